@@ -90,6 +90,51 @@ namespace gz
     void GZ_SIM_VISIBLE
     set(msgs::Time *_msg, const std::chrono::steady_clock::duration &_in);
 
+    /// \brief Helper function that sets a mutable msgs::Geometry object
+    /// to the values contained in a sdf::Geometry object. Unlike the
+    /// by-value convert, this fills a caller-owned message in place, so
+    /// repeated calls reuse its submessage storage (or its arena, when the
+    /// message lives on one) instead of allocating a fresh message tree.
+    /// \param[out] _msg Geometry message to set.
+    /// \param[in] _in SDF geometry.
+    void GZ_SIM_VISIBLE
+    set(msgs::Geometry *_msg, const sdf::Geometry &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Material object
+    /// to the values contained in a sdf::Material object.
+    /// \param[out] _msg Material message to set.
+    /// \param[in] _in SDF material.
+    void GZ_SIM_VISIBLE
+    set(msgs::Material *_msg, const sdf::Material &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Light object
+    /// to the values contained in a sdf::Light object.
+    /// \param[out] _msg Light message to set.
+    /// \param[in] _in SDF light.
+    void GZ_SIM_VISIBLE
+    set(msgs::Light *_msg, const sdf::Light &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Scene object
+    /// to the values contained in a sdf::Scene object.
+    /// \param[out] _msg Scene message to set.
+    /// \param[in] _in SDF scene.
+    void GZ_SIM_VISIBLE
+    set(msgs::Scene *_msg, const sdf::Scene &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Plugin object
+    /// to the values contained in a sdf::Plugin object.
+    /// \param[out] _msg Plugin message to set.
+    /// \param[in] _in SDF plugin.
+    void GZ_SIM_VISIBLE
+    set(msgs::Plugin *_msg, const sdf::Plugin &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Plugin object
+    /// to the values contained in a plugin sdf::Element.
+    /// \param[out] _msg Plugin message to set.
+    /// \param[in] _in Plugin SDF element.
+    void GZ_SIM_VISIBLE
+    set(msgs::Plugin *_msg, const sdf::Element &_in);
+
     /// \brief Generic conversion from an SDF geometry to another type.
     /// \param[in] _in SDF geometry.
     /// \return Conversion result.
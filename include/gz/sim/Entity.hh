@@ -59,6 +59,37 @@ namespace gz
 
     /// \brief Indicates a non-existant or invalid Entity.
     const Entity kNullEntity{0};
+
+    /// \brief Number of high bits of an Entity that hold the generation
+    /// counter when entity ID recycling is enabled. The remaining low bits
+    /// hold the entity index. With recycling disabled (the default), the
+    /// generation is always zero and an Entity is just its index.
+    /// \sa EntityComponentManager::SetEntityIdRecycling
+    const uint64_t kEntityGenerationBits{16};
+
+    /// \brief Number of low bits of an Entity that hold the entity index.
+    const uint64_t kEntityIndexBits{64u - kEntityGenerationBits};
+
+    /// \brief Bitmask selecting the index part of an Entity.
+    const Entity kEntityIndexMask{(Entity(1) << kEntityIndexBits) - 1};
+
+    /// \brief Get the index part of an entity ID.
+    /// \param[in] _entity The entity.
+    /// \return The entity's index.
+    inline Entity entityIndex(Entity _entity)
+    {
+      return _entity & kEntityIndexMask;
+    }
+
+    /// \brief Get the generation part of an entity ID. The generation is
+    /// incremented each time an index is recycled, so references to a
+    /// removed entity never alias the entity that later reuses its index.
+    /// \param[in] _entity The entity.
+    /// \return The entity's generation.
+    inline uint64_t entityGeneration(Entity _entity)
+    {
+      return _entity >> kEntityIndexBits;
+    }
     }
   }
 }
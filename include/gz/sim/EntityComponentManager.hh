@@ -20,6 +20,8 @@
 #include <gz/msgs/serialized.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
 
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -233,9 +235,91 @@ namespace gz
               bool RemoveComponent(Entity _entity);
 
       /// \brief Rebuild all the views. This could be an expensive
-      /// operation.
+      /// operation. Views are normally maintained incrementally as entities
+      /// and components are added and removed, so this should rarely be
+      /// needed.
       public: void RebuildViews();
 
+      /// \brief Get the number of operations that were handled by
+      /// incremental view maintenance instead of triggering a full
+      /// RebuildViews. This is useful for confirming that bulk operations
+      /// (such as removing all entities) are not causing view
+      /// reconstruction stalls.
+      /// \return The number of avoided full view rebuilds.
+      public: uint64_t RebuildViewsAvoidedCount() const;
+
+      /// \brief Enable or disable packed view storage. When enabled, Each()
+      /// iterates over contiguous arrays of entities and component pointers
+      /// instead of performing a per-entity map lookup, which significantly
+      /// reduces cache misses for worlds with large entity counts. The packed
+      /// arrays are rebuilt lazily whenever a view's entity membership
+      /// changes, so this mode is best suited for worlds where the set of
+      /// entities matched by a view changes infrequently relative to how
+      /// often the view is iterated.
+      ///
+      /// Packed view storage can also be enabled by setting the
+      /// GZ_SIM_PACKED_VIEW_STORAGE environment variable to a non-empty
+      /// value before the EntityComponentManager is constructed.
+      /// \param[in] _packed True to enable packed view storage, false to use
+      /// the default per-entity map storage.
+      /// \sa PackedViewStorage
+      public: void SetPackedViewStorage(bool _packed);
+
+      /// \brief Get whether packed view storage is enabled.
+      /// \return True if Each() iterates views through packed, contiguous
+      /// arrays. False otherwise.
+      /// \sa SetPackedViewStorage
+      public: bool PackedViewStorage() const;
+
+      /// \brief Enable or disable deterministic EachParallel. When enabled,
+      /// EachParallel visits entities serially in packed storage order
+      /// instead of dispatching chunks over worker threads, so callbacks
+      /// that accumulate results observe entities in a stable,
+      /// machine-independent order. Disabled by default.
+      /// \param[in] _deterministic True to run EachParallel serially.
+      /// \sa EachParallelDeterministic
+      public: void SetEachParallelDeterministic(bool _deterministic);
+
+      /// \brief Get whether deterministic EachParallel is enabled.
+      /// \return True if EachParallel runs serially in packed order.
+      /// \sa SetEachParallelDeterministic
+      public: bool EachParallelDeterministic() const;
+
+      /// \brief Enable or disable entity ID recycling. When enabled, the
+      /// indices of removed entities are kept on a free list and reused by
+      /// CreateEntity with an incremented generation counter in the ID's
+      /// high bits (see kEntityGenerationBits), so long-running
+      /// spawn/despawn workloads stop growing every entity-keyed container
+      /// without bound. A recycled ID is always a new, distinct Entity
+      /// value, so stale references to the removed entity never alias the
+      /// new one. Disabled by default: IDs are then handed out
+      /// monotonically, which log playback and users of
+      /// SetEntityCreateOffset rely on.
+      /// \param[in] _enable True to recycle entity IDs.
+      /// \sa EntityIdRecycling, entityIndex, entityGeneration
+      public: void SetEntityIdRecycling(bool _enable);
+
+      /// \brief Get whether entity ID recycling is enabled.
+      /// \return True if removed entity indices are recycled.
+      /// \sa SetEntityIdRecycling
+      public: bool EntityIdRecycling() const;
+
+      /// \brief Begin a batched entity creation transaction. While a batch
+      /// is open, newly created components do not update view membership
+      /// individually; the affected entities are staged and matched against
+      /// all views once when the batch is committed. This amortizes view
+      /// maintenance when creating many entities with many components each,
+      /// such as loading a whole model or world. Batches may be nested;
+      /// only the outermost commit flushes the staged entities.
+      /// \sa CommitEntityBatch
+      public: void BeginEntityBatch();
+
+      /// \brief Commit a batched entity creation transaction, updating view
+      /// membership for every entity that had components created since the
+      /// matching BeginEntityBatch call.
+      /// \sa BeginEntityBatch
+      public: void CommitEntityBatch();
+
       /// \brief Create a component of a particular type. This will copy the
       /// _data parameter.
       /// \param[in] _entity The entity that will be associated with
@@ -294,7 +378,9 @@ namespace gz
       /// * If the component type doesn't hold any data, this won't compile.
       /// * If the entity doesn't have that component, the component will be
       ///   created.
-      /// * If the entity has the component, its data will be updated.
+      /// * If the entity has the component, its data will be updated and,
+      ///   if it changed, recorded as a periodic change — the same
+      ///   tracking SetComponentDataBatch applies.
       /// \param[in] _entity The entity.
       /// \param[in] _data New component data
       /// \tparam ComponentTypeT Component type
@@ -304,6 +390,38 @@ namespace gz
               bool SetComponentData(const Entity _entity,
               const typename ComponentTypeT::Type &_data);
 
+      /// \brief Set the data of one component type on a batch of entities.
+      /// This behaves like calling SetComponentData for each (entity, data)
+      /// pair, except that change tracking for the whole batch is committed
+      /// in a single SetChanged call, so the per-type tracking structures
+      /// are resolved once instead of once per entity. Entities that don't
+      /// have the component yet get it created. Intended for per-step bulk
+      /// writers such as the physics pose writeback.
+      /// \param[in] _batch Entities and the data to assign to each of them.
+      /// \param[in] _c Change state to record for entities whose data
+      /// changed, defaults to a periodic change.
+      /// \tparam ComponentTypeT Component type
+      public: template<typename ComponentTypeT>
+              void SetComponentDataBatch(
+              const std::vector<
+                  std::pair<Entity, typename ComponentTypeT::Type>> &_batch,
+              const sim::ComponentState _c = ComponentState::PeriodicChange);
+
+      /// \brief Create one component type on a batch of entities. This
+      /// behaves like calling CreateComponent for each (entity, data)
+      /// pair, except that the per-type bookkeeping — the type
+      /// registration check and the one-time change tracking lookup — is
+      /// resolved once for the whole batch instead of once per entity.
+      /// Intended for bulk loaders such as SdfEntityCreator installing
+      /// the initial poses of a whole world at once.
+      /// \param[in] _batch Entities and the data each component is
+      /// constructed from.
+      /// \tparam ComponentTypeT Component type
+      public: template<typename ComponentTypeT>
+              void CreateComponentBatch(
+              const std::vector<
+                  std::pair<Entity, typename ComponentTypeT::Type>> &_batch);
+
       /// \brief Get the type IDs of all components attached to an entity.
       /// \param[in] _entity Entity to check.
       /// \return All the component type IDs.
@@ -447,6 +565,44 @@ namespace gz
                   bool(const Entity &_entity,
                        ComponentTypeTs *...)>>::type _f);
 
+      /// \brief A parallel version of Each(). The entities that match the
+      /// given component types are partitioned into contiguous chunks, and
+      /// the chunks are processed concurrently by a set of worker threads
+      /// that are joined before this function returns. Unlike Each(), the
+      /// callback cannot stop iteration early, so it returns void.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired component types,
+      /// in the order they're listed on the template. The callback must be
+      /// safe to invoke concurrently from multiple threads: it must not
+      /// create or remove entities or components, and any state it shares
+      /// across invocations must be synchronized by the caller. This
+      /// function iterates the view's packed storage, whose lazy rebuild is
+      /// synchronized internally, so concurrent calls from systems running
+      /// their PostUpdates in parallel are safe.
+      /// \tparam ComponentTypeTs All the desired component types.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  void(const Entity &_entity,
+                       const ComponentTypeTs *...)>>::type _f) const;
+
+      /// \brief A parallel version of Each() with mutable component access.
+      /// See the const overload for the threading contract. Since distinct
+      /// entities are processed by distinct threads, mutating the components
+      /// of the entity passed to the callback is safe without additional
+      /// synchronization; mutating any other entity's components is not.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired mutable
+      /// component types, in the order they're listed on the template.
+      /// \tparam ComponentTypeTs All the desired mutable component types.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  void(const Entity &_entity,
+                       ComponentTypeTs *...)>>::type _f);
+
       /// \brief Call a function for each parameter in a pack.
       /// \param[in] _f Function to be called.
       /// \param[in] _components Parameters which should be passed to the
@@ -561,6 +717,15 @@ namespace gz
       /// \return True if there are any components with periodic changes.
       public: bool HasPeriodicComponentChanges() const;
 
+      /// \brief Get the entities whose component of the given type is
+      /// currently marked as changed, combining one-time and periodic
+      /// changes. The sets are valid until SetAllComponentsUnchanged is
+      /// called, typically at the end of the current iteration.
+      /// \param[in] _typeId Component type to query.
+      /// \param[out] _entities Set the changed entities are inserted into.
+      public: void ChangedEntities(const ComponentTypeId _typeId,
+                  std::unordered_set<Entity> &_entities) const;
+
       /// \brief Get the components types that are marked as periodic changes.
       /// \return All the components that at least one entity marked as
       /// periodic changes.
@@ -633,6 +798,18 @@ namespace gz
       /// responsibility of the caller to timestamp it before use.
       public: void ChangedState(msgs::SerializedStateMap &_state) const;
 
+      /// \brief Serialize the changed state directly into a caller-provided
+      /// flat buffer in protobuf wire format. The buffer's capacity is
+      /// reused across calls and an internal scratch message recycles its
+      /// heap blocks between snapshots, so steady-state snapshots perform no
+      /// allocations. The resulting bytes are a serialized
+      /// msgs::SerializedStateMap and can be handed directly to
+      /// gz::transport::Node::Publisher::PublishRaw or written to a log
+      /// without being re-copied through another message tree.
+      /// \param[out] _buffer Buffer to fill with the serialized changed
+      /// state. The buffer is cleared first; it is empty if nothing changed.
+      public: void ChangedState(std::string &_buffer) const;
+
       /// \brief Set the absolute state of the ECM from a serialized message.
       /// Entities / components that are in the new state but not in the old
       /// one will be created.
@@ -651,6 +828,18 @@ namespace gz
           const Entity _entity, const ComponentTypeId _type,
           sim::ComponentState _c = ComponentState::OneTimeChange);
 
+      /// \brief Set the changed state of one component type on many
+      /// entities at once. Equivalent to calling SetChanged for each
+      /// entity, but the per-type tracking structures are resolved once
+      /// for the whole batch.
+      /// \param[in] _type Type of the component.
+      /// \param[in] _entities Entities whose component of type _type
+      /// changed.
+      /// \param[in] _c Changed state value.
+      public: void SetChanged(
+          const ComponentTypeId _type, const std::vector<Entity> &_entities,
+          sim::ComponentState _c);
+
       /// \brief Get a component's state.
       /// \param[in] _entity Entity that contains the component.
       /// \param[in] _typeId Component type ID.
@@ -667,10 +856,63 @@ namespace gz
       /// \brief Given a diff, apply it to this ECM. Note that for removed
       /// entities, this would mark them for removal instead of actually
       /// removing the entities.
+      ///
+      /// When component mutation tracking is enabled, the reset is applied
+      /// in place using the recorded mutations, so its cost is proportional
+      /// to what changed since tracking started instead of the world size.
       /// \param[in] _other Original EntityComponentManager from which the diff
       /// was computed.
+      /// \sa SetComponentMutationTracking
       public: void ResetTo(const EntityComponentManager &_other);
 
+      /// \brief Enable or disable component mutation tracking. While
+      /// enabled, every component creation, removal and change notification
+      /// is recorded, and ResetTo restores the snapshot by applying only the
+      /// recorded deltas instead of copying the entire world. Enabling
+      /// (re)starts the record, so this should be turned on right after
+      /// taking the snapshot that will later be passed to ResetTo. Component
+      /// data modified without notifying the ECM (e.g. through a mutable
+      /// component pointer without a SetChanged call) is not recorded and
+      /// will not be restored.
+      /// \param[in] _enable True to enable tracking.
+      public: void SetComponentMutationTracking(bool _enable);
+
+      /// \brief Get whether component mutation tracking is enabled.
+      /// \return True if tracking is enabled.
+      /// \sa SetComponentMutationTracking
+      public: bool ComponentMutationTracking() const;
+
+      /// \brief Enable or disable per-component-type change-rate counters.
+      /// While enabled, every component creation, removal and change
+      /// notification increments a counter for the component's type, at the
+      /// cost of one map increment per mark. Enabling (re)starts the
+      /// counters and the wall-clock window. This makes it possible to spot
+      /// a system that marks a component type changed every step, which
+      /// defeats the changed-state delta machinery, without instrumenting
+      /// the systems themselves. Disabled by default; can also be enabled
+      /// by setting the GZ_SIM_CHANGE_RATE_TRACKING environment variable to
+      /// a non-empty value before the manager is constructed.
+      /// \param[in] _enable True to enable the counters.
+      /// \sa ChangeRateCounters
+      public: void SetChangeRateTracking(bool _enable);
+
+      /// \brief Get whether change-rate counters are enabled.
+      /// \return True if counters are accumulating.
+      /// \sa SetChangeRateTracking
+      public: bool ChangeRateTracking() const;
+
+      /// \brief Get the number of times each component type was created,
+      /// removed or marked changed since tracking was last (re)started.
+      /// \return Counters keyed by component type ID.
+      /// \sa SetChangeRateTracking, ChangeRateWindow
+      public: std::map<ComponentTypeId, uint64_t> ChangeRateCounters() const;
+
+      /// \brief Get the wall-clock time elapsed since change-rate tracking
+      /// was last (re)started, for converting the counters to rates.
+      /// \return Elapsed time, or zero if tracking is disabled.
+      /// \sa ChangeRateCounters
+      public: std::chrono::steady_clock::duration ChangeRateWindow() const;
+
       /// \brief Return true if there are components marked for removal.
       /// \return True if there are components marked for removal.
       public: bool HasRemovedComponents() const;
@@ -683,6 +925,109 @@ namespace gz
       public: std::optional<Entity> EntityByName(
                   const std::string &_name) const;
 
+      /// \brief Get a counter that increments whenever the entity hierarchy
+      /// or entity naming changes: on entity creation and removal, and on
+      /// creation or removal of Name and ParentEntity components. Callers
+      /// can compare epochs to cheaply invalidate caches derived from the
+      /// entity tree.
+      /// \note Modifying the data of an existing Name component in place is
+      /// not detected.
+      /// \return The current epoch.
+      public: uint64_t EntityStructureEpoch() const;
+
+      /// \brief Get all entities matching a scoped name: the first name may
+      /// match an entity at any depth, and each subsequent name must match
+      /// a direct child of the previous match. The lookup is a hash probe
+      /// into an index that is rebuilt lazily after structural changes, so
+      /// repeated queries don't walk the entity tree.
+      /// \param[in] _scopedName Scoped name of the entities to find.
+      /// \param[in] _delim Delimiter between names, defaults to "::".
+      /// \param[in] _relativeTo Entity the scoped name is relative to. The
+      /// scoped name does not include the name of this entity. Defaults to
+      /// matching anywhere in the tree.
+      /// \return All matching entities, or an empty set if none match.
+      public: std::unordered_set<Entity> EntitiesByScopedName(
+                  const std::string &_scopedName,
+                  const std::string &_delim = "::",
+                  Entity _relativeTo = kNullEntity) const;
+
+      /// \brief Intern a name string and get its symbol. The same string
+      /// always maps to the same symbol for the lifetime of this manager,
+      /// so callers can resolve names they compare against once and then
+      /// compare 32-bit symbols instead of strings in hot paths. Symbol 0
+      /// is the empty name.
+      /// \param[in] _name Name to intern.
+      /// \return Symbol of the name.
+      public: uint32_t NameSymbol(const std::string &_name) const;
+
+      /// \brief Get the string a symbol was interned from, for display
+      /// code.
+      /// \param[in] _symbol Symbol to look up.
+      /// \return The interned string, or the empty string for symbol 0 and
+      /// for symbols that were never handed out. The reference stays valid
+      /// for the lifetime of this manager.
+      public: const std::string &SymbolString(uint32_t _symbol) const;
+
+      /// \brief Get the symbol of an entity's name.
+      /// \param[in] _entity Entity to query.
+      /// \return Symbol of the entity's Name component data, or 0 if the
+      /// entity has no Name component.
+      public: uint32_t EntityNameSymbol(Entity _entity) const;
+
+      /// \brief Storage statistics for one component type.
+      /// \sa MemoryStatistics
+      public: struct ComponentTypeStats
+      {
+        /// \brief Name of the component type, as registered with the factory
+        public: std::string name;
+
+        /// \brief Number of live components of this type
+        public: std::size_t count{0};
+
+        /// \brief Number of components of this type that are marked as
+        /// removed but still occupy storage
+        public: std::size_t markedRemovedCount{0};
+
+        /// \brief Estimated bytes used by components of this type,
+        /// including dynamically allocated string payloads.
+        /// \sa components::BaseComponent::SizeBytes
+        public: std::size_t sizeBytes{0};
+      };
+
+      /// \brief Aggregate storage statistics for the whole manager.
+      /// \sa MemoryStatistics
+      public: struct MemoryStats
+      {
+        /// \brief Number of entities
+        public: std::size_t entityCount{0};
+
+        /// \brief Total number of live components
+        public: std::size_t componentCount{0};
+
+        /// \brief Total estimated component bytes, the sum of
+        /// ComponentTypeStats::sizeBytes over all types
+        public: std::size_t componentSizeBytes{0};
+
+        /// \brief Number of views cached for Each queries
+        public: std::size_t viewCount{0};
+
+        /// \brief Total number of entities cached across all views. Each
+        /// cached entity also holds a tuple of component pointers.
+        public: std::size_t viewEntityCount{0};
+
+        /// \brief Per-type statistics, keyed by component type ID
+        public: std::map<ComponentTypeId, ComponentTypeStats> componentTypes;
+      };
+
+      /// \brief Get statistics about where the manager's memory goes:
+      /// per-type component counts and byte estimates, and the number of
+      /// entities cached by views. The byte counts are estimates based on
+      /// components::BaseComponent::SizeBytes and do not include the
+      /// manager's own bookkeeping maps. This walks all component storage,
+      /// so it is meant for introspection tools, not for use every step.
+      /// \return The statistics.
+      public: MemoryStats MemoryStatistics() const;
+
       /// \brief Clear the list of newly added entities so that a call to
       /// EachAdded after this will have no entities to iterate. This function
       /// is protected to facilitate testing.
@@ -744,6 +1089,32 @@ namespace gz
                    const ComponentTypeId _componentTypeId,
                    const components::BaseComponent *_data);
 
+      /// \brief Implementation of CreateComponentBatch. Per-type
+      /// bookkeeping is hoisted out of the per-entity loop; entities that
+      /// already had a component of this type fall back to
+      /// CreateComponentImplementation individually.
+      /// \param[in] _componentTypeId Id of the component type.
+      /// \param[in] _batch Entities and the data to construct each
+      /// component from. The pointers only need to stay valid for the
+      /// duration of the call.
+      /// \return Entities whose component data needs to be set externally,
+      /// i.e. entities that re-used a pre-existing component instance.
+      private: std::vector<Entity> CreateComponentBatchImplementation(
+                   const ComponentTypeId _componentTypeId,
+                   const std::vector<std::pair<Entity,
+                       const components::BaseComponent *>> &_batch);
+
+      /// \brief Copy all components of one entity onto another in a single
+      /// pass over the source entity's component storage, preserving the
+      /// source slot order. The Name and ParentEntity components are
+      /// skipped; Clone handles those explicitly. Change tracking and view
+      /// maintenance run once for the destination entity instead of once
+      /// per component.
+      /// \param[in] _from Source entity.
+      /// \param[in] _to Destination entity, assumed freshly created with
+      /// no components other than Name and ParentEntity.
+      private: void CloneComponents(const Entity _from, const Entity _to);
+
       /// \brief Get a component based on a component type.
       /// \param[in] _entity The entity.
       /// \param[in] _type Id of the component type.
@@ -762,6 +1133,18 @@ namespace gz
                    const Entity _entity,
                    const ComponentTypeId _type);
 
+      /// \brief Resolve a component through the flat per-entity pointer
+      /// table using the component type's dense registration index, avoiding
+      /// the unordered_map probes of ComponentImplementation. A nullptr
+      /// result is not authoritative; callers should fall back to
+      /// ComponentImplementation.
+      /// \param[in] _entity The entity.
+      /// \param[in] _typeIndex Dense index of the component type, i.e.
+      /// ComponentTypeT::typeIndex.
+      /// \return The component, or nullptr if it is not in the table.
+      private: components::BaseComponent *ComponentFastPath(
+                   const Entity _entity, const std::size_t _typeIndex) const;
+
       /// \brief Find a View that matches the set of ComponentTypeIds. If
       /// a match is not found, then a new view is created.
       /// \tparam ComponentTypeTs All the component types that define a view.
@@ -814,6 +1197,11 @@ namespace gz
           const std::unordered_set<ComponentTypeId> &_types = {},
           bool _full = false) const;
 
+      /// \brief Rebuild the scoped name index if the entity structure has
+      /// changed since it was last built. Must be called with the scoped
+      /// name mutex held.
+      private: void RefreshScopedNameIndex() const;
+
       /// \brief Set whether views should be locked when entities are being
       /// added to them. This can be used to prevent race conditions in
       /// system PostUpdates, since these are run in parallel (entities are
@@ -62,6 +62,39 @@ namespace gz
       /// \brief Destructor
       public: ~EventManager() = default;
 
+      /// \brief Get a direct reference to the event object of type E,
+      /// creating it if it does not exist yet.
+      ///
+      /// The returned reference remains valid for the lifetime of this
+      /// EventManager, so callers that signal an event every step can
+      /// resolve the channel once (e.g. at Configure time) and then emit
+      /// through it directly, skipping the type-indexed lookup on the hot
+      /// path:
+      ///
+      /// \code
+      /// events::PreRender &preRender =
+      ///     eventMgr.Channel<events::PreRender>();
+      /// // ... per step:
+      /// preRender.Signal();
+      /// \endcode
+      ///
+      /// Connect and Emit remain available for events that are emitted
+      /// rarely.
+      /// \return Reference to the event of type E.
+      public: template <typename E>
+              E &Channel()
+              {
+                auto iter = this->events.find(typeid(E));
+                if (iter == this->events.end())
+                {
+                  iter = this->events.emplace(typeid(E),
+                      std::make_unique<E>()).first;
+                }
+                // Entries are keyed by the concrete event type, so the
+                // stored object is always an E.
+                return *static_cast<E *>(iter->second.get());
+              }
+
       /// \brief Add a connection to an event.
       /// \param[in] _subscriber A std::function callback function. The function
       ///   signature must match that of the event (template parameter E).
@@ -71,23 +104,7 @@ namespace gz
               gz::common::ConnectionPtr
               Connect(const typename E::CallbackT &_subscriber)
               {
-                if (this->events.find(typeid(E)) == this->events.end()) {
-                  this->events[typeid(E)] = std::make_unique<E>();
-                }
-
-                E *eventPtr = dynamic_cast<E *>(this->events[typeid(E)].get());
-                // All values in the map should be derived from Event,
-                // so this shouldn't be an issue, but it doesn't hurt to check.
-                if (eventPtr != nullptr)
-                {
-                  return eventPtr->Connect(_subscriber);
-                }
-                else
-                {
-                  gzerr << "Failed to connect event: "
-                    << typeid(E).name() << std::endl;
-                  return nullptr;
-                }
+                return this->Channel<E>().Connect(_subscriber);
               }
 
       /// \brief Emit an event signal to connected subscribers.
@@ -96,29 +113,7 @@ namespace gz
       public: template <typename E, typename ... Args>
               void Emit(Args && ... _args)
               {
-                if (this->events.find(typeid(E)) == this->events.end())
-                {
-                  // If there are no events of type E in the map, create it.
-                  // But it also means there is nothing to signal.
-                  //
-                  // This is also needed to suppress unused function warnings
-                  // for Events that are purely emitted, with no connections.
-                  this->events[typeid(E)] = std::make_unique<E>();
-                  return;
-                }
-
-                E *eventPtr = dynamic_cast<E *>(this->events[typeid(E)].get());
-                // All values in the map should be derived from Event,
-                // so this shouldn't be an issue, but it doesn't hurt to check.
-                if (eventPtr != nullptr)
-                {
-                  eventPtr->Signal(std::forward<Args>(_args) ...);
-                }
-                else
-                {
-                  gzerr << "Failed to signal event: "
-                    << typeid(E).name() << std::endl;
-                }
+                this->Channel<E>().Signal(std::forward<Args>(_args) ...);
               }
 
       /// \brief Get connection count for a particular event
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_PUBLISHQUEUE_HH_
+#define GZ_SIM_PUBLISHQUEUE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <gz/transport/Node.hh>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/Export.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    // Forward declarations.
+    class PublishQueuePrivate;
+
+    /// \class PublishQueue PublishQueue.hh gz/sim/PublishQueue.hh
+    /// \brief Offloads transport publication from the simulation step.
+    ///
+    /// transport::Node::Publisher::Publish serializes the message inline,
+    /// so systems publishing from their update callbacks pay serialization
+    /// on the step critical path. Systems can instead move their message
+    /// into this queue; a dedicated I/O thread performs the serialization
+    /// and publication. Messages are published in enqueue order.
+    ///
+    /// The queue is bounded. When producers outrun the I/O thread the
+    /// oldest queued message is dropped instead of blocking the
+    /// simulation, and the drop is counted in Stats. The capacity defaults
+    /// to 1024 messages and can be overridden with the
+    /// GZ_SIM_PUBLISH_QUEUE_CAPACITY environment variable.
+    class GZ_SIM_VISIBLE PublishQueue
+    {
+      /// \brief Interface for a type-erased queued message.
+      public: struct QueuedMessage
+      {
+        /// \brief Destructor
+        public: virtual ~QueuedMessage() = default;
+
+        /// \brief Serialize and publish the message.
+        public: virtual void Publish() = 0;
+      };
+
+      /// \brief Backpressure counters. All counters are cumulative since
+      /// process start except depth, which is the current queue length.
+      public: struct Statistics
+      {
+        /// \brief Messages accepted into the queue.
+        public: uint64_t enqueued{0};
+
+        /// \brief Messages serialized and published by the I/O thread.
+        public: uint64_t published{0};
+
+        /// \brief Messages dropped because the queue was full.
+        public: uint64_t dropped{0};
+
+        /// \brief Messages currently waiting in the queue.
+        public: std::size_t depth{0};
+
+        /// \brief Largest queue depth observed.
+        public: std::size_t highWater{0};
+      };
+
+      /// \brief Get the process-wide queue shared by all systems. The I/O
+      /// thread is started lazily on the first publication.
+      /// \return The shared queue.
+      public: static PublishQueue &Instance();
+
+      /// \brief Queue a message for publication. The publisher is copied,
+      /// which transport supports cheaply, and the message is moved in, so
+      /// the caller pays neither serialization nor a message copy.
+      /// \param[in] _pub Publisher to publish with.
+      /// \param[in] _msg Message to publish. Pass by move to avoid a copy.
+      public: template <typename MsgT>
+              void Publish(const transport::Node::Publisher &_pub,
+                  MsgT &&_msg)
+      {
+        using Msg = std::decay_t<MsgT>;
+        class Queued : public QueuedMessage
+        {
+          public: Queued(const transport::Node::Publisher &_p, MsgT &&_m)
+                  : pub(_p), msg(std::forward<MsgT>(_m))
+          {
+          }
+
+          public: void Publish() override
+          {
+            this->pub.Publish(this->msg);
+          }
+
+          private: transport::Node::Publisher pub;
+          private: Msg msg;
+        };
+        this->Enqueue(
+            std::make_unique<Queued>(_pub, std::forward<MsgT>(_msg)));
+      }
+
+      /// \brief Block until every queued message has been published.
+      public: void Flush();
+
+      /// \brief Publish every queued message and join the I/O thread.
+      /// Called by the server before transport teardown so no message
+      /// outlives the publishers it references; destruction does the same
+      /// as a backstop. After shutdown, Publish delivers inline on the
+      /// caller's thread.
+      public: void Shutdown();
+
+      /// \brief Get the current backpressure counters.
+      /// \return A snapshot of the counters.
+      public: Statistics Stats() const;
+
+      /// \brief Constructor. Private: use Instance.
+      private: PublishQueue();
+
+      /// \brief Destructor. Publishes the remaining queued messages and
+      /// joins the I/O thread.
+      private: ~PublishQueue();
+
+      /// \brief Queue a type-erased message, dropping the oldest queued
+      /// message if the queue is full.
+      /// \param[in] _msg Message to queue.
+      private: void Enqueue(std::unique_ptr<QueuedMessage> _msg);
+
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<PublishQueuePrivate> dataPtr;
+    };
+    }  // namespace GZ_SIM_VERSION_NAMESPACE
+  }  // namespace sim
+}  // namespace gz
+
+#endif  // GZ_SIM_PUBLISHQUEUE_HH_
@@ -18,6 +18,7 @@
 #define GZ_SIM_SERVER_HH_
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -162,6 +163,28 @@ namespace gz
       /// not being initialized, or if the server is already running.
       public: bool RunOnce(const bool _paused = true);
 
+      /// \brief Run a batch of simulation steps in a tight blocking loop,
+      /// aimed at maximum-throughput headless use. The steps execute in the
+      /// calling thread with the running state set once for the whole
+      /// batch, so repeated batches avoid the per-call thread creation and
+      /// condition-variable handshake of Run(). Simulation starts unpaused.
+      /// Only supported with a single simulation world and without
+      /// distributed simulation.
+      /// \param[in] _iterations Number of steps to perform. Must be greater
+      /// than zero.
+      /// \param[in] _callbackInterval Invoke _callback every this many
+      /// steps. A value of zero invokes it only after the final step.
+      /// \param[in] _callback Optional callback receiving the number of
+      /// steps executed so far. Return false from the callback to end the
+      /// batch early.
+      /// \return True if the batch ran to completion or was ended early by
+      /// the callback. False if the server is already running, has more
+      /// than one world, uses distributed simulation, or was terminated
+      /// before completing.
+      public: bool RunBatch(const uint64_t _iterations,
+                  const uint64_t _callbackInterval = 0,
+                  const std::function<bool(uint64_t)> &_callback = nullptr);
+
       /// \brief Get whether the server is running. The server can have zero
       /// or more simulation worlds, each of which may or may not be
       /// running. See Running(const unsigned int) to get the running status
@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <list>
+#include <map>
 #include <memory>
 #include <optional> // NOLINT(*)
 #include <string>
@@ -219,6 +220,149 @@ namespace gz
       /// \param[in] _levels Value to set.
       public: void SetUseLevels(const bool _levels);
 
+      /// \brief Get whether PostUpdate systems run asynchronously.
+      /// \return True if asynchronous PostUpdate is enabled.
+      public: bool UseAsyncPostUpdate() const;
+
+      /// \brief Set whether PostUpdate systems run asynchronously. When
+      /// enabled, changed component data is flipped into a read-only
+      /// snapshot at the end of the update phases, and PostUpdate systems
+      /// consume the snapshot while the next simulation step already runs.
+      /// This hides PostUpdate latency at the cost of maintaining the
+      /// snapshot, and PostUpdate systems observe the world one flip behind
+      /// mutations that were not flagged as changed. Disabled by default,
+      /// and ignored in distributed simulation.
+      /// \param[in] _async Value to set.
+      public: void SetUseAsyncPostUpdate(bool _async);
+
+      /// \brief Get whether the resolved world cache is enabled.
+      /// \return True if the world cache is enabled.
+      /// \sa SetUseWorldCache
+      public: bool UseWorldCache() const;
+
+      /// \brief Set whether to cache resolved worlds on disk. When
+      /// enabled and the world comes from an SDF file, the fully resolved
+      /// DOM, with its include tree flattened and resource URIs already
+      /// resolved, is stored keyed by a hash of the world file contents.
+      /// Later servers loading an unchanged file parse the cached DOM and
+      /// skip include resolution and resource fetching, which cuts startup
+      /// time for fleets that start many servers with identical worlds.
+      /// The cache trusts that resources referenced by the world, such as
+      /// included models, have not changed since the entry was written;
+      /// delete the cache directory after editing them. The cache lives in
+      /// GZ_SIM_WORLD_CACHE_DIR if set, otherwise in
+      /// $HOME/.gz/sim/world_cache. Disabled by default; the
+      /// GZ_SIM_WORLD_CACHE environment variable set to "1" also enables
+      /// it.
+      /// \param[in] _cache Value to set.
+      public: void SetUseWorldCache(bool _cache);
+
+      /// \brief Get whether delta-based world reset is enabled.
+      /// \return True if delta reset is enabled.
+      /// \sa SetUseDeltaReset
+      public: bool UseDeltaReset() const;
+
+      /// \brief Set whether world resets are applied as deltas. When
+      /// enabled, the ECM journals component mutations after the initial
+      /// snapshot and a reset restores only what the journal recorded,
+      /// so its cost is proportional to what changed instead of the world
+      /// size. The journal only sees mutations that notify the ECM
+      /// (SetChanged, SetComponentData and friends); components mutated
+      /// through raw pointers without notification are not restored, so
+      /// this stays opt-in until no system mutates components that way.
+      /// Disabled by default, which keeps the full-copy reset.
+      /// \param[in] _delta Value to set.
+      public: void SetUseDeltaReset(bool _delta);
+
+      /// \brief Get whether deterministic execution is enabled.
+      /// \return True if deterministic execution is enabled.
+      /// \sa SetDeterministic
+      public: bool Deterministic() const;
+
+      /// \brief Set whether execution should be deterministic. When
+      /// enabled, the parallel execution paths fall back to stable serial
+      /// orderings: update stages and PostUpdate systems run in
+      /// registration order on the main thread, asynchronous PostUpdate is
+      /// ignored, and EachParallel visits entities serially in packed
+      /// storage order. Combine with SetSeed to reproduce runs that draw
+      /// random numbers. Disabled by default.
+      /// \param[in] _deterministic Value to set.
+      public: void SetDeterministic(bool _deterministic);
+
+      /// \brief Get the CPUs the simulation threads are pinned to.
+      /// \return CPU indices, empty if no pinning is applied.
+      /// \sa SetCpuAffinity
+      public: const std::vector<unsigned int> &CpuAffinity() const;
+
+      /// \brief Set the CPUs the simulation threads may run on. When
+      /// non-empty, the simulation step thread and the PostUpdate worker
+      /// pool are pinned to these CPUs. On NUMA machines, listing the CPUs
+      /// of a single socket keeps the threads from migrating across nodes,
+      /// and first-touch allocation then places the world state they scan
+      /// on the same node. Empty by default (no pinning); ignored on
+      /// platforms without thread affinity support.
+      /// \param[in] _cpus CPU indices to pin to.
+      public: void SetCpuAffinity(const std::vector<unsigned int> &_cpus);
+
+      /// \brief Placement and scheduling policy for one category of
+      /// internal server thread.
+      public: struct ThreadPolicy
+      {
+        /// \brief Thread name, shown by tools such as top, perf and
+        /// tracing. Empty keeps the default name. Truncated to the
+        /// platform limit (15 characters on Linux).
+        public: std::string name;
+
+        /// \brief CPUs the thread may run on. Empty leaves the thread
+        /// unpinned (or under the process-wide CpuAffinity, if set).
+        public: std::vector<unsigned int> cpus;
+
+        /// \brief Scheduling class: "other", "fifo" or "rr". Empty keeps
+        /// the inherited class. The real-time classes usually require
+        /// CAP_SYS_NICE or an appropriate RLIMIT_RTPRIO.
+        public: std::string schedulingClass;
+
+        /// \brief Scheduling priority, used by the real-time classes.
+        public: int priority{0};
+      };
+
+      /// \brief Categories of internal server threads that a ThreadPolicy
+      /// can be applied to.
+      public: enum class ThreadCategory
+      {
+        /// \brief The per-world simulation step loop. This is the
+        /// latency-critical thread that runs the physics and all
+        /// synchronous systems.
+        Step,
+
+        /// \brief The PostUpdate worker pool threads.
+        PostUpdate,
+
+        /// \brief The sensors system's render thread.
+        SensorsRender,
+      };
+
+      /// \brief Set the policy applied to one category of internal
+      /// thread. Policies for the Step and PostUpdate categories are
+      /// applied by the simulation runner; the SensorsRender policy is
+      /// forwarded to the sensors system through its
+      /// GZ_SIM_RENDER_THREAD_* environment variables. A category with a
+      /// policy no longer falls back to the process-wide CpuAffinity.
+      /// Transport threads are created inside gz-transport and cannot be
+      /// controlled from here.
+      /// \param[in] _category Thread category the policy applies to.
+      /// \param[in] _policy Policy to apply.
+      /// \sa SetCpuAffinity
+      public: void SetThreadPolicy(ThreadCategory _category,
+                  const ThreadPolicy &_policy);
+
+      /// \brief Get the configured per-category thread policies.
+      /// \return Map of thread category to policy; categories without an
+      /// entry use the defaults.
+      /// \sa SetThreadPolicy
+      public: const std::map<ThreadCategory, ThreadPolicy>
+                  &ThreadPolicies() const;
+
       /// \brief Get whether the server is using the distributed sim system
       /// \return True if the server is set to use the distributed simulation
       /// system
@@ -369,6 +513,49 @@ namespace gz
       /// \return True if headless mode is enable, false otherwise.
       public: bool HeadlessRendering() const;
 
+      /// \brief Set whether the server should skip creation of render-only
+      /// components. When enabled, SdfEntityCreator does not create visual
+      /// entities, material components or the world's scene component, and
+      /// the scene broadcaster system disables itself. This shrinks the
+      /// entity component manager for headless runs where nothing consumes
+      /// the scene, at the cost of visual plugins not being loaded and GUI
+      /// clients not being able to attach. Disabled by default.
+      /// \param[in] _skip Set to true to skip render-only components.
+      public: void SetSkipSceneComponents(const bool _skip);
+
+      /// \brief Get whether the server should skip creation of render-only
+      /// components. See SetSkipSceneComponents.
+      /// \return True if render-only components are skipped.
+      public: bool SkipSceneComponents() const;
+
+      /// \brief Set whether the server should ask the kernel to back its
+      /// large allocations with transparent huge pages. Large worlds with
+      /// multi-gigabyte component storage spend a measurable fraction of
+      /// cycles in TLB misses; huge pages reduce that pressure. Only
+      /// effective on platforms with transparent huge page support.
+      /// Disabled by default.
+      /// \param[in] _hugePages Set to true to request huge pages.
+      public: void SetUseHugePages(const bool _hugePages);
+
+      /// \brief Get whether the server requests transparent huge pages.
+      /// See SetUseHugePages.
+      /// \return True if huge pages are requested.
+      public: bool UseHugePages() const;
+
+      /// \brief Set whether the server should prefault its memory during
+      /// load, so that page faults are paid while the world loads instead
+      /// of during the first simulation steps that touch the memory.
+      /// Requires a sufficient memory lock limit (RLIMIT_MEMLOCK on
+      /// Linux); the server warns and continues without prefaulting if
+      /// the limit is too low. Disabled by default.
+      /// \param[in] _prefault Set to true to prefault memory during load.
+      public: void SetPrefaultMemory(const bool _prefault);
+
+      /// \brief Get whether the server prefaults its memory during load.
+      /// See SetPrefaultMemory.
+      /// \return True if memory is prefaulted.
+      public: bool PrefaultMemory() const;
+
       /// \brief Set the render engine server plugin library.
       /// \param[in] _renderEngineServer File containing render engine library.
       public: void SetRenderEngineServer(
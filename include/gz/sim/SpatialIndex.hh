@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_SPATIALINDEX_HH_
+#define GZ_SIM_SPATIALINDEX_HH_
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Vector3.hh>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/EntityComponentManager.hh>
+#include <gz/sim/Export.hh>
+#include <gz/sim/Types.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    // Forward declarations.
+    class SpatialIndexPrivate;
+
+    /// \brief One hit returned by SpatialIndex::RayQuery.
+    struct RayHit
+    {
+      /// \brief Entity whose bounding box the ray entered.
+      Entity entity{kNullEntity};
+
+      /// \brief Distance along the ray to the box entry point. Zero when
+      /// the ray starts inside the box.
+      double distance{0.0};
+    };
+
+    /// \class SpatialIndex SpatialIndex.hh gz/sim/SpatialIndex.hh
+    /// \brief A headless spatial index over the entities of an
+    /// EntityComponentManager.
+    ///
+    /// The index maintains an AABB tree over every entity that has both a
+    /// pose and a geometry component (collisions and visuals), built
+    /// purely from ECM state — no gz-rendering scene is required, so it
+    /// works on machines without a GPU. Systems that need spatial queries
+    /// (logical cameras, performer detection, proximity triggers) can
+    /// share one index instead of each scanning every entity per update.
+    ///
+    /// Call Update once per step after poses settle. When the set of
+    /// indexed entities is unchanged the tree is refit in place; when
+    /// entities were added or removed it is rebuilt. Queries are read-only
+    /// and may run from several threads concurrently, but not concurrently
+    /// with Update.
+    ///
+    /// Geometry types without a finite bounding box (planes, heightmaps)
+    /// are not indexed. Mesh bounding boxes are resolved through the
+    /// common mesh cache.
+    class GZ_SIM_VISIBLE SpatialIndex
+    {
+      /// \brief Constructor
+      public: SpatialIndex();
+
+      /// \brief Destructor
+      public: ~SpatialIndex();
+
+      /// \brief Refresh the index from the current ECM state.
+      /// \param[in] _ecm Immutable reference to the ECM.
+      public: void Update(const EntityComponentManager &_ecm);
+
+      /// \brief Get the entities whose bounding box intersects an
+      /// axis-aligned box.
+      /// \param[in] _box Query box in world coordinates.
+      /// \return Intersecting entities, in no particular order.
+      public: std::vector<Entity> BoxQuery(
+          const math::AxisAlignedBox &_box) const;
+
+      /// \brief Get the entities whose bounding box intersects a sphere.
+      /// \param[in] _center Sphere center in world coordinates.
+      /// \param[in] _radius Sphere radius.
+      /// \return Intersecting entities, in no particular order.
+      public: std::vector<Entity> SphereQuery(
+          const math::Vector3d &_center, double _radius) const;
+
+      /// \brief Get the entities whose bounding box a ray passes through,
+      /// ordered by distance to the box entry point.
+      /// \param[in] _origin Ray origin in world coordinates.
+      /// \param[in] _direction Ray direction; does not need to be
+      /// normalized. Distances are reported in units of its length.
+      /// \param[in] _maxDistance Hits beyond this distance are discarded.
+      /// \return Hits sorted by ascending distance.
+      public: std::vector<RayHit> RayQuery(const math::Vector3d &_origin,
+          const math::Vector3d &_direction,
+          double _maxDistance = std::numeric_limits<double>::infinity())
+          const;
+
+      /// \brief Get the world bounding box of an indexed entity.
+      /// \param[in] _entity Entity to look up.
+      /// \return The entity's box, or nullopt if the entity is not in the
+      /// index.
+      public: std::optional<math::AxisAlignedBox> EntityBox(
+          const Entity _entity) const;
+
+      /// \brief Get the number of indexed entities.
+      /// \return Number of entries in the index.
+      public: std::size_t EntryCount() const;
+
+      /// \brief Private data pointer.
+      private: std::unique_ptr<SpatialIndexPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
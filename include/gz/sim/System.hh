@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_set>
 
 #include <gz/sim/config.hh>
 #include <gz/sim/EntityComponentManager.hh>
@@ -96,6 +97,11 @@ namespace gz
       public: constexpr static std::string_view kPriorityElementName =
           {"gz:system_priority"};
 
+      /// \brief Name of the XML element from which the update frequency
+      /// value will be parsed, in Hz.
+      public: constexpr static std::string_view kUpdateFrequencyElementName =
+          {"gz:system_update_frequency"};
+
       /// \brief Constructor
       public: System() = default;
 
@@ -163,6 +169,24 @@ namespace gz
       public: virtual System::PriorityType ConfigurePriority() = 0;
     };
 
+    /// \class ISystemConfigureUpdateFrequency ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system that declares a desired update
+    /// frequency lower than the simulation rate.
+    ///
+    /// ConfigureUpdateFrequency is called before the system is instantiated.
+    /// The simulation runner invokes the system's PreUpdate, Update and
+    /// PostUpdate phases only on steps where at least one period of
+    /// simulation time has elapsed since the system last ran; on all other
+    /// steps the system is skipped without being called, avoiding its
+    /// virtual-call and view-iteration overhead. It can still be overridden
+    /// by the XML frequency element.
+    class ISystemConfigureUpdateFrequency {
+      /// \brief Configure the default update frequency of the system.
+      /// \return Desired update frequency in Hz. Values less than or equal
+      /// to zero run the system every step.
+      public: virtual double ConfigureUpdateFrequency() = 0;
+    };
+
     /// \class ISystemConfigureParameters ISystem.hh gz/sim/System.hh
     /// \brief Interface for a system that declares parameters.
     ///
@@ -196,6 +220,40 @@ namespace gz
                                   EntityComponentManager &_ecm) = 0;
     };
 
+    /// \class ISystemComponentAccess ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system that declares which component types its
+    /// Update phase reads and writes.
+    ///
+    /// The declarations let the simulation runner execute the Update phases
+    /// of non-conflicting systems concurrently. Systems that do not
+    /// implement this interface are assumed to access every component type
+    /// and always run alone.
+    ///
+    /// The declarations are a contract: an Update implementation must not
+    /// touch component types outside its declared sets. A "write" covers
+    /// any operation that mutates a component or notifies the ECM of a
+    /// change — SetChanged, SetComponentData, SetComponentDataBatch, or
+    /// modifying component data through a mutable reference. Systems that
+    /// create or remove entities or components during Update should not
+    /// implement this interface.
+    ///
+    /// Change notifications mutate shared ECM bookkeeping that is not
+    /// synchronized for concurrent writers, so currently only systems
+    /// whose declared write set is empty are run concurrently; a system
+    /// that declares writes always runs alone. Write declarations still
+    /// document intent and keep writers ordered relative to readers.
+    class ISystemComponentAccess {
+      /// \brief Declare the component types the Update phase only reads.
+      /// \return Set of read component type IDs.
+      public: virtual std::unordered_set<ComponentTypeId>
+          UpdateComponentReads() const = 0;
+
+      /// \brief Declare the component types the Update phase writes.
+      /// \return Set of written component type IDs.
+      public: virtual std::unordered_set<ComponentTypeId>
+          UpdateComponentWrites() const = 0;
+    };
+
     /// \class ISystemPostUpdate ISystem.hh gz/sim/System.hh
     /// \brief Interface for a system that uses the PostUpdate phase
     class ISystemPostUpdate{
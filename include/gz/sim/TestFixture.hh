@@ -102,6 +102,17 @@ class GZ_SIM_VISIBLE TestFixture
   /// The `OnConfigure` callback is called immediately on finalize.
   public: TestFixture &Finalize();
 
+  /// \brief Convenience wrapper to run the server for a given number of
+  /// steps, blocking and unpaused. Finalizes the fixture if that hasn't
+  /// been done yet.
+  /// \param[in] _iterations Number of steps to run.
+  /// \param[in] _postUpdatePeriod Invoke the post-update callback only on
+  /// every Nth step during this run. Values greater than one let tight
+  /// stepping loops skip the callback cost on intermediate steps; the
+  /// other callbacks still fire every step. Defaults to every step.
+  /// \return False if the server was already running.
+  public: bool Step(uint64_t _iterations, uint64_t _postUpdatePeriod = 1);
+
   /// \brief Get pointer to underlying server.
   public: std::shared_ptr<sim::Server> Server() const;
 
@@ -20,12 +20,16 @@
 #include <gz/msgs/entity.pb.h>
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include <gz/common/Mesh.hh>
 #include <gz/math/Pose3.hh>
+#include <gz/math/SphericalCoordinates.hh>
+#include <gz/math/Vector3.hh>
 #include <sdf/Mesh.hh>
 
 #include "gz/sim/components/Environment.hh"
@@ -50,6 +54,113 @@ namespace gz
     math::Pose3d GZ_SIM_VISIBLE worldPose(const Entity &_entity,
         const EntityComponentManager &_ecm);
 
+    /// \brief Helper function to compute the world poses of a batch of
+    /// entities in a single pass. Equivalent to calling worldPose for each
+    /// entity, but every ancestor's pose is resolved once and shared by all
+    /// entities beneath it, so the cost is linear in the number of distinct
+    /// entities visited instead of quadratic in tree depth.
+    /// \param[in] _entities Entities to get world poses for
+    /// \param[in] _ecm Immutable reference to ECM.
+    /// \return Map of entity to world pose. Entities without a pose
+    /// component map to an identity pose.
+    std::unordered_map<Entity, math::Pose3d> GZ_SIM_VISIBLE worldPoses(
+        const std::vector<Entity> &_entities,
+        const EntityComponentManager &_ecm);
+
+    /// \brief Enable the shared world pose cache for _ecm. While the cache
+    /// is active, worldPose memoizes every pose it resolves, including
+    /// ancestor poses, so concurrent systems reading overlapping kinematic
+    /// chains each walk a chain at most once per step. The simulation
+    /// runner activates the cache around the PostUpdate phase, where poses
+    /// are immutable; callers activating it elsewhere must guarantee poses
+    /// do not change while it is active.
+    /// \param[in] _ecm The entity component manager the cache applies to.
+    GZ_SIM_VISIBLE void beginWorldPoseCache(const EntityComponentManager &_ecm);
+
+    /// \brief Deactivate and clear the shared world pose cache for _ecm.
+    /// Subsequent worldPose calls walk parent chains directly again.
+    /// \param[in] _ecm The entity component manager the cache applies to.
+    GZ_SIM_VISIBLE void endWorldPoseCache(const EntityComponentManager &_ecm);
+
+    /// \brief Snapshot of the world-singleton components that sensor and
+    /// force systems read every step. Refreshed once per step by the
+    /// simulation runner so systems can read these values without repeating
+    /// the world-entity component lookups in their update loops.
+    struct WorldConstants
+    {
+      /// \brief The world entity, or kNullEntity before the world exists.
+      Entity world{kNullEntity};
+
+      /// \brief World gravity vector. Valid when hasGravity is true.
+      math::Vector3d gravity;
+
+      /// \brief Whether the world has a Gravity component.
+      bool hasGravity{false};
+
+      /// \brief World magnetic field. Valid when hasMagneticField is true.
+      math::Vector3d magneticField;
+
+      /// \brief Whether the world has a MagneticField component.
+      bool hasMagneticField{false};
+
+      /// \brief Spherical coordinates of the world origin, or nullopt when
+      /// the world has none.
+      std::optional<math::SphericalCoordinates> sphericalCoordinates;
+
+      /// \brief The wind entity, or kNullEntity when the world has no wind.
+      Entity windEntity{kNullEntity};
+    };
+
+    /// \brief Get the world-constants snapshot for _ecm. The simulation
+    /// runner refreshes the snapshot at the start of every step, so within
+    /// system updates the returned values match what the same lookups
+    /// against the ECM would produce, without the per-call component
+    /// fetches. Callers outside the runner's update phases get a snapshot
+    /// populated on first use.
+    /// \param[in] _ecm The entity component manager being read.
+    /// \return The snapshot. The reference stays valid for the lifetime of
+    /// the manager.
+    GZ_SIM_VISIBLE const WorldConstants &worldConstants(
+        const EntityComponentManager &_ecm);
+
+    /// \brief Refresh the world-constants snapshot for _ecm from the
+    /// current component values. Called by the simulation runner once per
+    /// step before the update phases run; systems normally only read the
+    /// snapshot through worldConstants.
+    /// \param[in] _ecm The entity component manager to snapshot.
+    GZ_SIM_VISIBLE void refreshWorldConstants(
+        const EntityComponentManager &_ecm);
+
+    /// \brief World-frame kinematic state of a link, sampled in one pass.
+    struct LinkKinematics
+    {
+      /// \brief World pose of the link
+      math::Pose3d pose;
+
+      /// \brief Linear velocity of the link in the world frame
+      math::Vector3d linearVelocity;
+
+      /// \brief Angular velocity of the link in the world frame
+      math::Vector3d angularVelocity;
+    };
+
+    /// \brief Helper function to sample the world pose and world linear and
+    /// angular velocities of a link in a single pass. Systems that need all
+    /// three each step, such as the marine systems applying hydrodynamic and
+    /// thrust forces, can call this once instead of resolving the pose and
+    /// each velocity through separate queries. The velocities are read from
+    /// the WorldLinearVelocity and WorldAngularVelocity components, which
+    /// physics keeps updated once enabled, so callers must enable those
+    /// components at configure time (e.g. with enableComponent).
+    /// \param[in] _entity Link entity to sample
+    /// \param[in] _ecm Immutable reference to ECM.
+    /// \return The sampled kinematics, or nullopt if either velocity
+    /// component is missing from the entity. The pose is taken from the
+    /// WorldPose component when present and computed from the pose tree
+    /// otherwise.
+    std::optional<LinkKinematics> GZ_SIM_VISIBLE linkWorldKinematics(
+        const Entity &_entity, const EntityComponentManager &_ecm);
+
     /// \brief Helper function to compute world velocity of an entity
     /// \param[in] _entity Entity to get the world pose for
     /// \param[in] _ecm Immutable reference to ECM.
@@ -305,6 +416,20 @@ namespace gz
     std::optional<math::Vector3d> GZ_SIM_VISIBLE sphericalCoordinates(
         Entity _entity, const EntityComponentManager &_ecm);
 
+    /// \brief Get the spherical coordinates for an entity whose world pose
+    /// is already known, e.g. from a WorldPose component. Skips the pose
+    /// climb that the two-argument overload performs, which matters for
+    /// sensor systems converting many entities every step.
+    /// \param[in] _entity Entity whose coordinates we want.
+    /// \param[in] _ecm Entity component manager
+    /// \param[in] _worldPose The entity's world pose.
+    /// \return The entity's latitude (deg), longitude (deg) and elevation (m).
+    /// If the world's spherical coordinates haven't been defined, this will
+    /// return nullopt.
+    std::optional<math::Vector3d> GZ_SIM_VISIBLE sphericalCoordinates(
+        Entity _entity, const EntityComponentManager &_ecm,
+        const math::Pose3d &_worldPose);
+
     /// \brief Get grid field coordinates based on a world position in cartesian
     /// coordinate frames.
     /// \param[in] _ecm Entity Component Manager
@@ -327,6 +452,51 @@ namespace gz
     GZ_SIM_VISIBLE const common::Mesh *optimizeMesh(const sdf::Mesh &_meshSdf,
         const common::Mesh &_mesh);
 
+    /// \brief Pin the calling thread to a set of CPUs. On NUMA machines
+    /// this keeps a thread from migrating away from the memory it
+    /// first-touched. No-op on platforms without thread affinity support.
+    /// \param[in] _cpus CPU indices to pin to. An empty set leaves the
+    /// thread unpinned.
+    /// \return True if the affinity was applied.
+    GZ_SIM_VISIBLE bool applyCpuAffinity(
+        const std::vector<unsigned int> &_cpus);
+
+    /// \brief Apply a placement and scheduling policy to the calling
+    /// thread: a thread name (truncated to the platform limit), a CPU
+    /// affinity set and a scheduling class. Every part is optional; empty
+    /// values leave the corresponding attribute unchanged. The real-time
+    /// scheduling classes usually require CAP_SYS_NICE or an appropriate
+    /// RLIMIT_RTPRIO, and a warning is logged when they can't be applied.
+    /// \param[in] _name Thread name, empty to keep the current name.
+    /// \param[in] _cpus CPU indices to pin to, empty to leave unpinned.
+    /// \param[in] _schedulingClass "other", "fifo" or "rr"; empty keeps
+    /// the inherited class.
+    /// \param[in] _priority Scheduling priority for the real-time
+    /// classes, ignored for "other".
+    /// \return True if any part of the policy was applied.
+    GZ_SIM_VISIBLE bool applyThreadPolicy(const std::string &_name,
+        const std::vector<unsigned int> &_cpus,
+        const std::string &_schedulingClass, int _priority);
+
+    /// \brief Ask the kernel to back this process's large anonymous
+    /// memory regions with transparent huge pages. This clears any
+    /// inherited per-process THP disable flag and marks the heap and
+    /// large anonymous mappings with MADV_HUGEPAGE, which lets khugepaged
+    /// collapse already-populated small pages as well. Large worlds with
+    /// multi-gigabyte component storage see reduced dTLB pressure. Safe
+    /// to call more than once; call again after a load phase to cover
+    /// mappings created in between. No-op on platforms without THP.
+    /// \return True if the huge page policy was applied.
+    GZ_SIM_VISIBLE bool applyHugePagePolicy();
+
+    /// \brief Prefault this process's memory: lock current pages and
+    /// fault in future allocations as they are made, so that page faults
+    /// are paid during load instead of during simulation steps. Requires
+    /// a sufficient RLIMIT_MEMLOCK; fails gracefully without one. No-op
+    /// on platforms without mlockall.
+    /// \return True if prefaulting was enabled.
+    GZ_SIM_VISIBLE bool prefaultProcessMemory();
+
     /// \brief Environment variable holding resource paths.
     const std::string kResourcePathEnv{"GZ_SIM_RESOURCE_PATH"};
 
@@ -95,12 +95,26 @@ class GZ_SIM_VISIBLE MsgManager
   public: void AddInbound(const std::string &_address,
                           const msgs::DataframeSharedPtr &_msg);
 
+  /// \brief Add a new message to the inbound queue, taking ownership of
+  /// the message pointer.
+  /// \param[in] _address The destination address.
+  /// \param[in] _msg The message.
+  public: void AddInbound(const std::string &_address,
+                          msgs::DataframeSharedPtr &&_msg);
+
   /// \brief Add a new message to the outbound queue.
   /// \param[in] _address The sender address.
   /// \param[in] _msg The message.
   public: void AddOutbound(const std::string &_address,
                            const msgs::DataframeSharedPtr &_msg);
 
+  /// \brief Add a new message to the outbound queue, taking ownership of
+  /// the message pointer.
+  /// \param[in] _address The sender address.
+  /// \param[in] _msg The message.
+  public: void AddOutbound(const std::string &_address,
+                           msgs::DataframeSharedPtr &&_msg);
+
   /// \brief Remove an existing subscriber.
   /// \param[in] _address The subscriber address.
   /// \param[in] _topic The Subscriber topic.
@@ -141,10 +155,32 @@ class GZ_SIM_VISIBLE MsgManager
   /// \return A copy of the data.
   public: Registry Copy() const;
 
+  /// \brief Copy the data structure containing subscriptions and data
+  /// queues into an existing registry. Equivalent to assigning Copy() to
+  /// _dest, but reuses the queue and string storage _dest already owns, so
+  /// a registry that is stepped every iteration doesn't reallocate its
+  /// buffers each time.
+  /// \param[in, out] _dest The registry to copy into. Addresses that no
+  /// longer exist are removed from it.
+  public: void CopyInto(Registry &_dest) const;
+
   /// \brief Set the data structure containing subscriptions and data queues.
   /// \param[in] _newContent New content to be set.
   public: void Set(const Registry &_newContent);
 
+  /// \brief Set the data structure containing subscriptions and data queues
+  /// by moving from the given content.
+  /// \param[in] _newContent New content to be set. Left in a valid but
+  /// unspecified state.
+  public: void Set(Registry &&_newContent);
+
+  /// \brief Swap the data structure containing subscriptions and data
+  /// queues with an existing registry. Combined with CopyInto, this lets a
+  /// caller step the registry every iteration while recycling the previous
+  /// step's storage.
+  /// \param[in, out] _other The registry to swap with.
+  public: void Swap(Registry &_other);
+
   /// \brief Private data pointer.
   GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
 };
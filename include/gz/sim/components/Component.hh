@@ -17,13 +17,22 @@
 #ifndef GZ_SIM_COMPONENTS_COMPONENT_HH_
 #define GZ_SIM_COMPONENTS_COMPONENT_HH_
 
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 #include <string>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 
 #include <gz/common/Console.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Quaternion.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/utils/ImplPtr.hh>
+#include <gz/utils/NeverDestroyed.hh>
 
 #include <gz/sim/config.hh>
 #include <gz/sim/Export.hh>
@@ -96,6 +105,69 @@ namespace traits
     public: static constexpr bool value =  // NOLINT
                 decltype(Test<Stream, DataType>(0))::value;
   };
+
+  /// \brief Trait that registers a component data type as eligible for
+  /// bitwise serialization. Eligible types can be copied into the state
+  /// message byte-for-byte instead of being formatted through stream
+  /// operators, which turns the hot pose/velocity serialization in
+  /// SceneBroadcaster and LogRecord into a memcpy and preserves full
+  /// floating point precision. Only trivially copyable, self-contained
+  /// types (no pointers, handles or heap payload) may be registered, and
+  /// registrations must live in this header so that every translation
+  /// unit instantiates the component with the same encoding. Components
+  /// that pass a custom serializer are not affected.
+  ///
+  /// The text encoding remains the default: bitwise output is an opt-in
+  /// via GZ_SIM_BITWISE_COMPONENT_SERIALIZATION=1 because it assumes
+  /// both ends of a state exchange share an architecture, and it changes
+  /// the recorded log format. Every bitwise value is prefixed with a
+  /// marker byte that cannot start a text encoding, so Deserialize
+  /// detects the format per value and either build reads both formats.
+  template <typename DataType>
+  struct BitwiseSerializable : std::false_type
+  {
+  };
+
+  /// \brief Pose components (Pose, WorldPose, ...) are serialized bitwise.
+  template <>
+  struct BitwiseSerializable<math::Pose3d> : std::true_type
+  {
+  };
+
+  /// \brief Vector components (LinearVelocity, Gravity, ...) are
+  /// serialized bitwise.
+  template <>
+  struct BitwiseSerializable<math::Vector3d> : std::true_type
+  {
+  };
+
+  /// \brief Quaternion components are serialized bitwise.
+  template <>
+  struct BitwiseSerializable<math::Quaterniond> : std::true_type
+  {
+  };
+
+  /// \brief Marker byte prefixed to every bitwise-serialized value. The
+  /// text encodings of the registered types start with digits, signs or
+  /// whitespace, never with this byte, so readers can tell the formats
+  /// apart per value.
+  constexpr char kBitwiseSerializationMarker = '\x01';
+
+  /// \brief Whether bitwise component output is opted in through
+  /// GZ_SIM_BITWISE_COMPONENT_SERIALIZATION=1. Reading bitwise input is
+  /// always enabled; this only gates what Serialize emits.
+  /// \return True if bitwise output is enabled.
+  inline bool BitwiseSerializationEnabled()
+  {
+    static const bool enabled = []()
+    {
+      const char *value =
+          std::getenv("GZ_SIM_BITWISE_COMPONENT_SERIALIZATION");
+      return nullptr != value && (std::string(value) == "1" ||
+          std::string(value) == "true");
+    }();
+    return enabled;
+  }
 }
 
 namespace serializers
@@ -226,6 +298,65 @@ namespace serializers
 
 namespace components
 {
+  /// \brief Sentinel value for a component type index that has not been
+  /// assigned yet, i.e. the component type has not been registered.
+  /// \sa Component::typeIndex
+  constexpr std::size_t kComponentTypeIdxInvalid{
+      std::numeric_limits<std::size_t>::max()};
+
+  /// \brief A slab allocator for component objects. Components are small,
+  /// frequently allocated objects; routing them through the global allocator
+  /// one at a time fragments the heap on long spawn/despawn workloads.
+  /// The pool carves fixed-size chunks out of slabs, one free list per
+  /// power-of-two size class, and recycles freed chunks. All components
+  /// allocate through this pool via BaseComponent's class-level operator
+  /// new/delete.
+  class GZ_SIM_VISIBLE ComponentPool
+  {
+    /// \brief Occupancy statistics for the pool.
+    public: struct Stats
+    {
+      /// \brief Total number of bytes reserved by the pool's slabs.
+      public: std::size_t slabBytes{0};
+
+      /// \brief Total number of chunks carved out of the slabs.
+      public: std::size_t totalChunks{0};
+
+      /// \brief Number of chunks currently on the free lists.
+      public: std::size_t freeChunks{0};
+    };
+
+    /// \brief Get an instance of the singleton. A single process-wide pool
+    /// is used so that components allocated by one library can be freed by
+    /// another.
+    public: static ComponentPool *Instance();
+
+    /// \brief Allocate a chunk of at least _size bytes from the pool.
+    /// Requests larger than the largest size class fall back to the global
+    /// allocator.
+    /// \param[in] _size Number of bytes to allocate.
+    /// \return Pointer to the allocated memory.
+    public: void *Allocate(std::size_t _size);
+
+    /// \brief Return a chunk previously obtained from Allocate to the pool.
+    /// \param[in] _ptr The pointer to deallocate.
+    public: void Deallocate(void *_ptr);
+
+    /// \brief Get the pool's current occupancy statistics.
+    /// \return The pool statistics.
+    public: Stats PoolStats() const;
+
+    public: ComponentPool(const ComponentPool &) = delete;
+    public: void operator=(const ComponentPool &) = delete;
+
+    /// \brief Constructor. Use Instance instead.
+    private: ComponentPool();
+    friend gz::utils::NeverDestroyed<ComponentPool>;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+
   /// \brief Base class for all components.
   class BaseComponent
   {
@@ -235,6 +366,21 @@ namespace components
     /// \brief Default destructor.
     public: virtual ~BaseComponent() = default;
 
+    /// \brief Allocate component objects from the component pool.
+    /// \param[in] _size Number of bytes to allocate.
+    /// \return Pointer to the allocated memory.
+    public: static void *operator new(std::size_t _size)
+    {
+      return ComponentPool::Instance()->Allocate(_size);
+    }
+
+    /// \brief Return component memory to the component pool.
+    /// \param[in] _ptr The pointer to deallocate.
+    public: static void operator delete(void *_ptr)
+    {
+      ComponentPool::Instance()->Deallocate(_ptr);
+    }
+
     /// \brief Fills a stream with a serialized version of the component.
     /// By default, it will leave the stream empty. Derived classes should
     /// override this function to support serialization.
@@ -283,6 +429,15 @@ namespace components
     /// \brief Clone the component.
     /// \return A pointer to the component.
     public: virtual std::unique_ptr<BaseComponent> Clone() const = 0;
+
+    /// \brief Estimate the memory used by this component, including
+    /// dynamically allocated payload such as string storage.
+    /// \return Estimated size in bytes, or 0 if the derived component does
+    /// not provide an estimate.
+    public: virtual std::size_t SizeBytes() const
+    {
+      return 0u;
+    }
   };
 
   /// \brief A component type that wraps any data type. The intention is for
@@ -358,6 +513,9 @@ namespace components
     // Documentation inherited
     public: void Deserialize(std::istream &_in) override;
 
+    // Documentation inherited
+    public: std::size_t SizeBytes() const override;
+
     /// \brief Get the mutable component data. This function will be
     /// deprecated in Gazebo 3, replaced by const DataType &Data() const.
     /// Use void SetData(const DataType &) to modify data.
@@ -388,6 +546,12 @@ namespace components
     /// \brief Unique name for this component type. This is set through the
     /// Factory registration.
     public: inline static const char *typeName{nullptr};
+
+    /// \brief Dense index for this component type, assigned in registration
+    /// order starting from zero. Unlike typeId, which is a 64-bit hash, the
+    /// index can address flat arrays directly, so hot component lookups can
+    /// skip hashing. This is set through the Factory registration.
+    public: inline static std::size_t typeIndex{kComponentTypeIdxInvalid};
   };
 
   /// \brief Specialization for components that don't wrap any data.
@@ -427,6 +591,9 @@ namespace components
     // Documentation inherited
     public: void Deserialize(std::istream &_in) override;
 
+    // Documentation inherited
+    public: std::size_t SizeBytes() const override;
+
     /// \brief Unique ID for this component type. This is set through the
     /// Factory registration.
     public: inline static ComponentTypeId typeId{0};
@@ -434,6 +601,12 @@ namespace components
     /// \brief Unique name for this component type. This is set through the
     /// Factory registration.
     public: inline static const char *typeName{nullptr};
+
+    /// \brief Dense index for this component type, assigned in registration
+    /// order starting from zero. Unlike typeId, which is a 64-bit hash, the
+    /// index can address flat arrays directly, so hot component lookups can
+    /// skip hashing. This is set through the Factory registration.
+    public: inline static std::size_t typeIndex{kComponentTypeIdxInvalid};
   };
 
   //////////////////////////////////////////////////
@@ -489,6 +662,22 @@ namespace components
   void Component<DataType, Identifier, Serializer>::Serialize(
       std::ostream &_out) const
   {
+    // Opt-in bitwise fast path for registered POD-layout payloads. A
+    // custom serializer always wins over the trait, and without the
+    // opt-in the compatible text encoding is emitted.
+    if constexpr (traits::BitwiseSerializable<DataType>::value &&
+        std::is_same_v<Serializer, serializers::DefaultSerializer<DataType>>)
+    {
+      static_assert(std::is_trivially_copyable_v<DataType>,
+          "Bitwise-serializable component data must be trivially copyable");
+      if (traits::BitwiseSerializationEnabled())
+      {
+        _out.put(traits::kBitwiseSerializationMarker);
+        _out.write(reinterpret_cast<const char *>(&this->data),
+            sizeof(DataType));
+        return;
+      }
+    }
     Serializer::Serialize(_out, this->Data());
   }
 
@@ -497,6 +686,18 @@ namespace components
   void Component<DataType, Identifier, Serializer>::Deserialize(
       std::istream &_in)
   {
+    // The marker byte identifies bitwise-encoded values regardless of
+    // whether this build opted in to emitting them.
+    if constexpr (traits::BitwiseSerializable<DataType>::value &&
+        std::is_same_v<Serializer, serializers::DefaultSerializer<DataType>>)
+    {
+      if (_in.peek() == traits::kBitwiseSerializationMarker)
+      {
+        _in.get();
+        _in.read(reinterpret_cast<char *>(&this->data), sizeof(DataType));
+        return;
+      }
+    }
     Serializer::Deserialize(_in, this->Data());
   }
 
@@ -517,6 +718,18 @@ namespace components
     return typeId;
   }
 
+  //////////////////////////////////////////////////
+  template <typename DataType, typename Identifier, typename Serializer>
+  std::size_t Component<DataType, Identifier, Serializer>::SizeBytes() const
+  {
+    std::size_t result = sizeof(*this);
+    // Account for heap storage of string payloads; other dynamically
+    // allocated payloads only report the size of their handle.
+    if constexpr (std::is_same_v<DataType, std::string>)
+      result += this->data.capacity();
+    return result;
+  }
+
   //////////////////////////////////////////////////
   template <typename Identifier, typename Serializer>
   bool Component<NoData, Identifier, Serializer>::operator==(
@@ -548,6 +761,13 @@ namespace components
     return typeId;
   }
 
+  //////////////////////////////////////////////////
+  template <typename Identifier, typename Serializer>
+  std::size_t Component<NoData, Identifier, Serializer>::SizeBytes() const
+  {
+    return sizeof(*this);
+  }
+
   //////////////////////////////////////////////////
   template <typename Identifier, typename Serializer>
   void Component<NoData, Identifier, Serializer>::Serialize(
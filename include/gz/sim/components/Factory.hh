@@ -18,6 +18,7 @@
 #define GZ_SIM_COMPONENTS_FACTORY_HH_
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <deque>
@@ -289,6 +290,18 @@ namespace components
                   << std::endl;
       }
 
+      // Assign a dense, registration-order index to the type. The index is
+      // tracked in indicesById so a type keeps the same index no matter
+      // which library registers it, and it is never recycled on Unregister
+      // so flat arrays sized by index stay valid for the process lifetime.
+      auto indexIt = this->indicesById.find(typeHash);
+      if (indexIt == this->indicesById.end())
+      {
+        indexIt = this->indicesById.insert(
+            {typeHash, this->indicesById.size()}).first;
+      }
+      ComponentTypeT::typeIndex = indexIt->second;
+
       // Keep track of all types
       this->compsById[ComponentTypeT::typeId].Add(_regObjId, _compDesc);
       namesById[ComponentTypeT::typeId] = ComponentTypeT::typeName;
@@ -434,6 +447,25 @@ namespace components
       return this->compsById.find(_typeId) != this->compsById.end();
     }
 
+    /// \brief Get a component's dense type index given its type ID.
+    /// \param[in] _typeId Type of component to query.
+    /// \return The index assigned at registration, or
+    /// kComponentTypeIdxInvalid if the type has never been registered.
+    public: std::size_t TypeIndex(ComponentTypeId _typeId) const
+    {
+      auto it = this->indicesById.find(_typeId);
+      if (it != this->indicesById.end())
+        return it->second;
+      return kComponentTypeIdxInvalid;
+    }
+
+    /// \brief Get the number of dense type indices assigned so far.
+    /// \return One past the largest assigned type index.
+    public: std::size_t TypeIndexCount() const
+    {
+      return this->indicesById.size();
+    }
+
     /// \brief Get a component's type name given its type ID.
     /// return Unique component name.
     public: std::string Name(ComponentTypeId _typeId) const
@@ -458,6 +490,11 @@ namespace components
     /// they try to register different types with the same typeName.
     public: std::map<ComponentTypeId, std::string>
         runtimeNamesById;
+
+    /// \brief Dense registration-order index for each type ID. Entries are
+    /// never removed so an index stays valid even if its type is
+    /// unregistered and registered again by another library.
+    public: std::map<ComponentTypeId, std::size_t> indicesById;
   };
 
   /// \brief Static component registration macro.
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_COMPONENTS_LOD_HH_
+#define GZ_SIM_COMPONENTS_LOD_HH_
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <gz/math/Helpers.hh>
+
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+/// \brief One level-of-detail mesh variant of a visual. The variant becomes
+/// active when the distance between the closest camera and the visual is at
+/// least minDistance.
+struct LodVariant
+{
+  /// \brief Camera distance at which this variant becomes active.
+  double minDistance{0.0};
+
+  /// \brief Resolved URI of the mesh to show for this variant.
+  std::string meshUri;
+
+  /// \brief Equality operator.
+  /// \param[in] _variant Variant to compare with.
+  /// \return True if both variants are equal.
+  public: bool operator==(const LodVariant &_variant) const
+  {
+    return math::equal(this->minDistance, _variant.minDistance) &&
+        this->meshUri == _variant.meshUri;
+  }
+
+  /// \brief Inequality operator.
+  /// \param[in] _variant Variant to compare with.
+  /// \return True if the variants differ.
+  public: bool operator!=(const LodVariant &_variant) const
+  {
+    return !(*this == _variant);
+  }
+};
+
+namespace serializers
+{
+  /// \brief Serializer for a vector of level-of-detail variants. Each
+  /// variant is written on its own line as the activation distance followed
+  /// by the mesh URI.
+  class LodVariantsSerializer
+  {
+    /// \brief Serialization for `std::vector<LodVariant>`.
+    /// \param[in] _out Output stream.
+    /// \param[in] _variants Variants to stream.
+    /// \return The stream.
+    public: static std::ostream &Serialize(std::ostream &_out,
+                const std::vector<LodVariant> &_variants)
+    {
+      _out << _variants.size();
+      for (const auto &variant : _variants)
+        _out << '\n' << variant.minDistance << ' ' << variant.meshUri;
+      return _out;
+    }
+
+    /// \brief Deserialization for `std::vector<LodVariant>`.
+    /// \param[in] _in Input stream.
+    /// \param[out] _variants Variants to populate.
+    /// \return The stream.
+    public: static std::istream &Deserialize(std::istream &_in,
+                std::vector<LodVariant> &_variants)
+    {
+      std::size_t count = 0u;
+      _in >> count;
+      _variants.clear();
+      _variants.reserve(count);
+      for (std::size_t i = 0u; i < count && _in; ++i)
+      {
+        LodVariant variant;
+        _in >> variant.minDistance;
+        // The URI is the rest of the line and may contain spaces; skip the
+        // single separator written by Serialize before reading it.
+        _in.get();
+        std::getline(_in, variant.meshUri);
+        _variants.push_back(variant);
+      }
+      return _in;
+    }
+  };
+}
+
+namespace components
+{
+  /// \brief A component holding the level-of-detail mesh variants of a
+  /// visual, sorted by ascending activation distance. Populated from
+  /// `<gz:lod>` elements of the visual's SDF and consumed by the rendering
+  /// scene to swap meshes based on camera distance.
+  using Lod = Component<std::vector<LodVariant>, class LodTag,
+      serializers::LodVariantsSerializer>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.Lod", Lod)
+}
+}
+}
+}
+
+#endif
@@ -17,9 +17,11 @@
 #ifndef GZ_SIM_DETAIL_BASEVIEW_HH_
 #define GZ_SIM_DETAIL_BASEVIEW_HH_
 
+#include <atomic>
 #include <cstddef>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "gz/sim/Entity.hh"
@@ -67,9 +69,20 @@ struct ComponentTypeHasher
 /// gz::sim::detail) directly.
 class GZ_SIM_VISIBLE BaseView
 {
+  /// \brief Constructor
+  public: BaseView() = default;
+
   /// \brief Destructor
   public: virtual ~BaseView();
 
+  // Copy and move operations are defined explicitly because stagedEntities
+  // is a std::atomic, which deletes the implicit versions. These copy all
+  // data members; the atomic flag is transferred by value.
+  public: BaseView(const BaseView &_other);
+  public: BaseView(BaseView &&_other) noexcept;
+  public: BaseView &operator=(const BaseView &_other);
+  public: BaseView &operator=(BaseView &&_other) noexcept;
+
   /// \brief See if an entity is a part of the view
   /// \param[in] _entity The entity
   /// \return true if _entity is a part of the view, false otherwise
@@ -136,6 +149,16 @@ class GZ_SIM_VISIBLE BaseView
   /// exist in the view.
   public: virtual bool RemoveEntity(const Entity _entity) = 0;
 
+  /// \brief Remove a batch of entities from the view. The base
+  /// implementation removes each entity individually; derived views may
+  /// override this to sweep their internal containers once per batch, which
+  /// is cheaper than per-entity removal when a large subtree (e.g. a model
+  /// with thousands of links) is deleted in one step.
+  /// \param[in] _entities The entities to remove.
+  /// \sa RemoveEntity
+  public: virtual void RemoveEntities(
+              const std::unordered_set<Entity> &_entities);
+
   /// \brief Add the entity to the list of entities to be removed
   /// \param[in] _entity The entity to add.
   /// \return True if the entity was added to the list, false if the entity
@@ -187,6 +210,17 @@ class GZ_SIM_VISIBLE BaseView
   /// \sa ToAddEntities
   public: void ClearToAddEntities();
 
+  /// \brief Check whether any entities are currently staged to be added to
+  /// the view. This is a lock-free atomic read, so concurrent readers can
+  /// use it to skip locking the view's mutex when no staged work exists
+  /// (the common case in steady state). The flag is set with release
+  /// ordering by MarkEntityToAdd and cleared by ClearToAddEntities, so a
+  /// reader that observes it as false is guaranteed to see a fully
+  /// up-to-date view.
+  /// \return True if entities are staged for addition, false otherwise.
+  /// \sa MarkEntityToAdd, ClearToAddEntities
+  public: bool HasToAddEntities() const;
+
   // TODO(adlarkin) make this a std::unordered_set for better performance.
   // We need to make sure nothing else depends on the ordered preserved by
   // std::set first
@@ -211,6 +245,12 @@ class GZ_SIM_VISIBLE BaseView
 
   /// \brief The component types in the view
   protected: std::set<ComponentTypeId> componentTypes;
+
+  /// \brief Whether toAddEntities currently holds any staged entities. This
+  /// duplicates toAddEntities.empty() as an atomic so that concurrent
+  /// readers can test for staged work without taking the view's mutex.
+  /// \sa HasToAddEntities
+  protected: std::atomic<bool> stagedEntities{false};
 };
 }  // namespace detail
 }  // namespace GZ_SIM_VERSION_NAMESPACE
@@ -17,17 +17,20 @@
 #ifndef GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 #define GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 
+#include <algorithm>
 #include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <gz/common/Profiler.hh>
 #include <gz/math/Helpers.hh>
 
 #include "gz/sim/EntityComponentManager.hh"
@@ -116,6 +119,12 @@ template<typename ComponentTypeT>
 const ComponentTypeT *EntityComponentManager::Component(
     const Entity _entity) const
 {
+  // Fast path: resolve the component through the flat pointer table using
+  // the type's dense registration index, avoiding unordered_map probes.
+  auto *cached = this->ComponentFastPath(_entity, ComponentTypeT::typeIndex);
+  if (cached)
+    return static_cast<const ComponentTypeT *>(cached);
+
   // Get a unique identifier to the component type
   const ComponentTypeId typeId = ComponentTypeT::typeId;
 
@@ -127,6 +136,12 @@ const ComponentTypeT *EntityComponentManager::Component(
 template<typename ComponentTypeT>
 ComponentTypeT *EntityComponentManager::Component(const Entity _entity)
 {
+  // Fast path: resolve the component through the flat pointer table using
+  // the type's dense registration index, avoiding unordered_map probes.
+  auto *cached = this->ComponentFastPath(_entity, ComponentTypeT::typeIndex);
+  if (cached)
+    return static_cast<ComponentTypeT *>(cached);
+
   // Get a unique identifier to the component type
   const ComponentTypeId typeId = ComponentTypeT::typeId;
 
@@ -173,7 +188,88 @@ bool EntityComponentManager::SetComponentData(const Entity _entity,
     return true;
   }
 
-  return comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+  // Record the change exactly like SetComponentDataBatch does, so the
+  // periodic state stream and the mutation journal see single-value
+  // writes too.
+  const bool changed =
+      comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+  if (changed)
+  {
+    this->SetChanged(_entity, ComponentTypeT::typeId,
+        ComponentState::PeriodicChange);
+  }
+  return changed;
+}
+
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::SetComponentDataBatch(
+    const std::vector<
+        std::pair<Entity, typename ComponentTypeT::Type>> &_batch,
+    const sim::ComponentState _c)
+{
+  std::vector<Entity> changed;
+  changed.reserve(_batch.size());
+
+  for (const auto &[entity, data] : _batch)
+  {
+    auto comp = this->Component<ComponentTypeT>(entity);
+
+    if (nullptr == comp)
+    {
+      // CreateComponent records its own one-time change.
+      this->CreateComponent(entity, ComponentTypeT(data));
+      continue;
+    }
+
+    if (comp->SetData(data, CompareData<typename ComponentTypeT::Type>))
+      changed.push_back(entity);
+  }
+
+  this->SetChanged(ComponentTypeT::typeId, changed, _c);
+}
+
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::CreateComponentBatch(
+    const std::vector<
+        std::pair<Entity, typename ComponentTypeT::Type>> &_batch)
+{
+  // The temporary components only need to outlive the implementation
+  // call, which copies them through the component factory. Reserve so
+  // the stored pointers stay stable while the vector grows.
+  std::vector<ComponentTypeT> components;
+  components.reserve(_batch.size());
+
+  std::vector<std::pair<Entity, const components::BaseComponent *>> raw;
+  raw.reserve(_batch.size());
+
+  for (const auto &[entity, data] : _batch)
+  {
+    components.emplace_back(data);
+    raw.emplace_back(entity, &components.back());
+  }
+
+  const auto needExternalUpdate =
+      this->CreateComponentBatchImplementation(ComponentTypeT::typeId, raw);
+
+  // Entities that re-used a pre-existing component instance (including
+  // components re-added after removal) keep that instance; install the
+  // new data on it here, like CreateComponent does.
+  for (const auto entity : needExternalUpdate)
+  {
+    auto comp = this->Component<ComponentTypeT>(entity);
+    if (nullptr == comp)
+      continue;
+    for (const auto &[batchEntity, data] : _batch)
+    {
+      if (batchEntity == entity)
+      {
+        *comp = ComponentTypeT(data);
+        break;
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -307,6 +403,7 @@ template<typename ...ComponentTypeTs>
 void EntityComponentManager::EachNoCache(typename identity<std::function<
     bool(const Entity &_entity, const ComponentTypeTs *...)>>::type _f) const
 {
+  GZ_PROFILE("EntityComponentManager::EachNoCache");
   for (const auto &vertex : this->Entities().Vertices())
   {
     Entity entity = vertex.first;
@@ -328,6 +425,7 @@ template<typename ...ComponentTypeTs>
 void EntityComponentManager::EachNoCache(typename identity<std::function<
     bool(const Entity &_entity, ComponentTypeTs *...)>>::type _f)
 {
+  GZ_PROFILE("EntityComponentManager::EachNoCache");
   for (const auto &vertex : this->Entities().Vertices())
   {
     Entity entity = vertex.first;
@@ -386,6 +484,73 @@ constexpr bool applyFunction(const FuncT &_f, const Entity &_entity,
   return applyFunctionImpl<ComponentTypeTs...>(
       _f, _entity, _data, std::index_sequence_for<ComponentTypeTs...>{});
 }
+
+/// \brief A version of applyFunctionImpl for callbacks that return void.
+/// \sa applyFunctionImpl
+template <typename... ComponentTypeTs, typename FuncT, typename BaseComponentT,
+          std::size_t... Is>
+constexpr void applyVoidFunctionImpl(const FuncT &_f, const Entity &_entity,
+                       const std::vector<BaseComponentT *> &_data,
+                       std::index_sequence<Is...>)
+{
+  _f(_entity, static_cast<ComponentTypeTs *>(_data[Is])...);
+}
+
+/// \brief A version of applyFunction for callbacks that return void. This is
+/// used by EachParallel, where the callback cannot stop iteration early.
+/// \sa applyFunction
+template <typename... ComponentTypeTs, typename FuncT, typename BaseComponentT>
+constexpr void applyVoidFunction(const FuncT &_f, const Entity &_entity,
+                   const std::vector<BaseComponentT *> &_data)
+{
+  applyVoidFunctionImpl<ComponentTypeTs...>(
+      _f, _entity, _data, std::index_sequence_for<ComponentTypeTs...>{});
+}
+
+/// \brief Partition the packed arrays of a view into contiguous chunks and
+/// invoke the callback function for every entity, dispatching the chunks
+/// over a set of worker threads that are joined before returning. Small
+/// entity counts are processed serially since thread dispatch would cost
+/// more than it saves.
+/// \param[in] _f The callback function.
+/// \param[in] _entities The view's packed entities.
+/// \param[in] _data The view's packed component data.
+template <typename... ComponentTypeTs, typename FuncT, typename BaseComponentT>
+void eachParallelImpl(const FuncT &_f, const std::vector<Entity> &_entities,
+    const std::vector<std::vector<BaseComponentT *>> &_data)
+{
+  const std::size_t numEntities = _entities.size();
+
+  // the minimum number of entities a worker thread should process; chunks
+  // smaller than this are not worth the thread dispatch overhead
+  const std::size_t minChunkSize = 64u;
+
+  std::size_t numThreads = std::min<std::size_t>(
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1u),
+      numEntities / minChunkSize);
+
+  if (numThreads <= 1u)
+  {
+    for (std::size_t i = 0; i < numEntities; ++i)
+      applyVoidFunction<ComponentTypeTs...>(_f, _entities[i], _data[i]);
+    return;
+  }
+
+  const std::size_t chunkSize = (numEntities + numThreads - 1) / numThreads;
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads);
+  for (std::size_t start = 0; start < numEntities; start += chunkSize)
+  {
+    const std::size_t end = std::min(start + chunkSize, numEntities);
+    workers.push_back(std::thread([&, start, end]()
+        {
+          for (std::size_t i = start; i < end; ++i)
+            applyVoidFunction<ComponentTypeTs...>(_f, _entities[i], _data[i]);
+        }));
+  }
+  for (auto &worker : workers)
+    worker.join();
+}
 }  // namespace detail
 
 //////////////////////////////////////////////////
@@ -393,10 +558,29 @@ template<typename ...ComponentTypeTs>
 void EntityComponentManager::Each(typename identity<std::function<
     bool(const Entity &_entity, const ComponentTypeTs *...)>>::type _f) const
 {
+  GZ_PROFILE("EntityComponentManager::Each");
   // Get the view. This will create a new view if one does not already
   // exist.
   auto view = this->FindView<ComponentTypeTs...>();
 
+  // When packed view storage is enabled, iterate over the view's packed
+  // entity/component arrays. This is a linear scan over contiguous memory,
+  // which avoids the per-entity map lookup in the default path below.
+  if (this->PackedViewStorage())
+  {
+    const auto &entities = view->PackedEntities();
+    const auto &data = view->PackedComponentData();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+      if (!detail::applyFunction<const ComponentTypeTs...>(_f, entities[i],
+            data[i]))
+      {
+        break;
+      }
+    }
+    return;
+  }
+
   // Iterate over the entities in the view, and invoke the callback
   // function.
   for (const Entity entity : view->Entities())
@@ -414,10 +598,27 @@ template<typename ...ComponentTypeTs>
 void EntityComponentManager::Each(typename identity<std::function<
     bool(const Entity &_entity, ComponentTypeTs *...)>>::type _f)
 {
+  GZ_PROFILE("EntityComponentManager::Each");
   // Get the view. This will create a new view if one does not already
   // exist.
   auto view = this->FindView<ComponentTypeTs...>();
 
+  // When packed view storage is enabled, iterate over the view's packed
+  // entity/component arrays (see the const Each overload above).
+  if (this->PackedViewStorage())
+  {
+    const auto &entities = view->PackedEntities();
+    const auto &data = view->PackedComponentData();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+      if (!detail::applyFunction<ComponentTypeTs...>(_f, entities[i], data[i]))
+      {
+        break;
+      }
+    }
+    return;
+  }
+
   // Iterate over the entities in the view, and invoke the callback
   // function.
   for (const Entity entity : view->Entities())
@@ -430,6 +631,66 @@ void EntityComponentManager::Each(typename identity<std::function<
   }
 }
 
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    void(const Entity &_entity, const ComponentTypeTs *...)>>::type _f) const
+{
+  GZ_PROFILE("EntityComponentManager::EachParallel");
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  const auto &entities = view->PackedEntities();
+  const auto &data = view->PackedComponentData();
+
+  // In deterministic mode, visit entities serially in packed order so that
+  // accumulating callbacks observe a stable, machine-independent order.
+  if (this->EachParallelDeterministic())
+  {
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+      detail::applyVoidFunction<const ComponentTypeTs...>(_f, entities[i],
+          data[i]);
+    }
+    return;
+  }
+
+  // Iterate over the view's packed arrays so that each worker thread scans
+  // a contiguous slice of memory.
+  detail::eachParallelImpl<const ComponentTypeTs...>(_f, entities, data);
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    void(const Entity &_entity, ComponentTypeTs *...)>>::type _f)
+{
+  GZ_PROFILE("EntityComponentManager::EachParallel");
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  const auto &entities = view->PackedEntities();
+  const auto &data = view->PackedComponentData();
+
+  // In deterministic mode, visit entities serially in packed order so that
+  // accumulating callbacks observe a stable, machine-independent order.
+  if (this->EachParallelDeterministic())
+  {
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+      detail::applyVoidFunction<ComponentTypeTs...>(_f, entities[i],
+          data[i]);
+    }
+    return;
+  }
+
+  // Iterate over the view's packed arrays so that each worker thread scans
+  // a contiguous slice of memory.
+  detail::eachParallelImpl<ComponentTypeTs...>(_f, entities, data);
+}
+
 //////////////////////////////////////////////////
 template <class Function, class... ComponentTypeTs>
 void EntityComponentManager::ForEach(Function _f,
@@ -516,6 +777,14 @@ detail::View *EntityComponentManager::FindView() const
   {
     auto view = static_cast<detail::View*>(baseViewPtr);
 
+    // fast path: if no entities are staged for addition, the view can be
+    // used directly without locking. The staged state is checked through a
+    // lock-free atomic, so concurrent read-only Each() calls (for example,
+    // from parallel system PostUpdates) never contend on the view's mutex
+    // in steady state.
+    if (!view->HasToAddEntities())
+      return view;
+
     std::unique_ptr<std::lock_guard<std::mutex>> viewLock;
     if (this->LockAddingEntitiesToViews())
     {
@@ -531,6 +800,11 @@ detail::View *EntityComponentManager::FindView() const
         return view;
       }
       viewLock = std::make_unique<std::lock_guard<std::mutex>>(*mutexPtr);
+
+      // re-check now that the mutex is held: another thread may have drained
+      // the staged entities while this thread was waiting for the lock
+      if (!view->HasToAddEntities())
+        return view;
     }
 
     // add any new entities to the view before using it
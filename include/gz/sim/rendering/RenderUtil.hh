@@ -234,6 +234,14 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     /// \param[in] _mgr Event manager to set to.
     public: void SetEventManager(EventManager *_mgr);
 
+    /// \brief Set whether actor animation level of detail is enabled. When
+    /// enabled, skeletal animation updates are decimated with distance from
+    /// the camera, and actors far from the camera keep their last pose.
+    /// Animation LOD can also be enabled by setting the
+    /// GZ_SIM_ACTOR_ANIMATION_LOD environment variable to 1.
+    /// \param[in] _enabled True to enable actor animation LOD.
+    public: void SetActorAnimationLod(bool _enabled);
+
     /// \brief Private data pointer.
     private: std::unique_ptr<RenderUtilPrivate> dataPtr;
   };
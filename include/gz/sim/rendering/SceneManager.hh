@@ -50,6 +50,7 @@
 
 #include <gz/sim/config.hh>
 #include <gz/sim/Entity.hh>
+#include <gz/sim/components/Lod.hh>
 #include <gz/sim/rendering/Export.hh>
 
 namespace gz
@@ -345,6 +346,43 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     private: rendering::MaterialPtr LoadMaterial(
         const sdf::Material &_material);
 
+    /// \brief Detach a geometry from a material shared through
+    /// deduplication by giving it its own copy, so the material can be
+    /// mutated without affecting other visuals created from the same
+    /// definition. No-op if the geometry's material is not shared.
+    /// \param[in] _geom Geometry to detach
+    /// \return The geometry's material after any detach
+    public: rendering::MaterialPtr DetachSharedMaterial(
+        const rendering::GeometryPtr &_geom);
+
+    /// \brief Get the number of visuals sharing each deduplicated
+    /// material. Visuals detached through DetachSharedMaterial are not
+    /// counted.
+    /// \return Map of material signature to the number of visuals
+    /// currently sharing it
+    public: std::unordered_map<std::string, unsigned int>
+        MaterialInstanceCounts() const;
+
+    /// \brief Set the level-of-detail mesh variants of a visual. Variants
+    /// must be sorted by ascending activation distance; the visual's own
+    /// geometry is shown below the first activation distance.
+    /// \param[in] _id Visual entity id
+    /// \param[in] _variants Level-of-detail variants
+    public: void SetVisualLod(Entity _id,
+        const std::vector<LodVariant> &_variants);
+
+    /// \brief Get the number of visuals with level-of-detail variants.
+    /// \return Number of visuals with variants
+    public: unsigned int LodCount() const;
+
+    /// \brief Swap level-of-detail meshes based on the distance between
+    /// each visual and the closest camera. A hysteresis band around each
+    /// activation distance prevents back and forth swaps when a camera
+    /// hovers near a threshold.
+    /// \param[in] _cameraPositions World positions of the active cameras
+    public: void UpdateLods(
+        const std::vector<math::Vector3d> &_cameraPositions);
+
     /// \brief Get the top level visual for the given visual, which
     /// is the ancestor which is a direct child to the root visual.
     /// Usually, this will be a model or a light.
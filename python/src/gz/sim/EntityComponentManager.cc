@@ -13,22 +13,121 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <limits>
+#include <vector>
+
+#include <gz/math/Pose3.hh>
+#include <gz/sim/Util.hh>
+#include "gz/sim/components/Pose.hh"
 
 #include "EntityComponentManager.hh"
 
+namespace py = pybind11;
+
 namespace gz
 {
 namespace sim
 {
 namespace python
 {
+/// \brief Write a pose into row _i of an Nx7 array as
+/// [x, y, z, qw, qx, qy, qz]
+static void writePoseRow(py::detail::unchecked_mutable_reference<double, 2> &_r,
+    py::ssize_t _i, const math::Pose3d &_pose)
+{
+  _r(_i, 0) = _pose.Pos().X();
+  _r(_i, 1) = _pose.Pos().Y();
+  _r(_i, 2) = _pose.Pos().Z();
+  _r(_i, 3) = _pose.Rot().W();
+  _r(_i, 4) = _pose.Rot().X();
+  _r(_i, 5) = _pose.Rot().Y();
+  _r(_i, 6) = _pose.Rot().Z();
+}
+
 /////////////////////////////////////////////////
 void defineSimEntityComponentManager(pybind11::object module)
 {
   pybind11::class_<gz::sim::EntityComponentManager>(
       module, "EntityComponentManager")
-  .def(pybind11::init<>());
+  .def(pybind11::init<>())
+  .def("poses",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_entities)
+      {
+        py::array_t<double> result(
+            {static_cast<py::ssize_t>(_entities.size()),
+             static_cast<py::ssize_t>(7)});
+        auto r = result.mutable_unchecked<2>();
+        for (py::ssize_t i = 0;
+             i < static_cast<py::ssize_t>(_entities.size()); ++i)
+        {
+          auto *comp = _self.Component<components::Pose>(_entities[i]);
+          if (comp)
+          {
+            writePoseRow(r, i, comp->Data());
+          }
+          else
+          {
+            for (py::ssize_t j = 0; j < 7; ++j)
+              r(i, j) = std::numeric_limits<double>::quiet_NaN();
+          }
+        }
+        return result;
+      },
+      py::arg("entities"),
+      "Get the local Pose components of a batch of entities as an Nx7 "
+      "array of [x, y, z, qw, qx, qy, qz] rows. Entities without a Pose "
+      "component yield a NaN row.")
+  .def("world_poses",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_entities)
+      {
+        auto poses = gz::sim::worldPoses(_entities, _self);
+        py::array_t<double> result(
+            {static_cast<py::ssize_t>(_entities.size()),
+             static_cast<py::ssize_t>(7)});
+        auto r = result.mutable_unchecked<2>();
+        for (py::ssize_t i = 0;
+             i < static_cast<py::ssize_t>(_entities.size()); ++i)
+        {
+          writePoseRow(r, i, poses[_entities[i]]);
+        }
+        return result;
+      },
+      py::arg("entities"),
+      "Get the world poses of a batch of entities as an Nx7 array of "
+      "[x, y, z, qw, qx, qy, qz] rows, resolving each ancestor pose once "
+      "for the whole batch. Entities without a Pose component yield an "
+      "identity row.")
+  .def("set_poses",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_entities,
+         const py::array_t<double> &_poses)
+      {
+        auto r = _poses.unchecked<2>();
+        if (r.shape(0) != static_cast<py::ssize_t>(_entities.size()) ||
+            r.shape(1) != 7)
+        {
+          throw py::value_error(
+              "Expected an Nx7 array of [x, y, z, qw, qx, qy, qz] rows "
+              "matching the number of entities");
+        }
+        for (py::ssize_t i = 0;
+             i < static_cast<py::ssize_t>(_entities.size()); ++i)
+        {
+          math::Pose3d pose(r(i, 0), r(i, 1), r(i, 2),
+                            r(i, 3), r(i, 4), r(i, 5), r(i, 6));
+          _self.SetComponentData<components::Pose>(_entities[i], pose);
+        }
+      },
+      py::arg("entities"), py::arg("poses"),
+      "Set the local Pose components of a batch of entities from an Nx7 "
+      "array of [x, y, z, qw, qx, qy, qz] rows, creating components that "
+      "don't exist yet and marking changed ones for serialization.");
 }
 }  // namespace python
 }  // namespace sim
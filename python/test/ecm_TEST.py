@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# Copyright (C) 2024 Open Source Robotics Foundation
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#       http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+import os
+import unittest
+
+from gz_test_deps.common import set_verbosity
+from gz_test_deps.sim import K_NULL_ENTITY, TestFixture, Link, Model, World, world_entity
+
+
+class TestEntityComponentManager(unittest.TestCase):
+    pre_iterations = 0
+
+    def test_batched_poses(self):
+        set_verbosity(4)
+
+        file_path = os.path.dirname(os.path.realpath(__file__))
+        fixture = TestFixture(os.path.join(file_path, 'link_test.sdf'))
+
+        def on_pre_udpate_cb(_info, _ecm):
+            self.pre_iterations += 1
+            world_e = world_entity(_ecm)
+            self.assertNotEqual(K_NULL_ENTITY, world_e)
+            w = World(world_e)
+            m = Model(w.model_by_name(_ecm, 'model_test'))
+            link = Link(m.link_by_name(_ecm, 'link_test'))
+            entities = [m.entity(), link.entity()]
+
+            # Batched getter returns one [x, y, z, qw, qx, qy, qz] row per
+            # entity
+            poses = _ecm.poses(entities)
+            self.assertEqual((2, 7), poses.shape)
+
+            # The world entity has no Pose component, so its row is NaN
+            world_row = _ecm.poses([world_e])
+            self.assertEqual((1, 7), world_row.shape)
+            self.assertTrue(math.isnan(world_row[0][0]))
+
+            # Batched setter round trip
+            poses[0][2] += 1.0
+            _ecm.set_poses(entities, poses)
+            updated = _ecm.poses(entities)
+            self.assertAlmostEqual(poses[0][2], updated[0][2])
+
+            # World poses resolve the ancestor chain for the whole batch
+            world_poses = _ecm.world_poses(entities)
+            self.assertEqual((2, 7), world_poses.shape)
+            self.assertFalse(math.isnan(world_poses[1][0]))
+
+            # Shape mismatches are rejected
+            with self.assertRaises(ValueError):
+                _ecm.set_poses(entities, poses[:1])
+
+        fixture.on_pre_update(on_pre_udpate_cb)
+        fixture.finalize()
+
+        server = fixture.server()
+        server.run(True, 2, False)
+
+        self.assertEqual(2, self.pre_iterations)
+
+
+if __name__ == '__main__':
+    unittest.main()
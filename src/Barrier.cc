@@ -17,9 +17,21 @@
 
 #include "Barrier.hh"
 
+#include <chrono>
+#include <thread>
+
+namespace
+{
+  /// \brief How long a waiter spins on the generation counter before
+  /// falling back to a blocking wait. At sub-millisecond step periods the
+  /// other participants usually arrive well within this window, so most
+  /// waits resolve without paying the sleep/wake round trip.
+  constexpr auto kSpinWindow = std::chrono::microseconds(50);
+}
+
 class gz::sim::BarrierPrivate
 {
-  /// \brief Mutex for syncronization
+  /// \brief Mutex for the blocking slow path
   public: std::mutex mutex;
 
   /// \brief Condition Variable for signaling
@@ -32,10 +44,12 @@ class gz::sim::BarrierPrivate
   public: unsigned int threadCount;
 
   /// \brief Current remaining thread count (decrements from threadCount)
-  public: unsigned int count;
+  public: std::atomic<unsigned int> count;
 
-  /// \brief Barrier generation, incremented when all threads report
-  public: unsigned int generation{0};
+  /// \brief Barrier generation, incremented when all threads report.
+  /// Spinners watch this without taking the mutex; it is only written
+  /// under the mutex so the condition variable never misses a wakeup.
+  public: std::atomic<unsigned int> generation{0};
 };
 
 using namespace gz::sim;
@@ -59,23 +73,45 @@ Barrier::ExitStatus Barrier::Wait()
     return Barrier::ExitStatus::CANCELLED;
   }
 
-  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
-  unsigned int gen = this->dataPtr->generation;
+  const unsigned int gen =
+      this->dataPtr->generation.load(std::memory_order_acquire);
 
-  if (--this->dataPtr->count == 0)
+  if (this->dataPtr->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
   {
-    // All threads have reached the wait, so reset the barrier.
-    this->dataPtr->generation++;
-    this->dataPtr->count = this->dataPtr->threadCount;
+    // All threads have reached the wait, so reset the barrier. The count
+    // is restored before the generation bump so a released thread that
+    // re-enters Wait never observes the stale count.
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->count.store(this->dataPtr->threadCount,
+        std::memory_order_release);
+    this->dataPtr->generation.fetch_add(1, std::memory_order_release);
     this->dataPtr->cv.notify_all();
     return Barrier::ExitStatus::DONE_LAST;
   }
 
-  while (gen == this->dataPtr->generation && !this->dataPtr->cancelled)
+  // Spin briefly on the generation counter: at high step rates the other
+  // participants arrive within the window and the sleep/wake round trip
+  // is skipped entirely.
+  const auto waitStart = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - waitStart < kSpinWindow)
+  {
+    if (gen != this->dataPtr->generation.load(std::memory_order_acquire) ||
+        this->dataPtr->cancelled)
+    {
+      return this->dataPtr->cancelled ? Barrier::ExitStatus::CANCELLED
+                                      : Barrier::ExitStatus::DONE;
+    }
+    std::this_thread::yield();
+  }
+
+  // Slow path: block until the generation is reached or a cancel occurs.
   {
-    // All threads haven't reached, so wait until generation is reached
-    // or a cancel occurs
-    this->dataPtr->cv.wait(lock);
+    std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+    while (gen == this->dataPtr->generation.load(std::memory_order_acquire)
+        && !this->dataPtr->cancelled)
+    {
+      this->dataPtr->cv.wait(lock);
+    }
   }
 
   if (this->dataPtr->cancelled)
@@ -93,7 +129,7 @@ void Barrier::Cancel()
 {
   std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
   // This forces pending threads to release
-  this->dataPtr->generation++;
+  this->dataPtr->generation.fetch_add(1, std::memory_order_release);
   this->dataPtr->cancelled = true;
   this->dataPtr->cv.notify_all();
 }
@@ -44,6 +44,9 @@ namespace gz
     ///
     /// Note that this can likely be replaced once the C++ concurrency TS
     /// is ratified: https://en.cppreference.com/w/cpp/experimental/barrier
+    ///
+    /// Nothing in the simulation loop uses this class at the moment; it is
+    /// kept for its tests and for future multi-threaded schedulers.
     class GZ_SIM_VISIBLE Barrier
     {
       /// \brief Constructor
@@ -16,6 +16,8 @@
 */
 #include "gz/sim/detail/BaseView.hh"
 
+#include <utility>
+
 #include "gz/sim/Entity.hh"
 #include "gz/sim/Types.hh"
 
@@ -26,6 +28,52 @@ using namespace detail;
 //////////////////////////////////////////////////
 BaseView::~BaseView() = default;
 
+//////////////////////////////////////////////////
+BaseView::BaseView(const BaseView &_other)
+  : entities(_other.entities),
+    newEntities(_other.newEntities),
+    toRemoveEntities(_other.toRemoveEntities),
+    toAddEntities(_other.toAddEntities),
+    componentTypes(_other.componentTypes),
+    stagedEntities(_other.stagedEntities.load())
+{
+}
+
+//////////////////////////////////////////////////
+BaseView::BaseView(BaseView &&_other) noexcept
+  : entities(std::move(_other.entities)),
+    newEntities(std::move(_other.newEntities)),
+    toRemoveEntities(std::move(_other.toRemoveEntities)),
+    toAddEntities(std::move(_other.toAddEntities)),
+    componentTypes(std::move(_other.componentTypes)),
+    stagedEntities(_other.stagedEntities.load())
+{
+}
+
+//////////////////////////////////////////////////
+BaseView &BaseView::operator=(const BaseView &_other)
+{
+  this->entities = _other.entities;
+  this->newEntities = _other.newEntities;
+  this->toRemoveEntities = _other.toRemoveEntities;
+  this->toAddEntities = _other.toAddEntities;
+  this->componentTypes = _other.componentTypes;
+  this->stagedEntities = _other.stagedEntities.load();
+  return *this;
+}
+
+//////////////////////////////////////////////////
+BaseView &BaseView::operator=(BaseView &&_other) noexcept
+{
+  this->entities = std::move(_other.entities);
+  this->newEntities = std::move(_other.newEntities);
+  this->toRemoveEntities = std::move(_other.toRemoveEntities);
+  this->toAddEntities = std::move(_other.toAddEntities);
+  this->componentTypes = std::move(_other.componentTypes);
+  this->stagedEntities = _other.stagedEntities.load();
+  return *this;
+}
+
 //////////////////////////////////////////////////
 bool BaseView::HasEntity(const Entity _entity) const
 {
@@ -45,6 +93,8 @@ bool BaseView::MarkEntityToAdd(const Entity _entity, bool _new)
     return false;
 
   this->toAddEntities[_entity] = _new;
+  // release so that a reader observing the flag also observes the insertion
+  this->stagedEntities.store(true, std::memory_order_release);
   return true;
 }
 
@@ -54,6 +104,13 @@ bool BaseView::RequiresComponent(const ComponentTypeId _typeId) const
   return this->componentTypes.find(_typeId) != this->componentTypes.end();
 }
 
+//////////////////////////////////////////////////
+void BaseView::RemoveEntities(const std::unordered_set<Entity> &_entities)
+{
+  for (const Entity entity : _entities)
+    this->RemoveEntity(entity);
+}
+
 //////////////////////////////////////////////////
 bool BaseView::MarkEntityToRemove(const Entity _entity)
 {
@@ -109,4 +166,11 @@ const std::unordered_map<Entity, bool> &BaseView::ToAddEntities() const
 void BaseView::ClearToAddEntities()
 {
   this->toAddEntities.clear();
+  this->stagedEntities.store(false, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+bool BaseView::HasToAddEntities() const
+{
+  return this->stagedEntities.load(std::memory_order_acquire);
 }
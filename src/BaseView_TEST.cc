@@ -64,16 +64,19 @@ TEST_F(BaseViewTest, ToAddEntities)
   // by default, the view shouldn't have any entities marked as ToAdd
   EXPECT_EQ(0u, modelNameView.ToAddEntities().size());
   EXPECT_FALSE(modelNameView.IsEntityMarkedForAddition(e1));
+  EXPECT_FALSE(modelNameView.HasToAddEntities());
 
   // Calling ClearToAddEntities should have no effect since no entities are
   // marked as ToAdd
   modelNameView.ClearToAddEntities();
   EXPECT_EQ(0u, modelNameView.ToAddEntities().size());
   EXPECT_FALSE(modelNameView.IsEntityMarkedForAddition(e1));
+  EXPECT_FALSE(modelNameView.HasToAddEntities());
 
   // Mark an entity as ToAdd (and as a "newly created" entity)
   EXPECT_TRUE(modelNameView.MarkEntityToAdd(e1, e1IsNew));
   EXPECT_TRUE(modelNameView.IsEntityMarkedForAddition(e1));
+  EXPECT_TRUE(modelNameView.HasToAddEntities());
   EXPECT_EQ(1u, modelNameView.ToAddEntities().size());
   auto e1ToAddIter = modelNameView.ToAddEntities().find(e1);
   ASSERT_NE(e1ToAddIter, modelNameView.ToAddEntities().end());
@@ -101,6 +104,7 @@ TEST_F(BaseViewTest, ToAddEntities)
   modelNameView.ClearToAddEntities();
   EXPECT_EQ(0u, modelNameView.ToAddEntities().size());
   EXPECT_FALSE(modelNameView.IsEntityMarkedForAddition(e1));
+  EXPECT_FALSE(modelNameView.HasToAddEntities());
   e1IsNew = true;
   EXPECT_TRUE(modelNameView.MarkEntityToAdd(e1, e1IsNew));
   EXPECT_TRUE(modelNameView.IsEntityMarkedForAddition(e1));
@@ -225,6 +229,51 @@ TEST_F(BaseViewTest, RemoveEntities)
   EXPECT_EQ(0u, view.ToRemoveEntities().size());
 }
 
+/////////////////////////////////////////////////
+TEST_F(BaseViewTest, RemoveEntitiesBatch)
+{
+  auto view = detail::View({components::Model::typeId});
+
+  const Entity e1 = 1;
+  auto e1ModelComp = components::Model();
+  const Entity e2 = 2;
+  auto e2ModelComp = components::Model();
+  const Entity e3 = 3;
+  auto e3ModelComp = components::Model();
+  const auto isNewEntity = false;
+
+  // add entities to the view
+  view.AddEntityWithComps(e1, isNewEntity, &e1ModelComp);
+  view.AddEntityWithConstComps(e1, isNewEntity, &e1ModelComp);
+  view.AddEntityWithComps(e2, isNewEntity, &e2ModelComp);
+  view.AddEntityWithConstComps(e2, isNewEntity, &e2ModelComp);
+  view.AddEntityWithComps(e3, isNewEntity, &e3ModelComp);
+  view.AddEntityWithConstComps(e3, isNewEntity, &e3ModelComp);
+  EXPECT_EQ(3u, view.Entities().size());
+
+  // a batch that is small relative to the view takes the per-entity path
+  view.RemoveEntities({e1});
+  EXPECT_FALSE(view.HasEntity(e1));
+  EXPECT_FALSE(view.HasCachedComponentData(e1));
+  EXPECT_EQ(2u, view.Entities().size());
+
+  // a batch that covers most of the view takes the sweep path. Entities in
+  // the batch that aren't part of the view should be ignored
+  view.RemoveEntities({e1, e2, e3});
+  EXPECT_FALSE(view.HasEntity(e2));
+  EXPECT_FALSE(view.HasEntity(e3));
+  EXPECT_FALSE(view.HasCachedComponentData(e2));
+  EXPECT_FALSE(view.HasCachedComponentData(e3));
+  EXPECT_EQ(0u, view.Entities().size());
+
+  // batch removal should also clear pending toAdd/toRemove markers
+  EXPECT_TRUE(view.MarkEntityToAdd(e1));
+  EXPECT_TRUE(view.MarkEntityToRemove(e1));
+  view.RemoveEntities({e1});
+  EXPECT_EQ(0u, view.ToAddEntities().size());
+  EXPECT_EQ(0u, view.ToRemoveEntities().size());
+}
+
 /////////////////////////////////////////////////
 TEST_F(BaseViewTest, Reset)
 {
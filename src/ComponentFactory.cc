@@ -17,10 +17,163 @@
 
 #include "gz/sim/components/Factory.hh"
 
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
 using Factory = gz::sim::components::Factory;
+using ComponentPool = gz::sim::components::ComponentPool;
 
 Factory *Factory::Instance()
 {
   static gz::utils::NeverDestroyed<Factory> instance;
   return &instance.Access();
 }
+
+/// \brief Private data for the ComponentPool class.
+class gz::sim::components::ComponentPool::Implementation
+{
+  /// \brief Number of power-of-two size classes. Chunk sizes range from
+  /// 2^4 (16 bytes) to 2^(4 + kNumSizeClasses - 1) (1024 bytes); larger
+  /// requests fall back to the global allocator.
+  public: static constexpr std::size_t kNumSizeClasses = 7;
+
+  /// \brief log2 of the smallest chunk size.
+  public: static constexpr std::size_t kMinSizeClassShift = 4;
+
+  /// \brief Number of chunks carved out of a slab per refill.
+  public: static constexpr std::size_t kChunksPerSlab = 64;
+
+  /// \brief Size-class index stored in the header of allocations that were
+  /// serviced by the global allocator instead of a slab.
+  public: static constexpr std::size_t kFallbackClass = kNumSizeClasses;
+
+  /// \brief Every allocation is preceded by a header holding its size-class
+  /// index so that Deallocate can route the chunk back to the right free
+  /// list. The header is max_align_t-sized to preserve the alignment of the
+  /// returned pointer.
+  public: static constexpr std::size_t kHeaderSize = alignof(std::max_align_t);
+
+  /// \brief Get the size-class index for a request, or kFallbackClass if
+  /// the request is too large to pool.
+  /// \param[in] _size Number of bytes requested, excluding the header.
+  /// \return The size-class index.
+  public: static std::size_t SizeClass(std::size_t _size)
+  {
+    std::size_t chunkSize = std::size_t(1) << kMinSizeClassShift;
+    for (std::size_t i = 0; i < kNumSizeClasses; ++i, chunkSize <<= 1)
+    {
+      if (_size <= chunkSize)
+        return i;
+    }
+    return kFallbackClass;
+  }
+
+  /// \brief Carve a new slab into chunks and push them onto the free list
+  /// of the given size class. Assumes the mutex is held.
+  /// \param[in] _sizeClass The size class to refill.
+  public: void Refill(std::size_t _sizeClass)
+  {
+    const std::size_t chunkSize =
+        (std::size_t(1) << (kMinSizeClassShift + _sizeClass)) + kHeaderSize;
+    const std::size_t slabSize = chunkSize * kChunksPerSlab;
+
+    auto *slab = static_cast<char *>(::operator new(slabSize));
+    this->slabs.push_back(slab);
+    this->slabBytes += slabSize;
+    this->totalChunks += kChunksPerSlab;
+
+    auto &freeList = this->freeLists[_sizeClass];
+    freeList.reserve(freeList.size() + kChunksPerSlab);
+    for (std::size_t i = 0; i < kChunksPerSlab; ++i)
+      freeList.push_back(slab + i * chunkSize);
+  }
+
+  /// \brief One free list of chunks per size class. Each entry points to
+  /// the start of a chunk (that is, to its header).
+  public: std::array<std::vector<void *>, kNumSizeClasses> freeLists;
+
+  /// \brief All slabs ever allocated. Slabs live for the lifetime of the
+  /// pool, which is the lifetime of the process.
+  public: std::vector<char *> slabs;
+
+  /// \brief Total number of bytes reserved by the slabs.
+  public: std::size_t slabBytes{0};
+
+  /// \brief Total number of chunks carved out of the slabs.
+  public: std::size_t totalChunks{0};
+
+  /// \brief A mutex to protect the free lists and slabs.
+  public: mutable std::mutex mutex;
+};
+
+//////////////////////////////////////////////////
+ComponentPool::ComponentPool()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+//////////////////////////////////////////////////
+ComponentPool *ComponentPool::Instance()
+{
+  static gz::utils::NeverDestroyed<ComponentPool> instance;
+  return &instance.Access();
+}
+
+//////////////////////////////////////////////////
+void *ComponentPool::Allocate(std::size_t _size)
+{
+  const std::size_t sizeClass = Implementation::SizeClass(_size);
+  char *chunk = nullptr;
+
+  if (sizeClass == Implementation::kFallbackClass)
+  {
+    chunk = static_cast<char *>(
+        ::operator new(_size + Implementation::kHeaderSize));
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    auto &freeList = this->dataPtr->freeLists[sizeClass];
+    if (freeList.empty())
+      this->dataPtr->Refill(sizeClass);
+    chunk = static_cast<char *>(freeList.back());
+    freeList.pop_back();
+  }
+
+  // record the size class so Deallocate can route the chunk back
+  *reinterpret_cast<std::size_t *>(chunk) = sizeClass;
+  return chunk + Implementation::kHeaderSize;
+}
+
+//////////////////////////////////////////////////
+void ComponentPool::Deallocate(void *_ptr)
+{
+  if (nullptr == _ptr)
+    return;
+
+  auto *chunk = static_cast<char *>(_ptr) - Implementation::kHeaderSize;
+  const std::size_t sizeClass = *reinterpret_cast<std::size_t *>(chunk);
+
+  if (sizeClass == Implementation::kFallbackClass)
+  {
+    ::operator delete(chunk);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->freeLists[sizeClass].push_back(chunk);
+}
+
+//////////////////////////////////////////////////
+ComponentPool::Stats ComponentPool::PoolStats() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  Stats stats;
+  stats.slabBytes = this->dataPtr->slabBytes;
+  stats.totalChunks = this->dataPtr->totalChunks;
+  for (const auto &freeList : this->dataPtr->freeLists)
+    stats.freeChunks += freeList.size();
+  return stats;
+}
@@ -16,6 +16,11 @@
 */
 
 #include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <gz/utils/SuppressWarning.hh>
 #include "test_config.hh"
 #include "gz/sim/components/Component.hh"
@@ -94,6 +99,49 @@ TEST_F(ComponentFactoryTest, Register)
   EXPECT_EQ(registeredCount + 1, ids.size());
 }
 
+/////////////////////////////////////////////////
+TEST_F(ComponentFactoryTest, TypeIndex)
+{
+  auto factory = components::Factory::Instance();
+
+  // Create custom components.
+  using IndexedA = components::Component<components::NoData, class IndexedATag>;
+  using IndexedB = components::Component<components::NoData, class IndexedBTag>;
+
+  // Unregistered types have no index
+  EXPECT_EQ(components::kComponentTypeIdxInvalid, IndexedA::typeIndex);
+  EXPECT_EQ(components::kComponentTypeIdxInvalid, IndexedB::typeIndex);
+
+  auto indexCount = factory->TypeIndexCount();
+
+  factory->Register<IndexedA>("gz_sim_components.IndexedA",
+                              new components::ComponentDescriptor<IndexedA>(),
+                              components::RegistrationObjectId(this));
+  factory->Register<IndexedB>("gz_sim_components.IndexedB",
+                              new components::ComponentDescriptor<IndexedB>(),
+                              components::RegistrationObjectId(this));
+
+  // Indices are dense and assigned in registration order
+  EXPECT_EQ(indexCount, IndexedA::typeIndex);
+  EXPECT_EQ(indexCount + 1, IndexedB::typeIndex);
+  EXPECT_EQ(indexCount + 2, factory->TypeIndexCount());
+  EXPECT_EQ(IndexedA::typeIndex, factory->TypeIndex(IndexedA::typeId));
+  EXPECT_EQ(IndexedB::typeIndex, factory->TypeIndex(IndexedB::typeId));
+
+  // Re-registering keeps the original index
+  factory->Register<IndexedA>("gz_sim_components.IndexedA",
+                              new components::ComponentDescriptor<IndexedA>(),
+                              components::RegistrationObjectId(this));
+  EXPECT_EQ(indexCount, IndexedA::typeIndex);
+  EXPECT_EQ(indexCount + 2, factory->TypeIndexCount());
+
+  // Indices are not recycled on unregister
+  factory->Unregister<IndexedA>(components::RegistrationObjectId(this));
+  factory->Unregister<IndexedB>(components::RegistrationObjectId(this));
+  EXPECT_EQ(indexCount + 2, factory->TypeIndexCount());
+  EXPECT_EQ(indexCount, factory->TypeIndex(IndexedA::typeId));
+}
+
 /////////////////////////////////////////////////
 TEST_F(ComponentFactoryTest, DeprecatedRegister)
 {
@@ -206,3 +254,32 @@ TEST_F(ComponentFactoryTest, New)
     ASSERT_EQ(nullptr, comp);
   }
 }
+
+/////////////////////////////////////////////////
+TEST_F(ComponentFactoryTest, ComponentPool)
+{
+  auto *pool = components::ComponentPool::Instance();
+  ASSERT_NE(nullptr, pool);
+
+  // Creating components should carve chunks out of the pool's slabs
+  std::vector<std::unique_ptr<components::BaseComponent>> comps;
+  for (int i = 0; i < 100; ++i)
+  {
+    auto comp = components::Factory::Instance()->New(components::Pose::typeId);
+    ASSERT_NE(nullptr, comp);
+    comps.push_back(std::move(comp));
+  }
+
+  auto stats = pool->PoolStats();
+  EXPECT_GT(stats.slabBytes, 0u);
+  EXPECT_GE(stats.totalChunks, 100u);
+  EXPECT_GE(stats.totalChunks, stats.freeChunks);
+  auto inUse = stats.totalChunks - stats.freeChunks;
+  EXPECT_GE(inUse, 100u);
+
+  // Destroying components should return their chunks to the free lists
+  comps.clear();
+  auto statsAfter = pool->PoolStats();
+  EXPECT_EQ(stats.totalChunks, statsAfter.totalChunks);
+  EXPECT_GE(statsAfter.freeChunks, stats.freeChunks + 100u);
+}
@@ -144,7 +144,7 @@ msgs::Collision gz::sim::convert(const sdf::Collision &_in)
   msgs::Collision out;
   out.set_name(_in.Name());
   msgs::Set(out.mutable_pose(), _in.RawPose());
-  out.mutable_geometry()->CopyFrom(convert<msgs::Geometry>(*_in.Geom()));
+  set(out.mutable_geometry(), *_in.Geom());
 
   return out;
 }
@@ -162,59 +162,57 @@ sdf::Collision gz::sim::convert(const msgs::Collision &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
+void gz::sim::set(msgs::Geometry *_msg, const sdf::Geometry &_in)
 {
-  msgs::Geometry out;
+  _msg->Clear();
   if (_in.Type() == sdf::GeometryType::BOX && _in.BoxShape())
   {
-    out.set_type(msgs::Geometry::BOX);
-    msgs::Set(out.mutable_box()->mutable_size(), _in.BoxShape()->Size());
+    _msg->set_type(msgs::Geometry::BOX);
+    msgs::Set(_msg->mutable_box()->mutable_size(), _in.BoxShape()->Size());
   }
   else if (_in.Type() == sdf::GeometryType::CAPSULE && _in.CapsuleShape())
   {
-    out.set_type(msgs::Geometry::CAPSULE);
-    out.mutable_capsule()->set_radius(_in.CapsuleShape()->Radius());
-    out.mutable_capsule()->set_length(_in.CapsuleShape()->Length());
+    _msg->set_type(msgs::Geometry::CAPSULE);
+    _msg->mutable_capsule()->set_radius(_in.CapsuleShape()->Radius());
+    _msg->mutable_capsule()->set_length(_in.CapsuleShape()->Length());
   }
   else if (_in.Type() == sdf::GeometryType::CONE && _in.ConeShape())
   {
-    out.set_type(msgs::Geometry::CONE);
-    out.mutable_cone()->set_radius(_in.ConeShape()->Radius());
-    out.mutable_cone()->set_length(_in.ConeShape()->Length());
+    _msg->set_type(msgs::Geometry::CONE);
+    _msg->mutable_cone()->set_radius(_in.ConeShape()->Radius());
+    _msg->mutable_cone()->set_length(_in.ConeShape()->Length());
   }
   else if (_in.Type() == sdf::GeometryType::CYLINDER && _in.CylinderShape())
   {
-    out.set_type(msgs::Geometry::CYLINDER);
-    out.mutable_cylinder()->set_radius(_in.CylinderShape()->Radius());
-    out.mutable_cylinder()->set_length(_in.CylinderShape()->Length());
+    _msg->set_type(msgs::Geometry::CYLINDER);
+    _msg->mutable_cylinder()->set_radius(_in.CylinderShape()->Radius());
+    _msg->mutable_cylinder()->set_length(_in.CylinderShape()->Length());
   }
   else if (_in.Type() == sdf::GeometryType::ELLIPSOID && _in.EllipsoidShape())
   {
-    out.set_type(msgs::Geometry::ELLIPSOID);
-    msgs::Set(out.mutable_ellipsoid()->mutable_radii(),
+    _msg->set_type(msgs::Geometry::ELLIPSOID);
+    msgs::Set(_msg->mutable_ellipsoid()->mutable_radii(),
              _in.EllipsoidShape()->Radii());
   }
   else if (_in.Type() == sdf::GeometryType::PLANE && _in.PlaneShape())
   {
-    out.set_type(msgs::Geometry::PLANE);
-    msgs::Set(out.mutable_plane()->mutable_normal(),
+    _msg->set_type(msgs::Geometry::PLANE);
+    msgs::Set(_msg->mutable_plane()->mutable_normal(),
               _in.PlaneShape()->Normal());
-    msgs::Set(out.mutable_plane()->mutable_size(),
+    msgs::Set(_msg->mutable_plane()->mutable_size(),
               _in.PlaneShape()->Size());
   }
   else if (_in.Type() == sdf::GeometryType::SPHERE && _in.SphereShape())
   {
-    out.set_type(msgs::Geometry::SPHERE);
-    out.mutable_sphere()->set_radius(_in.SphereShape()->Radius());
+    _msg->set_type(msgs::Geometry::SPHERE);
+    _msg->mutable_sphere()->set_radius(_in.SphereShape()->Radius());
   }
   else if (_in.Type() == sdf::GeometryType::MESH && _in.MeshShape())
   {
     auto meshSdf = _in.MeshShape();
 
-    out.set_type(msgs::Geometry::MESH);
-    auto meshMsg = out.mutable_mesh();
+    _msg->set_type(msgs::Geometry::MESH);
+    auto meshMsg = _msg->mutable_mesh();
 
     msgs::Set(meshMsg->mutable_scale(), meshSdf->Scale());
     meshMsg->set_filename(asFullPath(meshSdf->Uri(), meshSdf->FilePath()));
@@ -223,17 +221,17 @@ msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
 
     if (!meshSdf->OptimizationStr().empty())
     {
-      auto header = out.mutable_header()->add_data();
+      auto header = _msg->mutable_header()->add_data();
       header->set_key("optimization");
       header->add_value(meshSdf->OptimizationStr());
     }
     if (meshSdf->ConvexDecomposition())
     {
-      auto header = out.mutable_header()->add_data();
+      auto header = _msg->mutable_header()->add_data();
       header->set_key("max_convex_hulls");
       header->add_value(std::to_string(
           meshSdf->ConvexDecomposition()->MaxConvexHulls()));
-      header = out.mutable_header()->add_data();
+      header = _msg->mutable_header()->add_data();
       header->set_key("voxel_resolution");
       header->add_value(std::to_string(
           meshSdf->ConvexDecomposition()->VoxelResolution()));
@@ -243,8 +241,8 @@ msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
   {
     auto heightmapSdf = _in.HeightmapShape();
 
-    out.set_type(msgs::Geometry::HEIGHTMAP);
-    auto heightmapMsg = out.mutable_heightmap();
+    _msg->set_type(msgs::Geometry::HEIGHTMAP);
+    auto heightmapMsg = _msg->mutable_heightmap();
 
     heightmapMsg->set_filename(asFullPath(heightmapSdf->Uri(),
         heightmapSdf->FilePath()));
@@ -275,10 +273,10 @@ msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
   else if (_in.Type() == sdf::GeometryType::POLYLINE &&
       !_in.PolylineShape().empty())
   {
-    out.set_type(msgs::Geometry::POLYLINE);
+    _msg->set_type(msgs::Geometry::POLYLINE);
     for (const auto &polyline : _in.PolylineShape())
     {
-      auto polylineMsg = out.add_polyline();
+      auto polylineMsg = _msg->add_polyline();
       polylineMsg->set_height(polyline.Height());
       for (const auto &point : polyline.Points())
       {
@@ -288,13 +286,22 @@ msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
   }
   else if (_in.Type() == sdf::GeometryType::EMPTY)
   {
-    out.set_type(msgs::Geometry::EMPTY);
+    _msg->set_type(msgs::Geometry::EMPTY);
   }
   else
   {
     gzerr << "Geometry type [" << static_cast<int>(_in.Type())
            << "] not supported" << std::endl;
   }
+}
+
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
+{
+  msgs::Geometry out;
+  set(&out, _in);
   return out;
 }
 
@@ -464,24 +471,22 @@ sdf::Geometry gz::sim::convert(const msgs::Geometry &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Material gz::sim::convert(const sdf::Material &_in)
+void gz::sim::set(msgs::Material *_msg, const sdf::Material &_in)
 {
-  msgs::Material out;
-  msgs::Set(out.mutable_ambient(), _in.Ambient());
-  msgs::Set(out.mutable_diffuse(), _in.Diffuse());
-  msgs::Set(out.mutable_specular(), _in.Specular());
-  out.set_shininess(_in.Shininess());
-  msgs::Set(out.mutable_emissive(), _in.Emissive());
-  out.set_render_order(_in.RenderOrder());
-  out.set_lighting(_in.Lighting());
-  out.set_double_sided(_in.DoubleSided());
+  _msg->Clear();
+  msgs::Set(_msg->mutable_ambient(), _in.Ambient());
+  msgs::Set(_msg->mutable_diffuse(), _in.Diffuse());
+  msgs::Set(_msg->mutable_specular(), _in.Specular());
+  _msg->set_shininess(_in.Shininess());
+  msgs::Set(_msg->mutable_emissive(), _in.Emissive());
+  _msg->set_render_order(_in.RenderOrder());
+  _msg->set_lighting(_in.Lighting());
+  _msg->set_double_sided(_in.DoubleSided());
 
   auto pbr = _in.PbrMaterial();
   if (pbr)
   {
-    auto pbrMsg = out.mutable_pbr();
+    auto pbrMsg = _msg->mutable_pbr();
     auto workflow = pbr->Workflow(sdf::PbrWorkflowType::METAL);
     if (workflow)
       pbrMsg->set_type(msgs::Material_PBR_WorkflowType_METAL);
@@ -520,6 +525,15 @@ msgs::Material gz::sim::convert(const sdf::Material &_in)
       pbrMsg->set_light_map_texcoord_set(workflow->LightMapTexCoordSet());
     }
   }
+}
+
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Material gz::sim::convert(const sdf::Material &_in)
+{
+  msgs::Material out;
+  set(&out, _in);
   return out;
 }
 
@@ -651,34 +665,41 @@ sdf::Actor gz::sim::convert(const msgs::Actor &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Light gz::sim::convert(const sdf::Light &_in)
+void gz::sim::set(msgs::Light *_msg, const sdf::Light &_in)
 {
-  msgs::Light out;
-  out.set_name(_in.Name());
-  msgs::Set(out.mutable_pose(), _in.RawPose());
-  msgs::Set(out.mutable_diffuse(), _in.Diffuse());
-  msgs::Set(out.mutable_specular(), _in.Specular());
-  out.set_attenuation_constant(_in.ConstantAttenuationFactor());
-  out.set_attenuation_linear(_in.LinearAttenuationFactor());
-  out.set_attenuation_quadratic(_in.QuadraticAttenuationFactor());
-  out.set_range(_in.AttenuationRange());
-  out.set_intensity(_in.Intensity());
-  msgs::Set(out.mutable_direction(), _in.Direction());
-  out.set_cast_shadows(_in.CastShadows());
-  out.set_spot_inner_angle(_in.SpotInnerAngle().Radian());
-  out.set_spot_outer_angle(_in.SpotOuterAngle().Radian());
-  out.set_spot_falloff(_in.SpotFalloff());
-  out.set_is_light_off(!_in.LightOn());
-  out.set_visualize_visual(_in.Visualize());
+  _msg->Clear();
+  _msg->set_name(_in.Name());
+  msgs::Set(_msg->mutable_pose(), _in.RawPose());
+  msgs::Set(_msg->mutable_diffuse(), _in.Diffuse());
+  msgs::Set(_msg->mutable_specular(), _in.Specular());
+  _msg->set_attenuation_constant(_in.ConstantAttenuationFactor());
+  _msg->set_attenuation_linear(_in.LinearAttenuationFactor());
+  _msg->set_attenuation_quadratic(_in.QuadraticAttenuationFactor());
+  _msg->set_range(_in.AttenuationRange());
+  _msg->set_intensity(_in.Intensity());
+  msgs::Set(_msg->mutable_direction(), _in.Direction());
+  _msg->set_cast_shadows(_in.CastShadows());
+  _msg->set_spot_inner_angle(_in.SpotInnerAngle().Radian());
+  _msg->set_spot_outer_angle(_in.SpotOuterAngle().Radian());
+  _msg->set_spot_falloff(_in.SpotFalloff());
+  _msg->set_is_light_off(!_in.LightOn());
+  _msg->set_visualize_visual(_in.Visualize());
 
   if (_in.Type() == sdf::LightType::POINT)
-    out.set_type(msgs::Light_LightType_POINT);
+    _msg->set_type(msgs::Light_LightType_POINT);
   else if (_in.Type() == sdf::LightType::SPOT)
-    out.set_type(msgs::Light_LightType_SPOT);
+    _msg->set_type(msgs::Light_LightType_SPOT);
   else if (_in.Type() == sdf::LightType::DIRECTIONAL)
-    out.set_type(msgs::Light_LightType_DIRECTIONAL);
+    _msg->set_type(msgs::Light_LightType_DIRECTIONAL);
+}
+
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Light gz::sim::convert(const sdf::Light &_in)
+{
+  msgs::Light out;
+  set(&out, _in);
   return out;
 }
 
@@ -727,7 +748,7 @@ msgs::GUI gz::sim::convert(const sdf::Gui &_in)
   for (uint64_t i = 0; i < _in.PluginCount(); ++i)
   {
     auto pluginMsg = out.add_plugin();
-    pluginMsg->CopyFrom(convert<msgs::Plugin>(*_in.PluginByIndex(i)));
+    set(pluginMsg, *_in.PluginByIndex(i));
   }
 
   if (_in.Element()->HasElement("camera"))
@@ -830,22 +851,20 @@ sdf::JointAxis gz::sim::convert(const msgs::Axis &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Scene gz::sim::convert(const sdf::Scene &_in)
+void gz::sim::set(msgs::Scene *_msg, const sdf::Scene &_in)
 {
-  msgs::Scene out;
+  _msg->Clear();
   // todo(anyone) add Name to sdf::Scene?
-  // out.set_name(_in.Name());
-  msgs::Set(out.mutable_ambient(), _in.Ambient());
-  msgs::Set(out.mutable_background(), _in.Background());
-  out.set_shadows(_in.Shadows());
-  out.set_grid(_in.Grid());
-  out.set_origin_visual(_in.OriginVisual());
+  // _msg->set_name(_in.Name());
+  msgs::Set(_msg->mutable_ambient(), _in.Ambient());
+  msgs::Set(_msg->mutable_background(), _in.Background());
+  _msg->set_shadows(_in.Shadows());
+  _msg->set_grid(_in.Grid());
+  _msg->set_origin_visual(_in.OriginVisual());
 
   if (_in.Sky())
   {
-    msgs::Sky *skyMsg = out.mutable_sky();
+    msgs::Sky *skyMsg = _msg->mutable_sky();
     skyMsg->set_time(_in.Sky()->Time());
     skyMsg->set_sunrise(_in.Sky()->Sunrise());
     skyMsg->set_sunset(_in.Sky()->Sunset());
@@ -857,7 +876,15 @@ msgs::Scene gz::sim::convert(const sdf::Scene &_in)
     msgs::Set(skyMsg->mutable_cloud_ambient(),
         _in.Sky()->CloudAmbient());
   }
+}
 
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Scene gz::sim::convert(const sdf::Scene &_in)
+{
+  msgs::Scene out;
+  set(&out, _in);
   return out;
 }
 
@@ -1716,7 +1743,7 @@ msgs::ParticleEmitter gz::sim::convert(const sdf::ParticleEmitter &_in)
   out.mutable_lifetime()->set_data(_in.Lifetime());
   if (_in.Material())
   {
-    out.mutable_material()->CopyFrom(convert<msgs::Material>(*_in.Material()));
+    set(out.mutable_material(), *_in.Material());
   }
   out.mutable_min_velocity()->set_data(_in.MinVelocity());
   out.mutable_max_velocity()->set_data(_in.MaxVelocity());
@@ -1836,21 +1863,19 @@ sdf::Projector gz::sim::convert(const msgs::Projector &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Plugin gz::sim::convert(const sdf::Element &_in)
+void gz::sim::set(msgs::Plugin *_msg, const sdf::Element &_in)
 {
-  msgs::Plugin result;
+  _msg->Clear();
 
   if (_in.GetName() != "plugin")
   {
     gzerr << "Tried to convert SDF [" << _in.GetName()
            << "] into [plugin]" << std::endl;
-    return result;
+    return;
   }
 
-  result.set_name(_in.Get<std::string>("name"));
-  result.set_filename(_in.Get<std::string>("filename"));
+  _msg->set_name(_in.Get<std::string>("name"));
+  _msg->set_filename(_in.Get<std::string>("filename"));
 
   std::stringstream ss;
   for (auto innerElem = _in.GetFirstElement(); innerElem;
@@ -1858,28 +1883,42 @@ msgs::Plugin gz::sim::convert(const sdf::Element &_in)
   {
     ss << innerElem->ToString("");
   }
-  result.set_innerxml(ss.str());
-
-  return result;
+  _msg->set_innerxml(ss.str());
 }
 
 //////////////////////////////////////////////////
 template<>
 GZ_SIM_VISIBLE
-msgs::Plugin gz::sim::convert(const sdf::Plugin &_in)
+msgs::Plugin gz::sim::convert(const sdf::Element &_in)
 {
   msgs::Plugin result;
+  set(&result, _in);
+  return result;
+}
+
+//////////////////////////////////////////////////
+void gz::sim::set(msgs::Plugin *_msg, const sdf::Plugin &_in)
+{
+  _msg->Clear();
 
-  result.set_name(_in.Name());
-  result.set_filename(_in.Filename());
+  _msg->set_name(_in.Name());
+  _msg->set_filename(_in.Filename());
 
   std::stringstream ss;
   for (auto content : _in.Contents())
   {
     ss << content->ToString("");
   }
-  result.set_innerxml(ss.str());
+  _msg->set_innerxml(ss.str());
+}
 
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Plugin gz::sim::convert(const sdf::Plugin &_in)
+{
+  msgs::Plugin result;
+  set(&result, _in);
   return result;
 }
 
@@ -1891,7 +1930,7 @@ msgs::Plugin_V gz::sim::convert(const sdf::Plugins &_in)
   msgs::Plugin_V result;
   for (const sdf::Plugin &plugin : _in)
   {
-    result.add_plugins()->CopyFrom(convert<msgs::Plugin>(plugin));
+    set(result.add_plugins(), plugin);
   }
   return result;
 }
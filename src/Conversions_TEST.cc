@@ -49,6 +49,69 @@ using namespace gz;
 using namespace sim;
 using namespace std::chrono_literals;
 
+/////////////////////////////////////////////////
+TEST(Conversions, SetInPlace)
+{
+  // The set() overloads fill a caller-owned message and must match the
+  // by-value convert, including clearing fields from a previous use.
+  sdf::Light light;
+  light.SetName("set_in_place_light");
+  light.SetType(sdf::LightType::SPOT);
+  light.SetIntensity(0.3);
+
+  msgs::Light lightMsg;
+  lightMsg.set_id(123u);
+  set(&lightMsg, light);
+  EXPECT_EQ("set_in_place_light", lightMsg.name());
+  EXPECT_EQ(msgs::Light_LightType_SPOT, lightMsg.type());
+  EXPECT_FLOAT_EQ(0.3f, lightMsg.intensity());
+  // Stale fields are cleared
+  EXPECT_EQ(0u, lightMsg.id());
+
+  sdf::Geometry boxGeom;
+  boxGeom.SetType(sdf::GeometryType::BOX);
+  sdf::Box box;
+  box.SetSize({1, 2, 3});
+  boxGeom.SetBoxShape(box);
+
+  sdf::Geometry sphereGeom;
+  sphereGeom.SetType(sdf::GeometryType::SPHERE);
+  sdf::Sphere sphere;
+  sphere.SetRadius(1.5);
+  sphereGeom.SetSphereShape(sphere);
+
+  // Reusing one message across geometry types leaves no trace of the
+  // previous shape
+  msgs::Geometry geomMsg;
+  set(&geomMsg, boxGeom);
+  EXPECT_EQ(msgs::Geometry::BOX, geomMsg.type());
+  EXPECT_TRUE(geomMsg.has_box());
+
+  set(&geomMsg, sphereGeom);
+  EXPECT_EQ(msgs::Geometry::SPHERE, geomMsg.type());
+  EXPECT_FALSE(geomMsg.has_box());
+  EXPECT_DOUBLE_EQ(1.5, geomMsg.sphere().radius());
+
+  sdf::Scene scene;
+  scene.SetAmbient(math::Color(0.1f, 0.2f, 0.3f));
+  scene.SetShadows(true);
+
+  msgs::Scene sceneMsg;
+  set(&sceneMsg, scene);
+  EXPECT_TRUE(sceneMsg.shadows());
+  EXPECT_EQ(math::Color(0.1f, 0.2f, 0.3f),
+      msgs::Convert(sceneMsg.ambient()));
+
+  sdf::Plugin plugin;
+  plugin.SetName("set_in_place_plugin");
+  plugin.SetFilename("set-in-place-system");
+
+  msgs::Plugin pluginMsg;
+  set(&pluginMsg, plugin);
+  EXPECT_EQ("set_in_place_plugin", pluginMsg.name());
+  EXPECT_EQ("set-in-place-system", pluginMsg.filename());
+}
+
 /////////////////////////////////////////////////
 TEST(Conversions, Light)
 {
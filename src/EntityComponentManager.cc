@@ -18,6 +18,11 @@
 #include "gz/sim/EntityComponentManager.hh"
 #include "EntityComponentManagerDiff.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -29,6 +34,7 @@
 #include <vector>
 
 #include <gz/common/Profiler.hh>
+#include <gz/common/Util.hh>
 #include <gz/math/graph/GraphAlgorithms.hh>
 
 #include "gz/sim/components/CanonicalLink.hh"
@@ -143,6 +149,34 @@ class gz::sim::EntityComponentManagerPrivate
   public: std::unordered_map<ComponentTypeId, std::unordered_set<Entity>>
             periodicChangedComponents;
 
+  /// \brief Hierarchical dirty bitsets mirroring periodicChangedComponents.
+  /// For each component type, entities are grouped into blocks of 64
+  /// (block index = entity / 64), and each block holds a bitmask of the
+  /// entities within it that have a pending periodic change. Testing
+  /// whether a (type, entity) pair changed is then a map lookup plus a bit
+  /// test, with clean types and clean blocks rejected in O(1), so the
+  /// per-step serialization cost scales with the number of
+  /// actually-changed entities rather than the total entity count.
+  public: std::unordered_map<ComponentTypeId,
+            std::unordered_map<uint64_t, uint64_t>> periodicChangedBlocks;
+
+  /// \brief Set the periodic-change dirty bit for a (type, entity) pair.
+  /// \param[in] _type The component type.
+  /// \param[in] _entity The entity.
+  public: void SetPeriodicChangeBit(ComponentTypeId _type, Entity _entity);
+
+  /// \brief Clear the periodic-change dirty bit for a (type, entity) pair,
+  /// dropping blocks and types that become fully clean.
+  /// \param[in] _type The component type.
+  /// \param[in] _entity The entity.
+  public: void ClearPeriodicChangeBit(ComponentTypeId _type, Entity _entity);
+
+  /// \brief Check the periodic-change dirty bit for a (type, entity) pair.
+  /// \param[in] _type The component type.
+  /// \param[in] _entity The entity.
+  /// \return True if the pair has a pending periodic change.
+  public: bool PeriodicChangeBit(ComponentTypeId _type, Entity _entity) const;
+
   /// \brief Components that have been changed through a one-time change.
   /// The key is the type of component which has changed, and the value is the
   /// entities that had this type of component changed.
@@ -193,6 +227,39 @@ class gz::sim::EntityComponentManagerPrivate
   public: mutable std::unordered_map<Entity, std::unordered_set<Entity>>
           descendantCache;
 
+  /// \brief Counter incremented on entity creation and removal and on
+  /// creation or removal of Name and ParentEntity components
+  /// \sa EntityComponentManager::EntityStructureEpoch
+  public: std::atomic<uint64_t> structureEpoch{0u};
+
+  /// \brief Mutex protecting the scoped name index
+  public: mutable std::mutex scopedNameMutex;
+
+  /// \brief Epoch the scoped name index was last built at. Starts out of
+  /// sync with structureEpoch so the first query builds the index.
+  public: mutable uint64_t scopedNameIndexEpoch{
+              std::numeric_limits<uint64_t>::max()};
+
+  /// \brief Index from a separator-joined suffix of an entity's name path
+  /// to the entities whose name path ends with that suffix
+  public: mutable std::unordered_map<std::string, std::unordered_set<Entity>>
+          scopedNameIndex;
+
+  /// \brief Full separator-joined name path of each named entity
+  public: mutable std::unordered_map<Entity, std::string> entityNamePaths;
+
+  /// \brief Mutex protecting the name symbol table
+  public: mutable std::mutex nameSymbolMutex;
+
+  /// \brief Interned name strings, indexed by symbol. Symbol 0 is the
+  /// empty name. A deque keeps references handed out by SymbolString
+  /// valid as the table grows.
+  public: mutable std::deque<std::string> nameSymbols{std::string()};
+
+  /// \brief Map from an interned string to its symbol
+  public: mutable std::unordered_map<std::string, uint32_t> nameSymbolIds{
+              {std::string(), 0u}};
+
   /// \brief Keep track of entities already used to ensure uniqueness.
   public: uint64_t entityCount{0};
 
@@ -247,6 +314,91 @@ class gz::sim::EntityComponentManagerPrivate
   /// each thread.
   public: bool componentTypeIndexDirty{true};
 
+  /// \brief A row of the flat component pointer table, holding the raw
+  /// component pointers of a single entity indexed by the dense component
+  /// type index (Component::typeIndex). The full entity ID is recorded so
+  /// recycled entity indices never alias a stale row.
+  public: struct ComponentPtrRow
+  {
+    /// \brief The entity this row belongs to, or kNullEntity if unused.
+    Entity entity{kNullEntity};
+
+    /// \brief Raw component pointers indexed by dense component type index.
+    std::vector<components::BaseComponent *> ptrs;
+  };
+
+  /// \brief Flat table of component pointers indexed by
+  /// [entityIndex][component type index]. An entry is non-null only while
+  /// the component exists and is not marked as removed, so the hot
+  /// Component<T>() lookup can resolve with two array indexes instead of
+  /// unordered_map probes. Component pointers are stable because
+  /// componentStorage holds unique_ptrs and removal only marks components.
+  public: std::vector<ComponentPtrRow> componentPtrTable;
+
+  /// \brief Record _ptr in the flat component pointer table.
+  /// \param[in] _entity The entity the component belongs to.
+  /// \param[in] _typeId The component's type ID.
+  /// \param[in] _ptr The component pointer.
+  public: void SetComponentPtr(const Entity _entity,
+              const ComponentTypeId _typeId,
+              components::BaseComponent *_ptr);
+
+  /// \brief Drop a single component from the flat pointer table, e.g.
+  /// because it was marked as removed.
+  /// \param[in] _entity The entity the component belongs to.
+  /// \param[in] _typeId The component's type ID.
+  public: void ClearComponentPtr(const Entity _entity,
+              const ComponentTypeId _typeId);
+
+  /// \brief Drop an entity's entire row from the flat pointer table.
+  /// \param[in] _entity The removed entity.
+  public: void ClearComponentPtrRow(const Entity _entity);
+
+  /// \brief True if component mutations are being recorded for delta-based
+  /// resets.
+  /// \sa EntityComponentManager::SetComponentMutationTracking
+  public: bool trackComponentMutations{false};
+
+  /// \brief Components that were created, removed or marked as changed
+  /// since mutation tracking was last (re)started. ResetTo uses this
+  /// journal to restore a snapshot by touching only these components.
+  public: std::unordered_map<Entity, std::unordered_set<ComponentTypeId>>
+      mutatedComponents;
+
+  /// \brief Record a component mutation in the journal. No-op when
+  /// tracking is disabled.
+  /// \param[in] _entity Entity the component belongs to.
+  /// \param[in] _typeId The component's type ID.
+  public: void JournalMutation(const Entity _entity,
+              const ComponentTypeId _typeId);
+
+  /// \brief True if per-type change-rate counters are being accumulated.
+  /// \sa EntityComponentManager::SetChangeRateTracking
+  public: bool trackChangeRates{false};
+
+  /// \brief Number of times each component type was created, removed or
+  /// marked changed since tracking was last (re)started
+  public: std::map<ComponentTypeId, uint64_t> changeRateCounters;
+
+  /// \brief Wall-clock time at which change-rate tracking was last
+  /// (re)started
+  public: std::chrono::steady_clock::time_point changeRateWindowStart;
+
+  /// \brief Count a change mark against a component type. No-op when
+  /// tracking is disabled.
+  /// \param[in] _typeId The component's type ID.
+  public: void CountChangeMark(const ComponentTypeId _typeId);
+
+  /// \brief Replace a component's stored instance with a clone of _data.
+  /// The caller is responsible for notifying views, since the raw pointers
+  /// they hold become invalid.
+  /// \param[in] _entity Entity the component belongs to.
+  /// \param[in] _typeId The component's type ID.
+  /// \param[in] _data The data to clone into the storage slot.
+  public: void ReplaceComponentData(const Entity _entity,
+              const ComponentTypeId _typeId,
+              const components::BaseComponent *_data);
+
   /// \brief During cloning, we populate two maps:
   ///  - map of cloned model entities to the non-cloned model's canonical link
   ///  - map of non-cloned canonical links to the cloned canonical link
@@ -286,17 +438,209 @@ class gz::sim::EntityComponentManagerPrivate
 
   /// \brief Set of entities that are prevented from removal.
   public: std::unordered_set<Entity> pinnedEntities;
+
+  /// \brief Whether Each() should iterate views through packed, contiguous
+  /// entity/component arrays instead of per-entity map lookups.
+  /// \sa EntityComponentManager::SetPackedViewStorage
+  public: bool packedViewStorage{false};
+
+  /// \brief Whether EachParallel should run serially in packed order.
+  /// \sa EntityComponentManager::SetEachParallelDeterministic
+  public: bool eachParallelDeterministic{false};
+
+  /// \brief Number of operations that were serviced by incremental view
+  /// maintenance instead of a full RebuildViews.
+  /// \sa EntityComponentManager::RebuildViewsAvoidedCount
+  public: uint64_t rebuildViewsAvoided{0};
+
+  /// \brief Scratch message reused by the flat-buffer ChangedState
+  /// overload so protobuf tree allocations are recycled across snapshots.
+  /// \sa EntityComponentManager::ChangedState(std::string &)
+  public: mutable msgs::SerializedStateMap changedStateScratchMsg;
+
+  /// \brief Whether removed entity indices are recycled by CreateEntity.
+  /// \sa EntityComponentManager::SetEntityIdRecycling
+  public: bool entityIdRecycling{false};
+
+  /// \brief IDs of removed entities whose indices can be reused. The full
+  /// previous ID is stored so the generation counter can be incremented on
+  /// reuse.
+  public: std::vector<Entity> entityFreeList;
+
+  /// \brief Nesting depth of open entity creation batches. While positive,
+  /// component creation stages entities in batchTouchedEntities instead of
+  /// updating view membership per component.
+  /// \sa EntityComponentManager::BeginEntityBatch
+  public: int batchDepth{0};
+
+  /// \brief Entities that had components created while a batch was open
+  /// and still need to be matched against the views.
+  public: std::unordered_set<Entity> batchTouchedEntities;
 };
 
 //////////////////////////////////////////////////
 EntityComponentManager::EntityComponentManager()
   : dataPtr(new EntityComponentManagerPrivate)
 {
+  // allow opting into packed view storage without code changes
+  std::string packedViews;
+  if (common::env("GZ_SIM_PACKED_VIEW_STORAGE", packedViews) &&
+      !packedViews.empty())
+  {
+    this->dataPtr->packedViewStorage = true;
+  }
+
+  // allow opting into change-rate counters without code changes
+  std::string changeRates;
+  if (common::env("GZ_SIM_CHANGE_RATE_TRACKING", changeRates) &&
+      !changeRates.empty())
+  {
+    this->SetChangeRateTracking(true);
+  }
 }
 
 //////////////////////////////////////////////////
 EntityComponentManager::~EntityComponentManager() = default;
 
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::SetPeriodicChangeBit(
+    ComponentTypeId _type, Entity _entity)
+{
+  this->periodicChangedBlocks[_type][_entity / 64u] |=
+      uint64_t(1) << (_entity % 64u);
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ClearPeriodicChangeBit(
+    ComponentTypeId _type, Entity _entity)
+{
+  auto typeIter = this->periodicChangedBlocks.find(_type);
+  if (typeIter == this->periodicChangedBlocks.end())
+    return;
+
+  auto blockIter = typeIter->second.find(_entity / 64u);
+  if (blockIter == typeIter->second.end())
+    return;
+
+  blockIter->second &= ~(uint64_t(1) << (_entity % 64u));
+  if (0u == blockIter->second)
+  {
+    typeIter->second.erase(blockIter);
+    if (typeIter->second.empty())
+      this->periodicChangedBlocks.erase(typeIter);
+  }
+}
+
+//////////////////////////////////////////////////
+bool EntityComponentManagerPrivate::PeriodicChangeBit(
+    ComponentTypeId _type, Entity _entity) const
+{
+  auto typeIter = this->periodicChangedBlocks.find(_type);
+  if (typeIter == this->periodicChangedBlocks.end())
+    return false;
+
+  auto blockIter = typeIter->second.find(_entity / 64u);
+  if (blockIter == typeIter->second.end())
+    return false;
+
+  return 0u != (blockIter->second & (uint64_t(1) << (_entity % 64u)));
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::SetComponentPtr(const Entity _entity,
+    const ComponentTypeId _typeId, components::BaseComponent *_ptr)
+{
+  const auto typeIdx = components::Factory::Instance()->TypeIndex(_typeId);
+  if (components::kComponentTypeIdxInvalid == typeIdx)
+    return;
+
+  const auto idx = entityIndex(_entity);
+  if (idx >= this->componentPtrTable.size())
+    this->componentPtrTable.resize(idx + 1);
+
+  auto &row = this->componentPtrTable[idx];
+  if (row.entity != _entity)
+  {
+    // the index previously belonged to a removed entity; recycle the row
+    row.entity = _entity;
+    std::fill(row.ptrs.begin(), row.ptrs.end(), nullptr);
+  }
+
+  if (typeIdx >= row.ptrs.size())
+    row.ptrs.resize(typeIdx + 1, nullptr);
+  row.ptrs[typeIdx] = _ptr;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ClearComponentPtr(const Entity _entity,
+    const ComponentTypeId _typeId)
+{
+  const auto idx = entityIndex(_entity);
+  if (idx >= this->componentPtrTable.size())
+    return;
+
+  auto &row = this->componentPtrTable[idx];
+  const auto typeIdx = components::Factory::Instance()->TypeIndex(_typeId);
+  if (row.entity != _entity || typeIdx >= row.ptrs.size())
+    return;
+
+  row.ptrs[typeIdx] = nullptr;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ClearComponentPtrRow(const Entity _entity)
+{
+  const auto idx = entityIndex(_entity);
+  if (idx >= this->componentPtrTable.size())
+    return;
+
+  auto &row = this->componentPtrTable[idx];
+  if (row.entity != _entity)
+    return;
+
+  row.entity = kNullEntity;
+  std::fill(row.ptrs.begin(), row.ptrs.end(), nullptr);
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::JournalMutation(const Entity _entity,
+    const ComponentTypeId _typeId)
+{
+  if (!this->trackComponentMutations)
+    return;
+  this->mutatedComponents[_entity].insert(_typeId);
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::CountChangeMark(
+    const ComponentTypeId _typeId)
+{
+  if (!this->trackChangeRates)
+    return;
+  ++this->changeRateCounters[_typeId];
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ReplaceComponentData(const Entity _entity,
+    const ComponentTypeId _typeId, const components::BaseComponent *_data)
+{
+  auto typeMapIter = this->componentTypeIndex.find(_entity);
+  if (typeMapIter == this->componentTypeIndex.end())
+    return;
+
+  auto compIdxIter = typeMapIter->second.find(_typeId);
+  if (compIdxIter == typeMapIter->second.end())
+    return;
+
+  auto storageIter = this->componentStorage.find(_entity);
+  if (storageIter == this->componentStorage.end())
+    return;
+
+  auto &slot = storageIter->second[compIdxIter->second];
+  slot = _data->Clone();
+  this->SetComponentPtr(_entity, _typeId, slot.get());
+}
+
 //////////////////////////////////////////////////
 void EntityComponentManagerPrivate::CopyFrom(
     const EntityComponentManagerPrivate &_from)
@@ -304,6 +648,7 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->createdCompTypes = _from.createdCompTypes;
   this->entities = _from.entities;
   this->periodicChangedComponents = _from.periodicChangedComponents;
+  this->periodicChangedBlocks = _from.periodicChangedBlocks;
   this->oneTimeChangedComponents = _from.oneTimeChangedComponents;
   this->newlyCreatedEntities = _from.newlyCreatedEntities;
   this->toRemoveEntities = _from.toRemoveEntities;
@@ -311,6 +656,11 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->removeAllEntities = _from.removeAllEntities;
   this->views.clear();
   this->lockAddEntitiesToViews = _from.lockAddEntitiesToViews;
+  this->packedViewStorage = _from.packedViewStorage;
+  this->entityIdRecycling = _from.entityIdRecycling;
+  this->entityFreeList = _from.entityFreeList;
+  this->trackComponentMutations = _from.trackComponentMutations;
+  this->mutatedComponents = _from.mutatedComponents;
   this->descendantCache.clear();
   this->entityCount = _from.entityCount;
   this->removedComponents = _from.removedComponents;
@@ -328,6 +678,20 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->componentTypeIndexIterators.clear();
   this->componentTypeIndexDirty = true;
 
+  // Rebuild the flat component pointer table against the cloned storage
+  this->componentPtrTable.clear();
+  for (const auto &[entity, typeMap] : this->componentTypeIndex)
+  {
+    auto storageIter = this->componentStorage.find(entity);
+    if (storageIter == this->componentStorage.end())
+      continue;
+    for (const auto &[typeId, slot] : typeMap)
+    {
+      if (!this->ComponentMarkedAsRemoved(entity, typeId))
+        this->SetComponentPtr(entity, typeId, storageIter->second[slot].get());
+    }
+  }
+
   // Not copying maps related to cloning since they are transient variables
   // that are used as return values of some member functions.
 
@@ -343,6 +707,26 @@ size_t EntityComponentManager::EntityCount() const
 /////////////////////////////////////////////////
 Entity EntityComponentManager::CreateEntity()
 {
+  // Reuse the index of a removed entity if recycling is enabled, bumping
+  // the generation counter so the new ID never aliases the removed one.
+  while (this->dataPtr->entityIdRecycling &&
+      !this->dataPtr->entityFreeList.empty())
+  {
+    const Entity freed = this->dataPtr->entityFreeList.back();
+    this->dataPtr->entityFreeList.pop_back();
+
+    const uint64_t generation = entityGeneration(freed) + 1;
+    if (generation >= (uint64_t(1) << kEntityGenerationBits))
+    {
+      // this index's generation counter is exhausted; retire the index
+      continue;
+    }
+
+    const Entity entity =
+        (generation << kEntityIndexBits) | entityIndex(freed);
+    return this->dataPtr->CreateEntityImplementation(entity);
+  }
+
   Entity entity = ++this->dataPtr->entityCount;
 
   if (entity == std::numeric_limits<uint64_t>::max())
@@ -360,6 +744,7 @@ Entity EntityComponentManagerPrivate::CreateEntityImplementation(Entity _entity)
 {
   GZ_PROFILE("EntityComponentManager::CreateEntityImplementation");
   this->entities.AddVertex(std::to_string(_entity), _entity, _entity);
+  ++this->structureEpoch;
 
   // Add entity to the list of newly created entities
   {
@@ -528,30 +913,10 @@ Entity EntityComponentManager::CloneImpl(Entity _entity, Entity _parent,
   }
   this->CreateComponent(clonedEntity, components::Name(clonedName));
 
-  // copy all components from _entity to clonedEntity
-  for (const auto &type : this->ComponentTypes(_entity))
-  {
-    // skip the Name and ParentEntity components since those were already
-    // handled above
-    if ((type == components::Name::typeId) ||
-        (type == components::ParentEntity::typeId))
-      continue;
-
-    auto originalComp = this->ComponentImplementation(_entity, type);
-    auto clonedComp = originalComp->Clone();
-
-    auto updateData =
-      this->CreateComponentImplementation(clonedEntity, type, clonedComp.get());
-    if (updateData)
-    {
-      // When a cloned entity is removed, it erases all components/data so a new
-      // cloned entity should not have components to be updated
-      // LCOV_EXCL_START
-      gzerr << "Internal error: The component's data needs to be updated but "
-             << "this should not happen." << std::endl;
-      // LCOV_EXCL_STOP
-    }
-  }
+  // copy all components from _entity to clonedEntity in a single pass over
+  // the original entity's component storage. The Name and ParentEntity
+  // components are skipped since those were already handled above.
+  this->CloneComponents(_entity, clonedEntity);
 
   // keep track of canonical link information (for clones of models, the cloned
   // model should not share the same canonical link as the original model)
@@ -650,6 +1015,80 @@ Entity EntityComponentManager::CloneImpl(Entity _entity, Entity _parent,
   return clonedEntity;
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManager::CloneComponents(const Entity _from,
+    const Entity _to)
+{
+  const auto fromTypeIter = this->dataPtr->componentTypeIndex.find(_from);
+  const auto fromStorageIter = this->dataPtr->componentStorage.find(_from);
+  if (fromTypeIter == this->dataPtr->componentTypeIndex.end() ||
+      fromStorageIter == this->dataPtr->componentStorage.end())
+    return;
+
+  auto toTypeIter = this->dataPtr->componentTypeIndex.find(_to);
+  auto toStorageIter = this->dataPtr->componentStorage.find(_to);
+  if (toTypeIter == this->dataPtr->componentTypeIndex.end() ||
+      toStorageIter == this->dataPtr->componentStorage.end())
+  {
+    gzerr << "Internal error: attempt to clone components onto entity ["
+      << _to << "], but this entity is not in storage." << std::endl;
+    return;
+  }
+
+  // Order the source components by slot index so the copy preserves the
+  // original storage layout.
+  std::vector<std::pair<std::size_t, ComponentTypeId>> slots;
+  slots.reserve(fromTypeIter->second.size());
+  for (const auto &[typeId, slot] : fromTypeIter->second)
+  {
+    // skip the Name and ParentEntity components; Clone handles those
+    // explicitly
+    if (typeId == components::Name::typeId ||
+        typeId == components::ParentEntity::typeId)
+      continue;
+    if (this->dataPtr->ComponentMarkedAsRemoved(_from, typeId))
+      continue;
+    slots.emplace_back(slot, typeId);
+  }
+  std::sort(slots.begin(), slots.end());
+
+  auto &toStorage = toStorageIter->second;
+  toStorage.reserve(toStorage.size() + slots.size());
+
+  this->dataPtr->AddModifiedComponent(_to);
+
+  for (const auto &[slot, typeId] : slots)
+  {
+    auto clonedComp = fromStorageIter->second[slot]->Clone();
+    const auto vectorIdx = toStorage.size();
+    toStorage.push_back(std::move(clonedComp));
+    toTypeIter->second[typeId] = vectorIdx;
+    this->dataPtr->SetComponentPtr(_to, typeId, toStorage.back().get());
+    this->dataPtr->oneTimeChangedComponents[typeId].insert(_to);
+    this->dataPtr->JournalMutation(_to, typeId);
+    this->dataPtr->CountChangeMark(typeId);
+  }
+
+  if (!slots.empty())
+    this->dataPtr->componentTypeIndexDirty = true;
+
+  // Update view membership once for the destination entity instead of
+  // once per copied component.
+  if (this->dataPtr->batchDepth > 0)
+  {
+    this->dataPtr->batchTouchedEntities.insert(_to);
+  }
+  else
+  {
+    for (auto &viewPair : this->dataPtr->views)
+    {
+      auto &view = viewPair.second.first;
+      if (this->EntityMatches(_to, view->ComponentTypes()))
+        view->MarkEntityToAdd(_to, this->IsNewEntity(_to));
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 void EntityComponentManager::ClearNewlyCreatedEntities()
 {
@@ -774,7 +1213,22 @@ void EntityComponentManager::RequestRemoveEntities()
       std::lock_guard<std::mutex> lock(this->dataPtr->entityRemoveMutex);
       this->dataPtr->removeAllEntities = true;
     }
-    this->RebuildViews();
+
+    // Update each view's membership incrementally instead of dropping and
+    // reconstructing all views, which stalls for multiple milliseconds on
+    // large worlds. Every entity that is a part of a view (or staged to be
+    // added to one) is marked for removal; the views' cached component
+    // tuples are left intact and are cleaned up when the removal requests
+    // are processed.
+    for (auto &viewPair : this->dataPtr->views)
+    {
+      auto &view = viewPair.second.first;
+      for (const auto &entity : view->Entities())
+        view->MarkEntityToRemove(entity);
+      for (const auto &[entity, isNew] : view->ToAddEntities())
+        view->MarkEntityToRemove(entity);
+    }
+    ++this->dataPtr->rebuildViewsAvoided;
   }
   else
   {
@@ -818,6 +1272,7 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
   {
     GZ_PROFILE("RemoveAll");
     this->dataPtr->removeAllEntities = false;
+    ++this->dataPtr->structureEpoch;
     this->dataPtr->entities = EntityGraph();
     this->dataPtr->toRemoveEntities.clear();
     this->dataPtr->componentsMarkedAsRemoved.clear();
@@ -826,14 +1281,23 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
     this->dataPtr->componentStorage.clear();
     this->dataPtr->componentTypeIndex.clear();
     this->dataPtr->componentTypeIndexDirty = true;
+    this->dataPtr->componentPtrTable.clear();
 
     // All views are now invalid.
     this->dataPtr->views.clear();
+
+    // All previously handed-out IDs are gone; drop the free list rather
+    // than recycling indices from a world that no longer exists.
+    this->dataPtr->entityFreeList.clear();
   }
   else
   {
     GZ_PROFILE("Remove");
+    if (!this->dataPtr->toRemoveEntities.empty())
+      ++this->dataPtr->structureEpoch;
     // Otherwise iterate through the list of entities to remove.
+    std::unordered_set<Entity> removedEntities;
+    removedEntities.reserve(this->dataPtr->toRemoveEntities.size());
     for (const Entity entity : this->dataPtr->toRemoveEntities)
     {
       // Make sure the entity exists and is not removed.
@@ -846,12 +1310,25 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
       this->dataPtr->componentsMarkedAsRemoved.erase(entity);
       this->dataPtr->componentStorage.erase(entity);
       this->dataPtr->componentTypeIndex.erase(entity);
+      this->dataPtr->ClearComponentPtrRow(entity);
+
+      // the entity's index may now be recycled
+      if (this->dataPtr->entityIdRecycling)
+        this->dataPtr->entityFreeList.push_back(entity);
+
+      removedEntities.insert(entity);
+    }
+
+    if (!removedEntities.empty())
+    {
       this->dataPtr->componentTypeIndexDirty = true;
 
-      // Remove the entity from views.
+      // Remove the whole batch from each view at once. For large subtree
+      // removals this lets the view sweep its containers in a single pass
+      // instead of paying per-entity hash erases in every view.
       for (auto &view : this->dataPtr->views)
       {
-        view.second.first->RemoveEntity(entity);
+        view.second.first->RemoveEntities(removedEntities);
       }
     }
     // Clear the set of entities to remove.
@@ -871,6 +1348,12 @@ bool EntityComponentManager::RemoveComponent(
   if (!this->EntityHasComponentType(_entity, _typeId))
     return false;
 
+  if (components::Name::typeId == _typeId ||
+      components::ParentEntity::typeId == _typeId)
+  {
+    ++this->dataPtr->structureEpoch;
+  }
+
   auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_typeId);
   if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
   {
@@ -886,11 +1369,13 @@ bool EntityComponentManager::RemoveComponent(
     if (periodicIter->second.empty())
       this->dataPtr->periodicChangedComponents.erase(periodicIter);
   }
+  this->dataPtr->ClearPeriodicChangeBit(_typeId, _entity);
 
   auto compPtr = this->ComponentImplementation(_entity, _typeId);
   if (compPtr)
   {
     this->dataPtr->componentsMarkedAsRemoved[_entity].insert(_typeId);
+    this->dataPtr->ClearComponentPtr(_entity, _typeId);
 
     // update views to reflect the component removal
     for (auto &viewPair : this->dataPtr->views)
@@ -898,6 +1383,8 @@ bool EntityComponentManager::RemoveComponent(
   }
 
   this->dataPtr->AddModifiedComponent(_entity);
+  this->dataPtr->JournalMutation(_entity, _typeId);
+  this->dataPtr->CountChangeMark(_typeId);
 
   // Add component to map of removed components
   {
@@ -964,13 +1451,9 @@ ComponentState EntityComponentManager::ComponentState(const Entity _entity,
   {
     result = ComponentState::OneTimeChange;
   }
-  else
+  else if (this->dataPtr->PeriodicChangeBit(typeId, _entity))
   {
-    auto periodicIter =
-      this->dataPtr->periodicChangedComponents.find(typeId);
-    if (periodicIter != this->dataPtr->periodicChangedComponents.end() &&
-        periodicIter->second.find(_entity) != periodicIter->second.end())
-      result = ComponentState::PeriodicChange;
+    result = ComponentState::PeriodicChange;
   }
 
   return result;
@@ -1003,6 +1486,23 @@ bool EntityComponentManager::HasPeriodicComponentChanges() const
   return !this->dataPtr->periodicChangedComponents.empty();
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManager::ChangedEntities(const ComponentTypeId _typeId,
+    std::unordered_set<Entity> &_entities) const
+{
+  auto periodicIter = this->dataPtr->periodicChangedComponents.find(_typeId);
+  if (periodicIter != this->dataPtr->periodicChangedComponents.end())
+  {
+    _entities.insert(periodicIter->second.begin(), periodicIter->second.end());
+  }
+
+  auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_typeId);
+  if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
+  {
+    _entities.insert(oneTimeIter->second.begin(), oneTimeIter->second.end());
+  }
+}
+
 /////////////////////////////////////////////////
 std::unordered_set<ComponentTypeId>
     EntityComponentManager::ComponentTypesWithPeriodicChanges() const
@@ -1121,8 +1621,16 @@ bool EntityComponentManager::CreateComponentImplementation(
   // component is a brand new creation/addition
   bool updateData = true;
 
+  if (components::Name::typeId == _componentTypeId ||
+      components::ParentEntity::typeId == _componentTypeId)
+  {
+    ++this->dataPtr->structureEpoch;
+  }
+
   this->dataPtr->AddModifiedComponent(_entity);
   this->dataPtr->oneTimeChangedComponents[_componentTypeId].insert(_entity);
+  this->dataPtr->JournalMutation(_entity, _componentTypeId);
+  this->dataPtr->CountChangeMark(_componentTypeId);
 
   // make sure the entity exists
   auto typeMapIter = this->dataPtr->componentTypeIndex.find(_entity);
@@ -1154,13 +1662,24 @@ bool EntityComponentManager::CreateComponentImplementation(
     entityCompIter->second.push_back(std::move(newComp));
     this->dataPtr->componentTypeIndex[_entity][_componentTypeId] = vectorIdx;
     this->dataPtr->componentTypeIndexDirty = true;
+    this->dataPtr->SetComponentPtr(_entity, _componentTypeId,
+        entityCompIter->second.back().get());
 
     updateData = false;
-    for (auto &viewPair : this->dataPtr->views)
+    if (this->dataPtr->batchDepth > 0)
     {
-      auto &view = viewPair.second.first;
-      if (this->EntityMatches(_entity, view->ComponentTypes()))
-        view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+      // stage the entity; view membership is updated once per entity when
+      // the batch is committed
+      this->dataPtr->batchTouchedEntities.insert(_entity);
+    }
+    else
+    {
+      for (auto &viewPair : this->dataPtr->views)
+      {
+        auto &view = viewPair.second.first;
+        if (this->EntityMatches(_entity, view->ComponentTypes()))
+          view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+      }
     }
   }
   else
@@ -1186,6 +1705,8 @@ bool EntityComponentManager::CreateComponentImplementation(
     else if (this->dataPtr->ComponentMarkedAsRemoved(_entity, _componentTypeId))
     {
       this->dataPtr->componentsMarkedAsRemoved[_entity].erase(_componentTypeId);
+      this->dataPtr->SetComponentPtr(_entity, _componentTypeId,
+          existingCompPtr);
 
       for (auto &viewPair : this->dataPtr->views)
       {
@@ -1208,6 +1729,125 @@ bool EntityComponentManager::CreateComponentImplementation(
   return updateData;
 }
 
+/////////////////////////////////////////////////
+std::vector<Entity> EntityComponentManager::CreateComponentBatchImplementation(
+    const ComponentTypeId _componentTypeId,
+    const std::vector<std::pair<Entity,
+        const components::BaseComponent *>> &_batch)
+{
+  std::vector<Entity> needExternalUpdate;
+
+  if (_batch.empty())
+    return needExternalUpdate;
+
+  // Hoisted per-type work: the registration check, the structure epoch
+  // bump and the one-time change set lookup happen once for the whole
+  // batch instead of once per entity.
+  if (!this->HasComponentType(_componentTypeId) &&
+      !components::Factory::Instance()->HasType(_componentTypeId))
+  {
+    gzerr << "Failed to create components of type [" << _componentTypeId
+           << "]. Type has not been properly registered." << std::endl;
+    return needExternalUpdate;
+  }
+
+  if (components::Name::typeId == _componentTypeId ||
+      components::ParentEntity::typeId == _componentTypeId)
+  {
+    ++this->dataPtr->structureEpoch;
+  }
+
+  // References into unordered_map mapped values survive rehashing, so
+  // this stays valid across the insertions below.
+  auto &oneTimeChanged =
+      this->dataPtr->oneTimeChangedComponents[_componentTypeId];
+
+  bool addedNewComponent{false};
+
+  for (const auto &[entity, data] : _batch)
+  {
+    // make sure the entity exists
+    if (!this->HasEntity(entity))
+    {
+      gzerr << "Trying to create a component of type [" << _componentTypeId
+        << "] attached to entity [" << entity << "], but this entity does "
+        << "not exist. This create component request will be ignored."
+        << std::endl;
+      continue;
+    }
+
+    auto typeMapIter = this->dataPtr->componentTypeIndex.find(entity);
+    auto entityCompIter = this->dataPtr->componentStorage.find(entity);
+    if (typeMapIter == this->dataPtr->componentTypeIndex.end() ||
+        entityCompIter == this->dataPtr->componentStorage.end())
+    {
+      gzerr << "Attempt to create a component of type [" << _componentTypeId
+        << "] attached to entity [" << entity
+        << "] failed: entity not in storage." << std::endl;
+      continue;
+    }
+
+    const auto compIdxIter = typeMapIter->second.find(_componentTypeId);
+    if (compIdxIter != typeMapIter->second.end())
+    {
+      // The entity has had this component before; it may be live or
+      // marked as removed. Take the full per-entity path, which knows
+      // how to re-add and modify pre-existing components, and let the
+      // caller install the data externally.
+      if (this->CreateComponentImplementation(entity, _componentTypeId, data))
+        needExternalUpdate.push_back(entity);
+      continue;
+    }
+
+    this->dataPtr->AddModifiedComponent(entity);
+    oneTimeChanged.insert(entity);
+    this->dataPtr->JournalMutation(entity, _componentTypeId);
+    this->dataPtr->CountChangeMark(_componentTypeId);
+
+    // Instantiate the new component.
+    auto newComp = components::Factory::Instance()->New(_componentTypeId,
+        data);
+
+    const auto vectorIdx = entityCompIter->second.size();
+    entityCompIter->second.push_back(std::move(newComp));
+    typeMapIter->second[_componentTypeId] = vectorIdx;
+    this->dataPtr->SetComponentPtr(entity, _componentTypeId,
+        entityCompIter->second.back().get());
+    addedNewComponent = true;
+
+    if (this->dataPtr->batchDepth > 0)
+    {
+      // stage the entity; view membership is updated once per entity when
+      // the batch is committed
+      this->dataPtr->batchTouchedEntities.insert(entity);
+    }
+    else
+    {
+      for (auto &viewPair : this->dataPtr->views)
+      {
+        auto &view = viewPair.second.first;
+        if (this->EntityMatches(entity, view->ComponentTypes()))
+          view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+      }
+    }
+
+    // If the component is a components::ParentEntity, then make sure to
+    // update the entities graph.
+    if (_componentTypeId == components::ParentEntity::typeId)
+    {
+      auto parentComp = this->Component<components::ParentEntity>(entity);
+      this->SetParentEntity(entity, parentComp->Data());
+    }
+  }
+
+  if (addedNewComponent)
+    this->dataPtr->componentTypeIndexDirty = true;
+
+  this->dataPtr->createdCompTypes.insert(_componentTypeId);
+
+  return needExternalUpdate;
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManager::EntityMatches(Entity _entity,
     const std::set<ComponentTypeId> &_types) const
@@ -1290,6 +1930,22 @@ components::BaseComponent *EntityComponentManager::ComponentImplementation(
       *this).ComponentImplementation(_entity, _type));
 }
 
+/////////////////////////////////////////////////
+components::BaseComponent *EntityComponentManager::ComponentFastPath(
+    const Entity _entity, const std::size_t _typeIndex) const
+{
+  const auto idx = entityIndex(_entity);
+  const auto &table = this->dataPtr->componentPtrTable;
+  if (idx >= table.size())
+    return nullptr;
+
+  const auto &row = table[idx];
+  if (row.entity != _entity || _typeIndex >= row.ptrs.size())
+    return nullptr;
+
+  return row.ptrs[_typeIndex];
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManager::HasComponentType(
     const ComponentTypeId _typeId) const
@@ -1315,6 +1971,20 @@ std::pair<detail::BaseView *, std::mutex *> EntityComponentManager::FindView(
   {
     viewMutexPair.first = iter->second.first.get();
     viewMutexPair.second = iter->second.second.get();
+
+    // if an entity batch is open, flush the staged entities into this view
+    // on demand so queries issued mid-batch still see them. The entities
+    // stay staged for the remaining views until the batch is committed;
+    // re-marking an entity that was already added to a view is a no-op.
+    if (this->dataPtr->batchDepth > 0)
+    {
+      auto *view = viewMutexPair.first;
+      for (const auto &entity : this->dataPtr->batchTouchedEntities)
+      {
+        if (this->EntityMatches(entity, view->ComponentTypes()))
+          view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+      }
+    }
   }
   return viewMutexPair;
 }
@@ -1360,6 +2030,84 @@ void EntityComponentManager::RebuildViews()
   }
 }
 
+//////////////////////////////////////////////////
+uint64_t EntityComponentManager::RebuildViewsAvoidedCount() const
+{
+  return this->dataPtr->rebuildViewsAvoided;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManager::SetPackedViewStorage(bool _packed)
+{
+  this->dataPtr->packedViewStorage = _packed;
+}
+
+//////////////////////////////////////////////////
+bool EntityComponentManager::PackedViewStorage() const
+{
+  return this->dataPtr->packedViewStorage;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManager::SetEachParallelDeterministic(bool _deterministic)
+{
+  this->dataPtr->eachParallelDeterministic = _deterministic;
+}
+
+//////////////////////////////////////////////////
+bool EntityComponentManager::EachParallelDeterministic() const
+{
+  return this->dataPtr->eachParallelDeterministic;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManager::BeginEntityBatch()
+{
+  ++this->dataPtr->batchDepth;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManager::CommitEntityBatch()
+{
+  if (this->dataPtr->batchDepth <= 0)
+  {
+    gzwarn << "CommitEntityBatch called without a matching BeginEntityBatch."
+           << std::endl;
+    return;
+  }
+
+  if (--this->dataPtr->batchDepth > 0)
+    return;
+
+  // match every staged entity against the views once, instead of once per
+  // created component
+  for (const auto &entity : this->dataPtr->batchTouchedEntities)
+  {
+    if (!this->HasEntity(entity))
+      continue;
+
+    for (auto &viewPair : this->dataPtr->views)
+    {
+      auto &view = viewPair.second.first;
+      if (this->EntityMatches(entity, view->ComponentTypes()))
+        view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+    }
+  }
+  this->dataPtr->batchTouchedEntities.clear();
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManager::SetEntityIdRecycling(bool _enable)
+{
+  this->dataPtr->entityIdRecycling = _enable;
+}
+
+//////////////////////////////////////////////////
+bool EntityComponentManager::EntityIdRecycling() const
+{
+  return this->dataPtr->entityIdRecycling;
+}
+
 //////////////////////////////////////////////////
 void EntityComponentManagerPrivate::SetRemovedComponentsMsgs(Entity &_entity,
     msgs::SerializedEntity *_entityMsg,
@@ -1553,11 +2301,10 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
 
       if (noChange)
       {
-        // see if the entity has a component of this particular type marked as a
-        // periodic change
-        auto periodicIter = this->dataPtr->periodicChangedComponents.find(type);
-        if (periodicIter != this->dataPtr->periodicChangedComponents.end() &&
-            periodicIter->second.find(_entity) != periodicIter->second.end())
+        // see if the entity has a component of this particular type marked as
+        // a periodic change. The hierarchical dirty bitsets reject clean
+        // types and clean entity blocks in O(1).
+        if (this->dataPtr->PeriodicChangeBit(type, _entity))
           noChange = false;
       }
 
@@ -1651,6 +2398,22 @@ void EntityComponentManager::ChangedState(
   }
 }
 
+//////////////////////////////////////////////////
+void EntityComponentManager::ChangedState(std::string &_buffer) const
+{
+  // Reuse a scratch message across snapshots. Clear() keeps the message's
+  // allocated heap blocks, so in steady state the changed components are
+  // serialized into _buffer without any intermediate allocations.
+  auto &scratch = this->dataPtr->changedStateScratchMsg;
+  scratch.Clear();
+  this->ChangedState(scratch);
+
+  _buffer.clear();
+  if (scratch.entities().empty())
+    return;
+  scratch.AppendToString(&_buffer);
+}
+
 //////////////////////////////////////////////////
 void EntityComponentManagerPrivate::CalculateStateThreadLoad()
 {
@@ -2031,6 +2794,7 @@ std::unordered_set<Entity> EntityComponentManager::Descendants(Entity _entity)
 void EntityComponentManager::SetAllComponentsUnchanged()
 {
   this->dataPtr->periodicChangedComponents.clear();
+  this->dataPtr->periodicChangedBlocks.clear();
   this->dataPtr->oneTimeChangedComponents.clear();
   this->dataPtr->modifiedComponents.clear();
 }
@@ -2053,6 +2817,7 @@ void EntityComponentManager::SetChanged(
   if (_c == ComponentState::PeriodicChange)
   {
     this->dataPtr->periodicChangedComponents[_type].insert(_entity);
+    this->dataPtr->SetPeriodicChangeBit(_type, _entity);
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
       oneTimeIter->second.erase(_entity);
@@ -2062,6 +2827,7 @@ void EntityComponentManager::SetChanged(
     auto periodicIter = this->dataPtr->periodicChangedComponents.find(_type);
     if (periodicIter != this->dataPtr->periodicChangedComponents.end())
       periodicIter->second.erase(_entity);
+    this->dataPtr->ClearPeriodicChangeBit(_type, _entity);
     this->dataPtr->oneTimeChangedComponents[_type].insert(_entity);
   }
   else
@@ -2069,6 +2835,7 @@ void EntityComponentManager::SetChanged(
     auto periodicIter = this->dataPtr->periodicChangedComponents.find(_type);
     if (periodicIter != this->dataPtr->periodicChangedComponents.end())
       periodicIter->second.erase(_entity);
+    this->dataPtr->ClearPeriodicChangeBit(_type, _entity);
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
       oneTimeIter->second.erase(_entity);
@@ -2079,6 +2846,72 @@ void EntityComponentManager::SetChanged(
   }
 
   this->dataPtr->AddModifiedComponent(_entity);
+  this->dataPtr->JournalMutation(_entity, _type);
+  this->dataPtr->CountChangeMark(_type);
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::SetChanged(
+    const ComponentTypeId _type, const std::vector<Entity> &_entities,
+    sim::ComponentState _c)
+{
+  if (_entities.empty())
+    return;
+
+  if (_c == ComponentState::NoChange)
+  {
+    for (const Entity entity : _entities)
+      this->SetChanged(entity, _type, _c);
+    return;
+  }
+
+  // Resolve the per-type tracking structures once for the whole batch.
+  std::unordered_set<Entity> *periodicSet{nullptr};
+  std::unordered_set<Entity> *oneTimeSet{nullptr};
+  if (_c == ComponentState::PeriodicChange)
+  {
+    periodicSet = &this->dataPtr->periodicChangedComponents[_type];
+    auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
+    if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
+      oneTimeSet = &oneTimeIter->second;
+  }
+  else
+  {
+    oneTimeSet = &this->dataPtr->oneTimeChangedComponents[_type];
+    auto periodicIter = this->dataPtr->periodicChangedComponents.find(_type);
+    if (periodicIter != this->dataPtr->periodicChangedComponents.end())
+      periodicSet = &periodicIter->second;
+  }
+
+  for (const Entity entity : _entities)
+  {
+    // make sure the entity exists and has a component of type _type
+    auto ecIter = this->dataPtr->componentTypeIndex.find(entity);
+    if (ecIter == this->dataPtr->componentTypeIndex.end())
+      continue;
+    if (ecIter->second.find(_type) == ecIter->second.end() ||
+        this->dataPtr->ComponentMarkedAsRemoved(entity, _type))
+      continue;
+
+    if (_c == ComponentState::PeriodicChange)
+    {
+      periodicSet->insert(entity);
+      this->dataPtr->SetPeriodicChangeBit(_type, entity);
+      if (nullptr != oneTimeSet)
+        oneTimeSet->erase(entity);
+    }
+    else
+    {
+      if (nullptr != periodicSet)
+        periodicSet->erase(entity);
+      this->dataPtr->ClearPeriodicChangeBit(_type, entity);
+      oneTimeSet->insert(entity);
+    }
+
+    this->dataPtr->AddModifiedComponent(entity);
+    this->dataPtr->JournalMutation(entity, _type);
+    this->dataPtr->CountChangeMark(_type);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -2265,6 +3098,22 @@ EntityComponentManagerDiff EntityComponentManager::ComputeEntityDiff(
       diff.InsertRemovedEntity(v.Data());
     }
   }
+
+  if (this->dataPtr->trackComponentMutations)
+  {
+    // Component-level deltas only apply to entities present in both
+    // managers; entities in only one of them are handled wholesale as
+    // added/removed entities above.
+    for (const auto &[entity, types] : this->dataPtr->mutatedComponents)
+    {
+      if (!this->dataPtr->entities.VertexFromId(entity).Valid() ||
+          !_other.dataPtr->entities.VertexFromId(entity).Valid())
+        continue;
+      for (const auto &type : types)
+        diff.InsertModifiedComponent(entity, type);
+    }
+  }
+
   return diff;
 }
 
@@ -2329,10 +3178,134 @@ void EntityComponentManager::ApplyEntityDiff(
 void EntityComponentManager::ResetTo(const EntityComponentManager &_other)
 {
   auto ecmDiff = this->ComputeEntityDiff(_other);
-  EntityComponentManager tmpCopy;
-  tmpCopy.CopyFrom(_other);
-  tmpCopy.ApplyEntityDiff(*this, ecmDiff);
-  this->CopyFrom(tmpCopy);
+
+  if (!this->dataPtr->trackComponentMutations)
+  {
+    EntityComponentManager tmpCopy;
+    tmpCopy.CopyFrom(_other);
+    tmpCopy.ApplyEntityDiff(*this, ecmDiff);
+    this->CopyFrom(tmpCopy);
+    return;
+  }
+
+  // Every component mutation since tracking started was journaled, so the
+  // reset can be applied in place at a cost proportional to what changed
+  // instead of cloning the entire world twice.
+
+  // Re-create entities that were removed since the snapshot. They are
+  // marked as newly created so systems re-initialize their state.
+  for (const auto &entity : ecmDiff.AddedEntities())
+  {
+    if (this->HasEntity(entity))
+      continue;
+
+    this->dataPtr->CreateEntityImplementation(entity);
+    if (entity >= this->dataPtr->entityCount)
+    {
+      this->dataPtr->entityCount = entity;
+    }
+    for (const auto compTypeId : _other.ComponentTypes(entity))
+    {
+      const components::BaseComponent *data =
+          _other.ComponentImplementation(entity, compTypeId);
+      this->CreateComponentImplementation(entity, compTypeId, data);
+    }
+    this->SetParentEntity(entity, _other.ParentEntity(entity));
+  }
+
+  // Mark entities that were created since the snapshot for removal. Their
+  // components are left in place so systems still match them in
+  // EachRemoved.
+  for (const auto &entity : ecmDiff.RemovedEntities())
+  {
+    this->RequestRemoveEntity(entity, false);
+  }
+
+  // Restore the components recorded in the journal
+  for (const auto &[entity, typeId] : ecmDiff.ModifiedComponents())
+  {
+    const auto *snapComp = _other.ComponentImplementation(entity, typeId);
+    auto *liveComp = this->ComponentImplementation(entity, typeId);
+    if (nullptr != snapComp)
+    {
+      bool updateData = true;
+      if (nullptr == liveComp)
+      {
+        // the component was removed during the episode; re-add it
+        updateData =
+            this->CreateComponentImplementation(entity, typeId, snapComp);
+      }
+      if (updateData)
+      {
+        // write the snapshot's data over whatever the episode left behind
+        this->dataPtr->ReplaceComponentData(entity, typeId, snapComp);
+      }
+      this->SetChanged(entity, typeId, ComponentState::OneTimeChange);
+
+      if (typeId == components::ParentEntity::typeId)
+      {
+        this->SetParentEntity(entity,
+            static_cast<const components::ParentEntity *>(snapComp)->Data());
+      }
+    }
+    else if (nullptr != liveComp)
+    {
+      // the component was added during the episode; remove it
+      this->RemoveComponent(entity, typeId);
+    }
+  }
+
+  // Replacing stored component instances invalidates the raw pointers that
+  // views hold, so rebuild them.
+  if (!ecmDiff.ModifiedComponents().empty())
+    this->RebuildViews();
+
+  // Start a fresh journal for the next episode
+  this->dataPtr->mutatedComponents.clear();
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::SetComponentMutationTracking(bool _enable)
+{
+  this->dataPtr->trackComponentMutations = _enable;
+  this->dataPtr->mutatedComponents.clear();
+}
+
+/////////////////////////////////////////////////
+bool EntityComponentManager::ComponentMutationTracking() const
+{
+  return this->dataPtr->trackComponentMutations;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::SetChangeRateTracking(bool _enable)
+{
+  this->dataPtr->trackChangeRates = _enable;
+  this->dataPtr->changeRateCounters.clear();
+  this->dataPtr->changeRateWindowStart = std::chrono::steady_clock::now();
+}
+
+/////////////////////////////////////////////////
+bool EntityComponentManager::ChangeRateTracking() const
+{
+  return this->dataPtr->trackChangeRates;
+}
+
+/////////////////////////////////////////////////
+std::map<ComponentTypeId, uint64_t>
+EntityComponentManager::ChangeRateCounters() const
+{
+  return this->dataPtr->changeRateCounters;
+}
+
+/////////////////////////////////////////////////
+std::chrono::steady_clock::duration
+EntityComponentManager::ChangeRateWindow() const
+{
+  if (!this->dataPtr->trackChangeRates)
+    return std::chrono::steady_clock::duration::zero();
+  return std::chrono::steady_clock::now() -
+      this->dataPtr->changeRateWindowStart;
 }
 
 /////////////////////////////////////////////////
@@ -2346,3 +3319,234 @@ std::optional<Entity> EntityComponentManager::EntityByName(
 
   return entity;
 }
+
+/// \brief Separator used internally by the scoped name index. Chosen so it
+/// can't appear in user-supplied delimiters like "::" or "/".
+static constexpr char kScopedNameSep = '\x1f';
+
+/////////////////////////////////////////////////
+uint64_t EntityComponentManager::EntityStructureEpoch() const
+{
+  return this->dataPtr->structureEpoch;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::RefreshScopedNameIndex() const
+{
+  const uint64_t epoch = this->dataPtr->structureEpoch;
+  if (epoch == this->dataPtr->scopedNameIndexEpoch)
+    return;
+
+  GZ_PROFILE("EntityComponentManager::RefreshScopedNameIndex");
+  this->dataPtr->scopedNameIndex.clear();
+  this->dataPtr->entityNamePaths.clear();
+
+  for (const auto &vertex : this->dataPtr->entities.Vertices())
+  {
+    const Entity entity = vertex.first;
+    if (nullptr == this->Component<components::Name>(entity))
+      continue;
+
+    // Walk up the chain of named ancestors, collecting names leaf-first.
+    // An unnamed ancestor ends the path, matching the per-level name
+    // queries this index replaces.
+    std::vector<std::string> names;
+    Entity current = entity;
+    while (true)
+    {
+      auto nameComp = this->Component<components::Name>(current);
+      if (nullptr == nameComp)
+        break;
+      names.push_back(nameComp->Data());
+      auto parentComp = this->Component<components::ParentEntity>(current);
+      if (nullptr == parentComp)
+        break;
+      current = parentComp->Data();
+    }
+
+    // Index every suffix of the name path, so a partial scoped name
+    // matches an entity at any depth.
+    std::string path;
+    for (const auto &name : names)
+    {
+      if (path.empty())
+        path = name;
+      else
+        path.insert(0, name + kScopedNameSep);
+      this->dataPtr->scopedNameIndex[path].insert(entity);
+    }
+    this->dataPtr->entityNamePaths[entity] = path;
+  }
+
+  this->dataPtr->scopedNameIndexEpoch = epoch;
+}
+
+/////////////////////////////////////////////////
+std::unordered_set<Entity> EntityComponentManager::EntitiesByScopedName(
+    const std::string &_scopedName, const std::string &_delim,
+    Entity _relativeTo) const
+{
+  if (_delim.empty())
+  {
+    gzwarn << "Can't process scoped name [" << _scopedName
+           << "] with empty delimiter." << std::endl;
+    return {};
+  }
+
+  // Split the scoped name on the delimiter
+  std::vector<std::string> names;
+  size_t pos1 = 0;
+  size_t pos2 = _scopedName.find(_delim);
+  while (pos2 != std::string::npos)
+  {
+    names.push_back(_scopedName.substr(pos1, pos2 - pos1));
+    pos1 = pos2 + _delim.length();
+    pos2 = _scopedName.find(_delim, pos1);
+  }
+  names.push_back(_scopedName.substr(pos1, _scopedName.size() - pos1));
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->scopedNameMutex);
+  this->RefreshScopedNameIndex();
+
+  std::string key;
+  if (_relativeTo != kNullEntity)
+  {
+    auto pathIt = this->dataPtr->entityNamePaths.find(_relativeTo);
+    if (pathIt == this->dataPtr->entityNamePaths.end())
+    {
+      // The relative entity has no name path to anchor on, e.g. it is
+      // unnamed. Match its children level by level instead.
+      std::vector<Entity> resVector{_relativeTo};
+      for (const auto &name : names)
+      {
+        std::vector<Entity> current;
+        for (auto res : resVector)
+        {
+          auto matches = this->EntitiesByComponents(components::Name(name),
+              components::ParentEntity(res));
+          std::copy(std::begin(matches), std::end(matches),
+              std::back_inserter(current));
+        }
+        if (current.empty())
+          return {};
+        resVector = current;
+      }
+      return std::unordered_set<Entity>(resVector.begin(), resVector.end());
+    }
+    key = pathIt->second;
+    key.push_back(kScopedNameSep);
+  }
+
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    if (i > 0)
+      key.push_back(kScopedNameSep);
+    key.append(names[i]);
+  }
+
+  auto indexIt = this->dataPtr->scopedNameIndex.find(key);
+  if (indexIt == this->dataPtr->scopedNameIndex.end())
+    return {};
+
+  if (_relativeTo == kNullEntity)
+    return indexIt->second;
+
+  // Duplicate scoped names can make a suffix probe match entities outside
+  // the relative entity's subtree; verify the ancestor chain.
+  std::unordered_set<Entity> result;
+  for (const Entity entity : indexIt->second)
+  {
+    Entity current = entity;
+    bool valid = true;
+    for (size_t level = 0; level < names.size(); ++level)
+    {
+      auto parentComp = this->Component<components::ParentEntity>(current);
+      if (nullptr == parentComp)
+      {
+        valid = false;
+        break;
+      }
+      current = parentComp->Data();
+    }
+    if (valid && current == _relativeTo)
+      result.insert(entity);
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+uint32_t EntityComponentManager::NameSymbol(const std::string &_name) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->nameSymbolMutex);
+  auto symbolIt = this->dataPtr->nameSymbolIds.find(_name);
+  if (symbolIt != this->dataPtr->nameSymbolIds.end())
+    return symbolIt->second;
+
+  const auto symbol =
+      static_cast<uint32_t>(this->dataPtr->nameSymbols.size());
+  this->dataPtr->nameSymbols.push_back(_name);
+  this->dataPtr->nameSymbolIds.emplace(_name, symbol);
+  return symbol;
+}
+
+/////////////////////////////////////////////////
+const std::string &EntityComponentManager::SymbolString(
+    uint32_t _symbol) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->nameSymbolMutex);
+  if (_symbol >= this->dataPtr->nameSymbols.size())
+    return this->dataPtr->nameSymbols.front();
+  return this->dataPtr->nameSymbols[_symbol];
+}
+
+/////////////////////////////////////////////////
+uint32_t EntityComponentManager::EntityNameSymbol(Entity _entity) const
+{
+  auto nameComp = this->Component<components::Name>(_entity);
+  if (nullptr == nameComp)
+    return 0u;
+  return this->NameSymbol(nameComp->Data());
+}
+
+/////////////////////////////////////////////////
+EntityComponentManager::MemoryStats
+EntityComponentManager::MemoryStatistics() const
+{
+  MemoryStats stats;
+  stats.entityCount = this->EntityCount();
+
+  for (const auto &[entity, comps] : this->dataPtr->componentStorage)
+  {
+    for (const auto &comp : comps)
+    {
+      if (nullptr == comp)
+        continue;
+
+      const auto typeId = comp->TypeId();
+      auto &typeStats = stats.componentTypes[typeId];
+      if (typeStats.name.empty())
+        typeStats.name = components::Factory::Instance()->Name(typeId);
+
+      typeStats.sizeBytes += comp->SizeBytes();
+      if (this->dataPtr->ComponentMarkedAsRemoved(entity, typeId))
+      {
+        typeStats.markedRemovedCount++;
+      }
+      else
+      {
+        typeStats.count++;
+        stats.componentCount++;
+      }
+    }
+  }
+
+  for (const auto &[typeId, typeStats] : stats.componentTypes)
+    stats.componentSizeBytes += typeStats.sizeBytes;
+
+  std::lock_guard<std::mutex> lockViews(this->dataPtr->viewsMutex);
+  stats.viewCount = this->dataPtr->views.size();
+  for (const auto &[key, view] : this->dataPtr->views)
+    stats.viewEntityCount += view.first->Entities().size();
+
+  return stats;
+}
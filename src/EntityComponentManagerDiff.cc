@@ -46,6 +46,20 @@ const std::vector<Entity> &EntityComponentManagerDiff::RemovedEntities() const
   return this->removedEntities;
 }
 
+//////////////////////////////////////////////////
+void EntityComponentManagerDiff::InsertModifiedComponent(
+    const Entity &_entity, ComponentTypeId _typeId)
+{
+  this->modifiedComponents.push_back({_entity, _typeId});
+}
+
+//////////////////////////////////////////////////
+const std::vector<std::pair<Entity, ComponentTypeId>>
+    &EntityComponentManagerDiff::ModifiedComponents() const
+{
+  return this->modifiedComponents;
+}
+
 //////////////////////////////////////////////////
 void EntityComponentManagerDiff::ClearAddedEntities()
 {
@@ -57,3 +71,9 @@ void EntityComponentManagerDiff::ClearRemovedEntities()
 {
   this->removedEntities.clear();
 }
+
+//////////////////////////////////////////////////
+void EntityComponentManagerDiff::ClearModifiedComponents()
+{
+  this->modifiedComponents.clear();
+}
@@ -22,6 +22,7 @@
 #include "gz/sim/Export.hh"
 #include "gz/sim/Types.hh"
 
+#include <utility>
 #include <vector>
 
 namespace gz
@@ -52,17 +53,36 @@ namespace gz
       /// \return Vector of Entity IDs removed since construction/clear
       public: const std::vector<Entity> &RemovedEntities() const;
 
+      /// \brief Add a modified component to the current diff
+      /// \param[in] _entity Entity the component belongs to
+      /// \param[in] _typeId Type of the component that was modified
+      public: void InsertModifiedComponent(const Entity &_entity,
+                  ComponentTypeId _typeId);
+
+      /// \brief Retrieve the list of modified components
+      /// \return Vector of (entity, component type) pairs that were
+      /// modified since construction/clear
+      public: const std::vector<std::pair<Entity, ComponentTypeId>>
+                  &ModifiedComponents() const;
+
       /// \brief Clear the list of added entities
       public: void ClearAddedEntities();
 
       /// \brief Clear the list of removed entities
       public: void ClearRemovedEntities();
 
+      /// \brief Clear the list of modified components
+      public: void ClearModifiedComponents();
+
       /// \brief List of added entities
       private: std::vector<Entity> addedEntities;
 
       /// \brief List of removed entities
       private: std::vector<Entity> removedEntities;
+
+      /// \brief List of modified components
+      private: std::vector<std::pair<Entity, ComponentTypeId>>
+                   modifiedComponents;
     };
   }
   }
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <unordered_set>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
 #include <gz/math/Pose3.hh>
@@ -489,6 +495,85 @@ TEST_P(EntityComponentManagerFixture,
   }
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(SetComponentDataBatch))
+{
+  // Create some entities
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  Entity e3 = manager.CreateEntity();
+
+  manager.CreateComponent(e1, IntComponent(1));
+  manager.CreateComponent(e2, IntComponent(2));
+  manager.RunSetAllComponentsUnchanged();
+
+  // Batch-set data. e3 doesn't have the component yet, so it gets created,
+  // and e2's data doesn't change.
+  manager.SetComponentDataBatch<IntComponent>(
+      {{e1, 100}, {e2, 2}, {e3, 300}});
+
+  EXPECT_EQ(100, manager.ComponentData<IntComponent>(e1));
+  EXPECT_EQ(2, manager.ComponentData<IntComponent>(e2));
+  EXPECT_EQ(300, manager.ComponentData<IntComponent>(e3));
+
+  // Changed data is recorded as a periodic change, unchanged data isn't,
+  // and newly created components are one-time changes.
+  EXPECT_EQ(ComponentState::PeriodicChange,
+      manager.ComponentState(e1, IntComponent::typeId));
+  EXPECT_EQ(ComponentState::NoChange,
+      manager.ComponentState(e2, IntComponent::typeId));
+  EXPECT_EQ(ComponentState::OneTimeChange,
+      manager.ComponentState(e3, IntComponent::typeId));
+
+  // The batch can also record one-time changes.
+  manager.RunSetAllComponentsUnchanged();
+  manager.SetComponentDataBatch<IntComponent>(
+      {{e1, 101}}, ComponentState::OneTimeChange);
+  EXPECT_EQ(101, manager.ComponentData<IntComponent>(e1));
+  EXPECT_EQ(ComponentState::OneTimeChange,
+      manager.ComponentState(e1, IntComponent::typeId));
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ChangedEntities))
+{
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  Entity e3 = manager.CreateEntity();
+  manager.CreateComponent<IntComponent>(e1, IntComponent(1));
+  manager.CreateComponent<IntComponent>(e2, IntComponent(2));
+  manager.CreateComponent<IntComponent>(e3, IntComponent(3));
+
+  // Creation marks one-time changes on all entities.
+  std::unordered_set<Entity> changed;
+  manager.ChangedEntities(IntComponent::typeId, changed);
+  EXPECT_EQ(3u, changed.size());
+
+  // Once processed, nothing is marked as changed.
+  manager.RunSetAllComponentsUnchanged();
+  changed.clear();
+  manager.ChangedEntities(IntComponent::typeId, changed);
+  EXPECT_TRUE(changed.empty());
+
+  // One-time and periodic changes are combined into the output set.
+  manager.SetComponentData<IntComponent>(e1, 10);
+  manager.SetChanged(e1, IntComponent::typeId, ComponentState::PeriodicChange);
+  manager.SetComponentData<IntComponent>(e2, 20);
+  manager.SetChanged(e2, IntComponent::typeId, ComponentState::OneTimeChange);
+  changed.clear();
+  manager.ChangedEntities(IntComponent::typeId, changed);
+  EXPECT_EQ(2u, changed.size());
+  EXPECT_NE(changed.end(), changed.find(e1));
+  EXPECT_NE(changed.end(), changed.find(e2));
+  EXPECT_EQ(changed.end(), changed.find(e3));
+
+  // Querying a type with no changes leaves the set untouched.
+  manager.ChangedEntities(DoubleComponent::typeId, changed);
+  EXPECT_EQ(2u, changed.size());
+}
+
 //////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
        GZ_UTILS_TEST_DISABLED_ON_WIN32(RebuildViews))
@@ -559,6 +644,380 @@ TEST_P(EntityComponentManagerFixture,
   }
 }
 
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(PackedViewStorage))
+{
+  // Packed view storage is off by default
+  EXPECT_FALSE(manager.PackedViewStorage());
+  manager.SetPackedViewStorage(true);
+  EXPECT_TRUE(manager.PackedViewStorage());
+
+  // Create some entities
+  Entity eInt = manager.CreateEntity();
+  Entity eDouble = manager.CreateEntity();
+  Entity eIntDouble = manager.CreateEntity();
+  EXPECT_EQ(3u, manager.EntityCount());
+
+  // Add components of different types to each entity
+  ASSERT_NE(nullptr,
+      manager.CreateComponent<IntComponent>(eInt, IntComponent(123)));
+  ASSERT_NE(nullptr, manager.CreateComponent<DoubleComponent>(eDouble,
+      DoubleComponent(0.123)));
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(eIntDouble,
+      IntComponent(456)));
+  ASSERT_NE(nullptr, manager.CreateComponent<DoubleComponent>(eIntDouble,
+      DoubleComponent(0.456)));
+
+  // Each should visit the same entities and values as the default storage
+  int count = 0;
+  manager.Each<IntComponent>([&](const Entity &_entity,
+        const IntComponent *_value)->bool
+      {
+        EXPECT_NE(nullptr, _value);
+        if (_entity == eInt)
+        {
+          EXPECT_EQ(123, _value->Data());
+        }
+        if (_entity == eIntDouble)
+        {
+          EXPECT_EQ(456, _value->Data());
+        }
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  // Mutation through the non-const Each should work on packed data
+  manager.Each<IntComponent>([&](const Entity &, IntComponent *_value)->bool
+      {
+        _value->Data() += 1;
+        return true;
+      });
+  EXPECT_EQ(124, manager.Component<IntComponent>(eInt)->Data());
+  EXPECT_EQ(457, manager.Component<IntComponent>(eIntDouble)->Data());
+
+  // Removing a component should invalidate the packed arrays so that the
+  // entity is no longer visited
+  EXPECT_TRUE(manager.RemoveComponent(eIntDouble, IntComponent::typeId));
+  count = 0;
+  manager.Each<IntComponent>([&](const Entity &_entity,
+        const IntComponent *_value)->bool
+      {
+        EXPECT_NE(nullptr, _value);
+        EXPECT_EQ(eInt, _entity);
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+
+  // Adding the component back should re-pack the entity into the view
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(eIntDouble,
+      IntComponent(789)));
+  count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EachParallel))
+{
+  // Create enough entities that EachParallel dispatches multiple chunks
+  const int numEntities = 1000;
+  for (int i = 0; i < numEntities; ++i)
+  {
+    Entity entity = manager.CreateEntity();
+    ASSERT_NE(nullptr,
+        manager.CreateComponent<IntComponent>(entity, IntComponent(i)));
+  }
+  EXPECT_EQ(static_cast<size_t>(numEntities), manager.EntityCount());
+
+  // The read-only overload should visit every matching entity exactly once
+  std::atomic<int> count{0};
+  manager.EachParallel<IntComponent>([&](const Entity &,
+        const IntComponent *_value)
+      {
+        EXPECT_NE(nullptr, _value);
+        ++count;
+      });
+  EXPECT_EQ(numEntities, count);
+
+  // The mutating overload may modify the visited entity's components
+  manager.EachParallel<IntComponent>([&](const Entity &, IntComponent *_value)
+      {
+        _value->Data() += 1;
+      });
+
+  int sum = 0;
+  manager.Each<IntComponent>([&](const Entity &,
+        const IntComponent *_value)->bool
+      {
+        sum += _value->Data();
+        return true;
+      });
+  // each entity started with values 0..numEntities-1 and was incremented once
+  EXPECT_EQ(numEntities * (numEntities - 1) / 2 + numEntities, sum);
+
+  // In deterministic mode, entities are visited serially in the same packed
+  // order that Each uses
+  EXPECT_FALSE(manager.EachParallelDeterministic());
+  manager.SetEachParallelDeterministic(true);
+  EXPECT_TRUE(manager.EachParallelDeterministic());
+
+  std::vector<Entity> parallelOrder;
+  manager.EachParallel<IntComponent>([&](const Entity &_entity,
+        const IntComponent *)
+      {
+        parallelOrder.push_back(_entity);
+      });
+
+  std::vector<Entity> serialOrder;
+  manager.Each<IntComponent>([&](const Entity &_entity,
+        const IntComponent *)->bool
+      {
+        serialOrder.push_back(_entity);
+        return true;
+      });
+  EXPECT_EQ(serialOrder, parallelOrder);
+}
+
+/////////////////////////////////////////////////
+// Regression test: the lazy packed rebuild used to be unsynchronized, so
+// two threads iterating the same view after a membership change could
+// concurrently clear and refill the packed arrays. Run concurrent
+// EachParallel calls against a freshly dirtied view; under a thread
+// sanitizer this catches any regression in the rebuild synchronization.
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EachParallelConcurrentRebuild))
+{
+  const int numEntities = 1000;
+  std::vector<Entity> entities;
+  for (int i = 0; i < numEntities; ++i)
+  {
+    Entity entity = manager.CreateEntity();
+    entities.push_back(entity);
+    ASSERT_NE(nullptr,
+        manager.CreateComponent<IntComponent>(entity, IntComponent(i)));
+  }
+
+  // Build the view and its packed arrays once, then dirty them through a
+  // component removal so the next iteration triggers a rebuild.
+  manager.EachParallel<IntComponent>(
+      [](const Entity &, const IntComponent *)
+      {
+      });
+  EXPECT_TRUE(manager.RemoveComponent(entities.front(),
+      IntComponent::typeId));
+
+  std::atomic<int> countA{0};
+  std::atomic<int> countB{0};
+  std::thread threadA([&]()
+      {
+        manager.EachParallel<IntComponent>(
+            [&](const Entity &, const IntComponent *_value)
+            {
+              EXPECT_NE(nullptr, _value);
+              ++countA;
+            });
+      });
+  std::thread threadB([&]()
+      {
+        manager.EachParallel<IntComponent>(
+            [&](const Entity &, const IntComponent *_value)
+            {
+              EXPECT_NE(nullptr, _value);
+              ++countB;
+            });
+      });
+  threadA.join();
+  threadB.join();
+
+  // Both threads iterate the same rebuilt arrays and visit every remaining
+  // entity exactly once.
+  EXPECT_EQ(numEntities - 1, countA);
+  EXPECT_EQ(numEntities - 1, countB);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(IncrementalViewMaintenance))
+{
+  EXPECT_EQ(0u, manager.RebuildViewsAvoidedCount());
+
+  // Create entities and a view over IntComponent
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e1,
+      IntComponent(1)));
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e2,
+      IntComponent(2)));
+
+  int count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  // Removing all entities should be handled incrementally by marking the
+  // views' entities for removal rather than rebuilding every view
+  manager.RequestRemoveEntities();
+  EXPECT_EQ(1u, manager.RebuildViewsAvoidedCount());
+
+  // The entities should be visible to EachRemoved until removal requests
+  // are processed
+  count = 0;
+  manager.EachRemoved<IntComponent>([&](const Entity &,
+        const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  manager.ProcessEntityRemovals();
+  EXPECT_EQ(0u, manager.EntityCount());
+  count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(0, count);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ChangedStateBuffer))
+{
+  // With no changes, the buffer should come back empty
+  manager.RunClearNewlyCreatedEntities();
+  std::string buffer = "stale";
+  manager.ChangedState(buffer);
+  EXPECT_TRUE(buffer.empty());
+
+  // Create an entity with a component
+  Entity e1 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e1,
+      IntComponent(123)));
+
+  // The buffer overload should produce the same wire bytes as serializing
+  // the message built by the map overload
+  manager.ChangedState(buffer);
+  EXPECT_FALSE(buffer.empty());
+
+  msgs::SerializedStateMap stateMsg;
+  manager.ChangedState(stateMsg);
+  std::string expected;
+  stateMsg.SerializeToString(&expected);
+  EXPECT_EQ(expected, buffer);
+
+  // The buffer should be deserializable into an equivalent state message
+  msgs::SerializedStateMap fromBuffer;
+  ASSERT_TRUE(fromBuffer.ParseFromString(buffer));
+  EXPECT_EQ(1, fromBuffer.entities_size());
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityIdRecycling))
+{
+  // Recycling is off by default: IDs are monotonic
+  EXPECT_FALSE(manager.EntityIdRecycling());
+  manager.SetEntityIdRecycling(true);
+  EXPECT_TRUE(manager.EntityIdRecycling());
+
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  Entity e3 = manager.CreateEntity();
+  EXPECT_EQ(3u, manager.EntityCount());
+  EXPECT_EQ(0u, entityGeneration(e1));
+
+  // Remove an entity and process the removal; its index goes on the free
+  // list
+  manager.RequestRemoveEntity(e2);
+  manager.ProcessEntityRemovals();
+  EXPECT_FALSE(manager.HasEntity(e2));
+  EXPECT_EQ(2u, manager.EntityCount());
+
+  // The next entity reuses e2's index with a bumped generation, so the new
+  // ID is distinct from the removed one
+  Entity e4 = manager.CreateEntity();
+  EXPECT_NE(e2, e4);
+  EXPECT_EQ(entityIndex(e2), entityIndex(e4));
+  EXPECT_EQ(entityGeneration(e2) + 1, entityGeneration(e4));
+  EXPECT_TRUE(manager.HasEntity(e4));
+  EXPECT_EQ(3u, manager.EntityCount());
+
+  // Components attach to the recycled ID like any other entity
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e4,
+      IntComponent(42)));
+  EXPECT_EQ(42, manager.Component<IntComponent>(e4)->Data());
+  EXPECT_EQ(nullptr, manager.Component<IntComponent>(e2));
+
+  // With the free list drained, IDs continue monotonically
+  Entity e5 = manager.CreateEntity();
+  EXPECT_EQ(0u, entityGeneration(e5));
+  EXPECT_GT(entityIndex(e5), entityIndex(e3));
+  (void)e1;
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityBatch))
+{
+  // Create a view before the batch so the batched path has a view to
+  // maintain
+  int count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(0, count);
+
+  manager.BeginEntityBatch();
+  Entity e1 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e1,
+      IntComponent(1)));
+  Entity e2 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e2,
+      IntComponent(2)));
+
+  // Queries issued while the batch is open must still see the staged
+  // entities
+  count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  Entity e3 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e3,
+      IntComponent(3)));
+  manager.CommitEntityBatch();
+
+  // After the commit, all batched entities are in the view
+  count = 0;
+  manager.Each<IntComponent>([&](const Entity &, const IntComponent *)->bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(3, count);
+
+  // An unbalanced commit is ignored
+  manager.CommitEntityBatch();
+}
+
 //////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
        GZ_UTILS_TEST_DISABLED_ON_WIN32(ViewsAddComponents))
@@ -3333,6 +3792,87 @@ TEST_P(EntityComponentManagerFixture, ResetToWithAddedEntity)
   }
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(ResetToWithMutationTracking))
+{
+  Entity entity1 = manager.CreateEntity();
+  math::Pose3d testPose{1, 2, 3, 0.1, 0.2, 0.3};
+  manager.CreateComponent(entity1, Pose{testPose});
+  manager.CreateComponent(entity1, Name{"entity1"});
+
+  Entity entity2 = manager.CreateEntity();
+  manager.CreateComponent(entity2, Name{"entity2"});
+  manager.CreateComponent(entity2, IntComponent{42});
+
+  // Take the snapshot and start recording mutations
+  EntityCompMgrTest managerCopy;
+  managerCopy.CopyFrom(manager);
+  manager.SetComponentMutationTracking(true);
+  EXPECT_TRUE(manager.ComponentMutationTracking());
+
+  manager.RunClearNewlyCreatedEntities();
+  manager.ProcessEntityRemovals();
+  manager.RunClearRemovedComponents();
+  manager.RunSetAllComponentsUnchanged();
+
+  // Mutate the world: change a component, remove one, add one, and add a
+  // whole entity
+  math::Pose3d newPose{9, 9, 9, 0, 0, 0};
+  auto *poseComp = manager.Component<Pose>(entity1);
+  ASSERT_NE(nullptr, poseComp);
+  *poseComp = Pose{newPose};
+  manager.SetChanged(entity1, Pose::typeId, ComponentState::OneTimeChange);
+
+  manager.RemoveComponent<IntComponent>(entity2);
+  manager.CreateComponent(entity2, DoubleComponent{1.25});
+
+  Entity entity3 = manager.CreateEntity();
+  manager.CreateComponent(entity3, Name{"entity3"});
+
+  manager.RunClearNewlyCreatedEntities();
+  manager.ProcessEntityRemovals();
+  manager.RunClearRemovedComponents();
+  manager.RunSetAllComponentsUnchanged();
+
+  // Reset and verify the snapshot state is restored
+  manager.ResetTo(managerCopy);
+
+  ASSERT_NE(nullptr, manager.Component<Pose>(entity1));
+  EXPECT_EQ(testPose, manager.Component<Pose>(entity1)->Data());
+
+  ASSERT_NE(nullptr, manager.Component<IntComponent>(entity2));
+  EXPECT_EQ(42, manager.Component<IntComponent>(entity2)->Data());
+  EXPECT_EQ(nullptr, manager.Component<DoubleComponent>(entity2));
+
+  // The entity added during the episode is marked for removal
+  {
+    std::vector<Entity> removedEntities;
+    manager.EachRemoved<Name>(
+        [&](const Entity &_entity, const Name *)
+        {
+          removedEntities.push_back(_entity);
+          return true;
+        });
+    ASSERT_EQ(1u, removedEntities.size());
+    EXPECT_EQ(entity3, removedEntities.front());
+  }
+
+  // Tracking stays on and the journal restarts, so a second episode can be
+  // reset too
+  EXPECT_TRUE(manager.ComponentMutationTracking());
+  manager.ProcessEntityRemovals();
+
+  auto *poseComp2 = manager.Component<Pose>(entity1);
+  ASSERT_NE(nullptr, poseComp2);
+  *poseComp2 = Pose{newPose};
+  manager.SetChanged(entity1, Pose::typeId, ComponentState::OneTimeChange);
+
+  manager.ResetTo(managerCopy);
+  ASSERT_NE(nullptr, manager.Component<Pose>(entity1));
+  EXPECT_EQ(testPose, manager.Component<Pose>(entity1)->Data());
+}
+
 //////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
     GZ_UTILS_TEST_DISABLED_ON_WIN32(AddRemoveAddComponentsStateMap))
@@ -3438,6 +3978,216 @@ TEST_P(EntityComponentManagerFixture, EntityByName)
     *entityByName, true);
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, EntitiesByScopedName)
+{
+  // world
+  // - model
+  //   - link
+  // - model2
+  //   - link
+  Entity world = manager.CreateEntity();
+  manager.CreateComponent(world, components::Name("world"));
+
+  Entity modelA = manager.CreateEntity();
+  manager.CreateComponent(modelA, components::Name("model"));
+  manager.CreateComponent(modelA, components::ParentEntity(world));
+
+  Entity linkA = manager.CreateEntity();
+  manager.CreateComponent(linkA, components::Name("link"));
+  manager.CreateComponent(linkA, components::ParentEntity(modelA));
+
+  Entity modelB = manager.CreateEntity();
+  manager.CreateComponent(modelB, components::Name("model2"));
+  manager.CreateComponent(modelB, components::ParentEntity(world));
+
+  Entity linkB = manager.CreateEntity();
+  manager.CreateComponent(linkB, components::Name("link"));
+  manager.CreateComponent(linkB, components::ParentEntity(modelB));
+
+  // A name at any depth matches all entities with that name
+  auto links = manager.EntitiesByScopedName("link");
+  EXPECT_EQ(2u, links.size());
+  EXPECT_NE(links.end(), links.find(linkA));
+  EXPECT_NE(links.end(), links.find(linkB));
+
+  // Scoping disambiguates
+  auto scoped = manager.EntitiesByScopedName("model::link");
+  EXPECT_EQ(1u, scoped.size());
+  EXPECT_NE(scoped.end(), scoped.find(linkA));
+
+  scoped = manager.EntitiesByScopedName("world::model2::link");
+  EXPECT_EQ(1u, scoped.size());
+  EXPECT_NE(scoped.end(), scoped.find(linkB));
+
+  // Custom delimiter
+  scoped = manager.EntitiesByScopedName("model2/link", "/");
+  EXPECT_EQ(1u, scoped.size());
+  EXPECT_NE(scoped.end(), scoped.find(linkB));
+
+  // Relative queries don't include the relative entity's name
+  scoped = manager.EntitiesByScopedName("link", "::", modelA);
+  EXPECT_EQ(1u, scoped.size());
+  EXPECT_NE(scoped.end(), scoped.find(linkA));
+
+  scoped = manager.EntitiesByScopedName("model::link", "::", world);
+  EXPECT_EQ(1u, scoped.size());
+  EXPECT_NE(scoped.end(), scoped.find(linkA));
+
+  // No matches
+  EXPECT_TRUE(manager.EntitiesByScopedName("no_such_name").empty());
+  EXPECT_TRUE(manager.EntitiesByScopedName("model2::link", "::",
+      modelA).empty());
+  EXPECT_TRUE(manager.EntitiesByScopedName("link", "").empty());
+
+  // Structural changes invalidate the index and bump the epoch
+  const uint64_t epoch = manager.EntityStructureEpoch();
+  Entity linkC = manager.CreateEntity();
+  manager.CreateComponent(linkC, components::Name("link"));
+  manager.CreateComponent(linkC, components::ParentEntity(modelA));
+  EXPECT_NE(epoch, manager.EntityStructureEpoch());
+
+  links = manager.EntitiesByScopedName("model::link");
+  EXPECT_EQ(2u, links.size());
+  EXPECT_NE(links.end(), links.find(linkA));
+  EXPECT_NE(links.end(), links.find(linkC));
+
+  // Removal is reflected after removal requests are processed
+  manager.RequestRemoveEntity(modelB, true);
+  manager.ProcessEntityRemovals();
+  links = manager.EntitiesByScopedName("link");
+  EXPECT_EQ(2u, links.size());
+  EXPECT_EQ(links.end(), links.find(linkB));
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, NameSymbols)
+{
+  // Symbol 0 is the empty name
+  EXPECT_EQ(0u, manager.NameSymbol(""));
+  EXPECT_EQ("", manager.SymbolString(0u));
+
+  // The same string always maps to the same symbol
+  auto boxSymbol = manager.NameSymbol("box");
+  EXPECT_NE(0u, boxSymbol);
+  EXPECT_EQ(boxSymbol, manager.NameSymbol("box"));
+  EXPECT_EQ("box", manager.SymbolString(boxSymbol));
+
+  // Distinct strings get distinct symbols
+  auto sphereSymbol = manager.NameSymbol("sphere");
+  EXPECT_NE(boxSymbol, sphereSymbol);
+
+  // A symbol that was never handed out maps to the empty string
+  EXPECT_EQ("", manager.SymbolString(12345u));
+
+  // Entity name symbols follow the Name component
+  Entity box = manager.CreateEntity();
+  EXPECT_EQ(0u, manager.EntityNameSymbol(box));
+  manager.CreateComponent(box, components::Name("box"));
+  EXPECT_EQ(boxSymbol, manager.EntityNameSymbol(box));
+
+  Entity sphere = manager.CreateEntity();
+  manager.CreateComponent(sphere, components::Name("sphere"));
+  EXPECT_EQ(sphereSymbol, manager.EntityNameSymbol(sphere));
+  EXPECT_NE(manager.EntityNameSymbol(box), manager.EntityNameSymbol(sphere));
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, MemoryStatistics)
+{
+  auto stats = manager.MemoryStatistics();
+  EXPECT_EQ(0u, stats.entityCount);
+  EXPECT_EQ(0u, stats.componentCount);
+  EXPECT_EQ(0u, stats.componentSizeBytes);
+  EXPECT_TRUE(stats.componentTypes.empty());
+
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  manager.CreateComponent(e2, IntComponent(2));
+  manager.CreateComponent(e1, StringComponent(
+      "a string long enough to require heap storage in any implementation"));
+
+  stats = manager.MemoryStatistics();
+  EXPECT_EQ(2u, stats.entityCount);
+  EXPECT_EQ(3u, stats.componentCount);
+
+  const auto &intStats = stats.componentTypes[IntComponent::typeId];
+  EXPECT_EQ("gz_sim_components.IntComponent", intStats.name);
+  EXPECT_EQ(2u, intStats.count);
+  EXPECT_EQ(0u, intStats.markedRemovedCount);
+  EXPECT_GE(intStats.sizeBytes, 2 * sizeof(IntComponent));
+
+  // String components report their heap payload
+  const auto &stringStats = stats.componentTypes[StringComponent::typeId];
+  EXPECT_EQ(1u, stringStats.count);
+  EXPECT_GT(stringStats.sizeBytes, sizeof(StringComponent));
+
+  EXPECT_GE(stats.componentSizeBytes,
+      intStats.sizeBytes + stringStats.sizeBytes);
+
+  // Views created by Each are counted
+  EXPECT_EQ(0u, stats.viewCount);
+  int count{0};
+  manager.Each<IntComponent>(
+      [&](const Entity &, const IntComponent *) -> bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  stats = manager.MemoryStatistics();
+  EXPECT_EQ(1u, stats.viewCount);
+  EXPECT_EQ(2u, stats.viewEntityCount);
+
+  // Removed components remain in storage, marked as removed
+  manager.RemoveComponent<IntComponent>(e2);
+  stats = manager.MemoryStatistics();
+  EXPECT_EQ(2u, stats.componentCount);
+  EXPECT_EQ(1u, stats.componentTypes[IntComponent::typeId].count);
+  EXPECT_EQ(1u,
+      stats.componentTypes[IntComponent::typeId].markedRemovedCount);
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, ChangeRateCounters)
+{
+  // Nothing is counted while tracking is disabled
+  EXPECT_FALSE(manager.ChangeRateTracking());
+  Entity e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  EXPECT_TRUE(manager.ChangeRateCounters().empty());
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      manager.ChangeRateWindow());
+
+  manager.SetChangeRateTracking(true);
+  EXPECT_TRUE(manager.ChangeRateTracking());
+
+  // Creation, change marks and removal all count against the type
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent(e2, IntComponent(2));
+  manager.SetChanged(e1, IntComponent::typeId, ComponentState::OneTimeChange);
+  manager.SetChanged(IntComponent::typeId, {e1, e2},
+      ComponentState::PeriodicChange);
+  manager.RemoveComponent<IntComponent>(e2);
+
+  auto counters = manager.ChangeRateCounters();
+  EXPECT_EQ(5u, counters[IntComponent::typeId]);
+  EXPECT_EQ(counters.end(), counters.find(DoubleComponent::typeId));
+  EXPECT_LT(std::chrono::steady_clock::duration::zero(),
+      manager.ChangeRateWindow());
+
+  // Re-enabling restarts the counters
+  manager.SetChangeRateTracking(true);
+  EXPECT_TRUE(manager.ChangeRateCounters().empty());
+
+  // Disabling stops counting
+  manager.SetChangeRateTracking(false);
+  manager.SetChanged(e1, IntComponent::typeId, ComponentState::OneTimeChange);
+  EXPECT_TRUE(manager.ChangeRateCounters().empty());
+}
+
 // Run multiple times. We want to make sure that static globals don't cause
 // problems.
 INSTANTIATE_TEST_SUITE_P(EntityComponentManagerRepeat,
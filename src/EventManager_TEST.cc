@@ -127,3 +127,27 @@ TEST(EventManager, Disambiguate)
   eventManager.Emit<TestEvent2>();
   EXPECT_EQ(1, calls);
 }
+
+/// Test that a resolved channel stays in sync with the dynamic interface.
+TEST(EventManager, Channel)
+{
+  EventManager eventManager;
+  using TestEvent = gz::common::EventT<void(int), struct ChannelTestTag>;
+
+  TestEvent &channel = eventManager.Channel<TestEvent>();
+
+  // The channel is the same object the dynamic interface uses.
+  EXPECT_EQ(&channel, &eventManager.Channel<TestEvent>());
+
+  int value = 0;
+  auto connection = eventManager.Connect<TestEvent>(
+      [&value](int _value) { value = _value; });
+  EXPECT_EQ(1u, channel.ConnectionCount());
+
+  // Signaling the channel directly fires callbacks connected through the
+  // EventManager, and vice versa.
+  channel.Signal(42);
+  EXPECT_EQ(42, value);
+  eventManager.Emit<TestEvent>(7);
+  EXPECT_EQ(7, value);
+}
@@ -18,6 +18,7 @@
 #include "LevelManager.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 #include <sdf/Actor.hh>
@@ -263,6 +264,17 @@ void LevelManager::ReadLevels(const sdf::Plugin &_plugin)
   if (sdf == nullptr)
     return;
 
+  this->entityLoadBudget = sdf->Get<unsigned int>("entity_load_budget",
+      this->entityLoadBudget).first;
+  this->preloadDistance = sdf->Get<double>("preload_distance",
+      this->preloadDistance).first;
+  if (this->preloadDistance < 0)
+  {
+    gzwarn << "The preload_distance parameter cannot be a negative number. "
+            << "Setting to 0.0\n";
+    this->preloadDistance = 0.0;
+  }
+
   if (!sdf->HasElement("level"))
     return;
 
@@ -448,6 +460,12 @@ void LevelManager::UpdateLevelsState()
   std::vector<Entity> levelsToLoad;
   std::vector<Entity> levelsToUnload;
 
+  // Levels within the predictive radius of a performer this update
+  std::set<Entity> predictedLevels;
+  // When a performer was skipped its surroundings were not re-examined, so
+  // preloaded levels cannot safely be dropped this update
+  bool anyPerformerSkipped{false};
+
   {
     std::lock_guard<std::mutex> lock(this->performerToAddMutex);
     auto iter = this->performersToAdd.begin();
@@ -480,6 +498,14 @@ void LevelManager::UpdateLevelsState()
   // If levels are not being used, we only process the default level.
   if (this->useLevels)
   {
+    if (!this->levelIndexBuilt)
+      this->BuildLevelIndex();
+
+    bool hasPerformers{false};
+    // Levels held by at least one performer this update
+    std::set<Entity> keptLevels;
+    std::vector<std::size_t> candidates;
+
     this->runner->entityCompMgr.Each<
       components::Performer,
       components::PerformerLevels,
@@ -492,10 +518,26 @@ void LevelManager::UpdateLevelsState()
             components::ParentEntity *_parent) -> bool
           {
           GZ_PROFILE("EachPerformer");
+          hasPerformers = true;
 
           auto pose = this->runner->entityCompMgr.Component<components::Pose>(
               _parent->Data());
 
+          // Performers that have not moved keep the levels computed on the
+          // previous update. The cache is cleared whenever the set of active
+          // levels changes, so the reused sets are always consistent.
+          auto lastPoseIt = this->lastPerformerPoses.find(_perfEntity);
+          if (lastPoseIt != this->lastPerformerPoses.end() &&
+              lastPoseIt->second == pose->Data())
+          {
+            const auto &perfLevels = _perfLevels->Data();
+            keptLevels.insert(perfLevels.begin(), perfLevels.end());
+            levelsToLoad.insert(levelsToLoad.end(), perfLevels.begin(),
+                perfLevels.end());
+            anyPerformerSkipped = true;
+            return true;
+          }
+
           // We assume the geometry contains a box.
           auto perfBox = _geometry->Data().BoxShape();
           if (nullptr == perfBox)
@@ -505,70 +547,62 @@ void LevelManager::UpdateLevelsState()
           return true;
           }
 
+          this->lastPerformerPoses[_perfEntity] = pose->Data();
+
           math::AxisAlignedBox performerVolume{
             pose->Data().Pos() - perfBox->Size() / 2,
               pose->Data().Pos() + perfBox->Size() / 2};
 
           std::set<Entity> newPerfLevels;
 
-          // loop through levels and check for intersections
-          // Add all levels with intersections to the levelsToLoad even if they
-          // are currently active.
-          this->runner->entityCompMgr.Each<components::Level, components::Pose,
-            components::Geometry,
-            components::LevelBuffer >(
-                [&](const Entity &_entity, const components::Level *,
-                  const components::Pose *_pose,
-                  const components::Geometry *_levelGeometry,
-                  const components::LevelBuffer *_levelBuffer) -> bool
-                {
-                GZ_PROFILE("CheckPerformerAgainstLevel");
-                // Check if the performer is in this level
-                // assume a box for now
-                auto box = _levelGeometry->Data().BoxShape();
-                if (nullptr == box)
-                {
-                gzerr << "Level [" << _entity
-                << "]'s geometry is not a box." << std::endl;
-                return true;
-                }
-                auto buffer = _levelBuffer->Data();
-                auto center = _pose->Data().Pos();
-                math::AxisAlignedBox region{center - box->Size() / 2,
-                center + box->Size() / 2};
-
-                math::AxisAlignedBox outerRegion{
-                  center - (box->Size() / 2 + buffer),
-                         center + (box->Size() / 2 + buffer)};
-
-                if (region.Intersects(performerVolume))
-                {
-                  newPerfLevels.insert(_entity);
-                  levelsToLoad.push_back(_entity);
-                }
-                else
-                {
-                  // If the level is active, check if the performer is
-                  // outside of the buffer of this level
-                  if (this->IsLevelActive(_entity))
-                  {
-                    if (outerRegion.Intersects(performerVolume))
-                    {
-                      newPerfLevels.insert(_entity);
-                      levelsToLoad.push_back(_entity);
-                      return true;
-                    }
-                    // Otherwise, mark the level to be unloaded
-                    levelsToUnload.push_back(_entity);
-                  }
-                }
-                return true;
-                });
+          // Check the performer against the levels indexed near it.
+          // Add all levels with intersections to the levelsToLoad even if
+          // they are currently active.
+          this->LevelCandidates(performerVolume, candidates);
+          for (const auto index : candidates)
+          {
+            GZ_PROFILE("CheckPerformerAgainstLevel");
+            const auto &entry = this->levelIndexEntries[index];
+            if (entry.region.Intersects(performerVolume))
+            {
+              newPerfLevels.insert(entry.level);
+              levelsToLoad.push_back(entry.level);
+            }
+            else if (this->IsLevelActive(entry.level) &&
+                entry.outerRegion.Intersects(performerVolume))
+            {
+              // The performer is still within the buffer of this active
+              // level, so keep it loaded
+              newPerfLevels.insert(entry.level);
+              levelsToLoad.push_back(entry.level);
+            }
+            else if (this->preloadDistance > 0.0 &&
+                entry.preloadRegion.Intersects(performerVolume))
+            {
+              // The performer is approaching; start loading the level's
+              // entities ahead of activation
+              predictedLevels.insert(entry.level);
+            }
+          }
 
+          keptLevels.insert(newPerfLevels.begin(), newPerfLevels.end());
           *_perfLevels = components::PerformerLevels(newPerfLevels);
 
           return true;
           });
+
+    // Active levels no performer holds any more are marked to be unloaded
+    if (hasPerformers)
+    {
+      for (const auto &entry : this->levelIndexEntries)
+      {
+        if (this->IsLevelActive(entry.level) &&
+            keptLevels.find(entry.level) == keptLevels.end())
+        {
+          levelsToUnload.push_back(entry.level);
+        }
+      }
+    }
   }
 
   // Sort levelsToLoad and levelsToUnload so as to run std::unique on them.
@@ -609,6 +643,64 @@ void LevelManager::UpdateLevelsState()
     }
   }
 
+  // Queue the entities of levels a performer is approaching, and drop
+  // preloads for levels that fell out of the predictive radius without
+  // ever activating
+  if (this->preloadDistance > 0.0)
+  {
+    for (const auto &level : predictedLevels)
+    {
+      if (this->IsLevelActive(level) ||
+          !this->preloadedLevels.insert(level).second)
+      {
+        continue;
+      }
+      const auto &entityNames = this->runner->entityCompMgr
+        .Component<components::LevelEntityNames>(level)->Data();
+      this->EnqueueLoadNames(entityNames, false);
+    }
+
+    for (auto it = this->preloadedLevels.begin();
+         it != this->preloadedLevels.end();)
+    {
+      if (this->IsLevelActive(*it))
+      {
+        // The level activated; its entities are tracked as active now
+        it = this->preloadedLevels.erase(it);
+      }
+      else if (!anyPerformerSkipped &&
+          predictedLevels.find(*it) == predictedLevels.end())
+      {
+        const auto &entityNames = this->runner->entityCompMgr
+          .Component<components::LevelEntityNames>(*it)->Data();
+        std::set<std::string> namesToDrop;
+        for (const auto &name : entityNames)
+        {
+          if (entityNamesMarked.find(name) == entityNamesMarked.end())
+            namesToDrop.insert(name);
+        }
+        this->CancelPendingLoad(namesToDrop);
+
+        std::set<std::string> loadedToDrop;
+        for (const auto &name : namesToDrop)
+        {
+          if (this->activeEntityNames.find(name) !=
+              this->activeEntityNames.end())
+          {
+            loadedToDrop.insert(name);
+          }
+        }
+        if (!loadedToDrop.empty())
+          this->UnloadInactiveEntities(loadedToDrop);
+        it = this->preloadedLevels.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
   // First filter levelsToUnload so it doesn't contain any levels that are
   // already in levelsToLoad
   auto pendingRemove = std::remove_if(
@@ -626,11 +718,24 @@ void LevelManager::UpdateLevelsState()
     this->UnloadLevel(toUnload, entityNamesMarked);
   }
 
-  // Load the entities
-  if (entityNamesToLoad.size() > 0)
-    this->LoadActiveEntities(entityNamesToLoad);
+  // Load the entities. Entities of newly active levels go to the front of
+  // the queue, ahead of predictive preloads. Without a budget the whole
+  // queue is drained, creating everything this step.
+  this->EnqueueLoadNames(entityNamesToLoad, true);
+  std::set<std::string> loadBatch;
+  while (!this->pendingLoadNames.empty() &&
+      (this->entityLoadBudget == 0u ||
+       loadBatch.size() < this->entityLoadBudget))
+  {
+    loadBatch.insert(this->pendingLoadNames.front());
+    this->pendingLoadNameSet.erase(this->pendingLoadNames.front());
+    this->pendingLoadNames.pop_front();
+  }
+  if (!loadBatch.empty())
+    this->LoadActiveEntities(loadBatch);
 
   // Finally, update the list of active levels
+  bool activeLevelsChanged = !levelsToUnload.empty();
   for (const auto &level : levelsToLoad)
   {
     if (!this->IsLevelActive(level))
@@ -640,8 +745,170 @@ void LevelManager::UpdateLevelsState()
 
       gzmsg << "Loaded level [" << lvlName->Data() << "]" << std::endl;
       this->activeLevels.insert(level);
+      activeLevelsChanged = true;
     }
   }
+
+  // Cached performer levels depend on which levels are active, so re-test
+  // every performer on the next update
+  if (activeLevelsChanged)
+    this->lastPerformerPoses.clear();
+}
+
+/////////////////////////////////////////////////
+/// \brief Pack integer cell coordinates into a single grid key.
+/// Collisions from the truncation to 21 bits per axis are harmless; they
+/// only add candidates that the exact intersection test rejects.
+static std::int64_t cellKey(std::int64_t _x, std::int64_t _y, std::int64_t _z)
+{
+  return ((_x & 0x1FFFFF) << 42) | ((_y & 0x1FFFFF) << 21) | (_z & 0x1FFFFF);
+}
+
+/////////////////////////////////////////////////
+void LevelManager::BuildLevelIndex()
+{
+  GZ_PROFILE("LevelManager::BuildLevelIndex");
+
+  this->levelIndexEntries.clear();
+  this->levelGrid.clear();
+
+  double maxDimension{0.0};
+  this->runner->entityCompMgr.Each<components::Level, components::Pose,
+    components::Geometry, components::LevelBuffer>(
+        [&](const Entity &_entity, const components::Level *,
+          const components::Pose *_pose,
+          const components::Geometry *_levelGeometry,
+          const components::LevelBuffer *_levelBuffer) -> bool
+        {
+          // assume a box for now
+          auto box = _levelGeometry->Data().BoxShape();
+          if (nullptr == box)
+          {
+            gzerr << "Level [" << _entity
+                  << "]'s geometry is not a box." << std::endl;
+            return true;
+          }
+          auto buffer = _levelBuffer->Data();
+          auto center = _pose->Data().Pos();
+          LevelIndexEntry entry;
+          entry.level = _entity;
+          entry.region = math::AxisAlignedBox{center - box->Size() / 2,
+              center + box->Size() / 2};
+          entry.outerRegion = math::AxisAlignedBox{
+              center - (box->Size() / 2 + buffer),
+              center + (box->Size() / 2 + buffer)};
+          entry.preloadRegion = math::AxisAlignedBox{
+              entry.outerRegion.Min() -
+              math::Vector3d::One * this->preloadDistance,
+              entry.outerRegion.Max() +
+              math::Vector3d::One * this->preloadDistance};
+
+          auto outerSize = entry.preloadRegion.Size();
+          maxDimension = std::max({maxDimension, outerSize.X(), outerSize.Y(),
+              outerSize.Z()});
+          this->levelIndexEntries.push_back(entry);
+          return true;
+        });
+
+  // Cells the size of the largest level keep each outer region within a
+  // handful of cells while a performer query touches few cells
+  this->levelGridCellSize = std::max(1.0, maxDimension);
+
+  for (std::size_t index = 0; index < this->levelIndexEntries.size(); ++index)
+  {
+    const auto &outer = this->levelIndexEntries[index].preloadRegion;
+    const auto minCell = outer.Min() / this->levelGridCellSize;
+    const auto maxCell = outer.Max() / this->levelGridCellSize;
+    for (auto x = static_cast<std::int64_t>(std::floor(minCell.X()));
+         x <= static_cast<std::int64_t>(std::floor(maxCell.X())); ++x)
+    {
+      for (auto y = static_cast<std::int64_t>(std::floor(minCell.Y()));
+           y <= static_cast<std::int64_t>(std::floor(maxCell.Y())); ++y)
+      {
+        for (auto z = static_cast<std::int64_t>(std::floor(minCell.Z()));
+             z <= static_cast<std::int64_t>(std::floor(maxCell.Z())); ++z)
+        {
+          this->levelGrid[cellKey(x, y, z)].push_back(index);
+        }
+      }
+    }
+  }
+
+  this->levelIndexBuilt = true;
+}
+
+/////////////////////////////////////////////////
+void LevelManager::LevelCandidates(const math::AxisAlignedBox &_volume,
+    std::vector<std::size_t> &_candidates) const
+{
+  _candidates.clear();
+
+  const auto minCell = _volume.Min() / this->levelGridCellSize;
+  const auto maxCell = _volume.Max() / this->levelGridCellSize;
+  for (auto x = static_cast<std::int64_t>(std::floor(minCell.X()));
+       x <= static_cast<std::int64_t>(std::floor(maxCell.X())); ++x)
+  {
+    for (auto y = static_cast<std::int64_t>(std::floor(minCell.Y()));
+         y <= static_cast<std::int64_t>(std::floor(maxCell.Y())); ++y)
+    {
+      for (auto z = static_cast<std::int64_t>(std::floor(minCell.Z()));
+           z <= static_cast<std::int64_t>(std::floor(maxCell.Z())); ++z)
+      {
+        auto it = this->levelGrid.find(cellKey(x, y, z));
+        if (it != this->levelGrid.end())
+        {
+          _candidates.insert(_candidates.end(), it->second.begin(),
+              it->second.end());
+        }
+      }
+    }
+  }
+
+  // A level spanning several queried cells appears once per cell
+  std::sort(_candidates.begin(), _candidates.end());
+  _candidates.erase(std::unique(_candidates.begin(), _candidates.end()),
+      _candidates.end());
+}
+
+/////////////////////////////////////////////////
+void LevelManager::EnqueueLoadNames(const std::set<std::string> &_names,
+    bool _urgent)
+{
+  if (_urgent)
+  {
+    // Reverse iteration keeps the set's order once pushed to the front
+    for (auto it = _names.rbegin(); it != _names.rend(); ++it)
+    {
+      if (this->activeEntityNames.find(*it) != this->activeEntityNames.end())
+        continue;
+      if (!this->pendingLoadNameSet.insert(*it).second)
+      {
+        // Already queued, e.g. by a preload; move it to the front
+        this->pendingLoadNames.remove(*it);
+      }
+      this->pendingLoadNames.push_front(*it);
+    }
+  }
+  else
+  {
+    for (const auto &name : _names)
+    {
+      if (this->activeEntityNames.find(name) != this->activeEntityNames.end())
+        continue;
+      if (this->pendingLoadNameSet.insert(name).second)
+        this->pendingLoadNames.push_back(name);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void LevelManager::CancelPendingLoad(const std::set<std::string> &_names)
+{
+  for (const auto &name : _names)
+  {
+    if (this->pendingLoadNameSet.erase(name) > 0)
+      this->pendingLoadNames.remove(name);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -839,11 +1106,13 @@ void LevelManager::UnloadLevel(const Entity &_entity,
     }
   }
 
+  this->CancelPendingLoad(entityNamesToUnload);
   if (entityNamesToUnload.size() > 0)
   {
     this->UnloadInactiveEntities(entityNamesToUnload);
   }
   this->activeLevels.erase(_entity);
+  this->preloadedLevels.erase(_entity);
   const components::Name *lvlName =
     this->runner->entityCompMgr.Component<components::Name>(_entity);
 
@@ -21,6 +21,7 @@
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <set>
@@ -31,6 +32,8 @@
 
 #include <sdf/Element.hh>
 #include <sdf/Geometry.hh>
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Pose3d.hh>
 #include <gz/transport/Node.hh>
 
 #include "gz/sim/config.hh"
@@ -145,9 +148,93 @@ namespace gz
       private: void UnloadLevel(const Entity &_entity,
                    const std::set<std::string> &_entityNamesMarked = {});
 
+      /// \brief Build the uniform grid index over level volumes. Levels are
+      /// only created while the world is read, so the index is built once,
+      /// lazily, on the first levels update.
+      private: void BuildLevelIndex();
+
+      /// \brief Get the indices into levelIndexEntries of all levels whose
+      /// grid cells overlap the given volume. Candidates still need an exact
+      /// intersection test; the grid only prunes far-away levels.
+      /// \param[in] _volume Query volume, e.g. a performer's bounding box
+      /// \param[out] _candidates Unique level entry indices. Cleared first.
+      private: void LevelCandidates(const math::AxisAlignedBox &_volume,
+                   std::vector<std::size_t> &_candidates) const;
+
+      /// \brief Queue entity names to be created once the per-step load
+      /// budget allows it. Names that are already active or already queued
+      /// are skipped.
+      /// \param[in] _names Entity names to queue
+      /// \param[in] _urgent True places the names at the front of the
+      /// queue, ahead of predictive preloads.
+      private: void EnqueueLoadNames(const std::set<std::string> &_names,
+                   bool _urgent);
+
+      /// \brief Remove entity names from the pending load queue.
+      /// \param[in] _names Entity names to remove
+      private: void CancelPendingLoad(const std::set<std::string> &_names);
+
+      /// \brief An entry in the level spatial index
+      private: struct LevelIndexEntry
+      {
+        /// \brief Level entity
+        Entity level;
+
+        /// \brief The level's volume
+        math::AxisAlignedBox region;
+
+        /// \brief The level's volume grown by its buffer
+        math::AxisAlignedBox outerRegion;
+
+        /// \brief The outer region grown by the preload distance
+        math::AxisAlignedBox preloadRegion;
+      };
+
       /// \brief List of currently active levels
       private: std::set<Entity> activeLevels;
 
+      /// \brief All levels with a volume, in index order
+      private: std::vector<LevelIndexEntry> levelIndexEntries;
+
+      /// \brief Uniform grid over the levels' outer regions. Maps a packed
+      /// cell coordinate to the indices of the levels overlapping that cell.
+      private: std::unordered_map<std::int64_t,
+                   std::vector<std::size_t>> levelGrid;
+
+      /// \brief Edge length of a grid cell, derived from the largest level
+      private: double levelGridCellSize{100.0};
+
+      /// \brief Whether the level index has been built
+      private: bool levelIndexBuilt{false};
+
+      /// \brief Pose of each performer's parent model when its levels were
+      /// last computed. Performers that have not moved while the set of
+      /// active levels is unchanged keep their levels without re-testing.
+      private: std::unordered_map<Entity, math::Pose3d> lastPerformerPoses;
+
+      /// \brief Upper bound on the number of level entities (models,
+      /// actors, lights) created in the ECM per update. Zero, the default,
+      /// creates everything in the step the load is requested. Set with the
+      /// <entity_load_budget> element of the gz::sim plugin.
+      private: unsigned int entityLoadBudget{0u};
+
+      /// \brief Extra distance, in meters, around a level's buffered
+      /// volume within which its entities start loading before the level
+      /// activates. Zero, the default, disables predictive loading. Set
+      /// with the <preload_distance> element of the gz::sim plugin.
+      private: double preloadDistance{0.0};
+
+      /// \brief Entity names waiting for a slot in the load budget, in
+      /// load order
+      private: std::list<std::string> pendingLoadNames;
+
+      /// \brief Names in pendingLoadNames, for fast membership checks
+      private: std::set<std::string> pendingLoadNameSet;
+
+      /// \brief Levels whose entities were queued by the predictive
+      /// radius but that have not activated yet
+      private: std::set<Entity> preloadedLevels;
+
       /// \brief Names of entities that are currently active (loaded).
       private: std::set<std::string> activeEntityNames;
 
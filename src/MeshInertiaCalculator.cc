@@ -18,8 +18,18 @@
 #include "MeshInertiaCalculator.hh"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
 #include <numeric>
 #include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <sdf/CustomInertiaCalcProperties.hh>
@@ -27,8 +37,12 @@
 
 #include <gz/sim/Util.hh>
 
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/MeshManager.hh>
 #include <gz/common/SubMesh.hh>
+#include <gz/common/URI.hh>
+#include <gz/common/Util.hh>
 
 #include <gz/math/Vector3.hh>
 #include <gz/math/Pose3.hh>
@@ -39,6 +53,160 @@
 using namespace gz;
 using namespace sim;
 
+/// \brief Mutex protecting gMeshInertiaCache
+static std::mutex gMeshInertiaCacheMutex;
+
+/// \brief Process-wide cache of computed mesh inertias, keyed on the mesh
+/// source, its content hash, the optimization applied, the scale and the
+/// density. Repeated instances of the same mesh reuse one integration.
+static std::unordered_map<std::string, math::Inertiald> gMeshInertiaCache;
+
+/// \brief Magic token identifying an on-disk inertia cache file
+static constexpr const char *kInertiaCacheMagic = "gz-sim-mesh-inertia";
+
+/// \brief Version of the on-disk inertia cache format
+static constexpr int kInertiaCacheVersion = 1;
+
+/// \brief One entry of the on-disk inertia cache stored next to a mesh file.
+/// A file holds one entry per (scale, optimization, density) combination the
+/// mesh has been loaded with.
+struct InertiaCacheEntry
+{
+  /// \brief Content hash of the mesh file the inertia was computed from
+  uint64_t contentHash{0u};
+
+  /// \brief sdf::MeshOptimization the inertia was computed with
+  int optimization{0};
+
+  /// \brief Mesh scale the inertia was computed with
+  math::Vector3d scale{math::Vector3d::One};
+
+  /// \brief Density the inertia was computed with
+  double density{0.0};
+
+  /// \brief The computed inertia
+  math::Inertiald inertial;
+};
+
+//////////////////////////////////////////////////
+/// \brief Compute the FNV-1a hash of a file's contents.
+/// \param[in] _path Path of the file to hash
+/// \return The hash, or nullopt if the file could not be read.
+static std::optional<uint64_t> HashFileContents(const std::string &_path)
+{
+  std::ifstream file(_path, std::ios::binary);
+  if (!file)
+    return std::nullopt;
+
+  uint64_t hash = 14695981039346656037ull;
+  std::array<char, 65536> buffer;
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+  {
+    const std::streamsize count = file.gcount();
+    for (std::streamsize i = 0; i < count; ++i)
+    {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
+//////////////////////////////////////////////////
+/// \brief Resolve where the on-disk inertia cache for a mesh lives. By
+/// default the cache sits next to the mesh file. When the
+/// GZ_SIM_MESH_INERTIA_CACHE_DIR environment variable is set, entries are
+/// stored in that directory under a content-addressed name instead, which
+/// keeps read-only asset volumes cacheable and lets every simulation
+/// instance on a node share one warmed cache.
+/// \param[in] _meshPath Full path of the mesh file
+/// \param[in] _contentHash Content hash of the mesh file
+/// \return Path of the cache file for this mesh.
+static std::string InertiaCachePath(const std::string &_meshPath,
+    uint64_t _contentHash)
+{
+  std::string cacheDir;
+  if (common::env("GZ_SIM_MESH_INERTIA_CACHE_DIR", cacheDir) &&
+      !cacheDir.empty())
+  {
+    if (!common::exists(cacheDir))
+      common::createDirectories(cacheDir);
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << _contentHash
+         << ".inertia";
+    return common::joinPaths(cacheDir, name.str());
+  }
+  return _meshPath + ".inertia";
+}
+
+//////////////////////////////////////////////////
+/// \brief Read all entries of an on-disk inertia cache file.
+/// \param[in] _path Path of the cache file
+/// \return The entries, empty if the file is missing or not understood.
+static std::vector<InertiaCacheEntry> ReadInertiaCacheFile(
+    const std::string &_path)
+{
+  std::ifstream file(_path);
+  if (!file)
+    return {};
+
+  std::string magic;
+  int version{0};
+  file >> magic >> version;
+  if (magic != kInertiaCacheMagic || version != kInertiaCacheVersion)
+    return {};
+
+  std::vector<InertiaCacheEntry> entries;
+  InertiaCacheEntry entry;
+  double mass{0.0}, px{0.0}, py{0.0}, pz{0.0};
+  double qw{1.0}, qx{0.0}, qy{0.0}, qz{0.0};
+  math::Vector3d diagonal, offDiagonal;
+  while (file >> entry.contentHash >> entry.optimization >> entry.scale
+      >> entry.density >> mass >> px >> py >> pz >> qw >> qx >> qy >> qz
+      >> diagonal >> offDiagonal)
+  {
+    entry.inertial = math::Inertiald(
+        math::MassMatrix3d(mass, diagonal, offDiagonal),
+        math::Pose3d(px, py, pz, math::Quaterniond(qw, qx, qy, qz)));
+    entries.push_back(entry);
+  }
+  return entries;
+}
+
+//////////////////////////////////////////////////
+/// \brief Write an on-disk inertia cache file. Failures are silent: mesh
+/// directories may be read-only and the cache is only an optimization.
+/// \param[in] _path Path of the cache file
+/// \param[in] _entries Entries to write
+static void WriteInertiaCacheFile(const std::string &_path,
+    const std::vector<InertiaCacheEntry> &_entries)
+{
+  std::ofstream file(_path, std::ios::trunc);
+  if (!file)
+  {
+    gzdbg << "Unable to write mesh inertia cache [" << _path << "]"
+          << std::endl;
+    return;
+  }
+
+  file << kInertiaCacheMagic << " " << kInertiaCacheVersion << "\n"
+       << std::setprecision(17);
+  for (const auto &entry : _entries)
+  {
+    const auto &pose = entry.inertial.Pose();
+    const auto &massMatrix = entry.inertial.MassMatrix();
+    file << entry.contentHash << " " << entry.optimization << " "
+         << entry.scale << " " << entry.density << " "
+         << massMatrix.Mass() << " "
+         << pose.Pos().X() << " " << pose.Pos().Y() << " "
+         << pose.Pos().Z() << " "
+         << pose.Rot().W() << " " << pose.Rot().X() << " "
+         << pose.Rot().Y() << " " << pose.Rot().Z() << " "
+         << massMatrix.DiagonalMoments() << " "
+         << massMatrix.OffDiagonalMoments() << "\n";
+  }
+}
+
 //////////////////////////////////////////////////
 bool MeshInertiaCalculator::CorrectMassMatrix(
     math::MassMatrix3d &_massMatrix, double _tol)
@@ -124,6 +292,71 @@ void MeshInertiaCalculator::GetMeshTriangles(
   }
 }
 
+//////////////////////////////////////////////////
+/// \brief Accumulate the ten integral terms of the polyhedral mass
+/// properties algorithm over a range of triangles.
+/// \param[in] _triangles All triangles of the mesh
+/// \param[in] _begin Index of the first triangle of the range
+/// \param[in] _end Index one past the last triangle of the range
+/// \param[out] _integral Accumulated integral terms, zero-initialized by
+/// the caller
+static void IntegrateTriangleRange(const std::vector<Triangle> &_triangles,
+    std::size_t _begin, std::size_t _end, double *_integral)
+{
+  for (std::size_t i = _begin; i < _end; ++i)
+  {
+    // Cross product of 2 vectors emerging from a common vertex.
+    // This basically gives a vector normal to the plane of the triangle
+    const gz::math::Vector3d cross =
+      (_triangles[i].v1 - _triangles[i].v0).Cross(
+        _triangles[i].v2 - _triangles[i].v0);
+
+    // Subexpressions of the integral
+    const gz::math::Vector3d f1 =
+        _triangles[i].v0 + _triangles[i].v1 + _triangles[i].v2;
+    const gz::math::Vector3d f2 =
+        _triangles[i].v0 * _triangles[i].v0 +
+        _triangles[i].v1 * _triangles[i].v1 +
+        _triangles[i].v0 * _triangles[i].v1 +
+        _triangles[i].v2 * f1;
+    const gz::math::Vector3d f3 =
+        _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v0 +
+        _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v1 +
+        _triangles[i].v0 * _triangles[i].v1 * _triangles[i].v1 +
+        _triangles[i].v1 * _triangles[i].v1 * _triangles[i].v1 +
+        _triangles[i].v2 * f2;
+    const gz::math::Vector3d g0 =
+        f2 + (_triangles[i].v0 + f1) * (_triangles[i].v0);
+    const gz::math::Vector3d g1 =
+        f2 + (_triangles[i].v1 + f1) * (_triangles[i].v1);
+    const gz::math::Vector3d g2 =
+        f2 + (_triangles[i].v2 + f1) * (_triangles[i].v2);
+
+    const double x0 = _triangles[i].v0.X();
+    const double y0 = _triangles[i].v0.Y();
+    const double z0 = _triangles[i].v0.Z();
+    const double x1 = _triangles[i].v1.X();
+    const double y1 = _triangles[i].v1.Y();
+    const double z1 = _triangles[i].v1.Z();
+    const double x2 = _triangles[i].v2.X();
+    const double y2 = _triangles[i].v2.Y();
+    const double z2 = _triangles[i].v2.Z();
+    _integral[0] += cross.X() * f1.X();
+    _integral[1] += cross.X() * f2.X();
+    _integral[2] += cross.Y() * f2.Y();
+    _integral[3] += cross.Z() * f2.Z();
+    _integral[4] += cross.X() * f3.X();
+    _integral[5] += cross.Y() * f3.Y();
+    _integral[6] += cross.Z() * f3.Z();
+    _integral[7] += cross.X() *
+      (y0 * g0.X() + y1 * g1.X() + y2 * g2.X());
+    _integral[8] += cross.Y() *
+      (z0 * g0.Y() + z1 * g1.Y() + z2 * g2.Y());
+    _integral[9] += cross.Z() *
+      (x0 * g0.Z() + x1 * g1.Z() + x2 * g2.Z());
+  }
+}
+
 //////////////////////////////////////////////////
 void MeshInertiaCalculator::CalculateMassProperties(
   const std::vector<Triangle>& _triangles,
@@ -139,65 +372,40 @@ void MeshInertiaCalculator::CalculateMassProperties(
   // Number of triangles of in the mesh
   std::size_t numTriangles = _triangles.size();
 
-  // Vector to store cross products of 2 vectors of the triangles
-  std::vector<gz::math::Vector3d> crosses(numTriangles);
-
-  // Caculating cross products of 2 vectors emerging from a common vertex
-  // This basically gives a vector normal to the plane of triangle
-  for (std::size_t i = 0; i < numTriangles; ++i)
-  {
-    crosses[i] =
-      (_triangles[i].v1 - _triangles[i].v0).Cross(
-        _triangles[i].v2 - _triangles[i].v0);
-  }
-
-  // Calculate subexpressions of the integral
-  std::vector<gz::math::Vector3d> f1(numTriangles), f2(numTriangles),
-  f3(numTriangles), g0(numTriangles), g1(numTriangles), g2(numTriangles);
-
-  for (std::size_t i = 0; i < numTriangles; ++i)
+  // Calculate integral terms. Below this triangle count the threads cost
+  // more than they save, so integrate on the calling thread.
+  const std::size_t kParallelThreshold = 20000;
+  std::vector<double> integral(10);
+  std::size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+  if (numTriangles < kParallelThreshold || threadCount <= 1)
   {
-      f1[i] = _triangles[i].v0 + _triangles[i].v1 + _triangles[i].v2;
-      f2[i] = _triangles[i].v0 * _triangles[i].v0 +
-              _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v0 * _triangles[i].v1 +
-              _triangles[i].v2 * f1[i];
-      f3[i] = _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v0 +
-              _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v1 +
-              _triangles[i].v0 * _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v1 * _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v2 * f2[i];
-      g0[i] = f2[i] + (_triangles[i].v0 + f1[i]) * (_triangles[i].v0);
-      g1[i] = f2[i] + (_triangles[i].v1 + f1[i]) * (_triangles[i].v1);
-      g2[i] = f2[i] + (_triangles[i].v2 + f1[i]) * (_triangles[i].v2);
+    IntegrateTriangleRange(_triangles, 0, numTriangles, integral.data());
   }
-
-  // Calculate integral terms
-  std::vector<double> integral(10);
-  for (std::size_t i = 0; i < numTriangles; ++i)
+  else
   {
-      double x0 = _triangles[i].v0.X();
-      double y0 = _triangles[i].v0.Y();
-      double z0 = _triangles[i].v0.Z();
-      double x1 = _triangles[i].v1.X();
-      double y1 = _triangles[i].v1.Y();
-      double z1 = _triangles[i].v1.Z();
-      double x2 = _triangles[i].v2.X();
-      double y2 = _triangles[i].v2.Y();
-      double z2 = _triangles[i].v2.Z();
-      integral[0] += crosses[i].X() * f1[i].X();
-      integral[1] += crosses[i].X() * f2[i].X();
-      integral[2] += crosses[i].Y() * f2[i].Y();
-      integral[3] += crosses[i].Z() * f2[i].Z();
-      integral[4] += crosses[i].X() * f3[i].X();
-      integral[5] += crosses[i].Y() * f3[i].Y();
-      integral[6] += crosses[i].Z() * f3[i].Z();
-      integral[7] += crosses[i].X() *
-        (y0 * g0[i].X() + y1 * g1[i].X() + y2 * g2[i].X());
-      integral[8] += crosses[i].Y() *
-        (z0 * g0[i].Y() + z1 * g1[i].Y() + z2 * g2[i].Y());
-      integral[9] += crosses[i].Z() *
-        (x0 * g0[i].Z() + x1 * g1[i].Z() + x2 * g2[i].Z());
+    // Integrate disjoint ranges concurrently, each into its own partial
+    // accumulator, then reduce. Every term is a plain sum over triangles,
+    // so the partials combine by addition.
+    threadCount = std::min(threadCount, numTriangles / 1000);
+    const std::size_t chunk = (numTriangles + threadCount - 1) / threadCount;
+    std::vector<std::array<double, 10>> partials(threadCount);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (std::size_t t = 0; t < threadCount; ++t)
+    {
+      partials[t].fill(0.0);
+      const std::size_t begin = t * chunk;
+      const std::size_t end = std::min(numTriangles, begin + chunk);
+      threads.emplace_back(IntegrateTriangleRange, std::cref(_triangles),
+          begin, end, partials[t].data());
+    }
+    for (auto &thread : threads)
+      thread.join();
+    for (const auto &partial : partials)
+    {
+      for (int i = 0; i < 10; ++i)
+        integral[i] += partial[i];
+    }
   }
 
   for (int i = 0; i < 10; ++i)
@@ -255,6 +463,56 @@ std::optional<gz::math::Inertiald> MeshInertiaCalculator::operator()
     return std::nullopt;
   }
 
+  // Resolve the mesh file and hash its contents. Meshes registered by
+  // name have no backing file and only use the in-memory cache.
+  std::string meshPath;
+  std::optional<uint64_t> contentHash;
+  if (common::URI(sdfMesh->Uri()).Scheme() != "name")
+  {
+    meshPath = asFullPath(sdfMesh->Uri(), sdfMesh->FilePath());
+    contentHash = HashFileContents(meshPath);
+  }
+  const int optimization = static_cast<int>(sdfMesh->Optimization());
+
+  // The cache key covers everything the computed inertia depends on: the
+  // mesh source and contents, the optimization applied, the scale and the
+  // density.
+  std::ostringstream keyStream;
+  keyStream << std::setprecision(17) << sdfMesh->Uri() << "|" << meshPath
+            << "|" << (contentHash ? *contentHash : 0u) << "|"
+            << optimization << "|" << sdfMesh->Scale() << "|" << density;
+  const std::string cacheKey = keyStream.str();
+
+  {
+    std::lock_guard<std::mutex> lock(gMeshInertiaCacheMutex);
+    auto cacheIt = gMeshInertiaCache.find(cacheKey);
+    if (cacheIt != gMeshInertiaCache.end())
+      return cacheIt->second;
+  }
+
+  // Check the on-disk cache, either next to the mesh file or in the shared
+  // content-addressed cache directory. The content hash keys out stale
+  // entries when the mesh file changes.
+  const std::string cachePath = contentHash ?
+      InertiaCachePath(meshPath, *contentHash) : std::string();
+  std::vector<InertiaCacheEntry> cacheEntries;
+  if (contentHash)
+  {
+    cacheEntries = ReadInertiaCacheFile(cachePath);
+    for (const auto &entry : cacheEntries)
+    {
+      if (entry.contentHash == *contentHash &&
+          entry.optimization == optimization &&
+          entry.scale == sdfMesh->Scale() &&
+          std::abs(entry.density - density) < 1e-12)
+      {
+        std::lock_guard<std::mutex> lock(gMeshInertiaCacheMutex);
+        gMeshInertiaCache[cacheKey] = entry.inertial;
+        return entry.inertial;
+      }
+    }
+  }
+
   const common::Mesh *mesh = loadMesh(*sdfMesh);
 
   // Compute inertia for each submesh then sum up to get the final inertia
@@ -304,5 +562,24 @@ std::optional<gz::math::Inertiald> MeshInertiaCalculator::operator()
     return std::nullopt;
   }
 
+  {
+    std::lock_guard<std::mutex> lock(gMeshInertiaCacheMutex);
+    gMeshInertiaCache[cacheKey] = meshInertial;
+  }
+
+  // Persist the entry. Entries computed from older contents of the mesh
+  // file are dropped; entries for other scales and densities are kept.
+  if (contentHash)
+  {
+    cacheEntries.erase(std::remove_if(cacheEntries.begin(),
+        cacheEntries.end(), [&](const InertiaCacheEntry &_entry)
+        {
+          return _entry.contentHash != *contentHash;
+        }), cacheEntries.end());
+    cacheEntries.push_back({*contentHash, optimization, sdfMesh->Scale(),
+        density, meshInertial});
+    WriteInertiaCacheFile(cachePath, cacheEntries);
+  }
+
   return meshInertial;
 }
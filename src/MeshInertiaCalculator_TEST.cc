@@ -17,13 +17,103 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <gz/math/MassMatrix3.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector3.hh>
 
 #include "MeshInertiaCalculator.hh"
 
 using namespace gz;
 using namespace sim;
 
+/////////////////////////////////////////////////
+/// \brief Tessellate one face of an axis-aligned box into _n x _n quads,
+/// two triangles each, wound so the normals point out of the box.
+/// \param[out] _triangles Vector the triangles are appended to
+/// \param[in] _origin Corner of the face
+/// \param[in] _u First edge vector of the face
+/// \param[in] _v Second edge vector of the face
+/// \param[in] _n Number of subdivisions along each edge
+static void appendBoxFace(std::vector<Triangle> &_triangles,
+    const math::Vector3d &_origin, const math::Vector3d &_u,
+    const math::Vector3d &_v, int _n)
+{
+  for (int i = 0; i < _n; ++i)
+  {
+    for (int j = 0; j < _n; ++j)
+    {
+      const math::Vector3d p00 = _origin +
+          _u * (static_cast<double>(i) / _n) +
+          _v * (static_cast<double>(j) / _n);
+      const math::Vector3d p10 = _origin +
+          _u * (static_cast<double>(i + 1) / _n) +
+          _v * (static_cast<double>(j) / _n);
+      const math::Vector3d p01 = _origin +
+          _u * (static_cast<double>(i) / _n) +
+          _v * (static_cast<double>(j + 1) / _n);
+      const math::Vector3d p11 = _origin +
+          _u * (static_cast<double>(i + 1) / _n) +
+          _v * (static_cast<double>(j + 1) / _n);
+
+      Triangle tri;
+      tri.v0 = p00;
+      tri.v1 = p10;
+      tri.v2 = p11;
+      tri.centroid = (tri.v0 + tri.v1 + tri.v2) / 3;
+      _triangles.push_back(tri);
+
+      tri.v0 = p00;
+      tri.v1 = p11;
+      tri.v2 = p01;
+      tri.centroid = (tri.v0 + tri.v1 + tri.v2) / 3;
+      _triangles.push_back(tri);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(MeshInertiaCalculator, CalculateMassPropertiesLargeMesh)
+{
+  // Tessellate a unit box centered at the origin finely enough to exercise
+  // the multithreaded integration path, and compare the result against the
+  // analytical box inertia.
+  const int n = 50;
+  const math::Vector3d lo(-0.5, -0.5, -0.5);
+  const math::Vector3d x(1, 0, 0), y(0, 1, 0), z(0, 0, 1);
+  std::vector<Triangle> triangles;
+  // -z and +z faces
+  appendBoxFace(triangles, lo, y, x, n);
+  appendBoxFace(triangles, lo + z, x, y, n);
+  // -y and +y faces
+  appendBoxFace(triangles, lo, x, z, n);
+  appendBoxFace(triangles, lo + y, z, x, n);
+  // -x and +x faces
+  appendBoxFace(triangles, lo, z, y, n);
+  appendBoxFace(triangles, lo + x, y, z, n);
+  ASSERT_EQ(static_cast<std::size_t>(6 * 2 * n * n), triangles.size());
+
+  const double density = 1200.0;
+  math::MassMatrix3d massMatrix;
+  math::Pose3d centreOfMass;
+  MeshInertiaCalculator::CalculateMassProperties(triangles, density,
+      massMatrix, centreOfMass);
+
+  // Unit box: mass = density, moments = mass / 6 on the diagonal
+  EXPECT_NEAR(density, massMatrix.Mass(), 1e-6);
+  EXPECT_NEAR(0.0, centreOfMass.Pos().X(), 1e-9);
+  EXPECT_NEAR(0.0, centreOfMass.Pos().Y(), 1e-9);
+  EXPECT_NEAR(0.0, centreOfMass.Pos().Z(), 1e-9);
+  EXPECT_NEAR(density / 6.0, massMatrix.DiagonalMoments().X(), 1e-6);
+  EXPECT_NEAR(density / 6.0, massMatrix.DiagonalMoments().Y(), 1e-6);
+  EXPECT_NEAR(density / 6.0, massMatrix.DiagonalMoments().Z(), 1e-6);
+  EXPECT_NEAR(0.0, massMatrix.OffDiagonalMoments().X(), 1e-6);
+  EXPECT_NEAR(0.0, massMatrix.OffDiagonalMoments().Y(), 1e-6);
+  EXPECT_NEAR(0.0, massMatrix.OffDiagonalMoments().Z(), 1e-6);
+  EXPECT_TRUE(massMatrix.IsValid());
+}
+
 /////////////////////////////////////////////////
 TEST(MeshInertiaCalculator, CorrectMassMatrix)
 {
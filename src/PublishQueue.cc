@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/sim/PublishQueue.hh"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gz/common/Util.hh>
+
+using namespace gz;
+using namespace sim;
+
+/// \brief Private data for the PublishQueue class.
+class gz::sim::PublishQueuePrivate
+{
+  /// \brief I/O thread body: pop messages and publish them until stopped.
+  public: void Work();
+
+  /// \brief Guards every other member.
+  public: std::mutex mutex;
+
+  /// \brief Signals the I/O thread that work or a stop request arrived.
+  public: std::condition_variable workCv;
+
+  /// \brief Signals Flush callers that the queue drained.
+  public: std::condition_variable idleCv;
+
+  /// \brief Queued messages, oldest first.
+  public: std::deque<std::unique_ptr<PublishQueue::QueuedMessage>> queue;
+
+  /// \brief Maximum number of queued messages.
+  public: std::size_t capacity{1024};
+
+  /// \brief True once the I/O thread has been started.
+  public: bool running{false};
+
+  /// \brief True when the I/O thread should drain and exit.
+  public: bool stop{false};
+
+  /// \brief True while the I/O thread is publishing a popped message.
+  public: bool busy{false};
+
+  /// \brief Messages accepted into the queue.
+  public: uint64_t enqueued{0};
+
+  /// \brief Messages published by the I/O thread.
+  public: uint64_t published{0};
+
+  /// \brief Messages dropped because the queue was full.
+  public: uint64_t dropped{0};
+
+  /// \brief Largest queue depth observed.
+  public: std::size_t highWater{0};
+
+  /// \brief The I/O thread.
+  public: std::thread thread;
+};
+
+//////////////////////////////////////////////////
+void PublishQueuePrivate::Work()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->workCv.wait(lock,
+        [this]()
+        {
+          return this->stop || !this->queue.empty();
+        });
+    if (this->queue.empty())
+    {
+      // Only reachable on stop, after the queue drained.
+      break;
+    }
+
+    auto msg = std::move(this->queue.front());
+    this->queue.pop_front();
+    this->busy = true;
+
+    // Serialization and publication happen without the lock so producers
+    // never wait on the wire.
+    lock.unlock();
+    msg->Publish();
+    lock.lock();
+
+    this->busy = false;
+    ++this->published;
+    if (this->queue.empty())
+      this->idleCv.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+PublishQueue &PublishQueue::Instance()
+{
+  static PublishQueue instance;
+  return instance;
+}
+
+//////////////////////////////////////////////////
+PublishQueue::PublishQueue()
+  : dataPtr(std::make_unique<PublishQueuePrivate>())
+{
+  std::string capacityStr;
+  if (common::env("GZ_SIM_PUBLISH_QUEUE_CAPACITY", capacityStr))
+  {
+    try
+    {
+      this->dataPtr->capacity = std::max<std::size_t>(1u,
+          std::stoul(capacityStr));
+    }
+    catch (const std::exception &)
+    {
+      // Keep the default on a malformed value.
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+PublishQueue::~PublishQueue()
+{
+  this->Shutdown();
+}
+
+//////////////////////////////////////////////////
+void PublishQueue::Shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->workCv.notify_all();
+  if (this->dataPtr->thread.joinable())
+    this->dataPtr->thread.join();
+}
+
+//////////////////////////////////////////////////
+void PublishQueue::Enqueue(std::unique_ptr<QueuedMessage> _msg)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    if (!this->dataPtr->stop)
+    {
+      if (!this->dataPtr->running)
+      {
+        this->dataPtr->running = true;
+        this->dataPtr->thread =
+            std::thread(&PublishQueuePrivate::Work, this->dataPtr.get());
+      }
+
+      // Never block the simulation: on overflow the oldest message gives
+      // way, so subscribers keep receiving the freshest data.
+      if (this->dataPtr->queue.size() >= this->dataPtr->capacity)
+      {
+        this->dataPtr->queue.pop_front();
+        ++this->dataPtr->dropped;
+      }
+
+      this->dataPtr->queue.push_back(std::move(_msg));
+      ++this->dataPtr->enqueued;
+      this->dataPtr->highWater =
+          std::max(this->dataPtr->highWater, this->dataPtr->queue.size());
+      this->dataPtr->workCv.notify_one();
+      return;
+    }
+  }
+
+  // After Shutdown the I/O thread is gone; publish inline so late
+  // publishers still deliver instead of silently losing messages.
+  _msg->Publish();
+}
+
+//////////////////////////////////////////////////
+void PublishQueue::Flush()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->idleCv.wait(lock,
+      [this]()
+      {
+        return this->dataPtr->queue.empty() && !this->dataPtr->busy;
+      });
+}
+
+//////////////////////////////////////////////////
+PublishQueue::Statistics PublishQueue::Stats() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  Statistics stats;
+  stats.enqueued = this->dataPtr->enqueued;
+  stats.published = this->dataPtr->published;
+  stats.dropped = this->dataPtr->dropped;
+  stats.depth = this->dataPtr->queue.size();
+  stats.highWater = this->dataPtr->highWater;
+  return stats;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <gz/msgs/stringmsg.pb.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gz/transport/Node.hh>
+
+#include "gz/sim/PublishQueue.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+TEST(PublishQueueTest, PublishFlushAndStats)
+{
+  transport::Node node;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::string> received;
+  std::function<void(const msgs::StringMsg &)> cb =
+      [&](const msgs::StringMsg &_msg)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(_msg.data());
+        cv.notify_all();
+      };
+  ASSERT_TRUE(node.Subscribe("/publish_queue_test", cb));
+
+  auto pub = node.Advertise<msgs::StringMsg>("/publish_queue_test");
+  ASSERT_TRUE(pub);
+
+  auto &queue = PublishQueue::Instance();
+  const auto before = queue.Stats();
+
+  msgs::StringMsg msg;
+  msg.set_data("one");
+  queue.Publish(pub, std::move(msg));
+
+  msg.Clear();
+  msg.set_data("two");
+  queue.Publish(pub, std::move(msg));
+
+  // Flush returns only once the I/O thread published everything.
+  queue.Flush();
+
+  auto stats = queue.Stats();
+  EXPECT_EQ(before.enqueued + 2u, stats.enqueued);
+  EXPECT_EQ(before.published + 2u, stats.published);
+  EXPECT_EQ(before.dropped, stats.dropped);
+  EXPECT_EQ(0u, stats.depth);
+  EXPECT_GE(stats.highWater, 1u);
+
+  // Delivery is asynchronous even after Flush, so wait for the messages.
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(5),
+        [&]()
+        {
+          return received.size() >= 2u;
+        }));
+  }
+  ASSERT_EQ(2u, received.size());
+  // Messages of one queue keep their enqueue order.
+  EXPECT_EQ("one", received[0]);
+  EXPECT_EQ("two", received[1]);
+}
+
+/////////////////////////////////////////////////
+TEST(PublishQueueTest, ShutdownPublishesInline)
+{
+  transport::Node node;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::string> received;
+  std::function<void(const msgs::StringMsg &)> cb =
+      [&](const msgs::StringMsg &_msg)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(_msg.data());
+        cv.notify_all();
+      };
+  ASSERT_TRUE(node.Subscribe("/publish_queue_shutdown_test", cb));
+
+  auto pub = node.Advertise<msgs::StringMsg>("/publish_queue_shutdown_test");
+  ASSERT_TRUE(pub);
+
+  auto &queue = PublishQueue::Instance();
+  queue.Shutdown();
+  const auto before = queue.Stats();
+
+  // After shutdown the I/O thread is gone; publication happens inline on
+  // the caller's thread instead of being dropped.
+  msgs::StringMsg msg;
+  msg.set_data("after shutdown");
+  queue.Publish(pub, std::move(msg));
+
+  auto stats = queue.Stats();
+  EXPECT_EQ(before.enqueued, stats.enqueued);
+  EXPECT_EQ(0u, stats.depth);
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(5),
+        [&]()
+        {
+          return !received.empty();
+        }));
+  }
+  ASSERT_EQ(1u, received.size());
+  EXPECT_EQ("after shutdown", received[0]);
+}
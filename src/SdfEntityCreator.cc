@@ -15,10 +15,22 @@
  *
 */
 
+#include <algorithm>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
+#include <gz/common/MeshManager.hh>
 #include <gz/common/Profiler.hh>
+#include <gz/common/URI.hh>
+#include <gz/common/WorkerPool.hh>
+#include <sdf/Geometry.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Types.hh>
 
 #include "gz/sim/Events.hh"
@@ -59,6 +71,7 @@
 #include "gz/sim/components/LinearVelocity.hh"
 #include "gz/sim/components/LinearVelocitySeed.hh"
 #include "gz/sim/components/Link.hh"
+#include "gz/sim/components/Lod.hh"
 #include "gz/sim/components/LogicalCamera.hh"
 #include "gz/sim/components/MagneticField.hh"
 #include "gz/sim/components/Magnetometer.hh"
@@ -78,6 +91,7 @@
 #include "gz/sim/components/Scene.hh"
 #include "gz/sim/components/SegmentationCamera.hh"
 #include "gz/sim/components/SelfCollide.hh"
+#include "gz/sim/components/SkipSceneComponents.hh"
 #include "gz/sim/components/Sensor.hh"
 #include "gz/sim/components/SourceFilePath.hh"
 #include "gz/sim/components/SphericalCoordinates.hh"
@@ -118,6 +132,44 @@ class gz::sim::SdfEntityCreatorPrivate
 
   /// \brief Parse Gazebo defined materials for visuals
   public: MaterialParser materialParser;
+
+  /// \brief Stage an entity's initial pose, or create the component
+  /// immediately when no batched creation is in progress.
+  /// \param[in] _entity Entity the pose belongs to.
+  /// \param[in] _pose Initial pose of the entity.
+  public: void StagePose(Entity _entity, const math::Pose3d &_pose);
+
+  /// \brief Stage an entity's initial inertial, or create the component
+  /// immediately when no batched creation is in progress.
+  /// \param[in] _entity Entity the inertial belongs to.
+  /// \param[in] _inertial Initial inertial of the entity.
+  public: void StageInertial(Entity _entity,
+      const math::Inertiald &_inertial);
+
+  /// \brief Install the staged pose and inertial components through the
+  /// ECM's bulk creation path and clear the staging arrays.
+  public: void FlushStagedComponents();
+
+  /// \brief True while a batched CreateEntities call is collecting
+  /// initial poses and inertials into the flat arrays below instead of
+  /// creating the components one by one.
+  public: bool stagingComponents{false};
+
+  /// \brief Initial poses collected while parsing, installed in bulk
+  /// before the entity batch is committed.
+  public: std::vector<std::pair<Entity, math::Pose3d>> stagedPoses;
+
+  /// \brief Initial inertials collected while parsing, installed in bulk
+  /// before the entity batch is committed.
+  public: std::vector<std::pair<Entity, math::Inertiald>> stagedInertials;
+
+  /// \brief Get whether render-only components should be skipped. Resolved
+  /// from the world entity's SkipSceneComponents component and cached, so
+  /// the flag must be set before entities are created.
+  public: bool SkipSceneComponents();
+
+  /// \brief Cached value of the world's SkipSceneComponents component.
+  public: std::optional<bool> skipSceneComponents;
 };
 
 using namespace gz;
@@ -235,6 +287,58 @@ SdfEntityCreator &SdfEntityCreator::operator=(const SdfEntityCreator &_creator)
 SdfEntityCreator &SdfEntityCreator::operator=(SdfEntityCreator &&_creator)
     noexcept = default;
 
+/////////////////////////////////////////////////
+bool SdfEntityCreatorPrivate::SkipSceneComponents()
+{
+  if (!this->skipSceneComponents.has_value())
+  {
+    Entity worldEntity = this->ecm->EntityByComponents(components::World());
+    if (kNullEntity == worldEntity)
+      return false;
+
+    auto skipComp =
+        this->ecm->Component<components::SkipSceneComponents>(worldEntity);
+    this->skipSceneComponents = (nullptr != skipComp && skipComp->Data());
+  }
+  return *this->skipSceneComponents;
+}
+
+//////////////////////////////////////////////////
+void SdfEntityCreatorPrivate::StagePose(Entity _entity,
+    const math::Pose3d &_pose)
+{
+  if (this->stagingComponents)
+    this->stagedPoses.emplace_back(_entity, _pose);
+  else
+    this->ecm->CreateComponent(_entity, components::Pose(_pose));
+}
+
+//////////////////////////////////////////////////
+void SdfEntityCreatorPrivate::StageInertial(Entity _entity,
+    const math::Inertiald &_inertial)
+{
+  if (this->stagingComponents)
+    this->stagedInertials.emplace_back(_entity, _inertial);
+  else
+    this->ecm->CreateComponent(_entity, components::Inertial(_inertial));
+}
+
+//////////////////////////////////////////////////
+void SdfEntityCreatorPrivate::FlushStagedComponents()
+{
+  if (!this->stagedPoses.empty())
+  {
+    this->ecm->CreateComponentBatch<components::Pose>(this->stagedPoses);
+    this->stagedPoses.clear();
+  }
+  if (!this->stagedInertials.empty())
+  {
+    this->ecm->CreateComponentBatch<components::Inertial>(
+        this->stagedInertials);
+    this->stagedInertials.clear();
+  }
+}
+
 //////////////////////////////////////////////////
 Entity SdfEntityCreator::CreateEntities(const sdf::World *_world)
 {
@@ -245,12 +349,88 @@ Entity SdfEntityCreator::CreateEntities(const sdf::World *_world)
   return worldEntity;
 }
 
+//////////////////////////////////////////////////
+/// \brief Queue a background load for the mesh file referenced by a
+/// geometry, if any. Meshes already queued, meshes registered by name and
+/// URIs the mesh manager can't load are skipped.
+/// \param[in] _geom Geometry to inspect. May be null.
+/// \param[in] _pool Worker pool the load is dispatched on
+/// \param[in, out] _queued Resolved mesh paths already dispatched
+static void prefetchGeometryMesh(const sdf::Geometry *_geom,
+    common::WorkerPool &_pool, std::unordered_set<std::string> &_queued)
+{
+  if (nullptr == _geom || _geom->Type() != sdf::GeometryType::MESH)
+    return;
+
+  const sdf::Mesh *meshSdf = _geom->MeshShape();
+  if (nullptr == meshSdf)
+    return;
+
+  // Meshes with a name:// scheme live in the mesh manager already and have
+  // no file to load.
+  if (common::URI(meshSdf->Uri()).Scheme() == "name")
+    return;
+
+  if (!common::MeshManager::Instance()->IsValidFilename(meshSdf->Uri()))
+    return;
+
+  const std::string fullPath = asFullPath(meshSdf->Uri(),
+      meshSdf->FilePath());
+  if (!_queued.insert(fullPath).second)
+    return;
+
+  _pool.AddWork([fullPath]()
+  {
+    // Failures are not reported here; the consumer that needs the mesh
+    // loads it again and warns with context.
+    common::MeshManager::Instance()->Load(fullPath);
+  });
+}
+
+//////////////////////////////////////////////////
+/// \brief Queue background loads for every unique mesh file referenced by
+/// the collisions and visuals of a model and of its nested models, so the
+/// mesh cache is warm by the time physics and rendering request the same
+/// geometries.
+/// \param[in] _model Model to walk
+/// \param[in] _pool Worker pool the loads are dispatched on
+/// \param[in, out] _queued Resolved mesh paths already dispatched
+static void prefetchModelMeshes(const sdf::Model *_model,
+    common::WorkerPool &_pool, std::unordered_set<std::string> &_queued)
+{
+  for (uint64_t linkIndex = 0; linkIndex < _model->LinkCount(); ++linkIndex)
+  {
+    const sdf::Link *link = _model->LinkByIndex(linkIndex);
+    for (uint64_t i = 0; i < link->CollisionCount(); ++i)
+    {
+      prefetchGeometryMesh(link->CollisionByIndex(i)->Geom(), _pool, _queued);
+    }
+    for (uint64_t i = 0; i < link->VisualCount(); ++i)
+    {
+      prefetchGeometryMesh(link->VisualByIndex(i)->Geom(), _pool, _queued);
+    }
+  }
+
+  for (uint64_t modelIndex = 0; modelIndex < _model->ModelCount();
+      ++modelIndex)
+  {
+    prefetchModelMeshes(_model->ModelByIndex(modelIndex), _pool, _queued);
+  }
+}
+
 //////////////////////////////////////////////////
 void SdfEntityCreator::CreateEntities(const sdf::World *_world,
     Entity _worldEntity)
 {
   GZ_PROFILE("SdfEntityCreator::CreateEntities(sdf::World)");
 
+  // Stage the whole world as one batch so view membership is updated once
+  // per entity instead of once per created component. Initial poses and
+  // inertials are collected into flat arrays while parsing and installed
+  // through the ECM's bulk creation path just before the batch commits.
+  this->dataPtr->ecm->BeginEntityBatch();
+  this->dataPtr->stagingComponents = true;
+
   if (!this->dataPtr->ecm->EntityHasComponentType(
         _worldEntity, components::World::typeId))
   {
@@ -300,7 +480,7 @@ void SdfEntityCreator::CreateEntities(const sdf::World *_world,
   });
 
   // scene
-  if (_world->Scene())
+  if (_world->Scene() && !this->dataPtr->SkipSceneComponents())
   {
     this->dataPtr->ecm->CreateComponent(_worldEntity,
         components::Scene(*_world->Scene()));
@@ -320,6 +500,27 @@ void SdfEntityCreator::CreateEntities(const sdf::World *_world,
         components::SphericalCoordinates(*_world->SphericalCoordinates()));
   }
 
+  // Start warming the mesh cache for every model that is about to be
+  // created. The ECM is single-writer, so entities are still committed
+  // serially below in world order; the mesh file I/O is the
+  // parallelizable part of load, and it overlaps with those commits here.
+  common::WorkerPool meshPrefetchPool{
+      std::max(2u, std::thread::hardware_concurrency())};
+  {
+    GZ_PROFILE("SdfEntityCreator::PrefetchMeshes");
+    std::unordered_set<std::string> queuedMeshes;
+    for (uint64_t modelIndex = 0; modelIndex < _world->ModelCount();
+        ++modelIndex)
+    {
+      const sdf::Model *model = _world->ModelByIndex(modelIndex);
+      if (levelEntityNames.empty() ||
+          levelEntityNames.find(model->Name()) != levelEntityNames.end())
+      {
+        prefetchModelMeshes(model, meshPrefetchPool, queuedMeshes);
+      }
+    }
+  }
+
   // Models
   for (uint64_t modelIndex = 0; modelIndex < _world->ModelCount();
       ++modelIndex)
@@ -455,6 +656,20 @@ void SdfEntityCreator::CreateEntities(const sdf::World *_world,
   this->dataPtr->ecm->CreateComponent(
       _worldEntity, components::WorldSdf(*_world));
 
+  // Join the mesh prefetch before plugins load: systems configured below,
+  // physics in particular, expect their mesh lookups to hit the cache.
+  {
+    GZ_PROFILE("SdfEntityCreator::WaitForMeshPrefetch");
+    meshPrefetchPool.WaitForResults();
+  }
+
+  // Install the staged poses and inertials, then commit the staged
+  // entities before loading plugins, which may query the ECM and expect
+  // the new entities to be visible in views.
+  this->dataPtr->stagingComponents = false;
+  this->dataPtr->FlushStagedComponents();
+  this->dataPtr->ecm->CommitEntityBatch();
+
   this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(_worldEntity,
       _world->Plugins());
 
@@ -467,7 +682,15 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Model *_model)
 {
   GZ_PROFILE("SdfEntityCreator::CreateEntities(sdf::Model)");
 
+  // Stage the whole model as one batch so view membership is updated once
+  // per entity instead of once per created component. Initial poses and
+  // inertials are collected into flat arrays and installed in bulk.
+  this->dataPtr->ecm->BeginEntityBatch();
+  this->dataPtr->stagingComponents = true;
   auto ent = this->CreateEntities(_model, false);
+  this->dataPtr->stagingComponents = false;
+  this->dataPtr->FlushStagedComponents();
+  this->dataPtr->ecm->CommitEntityBatch();
 
   // Load all model plugins afterwards, so we get scoped name for nested models.
   this->LoadModelPlugins();
@@ -508,8 +731,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Model *_model,
 
   // Components
   this->dataPtr->ecm->CreateComponent(modelEntity, components::Model());
-  this->dataPtr->ecm->CreateComponent(modelEntity,
-      components::Pose(ResolveSdfPose(_model->SemanticPose())));
+  this->dataPtr->StagePose(modelEntity,
+      ResolveSdfPose(_model->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(modelEntity,
       components::Name(_model->Name()));
   bool isStatic = _model->Static() || _staticParent;
@@ -631,8 +854,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Actor *_actor)
 
   // Components
   this->dataPtr->ecm->CreateComponent(actorEntity, components::Actor(*_actor));
-  this->dataPtr->ecm->CreateComponent(actorEntity,
-      components::Pose(_actor->RawPose()));
+  this->dataPtr->StagePose(actorEntity, _actor->RawPose());
   this->dataPtr->ecm->CreateComponent(actorEntity,
       components::Name(_actor->Name()));
 
@@ -646,7 +868,9 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Actor *_actor)
     this->SetParent(linkEntity, actorEntity);
   }
 
-  // Actor plugins
+  // Actor plugins are loaded right away, so any staged components must be
+  // installed first: the plugins may read the actor's pose on Configure.
+  this->dataPtr->FlushStagedComponents();
   this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(actorEntity,
         _actor->Plugins());
 
@@ -663,8 +887,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Light *_light)
 
   // Components
   this->dataPtr->ecm->CreateComponent(lightEntity, components::Light(*_light));
-  this->dataPtr->ecm->CreateComponent(lightEntity,
-      components::Pose(ResolveSdfPose(_light->SemanticPose())));
+  this->dataPtr->StagePose(lightEntity,
+      ResolveSdfPose(_light->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(lightEntity,
       components::Name(_light->Name()));
 
@@ -674,8 +898,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Light *_light)
   // Light Visual
   Entity lightVisualEntity = this->dataPtr->ecm->CreateEntity();
   this->dataPtr->ecm->CreateComponent(lightVisualEntity, components::Visual());
-  this->dataPtr->ecm->CreateComponent(lightVisualEntity,
-      components::Pose());
+  this->dataPtr->StagePose(lightVisualEntity, math::Pose3d());
   this->dataPtr->ecm->CreateComponent(lightVisualEntity,
       components::Name(_light->Name() + "Visual"));
   this->dataPtr->ecm->CreateComponent(lightVisualEntity,
@@ -698,12 +921,11 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Link *_link)
   // Components
   this->dataPtr->ecm->CreateComponent(linkEntity, components::Link());
 
-  this->dataPtr->ecm->CreateComponent(linkEntity,
-      components::Pose(ResolveSdfPose(_link->SemanticPose())));
+  this->dataPtr->StagePose(linkEntity,
+      ResolveSdfPose(_link->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(linkEntity,
       components::Name(_link->Name()));
-  this->dataPtr->ecm->CreateComponent(linkEntity,
-      components::Inertial(_link->Inertial()));
+  this->dataPtr->StageInertial(linkEntity, _link->Inertial());
 
   if (_link->EnableWind())
   {
@@ -718,14 +940,18 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Link *_link)
         linkEntity, components::GravityEnabled(false));
   }
 
-  // Visuals
-  for (uint64_t visualIndex = 0; visualIndex < _link->VisualCount();
-      ++visualIndex)
+  // Visuals. Skipped entirely (including visual plugins) when render-only
+  // components are disabled, since nothing consumes them.
+  if (!this->dataPtr->SkipSceneComponents())
   {
-    auto visual = _link->VisualByIndex(visualIndex);
-    auto visualEntity = this->CreateEntities(visual);
+    for (uint64_t visualIndex = 0; visualIndex < _link->VisualCount();
+        ++visualIndex)
+    {
+      auto visual = _link->VisualByIndex(visualIndex);
+      auto visualEntity = this->CreateEntities(visual);
 
-    this->SetParent(visualEntity, linkEntity);
+      this->SetParent(visualEntity, linkEntity);
+    }
   }
 
   // Collisions
@@ -841,8 +1067,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Joint *_joint,
         components::JointAxis2(std::move(*resolvedAxis)));
   }
 
-  this->dataPtr->ecm->CreateComponent(jointEntity,
-      components::Pose(ResolveSdfPose(_joint->SemanticPose())));
+  this->dataPtr->StagePose(jointEntity,
+      ResolveSdfPose(_joint->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(jointEntity ,
       components::Name(_joint->Name()));
   this->dataPtr->ecm->CreateComponent(jointEntity ,
@@ -914,8 +1140,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Visual *_visual)
 
   // Components
   this->dataPtr->ecm->CreateComponent(visualEntity, components::Visual());
-  this->dataPtr->ecm->CreateComponent(visualEntity,
-      components::Pose(ResolveSdfPose(_visual->SemanticPose())));
+  this->dataPtr->StagePose(visualEntity,
+      ResolveSdfPose(_visual->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(visualEntity,
       components::Name(_visual->Name()));
   this->dataPtr->ecm->CreateComponent(visualEntity,
@@ -1002,6 +1228,40 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Visual *_visual)
     }
   }
 
+  // Level-of-detail mesh variants from custom <gz:lod> elements, e.g.
+  //   <gz:lod min_distance="25" uri="meshes/shelf_lod1.dae"/>
+  // min_distance and uri may be given as attributes or child elements.
+  if (_visual->Element() && _visual->Element()->HasElement("gz:lod"))
+  {
+    std::vector<LodVariant> variants;
+    for (auto lodElem = _visual->Element()->GetElement("gz:lod"); lodElem;
+         lodElem = lodElem->GetNextElement("gz:lod"))
+    {
+      LodVariant variant;
+      variant.minDistance = lodElem->Get<double>("min_distance", 0.0).first;
+      std::string uri = lodElem->Get<std::string>("uri", "").first;
+      if (uri.empty())
+      {
+        gzwarn << "Ignoring <gz:lod> without a uri in visual ["
+               << _visual->Name() << "]" << std::endl;
+        continue;
+      }
+      // Resolve relative URIs now, while the SDF file path is known.
+      variant.meshUri = asFullPath(uri, lodElem->FilePath());
+      variants.push_back(variant);
+    }
+    if (!variants.empty())
+    {
+      std::sort(variants.begin(), variants.end(),
+          [](const LodVariant &_a, const LodVariant &_b)
+          {
+            return _a.minDistance < _b.minDistance;
+          });
+      this->dataPtr->ecm->CreateComponent(visualEntity,
+          components::Lod(variants));
+    }
+  }
+
   // Keep track of visuals so we can load their plugins after loading the
   // entire model and having its full scoped name.
   if (!_visual->Plugins().empty())
@@ -1039,8 +1299,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::ParticleEmitter *_emitter)
   // Components
   this->dataPtr->ecm->CreateComponent(emitterEntity,
       components::ParticleEmitter(particleEmitterMsg));
-  this->dataPtr->ecm->CreateComponent(emitterEntity,
-      components::Pose(ResolveSdfPose(_emitter->SemanticPose())));
+  this->dataPtr->StagePose(emitterEntity,
+      ResolveSdfPose(_emitter->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(emitterEntity,
       components::Name(_emitter->Name()));
 
@@ -1058,8 +1318,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Projector *_projector)
   // Components
   this->dataPtr->ecm->CreateComponent(projectorEntity,
       components::Projector(*_projector));
-  this->dataPtr->ecm->CreateComponent(projectorEntity,
-      components::Pose(ResolveSdfPose(_projector->SemanticPose())));
+  this->dataPtr->StagePose(projectorEntity,
+      ResolveSdfPose(_projector->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(projectorEntity,
       components::Name(_projector->Name()));
 
@@ -1077,8 +1337,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Collision *_collision)
   // Components
   this->dataPtr->ecm->CreateComponent(collisionEntity,
       components::Collision());
-  this->dataPtr->ecm->CreateComponent(collisionEntity,
-      components::Pose(ResolveSdfPose(_collision->SemanticPose())));
+  this->dataPtr->StagePose(collisionEntity,
+      ResolveSdfPose(_collision->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(collisionEntity,
       components::Name(_collision->Name()));
 
@@ -1105,8 +1365,8 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Sensor *_sensor)
   // Components
   this->dataPtr->ecm->CreateComponent(sensorEntity,
       components::Sensor());
-  this->dataPtr->ecm->CreateComponent(sensorEntity,
-      components::Pose(ResolveSdfPose(_sensor->SemanticPose())));
+  this->dataPtr->StagePose(sensorEntity,
+      ResolveSdfPose(_sensor->SemanticPose()));
   this->dataPtr->ecm->CreateComponent(sensorEntity,
       components::Name(_sensor->Name()));
 
@@ -40,6 +40,7 @@
 #include "gz/sim/components/LaserRetro.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
+#include "gz/sim/components/Lod.hh"
 #include "gz/sim/components/Material.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
@@ -47,6 +48,7 @@
 #include "gz/sim/components/ParentLinkName.hh"
 #include "gz/sim/components/Physics.hh"
 #include "gz/sim/components/Pose.hh"
+#include "gz/sim/components/SkipSceneComponents.hh"
 #include "gz/sim/components/Transparency.hh"
 #include "gz/sim/components/Visibility.hh"
 #include "gz/sim/components/Visual.hh"
@@ -667,6 +669,45 @@ TEST_F(SdfEntityCreatorTest, CreateEntities)
   EXPECT_EQ(1u, lightCount);
 }
 
+/////////////////////////////////////////////////
+TEST_F(SdfEntityCreatorTest, SkipSceneComponents)
+{
+  EXPECT_EQ(0u, this->ecm.EntityCount());
+
+  // SdfEntityCreator
+  SdfEntityCreator creator(this->ecm, evm);
+
+  // Load SDF file
+  sdf::Root root;
+  root.Load(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Mark the world as skipping render-only components before creating the
+  // rest of the entities, the way the simulation runner does.
+  Entity worldEntity = this->ecm.CreateEntity();
+  this->ecm.CreateComponent(worldEntity, components::World());
+  this->ecm.CreateComponent(worldEntity, components::SkipSceneComponents(true));
+
+  creator.CreateEntities(root.WorldByIndex(0), worldEntity);
+
+  // Physics-side entities are still created.
+  EXPECT_TRUE(this->ecm.HasComponentType(components::Model::typeId));
+  EXPECT_TRUE(this->ecm.HasComponentType(components::Link::typeId));
+  EXPECT_TRUE(this->ecm.HasComponentType(components::Collision::typeId));
+
+  // No visual entities, materials or scene.
+  unsigned int visualCount{0u};
+  this->ecm.Each<components::Visual>(
+      [&](const Entity &, const components::Visual *)->bool
+      {
+        ++visualCount;
+        return true;
+      });
+  EXPECT_EQ(0u, visualCount);
+  EXPECT_FALSE(this->ecm.HasComponentType(components::Material::typeId));
+}
+
 /////////////////////////////////////////////////
 TEST_F(SdfEntityCreatorTest, CreateLights)
 {
@@ -1274,3 +1315,57 @@ TEST_F(SdfEntityCreatorTest, EachRemovedRecursiveRemoved)
   EXPECT_EQ(0u, removedCount<components::Collision>(ecm));
   EXPECT_EQ(0u, removedCount<components::Visual>(ecm));
 }
+
+/////////////////////////////////////////////////
+TEST_F(SdfEntityCreatorTest, CreateVisualLod)
+{
+  EXPECT_EQ(0u, this->ecm.EntityCount());
+
+  // SdfEntityCreator
+  SdfEntityCreator creator(this->ecm, evm);
+
+  sdf::Root root;
+  root.LoadSdfString("<?xml version='1.0'?><sdf version='1.6'>"
+      "<world name='default'>"
+      "<model name='shelf'>"
+      "<link name='link'>"
+      "<visual name='visual'>"
+      "<geometry><box><size>1 1 1</size></box></geometry>"
+      // Unsorted on purpose; the component must come out sorted by
+      // ascending activation distance.
+      "<gz:lod min_distance='50' uri='meshes/shelf_lod2.dae'/>"
+      "<gz:lod min_distance='20' uri='meshes/shelf_lod1.dae'/>"
+      // Missing uri, should be ignored
+      "<gz:lod min_distance='100'/>"
+      "</visual>"
+      "<visual name='plain'>"
+      "<geometry><box><size>1 1 1</size></box></geometry>"
+      "</visual>"
+      "</link>"
+      "</model>"
+      "</world></sdf>");
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create entities
+  creator.CreateEntities(root.WorldByIndex(0));
+
+  auto lodVisual = this->ecm.EntityByComponents(components::Name("visual"),
+      components::Visual());
+  ASSERT_NE(kNullEntity, lodVisual);
+
+  auto lodComp = this->ecm.Component<components::Lod>(lodVisual);
+  ASSERT_NE(nullptr, lodComp);
+  ASSERT_EQ(2u, lodComp->Data().size());
+  EXPECT_DOUBLE_EQ(20.0, lodComp->Data()[0].minDistance);
+  EXPECT_DOUBLE_EQ(50.0, lodComp->Data()[1].minDistance);
+  EXPECT_NE(std::string::npos,
+      lodComp->Data()[0].meshUri.find("shelf_lod1.dae"));
+  EXPECT_NE(std::string::npos,
+      lodComp->Data()[1].meshUri.find("shelf_lod2.dae"));
+
+  // Visuals without <gz:lod> don't get the component
+  auto plainVisual = this->ecm.EntityByComponents(components::Name("plain"),
+      components::Visual());
+  ASSERT_NE(kNullEntity, plainVisual);
+  EXPECT_EQ(nullptr, this->ecm.Component<components::Lod>(plainVisual));
+}
@@ -18,7 +18,10 @@
 #include "SdfGenerator.hh"
 
 #include <ctype.h>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include <sdf/sdf.hh>
@@ -270,6 +273,65 @@ namespace sdf_generator
     }
   }
 
+  /////////////////////////////////////////////////
+  /// \brief Combine a hash into a running signature.
+  /// \param[in, out] _seed Signature to combine into
+  /// \param[in] _value Hash to combine
+  static void hashCombine(std::size_t &_seed, std::size_t _value)
+  {
+    _seed ^= _value + 0x9e3779b97f4a7c15ull + (_seed << 6) + (_seed >> 2);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Signature of the ECM data that feeds a model's generated
+  /// element: the entity hierarchy plus the components the update*Element
+  /// functions rewrite during simulation (name, pose, static,
+  /// self-collide, wind mode and inertial). A model whose signature is
+  /// unchanged generates an identical element.
+  /// \param[in] _ecm Immutable reference to the Entity Component Manager
+  /// \param[in] _entity Model entity
+  /// \return The signature.
+  static std::size_t modelSignature(const EntityComponentManager &_ecm,
+                                    const Entity &_entity)
+  {
+    std::size_t sig = 0u;
+    std::function<void(const Entity &)> visit = [&](const Entity &_e)
+    {
+      hashCombine(sig, std::hash<uint64_t>{}(_e));
+      if (auto *nameComp = _ecm.Component<components::Name>(_e))
+        hashCombine(sig, std::hash<std::string>{}(nameComp->Data()));
+      if (auto *poseComp = _ecm.Component<components::Pose>(_e))
+      {
+        const auto &pose = poseComp->Data();
+        for (double v : {pose.Pos().X(), pose.Pos().Y(), pose.Pos().Z(),
+            pose.Rot().W(), pose.Rot().X(), pose.Rot().Y(), pose.Rot().Z()})
+        {
+          hashCombine(sig, std::hash<double>{}(v));
+        }
+      }
+      if (auto *staticComp = _ecm.Component<components::Static>(_e))
+        hashCombine(sig, staticComp->Data() ? 2u : 1u);
+      if (auto *selfCollideComp = _ecm.Component<components::SelfCollide>(_e))
+        hashCombine(sig, selfCollideComp->Data() ? 2u : 1u);
+      if (auto *windModeComp = _ecm.Component<components::WindMode>(_e))
+        hashCombine(sig, windModeComp->Data() ? 2u : 1u);
+      if (auto *inertialComp = _ecm.Component<components::Inertial>(_e))
+      {
+        const auto &massMatrix = inertialComp->Data().MassMatrix();
+        hashCombine(sig, std::hash<double>{}(massMatrix.Mass()));
+        hashCombine(sig, std::hash<double>{}(
+            massMatrix.DiagonalMoments().SquaredLength()));
+      }
+      for (const auto &child :
+          _ecm.EntitiesByComponents(components::ParentEntity(_e)))
+      {
+        visit(child);
+      }
+    };
+    visit(_entity);
+    return sig;
+  }
+
   /////////////////////////////////////////////////
   std::optional<std::string> generateWorld(
       const EntityComponentManager &_ecm, const Entity &_entity,
@@ -285,12 +347,31 @@ namespace sdf_generator
     return elem->ToString("");
   }
 
+  /////////////////////////////////////////////////
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      WorldGenCache &_cache, const IncludeUriMap &_includeUriMap,
+      const msgs::SdfGeneratorConfig &_config)
+  {
+    sdf::ElementPtr elem = std::make_shared<sdf::Element>();
+    sdf::initFile("root.sdf", elem);
+    auto worldElem = elem->AddElement("world");
+    if (!updateWorldElement(worldElem, _ecm, _entity, _includeUriMap, _config,
+        &_cache))
+    {
+      return std::nullopt;
+    }
+
+    return elem->ToString("");
+  }
+
   /////////////////////////////////////////////////
   bool updateWorldElement(sdf::ElementPtr _elem,
                           const EntityComponentManager &_ecm,
                           const Entity &_entity,
                           const IncludeUriMap &_includeUriMap,
-                          const msgs::SdfGeneratorConfig &_config)
+                          const msgs::SdfGeneratorConfig &_config,
+                          WorldGenCache *_cache)
   {
     const auto *worldSdf = _ecm.Component<components::WorldSdf>(_entity);
 
@@ -329,6 +410,13 @@ namespace sdf_generator
 
     auto worldDir = common::parentPath(worldSdf->Data().Element()->FilePath());
 
+    std::unordered_set<Entity> seenModels;
+    if (nullptr != _cache)
+    {
+      _cache->reused = 0u;
+      _cache->regenerated = 0u;
+    }
+
     // models
     _ecm.Each<components::Model, components::ModelSdf>(
         [&](const Entity &_modelEntity, const components::Model *,
@@ -360,14 +448,44 @@ namespace sdf_generator
 
           if (modelConfig.expand_include_tags().data() || !modelFromInclude)
           {
-            auto modelElem = _elem->AddElement("model");
-            updateModelElement(modelElem, _ecm, _modelEntity);
+            WorldGenCache::ModelEntry *entry{nullptr};
+            std::size_t signature = 0u;
+            if (nullptr != _cache)
+            {
+              seenModels.insert(_modelEntity);
+              entry = &_cache->models[_modelEntity];
+              signature = modelSignature(_ecm, _modelEntity);
+              // The per-model config changes the generated element too
+              hashCombine(signature,
+                  std::hash<std::string>{}(modelConfig.SerializeAsString()));
+            }
 
-            // Check & update possible //model/include(s)
-            if (!modelConfig.expand_include_tags().data())
+            if (nullptr != entry && nullptr != entry->elem &&
+                entry->signature == signature)
+            {
+              // Reuse the cached subtree by reference; InsertElement
+              // re-parents it under the fresh world element
+              _elem->InsertElement(entry->elem, true);
+              ++_cache->reused;
+            }
+            else
             {
-              updateModelElementWithNestedInclude(modelElem,
-                    modelConfig.save_fuel_version().data(), _includeUriMap);
+              auto modelElem = _elem->AddElement("model");
+              updateModelElement(modelElem, _ecm, _modelEntity);
+
+              // Check & update possible //model/include(s)
+              if (!modelConfig.expand_include_tags().data())
+              {
+                updateModelElementWithNestedInclude(modelElem,
+                      modelConfig.save_fuel_version().data(), _includeUriMap);
+              }
+
+              if (nullptr != entry)
+              {
+                entry->elem = modelElem;
+                entry->signature = signature;
+                ++_cache->regenerated;
+              }
             }
           }
           else if (uriMapIt != _includeUriMap.end())
@@ -422,6 +540,18 @@ namespace sdf_generator
           return true;
         });
 
+    // Drop cache entries of models that left the world
+    if (nullptr != _cache)
+    {
+      for (auto it = _cache->models.begin(); it != _cache->models.end();)
+      {
+        if (seenModels.find(it->first) == seenModels.end())
+          it = _cache->models.erase(it);
+        else
+          ++it;
+      }
+    }
+
     // lights
     _ecm.Each<components::Light, components::ParentEntity>(
         [&](const Entity &_lightEntity,
@@ -20,6 +20,7 @@
 #include <gz/msgs/sdf_generator_config.pb.h>
 
 #include <sdf/Element.hh>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -37,6 +38,44 @@ namespace sdf_generator
 {
   using IncludeUriMap = std::unordered_map<std::string, std::string>;
 
+  /// \brief Cache of generated per-model element trees for incremental
+  /// world generation. Repeated snapshots of mostly-static worlds reuse
+  /// the cached subtree of every model whose generation inputs are
+  /// unchanged, instead of rebuilding every element from the ECM.
+  ///
+  /// Reuse is keyed on a signature of the entity hierarchy and of the
+  /// components the generator rewrites during simulation: name, pose,
+  /// static, self-collide, wind mode and inertial. Mutations outside that
+  /// set, e.g. a light color changed through a user command, are not
+  /// detected; call Clear after such edits.
+  struct WorldGenCache
+  {
+    /// \brief A cached model subtree
+    struct ModelEntry
+    {
+      /// \brief Generated <model> element
+      sdf::ElementPtr elem;
+
+      /// \brief Signature of the inputs the element was generated from
+      std::size_t signature{0u};
+    };
+
+    /// \brief Cached model elements keyed by model entity
+    std::unordered_map<Entity, ModelEntry> models;
+
+    /// \brief Models reused from the cache by the last generation
+    std::size_t reused{0u};
+
+    /// \brief Models regenerated by the last generation
+    std::size_t regenerated{0u};
+
+    /// \brief Drop all cached elements.
+    public: void Clear()
+    {
+      this->models.clear();
+    }
+  };
+
   /// \brief Generate the SDFormat representation of a world
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
   /// \input[in] _entity World entity
@@ -51,6 +90,24 @@ namespace sdf_generator
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
       const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
 
+  /// \brief Generate the SDFormat representation of a world incrementally,
+  /// reusing the element trees of models whose generation inputs are
+  /// unchanged since the previous call with the same cache.
+  /// \input[in] _ecm Immutable reference to the Entity Component Manager
+  /// \input[in] _entity World entity
+  /// \input[in, out] _cache Cache carried across calls
+  /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
+  /// included Fuel models
+  /// \input[in] _config Configuration for the world generator
+  /// \returns Generated world string if generation succeeded.
+  /// Otherwise, nullopt
+  GZ_SIM_VISIBLE
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      WorldGenCache &_cache,
+      const IncludeUriMap &_includeUriMap = IncludeUriMap(),
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+
   /// \brief Update a sdf::Element of a world. Intended for internal use.
   /// \input[in, out] _elem sdf::Element to update
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
@@ -58,12 +115,14 @@ namespace sdf_generator
   /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
   /// included Fuel models
   /// \input[in] _config Configuration for the world generator
+  /// \input[in, out] _cache Optional cache for incremental generation
   GZ_SIM_VISIBLE
   bool updateWorldElement(
       sdf::ElementPtr _elem,
       const EntityComponentManager &_ecm, const Entity &_entity,
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
-      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig(),
+      WorldGenCache *_cache = nullptr);
 
   /// \brief Update a sdf::Element of an inlined model.
   /// Intended for internal use.
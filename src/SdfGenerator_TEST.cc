@@ -980,6 +980,55 @@ TEST_F(GenerateWorldFixture, ModelsInline)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(GenerateWorldFixture, IncrementalCache)
+{
+  this->LoadWorld(common::joinPaths("test", "worlds", "save_world.sdf"));
+  Entity worldEntity = this->ecm.EntityByComponents(components::World());
+  this->sdfGenConfig.mutable_global_entity_gen_config()
+      ->mutable_expand_include_tags()
+      ->set_data(true);
+
+  sdf_generator::WorldGenCache cache;
+  const auto first = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(0u, cache.reused);
+  EXPECT_GT(cache.regenerated, 0u);
+  const std::size_t modelCount = cache.regenerated;
+
+  // Nothing changed, so every model is reused and the output is identical
+  const auto second = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(modelCount, cache.reused);
+  EXPECT_EQ(0u, cache.regenerated);
+  EXPECT_EQ(*first, *second);
+
+  // Moving one model regenerates only that model
+  Entity modelEntity = this->ecm.EntityByComponents(components::Model(),
+      components::Name("inlineM1"));
+  ASSERT_NE(kNullEntity, modelEntity);
+  auto *poseComp = this->ecm.Component<components::Pose>(modelEntity);
+  ASSERT_NE(nullptr, poseComp);
+  *poseComp = components::Pose(math::Pose3d(0, 0, 2, 0, 0, 0.5));
+
+  const auto third = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(third.has_value());
+  EXPECT_EQ(modelCount - 1, cache.reused);
+  EXPECT_EQ(1u, cache.regenerated);
+  EXPECT_NE(*first, *third);
+
+  // The regenerated output carries the new pose
+  sdf::Root newRoot;
+  newRoot.LoadSdfString(*third);
+  ASSERT_NE(nullptr, newRoot.WorldByIndex(0));
+  const auto *movedModel = newRoot.WorldByIndex(0)->ModelByName("inlineM1");
+  ASSERT_NE(nullptr, movedModel);
+  EXPECT_EQ(math::Pose3d(0, 0, 2, 0, 0, 0.5), movedModel->RawPose());
+}
+
 /////////////////////////////////////////////////
 TEST_F(GenerateWorldFixture, PoseWithAttributes)
 {
@@ -15,6 +15,8 @@
  *
 */
 
+#include <algorithm>
+#include <chrono>
 #include <numeric>
 
 #ifdef HAVE_PYBIND11
@@ -22,6 +24,7 @@
 #endif
 
 #include <gz/common/SystemPaths.hh>
+#include <gz/common/Util.hh>
 #include <gz/fuel_tools/Interface.hh>
 #include <gz/fuel_tools/ClientConfig.hh>
 #include <sdf/Root.hh>
@@ -63,6 +66,52 @@ Server::Server(const ServerConfig &_config)
 
   this->dataPtr->config = _config;
 
+  // The sensors system runs in-process but loads as a plugin without
+  // access to the ServerConfig, so its render-thread policy travels
+  // through the environment variables the system reads on startup.
+  {
+    const auto &threadPolicies = _config.ThreadPolicies();
+    auto renderPolicy = threadPolicies.find(
+        ServerConfig::ThreadCategory::SensorsRender);
+    if (renderPolicy != threadPolicies.end())
+    {
+      const auto &policy = renderPolicy->second;
+      if (!policy.name.empty())
+        common::setenv("GZ_SIM_RENDER_THREAD_NAME", policy.name);
+      if (!policy.cpus.empty())
+      {
+        std::string cpus;
+        for (const auto cpu : policy.cpus)
+          cpus += (cpus.empty() ? "" : ",") + std::to_string(cpu);
+        common::setenv("GZ_SIM_RENDER_THREAD_AFFINITY", cpus);
+      }
+      if (!policy.schedulingClass.empty())
+      {
+        common::setenv("GZ_SIM_RENDER_THREAD_SCHED",
+            policy.schedulingClass + ":" + std::to_string(policy.priority));
+      }
+    }
+  }
+
+  // Apply the memory policy before loading so that load-time allocations
+  // are covered. Huge pages are requested again after entity creation to
+  // mark any large mappings created during the load.
+  if (_config.PrefaultMemory())
+  {
+    if (prefaultProcessMemory())
+      gzmsg << "Prefaulting process memory during load." << std::endl;
+    else
+      gzwarn << "Unable to prefault process memory. Check the memory lock "
+             << "limit (e.g. RLIMIT_MEMLOCK)." << std::endl;
+  }
+  if (_config.UseHugePages())
+  {
+    if (applyHugePagePolicy())
+      gzmsg << "Requested transparent huge pages." << std::endl;
+    else
+      gzwarn << "Unable to request transparent huge pages." << std::endl;
+  }
+
   // Configure the fuel client
   fuel_tools::ClientConfig config;
   if (!_config.ResourceCache().empty())
@@ -78,7 +127,10 @@ Server::Server(const ServerConfig &_config)
   addResourcePaths();
 
   // Loads the SDF root object based on values in a ServerConfig object.
+  auto phaseStart = std::chrono::steady_clock::now();
   sdf::Errors errors = this->dataPtr->LoadSdfRootHelper(_config);
+  this->dataPtr->RecordStartupPhase("load_sdf",
+      std::chrono::steady_clock::now() - phaseStart);
 
   if (!errors.empty())
   {
@@ -102,7 +154,14 @@ Server::Server(const ServerConfig &_config)
   if (this->dataPtr->signalReceived)
     return;
 
+  phaseStart = std::chrono::steady_clock::now();
   this->dataPtr->CreateEntities();
+  this->dataPtr->RecordStartupPhase("create_entities",
+      std::chrono::steady_clock::now() - phaseStart);
+
+  // Cover mappings created while loading entities and meshes.
+  if (_config.UseHugePages())
+    applyHugePagePolicy();
 
   // Set the desired update period, this will override the desired RTF given in
   // the world file which was parsed by CreateEntities.
@@ -112,7 +171,12 @@ Server::Server(const ServerConfig &_config)
   }
 
   // Establish publishers and subscribers.
+  phaseStart = std::chrono::steady_clock::now();
   this->dataPtr->SetupTransport();
+  this->dataPtr->RecordStartupPhase("setup_transport",
+      std::chrono::steady_clock::now() - phaseStart);
+
+  this->dataPtr->WriteStartupReport();
 }
 
 /////////////////////////////////////////////////
@@ -177,6 +241,72 @@ bool Server::RunOnce(const bool _paused)
   return this->Run(true, 1, _paused);
 }
 
+/////////////////////////////////////////////////
+bool Server::RunBatch(const uint64_t _iterations,
+    const uint64_t _callbackInterval,
+    const std::function<bool(uint64_t)> &_callback)
+{
+  if (0 == _iterations)
+  {
+    gzerr << "RunBatch requires at least one iteration.\n";
+    return false;
+  }
+
+  // Check the current state, and return early if preconditions are not met.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->runMutex);
+    if (!this->dataPtr->sigHandler.Initialized())
+    {
+      gzerr << "Signal handlers were not created. The server won't run.\n";
+      return false;
+    }
+
+    // Do not allow running more than once.
+    if (this->dataPtr->running)
+    {
+      gzwarn << "The server is already running.\n";
+      return false;
+    }
+
+    if (this->dataPtr->simRunners.size() != 1 ||
+        this->dataPtr->config.UseDistributedSimulation())
+    {
+      gzerr << "RunBatch requires a single world and no distributed "
+            << "simulation.\n";
+      return false;
+    }
+
+    this->dataPtr->running = true;
+  }
+
+  auto &runner = this->dataPtr->simRunners.front();
+  runner->SetPaused(false);
+
+  // The batch executes as chunks of the callback interval so there are no
+  // thread or condition-variable handshakes between steps.
+  const uint64_t chunk =
+      (_callbackInterval == 0 || nullptr == _callback) ?
+      _iterations : _callbackInterval;
+
+  bool result = true;
+  uint64_t executed{0u};
+  while (executed < _iterations && !this->dataPtr->signalReceived)
+  {
+    const uint64_t batch = std::min(chunk, _iterations - executed);
+    result = runner->Run(batch) && result;
+    executed += batch;
+
+    if (runner->StopReceived())
+      break;
+
+    if (_callback && !_callback(executed))
+      break;
+  }
+
+  this->dataPtr->running = false;
+  return result;
+}
+
 /////////////////////////////////////////////////
 void Server::SetUpdatePeriod(
     const std::chrono::steady_clock::duration &_updatePeriod,
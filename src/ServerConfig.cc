@@ -194,6 +194,12 @@ class gz::sim::ServerConfigPrivate
             updateRate(_cfg->updateRate),
             initialSimTime(_cfg->initialSimTime),
             useLevels(_cfg->useLevels),
+            useAsyncPostUpdate(_cfg->useAsyncPostUpdate),
+            deterministic(_cfg->deterministic),
+            useWorldCache(_cfg->useWorldCache),
+            useDeltaReset(_cfg->useDeltaReset),
+            cpuAffinity(_cfg->cpuAffinity),
+            threadPolicies(_cfg->threadPolicies),
             useLogRecord(_cfg->useLogRecord),
             logRecordPath(_cfg->logRecordPath),
             logRecordPeriod(_cfg->logRecordPeriod),
@@ -212,6 +218,9 @@ class gz::sim::ServerConfigPrivate
             seed(_cfg->seed),
             logRecordTopics(_cfg->logRecordTopics),
             isHeadlessRendering(_cfg->isHeadlessRendering),
+            skipSceneComponents(_cfg->skipSceneComponents),
+            useHugePages(_cfg->useHugePages),
+            prefaultMemory(_cfg->prefaultMemory),
             source(_cfg->source),
             behaviorOnSdfErrors(_cfg->behaviorOnSdfErrors){ }
 
@@ -230,6 +239,25 @@ class gz::sim::ServerConfigPrivate
   /// \brief Use the level system
   public: bool useLevels{false};
 
+  /// \brief Run PostUpdate systems asynchronously against a snapshot
+  public: bool useAsyncPostUpdate{false};
+
+  /// \brief Force stable serial orderings on the parallel execution paths
+  public: bool deterministic{false};
+
+  /// \brief Cache resolved worlds on disk and reuse them across starts
+  public: bool useWorldCache{false};
+
+  /// \brief Apply world resets as journaled deltas instead of full copies
+  public: bool useDeltaReset{false};
+
+  /// \brief CPUs the simulation threads are pinned to, empty for no pinning
+  public: std::vector<unsigned int> cpuAffinity;
+
+  /// \brief Per-category thread policies
+  public: std::map<ServerConfig::ThreadCategory, ServerConfig::ThreadPolicy>
+      threadPolicies;
+
   /// \brief Use the logging system to record states
   public: bool useLogRecord{false};
 
@@ -292,6 +320,16 @@ class gz::sim::ServerConfigPrivate
   /// \brief is the headless mode active.
   public: bool isHeadlessRendering{false};
 
+  /// \brief True if render-only components should be skipped.
+  public: bool skipSceneComponents{false};
+
+  /// \brief True if large allocations should be backed by transparent
+  /// huge pages.
+  public: bool useHugePages{false};
+
+  /// \brief True if memory should be prefaulted during load.
+  public: bool prefaultMemory{false};
+
   /// \brief Optional SDF root object.
   public: std::optional<sdf::Root> sdfRoot;
 
@@ -404,6 +442,80 @@ void ServerConfig::SetUseLevels(const bool _levels)
   this->dataPtr->useLevels = _levels;
 }
 
+/////////////////////////////////////////////////
+bool ServerConfig::UseAsyncPostUpdate() const
+{
+  return this->dataPtr->useAsyncPostUpdate;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseAsyncPostUpdate(bool _async)
+{
+  this->dataPtr->useAsyncPostUpdate = _async;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseWorldCache() const
+{
+  return this->dataPtr->useWorldCache;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseWorldCache(bool _cache)
+{
+  this->dataPtr->useWorldCache = _cache;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseDeltaReset() const
+{
+  return this->dataPtr->useDeltaReset;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseDeltaReset(bool _delta)
+{
+  this->dataPtr->useDeltaReset = _delta;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::Deterministic() const
+{
+  return this->dataPtr->deterministic;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetDeterministic(bool _deterministic)
+{
+  this->dataPtr->deterministic = _deterministic;
+}
+
+/////////////////////////////////////////////////
+const std::vector<unsigned int> &ServerConfig::CpuAffinity() const
+{
+  return this->dataPtr->cpuAffinity;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetCpuAffinity(const std::vector<unsigned int> &_cpus)
+{
+  this->dataPtr->cpuAffinity = _cpus;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetThreadPolicy(ThreadCategory _category,
+    const ThreadPolicy &_policy)
+{
+  this->dataPtr->threadPolicies[_category] = _policy;
+}
+
+/////////////////////////////////////////////////
+const std::map<ServerConfig::ThreadCategory, ServerConfig::ThreadPolicy>
+    &ServerConfig::ThreadPolicies() const
+{
+  return this->dataPtr->threadPolicies;
+}
+
 /////////////////////////////////////////////////
 void ServerConfig::SetNetworkSecondaries(unsigned int _secondaries)
 {
@@ -583,6 +695,42 @@ bool ServerConfig::HeadlessRendering() const
   return this->dataPtr->isHeadlessRendering;
 }
 
+/////////////////////////////////////////////////
+void ServerConfig::SetSkipSceneComponents(const bool _skip)
+{
+  this->dataPtr->skipSceneComponents = _skip;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::SkipSceneComponents() const
+{
+  return this->dataPtr->skipSceneComponents;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseHugePages(const bool _hugePages)
+{
+  this->dataPtr->useHugePages = _hugePages;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseHugePages() const
+{
+  return this->dataPtr->useHugePages;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetPrefaultMemory(const bool _prefault)
+{
+  this->dataPtr->prefaultMemory = _prefault;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::PrefaultMemory() const
+{
+  return this->dataPtr->prefaultMemory;
+}
+
 /////////////////////////////////////////////////
 const std::string &ServerConfig::RenderEngineGui() const
 {
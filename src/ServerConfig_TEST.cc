@@ -261,3 +261,92 @@ TEST(ServerConfig, SdfRoot)
   EXPECT_TRUE(config.SdfString().empty());
   EXPECT_EQ(ServerConfig::SourceType::kSdfRoot, config.Source());
 }
+
+//////////////////////////////////////////////////
+TEST(ServerConfig, CpuAffinity)
+{
+  ServerConfig config;
+  EXPECT_TRUE(config.CpuAffinity().empty());
+
+  config.SetCpuAffinity({0u, 2u, 4u});
+  ASSERT_EQ(3u, config.CpuAffinity().size());
+  EXPECT_EQ(0u, config.CpuAffinity()[0]);
+  EXPECT_EQ(2u, config.CpuAffinity()[1]);
+  EXPECT_EQ(4u, config.CpuAffinity()[2]);
+
+  // The copy constructor carries the affinity along
+  ServerConfig copy(config);
+  EXPECT_EQ(config.CpuAffinity(), copy.CpuAffinity());
+}
+
+//////////////////////////////////////////////////
+TEST(ServerConfig, MemoryPolicy)
+{
+  ServerConfig config;
+  EXPECT_FALSE(config.UseHugePages());
+  EXPECT_FALSE(config.PrefaultMemory());
+
+  config.SetUseHugePages(true);
+  config.SetPrefaultMemory(true);
+  EXPECT_TRUE(config.UseHugePages());
+  EXPECT_TRUE(config.PrefaultMemory());
+
+  ServerConfig copy(config);
+  EXPECT_TRUE(copy.UseHugePages());
+  EXPECT_TRUE(copy.PrefaultMemory());
+}
+
+//////////////////////////////////////////////////
+TEST(ServerConfig, DeltaReset)
+{
+  ServerConfig config;
+  EXPECT_FALSE(config.UseDeltaReset());
+
+  config.SetUseDeltaReset(true);
+  EXPECT_TRUE(config.UseDeltaReset());
+
+  ServerConfig copy(config);
+  EXPECT_TRUE(copy.UseDeltaReset());
+}
+
+//////////////////////////////////////////////////
+TEST(ServerConfig, ThreadPolicies)
+{
+  ServerConfig config;
+  EXPECT_TRUE(config.ThreadPolicies().empty());
+
+  ServerConfig::ThreadPolicy stepPolicy;
+  stepPolicy.name = "gz-step";
+  stepPolicy.cpus = {1u, 3u};
+  stepPolicy.schedulingClass = "fifo";
+  stepPolicy.priority = 10;
+  config.SetThreadPolicy(ServerConfig::ThreadCategory::Step, stepPolicy);
+
+  ServerConfig::ThreadPolicy renderPolicy;
+  renderPolicy.name = "gz-render";
+  config.SetThreadPolicy(ServerConfig::ThreadCategory::SensorsRender,
+      renderPolicy);
+
+  ASSERT_EQ(2u, config.ThreadPolicies().size());
+  auto iter = config.ThreadPolicies().find(
+      ServerConfig::ThreadCategory::Step);
+  ASSERT_NE(config.ThreadPolicies().end(), iter);
+  EXPECT_EQ("gz-step", iter->second.name);
+  ASSERT_EQ(2u, iter->second.cpus.size());
+  EXPECT_EQ(3u, iter->second.cpus[1]);
+  EXPECT_EQ("fifo", iter->second.schedulingClass);
+  EXPECT_EQ(10, iter->second.priority);
+
+  // Setting a category again replaces its policy
+  stepPolicy.priority = 5;
+  config.SetThreadPolicy(ServerConfig::ThreadCategory::Step, stepPolicy);
+  ASSERT_EQ(2u, config.ThreadPolicies().size());
+  EXPECT_EQ(5, config.ThreadPolicies().at(
+      ServerConfig::ThreadCategory::Step).priority);
+
+  // The copy constructor carries the policies along
+  ServerConfig copy(config);
+  ASSERT_EQ(2u, copy.ThreadPolicies().size());
+  EXPECT_EQ("gz-render", copy.ThreadPolicies().at(
+      ServerConfig::ThreadCategory::SensorsRender).name);
+}
@@ -19,18 +19,30 @@
 
 #include <tinyxml2.h>
 
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/server_control.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/stringmsg_v.pb.h>
 
+#include <sdf/Element.hh>
 #include <sdf/Root.hh>
 #include <sdf/World.hh>
 
 #include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
 
 #include <gz/fuel_tools/Interface.hh>
@@ -200,16 +212,25 @@ bool ServerPrivate::Run(const uint64_t _iterations,
   }
   else
   {
+    // One worker per world; each runner paces itself against its own
+    // world's real time factor, so none of them may wait on a shared
+    // thread with another world.
+    if (!this->workerPool)
+    {
+      this->workerPool = std::make_unique<common::WorkerPool>(
+          static_cast<unsigned int>(this->simRunners.size()));
+    }
+
     for (std::unique_ptr<SimulationRunner> &runner : this->simRunners)
     {
-      this->workerPool.AddWork([&runner, &_iterations] ()
+      this->workerPool->AddWork([&runner, &_iterations] ()
         {
           runner->Run(_iterations);
         });
     }
 
     // Wait for the runner to complete.
-    result = this->workerPool.WaitForResults();
+    result = this->workerPool->WaitForResults();
   }
 
   // See comments ServerPrivate::Stop() for why we lock this mutex here.
@@ -321,13 +342,97 @@ void ServerPrivate::CreateEntities()
       std::lock_guard<std::mutex> lock(this->worldsMutex);
       this->worldNames.push_back(world->Name());
     }
+    const auto worldStart = std::chrono::steady_clock::now();
     auto runner = std::make_unique<SimulationRunner>(
         *world, this->systemLoader, this->config);
     runner->SetFuelUriMap(this->fuelUriMap);
     this->simRunners.push_back(std::move(runner));
+    this->RecordStartupPhase("create_world:" + world->Name(),
+        std::chrono::steady_clock::now() - worldStart);
   }
 }
 
+//////////////////////////////////////////////////
+void ServerPrivate::RecordStartupPhase(const std::string &_name,
+    const std::chrono::steady_clock::duration &_duration)
+{
+  this->startupPhases.emplace_back(_name, _duration);
+}
+
+//////////////////////////////////////////////////
+void ServerPrivate::WriteStartupReport() const
+{
+  auto toMs = [](const std::chrono::steady_clock::duration &_d) -> double
+  {
+    return std::chrono::duration<double, std::milli>(_d).count();
+  };
+
+  double totalMs{0.0};
+  for (const auto &[name, duration] : this->startupPhases)
+  {
+    // Per-world creation time is part of the create_entities phase, don't
+    // count it twice.
+    if (name.compare(0, 13, "create_world:") != 0)
+      totalMs += toMs(duration);
+  }
+
+  gzdbg << "Server startup took " << totalMs << " ms, of which "
+         << toMs(this->fetchResourceTime) << " ms fetching "
+         << this->fetchResourceCount << " resources." << std::endl;
+
+  std::string reportPath;
+  common::env("GZ_SIM_STARTUP_REPORT", reportPath);
+  if (reportPath.empty())
+    return;
+
+  std::ofstream report(reportPath);
+  if (!report)
+  {
+    gzerr << "Failed to open startup report file [" << reportPath << "]"
+           << std::endl;
+    return;
+  }
+
+  report << "{\n"
+         << "  \"total_ms\": " << totalMs << ",\n"
+         << "  \"resource_fetch_ms\": " << toMs(this->fetchResourceTime)
+         << ",\n"
+         << "  \"resource_fetch_count\": " << this->fetchResourceCount
+         << ",\n"
+         << "  \"phases\": [\n";
+
+  for (std::size_t i = 0; i < this->startupPhases.size(); ++i)
+  {
+    report << "    {\"name\": \"" << this->startupPhases[i].first
+           << "\", \"ms\": " << toMs(this->startupPhases[i].second) << "}"
+           << (i + 1 < this->startupPhases.size() ? "," : "") << "\n";
+  }
+
+  report << "  ],\n"
+         << "  \"system_configure\": [\n";
+
+  std::vector<std::string> rows;
+  std::size_t worldIndex{0};
+  for (const auto &runner : this->simRunners)
+  {
+    for (const auto &[system, duration] : runner->SystemConfigureTimings())
+    {
+      std::ostringstream row;
+      row << "    {\"world\": \"" << this->worldNames[worldIndex]
+          << "\", \"system\": \"" << system
+          << "\", \"ms\": " << toMs(duration) << "}";
+      rows.push_back(row.str());
+    }
+    worldIndex++;
+  }
+  for (std::size_t i = 0; i < rows.size(); ++i)
+    report << rows[i] << (i + 1 < rows.size() ? "," : "") << "\n";
+
+  report << "  ]\n}\n";
+
+  gzmsg << "Wrote startup report to [" << reportPath << "]" << std::endl;
+}
+
 //////////////////////////////////////////////////
 void ServerPrivate::SetupTransport()
 {
@@ -572,6 +677,125 @@ bool ServerPrivate::ResourcePathsResolveService(
   return false;
 }
 
+//////////////////////////////////////////////////
+namespace
+{
+/// \brief Collect the contents of <uri> elements in raw SDF text. This is
+/// a plain string scan, not a parse: it is used to discover remote
+/// resources before the SDF DOM is built.
+/// \param[in] _content Raw SDF text.
+/// \return The URIs found, in document order, untrimmed entries skipped.
+std::vector<std::string> ExtractResourceUris(const std::string &_content)
+{
+  std::vector<std::string> uris;
+  std::size_t pos = 0;
+  while ((pos = _content.find("<uri>", pos)) != std::string::npos)
+  {
+    pos += 5;
+    const auto end = _content.find("</uri>", pos);
+    if (end == std::string::npos)
+      break;
+    const std::string uri = common::trimmed(_content.substr(pos, end - pos));
+    if (!uri.empty())
+      uris.push_back(uri);
+    pos = end + 6;
+  }
+  return uris;
+}
+
+/// \brief Whether a URI points at a remote resource worth prefetching.
+/// \param[in] _uri Candidate URI.
+/// \return True for http(s) URIs.
+bool IsRemoteUri(const std::string &_uri)
+{
+  return _uri.rfind("http://", 0) == 0 || _uri.rfind("https://", 0) == 0;
+}
+}
+
+//////////////////////////////////////////////////
+void ServerPrivate::PrefetchResources(const std::string &_sdfContent)
+{
+  // Seed with the URIs referenced by the world itself. Each fetched model
+  // is scanned for nested references, so the whole dependency tree
+  // downloads in parallel waves instead of one resource at a time as the
+  // parser encounters them.
+  std::vector<std::string> pending;
+  std::unordered_set<std::string> visited;
+  for (const auto &uri : ExtractResourceUris(_sdfContent))
+  {
+    if (IsRemoteUri(uri) && visited.insert(uri).second)
+      pending.push_back(uri);
+  }
+  if (pending.empty())
+    return;
+
+  gzmsg << "Prefetching " << pending.size()
+        << " remote resources before parsing." << std::endl;
+
+  fuel_tools::ClientConfig clientConfig;
+  if (!this->config.ResourceCache().empty())
+    clientConfig.SetCacheLocation(this->config.ResourceCache());
+
+  // Cap the number of concurrent downloads.
+  constexpr std::size_t kMaxConcurrentFetches = 8;
+
+  const auto fetchStart = std::chrono::steady_clock::now();
+  while (!pending.empty())
+  {
+    std::vector<std::string> wave = std::move(pending);
+    pending.clear();
+
+    for (std::size_t first = 0; first < wave.size();
+         first += kMaxConcurrentFetches)
+    {
+      const std::size_t last =
+          std::min(first + kMaxConcurrentFetches, wave.size());
+      std::vector<std::future<std::string>> fetches;
+      for (std::size_t i = first; i < last; ++i)
+      {
+        fetches.push_back(std::async(std::launch::async,
+            [uri = wave[i], &clientConfig]()
+            {
+              // Each task uses its own client; the cache directory is
+              // shared but distinct resources land in distinct
+              // directories.
+              fuel_tools::FuelClient client(clientConfig);
+              return fuel_tools::fetchResourceWithClient(uri, client);
+            }));
+      }
+
+      for (std::size_t i = first; i < last; ++i)
+      {
+        const std::string path = fetches[i - first].get();
+        if (path.empty())
+          continue;
+        this->fuelUriMap[path] = wave[i];
+        this->fetchResourceCount++;
+
+        // Scan the fetched model's SDF files for nested references.
+        std::error_code ec;
+        if (!std::filesystem::is_directory(path, ec) || ec)
+          continue;
+        for (std::filesystem::recursive_directory_iterator it(path, ec),
+             endIt; !ec && it != endIt; it.increment(ec))
+        {
+          if (!it->is_regular_file(ec) || it->path().extension() != ".sdf")
+            continue;
+          std::ifstream nested(it->path());
+          std::stringstream content;
+          content << nested.rdbuf();
+          for (const auto &uri : ExtractResourceUris(content.str()))
+          {
+            if (IsRemoteUri(uri) && visited.insert(uri).second)
+              pending.push_back(uri);
+          }
+        }
+      }
+    }
+  }
+  this->fetchResourceTime += std::chrono::steady_clock::now() - fetchStart;
+}
+
 //////////////////////////////////////////////////
 std::string ServerPrivate::FetchResource(const std::string &_uri)
 {
@@ -581,8 +805,11 @@ std::string ServerPrivate::FetchResource(const std::string &_uri)
     return _uri;
 
   // Fetch resource from fuel
+  const auto fetchStart = std::chrono::steady_clock::now();
   auto path =
       fuel_tools::fetchResourceWithClient(_uri, *this->fuelClient.get());
+  this->fetchResourceTime += std::chrono::steady_clock::now() - fetchStart;
+  this->fetchResourceCount++;
 
   if (!path.empty())
   {
@@ -601,6 +828,74 @@ std::string ServerPrivate::FetchResourceUri(const common::URI &_uri)
   return this->FetchResource(_uri.Str());
 }
 
+namespace
+{
+/// \brief FNV-1a hash of a world file's contents, mixed with the gz-sim
+/// version so cached resolved worlds are never shared across releases.
+/// \param[in] _path File to hash.
+/// \return The hash, or nullopt if the file could not be read.
+std::optional<uint64_t> HashWorldFile(const std::string &_path)
+{
+  std::ifstream file(_path, std::ios::in | std::ios::binary);
+  if (!file.is_open())
+    return std::nullopt;
+
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&hash](const char *_data, std::size_t _len)
+  {
+    for (std::size_t i = 0; i < _len; ++i)
+    {
+      hash ^= static_cast<unsigned char>(_data[i]);
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  const std::string version{GZ_SIM_VERSION_FULL};
+  mix(version.data(), version.size());
+
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+    mix(buffer, static_cast<std::size_t>(file.gcount()));
+  return hash;
+}
+
+/// \brief Path of the resolved-world cache entry for a world file,
+/// creating the cache directory if needed. The cache directory comes from
+/// GZ_SIM_WORLD_CACHE_DIR, falling back to $HOME/.gz/sim/world_cache.
+/// \param[in] _worldPath Resolved world file path.
+/// \return The entry path, or an empty string if the cache is unusable.
+std::string WorldCacheEntryPath(const std::string &_worldPath)
+{
+  std::string cacheDir;
+  if (!common::env("GZ_SIM_WORLD_CACHE_DIR", cacheDir) || cacheDir.empty())
+  {
+    std::string home;
+    if (!common::env(GZ_HOMEDIR, home) || home.empty())
+    {
+      gzwarn << "World cache disabled: no GZ_SIM_WORLD_CACHE_DIR and no "
+             << "home directory." << std::endl;
+      return std::string();
+    }
+    cacheDir = common::joinPaths(home, ".gz", "sim", "world_cache");
+  }
+
+  if (!common::exists(cacheDir) && !common::createDirectories(cacheDir))
+  {
+    gzwarn << "World cache disabled: failed to create cache directory ["
+           << cacheDir << "]." << std::endl;
+    return std::string();
+  }
+
+  auto hash = HashWorldFile(_worldPath);
+  if (!hash.has_value())
+    return std::string();
+
+  std::ostringstream name;
+  name << std::hex << std::setfill('0') << std::setw(16) << *hash;
+  return common::joinPaths(cacheDir, name.str() + ".sdf");
+}
+}
+
 //////////////////////////////////////////////////
 sdf::Errors ServerPrivate::LoadSdfRootHelper(const ServerConfig &_config)
 {
@@ -635,6 +930,7 @@ sdf::Errors ServerPrivate::LoadSdfRootHelper(const ServerConfig &_config)
         msg += "File path [" + _config.SdfFile() + "].\n";
       }
       gzmsg << msg;
+      this->PrefetchResources(_config.SdfString());
       errors = this->sdfRoot.LoadSdfString(
         _config.SdfString(), sdfParserConfig);
       this->sdfRoot.ResolveAutoInertials(errors, sdfParserConfig);
@@ -657,6 +953,59 @@ sdf::Errors ServerPrivate::LoadSdfRootHelper(const ServerConfig &_config)
 
       gzmsg << "Loading SDF world file[" << filePath << "].\n";
 
+      // Resolved-world cache: when the world file is unchanged, parse the
+      // flattened DOM written by a previous server instead of resolving
+      // includes and fetching resources again.
+      std::string worldCacheEnv;
+      common::env("GZ_SIM_WORLD_CACHE", worldCacheEnv);
+      const bool worldCacheEnabled =
+          _config.UseWorldCache() || worldCacheEnv == "1";
+      std::string worldCachePath;
+      if (worldCacheEnabled)
+      {
+        worldCachePath = WorldCacheEntryPath(filePath);
+        if (!worldCachePath.empty() && common::exists(worldCachePath))
+        {
+          std::ifstream cached(worldCachePath,
+              std::ios::in | std::ios::binary);
+          std::stringstream cachedStr;
+          cachedStr << cached.rdbuf();
+          if (cached)
+          {
+            errors = this->sdfRoot.LoadSdfString(cachedStr.str(),
+                sdfParserConfig);
+            if (errors.empty())
+            {
+              gzmsg << "Loaded resolved world from cache ["
+                    << worldCachePath << "].\n";
+              this->sdfRoot.ResolveAutoInertials(errors, sdfParserConfig);
+              break;
+            }
+            // A stale or corrupt entry falls back to a fresh load.
+            gzwarn << "Discarding unreadable world cache entry ["
+                   << worldCachePath << "]." << std::endl;
+            this->sdfRoot = sdf::Root();
+            errors.clear();
+          }
+        }
+      }
+
+      // Download the remote resources the world references in parallel
+      // waves before parsing, so the blocking fetches the parser issues
+      // below hit a warm cache.
+      {
+        std::ifstream worldFile(filePath, std::ios::in | std::ios::binary);
+        std::stringstream worldContent;
+        worldContent << worldFile.rdbuf();
+        if (worldFile)
+        {
+          const auto prefetchStart = std::chrono::steady_clock::now();
+          this->PrefetchResources(worldContent.str());
+          this->RecordStartupPhase("prefetch_resources",
+              std::chrono::steady_clock::now() - prefetchStart);
+        }
+      }
+
       sdf::Root sdfRootLocal;
       // \todo(nkoenig) Async resource download.
       // This call can block for a long period of time while
@@ -694,6 +1043,22 @@ sdf::Errors ServerPrivate::LoadSdfRootHelper(const ServerConfig &_config)
       }
 
       this->sdfRoot.ResolveAutoInertials(errors, sdfParserConfig);
+
+      // Persist the flattened DOM, with includes expanded, URIs resolved
+      // and auto inertials computed, for the next server start.
+      if (worldCacheEnabled && !worldCachePath.empty() && errors.empty() &&
+          this->sdfRoot.WorldCount() > 0u &&
+          nullptr != this->sdfRoot.Element())
+      {
+        std::ofstream cached(worldCachePath,
+            std::ios::out | std::ios::binary | std::ios::trunc);
+        if (cached)
+        {
+          cached << this->sdfRoot.Element()->ToString("");
+          gzdbg << "Wrote resolved world cache entry [" << worldCachePath
+                 << "]." << std::endl;
+        }
+      }
       break;
     }
 
@@ -23,6 +23,7 @@
 #include <gz/msgs/stringmsg_v.pb.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -105,6 +106,28 @@ namespace gz
       /// \return Set of SDF errors.
       public: sdf::Errors LoadSdfRootHelper(const ServerConfig &_config);
 
+      /// \brief Scan raw SDF text for remote resource URIs and download
+      /// them concurrently before the SDF DOM is built. Fetched models are
+      /// scanned for nested references, so the whole dependency tree is
+      /// downloaded in parallel waves; the fetches the parser issues later
+      /// then hit a warm cache.
+      /// \param[in] _sdfContent Raw SDF text of the world.
+      public: void PrefetchResources(const std::string &_sdfContent);
+
+      /// \brief Record the wall-clock duration of a named startup phase.
+      /// \param[in] _name Phase name, e.g. "load_sdf".
+      /// \param[in] _duration Wall-clock duration of the phase.
+      public: void RecordStartupPhase(const std::string &_name,
+                  const std::chrono::steady_clock::duration &_duration);
+
+      /// \brief Write a machine-readable report of where startup time went:
+      /// phase durations, per-world creation time, every system's Configure
+      /// duration and the accumulated resource fetch wait. The report is a
+      /// JSON document written to the path in the GZ_SIM_STARTUP_REPORT
+      /// environment variable; when the variable is unset only a one-line
+      /// summary is logged.
+      public: void WriteStartupReport() const;
+
       /// \brief Signal handler callback
       /// \param[in] _sig The signal number
       private: void OnSignal(int _sig);
@@ -153,8 +176,10 @@ namespace gz
       private: bool ServerControlService(
         const gz::msgs::ServerControl &_req, msgs::Boolean &_res);
 
-      /// \brief A pool of worker threads.
-      public: common::WorkerPool workerPool{2};
+      /// \brief A pool of worker threads used to step multiple worlds
+      /// concurrently. Created on demand in Run with one thread per
+      /// simulation runner so the worlds don't queue behind each other.
+      public: std::unique_ptr<common::WorkerPool> workerPool;
 
       /// \brief All the simulation runners.
       public: std::vector<std::unique_ptr<SimulationRunner>> simRunners;
@@ -197,6 +222,19 @@ namespace gz
       /// Server. It is used in the SDFormat world generator when saving worlds
       public: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Named startup phases and their durations, in the order
+      /// they were recorded
+      public: std::vector<std::pair<std::string,
+          std::chrono::steady_clock::duration>> startupPhases;
+
+      /// \brief Accumulated wall time spent fetching remote resources,
+      /// including resources that were already cached
+      public: std::chrono::steady_clock::duration fetchResourceTime{
+          std::chrono::steady_clock::duration::zero()};
+
+      /// \brief Number of resource URIs that have been fetched
+      public: uint64_t fetchResourceCount{0};
+
       /// \brief Gazebo classic material URI string
       /// A URI matching this string indicates that it is a gazebo classic
       /// material.
@@ -540,6 +540,47 @@ TEST_P(ServerFixture, RunBlocking)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, RunBatch)
+{
+  sim::Server server;
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+  EXPECT_EQ(0u, server.IterationCount());
+
+  // Make the server run fast.
+  server.SetUpdatePeriod(1ns);
+
+  // Zero iterations is rejected
+  EXPECT_FALSE(server.RunBatch(0));
+
+  // A batch without a callback runs to completion
+  EXPECT_TRUE(server.RunBatch(100));
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(100u, *server.IterationCount());
+
+  // The callback is invoked every interval, and once after the final step
+  std::vector<uint64_t> calls;
+  EXPECT_TRUE(server.RunBatch(100, 25,
+      [&calls](uint64_t _executed) -> bool
+      {
+        calls.push_back(_executed);
+        return true;
+      }));
+  EXPECT_EQ(200u, *server.IterationCount());
+  ASSERT_EQ(4u, calls.size());
+  EXPECT_EQ(25u, calls[0]);
+  EXPECT_EQ(100u, calls[3]);
+
+  // Returning false from the callback ends the batch early
+  EXPECT_TRUE(server.RunBatch(100, 10,
+      [](uint64_t) -> bool
+      {
+        return false;
+      }));
+  EXPECT_EQ(210u, *server.IterationCount());
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, RunNonBlockingPaused)
 {
@@ -0,0 +1,438 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_SHMSTATECHANNEL_HH_
+#define GZ_SIM_SHMSTATECHANNEL_HH_
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define GZ_SIM_SHM_STATE_AVAILABLE 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+/// \brief Internal shared memory channel carrying the latest serialized
+/// state snapshot between a server and GUIs on the same host, so state
+/// sync skips the transport loopback for the common single-host case.
+///
+/// The segment holds one slot guarded by a sequence lock: the writer
+/// overwrites the slot in place and readers retry if a write raced their
+/// copy, so neither side ever blocks the other. Readers poll at their own
+/// rate and publish a heartbeat so the writer can tell whether serializing
+/// a snapshot is worth the effort. Unsupported platforms compile to inert
+/// objects and callers fall back to transport.
+///
+/// This is an internal header; the wire format may change between
+/// releases and both sides are expected to come from the same build.
+
+/// \brief Control block at the start of the shared segment.
+struct ShmStateHeader
+{
+  /// \brief Set last during initialization so readers never see a
+  /// half-built segment.
+  std::atomic<uint64_t> magic;
+
+  /// \brief Payload capacity in bytes. Grows when a snapshot outgrows the
+  /// segment; readers remap when it differs from what they mapped.
+  std::atomic<uint64_t> capacity;
+
+  /// \brief Sequence lock; odd while a write is in flight.
+  std::atomic<uint64_t> writing;
+
+  /// \brief Sequence number of the latest complete snapshot.
+  std::atomic<uint64_t> seq;
+
+  /// \brief Size in bytes of the latest snapshot.
+  std::atomic<uint64_t> size;
+
+  /// \brief Steady clock nanoseconds of the most recent reader poll.
+  std::atomic<int64_t> readerHeartbeat;
+};
+
+/// \brief Expected value of ShmStateHeader::magic ("GZSIMST1").
+static constexpr uint64_t kShmStateMagic = 0x475a53494d535431ULL;
+
+/// \brief A reader is considered live if it polled within this window.
+static constexpr std::chrono::seconds kShmReaderTimeout{5};
+
+/// \brief Build the shared memory object name for a world.
+/// \param[in] _worldName World name; characters that are not portable in
+/// shm object names are replaced.
+/// \return Name starting with '/' as required by shm_open.
+inline std::string ShmStateName(const std::string &_worldName)
+{
+  std::string name = "/gz-sim-state-" + _worldName;
+  // Keep the leading '/', sanitize the rest.
+  for (std::size_t i = 1; i < name.size(); ++i)
+  {
+    if (!isalnum(static_cast<unsigned char>(name[i])) &&
+        name[i] != '-' && name[i] != '_')
+    {
+      name[i] = '_';
+    }
+  }
+  return name;
+}
+
+/// \brief Writer side of the channel, owned by the server. Creates the
+/// segment on Open and unlinks it on destruction.
+class ShmStateWriter
+{
+  /// \brief Destructor, unlinks the segment.
+  public: ~ShmStateWriter()
+  {
+    this->Close();
+  }
+
+  /// \brief Create the segment for a world.
+  /// \param[in] _worldName World name used to derive the segment name.
+  /// \return True if the segment is ready for writing.
+  public: bool Open(const std::string &_worldName)
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    this->name = ShmStateName(_worldName);
+    // A stale segment from a crashed server is re-initialized in place.
+    this->fd = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (this->fd < 0)
+      return false;
+    if (!this->Resize(this->kInitialCapacity))
+    {
+      this->Close();
+      return false;
+    }
+    auto *header = this->Header();
+    header->capacity.store(this->capacity, std::memory_order_relaxed);
+    header->writing.store(0u, std::memory_order_relaxed);
+    header->seq.store(0u, std::memory_order_relaxed);
+    header->size.store(0u, std::memory_order_relaxed);
+    header->readerHeartbeat.store(0, std::memory_order_relaxed);
+    header->magic.store(kShmStateMagic, std::memory_order_release);
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /// \brief Get whether the segment is open.
+  public: bool Valid() const
+  {
+    return nullptr != this->mem;
+  }
+
+  /// \brief Get whether a reader polled the segment recently. Serializing
+  /// a snapshot nobody maps is wasted work, so callers should check this
+  /// first.
+  public: bool HasActiveReader() const
+  {
+    if (!this->Valid())
+      return false;
+    auto heartbeat = this->Header()->readerHeartbeat.load(
+        std::memory_order_relaxed);
+    if (0 == heartbeat)
+      return false;
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return now - std::chrono::nanoseconds(heartbeat) < kShmReaderTimeout;
+  }
+
+  /// \brief Publish a snapshot, growing the segment if needed.
+  /// \param[in] _data Serialized snapshot.
+  /// \return True if the snapshot was written.
+  public: bool Write(const std::string &_data)
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    if (!this->Valid())
+      return false;
+    if (_data.size() > this->capacity)
+    {
+      if (!this->Resize(_data.size() * 2u))
+        return false;
+      this->Header()->capacity.store(this->capacity,
+          std::memory_order_release);
+    }
+    auto *header = this->Header();
+    header->writing.fetch_add(1u, std::memory_order_acq_rel);
+    std::memcpy(this->Payload(), _data.data(), _data.size());
+    header->size.store(_data.size(), std::memory_order_release);
+    header->seq.fetch_add(1u, std::memory_order_release);
+    header->writing.fetch_add(1u, std::memory_order_release);
+    return true;
+#else
+    (void)_data;
+    return false;
+#endif
+  }
+
+  /// \brief Unmap and unlink the segment.
+  public: void Close()
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    if (this->mem)
+    {
+      munmap(this->mem, sizeof(ShmStateHeader) + this->capacity);
+      this->mem = nullptr;
+    }
+    if (this->fd >= 0)
+    {
+      close(this->fd);
+      this->fd = -1;
+      shm_unlink(this->name.c_str());
+    }
+#endif
+  }
+
+  /// \brief Grow the segment and remap it.
+  /// \param[in] _capacity New payload capacity in bytes.
+  /// \return True on success.
+  private: bool Resize(uint64_t _capacity)
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    const auto totalSize = sizeof(ShmStateHeader) + _capacity;
+    if (ftruncate(this->fd, static_cast<off_t>(totalSize)) != 0)
+      return false;
+    if (this->mem)
+      munmap(this->mem, sizeof(ShmStateHeader) + this->capacity);
+    this->mem = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED, this->fd, 0);
+    if (MAP_FAILED == this->mem)
+    {
+      this->mem = nullptr;
+      return false;
+    }
+    this->capacity = _capacity;
+    return true;
+#else
+    (void)_capacity;
+    return false;
+#endif
+  }
+
+  /// \brief Typed access to the control block.
+  private: ShmStateHeader *Header() const
+  {
+    return static_cast<ShmStateHeader *>(this->mem);
+  }
+
+  /// \brief Start of the payload area.
+  private: char *Payload() const
+  {
+    return static_cast<char *>(this->mem) + sizeof(ShmStateHeader);
+  }
+
+  /// \brief Initial payload capacity; grows on demand.
+  private: static constexpr uint64_t kInitialCapacity{1u << 20};
+
+  /// \brief Shared memory object name.
+  private: std::string name;
+
+  /// \brief Segment file descriptor.
+  private: int fd{-1};
+
+  /// \brief Mapped segment, or nullptr when closed.
+  private: void *mem{nullptr};
+
+  /// \brief Mapped payload capacity in bytes.
+  private: uint64_t capacity{0u};
+};
+
+/// \brief Reader side of the channel, used by co-located GUIs.
+class ShmStateReader
+{
+  /// \brief Destructor, unmaps the segment.
+  public: ~ShmStateReader()
+  {
+    this->Detach();
+  }
+
+  /// \brief Map the segment of a world, if the server created one.
+  /// \param[in] _worldName World name used to derive the segment name.
+  /// \return True when attached. Callers typically retry periodically and
+  /// use transport until this succeeds.
+  public: bool Attach(const std::string &_worldName)
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    this->name = ShmStateName(_worldName);
+    this->fd = shm_open(this->name.c_str(), O_RDWR, 0600);
+    if (this->fd < 0)
+      return false;
+    if (!this->Remap())
+    {
+      this->Detach();
+      return false;
+    }
+    if (this->Header()->magic.load(std::memory_order_acquire) !=
+        kShmStateMagic)
+    {
+      this->Detach();
+      return false;
+    }
+    return true;
+#else
+    (void)_worldName;
+    return false;
+#endif
+  }
+
+  /// \brief Get whether the segment is mapped.
+  public: bool Valid() const
+  {
+    return nullptr != this->mem;
+  }
+
+  /// \brief Copy out the latest snapshot if it is newer than the last one
+  /// this reader saw. Also publishes the reader heartbeat, so this should
+  /// be called at the reader's regular poll rate even when it returns
+  /// false.
+  /// \param[out] _data Filled with the snapshot on success.
+  /// \param[out] _missedSnapshot Set to true when the returned snapshot's
+  /// sequence number is not the successor of the previous one: the slot
+  /// only holds the latest value, so intermediate snapshots were
+  /// overwritten before this reader saw them and the caller must recover
+  /// any state it cannot afford to lose (e.g. re-request a full state).
+  /// Also reported on the first successful poll after Attach, since
+  /// whatever was published before attaching was never seen either.
+  /// \return True if a new snapshot was copied out.
+  public: bool Poll(std::string &_data, bool &_missedSnapshot)
+  {
+    _missedSnapshot = false;
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    if (!this->Valid())
+      return false;
+    auto *header = this->Header();
+    header->readerHeartbeat.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+
+    // The writer may have grown the segment since it was mapped.
+    if (header->capacity.load(std::memory_order_acquire) != this->capacity &&
+        !this->Remap())
+    {
+      return false;
+    }
+
+    auto writingBefore = header->writing.load(std::memory_order_acquire);
+    if (writingBefore % 2u != 0u)
+      return false;
+    auto seq = header->seq.load(std::memory_order_acquire);
+    if (seq == this->lastSeq)
+      return false;
+    auto size = header->size.load(std::memory_order_acquire);
+    if (size > this->capacity)
+      return false;
+    _data.assign(this->Payload(), size);
+    // A write racing the copy above invalidates it; pick the snapshot up
+    // on the next poll.
+    if (header->writing.load(std::memory_order_acquire) != writingBefore)
+      return false;
+    _missedSnapshot = seq != this->lastSeq + 1u;
+    this->lastSeq = seq;
+    return true;
+#else
+    (void)_data;
+    return false;
+#endif
+  }
+
+  /// \brief Unmap the segment.
+  public: void Detach()
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    if (this->mem)
+    {
+      munmap(this->mem, sizeof(ShmStateHeader) + this->capacity);
+      this->mem = nullptr;
+    }
+    if (this->fd >= 0)
+    {
+      close(this->fd);
+      this->fd = -1;
+    }
+#endif
+  }
+
+  /// \brief Map the segment at its current capacity.
+  /// \return True on success.
+  private: bool Remap()
+  {
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+    struct stat segmentStat;
+    if (fstat(this->fd, &segmentStat) != 0 ||
+        static_cast<std::size_t>(segmentStat.st_size) <
+        sizeof(ShmStateHeader))
+    {
+      return false;
+    }
+    if (this->mem)
+      munmap(this->mem, sizeof(ShmStateHeader) + this->capacity);
+    this->mem = mmap(nullptr, static_cast<std::size_t>(segmentStat.st_size),
+        PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+    if (MAP_FAILED == this->mem)
+    {
+      this->mem = nullptr;
+      return false;
+    }
+    this->capacity = segmentStat.st_size - sizeof(ShmStateHeader);
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /// \brief Typed access to the control block.
+  private: ShmStateHeader *Header() const
+  {
+    return static_cast<ShmStateHeader *>(this->mem);
+  }
+
+  /// \brief Start of the payload area.
+  private: const char *Payload() const
+  {
+    return static_cast<const char *>(this->mem) + sizeof(ShmStateHeader);
+  }
+
+  /// \brief Shared memory object name.
+  private: std::string name;
+
+  /// \brief Segment file descriptor.
+  private: int fd{-1};
+
+  /// \brief Mapped segment, or nullptr when detached.
+  private: void *mem{nullptr};
+
+  /// \brief Mapped payload capacity in bytes.
+  private: uint64_t capacity{0u};
+
+  /// \brief Sequence of the last snapshot returned by Poll.
+  private: uint64_t lastSeq{0u};
+};
+}
+}
+}
+
+#endif
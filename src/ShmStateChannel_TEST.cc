@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ShmStateChannel.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+TEST(ShmStateChannel, Name)
+{
+  EXPECT_EQ("/gz-sim-state-default", ShmStateName("default"));
+  EXPECT_EQ("/gz-sim-state-my_world_2", ShmStateName("my world/2"));
+}
+
+#ifdef GZ_SIM_SHM_STATE_AVAILABLE
+/////////////////////////////////////////////////
+TEST(ShmStateChannel, WriteAndPoll)
+{
+  ShmStateWriter writer;
+  ASSERT_TRUE(writer.Open("shm_channel_test"));
+  EXPECT_TRUE(writer.Valid());
+  EXPECT_FALSE(writer.HasActiveReader());
+
+  ShmStateReader reader;
+  ASSERT_TRUE(reader.Attach("shm_channel_test"));
+  EXPECT_TRUE(reader.Valid());
+
+  // Nothing written yet
+  std::string out;
+  bool missed{false};
+  EXPECT_FALSE(reader.Poll(out, missed));
+
+  // The poll above published a heartbeat
+  EXPECT_TRUE(writer.HasActiveReader());
+
+  EXPECT_TRUE(writer.Write("snapshot one"));
+  EXPECT_TRUE(reader.Poll(out, missed));
+  EXPECT_EQ("snapshot one", out);
+  EXPECT_FALSE(missed);
+
+  // The same snapshot is not returned twice
+  EXPECT_FALSE(reader.Poll(out, missed));
+
+  EXPECT_TRUE(writer.Write("snapshot two"));
+  EXPECT_TRUE(reader.Poll(out, missed));
+  EXPECT_EQ("snapshot two", out);
+  EXPECT_FALSE(missed);
+
+  // A snapshot overwritten before it was polled is reported as missed
+  EXPECT_TRUE(writer.Write("snapshot three"));
+  EXPECT_TRUE(writer.Write("snapshot four"));
+  EXPECT_TRUE(reader.Poll(out, missed));
+  EXPECT_EQ("snapshot four", out);
+  EXPECT_TRUE(missed);
+
+  // A reader attaching after snapshots were published reports a miss on
+  // its first poll, so callers resync from the switchover
+  ShmStateReader lateReader;
+  ASSERT_TRUE(lateReader.Attach("shm_channel_test"));
+  EXPECT_TRUE(lateReader.Poll(out, missed));
+  EXPECT_EQ("snapshot four", out);
+  EXPECT_TRUE(missed);
+}
+
+/////////////////////////////////////////////////
+TEST(ShmStateChannel, GrowBeyondInitialCapacity)
+{
+  ShmStateWriter writer;
+  ASSERT_TRUE(writer.Open("shm_channel_grow_test"));
+
+  ShmStateReader reader;
+  ASSERT_TRUE(reader.Attach("shm_channel_grow_test"));
+
+  // Larger than the initial 1 MB capacity, forcing the writer to grow the
+  // segment and the reader to remap it.
+  std::string big(3u << 20, 'x');
+  big.back() = 'y';
+  EXPECT_TRUE(writer.Write(big));
+
+  std::string out;
+  bool missed{false};
+  EXPECT_TRUE(reader.Poll(out, missed));
+  EXPECT_EQ(big.size(), out.size());
+  EXPECT_EQ(big, out);
+}
+
+/////////////////////////////////////////////////
+TEST(ShmStateChannel, AttachWithoutWriter)
+{
+  ShmStateReader reader;
+  EXPECT_FALSE(reader.Attach("shm_channel_no_writer_test"));
+  EXPECT_FALSE(reader.Valid());
+
+  std::string out;
+  bool missed{false};
+  EXPECT_FALSE(reader.Poll(out, missed));
+}
+
+/////////////////////////////////////////////////
+TEST(ShmStateChannel, WriterUnlinksOnClose)
+{
+  {
+    ShmStateWriter writer;
+    ASSERT_TRUE(writer.Open("shm_channel_unlink_test"));
+  }
+
+  // The segment is gone once the writer is destroyed
+  ShmStateReader reader;
+  EXPECT_FALSE(reader.Attach("shm_channel_unlink_test"));
+}
+#endif
@@ -18,11 +18,17 @@
 #include "SimulationRunner.hh"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <thread>
 #include <unordered_set>
 #ifdef HAVE_PYBIND11
 #include <pybind11/pybind11.h>
 #endif
 
+#include <gz/msgs/any.pb.h>
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/clock.pb.h>
 #include <gz/msgs/gui.pb.h>
@@ -37,10 +43,14 @@
 #include <vector>
 
 #include "gz/common/Profiler.hh"
+#include "gz/common/Util.hh"
 #include "gz/sim/Constants.hh"
+#include "gz/sim/PublishQueue.hh"
+#include "gz/sim/components/Factory.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/Sensor.hh"
+#include "gz/sim/components/SkipSceneComponents.hh"
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/components/ParentEntity.hh"
@@ -116,6 +126,13 @@ SimulationRunner::SimulationRunner(const sdf::World &_world,
     gz::transport::parameters::ParametersRegistry>(
       std::string{"world/"} + this->worldName);
 
+  if (this->serverConfig.Deterministic())
+  {
+    this->entityCompMgr.SetEachParallelDeterministic(true);
+    gzmsg << "Deterministic execution enabled: systems and EachParallel "
+          << "run in stable serial order." << std::endl;
+  }
+
   // Get the physics profile
   // TODO(luca): remove duplicated logic in SdfEntityCreator and LevelManager
   const sdf::Physics *physics = _world.PhysicsByIndex(0);
@@ -173,6 +190,21 @@ SimulationRunner::SimulationRunner(const sdf::World &_world,
   );
   this->currentInfo.simTime = this->simTimeEpoch;
 
+  // Stats/clock publication decimation
+  std::string statsDecimationStr;
+  if (common::env("GZ_SIM_STATS_DECIMATION", statsDecimationStr))
+  {
+    try
+    {
+      this->statsDecimation = std::max<uint64_t>(1u,
+          std::stoull(statsDecimationStr));
+    }
+    catch (const std::exception &)
+    {
+      // Keep the default on a malformed value.
+    }
+  }
+
   // World control
   transport::NodeOptions opts;
   std::string ns{"/world/" + this->worldName};
@@ -295,12 +327,24 @@ SimulationRunner::SimulationRunner(const sdf::World &_world,
 
   gzmsg << "Serving world SDF generation service on [" << opts.NameSpace()
          << "/" << genWorldSdfService << "]" << std::endl;
+
+  std::string ecmStatsService{"ecm/stats"};
+  this->node->Advertise(
+      ecmStatsService, &SimulationRunner::EcmStatsService, this);
+
+  gzmsg << "Serving ECM statistics on [" << opts.NameSpace()
+         << "/" << ecmStatsService << "]" << std::endl;
 }
 
 //////////////////////////////////////////////////
 SimulationRunner::~SimulationRunner()
 {
   this->StopWorkerThreads();
+
+  // Drain and stop the shared publication queue before the systems and
+  // their transport nodes are destroyed, so no queued message outlives
+  // the publisher it references.
+  PublishQueue::Instance().Shutdown();
 }
 
 /////////////////////////////////////////////////
@@ -435,58 +479,208 @@ void SimulationRunner::PublishStats()
 {
   GZ_PROFILE("SimulationRunner::PublishStats");
 
-  // Create the world statistics message.
-  msgs::WorldStatistics msg;
-  msg.set_real_time_factor(this->realTimeFactor);
+  // Decimate publication: at high step rates (1 kHz and above) building
+  // and publishing stats and clock every step is a measurable share of
+  // the step budget.
+  if (++this->stepsSinceStatsPublish < this->statsDecimation)
+    return;
+  this->stepsSinceStatsPublish = 0u;
+
+  const bool statsWanted = this->statsPub.HasConnections() ||
+      (this->rootStatsPub.Valid() && this->rootStatsPub.HasConnections());
+  const bool clockWanted = this->clockPub.HasConnections() ||
+      (this->rootClockPub.Valid() && this->rootClockPub.HasConnections());
+
+  // Nothing to build when nobody listens; system stats have their own
+  // subscriber check.
+  if (!statsWanted && !clockWanted)
+  {
+    this->PublishSystemStats();
+    return;
+  }
 
-  auto realTimeSecNsec =
+  const auto realTimeSecNsec =
     math::durationToSecNsec(this->currentInfo.realTime);
 
-  auto simTimeSecNsec =
+  const auto simTimeSecNsec =
     math::durationToSecNsec(this->currentInfo.simTime);
 
-  msg.mutable_real_time()->set_sec(realTimeSecNsec.first);
-  msg.mutable_real_time()->set_nsec(realTimeSecNsec.second);
+  if (statsWanted)
+  {
+    // Fill the preallocated world statistics message; submessages are
+    // reused across steps.
+    auto &msg = this->statsMsg;
+    msg.set_real_time_factor(this->realTimeFactor);
+
+    msg.mutable_real_time()->set_sec(realTimeSecNsec.first);
+    msg.mutable_real_time()->set_nsec(realTimeSecNsec.second);
+
+    msg.mutable_sim_time()->set_sec(simTimeSecNsec.first);
+    msg.mutable_sim_time()->set_nsec(simTimeSecNsec.second);
+
+    msg.set_iterations(this->currentInfo.iterations);
+
+    msg.set_paused(this->currentInfo.paused);
 
-  msg.mutable_sim_time()->set_sec(simTimeSecNsec.first);
-  msg.mutable_sim_time()->set_nsec(simTimeSecNsec.second);
+    msgs::Set(msg.mutable_step_size(), this->currentInfo.dt);
 
-  msg.set_iterations(this->currentInfo.iterations);
+    if (this->Stepping())
+    {
+      // (deprecated) Remove this header in Gazebo H
+      msg.mutable_header()->clear_data();
+      auto headerData = msg.mutable_header()->add_data();
+      headerData->set_key("step");
 
-  msg.set_paused(this->currentInfo.paused);
+      msg.set_stepping(true);
+    }
+    else
+    {
+      msg.clear_header();
+      msg.clear_stepping();
+    }
 
-  msgs::Set(msg.mutable_step_size(), this->currentInfo.dt);
+    // Publish the stats message. The stats message is throttled.
+    this->statsPub.Publish(msg);
 
-  if (this->Stepping())
+    if (this->rootStatsPub.Valid())
+      this->rootStatsPub.Publish(msg);
+  }
+
+  if (clockWanted)
   {
-    // (deprecated) Remove this header in Gazebo H
-    auto headerData = msg.mutable_header()->add_data();
-    headerData->set_key("step");
+    // Fill and publish the preallocated clock message. The clock message
+    // is not throttled.
+    auto &msg = this->clockMsg;
+    msg.mutable_real()->set_sec(realTimeSecNsec.first);
+    msg.mutable_real()->set_nsec(realTimeSecNsec.second);
+    msg.mutable_sim()->set_sec(simTimeSecNsec.first);
+    msg.mutable_sim()->set_nsec(simTimeSecNsec.second);
+    msg.mutable_system()->set_sec(GZ_SYSTEM_TIME_S());
+    msg.mutable_system()->set_nsec(
+        GZ_SYSTEM_TIME_NS() - GZ_SYSTEM_TIME_S() * GZ_SEC_TO_NANO);
+    this->clockPub.Publish(msg);
+
+    // Only publish to root topic if no others are.
+    if (this->rootClockPub.Valid())
+      this->rootClockPub.Publish(msg);
+  }
+
+  this->PublishSystemStats();
+}
 
-    msg.set_stepping(true);
+/////////////////////////////////////////////////
+void SimulationRunner::PhaseTimingBuffer::Record(double _ms)
+{
+  if (this->samples.size() < kSystemTimingWindow)
+  {
+    this->samples.push_back(_ms);
+    return;
+  }
+  this->samples[this->next] = _ms;
+  this->next = (this->next + 1) % kSystemTimingWindow;
+}
+
+namespace {
+/////////////////////////////////////////////////
+/// \brief Fill the aggregate fields of _stats from a window of samples.
+/// \param[in] _samples Wall-time samples in milliseconds. Must not be empty.
+/// \param[out] _stats Statistics to fill.
+void AggregateSamples(const std::vector<double> &_samples,
+    SimulationRunner::SystemPhaseStats &_stats)
+{
+  std::vector<double> sorted{_samples};
+  std::sort(sorted.begin(), sorted.end());
+
+  _stats.count = sorted.size();
+  _stats.meanMs = std::accumulate(sorted.begin(), sorted.end(), 0.0) /
+      static_cast<double>(sorted.size());
+  auto percentile = [&sorted](double _pct)
+  {
+    const auto rank = static_cast<size_t>(
+        std::ceil(_pct * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+  };
+  _stats.p50Ms = percentile(0.50);
+  _stats.p99Ms = percentile(0.99);
+  _stats.maxMs = sorted.back();
+}
+}
+
+/////////////////////////////////////////////////
+std::vector<SimulationRunner::SystemPhaseStats>
+SimulationRunner::SystemTimingStats() const
+{
+  std::vector<SystemPhaseStats> result;
+
+  auto append = [&result](const std::string &_name, const std::string &_phase,
+      const std::vector<double> &_samples)
+  {
+    if (_samples.empty())
+      return;
+    SystemPhaseStats stats;
+    stats.name = _name;
+    stats.phase = _phase;
+    AggregateSamples(_samples, stats);
+    result.push_back(std::move(stats));
+  };
+
+  for (const auto &[system, buffer] : this->preUpdateTimings)
+  {
+    append(this->systemMgr->SystemName(system), "pre_update",
+        buffer.samples);
+  }
+  for (const auto &[system, buffer] : this->updateTimings)
+  {
+    append(this->systemMgr->SystemName(system), "update", buffer.samples);
+  }
+  for (const auto &[system, buffer] : this->postUpdateTimings)
+  {
+    append(this->systemMgr->SystemName(system), "post_update",
+        buffer.samples);
   }
 
-  // Publish the stats message. The stats message is throttled.
-  this->statsPub.Publish(msg);
+  return result;
+}
 
-  if (this->rootStatsPub.Valid())
-    this->rootStatsPub.Publish(msg);
+/////////////////////////////////////////////////
+void SimulationRunner::PublishSystemStats()
+{
+  GZ_PROFILE("SimulationRunner::PublishSystemStats");
 
-  // Create and publish the clock message. The clock message is not
-  // throttled.
-  msgs::Clock clockMsg;
-  clockMsg.mutable_real()->set_sec(realTimeSecNsec.first);
-  clockMsg.mutable_real()->set_nsec(realTimeSecNsec.second);
-  clockMsg.mutable_sim()->set_sec(simTimeSecNsec.first);
-  clockMsg.mutable_sim()->set_nsec(simTimeSecNsec.second);
-  clockMsg.mutable_system()->set_sec(GZ_SYSTEM_TIME_S());
-  clockMsg.mutable_system()->set_nsec(
-      GZ_SYSTEM_TIME_NS() - GZ_SYSTEM_TIME_S() * GZ_SEC_TO_NANO);
-  this->clockPub.Publish(clockMsg);
+  if (!this->systemStatsPub.Valid() || !this->systemStatsPub.HasConnections())
+    return;
 
-  // Only publish to root topic if no others are.
-  if (this->rootClockPub.Valid())
-    this->rootClockPub.Publish(clockMsg);
+  msgs::Param_V msg;
+  for (const auto &stats : this->SystemTimingStats())
+  {
+    auto *param = msg.add_param();
+    auto &params = *param->mutable_params();
+
+    msgs::Any name;
+    name.set_type(msgs::Any::STRING);
+    name.set_string_value(stats.name);
+    params["name"] = name;
+
+    msgs::Any phase;
+    phase.set_type(msgs::Any::STRING);
+    phase.set_string_value(stats.phase);
+    params["phase"] = phase;
+
+    auto setDouble = [&params](const std::string &_key, double _value)
+    {
+      msgs::Any value;
+      value.set_type(msgs::Any::DOUBLE);
+      value.set_double_value(_value);
+      params[_key] = value;
+    };
+    setDouble("count", static_cast<double>(stats.count));
+    setDouble("mean_ms", stats.meanMs);
+    setDouble("p50_ms", stats.p50Ms);
+    setDouble("p99_ms", stats.p99Ms);
+    setDouble("max_ms", stats.maxMs);
+  }
+
+  this->systemStatsPub.Publish(msg);
 }
 
 namespace {
@@ -520,6 +714,14 @@ void SimulationRunner::AddSystem(
   this->systemMgr->AddSystem(_system, entity, sdf);
 }
 
+/////////////////////////////////////////////////
+const std::vector<std::pair<std::string,
+    std::chrono::steady_clock::duration>> &
+SimulationRunner::SystemConfigureTimings() const
+{
+  return this->systemMgr->ConfigureTimings();
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::ProcessSystemQueue()
 {
@@ -528,48 +730,185 @@ void SimulationRunner::ProcessSystemQueue()
   if (0 == pending && !this->threadsNeedCleanUp)
     return;
 
-  // If additional systems are to be added or have been removed,
-  // stop the existing threads.
-  this->StopWorkerThreads();
+  this->systemMgr->ActivatePendingSystems();
 
-  this->threadsNeedCleanUp = false;
+  // PostUpdates run as tasks on a fixed-size pool instead of one thread
+  // per system, so short systems pack onto fewer threads and the step
+  // doesn't pay a wakeup per trivial system.
+  const auto numSystems = this->systemMgr->SystemsPostUpdate().size();
+  const unsigned int threadCount = numSystems > 0 ?
+      std::min(static_cast<unsigned int>(numSystems),
+          std::max(2u, std::thread::hardware_concurrency())) : 0u;
+
+  // Only rebuild the pool when its size changes or a removed system's
+  // tasks have to be drained. Keeping it alive otherwise lets systems
+  // attach to a running simulation without a thread teardown stall.
+  if (this->threadsNeedCleanUp ||
+      threadCount != this->postUpdatePoolThreads)
+  {
+    this->StopWorkerThreads();
+    this->threadsNeedCleanUp = false;
+    this->postUpdatePoolThreads = threadCount;
 
-  this->systemMgr->ActivatePendingSystems();
+    if (threadCount > 0)
+    {
+      gzdbg << "Creating PostUpdate worker pool with " << threadCount
+        << " threads for " << numSystems << " systems" << std::endl;
+
+      this->postUpdatePool = std::make_unique<common::WorkerPool>(threadCount);
+      this->PinWorkerPool(threadCount);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::PinWorkerPool(unsigned int _threads)
+{
+  // A dedicated PostUpdate policy wins over the process-wide affinity.
+  ServerConfig::ThreadPolicy policy;
+  policy.cpus = this->serverConfig.CpuAffinity();
+  const auto &threadPolicies = this->serverConfig.ThreadPolicies();
+  auto policyIter =
+      threadPolicies.find(ServerConfig::ThreadCategory::PostUpdate);
+  if (policyIter != threadPolicies.end())
+    policy = policyIter->second;
+
+  if (!this->postUpdatePool || (policy.name.empty() &&
+      policy.cpus.empty() && policy.schedulingClass.empty()))
+    return;
+
+  // The pool does not expose its threads, so the policy is applied from
+  // inside it: one task per thread, and no task finishes until every task
+  // has started, which guarantees each task lands on a distinct worker.
+  std::atomic<unsigned int> started{0};
+  for (unsigned int i = 0; i < _threads; ++i)
+  {
+    this->postUpdatePool->AddWork([&started, _threads, &policy] ()
+    {
+      applyThreadPolicy(policy.name, policy.cpus, policy.schedulingClass,
+          policy.priority);
+      started.fetch_add(1);
+      while (started.load() < _threads)
+        std::this_thread::yield();
+    });
+  }
+  this->postUpdatePool->WaitForResults();
+}
 
-  unsigned int threadCount =
-    static_cast<unsigned int>(this->systemMgr->SystemsPostUpdate().size() + 1u);
+/////////////////////////////////////////////////
+void SimulationRunner::SetSnapshotCadence(uint64_t _cadence,
+    std::size_t _depth)
+{
+  std::lock_guard<std::mutex> lock(this->snapshotMutex);
+  this->snapshotCadence = _cadence;
+  this->snapshotDepth = std::max<std::size_t>(1u, _depth);
+  if (0 == _cadence)
+  {
+    this->snapshotBaseEcm.reset();
+    this->snapshotPoints.clear();
+    this->snapshotPendingDelta.Clear();
+  }
+}
 
-  gzdbg << "Creating PostUpdate worker threads: "
-    << threadCount << std::endl;
+/////////////////////////////////////////////////
+std::vector<std::pair<uint64_t, std::chrono::steady_clock::duration>>
+SimulationRunner::SnapshotPoints() const
+{
+  std::lock_guard<std::mutex> lock(this->snapshotMutex);
+  std::vector<std::pair<uint64_t, std::chrono::steady_clock::duration>>
+      points;
+  points.reserve(this->snapshotPoints.size());
+  for (const auto &point : this->snapshotPoints)
+    points.emplace_back(point.iteration, point.simTime);
+  return points;
+}
 
-  this->postUpdateStartBarrier = std::make_unique<Barrier>(threadCount);
-  this->postUpdateStopBarrier = std::make_unique<Barrier>(threadCount);
+/////////////////////////////////////////////////
+std::unique_ptr<EntityComponentManager> SimulationRunner::ForkSnapshot(
+    uint64_t _iteration) const
+{
+  std::lock_guard<std::mutex> lock(this->snapshotMutex);
+  if (!this->snapshotBaseEcm)
+    return nullptr;
+
+  auto target = std::find_if(this->snapshotPoints.begin(),
+      this->snapshotPoints.end(),
+      [_iteration](const SnapshotPoint &_point)
+      {
+        return _point.iteration == _iteration;
+      });
+  if (target == this->snapshotPoints.end())
+    return nullptr;
+
+  auto forked = std::make_unique<EntityComponentManager>();
+  forked->CopyFrom(*this->snapshotBaseEcm);
+  for (auto point = this->snapshotPoints.begin(); ; ++point)
+  {
+    forked->SetState(point->delta);
+    if (point == target)
+      break;
+  }
+
+  // Entities the deltas flagged for removal were only marked; finalize so
+  // the fork starts from a clean state.
+  forked->ProcessRemoveEntityRequests();
+  forked->ClearRemovedComponents();
+  forked->SetAllComponentsUnchanged();
+  return forked;
+}
 
-  this->postUpdateThreadsRunning = true;
-  int id = 0;
+/////////////////////////////////////////////////
+void SimulationRunner::CaptureSnapshot()
+{
+  GZ_PROFILE("SimulationRunner::CaptureSnapshot");
+  std::lock_guard<std::mutex> lock(this->snapshotMutex);
 
-  for (auto &system : this->systemMgr->SystemsPostUpdate())
+  if (!this->snapshotBaseEcm)
   {
-    gzdbg << "Creating postupdate worker thread (" << id << ")" << std::endl;
+    // The first capture pays one full copy; every capture afterwards is
+    // proportional to the number of changed components.
+    this->snapshotBaseEcm = std::make_unique<EntityComponentManager>();
+    this->snapshotBaseEcm->CopyFrom(this->entityCompMgr);
+    this->snapshotPoints.push_back({this->currentInfo.iterations,
+        this->currentInfo.simTime, msgs::SerializedStateMap()});
+    return;
+  }
 
-    this->postUpdateThreads.push_back(std::thread([&, id]()
+  // Merge this step's changes into the pending delta. Later marks for the
+  // same component overwrite earlier ones, so the merged delta stays
+  // proportional to the set of changed components, not to elapsed steps.
+  msgs::SerializedStateMap stepDelta;
+  this->entityCompMgr.ChangedState(stepDelta);
+  for (auto &entityIter : *stepDelta.mutable_entities())
+  {
+    auto &pendingEntity =
+        (*this->snapshotPendingDelta.mutable_entities())[entityIter.first];
+    pendingEntity.set_id(entityIter.second.id());
+    if (entityIter.second.remove())
+      pendingEntity.set_remove(true);
+    for (auto &compIter : *entityIter.second.mutable_components())
     {
-      std::stringstream ss;
-      ss << "PostUpdateThread: " << id;
-      GZ_PROFILE_THREAD_NAME(ss.str().c_str());
-      while (this->postUpdateThreadsRunning)
-      {
-        this->postUpdateStartBarrier->Wait();
-        if (this->postUpdateThreadsRunning)
-        {
-          system->PostUpdate(this->currentInfo, this->entityCompMgr);
-        }
-        this->postUpdateStopBarrier->Wait();
-      }
-      gzdbg << "Exiting postupdate worker thread ("
-        << id << ")" << std::endl;
-    }));
-    id++;
+      (*pendingEntity.mutable_components())[compIter.first] =
+          std::move(compIter.second);
+    }
+  }
+
+  if (this->currentInfo.iterations % this->snapshotCadence != 0)
+    return;
+
+  this->snapshotPoints.push_back({this->currentInfo.iterations,
+      this->currentInfo.simTime, std::move(this->snapshotPendingDelta)});
+  this->snapshotPendingDelta.Clear();
+
+  // Bound memory by folding points that fall out of the retention window
+  // into the base copy. The base then matches the state at the oldest
+  // retained point, which holds an empty delta relative to it.
+  while (this->snapshotPoints.size() > this->snapshotDepth)
+  {
+    this->snapshotBaseEcm->SetState(this->snapshotPoints.front().delta);
+    this->snapshotBaseEcm->ProcessRemoveEntityRequests();
+    this->snapshotBaseEcm->ClearRemovedComponents();
+    this->snapshotPoints.pop_front();
   }
 }
 
@@ -577,59 +916,221 @@ void SimulationRunner::ProcessSystemQueue()
 void SimulationRunner::UpdateSystems()
 {
   GZ_PROFILE("SimulationRunner::UpdateSystems");
-  // \todo(nkoenig)  Systems used to be updated in parallel using
-  // a common::WorkerPool. There is overhead associated with
-  // this, most notably the creation and destruction of WorkOrders (see
-  // WorkerPool.cc). We could turn on parallel updates in the future, and/or
-  // turn it on if there are sufficient systems. More testing is required.
+  // Update systems that declare read-only component access
+  // (ISystemComponentAccess) are grouped by the SystemManager into stages,
+  // which are run in parallel on the worker pool. Systems that declare
+  // writes and systems without declarations run alone — ECM change
+  // tracking is not safe for concurrent writers — so the default behavior
+  // is still sequential.
+
+  // With asynchronous PostUpdate the previous step's tasks may still be
+  // consuming the snapshot; they must finish before systems are reset or
+  // before this step's PostUpdate flips new state into it.
+  this->WaitForAsyncPostUpdates();
 
   if (this->resetInitiated)
   {
     GZ_PROFILE("Reset");
+    // The incremental snapshot flips can't follow a reset, so re-seed the
+    // snapshot with a full copy on the next flip.
+    this->postUpdateSnapshotInitialized = false;
     this->systemMgr->Reset(this->currentInfo, this->entityCompMgr);
     return;
   }
 
+  // Systems with a declared update frequency are skipped below on steps
+  // where their period hasn't elapsed, without invoking any of their
+  // update phases.
+  this->systemMgr->UpdateThrottling(this->currentInfo);
+
+  // Publish the world-singleton snapshot (gravity, magnetic field,
+  // spherical coordinates, wind) so systems read it through
+  // worldConstants instead of repeating the lookups every update.
+  refreshWorldConstants(this->entityCompMgr);
+
   {
     GZ_PROFILE("PreUpdate");
     for (auto& [priority, systems] : this->systemMgr->SystemsPreUpdate())
     {
       for (auto& system : systems)
       {
+        if (this->systemMgr->Throttled(system))
+          continue;
+        const auto start = std::chrono::steady_clock::now();
         system->PreUpdate(this->currentInfo, this->entityCompMgr);
+        this->preUpdateTimings[system].Record(
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count());
       }
     }
   }
 
   {
     GZ_PROFILE("Update");
-    for (auto& [priority, systems] : this->systemMgr->SystemsUpdate())
+    for (const auto &stage : this->systemMgr->UpdateStages())
     {
-      for (auto& system : systems)
+      // A single-system stage runs inline; in deterministic mode every
+      // stage does, so systems always run in registration order.
+      if (stage.size() == 1 || this->serverConfig.Deterministic())
+      {
+        for (const auto &system : stage)
+        {
+          if (this->systemMgr->Throttled(system))
+            continue;
+          const auto start = std::chrono::steady_clock::now();
+          system->Update(this->currentInfo, this->entityCompMgr);
+          this->updateTimings[system].Record(
+              std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - start).count());
+        }
+        continue;
+      }
+
+      // Systems that share a stage declared non-conflicting component
+      // access, so their updates can run concurrently on the worker pool.
+      // Lock view creation/addition while they run: concurrent Each calls
+      // drain a view's staged entities, and the lock makes that drain take
+      // the view's mutex, matching the parallel PostUpdate protocol.
+      this->entityCompMgr.LockAddingEntitiesToViews(true);
+      for (const auto &system : stage)
       {
-        system->Update(this->currentInfo, this->entityCompMgr);
+        if (this->systemMgr->Throttled(system))
+          continue;
+        // Resolve the timing buffer on the main thread so workers never
+        // mutate the map, only their own buffer.
+        auto &timings = this->updateTimings[system];
+        this->workerPool.AddWork([system, &timings, this] ()
+        {
+          const auto start = std::chrono::steady_clock::now();
+          system->Update(this->currentInfo, this->entityCompMgr);
+          timings.Record(std::chrono::duration<double, std::milli>(
+              std::chrono::steady_clock::now() - start).count());
+        });
       }
+      this->workerPool.WaitForResults();
+      this->entityCompMgr.LockAddingEntitiesToViews(false);
     }
   }
 
   {
     GZ_PROFILE("PostUpdate");
-    this->entityCompMgr.LockAddingEntitiesToViews(true);
     // If no systems implementing PostUpdate have been added, then
-    // the barriers will be uninitialized, so guard against that condition.
-    if (this->postUpdateStartBarrier && this->postUpdateStopBarrier)
+    // the worker pool will be uninitialized, so guard against that
+    // condition.
+    if (this->postUpdatePool &&
+        this->serverConfig.UseAsyncPostUpdate() && !this->networkMgr &&
+        !this->serverConfig.Deterministic())
     {
-      // Release the GIL from the main thread to run PostUpdate threads which
+      // Flip changed component state into the read snapshot and let
+      // PostUpdate systems consume it while the next step already runs.
+      // The tasks are waited on at the top of the next UpdateSystems call.
+      if (!this->postUpdateSnapshotInitialized)
+      {
+        this->postUpdateSnapshotEcm.CopyFrom(this->entityCompMgr);
+        this->postUpdateSnapshotInitialized = true;
+      }
+      else
+      {
+        msgs::SerializedStateMap changedState;
+        this->entityCompMgr.ChangedState(changedState);
+        this->postUpdateSnapshotEcm.SetState(changedState);
+      }
+
+      this->postUpdateSnapshotEcm.LockAddingEntitiesToViews(true);
+      // The snapshot manager has its own world-constants entry; refresh it
+      // from the flipped state before the tasks start reading it.
+      refreshWorldConstants(this->postUpdateSnapshotEcm);
+      // Poses in the snapshot are immutable until the tasks are waited on,
+      // so systems can share resolved kinematic chains.
+      beginWorldPoseCache(this->postUpdateSnapshotEcm);
+      // Tasks outlive this call, so they capture the update info by value
+      // instead of reading currentInfo, which the next step overwrites.
+      const UpdateInfo info = this->currentInfo;
+      for (const auto &system : this->systemMgr->SystemsPostUpdate())
+      {
+        if (this->systemMgr->Throttled(system))
+          continue;
+        // Resolve the timing buffer on the main thread so workers never
+        // mutate the map, only their own buffer.
+        auto &timings = this->postUpdateTimings[system];
+        this->postUpdatePool->AddWork([system, &timings, info, this] ()
+        {
+          const auto start = std::chrono::steady_clock::now();
+          system->PostUpdate(info, this->postUpdateSnapshotEcm);
+          timings.Record(std::chrono::duration<double, std::milli>(
+              std::chrono::steady_clock::now() - start).count());
+        });
+      }
+      this->postUpdatesInFlight = true;
+    }
+    else if (this->postUpdatePool)
+    {
+      this->entityCompMgr.LockAddingEntitiesToViews(true);
+      // Poses are immutable for the rest of the phase, so systems can
+      // share resolved kinematic chains.
+      beginWorldPoseCache(this->entityCompMgr);
+      // Release the GIL from the main thread to run PostUpdate tasks which
       // might be calling into python. The system that does call into python
       // needs to lock the GIL from its thread.
       MaybeGilScopedRelease release;
-      this->postUpdateStartBarrier->Wait();
-      this->postUpdateStopBarrier->Wait();
+      if (this->serverConfig.Deterministic())
+      {
+        // Run PostUpdate systems inline in registration order so their
+        // side effects, e.g. published messages, keep a stable order.
+        for (const auto &system : this->systemMgr->SystemsPostUpdate())
+        {
+          if (this->systemMgr->Throttled(system))
+            continue;
+          const auto start = std::chrono::steady_clock::now();
+          system->PostUpdate(this->currentInfo, this->entityCompMgr);
+          this->postUpdateTimings[system].Record(
+              std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - start).count());
+        }
+      }
+      else
+      {
+        for (const auto &system : this->systemMgr->SystemsPostUpdate())
+        {
+          if (this->systemMgr->Throttled(system))
+            continue;
+          // Resolve the timing buffer on the main thread so workers never
+          // mutate the map, only their own buffer.
+          auto &timings = this->postUpdateTimings[system];
+          this->postUpdatePool->AddWork([system, &timings, this] ()
+          {
+            const auto start = std::chrono::steady_clock::now();
+            system->PostUpdate(this->currentInfo, this->entityCompMgr);
+            timings.Record(std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count());
+          });
+        }
+        this->postUpdatePool->WaitForResults();
+      }
+      endWorldPoseCache(this->entityCompMgr);
+      this->entityCompMgr.LockAddingEntitiesToViews(false);
     }
-    this->entityCompMgr.LockAddingEntitiesToViews(false);
   }
 }
 
+/////////////////////////////////////////////////
+void SimulationRunner::WaitForAsyncPostUpdates()
+{
+  if (!this->postUpdatesInFlight)
+    return;
+
+  GZ_PROFILE("SimulationRunner::WaitForAsyncPostUpdates");
+  {
+    // Release the GIL while waiting in case a PostUpdate task calls into
+    // python and needs to lock it from its thread.
+    MaybeGilScopedRelease release;
+    this->postUpdatePool->WaitForResults();
+  }
+  endWorldPoseCache(this->postUpdateSnapshotEcm);
+  this->postUpdateSnapshotEcm.LockAddingEntitiesToViews(false);
+  this->postUpdatesInFlight = false;
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::Stop()
 {
@@ -646,20 +1147,10 @@ void SimulationRunner::OnStop()
 /////////////////////////////////////////////////
 void SimulationRunner::StopWorkerThreads()
 {
-  this->postUpdateThreadsRunning = false;
-  if (this->postUpdateStartBarrier)
-  {
-    this->postUpdateStartBarrier->Cancel();
-  }
-  if (this->postUpdateStopBarrier)
-  {
-    this->postUpdateStopBarrier->Cancel();
-  }
-  for (auto &thread : this->postUpdateThreads)
-  {
-    thread.join();
-  }
-  this->postUpdateThreads.clear();
+  this->WaitForAsyncPostUpdates();
+  // Destroying the pool joins its worker threads
+  this->postUpdatePool.reset();
+  this->postUpdatePoolThreads = 0u;
 }
 
 /////////////////////////////////////////////////
@@ -672,6 +1163,28 @@ bool SimulationRunner::Run(const uint64_t _iterations)
   // in the design.
   GZ_PROFILE_THREAD_NAME("SimulationRunner");
 
+  // Apply the step thread's policy before it touches per-step state, so
+  // first-touch allocations land on the node the configured CPUs belong
+  // to. A dedicated Step policy wins over the process-wide affinity.
+  const auto &threadPolicies = this->serverConfig.ThreadPolicies();
+  auto stepPolicy =
+      threadPolicies.find(ServerConfig::ThreadCategory::Step);
+  if (stepPolicy != threadPolicies.end())
+  {
+    if (applyThreadPolicy(stepPolicy->second.name, stepPolicy->second.cpus,
+        stepPolicy->second.schedulingClass, stepPolicy->second.priority))
+      gzdbg << "Applied thread policy to simulation step thread\n";
+    else
+      gzwarn << "Unable to apply thread policy to simulation step thread\n";
+  }
+  else if (!this->serverConfig.CpuAffinity().empty())
+  {
+    if (applyCpuAffinity(this->serverConfig.CpuAffinity()))
+      gzdbg << "Pinned simulation step thread to configured CPUs\n";
+    else
+      gzwarn << "Unable to apply CPU affinity to simulation step thread\n";
+  }
+
   // Initialize network communications.
   if (this->networkMgr)
   {
@@ -718,6 +1231,16 @@ bool SimulationRunner::Run(const uint64_t _iterations)
         "stats", advertOpts);
   }
 
+  // Create the per-system timing statistics publisher. One message per
+  // second is enough since each message aggregates a full window of steps.
+  if (!this->systemStatsPub.Valid())
+  {
+    transport::AdvertiseMessageOptions advertOpts;
+    advertOpts.SetMsgsPerSec(1);
+    this->systemStatsPub = this->node->Advertise<msgs::Param_V>(
+        "stats/systems", advertOpts);
+  }
+
   if (!this->rootStatsPub.Valid())
   {
     // Check for the existence of other publishers on `/stats`
@@ -784,6 +1307,10 @@ bool SimulationRunner::Run(const uint64_t _iterations)
   // Keep number of iterations requested by caller
   uint64_t processedIterations{0};
 
+  // Start pacing from now; the deadline then advances by exactly one
+  // update period per iteration.
+  this->rateDeadline = std::chrono::steady_clock::now();
+
   // Execute all the systems until we are told to stop, or the number of
   // iterations is reached.
   while (this->running && (_iterations == 0 ||
@@ -799,12 +1326,30 @@ bool SimulationRunner::Run(const uint64_t _iterations)
     sleepTime = 0ns;
     actualSleep = 0ns;
 
-    sleepTime = std::max(0ns, this->prevUpdateRealTime +
-        this->updatePeriod - std::chrono::steady_clock::now() -
-        this->sleepOffset);
+    if (this->updatePeriod > 0ns)
+    {
+      this->rateDeadline += this->updatePeriod;
+
+      const auto now = std::chrono::steady_clock::now();
+
+      // If simulation fell far behind schedule (slow step, pause, or a
+      // debugger stop), restart pacing from now instead of running an
+      // unthrottled catch-up burst.
+      if (now - this->rateDeadline > this->maxScheduleSlip)
+        this->rateDeadline = now;
 
-    // Only sleep if needed.
-    if (sleepTime > 0ns)
+      sleepTime = std::max(0ns,
+          this->rateDeadline - now - this->sleepOffset);
+    }
+
+    // Only sleep when the accumulated time is worth a wakeup. At update
+    // periods below minSleepPeriod a per-iteration sleep is dominated by
+    // scheduler wakeup granularity, so several iterations run
+    // back-to-back and a single aggregated sleep covers them; the unspent
+    // time stays in rateDeadline, keeping the long-run rate exact.
+    const bool batchingSteps = this->updatePeriod < this->minSleepPeriod;
+    if (sleepTime > 0ns && (!batchingSteps ||
+        sleepTime >= this->minSleepPeriod))
     {
       GZ_PROFILE("Sleep");
       // Get the current time, sleep for the duration needed to match the
@@ -812,13 +1357,13 @@ bool SimulationRunner::Run(const uint64_t _iterations)
       startTime = std::chrono::steady_clock::now();
       std::this_thread::sleep_for(sleepTime);
       actualSleep = std::chrono::steady_clock::now() - startTime;
-    }
 
-    // Exponentially average out the difference between expected sleep time
-    // and actual sleep time.
-    this->sleepOffset =
-      std::chrono::duration_cast<std::chrono::nanoseconds>(
-          (actualSleep - sleepTime) * 0.01 + this->sleepOffset * 0.99);
+      // Exponentially average out the difference between expected sleep
+      // time and actual sleep time.
+      this->sleepOffset =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            (actualSleep - sleepTime) * 0.01 + this->sleepOffset * 0.99);
+    }
 
     // Update time information. This will update the iteration count, RTF,
     // and other values.
@@ -917,6 +1462,16 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   // Process world control messages.
   this->ProcessMessages();
 
+  // Load server plugins whose target entity was created this step.
+  // Must happen before ClearNewlyCreatedEntities so the new-entity check
+  // used to skip the matching work still sees this step's entities.
+  this->LoadDeferredServerPlugins();
+
+  // Record the branchable snapshot delta while this step's change marks
+  // and removal requests are still visible.
+  if (this->snapshotCadence > 0)
+    this->CaptureSnapshot();
+
   // Clear all new entities
   this->entityCompMgr.ClearNewlyCreatedEntities();
 
@@ -947,83 +1502,133 @@ void SimulationRunner::LoadPlugin(const Entity _entity,
 }
 
 //////////////////////////////////////////////////
-void SimulationRunner::LoadServerPlugins(
-    const std::list<ServerConfig::PluginInfo> &_plugins)
+Entity SimulationRunner::FindEntityForPlugin(
+    const ServerConfig::PluginInfo &_plugin) const
 {
-  // \todo(nkoenig) Remove plugins from the server config after they have
-  // been added. We might not want to do this if we want to support adding
-  // the same plugin to multiple entities, for example via a regex
-  // expression.
-  //
-  // Check plugins from the ServerConfig for matching entities.
+  // \todo(anyone) Type + name is not enough to uniquely identify an entity
+  // \todo(louise) The runner shouldn't care about specific components, this
+  // logic should be moved somewhere else.
+  Entity entity{kNullEntity};
 
-  for (const ServerConfig::PluginInfo &plugin : _plugins)
+  if ("model" == _plugin.EntityType())
   {
-    // \todo(anyone) Type + name is not enough to uniquely identify an entity
-    // \todo(louise) The runner shouldn't care about specific components, this
-    // logic should be moved somewhere else.
-    Entity entity{kNullEntity};
-
-    if ("model" == plugin.EntityType())
+    entity = this->entityCompMgr.EntityByComponents(
+        components::Name(_plugin.EntityName()), components::Model());
+  }
+  else if ("world" == _plugin.EntityType())
+  {
+    // Allow wildcard for world name
+    if (_plugin.EntityName() == "*")
+    {
+      entity = this->entityCompMgr.EntityByComponents(components::World());
+    }
+    else
     {
       entity = this->entityCompMgr.EntityByComponents(
-          components::Name(plugin.EntityName()), components::Model());
+          components::Name(_plugin.EntityName()), components::World());
     }
-    else if ("world" == plugin.EntityType())
+  }
+  else if ("sensor" == _plugin.EntityType())
+  {
+    // TODO(louise) Use scoped names for models and worlds too
+    auto sensors = this->entityCompMgr.EntitiesByComponents(
+        components::Sensor());
+
+    for (auto sensor : sensors)
     {
-      // Allow wildcard for world name
-      if (plugin.EntityName() == "*")
+      if (scopedName(sensor, this->entityCompMgr, "::", false) ==
+          _plugin.EntityName())
       {
-        entity = this->entityCompMgr.EntityByComponents(components::World());
-      }
-      else
-      {
-        entity = this->entityCompMgr.EntityByComponents(
-            components::Name(plugin.EntityName()), components::World());
+        entity = sensor;
+        break;
       }
     }
-    else if ("sensor" == plugin.EntityType())
-    {
-      // TODO(louise) Use scoped names for models and worlds too
-      auto sensors = this->entityCompMgr.EntitiesByComponents(
-          components::Sensor());
+  }
+  else if ("visual" == _plugin.EntityType())
+  {
+    // TODO(anyone) Use scoped names for models and worlds too
+    auto visuals = this->entityCompMgr.EntitiesByComponents(
+        components::Visual());
 
-      for (auto sensor : sensors)
+    for (auto visual : visuals)
+    {
+      if (scopedName(visual, this->entityCompMgr, "::", false) ==
+          _plugin.EntityName())
       {
-        if (scopedName(sensor, this->entityCompMgr, "::", false) ==
-            plugin.EntityName())
-        {
-          entity = sensor;
-          break;
-        }
+        entity = visual;
+        break;
       }
     }
-    else if ("visual" == plugin.EntityType())
-    {
-      // TODO(anyone) Use scoped names for models and worlds too
-      auto visuals = this->entityCompMgr.EntitiesByComponents(
-          components::Visual());
+  }
+  else
+  {
+    gzwarn << "No support for attaching plugins to entity of type ["
+            << _plugin.EntityType() << "]" << std::endl;
+  }
 
-      for (auto visual : visuals)
-      {
-        if (scopedName(visual, this->entityCompMgr, "::", false) ==
-            plugin.EntityName())
-        {
-          entity = visual;
-          break;
-        }
-      }
+  return entity;
+}
+
+//////////////////////////////////////////////////
+void SimulationRunner::LoadServerPlugins(
+    const std::list<ServerConfig::PluginInfo> &_plugins)
+{
+  // \todo(nkoenig) Remove plugins from the server config after they have
+  // been added. We might not want to do this if we want to support adding
+  // the same plugin to multiple entities, for example via a regex
+  // expression.
+  //
+  // Check plugins from the ServerConfig for matching entities.
+
+  for (const ServerConfig::PluginInfo &plugin : _plugins)
+  {
+    Entity entity = this->FindEntityForPlugin(plugin);
+
+    if (kNullEntity != entity)
+    {
+      this->LoadPlugin(entity, plugin.Plugin());
     }
-    else
+    else if ("model" == plugin.EntityType() ||
+             "world" == plugin.EntityType() ||
+             "sensor" == plugin.EntityType() ||
+             "visual" == plugin.EntityType())
     {
-      gzwarn << "No support for attaching plugins to entity of type ["
-              << plugin.EntityType() << "]" << std::endl;
+      // The target entity doesn't exist yet. Keep the plugin registered and
+      // load its shared library only once a matching entity is created, so
+      // startup time and resident memory stay proportional to what the
+      // world actually uses.
+      gzdbg << "Deferring load of system [" << plugin.Plugin().Name()
+            << "] until " << plugin.EntityType() << " ["
+            << plugin.EntityName() << "] is created" << std::endl;
+      this->deferredServerPlugins.push_back(plugin);
     }
+  }
+}
 
+//////////////////////////////////////////////////
+void SimulationRunner::LoadDeferredServerPlugins()
+{
+  if (this->deferredServerPlugins.empty() ||
+      !this->entityCompMgr.HasNewEntities())
+  {
+    return;
+  }
 
+  for (auto it = this->deferredServerPlugins.begin();
+       it != this->deferredServerPlugins.end();)
+  {
+    Entity entity = this->FindEntityForPlugin(*it);
     if (kNullEntity != entity)
     {
-      this->LoadPlugin(entity, plugin.Plugin());
+      gzdbg << "Loading deferred system [" << it->Plugin().Name()
+            << "] for " << it->EntityType() << " [" << it->EntityName()
+            << "]" << std::endl;
+      this->LoadPlugin(entity, it->Plugin());
+      it = this->deferredServerPlugins.erase(it);
+    }
+    else
+    {
+      ++it;
     }
   }
 }
@@ -1220,12 +1825,61 @@ bool SimulationRunner::OnWorldControlState(const msgs::WorldControlState &_req,
       std::chrono::nanoseconds(_req.world_control().run_to_sim_time().nsec());
   }
 
-  this->worldControls.push_back(control);
+  this->EnqueueWorldControl(control);
 
   _res.set_data(true);
   return true;
 }
 
+/////////////////////////////////////////////////
+void SimulationRunner::EnqueueWorldControl(const WorldControl &_control)
+{
+  // Coalesce redundant messages so bursts (e.g. GUI scrubbing or rapid
+  // pause toggles) replace each other instead of growing the buffer: a
+  // pure pause/play or a pure seek supersedes a preceding message of the
+  // same kind. Steps and rewinds are never coalesced since their effects
+  // accumulate.
+  auto pureToggle = [](const WorldControl &_c)
+  {
+    return _c.multiStep == 0u && !_c.rewind &&
+        _c.seek < std::chrono::steady_clock::duration::zero() &&
+        _c.runToSimTime < std::chrono::steady_clock::duration::zero();
+  };
+  auto pureSeek = [](const WorldControl &_c)
+  {
+    return _c.multiStep == 0u && !_c.rewind &&
+        _c.seek >= std::chrono::steady_clock::duration::zero();
+  };
+
+  if (!this->worldControls.empty())
+  {
+    auto &back = this->worldControls.back();
+    if ((pureToggle(back) && pureToggle(_control)) ||
+        (pureSeek(back) && pureSeek(_control)))
+    {
+      back = _control;
+      return;
+    }
+  }
+
+  if (this->worldControls.size() >= this->worldControlQueueCapacity)
+  {
+    gzwarn << "World control buffer is full ("
+           << this->worldControlQueueCapacity
+           << " messages), dropping the oldest message" << std::endl;
+    this->worldControls.pop_front();
+  }
+
+  this->worldControls.push_back(_control);
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::SetWorldControlQueueCapacity(size_t _capacity)
+{
+  std::lock_guard<std::mutex> lock(this->msgBufferMutex);
+  this->worldControlQueueCapacity = std::max<size_t>(1u, _capacity);
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::ProcessNewWorldControlState()
 {
@@ -1263,7 +1917,7 @@ bool SimulationRunner::OnPlaybackControl(const msgs::LogPlaybackControl &_req,
     gzwarn << "Log forwarding is not supported, use seek." << std::endl;
   }
 
-  this->worldControls.push_back(control);
+  this->EnqueueWorldControl(control);
 
   _res.set_data(true);
   return true;
@@ -1500,6 +2154,64 @@ bool SimulationRunner::GuiInfoService(msgs::GUI &_res)
   return true;
 }
 
+//////////////////////////////////////////////////
+bool SimulationRunner::EcmStatsService(msgs::StringMsg &_res)
+{
+  const auto stats = this->entityCompMgr.MemoryStatistics();
+  const auto poolStats = components::ComponentPool::Instance()->PoolStats();
+
+  std::ostringstream out;
+  out << "{\n"
+      << "  \"entity_count\": " << stats.entityCount << ",\n"
+      << "  \"component_count\": " << stats.componentCount << ",\n"
+      << "  \"component_size_bytes\": " << stats.componentSizeBytes << ",\n"
+      << "  \"view_count\": " << stats.viewCount << ",\n"
+      << "  \"view_entity_count\": " << stats.viewEntityCount << ",\n"
+      << "  \"pool_slab_bytes\": " << poolStats.slabBytes << ",\n"
+      << "  \"pool_total_chunks\": " << poolStats.totalChunks << ",\n"
+      << "  \"pool_free_chunks\": " << poolStats.freeChunks << ",\n"
+      << "  \"component_types\": [\n";
+
+  std::size_t i{0};
+  for (const auto &[typeId, typeStats] : stats.componentTypes)
+  {
+    out << "    {\"type_id\": " << typeId
+        << ", \"name\": \"" << typeStats.name << "\""
+        << ", \"count\": " << typeStats.count
+        << ", \"marked_removed_count\": " << typeStats.markedRemovedCount
+        << ", \"size_bytes\": " << typeStats.sizeBytes << "}"
+        << (++i < stats.componentTypes.size() ? "," : "") << "\n";
+  }
+
+  out << "  ]";
+
+  // Change-rate counters are only reported while tracking is enabled, see
+  // EntityComponentManager::SetChangeRateTracking
+  if (this->entityCompMgr.ChangeRateTracking())
+  {
+    const auto counters = this->entityCompMgr.ChangeRateCounters();
+    const double windowSec = std::chrono::duration<double>(
+        this->entityCompMgr.ChangeRateWindow()).count();
+    out << ",\n  \"change_rate_window_s\": " << windowSec << ",\n"
+        << "  \"change_counts\": [\n";
+    std::size_t j{0};
+    for (const auto &[typeId, count] : counters)
+    {
+      out << "    {\"type_id\": " << typeId
+          << ", \"name\": \""
+          << components::Factory::Instance()->Name(typeId) << "\""
+          << ", \"count\": " << count << "}"
+          << (++j < counters.size() ? "," : "") << "\n";
+    }
+    out << "  ]";
+  }
+
+  out << "\n}\n";
+
+  _res.set_data(out.str());
+  return true;
+}
+
 //////////////////////////////////////////////////
 bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
                                         msgs::StringMsg &_res)
@@ -1508,7 +2220,7 @@ bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
   // ECM.
   Entity world = this->entityCompMgr.EntityByComponents(components::World());
   std::optional<std::string> genString = sdf_generator::generateWorld(
-      this->entityCompMgr, world, this->fuelUriMap, _req);
+      this->entityCompMgr, world, this->sdfGenCache, this->fuelUriMap, _req);
   if (genString.has_value())
   {
     _res.set_data(*genString);
@@ -1586,6 +2298,10 @@ void SimulationRunner::CreateEntities(const sdf::World &_world)
       components::RenderEngineGuiPlugin(
       this->serverConfig.RenderEngineGui()));
 
+  this->entityCompMgr.CreateComponent(worldEntity,
+      components::SkipSceneComponents(
+      this->serverConfig.SkipSceneComponents()));
+
   // Load the world entities from SDF
   creator->CreateEntities(&this->sdfWorld, worldEntity);
 
@@ -1660,4 +2376,11 @@ void SimulationRunner::CreateEntities(const sdf::World &_world)
 
   // Store the initial state of the ECM;
   this->initialEntityCompMgr.CopyFrom(this->entityCompMgr);
+
+  // Record component mutations from here on so that a reset can restore
+  // the initial state by applying only the recorded deltas. Opt-in: the
+  // journal misses components mutated through raw pointers without a
+  // change notification, so the full-copy reset stays the default.
+  if (this->serverConfig.UseDeltaReset())
+    this->entityCompMgr.SetComponentMutationTracking(true);
 }
@@ -18,18 +18,24 @@
 #define GZ_SIM_SIMULATIONRUNNER_HH_
 
 #include <gz/msgs/boolean.pb.h>
+#include <gz/msgs/clock.pb.h>
 #include <gz/msgs/gui.pb.h>
 #include <gz/msgs/log_playback_control.pb.h>
+#include <gz/msgs/param_v.pb.h>
 #include <gz/msgs/sdf_generator_config.pb.h>
+#include <gz/msgs/serialized_map.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/world_control.pb.h>
 #include <gz/msgs/world_control_state.pb.h>
+#include <gz/msgs/world_stats.pb.h>
 
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -56,8 +62,8 @@
 
 #include "network/NetworkManager.hh"
 #include "LevelManager.hh"
+#include "SdfGenerator.hh"
 #include "SystemManager.hh"
-#include "Barrier.hh"
 #include "WorldControl.hh"
 
 using namespace std::chrono_literals;
@@ -90,9 +96,13 @@ namespace gz
       /// \brief Internal method for handling stop event (to prevent recursion)
       private: void OnStop();
 
-      /// \brief Stop and join all post update worker threads
+      /// \brief Stop and join the PostUpdate worker pool
       private: void StopWorkerThreads();
 
+      /// \brief Wait for asynchronous PostUpdate tasks submitted on a
+      /// previous step to finish. Does nothing if none are in flight.
+      private: void WaitForAsyncPostUpdates();
+
       /// \brief Run the simulationrunner.
       /// \param[in] _iterations Number of iterations.
       /// \return True if the operation completed successfully.
@@ -139,6 +149,46 @@ namespace gz
       /// \brief Publish current world statistics.
       public: void PublishStats();
 
+      /// \brief Aggregated wall-clock statistics for one update phase of one
+      /// system, computed over the samples currently held in its ring
+      /// buffer.
+      public: struct SystemPhaseStats
+      {
+        /// \brief Name of the system as reported by the system manager. May
+        /// be empty for systems added in-memory without a plugin name.
+        public: std::string name;
+
+        /// \brief Update phase: "pre_update", "update" or "post_update".
+        public: std::string phase;
+
+        /// \brief Number of samples in the window.
+        public: size_t count{0};
+
+        /// \brief Mean wall time in milliseconds.
+        public: double meanMs{0.0};
+
+        /// \brief Median (50th percentile) wall time in milliseconds.
+        public: double p50Ms{0.0};
+
+        /// \brief 99th percentile wall time in milliseconds.
+        public: double p99Ms{0.0};
+
+        /// \brief Maximum wall time in milliseconds.
+        public: double maxMs{0.0};
+      };
+
+      /// \brief Get per-system, per-phase wall-time statistics aggregated
+      /// over the most recent steps (see kSystemTimingWindow). Percentiles
+      /// expose spikes that averages hide. Should not be called while a
+      /// step is in progress.
+      /// \return One entry per system and update phase.
+      public: std::vector<SystemPhaseStats> SystemTimingStats() const;
+
+      /// \brief Publish per-system timing statistics on the stats/systems
+      /// topic. Called every step; the publisher throttles the actual
+      /// message rate.
+      private: void PublishSystemStats();
+
       /// \brief Load system plugin for a given entity.
       /// \param[in] _entity The plugins will be associated with this Entity
       /// \param[in] _plugin SDF Plugin to load
@@ -160,6 +210,18 @@ namespace gz
       /// \param[in] _config Configuration to load plugins from.
       public: void LoadLoggingPlugins(const ServerConfig &_config);
 
+      /// \brief Find the entity a server plugin targets, based on its
+      /// entity type and name filter.
+      /// \param[in] _plugin Plugin information with the entity filter.
+      /// \return The matching entity, or kNullEntity if none exists yet.
+      private: Entity FindEntityForPlugin(
+          const ServerConfig::PluginInfo &_plugin) const;
+
+      /// \brief Load deferred server plugins whose target entity has been
+      /// created since they were registered. Called once per step; does
+      /// nothing unless there are deferred plugins and new entities.
+      private: void LoadDeferredServerPlugins();
+
       /// \brief Get whether this is running. When running is true,
       /// then simulation is stepping forward.
       /// \return True if the server is running.
@@ -324,6 +386,14 @@ namespace gz
       /// \return True if successful.
       private: bool GuiInfoService(gz::msgs::GUI &_res);
 
+      /// \brief Callback for the ECM stats service. Reports per-component
+      /// type counts and byte estimates and view overhead as a JSON
+      /// document, so long running simulations can be monitored for
+      /// component growth without a heap profiler.
+      /// \param[out] _res Response containing the JSON document.
+      /// \return True if successful.
+      private: bool EcmStatsService(msgs::StringMsg &_res);
+
       /// \brief Calculate real time factor and populate currentInfo.
       private: void UpdateCurrentInfo();
 
@@ -334,6 +404,18 @@ namespace gz
       /// \brief Process world control service messages.
       private: void ProcessWorldControl();
 
+      /// \brief Add a world control message to the buffer, coalescing it
+      /// with the previous message when redundant (e.g. consecutive pause
+      /// toggles or seeks) and dropping the oldest message when the buffer
+      /// is at capacity. The caller must hold msgBufferMutex.
+      /// \param[in] _control Message to buffer.
+      private: void EnqueueWorldControl(const WorldControl &_control);
+
+      /// \brief Set the capacity of the world control message buffer.
+      /// \param[in] _capacity Maximum number of buffered messages. Values
+      /// below one are clamped to one.
+      public: void SetWorldControlQueueCapacity(size_t _capacity);
+
       /// \brief Actually add system to the runner
       /// \param[in] _system System to be added
       public: void AddSystemToRunner(SystemInternal _system);
@@ -342,6 +424,55 @@ namespace gz
       /// added.
       public: void ProcessSystemQueue();
 
+      /// \brief Apply the PostUpdate thread policy configured through
+      /// ServerConfig::SetThreadPolicy to every worker thread, falling
+      /// back to the process-wide ServerConfig::SetCpuAffinity pinning.
+      /// No-op when neither is configured or no pool exists.
+      /// \param[in] _threads Number of threads in the pool.
+      private: void PinWorkerPool(unsigned int _threads);
+
+      /// \brief Get the wall-clock duration of every system's Configure
+      /// call, as recorded by the system manager.
+      /// \return Pairs of system name and Configure duration.
+      public: const std::vector<std::pair<std::string,
+          std::chrono::steady_clock::duration>> &
+          SystemConfigureTimings() const;
+
+      /// \brief Enable periodic branchable snapshots of the world state.
+      ///
+      /// While enabled, the runner records the serialized changed-component
+      /// delta of every step and retains a fork point every _cadence
+      /// iterations. The first capture pays one full copy of the ECM;
+      /// every capture afterwards costs time proportional to the number of
+      /// components that changed, not to the world size. Retained fork
+      /// points can be turned into independent ECMs with ForkSnapshot.
+      /// \param[in] _cadence Retain a fork point every this many
+      /// iterations. Zero disables snapshots and discards retained state.
+      /// \param[in] _depth Maximum number of fork points to retain. When
+      /// exceeded, the oldest point is folded into the base copy.
+      public: void SetSnapshotCadence(uint64_t _cadence,
+                                      std::size_t _depth = 16);
+
+      /// \brief Get the retained snapshot fork points.
+      /// \return Pairs of iteration count and sim time, oldest first.
+      public: std::vector<std::pair<uint64_t,
+          std::chrono::steady_clock::duration>> SnapshotPoints() const;
+
+      /// \brief Create an independent ECM holding the world state at a
+      /// retained fork point, for what-if evaluation off the live world.
+      /// The fork is rebuilt from the base copy plus the retained deltas,
+      /// so its cost is one ECM copy with no SDF parsing or plugin loading.
+      /// \param[in] _iteration Iteration count of a retained fork point, as
+      /// reported by SnapshotPoints.
+      /// \return Forked ECM, or nullptr if the iteration is not retained.
+      public: std::unique_ptr<EntityComponentManager> ForkSnapshot(
+                  uint64_t _iteration) const;
+
+      /// \brief Record this step's changed-component delta and, on cadence
+      /// boundaries, retain it as a fork point. Called while the step's
+      /// change marks and removal requests are still visible.
+      private: void CaptureSnapshot();
+
       /// \brief Generate the current world's SDFormat representation.
       /// \param[in] _req Request message with options for saving a world to an
       /// SDFormat file.
@@ -437,6 +568,24 @@ namespace gz
       /// sleep durations.
       private: std::chrono::steady_clock::duration sleepOffset{0};
 
+      /// \brief Wall clock deadline the current iteration is paced
+      /// against. It advances by exactly one update period per iteration,
+      /// so the long-run rate stays exact even when sleeps are batched
+      /// over several iterations.
+      private: std::chrono::steady_clock::time_point rateDeadline;
+
+      /// \brief Smallest sleep worth a wakeup. When the update period is
+      /// below this, several iterations run back-to-back and a single
+      /// aggregated sleep covers them, since sub-millisecond sleeps are
+      /// dominated by scheduler wakeup granularity.
+      private: std::chrono::steady_clock::duration minSleepPeriod{1ms};
+
+      /// \brief How far simulation may fall behind its pacing deadline
+      /// before pacing restarts from the current time. Without this bound
+      /// a slow step, pause, or debugger stop would be followed by an
+      /// unthrottled catch-up burst.
+      private: std::chrono::steady_clock::duration maxScheduleSlip{100ms};
+
       /// \brief This is the rate at which the systems are updated.
       /// The default update rate is 500hz, which is a period of 2ms.
       private: std::chrono::steady_clock::duration updatePeriod{2ms};
@@ -452,6 +601,27 @@ namespace gz
       /// \brief World statistics publisher.
       private: gz::transport::Node::Publisher statsPub;
 
+      /// \brief Preallocated world statistics message. Reused across
+      /// steps so publication doesn't allocate submessages every
+      /// iteration.
+      private: msgs::WorldStatistics statsMsg;
+
+      /// \brief Preallocated clock message, reused across steps.
+      private: msgs::Clock clockMsg;
+
+      /// \brief Publish stats and clock only every Nth step. Read from
+      /// GZ_SIM_STATS_DECIMATION; defaults to 1 (publish every step).
+      /// External clock consumers that interpolate (e.g. bridges) can
+      /// raise this to take stats publication out of the step budget at
+      /// high step rates.
+      private: uint64_t statsDecimation{1u};
+
+      /// \brief Steps since stats and clock were last published.
+      private: uint64_t stepsSinceStatsPublish{0u};
+
+      /// \brief Per-system timing statistics publisher.
+      private: gz::transport::Node::Publisher systemStatsPub;
+
       /// \brief Clock publisher for the root `/stats` topic.
       private: gz::transport::Node::Publisher rootStatsPub;
 
@@ -507,8 +677,14 @@ namespace gz
       /// \brief Keeps the latest simulation info.
       private: UpdateInfo currentInfo;
 
-      /// \brief Buffer of world control messages.
-      private: std::list<WorldControl> worldControls;
+      /// \brief Buffer of world control messages. Bounded by
+      /// worldControlQueueCapacity; see EnqueueWorldControl.
+      private: std::deque<WorldControl> worldControls;
+
+      /// \brief Maximum number of buffered world control messages. When the
+      /// buffer is full the oldest message is dropped, so a burst of
+      /// messages can't stall a step draining an unbounded backlog.
+      private: size_t worldControlQueueCapacity{128};
 
       /// \brief Mutex to protect message buffers.
       private: std::mutex msgBufferMutex;
@@ -519,21 +695,77 @@ namespace gz
       /// \brief Copy of the server configuration.
       public: ServerConfig serverConfig;
 
-      /// \brief Collection of threads running system PostUpdates
-      private: std::vector<std::thread> postUpdateThreads;
-
-      /// \brief Flag to indicate running status of PostUpdate threads
-      private: std::atomic<bool> postUpdateThreadsRunning{false};
-
-      /// \brief Barrier to signal beginning of PostUpdate thread execution
-      private: std::unique_ptr<Barrier> postUpdateStartBarrier;
-
-      /// \brief Barrier to signal end of PostUpdate thread execution
-      private: std::unique_ptr<Barrier> postUpdateStopBarrier;
+      /// \brief Fixed-size pool of worker threads that runs the PostUpdate
+      /// phase of all systems as tasks each step. Sizing the pool to the
+      /// hardware concurrency instead of one thread per system lets short
+      /// PostUpdates pack onto fewer threads instead of every step paying a
+      /// wakeup and barrier round-trip per system.
+      private: std::unique_ptr<common::WorkerPool> postUpdatePool;
+
+      /// \brief Number of threads in postUpdatePool, or zero when no pool
+      /// exists. Used to keep the pool alive across system additions that
+      /// do not change its size.
+      private: unsigned int postUpdatePoolThreads{0u};
+
+      /// \brief Read-only snapshot of the ECM consumed by PostUpdate
+      /// systems when asynchronous PostUpdate is enabled. Changed component
+      /// state is flipped into the snapshot at the end of the update
+      /// phases, and the next step's physics runs while PostUpdate systems
+      /// still read the snapshot.
+      private: EntityComponentManager postUpdateSnapshotEcm;
+
+      /// \brief True once the snapshot has been seeded with a full copy of
+      /// the ECM.
+      private: bool postUpdateSnapshotInitialized{false};
+
+      /// \brief True while asynchronous PostUpdate tasks submitted on a
+      /// previous step may still be running.
+      private: bool postUpdatesInFlight{false};
+
+      /// \brief A retained snapshot fork point: the merged changed-state
+      /// delta covering the steps since the previous fork point.
+      private: struct SnapshotPoint
+      {
+        /// \brief Iteration count the point was captured at.
+        uint64_t iteration;
+
+        /// \brief Sim time the point was captured at.
+        std::chrono::steady_clock::duration simTime;
+
+        /// \brief Delta from the previous fork point to this one.
+        msgs::SerializedStateMap delta;
+      };
+
+      /// \brief Retain a snapshot fork point every this many iterations.
+      /// Zero disables snapshot capture.
+      private: uint64_t snapshotCadence{0};
+
+      /// \brief Maximum number of retained fork points.
+      private: std::size_t snapshotDepth{16};
+
+      /// \brief Full ECM copy matching the state at the oldest retained
+      /// fork point. Seeded once when snapshots are enabled; afterwards the
+      /// oldest delta is folded into it as points fall out of the window.
+      private: std::unique_ptr<EntityComponentManager> snapshotBaseEcm;
+
+      /// \brief Retained fork points, oldest first.
+      private: std::deque<SnapshotPoint> snapshotPoints;
+
+      /// \brief Changed-state delta merged step by step until the next
+      /// cadence boundary turns it into a fork point.
+      private: msgs::SerializedStateMap snapshotPendingDelta;
+
+      /// \brief Protects the snapshot members so forks can be taken from
+      /// other threads while the simulation steps.
+      private: mutable std::mutex snapshotMutex;
 
       /// \brief Map from file paths to Fuel URIs.
       private: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Cache of per-model element trees reused across world SDF
+      /// generation requests.
+      private: sdf_generator::WorldGenCache sdfGenCache;
+
       /// \brief True if Server::RunOnce triggered a blocking paused step
       private: bool blockingPausedStepPending{false};
 
@@ -541,6 +773,11 @@ namespace gz
       /// WorldControl info (true) or not (false)
       private: bool stepping{false};
 
+      /// \brief Server plugins whose target entity did not exist when they
+      /// were registered. Their shared libraries are only loaded once a
+      /// matching entity is created.
+      private: std::list<ServerConfig::PluginInfo> deferredServerPlugins;
+
       /// \brief A set of entities that need to be recreated
       private: std::set<Entity> entitiesToRecreate;
 
@@ -548,6 +785,41 @@ namespace gz
       /// at the appropriate time.
       private: std::unique_ptr<msgs::WorldControlState> newWorldControlState;
 
+      /// \brief Number of per-phase wall-time samples retained for timing
+      /// statistics. At a 1 kHz physics rate this covers the last second of
+      /// stepping.
+      private: static constexpr size_t kSystemTimingWindow{1000};
+
+      /// \brief Fixed-size ring buffer of per-step wall-time samples, in
+      /// milliseconds, for one update phase of one system.
+      private: struct PhaseTimingBuffer
+      {
+        /// \brief Record a sample, overwriting the oldest one once the
+        /// buffer is full.
+        /// \param[in] _ms Wall time of one phase invocation in milliseconds.
+        public: void Record(double _ms);
+
+        /// \brief Samples, up to kSystemTimingWindow of them.
+        public: std::vector<double> samples;
+
+        /// \brief Index the next sample is written to once full.
+        public: size_t next{0};
+      };
+
+      /// \brief Wall-time samples of each system's PreUpdate phase. Entries
+      /// are created on the main thread before any worker touches them, so
+      /// workers only ever write to their own buffer.
+      private: std::unordered_map<ISystemPreUpdate *, PhaseTimingBuffer>
+          preUpdateTimings;
+
+      /// \brief Wall-time samples of each system's Update phase.
+      private: std::unordered_map<ISystemUpdate *, PhaseTimingBuffer>
+          updateTimings;
+
+      /// \brief Wall-time samples of each system's PostUpdate phase.
+      private: std::unordered_map<ISystemPostUpdate *, PhaseTimingBuffer>
+          postUpdateTimings;
+
       /// \brief Set if we need to remove systems due to entity removal
       private: bool threadsNeedCleanUp{false};
 
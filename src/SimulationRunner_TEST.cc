@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 #include <tinyxml2.h>
 
+#include <atomic>
+#include <unordered_set>
+
 #include <gz/msgs/clock.pb.h>
 #include <gz/msgs/gui.pb.h>
 #include <gz/msgs/sdf_generator_config.pb.h>
@@ -110,6 +113,42 @@ void rootClockCb(const msgs::Clock &_msg)
   rootClockMsgs.push_back(_msg);
 }
 
+/////////////////////////////////////////////////
+class PostUpdateCounterSystem
+  : public System,
+    public ISystemPostUpdate
+{
+  // Documentation inherited
+  public: void PostUpdate(const UpdateInfo &,
+                const EntityComponentManager &) override
+          {
+            this->count++;
+          };
+
+  /// \brief Number of PostUpdate calls.
+  public: std::atomic<int> count{0};
+};
+
+/////////////////////////////////////////////////
+class TimedSystem
+  : public System,
+    public ISystemPreUpdate,
+    public ISystemUpdate,
+    public ISystemPostUpdate
+{
+  // Documentation inherited
+  public: void PreUpdate(const UpdateInfo &,
+                EntityComponentManager &) override {};
+
+  // Documentation inherited
+  public: void Update(const UpdateInfo &,
+                EntityComponentManager &) override {};
+
+  // Documentation inherited
+  public: void PostUpdate(const UpdateInfo &,
+                const EntityComponentManager &) override {};
+};
+
 /////////////////////////////////////////////////
 TEST_P(SimulationRunnerTest, CreateEntities)
 {
@@ -1187,6 +1226,129 @@ TEST_P(SimulationRunnerTest, Time)
       runner.CurrentInfo().simTime.count());
 }
 
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, AsyncPostUpdate)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  ServerConfig config;
+  config.SetUseAsyncPostUpdate(true);
+
+  auto systemLoader = std::make_shared<SystemLoader>();
+  auto system = std::make_shared<PostUpdateCounterSystem>();
+
+  {
+    // Create simulation runner
+    SimulationRunner runner(*root.WorldByIndex(0), systemLoader, config);
+    runner.AddSystem(system);
+
+    runner.SetPaused(false);
+    EXPECT_TRUE(runner.Run(10));
+    EXPECT_EQ(10u, runner.CurrentInfo().iterations);
+  }
+
+  // Destroying the runner joins any in-flight PostUpdate tasks, so every
+  // step's PostUpdate has run by now.
+  EXPECT_EQ(10, system->count);
+}
+
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, SystemTimingStats)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create simulation runner
+  auto systemLoader = std::make_shared<SystemLoader>();
+  SimulationRunner runner(*root.WorldByIndex(0), systemLoader);
+
+  auto system = std::make_shared<TimedSystem>();
+  runner.AddSystem(system);
+
+  // No samples before stepping
+  EXPECT_TRUE(runner.SystemTimingStats().empty());
+
+  runner.SetPaused(false);
+  EXPECT_TRUE(runner.Run(20));
+
+  auto stats = runner.SystemTimingStats();
+  ASSERT_FALSE(stats.empty());
+
+  std::unordered_set<std::string> phases;
+  for (const auto &phaseStats : stats)
+  {
+    phases.insert(phaseStats.phase);
+    EXPECT_GT(phaseStats.count, 0u);
+    EXPECT_GE(phaseStats.meanMs, 0.0);
+    EXPECT_LE(phaseStats.p50Ms, phaseStats.p99Ms);
+    EXPECT_LE(phaseStats.p99Ms, phaseStats.maxMs);
+  }
+
+  // All three phases of the added system were timed
+  EXPECT_EQ(1u, phases.count("pre_update"));
+  EXPECT_EQ(1u, phases.count("update"));
+  EXPECT_EQ(1u, phases.count("post_update"));
+}
+
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, BranchableSnapshots)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create simulation runner
+  auto systemLoader = std::make_shared<SystemLoader>();
+  SimulationRunner runner(*root.WorldByIndex(0), systemLoader);
+
+  // Nothing is retained while snapshots are disabled
+  EXPECT_TRUE(runner.SnapshotPoints().empty());
+
+  runner.SetSnapshotCadence(5, 4);
+
+  runner.SetPaused(false);
+  EXPECT_TRUE(runner.Run(20));
+
+  auto points = runner.SnapshotPoints();
+  ASSERT_FALSE(points.empty());
+  EXPECT_LE(points.size(), 4u);
+
+  // Points are retained oldest first
+  for (std::size_t i = 1; i < points.size(); ++i)
+    EXPECT_LT(points[i - 1].first, points[i].first);
+
+  // An iteration that was never retained cannot be forked
+  EXPECT_EQ(nullptr, runner.ForkSnapshot(points.back().first + 1));
+
+  // Forking a retained point yields an independent ECM with the same
+  // world content
+  auto forked = runner.ForkSnapshot(points.back().first);
+  ASSERT_NE(nullptr, forked);
+  EXPECT_NE(forked.get(), &runner.EntityCompMgr());
+  EXPECT_EQ(runner.EntityCompMgr().EntityCount(), forked->EntityCount());
+
+  // Mutating the fork does not touch the live world
+  const auto liveCount = runner.EntityCompMgr().EntityCount();
+  forked->CreateEntity();
+  EXPECT_EQ(liveCount, runner.EntityCompMgr().EntityCount());
+
+  // Disabling snapshots discards the retained points
+  runner.SetSnapshotCadence(0);
+  EXPECT_TRUE(runner.SnapshotPoints().empty());
+}
+
 /////////////////////////////////////////////////
 // See https://github.com/gazebosim/gz-sim/issues/1175
 TEST_P(SimulationRunnerTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(LoadPlugins) )
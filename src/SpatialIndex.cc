@@ -0,0 +1,503 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "gz/sim/SpatialIndex.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/math/Helpers.hh>
+#include <gz/math/Pose3.hh>
+#include <sdf/Box.hh>
+#include <sdf/Capsule.hh>
+#include <sdf/Cylinder.hh>
+#include <sdf/Ellipsoid.hh>
+#include <sdf/Geometry.hh>
+#include <sdf/Mesh.hh>
+#include <sdf/Sphere.hh>
+
+#include "gz/sim/components/Geometry.hh"
+#include "gz/sim/components/Pose.hh"
+#include "gz/sim/Util.hh"
+
+using namespace gz;
+using namespace sim;
+
+namespace
+{
+/// \brief One indexed entity.
+struct IndexEntry
+{
+  /// \brief The indexed entity.
+  Entity entity{kNullEntity};
+
+  /// \brief Bounding box of the geometry in the entity's own frame.
+  math::AxisAlignedBox localBox;
+
+  /// \brief Bounding box in world coordinates.
+  math::AxisAlignedBox worldBox;
+};
+
+/// \brief Node of the AABB tree. Leaves reference an entry; internal
+/// nodes cover the union of their children. Children always have larger
+/// indices than their parent, so a reverse pass refits the tree
+/// bottom-up.
+struct TreeNode
+{
+  /// \brief Bounds of everything below this node.
+  math::AxisAlignedBox box;
+
+  /// \brief Index of the left child, -1 for leaves.
+  int left{-1};
+
+  /// \brief Index of the right child, -1 for leaves.
+  int right{-1};
+
+  /// \brief Index of the entry a leaf references, -1 for internal nodes.
+  int entry{-1};
+};
+
+//////////////////////////////////////////////////
+/// \brief Compute the bounding box of a geometry in its own frame.
+/// \param[in] _geom Geometry to measure.
+/// \return The box, or nullopt for geometry types without a finite box
+/// (planes, heightmaps) or meshes that cannot be loaded.
+std::optional<math::AxisAlignedBox> LocalGeometryBox(
+    const sdf::Geometry &_geom)
+{
+  switch (_geom.Type())
+  {
+    case sdf::GeometryType::BOX:
+    {
+      const auto half = _geom.BoxShape()->Size() / 2.0;
+      return math::AxisAlignedBox(-half, half);
+    }
+    case sdf::GeometryType::SPHERE:
+    {
+      const auto r = _geom.SphereShape()->Radius();
+      return math::AxisAlignedBox({-r, -r, -r}, {r, r, r});
+    }
+    case sdf::GeometryType::CYLINDER:
+    {
+      const auto r = _geom.CylinderShape()->Radius();
+      const auto halfLength = _geom.CylinderShape()->Length() / 2.0;
+      return math::AxisAlignedBox({-r, -r, -halfLength},
+                                  {r, r, halfLength});
+    }
+    case sdf::GeometryType::CAPSULE:
+    {
+      const auto r = _geom.CapsuleShape()->Radius();
+      const auto halfHeight = _geom.CapsuleShape()->Length() / 2.0 + r;
+      return math::AxisAlignedBox({-r, -r, -halfHeight},
+                                  {r, r, halfHeight});
+    }
+    case sdf::GeometryType::ELLIPSOID:
+    {
+      const auto radii = _geom.EllipsoidShape()->Radii();
+      return math::AxisAlignedBox(-radii, radii);
+    }
+    case sdf::GeometryType::MESH:
+    {
+      auto mesh = loadMesh(*_geom.MeshShape());
+      if (nullptr == mesh)
+        return std::nullopt;
+      const auto scale = _geom.MeshShape()->Scale();
+      return math::AxisAlignedBox(mesh->Min() * scale, mesh->Max() * scale);
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Transform a local bounding box into world coordinates.
+/// \param[in] _box Box in the entity's frame.
+/// \param[in] _pose World pose of the entity.
+/// \return The axis-aligned bounds of the transformed box.
+math::AxisAlignedBox TransformBox(const math::AxisAlignedBox &_box,
+    const math::Pose3d &_pose)
+{
+  const auto &min = _box.Min();
+  const auto &max = _box.Max();
+  math::Vector3d worldMin(math::MAX_D, math::MAX_D, math::MAX_D);
+  math::Vector3d worldMax(math::LOW_D, math::LOW_D, math::LOW_D);
+  for (int i = 0; i < 8; ++i)
+  {
+    const math::Vector3d corner(
+        (i & 1) ? max.X() : min.X(),
+        (i & 2) ? max.Y() : min.Y(),
+        (i & 4) ? max.Z() : min.Z());
+    const auto world = _pose.Rot().RotateVector(corner) + _pose.Pos();
+    worldMin.Min(world);
+    worldMax.Max(world);
+  }
+  return math::AxisAlignedBox(worldMin, worldMax);
+}
+
+//////////////////////////////////////////////////
+/// \brief Slab test for a ray against a box.
+/// \param[in] _box Box to test.
+/// \param[in] _origin Ray origin.
+/// \param[in] _direction Ray direction.
+/// \param[in] _maxDistance Hits beyond this distance are rejected.
+/// \param[out] _distance Distance to the box entry point, zero when the
+/// origin is inside the box.
+/// \return True if the ray passes through the box within _maxDistance.
+bool RayIntersects(const math::AxisAlignedBox &_box,
+    const math::Vector3d &_origin, const math::Vector3d &_direction,
+    double _maxDistance, double &_distance)
+{
+  double tMin = 0.0;
+  double tMax = _maxDistance;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double o = _origin[axis];
+    const double d = _direction[axis];
+    const double lo = _box.Min()[axis];
+    const double hi = _box.Max()[axis];
+    if (std::abs(d) < 1e-12)
+    {
+      if (o < lo || o > hi)
+        return false;
+      continue;
+    }
+    double t1 = (lo - o) / d;
+    double t2 = (hi - o) / d;
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax)
+      return false;
+  }
+  _distance = tMin;
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Check whether a sphere intersects a box by clamping the sphere
+/// center onto the box.
+/// \param[in] _box Box to test.
+/// \param[in] _center Sphere center.
+/// \param[in] _radius Sphere radius.
+/// \return True if the sphere and the box overlap.
+bool SphereIntersects(const math::AxisAlignedBox &_box,
+    const math::Vector3d &_center, double _radius)
+{
+  double distSquared = 0.0;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double v = _center[axis];
+    const double lo = _box.Min()[axis];
+    const double hi = _box.Max()[axis];
+    if (v < lo)
+      distSquared += (lo - v) * (lo - v);
+    else if (v > hi)
+      distSquared += (v - hi) * (v - hi);
+  }
+  return distSquared <= _radius * _radius;
+}
+}  // namespace
+
+class gz::sim::SpatialIndexPrivate
+{
+  /// \brief Build a subtree over a range of _items and return its node
+  /// index. The parent node is created before its children, which the
+  /// bottom-up refit pass relies on.
+  /// \param[in, out] _items Entry indices, partially sorted in place.
+  /// \param[in] _begin First item of the range.
+  /// \param[in] _end One past the last item of the range.
+  /// \return Index of the created node.
+  public: int BuildNode(std::vector<std::size_t> &_items,
+      std::size_t _begin, std::size_t _end);
+
+  /// \brief Recompute every node box from the current entry boxes
+  /// without changing the tree topology.
+  public: void Refit();
+
+  /// \brief Indexed entities, in ECM iteration order.
+  public: std::vector<IndexEntry> entries;
+
+  /// \brief Nodes of the AABB tree; the root is node 0 when non-empty.
+  public: std::vector<TreeNode> nodes;
+
+  /// \brief Map from entity to its index in entries.
+  public: std::unordered_map<Entity, std::size_t> entryIndex;
+
+  /// \brief Cached local geometry boxes, nullopt for entities whose
+  /// geometry cannot be indexed. Avoids re-measuring (and for meshes,
+  /// re-loading) geometry every update.
+  public: std::unordered_map<Entity,
+      std::optional<math::AxisAlignedBox>> localBoxes;
+};
+
+//////////////////////////////////////////////////
+int SpatialIndexPrivate::BuildNode(std::vector<std::size_t> &_items,
+    std::size_t _begin, std::size_t _end)
+{
+  const int nodeIndex = static_cast<int>(this->nodes.size());
+  this->nodes.emplace_back();
+
+  if (_end - _begin == 1)
+  {
+    auto &node = this->nodes[nodeIndex];
+    node.entry = static_cast<int>(_items[_begin]);
+    node.box = this->entries[_items[_begin]].worldBox;
+    return nodeIndex;
+  }
+
+  // Split at the median centroid along the longest axis of the centroid
+  // bounds. Not the best possible tree, but cheap to build and balanced.
+  math::Vector3d centroidMin(math::MAX_D, math::MAX_D, math::MAX_D);
+  math::Vector3d centroidMax(math::LOW_D, math::LOW_D, math::LOW_D);
+  for (std::size_t i = _begin; i < _end; ++i)
+  {
+    const auto centroid = this->entries[_items[i]].worldBox.Center();
+    centroidMin.Min(centroid);
+    centroidMax.Max(centroid);
+  }
+  const auto extent = centroidMax - centroidMin;
+  int axis = 0;
+  if (extent.Y() > extent.X())
+    axis = 1;
+  if (extent.Z() > extent[axis])
+    axis = 2;
+
+  const auto mid = _begin + (_end - _begin) / 2;
+  std::nth_element(_items.begin() + _begin, _items.begin() + mid,
+      _items.begin() + _end,
+      [this, axis](std::size_t _a, std::size_t _b)
+      {
+        return this->entries[_a].worldBox.Center()[axis] <
+               this->entries[_b].worldBox.Center()[axis];
+      });
+
+  const int left = this->BuildNode(_items, _begin, mid);
+  const int right = this->BuildNode(_items, mid, _end);
+
+  // Re-resolve the node reference: the vector may have reallocated while
+  // the children were built.
+  auto &node = this->nodes[nodeIndex];
+  node.left = left;
+  node.right = right;
+  node.box = this->nodes[left].box;
+  node.box.Merge(this->nodes[right].box);
+  return nodeIndex;
+}
+
+//////////////////////////////////////////////////
+void SpatialIndexPrivate::Refit()
+{
+  for (auto it = this->nodes.rbegin(); it != this->nodes.rend(); ++it)
+  {
+    if (it->entry >= 0)
+    {
+      it->box = this->entries[it->entry].worldBox;
+    }
+    else
+    {
+      it->box = this->nodes[it->left].box;
+      it->box.Merge(this->nodes[it->right].box);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+SpatialIndex::SpatialIndex()
+  : dataPtr(std::make_unique<SpatialIndexPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+SpatialIndex::~SpatialIndex() = default;
+
+//////////////////////////////////////////////////
+void SpatialIndex::Update(const EntityComponentManager &_ecm)
+{
+  // Collect the indexable entities and their world boxes. The local
+  // geometry boxes are cached across updates; only the world transform
+  // is recomputed.
+  std::vector<IndexEntry> entries;
+  _ecm.Each<components::Pose, components::Geometry>(
+      [&](const Entity &_entity, const components::Pose *,
+          const components::Geometry *_geom) -> bool
+      {
+        auto cached = this->dataPtr->localBoxes.find(_entity);
+        if (cached == this->dataPtr->localBoxes.end())
+        {
+          cached = this->dataPtr->localBoxes.emplace(_entity,
+              LocalGeometryBox(_geom->Data())).first;
+        }
+        if (cached->second.has_value())
+        {
+          entries.push_back({_entity, *cached->second,
+              TransformBox(*cached->second, worldPose(_entity, _ecm))});
+        }
+        return true;
+      });
+
+  // When the entity set is unchanged the tree topology is reused and
+  // only the boxes are refit; otherwise the tree is rebuilt.
+  bool sameEntities = entries.size() == this->dataPtr->entries.size();
+  for (std::size_t i = 0; sameEntities && i < entries.size(); ++i)
+    sameEntities = entries[i].entity == this->dataPtr->entries[i].entity;
+
+  this->dataPtr->entries = std::move(entries);
+
+  if (sameEntities)
+  {
+    this->dataPtr->Refit();
+    return;
+  }
+
+  this->dataPtr->entryIndex.clear();
+  for (std::size_t i = 0; i < this->dataPtr->entries.size(); ++i)
+    this->dataPtr->entryIndex[this->dataPtr->entries[i].entity] = i;
+
+  // Drop cached local boxes of entities that left the index.
+  for (auto it = this->dataPtr->localBoxes.begin();
+       it != this->dataPtr->localBoxes.end();)
+  {
+    if (this->dataPtr->entryIndex.find(it->first) ==
+        this->dataPtr->entryIndex.end())
+      it = this->dataPtr->localBoxes.erase(it);
+    else
+      ++it;
+  }
+
+  this->dataPtr->nodes.clear();
+  if (this->dataPtr->entries.empty())
+    return;
+
+  std::vector<std::size_t> items(this->dataPtr->entries.size());
+  for (std::size_t i = 0; i < items.size(); ++i)
+    items[i] = i;
+  this->dataPtr->nodes.reserve(2 * items.size());
+  this->dataPtr->BuildNode(items, 0, items.size());
+}
+
+//////////////////////////////////////////////////
+std::vector<Entity> SpatialIndex::BoxQuery(
+    const math::AxisAlignedBox &_box) const
+{
+  std::vector<Entity> result;
+  if (this->dataPtr->nodes.empty())
+    return result;
+
+  std::vector<int> stack{0};
+  while (!stack.empty())
+  {
+    const auto &node = this->dataPtr->nodes[stack.back()];
+    stack.pop_back();
+    if (!node.box.Intersects(_box))
+      continue;
+    if (node.entry >= 0)
+    {
+      result.push_back(this->dataPtr->entries[node.entry].entity);
+    }
+    else
+    {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::vector<Entity> SpatialIndex::SphereQuery(
+    const math::Vector3d &_center, double _radius) const
+{
+  std::vector<Entity> result;
+  if (this->dataPtr->nodes.empty())
+    return result;
+
+  std::vector<int> stack{0};
+  while (!stack.empty())
+  {
+    const auto &node = this->dataPtr->nodes[stack.back()];
+    stack.pop_back();
+    if (!SphereIntersects(node.box, _center, _radius))
+      continue;
+    if (node.entry >= 0)
+    {
+      result.push_back(this->dataPtr->entries[node.entry].entity);
+    }
+    else
+    {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::vector<RayHit> SpatialIndex::RayQuery(const math::Vector3d &_origin,
+    const math::Vector3d &_direction, double _maxDistance) const
+{
+  std::vector<RayHit> result;
+  if (this->dataPtr->nodes.empty())
+    return result;
+
+  std::vector<int> stack{0};
+  while (!stack.empty())
+  {
+    const auto &node = this->dataPtr->nodes[stack.back()];
+    stack.pop_back();
+    double distance = 0.0;
+    if (!RayIntersects(node.box, _origin, _direction, _maxDistance,
+        distance))
+      continue;
+    if (node.entry >= 0)
+    {
+      result.push_back({this->dataPtr->entries[node.entry].entity,
+          distance});
+    }
+    else
+    {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+
+  std::sort(result.begin(), result.end(),
+      [](const RayHit &_a, const RayHit &_b)
+      {
+        return _a.distance < _b.distance;
+      });
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::optional<math::AxisAlignedBox> SpatialIndex::EntityBox(
+    const Entity _entity) const
+{
+  auto iter = this->dataPtr->entryIndex.find(_entity);
+  if (iter == this->dataPtr->entryIndex.end())
+    return std::nullopt;
+  return this->dataPtr->entries[iter->second].worldBox;
+}
+
+//////////////////////////////////////////////////
+std::size_t SpatialIndex::EntryCount() const
+{
+  return this->dataPtr->entries.size();
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <sdf/Box.hh>
+#include <sdf/Geometry.hh>
+
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/SpatialIndex.hh"
+#include "gz/sim/components/Geometry.hh"
+#include "gz/sim/components/ParentEntity.hh"
+#include "gz/sim/components/Pose.hh"
+
+using namespace gz;
+using namespace sim;
+
+//////////////////////////////////////////////////
+/// \brief Create an entity with a pose and a box geometry.
+Entity createBoxEntity(EntityComponentManager &_ecm,
+    const math::Pose3d &_pose, const math::Vector3d &_size)
+{
+  auto entity = _ecm.CreateEntity();
+  _ecm.CreateComponent(entity, components::Pose(_pose));
+
+  sdf::Box box;
+  box.SetSize(_size);
+  sdf::Geometry geom;
+  geom.SetType(sdf::GeometryType::BOX);
+  geom.SetBoxShape(box);
+  _ecm.CreateComponent(entity, components::Geometry(geom));
+  return entity;
+}
+
+//////////////////////////////////////////////////
+TEST(SpatialIndex, BoxAndSphereQueries)
+{
+  EntityComponentManager ecm;
+  auto e1 = createBoxEntity(ecm, {0, 0, 0, 0, 0, 0}, {1, 1, 1});
+  auto e2 = createBoxEntity(ecm, {10, 0, 0, 0, 0, 0}, {2, 2, 2});
+  auto e3 = createBoxEntity(ecm, {0, 10, 0, 0, 0, 0}, {1, 1, 1});
+
+  SpatialIndex index;
+  index.Update(ecm);
+  EXPECT_EQ(3u, index.EntryCount());
+
+  auto hits = index.BoxQuery(math::AxisAlignedBox({-1, -1, -1}, {1, 1, 1}));
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e1, hits[0]);
+
+  // A box covering everything returns every entity.
+  hits = index.BoxQuery(math::AxisAlignedBox({-20, -20, -20}, {20, 20, 20}));
+  EXPECT_EQ(3u, hits.size());
+  EXPECT_NE(hits.end(), std::find(hits.begin(), hits.end(), e2));
+
+  hits = index.SphereQuery({0, 9, 0}, 1.0);
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e3, hits[0]);
+
+  // A sphere that touches nothing.
+  hits = index.SphereQuery({0, 0, 50}, 1.0);
+  EXPECT_TRUE(hits.empty());
+
+  auto box = index.EntityBox(e2);
+  ASSERT_TRUE(box.has_value());
+  EXPECT_EQ(math::Vector3d(9, -1, -1), box->Min());
+  EXPECT_EQ(math::Vector3d(11, 1, 1), box->Max());
+  EXPECT_FALSE(index.EntityBox(kNullEntity).has_value());
+}
+
+//////////////////////////////////////////////////
+TEST(SpatialIndex, RayQueryOrdering)
+{
+  EntityComponentManager ecm;
+  auto e1 = createBoxEntity(ecm, {0, 0, 0, 0, 0, 0}, {1, 1, 1});
+  auto e2 = createBoxEntity(ecm, {10, 0, 0, 0, 0, 0}, {2, 2, 2});
+  createBoxEntity(ecm, {0, 10, 0, 0, 0, 0}, {1, 1, 1});
+
+  SpatialIndex index;
+  index.Update(ecm);
+
+  // The ray along +X passes through e1 and then e2.
+  auto hits = index.RayQuery({-5, 0, 0}, {1, 0, 0});
+  ASSERT_EQ(2u, hits.size());
+  EXPECT_EQ(e1, hits[0].entity);
+  EXPECT_EQ(e2, hits[1].entity);
+  EXPECT_DOUBLE_EQ(4.5, hits[0].distance);
+  EXPECT_DOUBLE_EQ(14.0, hits[1].distance);
+
+  // A maximum distance cuts off the farther hit.
+  hits = index.RayQuery({-5, 0, 0}, {1, 0, 0}, 6.0);
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e1, hits[0].entity);
+
+  // A ray starting inside a box reports distance zero.
+  hits = index.RayQuery({0, 0, 0}, {0, 0, 1}, 1.0);
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e1, hits[0].entity);
+  EXPECT_DOUBLE_EQ(0.0, hits[0].distance);
+}
+
+//////////////////////////////////////////////////
+TEST(SpatialIndex, RefitAndRebuild)
+{
+  EntityComponentManager ecm;
+  auto e1 = createBoxEntity(ecm, {0, 0, 0, 0, 0, 0}, {1, 1, 1});
+  auto e2 = createBoxEntity(ecm, {10, 0, 0, 0, 0, 0}, {2, 2, 2});
+
+  SpatialIndex index;
+  index.Update(ecm);
+  EXPECT_EQ(2u, index.EntryCount());
+
+  // Moving an entity is picked up by a refit.
+  ecm.SetComponentData<components::Pose>(e2,
+      math::Pose3d(0, 0, 20, 0, 0, 0));
+  index.Update(ecm);
+
+  auto hits = index.SphereQuery({0, 0, 20}, 0.5);
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e2, hits[0]);
+
+  // A new entity changes the indexed set and triggers a rebuild.
+  auto e3 = createBoxEntity(ecm, {-10, 0, 0, 0, 0, 0}, {1, 1, 1});
+  index.Update(ecm);
+  EXPECT_EQ(3u, index.EntryCount());
+
+  hits = index.BoxQuery(math::AxisAlignedBox({-11, -1, -1}, {-9, 1, 1}));
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e3, hits[0]);
+
+  hits = index.BoxQuery(math::AxisAlignedBox({-1, -1, -1}, {1, 1, 1}));
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(e1, hits[0]);
+}
+
+//////////////////////////////////////////////////
+TEST(SpatialIndex, ChildPosesAreResolvedToWorld)
+{
+  EntityComponentManager ecm;
+
+  // A parent model offset from the origin with a child at a local offset.
+  auto parent = ecm.CreateEntity();
+  ecm.CreateComponent(parent, components::Pose({5, 0, 0, 0, 0, 0}));
+
+  auto child = createBoxEntity(ecm, {0, 3, 0, 0, 0, 0}, {1, 1, 1});
+  ecm.CreateComponent(child, components::ParentEntity(parent));
+
+  SpatialIndex index;
+  index.Update(ecm);
+  ASSERT_EQ(1u, index.EntryCount());
+
+  auto box = index.EntityBox(child);
+  ASSERT_TRUE(box.has_value());
+  EXPECT_EQ(math::Vector3d(4.5, 2.5, -0.5), box->Min());
+  EXPECT_EQ(math::Vector3d(5.5, 3.5, 0.5), box->Max());
+}
@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -54,6 +55,10 @@ namespace gz
                 preupdate(systemPlugin->QueryInterface<ISystemPreUpdate>()),
                 update(systemPlugin->QueryInterface<ISystemUpdate>()),
                 postupdate(systemPlugin->QueryInterface<ISystemPostUpdate>()),
+                componentAccess(
+                  systemPlugin->QueryInterface<ISystemComponentAccess>()),
+                configureUpdateFrequency(
+                  systemPlugin->QueryInterface<ISystemConfigureUpdateFrequency>()),
                 parentEntity(_entity)
       {
       }
@@ -74,6 +79,11 @@ namespace gz
                 preupdate(dynamic_cast<ISystemPreUpdate *>(_system.get())),
                 update(dynamic_cast<ISystemUpdate *>(_system.get())),
                 postupdate(dynamic_cast<ISystemPostUpdate *>(_system.get())),
+                componentAccess(
+                  dynamic_cast<ISystemComponentAccess *>(_system.get())),
+                configureUpdateFrequency(
+                  dynamic_cast<ISystemConfigureUpdateFrequency *>(
+                    _system.get())),
                 parentEntity(_entity)
       {
       }
@@ -120,6 +130,27 @@ namespace gz
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemPostUpdate *postupdate = nullptr;
 
+      /// \brief Access this system via the ISystemComponentAccess interface
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemComponentAccess *componentAccess = nullptr;
+
+      /// \brief Access this system via the ISystemConfigureUpdateFrequency
+      ///   interface.
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemConfigureUpdateFrequency *configureUpdateFrequency =
+          nullptr;
+
+      /// \brief Minimum simulation time between update phase invocations,
+      /// resolved from the declared update frequency or the XML frequency
+      /// element. A zero period runs the system every step.
+      public: std::chrono::steady_clock::duration updatePeriod{0};
+
+      /// \brief Simulation time at which the system last ran. Unset until the
+      /// system has run once, so a throttled system always runs on its first
+      /// step.
+      public: std::optional<std::chrono::steady_clock::duration>
+          lastUpdateTime;
+
       /// \brief Entity that the system is attached to. It's passed to the
       /// system during the `Configure` call.
       public: Entity parentEntity = {kNullEntity};
@@ -15,10 +15,14 @@
  *
 */
 
+#include <filesystem>
+#include <fstream>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include <gz/sim/SystemLoader.hh>
 
@@ -42,6 +46,12 @@ class gz::sim::SystemLoaderPrivate
   //////////////////////////////////////////////////
   public: explicit SystemLoaderPrivate() = default;
 
+  //////////////////////////////////////////////////
+  public: ~SystemLoaderPrivate()
+  {
+    this->SaveResolutionCache();
+  }
+
   //////////////////////////////////////////////////
   public: std::list<std::string> PluginPaths() const
   {
@@ -60,6 +70,116 @@ class gz::sim::SystemLoaderPrivate
     return systemPaths.PluginPaths();
   }
 
+  //////////////////////////////////////////////////
+  /// \brief Path of the per-user plugin resolution cache file.
+  public: static std::string ResolutionCachePath()
+  {
+    std::string homePath;
+    common::env(GZ_HOMEDIR, homePath);
+    return common::joinPaths(homePath, ".gz", "sim",
+        "plugin_path_cache.txt");
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Modification time of a file as a string, empty if the file
+  /// can't be inspected. Used to detect stale cache entries.
+  public: static std::string MTimeString(const std::string &_path)
+  {
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(_path, ec);
+    if (ec)
+      return "";
+    return std::to_string(mtime.time_since_epoch().count());
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Load the resolution cache from disk. Each line holds a
+  /// library filename, its resolved path and the path's modification
+  /// time, tab-separated; unparsable lines are skipped.
+  public: void LoadResolutionCache()
+  {
+    this->resolutionCacheLoaded = true;
+    std::ifstream file(ResolutionCachePath());
+    if (!file)
+      return;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+      const auto parts = common::Split(line, '\t');
+      if (parts.size() != 3 || parts[0].empty() || parts[1].empty())
+        continue;
+      this->resolutionCache[parts[0]] = std::make_pair(parts[1], parts[2]);
+    }
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Write the resolution cache back to disk if it changed.
+  /// Concurrent servers may race on the file; it is only a cache, so the
+  /// last writer wins and losers merely re-resolve on their next start.
+  public: void SaveResolutionCache() const
+  {
+    if (!this->resolutionCacheDirty)
+      return;
+
+    const auto cachePath = ResolutionCachePath();
+    const auto cacheDir = common::parentPath(cachePath);
+    if (!common::exists(cacheDir) && !common::createDirectories(cacheDir))
+      return;
+
+    std::ofstream file(cachePath, std::ios::trunc);
+    if (!file)
+      return;
+    for (const auto &[filename, entry] : this->resolutionCache)
+    {
+      file << filename << '\t' << entry.first << '\t' << entry.second
+           << '\n';
+    }
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Look up a library filename in the resolution cache.
+  /// \param[in] _filename Library filename, e.g. gz-sim-physics-system.
+  /// \return Cached library path, or empty if the entry is missing or the
+  /// library changed on disk since it was cached.
+  public: std::string CachedLibraryPath(const std::string &_filename)
+  {
+    if (!this->resolutionCacheLoaded)
+      this->LoadResolutionCache();
+
+    auto it = this->resolutionCache.find(_filename);
+    if (it == this->resolutionCache.end())
+      return "";
+
+    const auto mtime = MTimeString(it->second.first);
+    if (mtime.empty() || mtime != it->second.second)
+    {
+      this->resolutionCache.erase(it);
+      this->resolutionCacheDirty = true;
+      return "";
+    }
+    return it->second.first;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Record a freshly resolved library path in the cache.
+  /// \param[in] _filename Library filename that was resolved.
+  /// \param[in] _path Resolved library path.
+  public: void RecordResolution(const std::string &_filename,
+              const std::string &_path)
+  {
+    const auto mtime = MTimeString(_path);
+    if (mtime.empty())
+      return;
+
+    const auto entry = std::make_pair(_path, mtime);
+    auto it = this->resolutionCache.find(_filename);
+    if (it != this->resolutionCache.end() && it->second == entry)
+      return;
+    this->resolutionCache[_filename] = entry;
+    this->resolutionCacheDirty = true;
+  }
+
   //////////////////////////////////////////////////
   public: bool InstantiateSystemPlugin(const sdf::Plugin &_sdfPlugin,
               gz::plugin::PluginPtr &_gzPlugin)
@@ -75,14 +195,23 @@ class gz::sim::SystemLoaderPrivate
              << "]. Using [" << filename << "] instead." << std::endl;
     }
 
-    const std::list<std::string> paths = this->PluginPaths();
-    common::SystemPaths systemPaths;
-    for (const auto &p : paths)
+    // The per-user cache maps filenames resolved on an earlier run to
+    // their library paths, validated by modification time, so a restart
+    // skips the directory scans below.
+    auto pathToLib = this->CachedLibraryPath(filename);
+    if (pathToLib.empty())
     {
-      systemPaths.AddPluginPaths(p);
-    }
+      const std::list<std::string> paths = this->PluginPaths();
+      common::SystemPaths systemPaths;
+      for (const auto &p : paths)
+      {
+        systemPaths.AddPluginPaths(p);
+      }
 
-    const auto pathToLib = systemPaths.FindSharedLibrary(filename);
+      pathToLib = systemPaths.FindSharedLibrary(filename);
+      if (!pathToLib.empty())
+        this->RecordResolution(filename, pathToLib);
+    }
     if (pathToLib.empty())
     {
       // We assume gz::sim corresponds to the levels feature
@@ -205,6 +334,17 @@ class gz::sim::SystemLoaderPrivate
 
   /// \brief Paths to search for system plugins.
   public: std::unordered_set<std::string> systemPluginPaths;
+
+  /// \brief Per-user cache of library filename to resolved path and the
+  /// path's modification time at resolution, persisted across runs.
+  public: std::unordered_map<std::string,
+      std::pair<std::string, std::string>> resolutionCache;
+
+  /// \brief Whether resolutionCache has been read from disk.
+  public: bool resolutionCacheLoaded{false};
+
+  /// \brief Whether resolutionCache has entries not yet written to disk.
+  public: bool resolutionCacheDirty{false};
 };
 
 //////////////////////////////////////////////////
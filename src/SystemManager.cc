@@ -15,11 +15,16 @@
  *
 */
 
+#include <chrono>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gz/common/StringUtils.hh>
 
@@ -130,6 +135,30 @@ size_t SystemManager::ActivatePendingSystems()
       p = newPriority;
     }
 
+    double frequency{0.0};
+    if (system.configureUpdateFrequency)
+    {
+      frequency = system.configureUpdateFrequency->ConfigureUpdateFrequency();
+    }
+    const std::string kUpdateFrequencyElementName
+        {gz::sim::System::kUpdateFrequencyElementName};
+    if (system.configureSdf &&
+        system.configureSdf->HasElement(kUpdateFrequencyElementName))
+    {
+      double newFrequency =
+          system.configureSdf->Get<double>(kUpdateFrequencyElementName);
+      gzdbg << "Changing update frequency for system [" << system.name
+            << "] from {" << frequency
+            << "} to {" << newFrequency << "}\n";
+      frequency = newFrequency;
+    }
+    if (frequency > 0.0)
+    {
+      this->systems.back().updatePeriod =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double>(1.0 / frequency));
+    }
+
     if (system.configure)
       this->systemsConfigure.push_back(system.configure);
 
@@ -158,9 +187,67 @@ size_t SystemManager::ActivatePendingSystems()
   }
 
   this->pendingSystems.clear();
+
+  if (count > 0)
+    this->RebuildUpdateStages();
+
   return count;
 }
 
+//////////////////////////////////////////////////
+void SystemManager::RebuildUpdateStages()
+{
+  this->updateStages.clear();
+
+  std::unordered_map<ISystemUpdate *, ISystemComponentAccess *>
+      accessByUpdate;
+  for (const auto &system : this->systems)
+  {
+    if (system.update)
+      accessByUpdate[system.update] = system.componentAccess;
+  }
+
+  // Only systems whose declared access is read-only may share a stage:
+  // every write path (SetChanged, SetComponentData and friends) feeds the
+  // ECM change-tracking maps, which are not synchronized for concurrent
+  // writers, so a system that declares writes runs alone even when its
+  // declared sets are disjoint from everything else. Systems without
+  // declarations are exclusive too.
+  std::vector<ISystemUpdate *> stage;
+  bool stageShareable{false};
+
+  auto flushStage = [&]()
+  {
+    if (!stage.empty())
+      this->updateStages.push_back(std::move(stage));
+    stage.clear();
+    stageShareable = false;
+  };
+
+  for (const auto &[priority, systems] : this->systemsUpdate)
+  {
+    // Systems of different priorities never share a stage
+    flushStage();
+    for (const auto &system : systems)
+    {
+      auto accessIter = accessByUpdate.find(system);
+      auto *access = accessIter != accessByUpdate.end() ?
+          accessIter->second : nullptr;
+      const bool shareable = nullptr != access &&
+          access->UpdateComponentWrites().empty();
+
+      // Only append to the most recent stage so that systems keep their
+      // relative execution order
+      if (!stage.empty() && (!stageShareable || !shareable))
+        flushStage();
+
+      stage.push_back(system);
+      stageShareable = shareable;
+    }
+  }
+  flushStage();
+}
+
 //////////////////////////////////////////////////
 /// \brief Structure to temporarily store plugin information for reset
 struct PluginInfo {
@@ -188,6 +275,10 @@ void SystemManager::Reset(const UpdateInfo &_info, EntityComponentManager &_ecm)
   this->systemsPreupdate.clear();
   this->systemsUpdate.clear();
   this->systemsPostupdate.clear();
+  this->updateStages.clear();
+  this->throttledPreupdate.clear();
+  this->throttledUpdate.clear();
+  this->throttledPostupdate.clear();
 
   std::vector<PluginInfo> pluginsToBeLoaded;
 
@@ -276,7 +367,7 @@ void SystemManager::AddSystemImpl(
     if (_sdf)
     {
       auto pluginMsg = systemInfoMsg.add_plugins();
-      pluginMsg->CopyFrom(convert<msgs::Plugin>(*_sdf.get()));
+      set(pluginMsg, *_sdf.get());
     }
 
     this->entityCompMgr->SetComponentData<components::SystemPluginInfo>(
@@ -288,9 +379,13 @@ void SystemManager::AddSystemImpl(
   // Configure the system, if necessary
   if (_system.configure && this->entityCompMgr && this->eventMgr)
   {
+    const auto configureStart = std::chrono::steady_clock::now();
     _system.configure->Configure(_system.parentEntity, _sdf,
                                  *this->entityCompMgr,
                                  *this->eventMgr);
+    this->configureTimings.emplace_back(
+        !_system.name.empty() ? _system.name : _system.fname,
+        std::chrono::steady_clock::now() - configureStart);
   }
 
   // Configure the system parameters, if necessary
@@ -308,6 +403,14 @@ void SystemManager::AddSystemImpl(
   this->pendingSystems.push_back(_system);
 }
 
+//////////////////////////////////////////////////
+const std::vector<std::pair<std::string,
+    std::chrono::steady_clock::duration>> &
+SystemManager::ConfigureTimings() const
+{
+  return this->configureTimings;
+}
+
 //////////////////////////////////////////////////
 const std::vector<ISystemConfigure *>& SystemManager::SystemsConfigure()
 {
@@ -341,6 +444,13 @@ SystemManager::SystemsUpdate()
   return this->systemsUpdate;
 }
 
+//////////////////////////////////////////////////
+const std::vector<std::vector<ISystemUpdate *>>&
+SystemManager::UpdateStages()
+{
+  return this->updateStages;
+}
+
 //////////////////////////////////////////////////
 const std::vector<ISystemPostUpdate *>& SystemManager::SystemsPostUpdate()
 {
@@ -363,12 +473,122 @@ std::vector<SystemInternal> SystemManager::TotalByEntity(Entity _entity)
   return result;
 }
 
+//////////////////////////////////////////////////
+std::string SystemManager::SystemName(const ISystemPreUpdate *_system) const
+{
+  for (const auto &system : this->systems)
+  {
+    if (system.preupdate == _system)
+      return system.name;
+  }
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+std::string SystemManager::SystemName(const ISystemUpdate *_system) const
+{
+  for (const auto &system : this->systems)
+  {
+    if (system.update == _system)
+      return system.name;
+  }
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+std::string SystemManager::SystemName(const ISystemPostUpdate *_system) const
+{
+  for (const auto &system : this->systems)
+  {
+    if (system.postupdate == _system)
+      return system.name;
+  }
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+void SystemManager::UpdateThrottling(const UpdateInfo &_info)
+{
+  for (auto &system : this->systems)
+  {
+    if (system.updatePeriod <= std::chrono::steady_clock::duration::zero())
+      continue;
+
+    // A throttled system runs on its first step, whenever its period has
+    // elapsed, and after simulation time jumps backwards (e.g. rewind).
+    const bool due = !system.lastUpdateTime.has_value() ||
+        _info.simTime < *system.lastUpdateTime ||
+        _info.simTime - *system.lastUpdateTime >= system.updatePeriod;
+
+    if (due)
+    {
+      system.lastUpdateTime = _info.simTime;
+      if (system.preupdate)
+        this->throttledPreupdate.erase(system.preupdate);
+      if (system.update)
+        this->throttledUpdate.erase(system.update);
+      if (system.postupdate)
+        this->throttledPostupdate.erase(system.postupdate);
+    }
+    else
+    {
+      if (system.preupdate)
+        this->throttledPreupdate.insert(system.preupdate);
+      if (system.update)
+        this->throttledUpdate.insert(system.update);
+      if (system.postupdate)
+        this->throttledPostupdate.insert(system.postupdate);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+bool SystemManager::Throttled(ISystemPreUpdate *_system) const
+{
+  return this->throttledPreupdate.count(_system) != 0;
+}
+
+//////////////////////////////////////////////////
+bool SystemManager::Throttled(ISystemUpdate *_system) const
+{
+  return this->throttledUpdate.count(_system) != 0;
+}
+
+//////////////////////////////////////////////////
+bool SystemManager::Throttled(ISystemPostUpdate *_system) const
+{
+  return this->throttledPostupdate.count(_system) != 0;
+}
+
 //////////////////////////////////////////////////
 bool SystemManager::EntitySystemAddService(const msgs::EntityPlugin_V &_req,
                                            msgs::Boolean &_res)
 {
-  std::lock_guard<std::mutex> lock(this->systemsMsgMutex);
-  this->systemsToAdd.push_back(_req);
+  if (_req.plugins().empty())
+  {
+    gzerr << "Unable to add plugins to Entity: '" << _req.entity().id()
+          << "'. No plugins specified." << std::endl;
+  }
+
+  // Load the plugin libraries here, on the transport thread, so that the
+  // step loop only pays for Configure and activation. Loading can block on
+  // disk I/O and must not stall a running simulation.
+  for (const auto &pluginMsg : _req.plugins())
+  {
+    sdf::Plugin pluginSDF(pluginMsg.filename(), pluginMsg.name(),
+        pluginMsg.innerxml());
+    std::optional<SystemPluginPtr> system;
+    {
+      std::lock_guard<std::mutex> lock(this->systemLoaderMutex);
+      system = this->systemLoader->LoadPlugin(pluginSDF);
+    }
+    if (!system)
+      continue;
+
+    std::lock_guard<std::mutex> lock(this->systemsMsgMutex);
+    this->systemsToAdd.push_back({static_cast<Entity>(_req.entity().id()),
+        std::move(system.value()), std::move(pluginSDF)});
+  }
 
   // The response is set to true to indicate that the service request is
   // handled but it does not necessarily mean the system is added
@@ -426,24 +646,24 @@ bool SystemManager::EntitySystemInfoService(const msgs::Empty &,
 //////////////////////////////////////////////////
 void SystemManager::ProcessPendingEntitySystems()
 {
-  std::lock_guard<std::mutex> lock(this->systemsMsgMutex);
-  for (auto &req : this->systemsToAdd)
+  // Swap the staged list out so the transport thread is only ever blocked
+  // for the duration of the swap, never while systems are configured.
+  std::vector<StagedSystemPlugin> staged;
   {
-    Entity entity = req.entity().id();
+    std::lock_guard<std::mutex> lock(this->systemsMsgMutex);
+    staged.swap(this->systemsToAdd);
+  }
 
-    if (req.plugins().empty())
-    {
-      gzerr << "Unable to add plugins to Entity: '" << entity
-            << "'. No plugins specified." << std::endl;
-       continue;
-    }
+  for (auto &pending : staged)
+  {
+    Entity entity = pending.entity;
 
     // set to world entity if entity id is not specified in the request.
     if (entity == kNullEntity || entity == 0u)
     {
       entity = worldEntity(*this->entityCompMgr);
     }
-    // otherwise check if entity exists before attempting to load the plugin.
+    // otherwise check if entity exists before adding the system.
     else if (!this->entityCompMgr->HasEntity(entity))
     {
       gzerr << "Unable to add plugins to Entity: '" << entity
@@ -451,16 +671,14 @@ void SystemManager::ProcessPendingEntitySystems()
        continue;
     }
 
-    for (auto &pluginMsg : req.plugins())
-    {
-      std::string fname = pluginMsg.filename();
-      std::string name = pluginMsg.name();
-      std::string innerxml = pluginMsg.innerxml();
-      sdf::Plugin pluginSDF(fname, name, innerxml);
-      this->LoadPlugin(entity, pluginSDF);
-    }
+    SystemInternal ss(std::move(pending.plugin), entity);
+    ss.fname = pending.sdf.Filename();
+    ss.name = pending.sdf.Name();
+    ss.configureSdf = pending.sdf.ToElement();
+    this->AddSystemImpl(ss, ss.configureSdf);
+    gzdbg << "Loaded system [" << ss.name
+          << "] for entity [" << entity << "]" << std::endl;
   }
-  this->systemsToAdd.clear();
 }
 
 template <typename T>
@@ -605,4 +823,16 @@ void SystemManager::ProcessRemovedEntities(
     [&](const SystemInternal& _system) {
       return _ecm.IsMarkedForRemoval(_system.parentEntity);
     });
+
+  if (!updateSystemsToBeRemoved.empty())
+    this->RebuildUpdateStages();
+
+  // Drop stale throttle entries; the sets are repopulated on the next
+  // UpdateThrottling call.
+  for (auto *system : preupdateSystemsToBeRemoved)
+    this->throttledPreupdate.erase(system);
+  for (auto *system : updateSystemsToBeRemoved)
+    this->throttledUpdate.erase(system);
+  for (auto *system : postupdateSystemsToBeRemoved)
+    this->throttledPostupdate.erase(system);
 }
@@ -19,10 +19,13 @@
 
 #include <gz/msgs/entity_plugin_v.pb.h>
 
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <sdf/Plugin.hh>
@@ -126,6 +129,14 @@ namespace gz
       /// \return Vector of systems' configure interfaces.
       public: const std::vector<ISystemConfigure *>& SystemsConfigure();
 
+      /// \brief Get the wall-clock duration of every system's Configure
+      /// call, in the order the systems were configured. Entries accumulate
+      /// over the manager's lifetime, so startup telemetry can attribute
+      /// load time to individual systems.
+      /// \return Pairs of system name and Configure duration.
+      public: const std::vector<std::pair<std::string,
+          std::chrono::steady_clock::duration>> &ConfigureTimings() const;
+
       /// \brief Get a vector of all active systems implementing
       ///   "ConfigureParameters"
       /// \return Vector of systems's configure interfaces.
@@ -146,6 +157,16 @@ namespace gz
       /// \return Priortized map of systems's update interfaces.
       public: const PrioritizedSystems<ISystemUpdate *>& SystemsUpdate();
 
+      /// \brief Get the Update systems grouped into sequential stages.
+      /// Systems within a stage declared read-only component access (see
+      /// ISystemComponentAccess) and may be executed concurrently. Stages
+      /// respect priority order and, within a priority, load order.
+      /// Systems that declare writes and systems without access
+      /// declarations always get a stage of their own, because ECM change
+      /// tracking is not safe for concurrent writers.
+      /// \return Stages of update systems.
+      public: const std::vector<std::vector<ISystemUpdate *>>& UpdateStages();
+
       /// \brief Get a vector of all active systems implementing "PostUpdate"
       /// \return Vector of systems's post-update interfaces.
       public: const std::vector<ISystemPostUpdate *>& SystemsPostUpdate();
@@ -154,6 +175,54 @@ namespace gz
       /// \return Vector of systems.
       public: std::vector<SystemInternal> TotalByEntity(Entity _entity);
 
+      /// \brief Get the name of the active system owning a PreUpdate
+      /// interface.
+      /// \param[in] _system Pre-update interface to look up.
+      /// \return The system's plugin name, or an empty string if the system
+      /// is unknown or was added in-memory without a name.
+      public: std::string SystemName(const ISystemPreUpdate *_system) const;
+
+      /// \brief Get the name of the active system owning an Update
+      /// interface.
+      /// \param[in] _system Update interface to look up.
+      /// \return The system's plugin name, or an empty string if the system
+      /// is unknown or was added in-memory without a name.
+      public: std::string SystemName(const ISystemUpdate *_system) const;
+
+      /// \brief Get the name of the active system owning a PostUpdate
+      /// interface.
+      /// \param[in] _system Post-update interface to look up.
+      /// \return The system's plugin name, or an empty string if the system
+      /// is unknown or was added in-memory without a name.
+      public: std::string SystemName(const ISystemPostUpdate *_system) const;
+
+      /// \brief Advance the per-system rate throttling bookkeeping for the
+      /// step described by _info. Systems with a declared update frequency
+      /// (see ISystemConfigureUpdateFrequency or the XML frequency element)
+      /// whose period has not elapsed since they last ran are marked as
+      /// throttled for this step. Must be called once per step before
+      /// querying Throttled().
+      /// \param[in] _info Update info for the current step.
+      public: void UpdateThrottling(const UpdateInfo &_info);
+
+      /// \brief Whether a PreUpdate interface belongs to a system that is
+      /// skipped on the current step due to its declared update frequency.
+      /// \param[in] _system Pre-update interface to query.
+      /// \return True if the system should be skipped this step.
+      public: bool Throttled(ISystemPreUpdate *_system) const;
+
+      /// \brief Whether an Update interface belongs to a system that is
+      /// skipped on the current step due to its declared update frequency.
+      /// \param[in] _system Update interface to query.
+      /// \return True if the system should be skipped this step.
+      public: bool Throttled(ISystemUpdate *_system) const;
+
+      /// \brief Whether a PostUpdate interface belongs to a system that is
+      /// skipped on the current step due to its declared update frequency.
+      /// \param[in] _system Post-update interface to query.
+      /// \return True if the system should be skipped this step.
+      public: bool Throttled(ISystemPostUpdate *_system) const;
+
       /// \brief Process system messages and add systems to entities
       public: void ProcessPendingEntitySystems();
 
@@ -189,6 +258,10 @@ namespace gz
       private: bool EntitySystemAddService(const msgs::EntityPlugin_V &_req,
                                            msgs::Boolean &_res);
 
+      /// \brief Rebuild the Update stages from the current set of active
+      /// systems. Called whenever systems are added or removed.
+      private: void RebuildUpdateStages();
+
       /// \brief Callback for entity info system service.
       /// \param[in] _req Empty request message
       /// \param[out] _res Response containing a list of plugin names
@@ -209,6 +282,10 @@ namespace gz
       /// \brief Systems implementing Configure
       private: std::vector<ISystemConfigure *> systemsConfigure;
 
+      /// \brief Wall-clock duration of every system's Configure call
+      private: std::vector<std::pair<std::string,
+          std::chrono::steady_clock::duration>> configureTimings;
+
       /// \brief Systems implementing ConfigureParameters
       private: std::vector<ISystemConfigureParameters *>
         systemsConfigureParameters;
@@ -222,9 +299,27 @@ namespace gz
       /// \brief Systems implementing Update
       private: PrioritizedSystems<ISystemUpdate *> systemsUpdate;
 
+      /// \brief Update systems grouped into sequential stages of
+      /// non-conflicting systems. Rebuilt whenever systems are added or
+      /// removed.
+      private: std::vector<std::vector<ISystemUpdate *>> updateStages;
+
       /// \brief Systems implementing PostUpdate
       private: std::vector<ISystemPostUpdate *> systemsPostupdate;
 
+      /// \brief PreUpdate interfaces of rate-throttled systems that are
+      /// skipped on the current step. Only ever contains systems with a
+      /// non-zero update period, so lookups stay cheap.
+      private: std::unordered_set<ISystemPreUpdate *> throttledPreupdate;
+
+      /// \brief Update interfaces of rate-throttled systems that are
+      /// skipped on the current step.
+      private: std::unordered_set<ISystemUpdate *> throttledUpdate;
+
+      /// \brief PostUpdate interfaces of rate-throttled systems that are
+      /// skipped on the current step.
+      private: std::unordered_set<ISystemPostUpdate *> throttledPostupdate;
+
       /// \brief System loader, for loading system plugins.
       private: SystemLoaderPtr systemLoader;
 
@@ -237,8 +332,24 @@ namespace gz
       /// \brief Pointer to associated event manager
       private: EventManager *eventMgr;
 
+      /// \brief A runtime-requested system whose library has already been
+      /// loaded on the transport thread and is waiting to be configured and
+      /// activated at a step boundary.
+      private: struct StagedSystemPlugin
+      {
+        /// \brief Entity the plugin was requested for. May be null, in
+        /// which case the world entity is used.
+        Entity entity;
+
+        /// \brief Loaded system plugin.
+        SystemPluginPtr plugin;
+
+        /// \brief SDF plugin element the system was requested with.
+        sdf::Plugin sdf;
+      };
+
       /// \brief A list of entity systems to add
-      private: std::vector<msgs::EntityPlugin_V> systemsToAdd;
+      private: std::vector<StagedSystemPlugin> systemsToAdd;
 
       /// \brief Mutex to protect systemsToAdd list
       private: std::mutex systemsMsgMutex;
@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <unordered_set>
+#include <utility>
+
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/System.hh"
 #include "gz/sim/SystemLoader.hh"
@@ -81,6 +85,39 @@ class SystemWithPrioritizedUpdates:
                 { return kPriority; }
 };
 
+/////////////////////////////////////////////////
+class SystemWithComponentAccess:
+  public SystemWithUpdates,
+  public ISystemComponentAccess
+{
+  public: explicit SystemWithComponentAccess(
+              std::unordered_set<ComponentTypeId> _reads,
+              std::unordered_set<ComponentTypeId> _writes)
+            : reads(std::move(_reads)), writes(std::move(_writes))
+  {
+  }
+
+  // Documentation inherited
+  public: std::unordered_set<ComponentTypeId>
+              UpdateComponentReads() const override { return this->reads; }
+
+  // Documentation inherited
+  public: std::unordered_set<ComponentTypeId>
+              UpdateComponentWrites() const override { return this->writes; }
+
+  public: std::unordered_set<ComponentTypeId> reads;
+  public: std::unordered_set<ComponentTypeId> writes;
+};
+
+/////////////////////////////////////////////////
+class SystemWithUpdateFrequency:
+  public SystemWithUpdates,
+  public ISystemConfigureUpdateFrequency
+{
+  // Documentation inherited
+  public: double ConfigureUpdateFrequency() override { return 50.0; }
+};
+
 /////////////////////////////////////////////////
 TEST(SystemManager, Constructor)
 {
@@ -175,6 +212,110 @@ TEST(SystemManager, AddSystemNoEcm)
   EXPECT_EQ(2u, systemMgr.TotalByEntity(updateEntity).size());
 }
 
+/////////////////////////////////////////////////
+TEST(SystemManager, UpdateStages)
+{
+  auto loader = std::make_shared<SystemLoader>();
+  SystemManager systemMgr(loader);
+
+  const ComponentTypeId kPoseType{1};
+  const ComponentTypeId kVelType{2};
+  const ComponentTypeId kWrenchType{3};
+
+  // Read-only systems share a stage; a system that declares writes and a
+  // system without declarations each run alone
+  auto poseReader1 = std::make_shared<SystemWithComponentAccess>(
+      std::unordered_set<ComponentTypeId>{kPoseType, kVelType},
+      std::unordered_set<ComponentTypeId>{});
+  auto poseReader2 = std::make_shared<SystemWithComponentAccess>(
+      std::unordered_set<ComponentTypeId>{kPoseType, kWrenchType},
+      std::unordered_set<ComponentTypeId>{});
+  auto poseWriter = std::make_shared<SystemWithComponentAccess>(
+      std::unordered_set<ComponentTypeId>{},
+      std::unordered_set<ComponentTypeId>{kPoseType});
+  auto undeclared = std::make_shared<SystemWithUpdates>();
+
+  systemMgr.AddSystem(poseReader1, kNullEntity, nullptr);
+  systemMgr.AddSystem(poseReader2, kNullEntity, nullptr);
+  systemMgr.AddSystem(poseWriter, kNullEntity, nullptr);
+  systemMgr.AddSystem(undeclared, kNullEntity, nullptr);
+  systemMgr.ActivatePendingSystems();
+
+  const auto &stages = systemMgr.UpdateStages();
+  ASSERT_EQ(3u, stages.size());
+
+  // Stage 1: the two read-only systems run together
+  ASSERT_EQ(2u, stages[0].size());
+  EXPECT_EQ(poseReader1.get(), stages[0][0]);
+  EXPECT_EQ(poseReader2.get(), stages[0][1]);
+
+  // Stage 2: the pose writer runs alone; change tracking is not safe for
+  // concurrent writers
+  ASSERT_EQ(1u, stages[1].size());
+  EXPECT_EQ(poseWriter.get(), stages[1][0]);
+
+  // Stage 3: the system without declarations is exclusive
+  ASSERT_EQ(1u, stages[2].size());
+  EXPECT_EQ(undeclared.get(), stages[2][0]);
+
+  // Systems of different priorities never share a stage, even without
+  // conflicts
+  auto prioritized = std::make_shared<SystemWithPrioritizedUpdates>();
+  systemMgr.AddSystem(prioritized, kNullEntity, nullptr);
+  systemMgr.ActivatePendingSystems();
+  ASSERT_EQ(4u, systemMgr.UpdateStages().size());
+}
+
+/////////////////////////////////////////////////
+TEST(SystemManager, UpdateThrottling)
+{
+  auto loader = std::make_shared<SystemLoader>();
+  SystemManager systemMgr(loader);
+
+  // 50 Hz declared frequency gives a 20 ms period
+  auto throttled = std::make_shared<SystemWithUpdateFrequency>();
+  auto regular = std::make_shared<SystemWithUpdates>();
+
+  systemMgr.AddSystem(throttled, kNullEntity, nullptr);
+  systemMgr.AddSystem(regular, kNullEntity, nullptr);
+  systemMgr.ActivatePendingSystems();
+
+  auto *throttledUpdate = static_cast<ISystemUpdate *>(throttled.get());
+  auto *regularUpdate = static_cast<ISystemUpdate *>(regular.get());
+
+  // A throttled system always runs on its first step
+  UpdateInfo info;
+  info.simTime = std::chrono::milliseconds(1);
+  systemMgr.UpdateThrottling(info);
+  EXPECT_FALSE(systemMgr.Throttled(throttledUpdate));
+  EXPECT_FALSE(systemMgr.Throttled(regularUpdate));
+
+  // One millisecond later the period hasn't elapsed, and all phases of the
+  // throttled system are skipped
+  info.simTime = std::chrono::milliseconds(2);
+  systemMgr.UpdateThrottling(info);
+  EXPECT_TRUE(systemMgr.Throttled(throttledUpdate));
+  EXPECT_TRUE(systemMgr.Throttled(
+      static_cast<ISystemPreUpdate *>(throttled.get())));
+  EXPECT_TRUE(systemMgr.Throttled(
+      static_cast<ISystemPostUpdate *>(throttled.get())));
+  EXPECT_FALSE(systemMgr.Throttled(regularUpdate));
+
+  // Once a full period has elapsed since the last run, the system is due
+  // again
+  info.simTime = std::chrono::milliseconds(21);
+  systemMgr.UpdateThrottling(info);
+  EXPECT_FALSE(systemMgr.Throttled(throttledUpdate));
+
+  // Simulation time jumping backwards (e.g. rewind) re-runs the system
+  info.simTime = std::chrono::milliseconds(22);
+  systemMgr.UpdateThrottling(info);
+  EXPECT_TRUE(systemMgr.Throttled(throttledUpdate));
+  info.simTime = std::chrono::milliseconds(5);
+  systemMgr.UpdateThrottling(info);
+  EXPECT_FALSE(systemMgr.Throttled(throttledUpdate));
+}
+
 /////////////////////////////////////////////////
 TEST(SystemManager, AddSystemEcm)
 {
@@ -15,6 +15,9 @@
  *
 */
 
+#include <memory>
+#include <utility>
+
 #include "gz/sim/Server.hh"
 #include "gz/sim/ServerConfig.hh"
 
@@ -23,34 +26,10 @@
 using namespace gz;
 using namespace sim;
 
-/// \brief System that is inserted into the simulation loop to observe the ECM.
-class HelperSystem :
-  public System,
-  public ISystemConfigure,
-  public ISystemPreUpdate,
-  public ISystemUpdate,
-  public ISystemPostUpdate
+/// \brief Callbacks shared between the fixture and its helper systems.
+struct HelperCallbacks
 {
-  // Documentation inherited
-  public: void Configure(
-                const Entity &_entity,
-                const std::shared_ptr<const sdf::Element> &_sdf,
-                EntityComponentManager &_ecm,
-                EventManager &_eventMgr) override;
-
-  // Documentation inherited
-  public: void PreUpdate(const UpdateInfo &_info,
-                EntityComponentManager &_ecm) override;
-
-  // Documentation inherited
-  public: void Update(const UpdateInfo &_info,
-                EntityComponentManager &_ecm) override;
-
-  // Documentation inherited
-  public: void PostUpdate(const UpdateInfo &_info,
-                const EntityComponentManager &_ecm) override;
-
-  /// \brief Function to call every time  we configure a world
+  /// \brief Function to call every time we configure a world
   public: std::function<void(const Entity &_entity,
                 const std::shared_ptr<const sdf::Element> &_sdf,
                 EntityComponentManager &_ecm,
@@ -68,42 +47,128 @@ class HelperSystem :
   /// \brief Function to call every post-update
   public: std::function<void(const UpdateInfo &,
       const EntityComponentManager &)> postUpdateCallback;
+
+  /// \brief Invoke the post-update callback only on every Nth step.
+  public: uint64_t postUpdatePeriod{1};
+
+  /// \brief Number of post-updates since the period was last reset.
+  public: uint64_t postUpdateCount{0};
 };
 
-/////////////////////////////////////////////////
-void HelperSystem::Configure(
+/// \brief Systems inserted into the simulation loop to observe the ECM.
+/// Each phase has its own helper class, so only the phases a test actually
+/// hooks are registered with the server and unhooked phases cost nothing
+/// per step. In particular, a post-update system is only registered when a
+/// post-update callback exists, keeping the fixture out of the parallel
+/// post-update barrier otherwise.
+class ConfigureHelper :
+  public System,
+  public ISystemConfigure
+{
+  /// \brief Constructor
+  /// \param[in] _callbacks Callbacks shared with the fixture
+  public: explicit ConfigureHelper(
+              std::shared_ptr<HelperCallbacks> _callbacks)
+    : callbacks(std::move(_callbacks))
+  {
+  }
+
+  // Documentation inherited
+  public: void Configure(
                 const Entity &_entity,
                 const std::shared_ptr<const sdf::Element> &_sdf,
                 EntityComponentManager &_ecm,
-                EventManager &_eventMgr)
-{
-  if (this->configureCallback)
-    this->configureCallback(_entity, _sdf, _ecm, _eventMgr);
-}
+                EventManager &_eventMgr) override
+  {
+    if (this->callbacks->configureCallback)
+      this->callbacks->configureCallback(_entity, _sdf, _ecm, _eventMgr);
+  }
 
-/////////////////////////////////////////////////
-void HelperSystem::PreUpdate(const UpdateInfo &_info,
-      EntityComponentManager &_ecm)
+  /// \brief Callbacks shared with the fixture
+  private: std::shared_ptr<HelperCallbacks> callbacks;
+};
+
+/// \brief See ConfigureHelper
+class PreUpdateHelper :
+  public System,
+  public ISystemPreUpdate
 {
-  if (this->preUpdateCallback)
-    this->preUpdateCallback(_info, _ecm);
-}
+  /// \brief Constructor
+  /// \param[in] _callbacks Callbacks shared with the fixture
+  public: explicit PreUpdateHelper(
+              std::shared_ptr<HelperCallbacks> _callbacks)
+    : callbacks(std::move(_callbacks))
+  {
+  }
 
-/////////////////////////////////////////////////
-void HelperSystem::Update(const UpdateInfo &_info,
-      EntityComponentManager &_ecm)
+  // Documentation inherited
+  public: void PreUpdate(const UpdateInfo &_info,
+                EntityComponentManager &_ecm) override
+  {
+    if (this->callbacks->preUpdateCallback)
+      this->callbacks->preUpdateCallback(_info, _ecm);
+  }
+
+  /// \brief Callbacks shared with the fixture
+  private: std::shared_ptr<HelperCallbacks> callbacks;
+};
+
+/// \brief See ConfigureHelper
+class UpdateHelper :
+  public System,
+  public ISystemUpdate
 {
-  if (this->updateCallback)
-    this->updateCallback(_info, _ecm);
-}
+  /// \brief Constructor
+  /// \param[in] _callbacks Callbacks shared with the fixture
+  public: explicit UpdateHelper(
+              std::shared_ptr<HelperCallbacks> _callbacks)
+    : callbacks(std::move(_callbacks))
+  {
+  }
 
-/////////////////////////////////////////////////
-void HelperSystem::PostUpdate(const UpdateInfo &_info,
-    const EntityComponentManager &_ecm)
+  // Documentation inherited
+  public: void Update(const UpdateInfo &_info,
+                EntityComponentManager &_ecm) override
+  {
+    if (this->callbacks->updateCallback)
+      this->callbacks->updateCallback(_info, _ecm);
+  }
+
+  /// \brief Callbacks shared with the fixture
+  private: std::shared_ptr<HelperCallbacks> callbacks;
+};
+
+/// \brief See ConfigureHelper
+class PostUpdateHelper :
+  public System,
+  public ISystemPostUpdate
 {
-  if (this->postUpdateCallback)
-    this->postUpdateCallback(_info, _ecm);
-}
+  /// \brief Constructor
+  /// \param[in] _callbacks Callbacks shared with the fixture
+  public: explicit PostUpdateHelper(
+              std::shared_ptr<HelperCallbacks> _callbacks)
+    : callbacks(std::move(_callbacks))
+  {
+  }
+
+  // Documentation inherited
+  public: void PostUpdate(const UpdateInfo &_info,
+                const EntityComponentManager &_ecm) override
+  {
+    if (this->callbacks->postUpdatePeriod > 1 &&
+        (++this->callbacks->postUpdateCount %
+         this->callbacks->postUpdatePeriod != 0))
+    {
+      return;
+    }
+
+    if (this->callbacks->postUpdateCallback)
+      this->callbacks->postUpdateCallback(_info, _ecm);
+  }
+
+  /// \brief Callbacks shared with the fixture
+  private: std::shared_ptr<HelperCallbacks> callbacks;
+};
 
 //////////////////////////////////////////////////
 class gz::sim::TestFixture::Implementation
@@ -112,11 +177,27 @@ class gz::sim::TestFixture::Implementation
   /// \param[in] _config Server config
   public: void Init(const ServerConfig &_config);
 
+  /// \brief Add helper systems for all phases that have a callback and
+  /// haven't been added yet.
+  public: void AddHelperSystems();
+
   /// \brief Pointer to underlying server
   public: std::shared_ptr<sim::Server> server{nullptr};
 
-  /// \brief Pointer to underlying Helper interface
-  public: std::shared_ptr<HelperSystem> helperSystem{nullptr};
+  /// \brief Callbacks shared with the helper systems
+  public: std::shared_ptr<HelperCallbacks> callbacks{nullptr};
+
+  /// \brief Whether each phase's helper system has been added to the server
+  public: bool configureAdded{false};
+
+  /// \brief See configureAdded
+  public: bool preUpdateAdded{false};
+
+  /// \brief See configureAdded
+  public: bool updateAdded{false};
+
+  /// \brief See configureAdded
+  public: bool postUpdateAdded{false};
 
   /// \brief Flag to make sure Finalize is only called once
   public: bool finalized{false};
@@ -141,10 +222,39 @@ TestFixture::TestFixture(const ServerConfig &_config)
 //////////////////////////////////////////////////
 void TestFixture::Implementation::Init(const ServerConfig &_config)
 {
-  this->helperSystem = std::make_shared<HelperSystem>();
+  this->callbacks = std::make_shared<HelperCallbacks>();
   this->server = std::make_shared<sim::Server>(_config);
 }
 
+//////////////////////////////////////////////////
+void TestFixture::Implementation::AddHelperSystems()
+{
+  if (this->callbacks->configureCallback && !this->configureAdded)
+  {
+    this->server->AddSystem(
+        std::make_shared<ConfigureHelper>(this->callbacks));
+    this->configureAdded = true;
+  }
+  if (this->callbacks->preUpdateCallback && !this->preUpdateAdded)
+  {
+    this->server->AddSystem(
+        std::make_shared<PreUpdateHelper>(this->callbacks));
+    this->preUpdateAdded = true;
+  }
+  if (this->callbacks->updateCallback && !this->updateAdded)
+  {
+    this->server->AddSystem(
+        std::make_shared<UpdateHelper>(this->callbacks));
+    this->updateAdded = true;
+  }
+  if (this->callbacks->postUpdateCallback && !this->postUpdateAdded)
+  {
+    this->server->AddSystem(
+        std::make_shared<PostUpdateHelper>(this->callbacks));
+    this->postUpdateAdded = true;
+  }
+}
+
 //////////////////////////////////////////////////
 TestFixture &TestFixture::Finalize()
 {
@@ -155,12 +265,28 @@ TestFixture &TestFixture::Finalize()
     return *this;
   }
 
-  this->dataPtr->server->AddSystem(this->dataPtr->helperSystem);
+  this->dataPtr->AddHelperSystems();
 
   this->dataPtr->finalized = true;
   return *this;
 }
 
+//////////////////////////////////////////////////
+bool TestFixture::Step(uint64_t _iterations, uint64_t _postUpdatePeriod)
+{
+  if (!this->dataPtr->finalized)
+    this->Finalize();
+
+  this->dataPtr->callbacks->postUpdatePeriod =
+      _postUpdatePeriod > 0 ? _postUpdatePeriod : 1;
+  this->dataPtr->callbacks->postUpdateCount = 0;
+
+  const bool result = this->dataPtr->server->Run(true, _iterations, false);
+
+  this->dataPtr->callbacks->postUpdatePeriod = 1;
+  return result;
+}
+
 //////////////////////////////////////////////////
 TestFixture &TestFixture::OnConfigure(std::function<void(
           const Entity &_entity,
@@ -168,8 +294,9 @@ TestFixture &TestFixture::OnConfigure(std::function<void(
           EntityComponentManager &_ecm,
           EventManager &_eventMgr)> _cb)
 {
-  if (nullptr != this->dataPtr->helperSystem)
-    this->dataPtr->helperSystem->configureCallback = std::move(_cb);
+  this->dataPtr->callbacks->configureCallback = std::move(_cb);
+  if (this->dataPtr->finalized)
+    this->dataPtr->AddHelperSystems();
   return *this;
 }
 
@@ -177,8 +304,9 @@ TestFixture &TestFixture::OnConfigure(std::function<void(
 TestFixture &TestFixture::OnPreUpdate(std::function<void(
           const UpdateInfo &, EntityComponentManager &)> _cb)
 {
-  if (nullptr != this->dataPtr->helperSystem)
-    this->dataPtr->helperSystem->preUpdateCallback = std::move(_cb);
+  this->dataPtr->callbacks->preUpdateCallback = std::move(_cb);
+  if (this->dataPtr->finalized)
+    this->dataPtr->AddHelperSystems();
   return *this;
 }
 
@@ -186,8 +314,9 @@ TestFixture &TestFixture::OnPreUpdate(std::function<void(
 TestFixture &TestFixture::OnUpdate(std::function<void(
           const UpdateInfo &, EntityComponentManager &)> _cb)
 {
-  if (nullptr != this->dataPtr->helperSystem)
-    this->dataPtr->helperSystem->updateCallback = std::move(_cb);
+  this->dataPtr->callbacks->updateCallback = std::move(_cb);
+  if (this->dataPtr->finalized)
+    this->dataPtr->AddHelperSystems();
   return *this;
 }
 
@@ -195,8 +324,9 @@ TestFixture &TestFixture::OnUpdate(std::function<void(
 TestFixture &TestFixture::OnPostUpdate(std::function<void(
           const UpdateInfo &, const EntityComponentManager &)> _cb)
 {
-  if (nullptr != this->dataPtr->helperSystem)
-    this->dataPtr->helperSystem->postUpdateCallback = std::move(_cb);
+  this->dataPtr->callbacks->postUpdateCallback = std::move(_cb);
+  if (this->dataPtr->finalized)
+    this->dataPtr->AddHelperSystems();
   return *this;
 }
 
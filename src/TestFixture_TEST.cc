@@ -259,3 +259,39 @@ TEST_F(TestFixtureTest, ChangeCallback)
   // New callback is called
   EXPECT_EQ(expectedIterations, preUpdate2);
 }
+
+/////////////////////////////////////////////////
+TEST_F(TestFixtureTest, Step)
+{
+  TestFixture testFixture(common::joinPaths(
+      std::string(PROJECT_SOURCE_PATH), "test", "worlds", "shapes.sdf"));
+  ASSERT_NE(nullptr, testFixture.Server());
+
+  unsigned int preUpdates{0u};
+  unsigned int postUpdates{0u};
+  testFixture.
+    OnPreUpdate([&](const UpdateInfo &, EntityComponentManager &)
+    {
+      preUpdates++;
+    }).
+    OnPostUpdate([&](const UpdateInfo &, const EntityComponentManager &)
+    {
+      postUpdates++;
+    }).
+    Finalize();
+
+  EXPECT_TRUE(testFixture.Step(10u));
+  EXPECT_EQ(10u, preUpdates);
+  EXPECT_EQ(10u, postUpdates);
+
+  // With a period, the post-update callback only fires on every Nth step,
+  // while other callbacks still fire every step
+  EXPECT_TRUE(testFixture.Step(10u, 5u));
+  EXPECT_EQ(20u, preUpdates);
+  EXPECT_EQ(12u, postUpdates);
+
+  // The period only applies to that run
+  EXPECT_TRUE(testFixture.Server()->Run(true, 10u, false));
+  EXPECT_EQ(30u, preUpdates);
+  EXPECT_EQ(22u, postUpdates);
+}
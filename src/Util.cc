@@ -15,8 +15,25 @@
  *
 */
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#endif
+
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <gz/msgs/entity.pb.h>
@@ -42,9 +59,11 @@
 #include "gz/sim/components/AngularVelocity.hh"
 #include "gz/sim/components/Collision.hh"
 #include "gz/sim/components/Environment.hh"
+#include "gz/sim/components/Gravity.hh"
 #include "gz/sim/components/Joint.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
+#include "gz/sim/components/MagneticField.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParentEntity.hh"
@@ -54,6 +73,7 @@
 #include "gz/sim/components/Sensor.hh"
 #include "gz/sim/components/SphericalCoordinates.hh"
 #include "gz/sim/components/Visual.hh"
+#include "gz/sim/components/Wind.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/components/LinearVelocity.hh"
 
@@ -66,6 +86,143 @@ namespace sim
 {
 // Inline bracket to help doxygen filtering.
 inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace
+{
+/// \brief Step-scoped cache of world poses shared by every worldPose
+/// caller reading the same entity component manager. Only consulted while
+/// active, which the simulation runner limits to the PostUpdate phase
+/// where poses are immutable.
+struct WorldPoseCache
+{
+  /// \brief Guards the other members; PostUpdate systems query
+  /// concurrently from the worker pool.
+  std::mutex mutex;
+
+  /// \brief Whether worldPose should read and populate the cache.
+  bool active{false};
+
+  /// \brief Resolved world poses, including intermediate ancestors.
+  std::unordered_map<Entity, math::Pose3d> poses;
+};
+
+/// \brief Look up the cache for a manager, optionally creating it.
+/// \param[in] _ecm The entity component manager being read.
+/// \param[in] _create True to create a missing cache.
+/// \return The cache, or nullptr if absent and _create is false.
+std::shared_ptr<WorldPoseCache> WorldPoseCacheFor(
+    const EntityComponentManager &_ecm, bool _create)
+{
+  static std::mutex cachesMutex;
+  static std::unordered_map<const EntityComponentManager *,
+      std::shared_ptr<WorldPoseCache>> caches;
+  std::lock_guard<std::mutex> lock(cachesMutex);
+  auto iter = caches.find(&_ecm);
+  if (iter != caches.end())
+    return iter->second;
+  if (!_create)
+    return nullptr;
+  return caches[&_ecm] = std::make_shared<WorldPoseCache>();
+}
+
+/// \brief Per-manager world-constants snapshot plus a flag recording
+/// whether it has been populated yet.
+struct WorldConstantsEntry
+{
+  /// \brief The published snapshot.
+  WorldConstants constants;
+
+  /// \brief Whether refreshWorldConstants has populated the snapshot.
+  bool populated{false};
+};
+
+/// \brief Look up the world-constants entry for a manager, creating it on
+/// first use. The returned entry outlives the manager; entries are only a
+/// few hundred bytes and managers are few, so they are never reclaimed.
+/// \param[in] _ecm The entity component manager being read.
+/// \return The entry for _ecm.
+WorldConstantsEntry &WorldConstantsFor(const EntityComponentManager &_ecm)
+{
+  static std::mutex entriesMutex;
+  static std::unordered_map<const EntityComponentManager *,
+      std::shared_ptr<WorldConstantsEntry>> entries;
+  std::lock_guard<std::mutex> lock(entriesMutex);
+  auto iter = entries.find(&_ecm);
+  if (iter != entries.end())
+    return *iter->second;
+  return *(entries[&_ecm] = std::make_shared<WorldConstantsEntry>());
+}
+}
+
+//////////////////////////////////////////////////
+void beginWorldPoseCache(const EntityComponentManager &_ecm)
+{
+  auto cache = WorldPoseCacheFor(_ecm, true);
+  std::lock_guard<std::mutex> lock(cache->mutex);
+  cache->poses.clear();
+  cache->active = true;
+}
+
+//////////////////////////////////////////////////
+void endWorldPoseCache(const EntityComponentManager &_ecm)
+{
+  auto cache = WorldPoseCacheFor(_ecm, false);
+  if (nullptr == cache)
+    return;
+  std::lock_guard<std::mutex> lock(cache->mutex);
+  cache->poses.clear();
+  cache->active = false;
+}
+
+//////////////////////////////////////////////////
+const WorldConstants &worldConstants(const EntityComponentManager &_ecm)
+{
+  auto &entry = WorldConstantsFor(_ecm);
+  if (!entry.populated)
+    refreshWorldConstants(_ecm);
+  return entry.constants;
+}
+
+//////////////////////////////////////////////////
+void refreshWorldConstants(const EntityComponentManager &_ecm)
+{
+  auto &entry = WorldConstantsFor(_ecm);
+  WorldConstants constants;
+
+  constants.world = worldEntity(_ecm);
+  if (kNullEntity == constants.world)
+  {
+    // No world yet; leave the snapshot unpopulated so the next read tries
+    // again once the world has been created.
+    entry.constants = constants;
+    return;
+  }
+
+  auto gravity = _ecm.Component<components::Gravity>(constants.world);
+  if (gravity)
+  {
+    constants.gravity = gravity->Data();
+    constants.hasGravity = true;
+  }
+
+  auto magneticField =
+      _ecm.Component<components::MagneticField>(constants.world);
+  if (magneticField)
+  {
+    constants.magneticField = magneticField->Data();
+    constants.hasMagneticField = true;
+  }
+
+  auto sphericalCoords =
+      _ecm.Component<components::SphericalCoordinates>(constants.world);
+  if (sphericalCoords)
+    constants.sphericalCoordinates = sphericalCoords->Data();
+
+  constants.windEntity = _ecm.EntityByComponents(components::Wind());
+
+  entry.constants = constants;
+  entry.populated = true;
+}
+
 //////////////////////////////////////////////////
 math::Pose3d worldPose(const Entity &_entity,
     const EntityComponentManager &_ecm)
@@ -78,23 +235,149 @@ math::Pose3d worldPose(const Entity &_entity,
     return math::Pose3d();
   }
 
-  // work out pose in world frame
-  math::Pose3d pose = poseComp->Data();
-  auto p = _ecm.Component<components::ParentEntity>(_entity);
-  while (p)
+  auto cache = WorldPoseCacheFor(_ecm, false);
+  if (nullptr != cache)
   {
-    // get pose of parent entity
-    auto parentPose = _ecm.Component<components::Pose>(p->Data());
-    if (!parentPose)
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    if (!cache->active)
+    {
+      cache = nullptr;
+    }
+    else
+    {
+      auto cacheIter = cache->poses.find(_entity);
+      if (cacheIter != cache->poses.end())
+        return cacheIter->second;
+    }
+  }
+
+  // Climb towards the root, recording the chain so that with an active
+  // cache every ancestor visited is memoized for other callers.
+  std::vector<std::pair<Entity, math::Pose3d>> chain;
+  math::Pose3d pose;
+  Entity current = _entity;
+  const components::Pose *currentPose = poseComp;
+  while (true)
+  {
+    if (nullptr != cache)
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      auto cacheIter = cache->poses.find(current);
+      if (cacheIter != cache->poses.end())
+      {
+        pose = cacheIter->second;
+        break;
+      }
+    }
+    if (nullptr == currentPose)
       break;
-    // transform pose
-    pose = parentPose->Data() * pose;
-    // keep going up the tree
-    p = _ecm.Component<components::ParentEntity>(p->Data());
+    chain.emplace_back(current, currentPose->Data());
+    auto p = _ecm.Component<components::ParentEntity>(current);
+    if (nullptr == p)
+      break;
+    current = p->Data();
+    currentPose = _ecm.Component<components::Pose>(current);
+  }
+
+  // Unwind, composing world poses from the top down.
+  for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+  {
+    pose = pose * iter->second;
+    if (nullptr != cache)
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      if (cache->active)
+        cache->poses[iter->first] = pose;
+    }
   }
   return pose;
 }
 
+//////////////////////////////////////////////////
+std::unordered_map<Entity, math::Pose3d> worldPoses(
+    const std::vector<Entity> &_entities,
+    const EntityComponentManager &_ecm)
+{
+  // Memoized world poses, shared by every entity that has the memoized
+  // entity as an ancestor.
+  std::unordered_map<Entity, math::Pose3d> memo;
+  memo.reserve(_entities.size());
+
+  std::unordered_map<Entity, math::Pose3d> result;
+  result.reserve(_entities.size());
+
+  // Scratch chain of entities between the one being resolved and its
+  // nearest memoized (or topmost posed) ancestor.
+  std::vector<std::pair<Entity, math::Pose3d>> chain;
+
+  for (const Entity entity : _entities)
+  {
+    auto poseComp = _ecm.Component<components::Pose>(entity);
+    if (nullptr == poseComp)
+    {
+      gzwarn << "Trying to get world pose from entity [" << entity
+              << "], which doesn't have a pose component" << std::endl;
+      result[entity] = math::Pose3d();
+      continue;
+    }
+
+    // Climb towards the root until hitting a memoized ancestor or an
+    // ancestor without a pose component.
+    chain.clear();
+    math::Pose3d pose;
+    Entity current = entity;
+    const components::Pose *currentPose = poseComp;
+    while (true)
+    {
+      auto memoIt = memo.find(current);
+      if (memoIt != memo.end())
+      {
+        pose = memoIt->second;
+        break;
+      }
+      if (nullptr == currentPose)
+        break;
+      chain.emplace_back(current, currentPose->Data());
+      auto p = _ecm.Component<components::ParentEntity>(current);
+      if (nullptr == p)
+        break;
+      current = p->Data();
+      currentPose = _ecm.Component<components::Pose>(current);
+    }
+
+    // Unwind, composing and memoizing world poses from the top down.
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+    {
+      pose = pose * it->second;
+      memo[it->first] = pose;
+    }
+    result[entity] = pose;
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::optional<LinkKinematics> linkWorldKinematics(
+    const Entity &_entity, const EntityComponentManager &_ecm)
+{
+  auto linVelComp =
+      _ecm.Component<components::WorldLinearVelocity>(_entity);
+  auto angVelComp =
+      _ecm.Component<components::WorldAngularVelocity>(_entity);
+  if (nullptr == linVelComp || nullptr == angVelComp)
+    return std::nullopt;
+
+  LinkKinematics kinematics;
+  auto worldPoseComp = _ecm.Component<components::WorldPose>(_entity);
+  if (nullptr != worldPoseComp)
+    kinematics.pose = worldPoseComp->Data();
+  else
+    kinematics.pose = worldPose(_entity, _ecm);
+  kinematics.linearVelocity = linVelComp->Data();
+  kinematics.angularVelocity = angVelComp->Data();
+  return kinematics;
+}
+
 //////////////////////////////////////////////////
 math::Vector3d relativeVel(const Entity &_entity,
     const EntityComponentManager &_ecm)
@@ -134,11 +417,58 @@ math::Vector3d relativeVel(const Entity &_entity,
   return pose.Rot().RotateVectorReverse(vel);
 }
 
+/// \brief Mutex protecting gScopedNameCaches
+static std::mutex gScopedNameCacheMutex;
+
+/// \brief Formatted scoped names cached for one ECM. Entries are valid
+/// while the ECM's entity structure epoch and entity count are unchanged.
+struct ScopedNameCache
+{
+  /// \brief Entity structure epoch the cache was filled at
+  uint64_t epoch{0u};
+
+  /// \brief Entity count the cache was filled at, a second staleness guard
+  /// in case a new ECM is allocated at a reused address
+  size_t entityCount{0u};
+
+  /// \brief Names per entity, one entry per (delimiter, include prefix)
+  /// combination requested
+  std::unordered_map<Entity,
+      std::vector<std::tuple<std::string, bool, std::string>>> names;
+};
+
+/// \brief Per-ECM caches of formatted scoped names, so per-frame callers
+/// don't walk the entity tree and rebuild the same strings every call
+static std::unordered_map<const EntityComponentManager *, ScopedNameCache>
+    gScopedNameCaches;
+
 //////////////////////////////////////////////////
 std::string scopedName(const Entity &_entity,
     const EntityComponentManager &_ecm, const std::string &_delim,
     bool _includePrefix)
 {
+  const uint64_t epoch = _ecm.EntityStructureEpoch();
+  const size_t entityCount = _ecm.EntityCount();
+  {
+    std::lock_guard<std::mutex> lock(gScopedNameCacheMutex);
+    auto &cache = gScopedNameCaches[&_ecm];
+    if (cache.epoch != epoch || cache.entityCount != entityCount)
+    {
+      cache.names.clear();
+      cache.epoch = epoch;
+      cache.entityCount = entityCount;
+    }
+    auto entityIt = cache.names.find(_entity);
+    if (entityIt != cache.names.end())
+    {
+      for (const auto &[delim, includePrefix, name] : entityIt->second)
+      {
+        if (delim == _delim && includePrefix == _includePrefix)
+          return name;
+      }
+    }
+  }
+
   std::string result;
 
   auto entity = _entity;
@@ -180,6 +510,13 @@ std::string scopedName(const Entity &_entity,
     entity = parentComp->Data();
   }
 
+  {
+    std::lock_guard<std::mutex> lock(gScopedNameCacheMutex);
+    auto &cache = gScopedNameCaches[&_ecm];
+    if (cache.epoch == epoch && cache.entityCount == entityCount)
+      cache.names[_entity].emplace_back(_delim, _includePrefix, result);
+  }
+
   return result;
 }
 
@@ -188,57 +525,7 @@ std::unordered_set<Entity> entitiesFromScopedName(
     const std::string &_scopedName, const EntityComponentManager &_ecm,
     Entity _relativeTo, const std::string &_delim)
 {
-  if (_delim.empty())
-  {
-    gzwarn << "Can't process scoped name [" << _scopedName
-            << "] with empty delimiter." << std::endl;
-    return {};
-  }
-
-  // Split names
-  std::vector<std::string> names;
-  size_t pos1 = 0;
-  size_t pos2 = _scopedName.find(_delim);
-  while (pos2 != std::string::npos)
-  {
-    names.push_back(_scopedName.substr(pos1, pos2 - pos1));
-    pos1 = pos2 + _delim.length();
-    pos2 = _scopedName.find(_delim, pos1);
-  }
-  names.push_back(_scopedName.substr(pos1, _scopedName.size()-pos1));
-
-  // Holds current entities that match and is updated for each name
-  std::vector<Entity> resVector;
-
-  // If there's an entity we're relative to, treat it as the first level result
-  if (_relativeTo != kNullEntity)
-  {
-    resVector = {_relativeTo};
-  }
-
-  for (const auto &name : names)
-  {
-    std::vector<Entity> current;
-    if (resVector.empty())
-    {
-      current = _ecm.EntitiesByComponents(components::Name(name));
-    }
-    else
-    {
-      for (auto res : resVector)
-      {
-        auto matches = _ecm.EntitiesByComponents(components::Name(name),
-            components::ParentEntity(res));
-        std::copy(std::begin(matches), std::end(matches),
-            std::back_inserter(current));
-      }
-    }
-    if (current.empty())
-      return {};
-    resVector = current;
-  }
-
-  return std::unordered_set<Entity>(resVector.begin(), resVector.end());
+  return _ecm.EntitiesByScopedName(_scopedName, _delim, _relativeTo);
 }
 
 //////////////////////////////////////////////////
@@ -722,6 +1009,31 @@ std::optional<math::Vector3d> sphericalCoordinates(Entity _entity,
   return math::Vector3d(rad->Lat()->Degree(), rad->Lon()->Degree(), *rad->Z());
 }
 
+//////////////////////////////////////////////////
+std::optional<math::Vector3d> sphericalCoordinates(Entity _entity,
+    const EntityComponentManager &_ecm, const math::Pose3d &_worldPose)
+{
+  auto sphericalCoordinatesComp =
+      _ecm.Component<components::SphericalCoordinates>(
+      worldEntity(_entity, _ecm));
+  if (nullptr == sphericalCoordinatesComp)
+  {
+    return std::nullopt;
+  }
+
+  // lat / lon / elevation in rad / rad / m
+  auto rad = sphericalCoordinatesComp->Data().PositionTransform(
+      math::CoordinateVector3::Metric(_worldPose.Pos()),
+      math::SphericalCoordinates::LOCAL,
+      math::SphericalCoordinates::SPHERICAL);
+
+  if (!rad.has_value() || !rad->IsSpherical())
+    return std::nullopt;
+
+  // Return degrees
+  return math::Vector3d(rad->Lat()->Degree(), rad->Lon()->Degree(), *rad->Z());
+}
+
 //////////////////////////////////////////////////
 std::optional<math::Vector3d> getGridFieldCoordinates(
   const EntityComponentManager &_ecm,
@@ -729,9 +1041,9 @@ std::optional<math::Vector3d> getGridFieldCoordinates(
   const std::shared_ptr<components::EnvironmentalData>& _gridField
   )
 {
-
-  auto origin =
-    _ecm.Component<components::SphericalCoordinates>(worldEntity(_ecm));
+  // Read the world origin from the per-step snapshot instead of fetching
+  // the component on every probe.
+  const auto &origin = worldConstants(_ecm).sphericalCoordinates;
   if (!origin)
   {
     if (_gridField->reference == math::SphericalCoordinates::SPHERICAL)
@@ -749,7 +1061,7 @@ std::optional<math::Vector3d> getGridFieldCoordinates(
       return _worldPosition;
     }
   }
-  auto position = origin->Data().PositionTransform(
+  auto position = origin->PositionTransform(
       math::CoordinateVector3::Metric(_worldPosition),
       math::SphericalCoordinates::LOCAL,
       _gridField->reference);
@@ -899,6 +1211,185 @@ const common::Mesh *loadMesh(const sdf::Mesh &_meshSdf)
   return mesh;
 }
 
+/// \brief Magic bytes identifying an on-disk convex decomposition cache file.
+static constexpr char kDecompositionCacheMagic[16] = "gz-sim-convex";
+
+/// \brief Version of the on-disk convex decomposition cache format. Bump
+/// whenever the layout below changes so stale entries are regenerated.
+static constexpr uint32_t kDecompositionCacheVersion = 1;
+
+//////////////////////////////////////////////////
+/// \brief Compute the FNV-1a hash of a submesh's geometry together with the
+/// decomposition parameters. Hashing the geometry rather than the source file
+/// lets meshes that were loaded by name, scaled copies and submesh selections
+/// all get distinct cache entries.
+/// \param[in] _submesh Submesh about to be decomposed
+/// \param[in] _maxConvexHulls Maximum number of convex hulls to generate
+/// \param[in] _voxelResolution Voxel resolution used by the decomposition
+/// \return The hash.
+static uint64_t HashSubMeshGeometry(const common::SubMesh &_submesh,
+    std::size_t _maxConvexHulls, std::size_t _voxelResolution)
+{
+  uint64_t hash = 14695981039346656037ull;
+  auto mix = [&hash](const void *_data, std::size_t _size)
+  {
+    const auto *bytes = static_cast<const unsigned char *>(_data);
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+  };
+  for (unsigned int i = 0; i < _submesh.VertexCount(); ++i)
+  {
+    const math::Vector3d v = _submesh.Vertex(i);
+    const double coords[3] = {v.X(), v.Y(), v.Z()};
+    mix(coords, sizeof(coords));
+  }
+  for (unsigned int i = 0; i < _submesh.IndexCount(); ++i)
+  {
+    const int index = _submesh.Index(i);
+    mix(&index, sizeof(index));
+  }
+  const uint64_t params[2] = {_maxConvexHulls, _voxelResolution};
+  mix(params, sizeof(params));
+  return hash;
+}
+
+//////////////////////////////////////////////////
+/// \brief Resolve the on-disk cache file for a convex decomposition result.
+/// Entries live in the directory named by the
+/// GZ_SIM_MESH_DECOMPOSITION_CACHE_DIR environment variable, or in
+/// $HOME/.gz/sim/mesh_decomposition_cache by default, under a
+/// content-addressed name.
+/// \param[in] _hash Geometry hash of the submesh being decomposed
+/// \return Path of the cache file, or an empty string if no cache directory
+/// is available.
+static std::string DecompositionCachePath(uint64_t _hash)
+{
+  std::string cacheDir;
+  if (!common::env("GZ_SIM_MESH_DECOMPOSITION_CACHE_DIR", cacheDir) ||
+      cacheDir.empty())
+  {
+    std::string home;
+    if (!common::env(GZ_HOMEDIR, home) || home.empty())
+      return std::string();
+    cacheDir = common::joinPaths(home, ".gz", "sim",
+        "mesh_decomposition_cache");
+  }
+  if (!common::exists(cacheDir) && !common::createDirectories(cacheDir))
+  {
+    static bool informed{false};
+    if (!informed)
+    {
+      gzwarn << "Failed to create mesh decomposition cache directory ["
+             << cacheDir << "]. Decomposition results will not be cached."
+             << std::endl;
+      informed = true;
+    }
+    return std::string();
+  }
+  std::ostringstream name;
+  name << std::hex << std::setw(16) << std::setfill('0') << _hash
+       << ".convex";
+  return common::joinPaths(cacheDir, name.str());
+}
+
+//////////////////////////////////////////////////
+/// \brief Read a cached convex decomposition result from disk.
+/// \param[in] _path Path of the cache file
+/// \param[out] _decomposed Decomposed submeshes read from the file
+/// \return True if the file existed and was fully understood.
+static bool ReadDecompositionCacheFile(const std::string &_path,
+    std::vector<common::SubMesh> &_decomposed)
+{
+  std::ifstream file(_path, std::ios::binary);
+  if (!file.is_open())
+    return false;
+
+  char magic[sizeof(kDecompositionCacheMagic)] = {0};
+  uint32_t version = 0u;
+  uint32_t submeshCount = 0u;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char *>(&version), sizeof(version));
+  file.read(reinterpret_cast<char *>(&submeshCount), sizeof(submeshCount));
+  if (!file || std::string(magic) != kDecompositionCacheMagic ||
+      version != kDecompositionCacheVersion || submeshCount > 1024u)
+    return false;
+
+  for (uint32_t s = 0u; s < submeshCount; ++s)
+  {
+    uint32_t vertexCount = 0u;
+    uint32_t indexCount = 0u;
+    file.read(reinterpret_cast<char *>(&vertexCount), sizeof(vertexCount));
+    file.read(reinterpret_cast<char *>(&indexCount), sizeof(indexCount));
+    if (!file || vertexCount > 10000000u || indexCount > 30000000u)
+      return false;
+
+    common::SubMesh submesh;
+    for (uint32_t v = 0u; v < vertexCount; ++v)
+    {
+      double coords[3];
+      file.read(reinterpret_cast<char *>(coords), sizeof(coords));
+      submesh.AddVertex(coords[0], coords[1], coords[2]);
+    }
+    for (uint32_t i = 0u; i < indexCount; ++i)
+    {
+      uint32_t index = 0u;
+      file.read(reinterpret_cast<char *>(&index), sizeof(index));
+      submesh.AddIndex(index);
+    }
+    if (!file)
+      return false;
+    submesh.RecalculateNormals();
+    _decomposed.push_back(std::move(submesh));
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Write a convex decomposition result to the on-disk cache.
+/// \param[in] _path Path of the cache file
+/// \param[in] _decomposed Decomposed submeshes to store
+static void WriteDecompositionCacheFile(const std::string &_path,
+    const std::vector<common::SubMesh> &_decomposed)
+{
+  std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open())
+  {
+    gzwarn << "Failed to write mesh decomposition cache file [" << _path
+           << "]" << std::endl;
+    return;
+  }
+
+  const uint32_t submeshCount = static_cast<uint32_t>(_decomposed.size());
+  file.write(kDecompositionCacheMagic, sizeof(kDecompositionCacheMagic));
+  file.write(reinterpret_cast<const char *>(&kDecompositionCacheVersion),
+      sizeof(kDecompositionCacheVersion));
+  file.write(reinterpret_cast<const char *>(&submeshCount),
+      sizeof(submeshCount));
+  for (const auto &submesh : _decomposed)
+  {
+    const uint32_t vertexCount = submesh.VertexCount();
+    const uint32_t indexCount = submesh.IndexCount();
+    file.write(reinterpret_cast<const char *>(&vertexCount),
+        sizeof(vertexCount));
+    file.write(reinterpret_cast<const char *>(&indexCount),
+        sizeof(indexCount));
+    for (uint32_t v = 0u; v < vertexCount; ++v)
+    {
+      const math::Vector3d vertex = submesh.Vertex(v);
+      const double coords[3] = {vertex.X(), vertex.Y(), vertex.Z()};
+      file.write(reinterpret_cast<const char *>(coords), sizeof(coords));
+    }
+    for (uint32_t i = 0u; i < indexCount; ++i)
+    {
+      const uint32_t index = static_cast<uint32_t>(submesh.Index(i));
+      file.write(reinterpret_cast<const char *>(&index), sizeof(index));
+    }
+  }
+}
+
 const common::Mesh *optimizeMesh(const sdf::Mesh &_meshSdf,
     const common::Mesh &_mesh)
 {
@@ -961,11 +1452,29 @@ const common::Mesh *optimizeMesh(const sdf::Mesh &_meshSdf,
     {
       // Decompose and add mesh to MeshManager
       auto mergedSubmesh = meshToDecompose->SubMeshByIndex(0u).lock();
-      std::vector<common::SubMesh> decomposed =
-        gz::common::MeshManager::ConvexDecomposition(
-        *mergedSubmesh.get(), maxConvexHulls, voxelResolution);
-      gzdbg << "Optimizing mesh (" << _meshSdf.OptimizationStr() << "): "
-            <<  _mesh.Name() << std::endl;
+
+      // Convex decomposition is deterministic for a given geometry and
+      // parameter set, so results are cached on disk keyed by a hash of
+      // both. Warm runs skip the decomposition entirely.
+      const uint64_t geometryHash = HashSubMeshGeometry(*mergedSubmesh.get(),
+          maxConvexHulls, voxelResolution);
+      const std::string cachePath = DecompositionCachePath(geometryHash);
+      std::vector<common::SubMesh> decomposed;
+      if (!cachePath.empty() &&
+          ReadDecompositionCacheFile(cachePath, decomposed))
+      {
+        gzdbg << "Loaded convex decomposition of " << _mesh.Name()
+              << " from cache [" << cachePath << "]" << std::endl;
+      }
+      else
+      {
+        decomposed = gz::common::MeshManager::ConvexDecomposition(
+          *mergedSubmesh.get(), maxConvexHulls, voxelResolution);
+        gzdbg << "Optimizing mesh (" << _meshSdf.OptimizationStr() << "): "
+              <<  _mesh.Name() << std::endl;
+        if (!cachePath.empty() && !decomposed.empty())
+          WriteDecompositionCacheFile(cachePath, decomposed);
+      }
       // Create decomposed mesh and add it to MeshManager
       // Note: MeshManager will call delete on this mesh in its destructor
       // \todo(iche033) Consider updating MeshManager to accept
@@ -989,6 +1498,154 @@ const common::Mesh *optimizeMesh(const sdf::Mesh &_meshSdf,
   return optimizedMesh;
 }
 
+//////////////////////////////////////////////////
+bool applyCpuAffinity(const std::vector<unsigned int> &_cpus)
+{
+#ifdef __linux__
+  if (_cpus.empty())
+    return false;
+
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for (const auto cpu : _cpus)
+    CPU_SET(cpu, &cpuSet);
+
+  return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpuSet),
+      &cpuSet);
+#else
+  (void)_cpus;
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool applyThreadPolicy(const std::string &_name,
+    const std::vector<unsigned int> &_cpus,
+    const std::string &_schedulingClass, int _priority)
+{
+  bool applied = false;
+
+#ifdef __linux__
+  if (!_name.empty())
+  {
+    // The kernel limits thread names to 15 characters plus terminator.
+    if (0 == pthread_setname_np(pthread_self(),
+        _name.substr(0, 15).c_str()))
+    {
+      applied = true;
+    }
+  }
+#else
+  (void)_name;
+#endif
+
+  if (!_cpus.empty())
+    applied = applyCpuAffinity(_cpus) || applied;
+
+#ifdef __linux__
+  if (!_schedulingClass.empty())
+  {
+    int schedPolicy = -1;
+    if ("other" == _schedulingClass)
+      schedPolicy = SCHED_OTHER;
+    else if ("fifo" == _schedulingClass)
+      schedPolicy = SCHED_FIFO;
+    else if ("rr" == _schedulingClass)
+      schedPolicy = SCHED_RR;
+
+    if (schedPolicy < 0)
+    {
+      gzwarn << "Unknown scheduling class [" << _schedulingClass
+             << "]; expected other, fifo or rr" << std::endl;
+    }
+    else
+    {
+      sched_param param{};
+      param.sched_priority = SCHED_OTHER == schedPolicy ? 0 : _priority;
+      if (0 == pthread_setschedparam(pthread_self(), schedPolicy, &param))
+      {
+        applied = true;
+      }
+      else
+      {
+        gzwarn << "Unable to set scheduling class [" << _schedulingClass
+               << "] priority [" << _priority << "]. Real-time classes "
+               << "usually require CAP_SYS_NICE or RLIMIT_RTPRIO."
+               << std::endl;
+      }
+    }
+  }
+#else
+  (void)_schedulingClass;
+  (void)_priority;
+#endif
+
+  return applied;
+}
+
+//////////////////////////////////////////////////
+bool applyHugePagePolicy()
+{
+#ifdef __linux__
+  // Clear any THP disable flag this process may have inherited.
+#ifdef PR_SET_THP_DISABLE
+  prctl(PR_SET_THP_DISABLE, 0, 0, 0, 0);
+#endif
+
+  // With the system THP mode set to "madvise" (the common default),
+  // regions are only promoted to huge pages if they are explicitly
+  // marked. Walk this process's mappings and mark the heap and large
+  // anonymous writable mappings; khugepaged will also collapse pages
+  // that are already populated.
+  std::ifstream maps("/proc/self/maps");
+  if (!maps.is_open())
+    return false;
+
+  const std::size_t kMinRegionSize = 2u * 1024u * 1024u;
+  std::string line;
+  bool applied = false;
+  while (std::getline(maps, line))
+  {
+    // Format: begin-end perms offset dev inode [pathname]
+    std::uintptr_t begin = 0, end = 0;
+    char perms[5] = {0};
+    if (3 != std::sscanf(line.c_str(), "%zx-%zx %4s",
+        &begin, &end, perms))
+      continue;
+    if ('w' != perms[1])
+      continue;
+
+    const bool isHeap = line.find("[heap]") != std::string::npos;
+    const bool isAnonymous = line.find('/') == std::string::npos &&
+        line.find('[') == std::string::npos;
+    if (!isHeap && !(isAnonymous && end - begin >= kMinRegionSize))
+      continue;
+
+    if (0 == madvise(reinterpret_cast<void *>(begin), end - begin,
+        MADV_HUGEPAGE))
+    {
+      applied = true;
+    }
+  }
+  return applied;
+#else
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool prefaultProcessMemory()
+{
+#ifdef __linux__
+  // MCL_FUTURE makes the kernel fault in (and pin) allocations as they
+  // are made, so world load pays the page faults instead of the first
+  // simulation steps that touch the memory.
+  return 0 == mlockall(MCL_CURRENT | MCL_FUTURE);
+#else
+  return false;
+#endif
+}
+
 }
 }
 }
@@ -24,7 +24,9 @@
 #include <gz/fuel_tools/ClientConfig.hh>
 
 #include "gz/sim/components/Actor.hh"
+#include "gz/sim/components/AngularVelocity.hh"
 #include "gz/sim/components/Collision.hh"
+#include "gz/sim/components/LinearVelocity.hh"
 #include "gz/sim/components/Joint.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
@@ -32,6 +34,7 @@
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/ParticleEmitter.hh"
+#include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/Projector.hh"
 #include "gz/sim/components/Sensor.hh"
 #include "gz/sim/components/Visual.hh"
@@ -589,6 +592,137 @@ TEST_F(UtilTest, TopLevelModel)
   EXPECT_EQ(kNullEntity, topLevelModel(worldEntity, ecm));
 }
 
+/////////////////////////////////////////////////
+TEST_F(UtilTest, WorldPoses)
+{
+  EntityComponentManager ecm;
+
+  // world
+  //  - modelA (1 0 0)
+  //    - linkA (0 1 0)
+  //      - modelB (0 0 1)
+  //        - linkB (0.1 0.2 0.3)
+  //  - modelC (2 0 0)
+
+  auto worldEntity = ecm.CreateEntity();
+  ecm.CreateComponent(worldEntity, components::World());
+
+  auto modelAEntity = ecm.CreateEntity();
+  ecm.CreateComponent(modelAEntity, components::Model());
+  ecm.CreateComponent(modelAEntity, components::ParentEntity(worldEntity));
+  ecm.CreateComponent(modelAEntity,
+      components::Pose(math::Pose3d(1, 0, 0, 0, 0, 0)));
+
+  auto linkAEntity = ecm.CreateEntity();
+  ecm.CreateComponent(linkAEntity, components::Link());
+  ecm.CreateComponent(linkAEntity, components::ParentEntity(modelAEntity));
+  ecm.CreateComponent(linkAEntity,
+      components::Pose(math::Pose3d(0, 1, 0, 0, 0, 0)));
+
+  auto modelBEntity = ecm.CreateEntity();
+  ecm.CreateComponent(modelBEntity, components::Model());
+  ecm.CreateComponent(modelBEntity, components::ParentEntity(linkAEntity));
+  ecm.CreateComponent(modelBEntity,
+      components::Pose(math::Pose3d(0, 0, 1, 0, 0, 0)));
+
+  auto linkBEntity = ecm.CreateEntity();
+  ecm.CreateComponent(linkBEntity, components::Link());
+  ecm.CreateComponent(linkBEntity, components::ParentEntity(modelBEntity));
+  ecm.CreateComponent(linkBEntity,
+      components::Pose(math::Pose3d(0.1, 0.2, 0.3, 0, 0, 0)));
+
+  auto modelCEntity = ecm.CreateEntity();
+  ecm.CreateComponent(modelCEntity, components::Model());
+  ecm.CreateComponent(modelCEntity, components::ParentEntity(worldEntity));
+  ecm.CreateComponent(modelCEntity,
+      components::Pose(math::Pose3d(2, 0, 0, 0, 0, 0)));
+
+  // an entity without a pose component
+  auto noPoseEntity = ecm.CreateEntity();
+  ecm.CreateComponent(noPoseEntity, components::ParentEntity(worldEntity));
+
+  std::vector<Entity> entities{modelAEntity, linkAEntity, modelBEntity,
+      linkBEntity, modelCEntity, noPoseEntity};
+  auto poses = worldPoses(entities, ecm);
+  ASSERT_EQ(entities.size(), poses.size());
+
+  // the batch matches the per-entity helper
+  for (const Entity entity : entities)
+    EXPECT_EQ(worldPose(entity, ecm), poses[entity]) << entity;
+
+  EXPECT_EQ(math::Pose3d(1, 0, 0, 0, 0, 0), poses[modelAEntity]);
+  EXPECT_EQ(math::Pose3d(1, 1, 1, 0, 0, 0), poses[modelBEntity]);
+  EXPECT_EQ(math::Pose3d(1.1, 1.2, 1.3, 0, 0, 0), poses[linkBEntity]);
+  EXPECT_EQ(math::Pose3d(), poses[noPoseEntity]);
+
+  // order doesn't matter: descendants before ancestors
+  std::vector<Entity> reversed{linkBEntity, modelBEntity, linkAEntity,
+      modelAEntity};
+  auto reversedPoses = worldPoses(reversed, ecm);
+  for (const Entity entity : reversed)
+    EXPECT_EQ(poses[entity], reversedPoses[entity]) << entity;
+
+  // the shared cache returns the same poses while active
+  beginWorldPoseCache(ecm);
+  for (const Entity entity : entities)
+    EXPECT_EQ(poses[entity], worldPose(entity, ecm)) << entity;
+  // repeated lookups hit the cache and stay consistent
+  EXPECT_EQ(poses[linkBEntity], worldPose(linkBEntity, ecm));
+  endWorldPoseCache(ecm);
+
+  // after deactivation a pose change is visible again
+  ecm.SetComponentData<components::Pose>(modelCEntity,
+      math::Pose3d(3, 0, 0, 0, 0, 0));
+  EXPECT_EQ(math::Pose3d(3, 0, 0, 0, 0, 0), worldPose(modelCEntity, ecm));
+}
+
+/////////////////////////////////////////////////
+TEST_F(UtilTest, LinkWorldKinematics)
+{
+  EntityComponentManager ecm;
+
+  // world
+  //  - model (1 0 0)
+  //    - link (0 1 0)
+
+  auto worldEntity = ecm.CreateEntity();
+  ecm.CreateComponent(worldEntity, components::World());
+
+  auto modelEntity = ecm.CreateEntity();
+  ecm.CreateComponent(modelEntity, components::Model());
+  ecm.CreateComponent(modelEntity, components::ParentEntity(worldEntity));
+  ecm.CreateComponent(modelEntity,
+      components::Pose(math::Pose3d(1, 0, 0, 0, 0, 0)));
+
+  auto linkEntity = ecm.CreateEntity();
+  ecm.CreateComponent(linkEntity, components::Link());
+  ecm.CreateComponent(linkEntity, components::ParentEntity(modelEntity));
+  ecm.CreateComponent(linkEntity,
+      components::Pose(math::Pose3d(0, 1, 0, 0, 0, 0)));
+
+  // no velocity components yet
+  EXPECT_FALSE(linkWorldKinematics(linkEntity, ecm).has_value());
+
+  ecm.CreateComponent(linkEntity,
+      components::WorldLinearVelocity(math::Vector3d(1, 2, 3)));
+  ecm.CreateComponent(linkEntity,
+      components::WorldAngularVelocity(math::Vector3d(0.1, 0.2, 0.3)));
+
+  // without a WorldPose component the pose comes from the pose tree
+  auto kinematics = linkWorldKinematics(linkEntity, ecm);
+  ASSERT_TRUE(kinematics.has_value());
+  EXPECT_EQ(math::Pose3d(1, 1, 0, 0, 0, 0), kinematics->pose);
+  EXPECT_EQ(math::Vector3d(1, 2, 3), kinematics->linearVelocity);
+  EXPECT_EQ(math::Vector3d(0.1, 0.2, 0.3), kinematics->angularVelocity);
+
+  // a WorldPose component takes precedence over the computed pose
+  ecm.CreateComponent(linkEntity,
+      components::WorldPose(math::Pose3d(5, 6, 7, 0, 0, 0)));
+  kinematics = linkWorldKinematics(linkEntity, ecm);
+  ASSERT_TRUE(kinematics.has_value());
+  EXPECT_EQ(math::Pose3d(5, 6, 7, 0, 0, 0), kinematics->pose);
+}
+
 /////////////////////////////////////////////////
 TEST_F(UtilTest, ValidTopic)
 {
@@ -1042,3 +1176,31 @@ TEST_F(UtilTest, LoadMesh)
   EXPECT_NE(nullptr, optimizedMesh);
   EXPECT_EQ(16u, optimizedMesh->SubMeshCount());
 }
+
+/////////////////////////////////////////////////
+TEST_F(UtilTest, ApplyCpuAffinity)
+{
+  // An empty CPU set applies nothing on any platform
+  EXPECT_FALSE(applyCpuAffinity({}));
+
+#ifdef __linux__
+  // Pinning to the current CPU set's first CPU succeeds
+  EXPECT_TRUE(applyCpuAffinity({0u}));
+#endif
+}
+
+/////////////////////////////////////////////////
+TEST_F(UtilTest, ApplyThreadPolicy)
+{
+  // An empty policy applies nothing on any platform
+  EXPECT_FALSE(applyThreadPolicy("", {}, "", 0));
+
+  // An unknown scheduling class applies nothing
+  EXPECT_FALSE(applyThreadPolicy("", {}, "not_a_class", 0));
+
+#ifdef __linux__
+  // Name and affinity apply without special privileges; the "other"
+  // scheduling class is the inherited default, so setting it succeeds
+  EXPECT_TRUE(applyThreadPolicy("gz-util-test", {0u}, "other", 0));
+#endif
+}
@@ -17,6 +17,8 @@
 
 #include "gz/sim/detail/View.hh"
 
+#include <utility>
+
 namespace gz
 {
 namespace sim
@@ -31,6 +33,68 @@ View::View(const std::set<ComponentTypeId>& _compIds)
   this->componentTypes = _compIds;
 }
 
+//////////////////////////////////////////////////
+View::View(const View &_other)
+  : BaseView(_other),
+    validData(_other.validData),
+    validConstData(_other.validConstData),
+    invalidData(_other.invalidData),
+    invalidConstData(_other.invalidConstData),
+    missingCompTracker(_other.missingCompTracker),
+    packedEntities(_other.packedEntities),
+    packedData(_other.packedData),
+    packedConstData(_other.packedConstData),
+    packedDataDirty(_other.packedDataDirty.load())
+{
+}
+
+//////////////////////////////////////////////////
+View::View(View &&_other) noexcept
+  : BaseView(std::move(_other)),
+    validData(std::move(_other.validData)),
+    validConstData(std::move(_other.validConstData)),
+    invalidData(std::move(_other.invalidData)),
+    invalidConstData(std::move(_other.invalidConstData)),
+    missingCompTracker(std::move(_other.missingCompTracker)),
+    packedEntities(std::move(_other.packedEntities)),
+    packedData(std::move(_other.packedData)),
+    packedConstData(std::move(_other.packedConstData)),
+    packedDataDirty(_other.packedDataDirty.load())
+{
+}
+
+//////////////////////////////////////////////////
+View &View::operator=(const View &_other)
+{
+  this->BaseView::operator=(_other);
+  this->validData = _other.validData;
+  this->validConstData = _other.validConstData;
+  this->invalidData = _other.invalidData;
+  this->invalidConstData = _other.invalidConstData;
+  this->missingCompTracker = _other.missingCompTracker;
+  this->packedEntities = _other.packedEntities;
+  this->packedData = _other.packedData;
+  this->packedConstData = _other.packedConstData;
+  this->packedDataDirty = _other.packedDataDirty.load();
+  return *this;
+}
+
+//////////////////////////////////////////////////
+View &View::operator=(View &&_other) noexcept
+{
+  this->BaseView::operator=(std::move(_other));
+  this->validData = std::move(_other.validData);
+  this->validConstData = std::move(_other.validConstData);
+  this->invalidData = std::move(_other.invalidData);
+  this->invalidConstData = std::move(_other.invalidConstData);
+  this->missingCompTracker = std::move(_other.missingCompTracker);
+  this->packedEntities = std::move(_other.packedEntities);
+  this->packedData = std::move(_other.packedData);
+  this->packedConstData = std::move(_other.packedConstData);
+  this->packedDataDirty = _other.packedDataDirty.load();
+  return *this;
+}
+
 //////////////////////////////////////////////////
 const std::vector<const components::BaseComponent *>
     &View::EntityComponentConstData(const Entity _entity) const
@@ -85,10 +149,126 @@ bool View::RemoveEntity(const Entity _entity)
   this->toAddEntities.erase(_entity);
   this->validData.erase(_entity);
   this->validConstData.erase(_entity);
+  this->packedDataDirty = true;
 
   return true;
 }
 
+//////////////////////////////////////////////////
+void View::RemoveEntities(const std::unordered_set<Entity> &_entities)
+{
+  // For a small batch, per-entity removal is cheapest. For a large batch
+  // (e.g. deleting a model with thousands of links), sweeping each container
+  // once and testing membership in the batch avoids paying several hash
+  // erases per entity, most of which are misses for views that don't
+  // contain the entity.
+  const std::size_t cachedSize =
+      this->validData.size() + this->invalidData.size();
+  if (_entities.size() < (cachedSize / 2u) + 1u)
+  {
+    for (const Entity entity : _entities)
+      this->RemoveEntity(entity);
+    return;
+  }
+
+  auto sweepMap = [&_entities](auto &_map)
+  {
+    for (auto it = _map.begin(); it != _map.end();)
+    {
+      if (_entities.find(it->first) != _entities.end())
+        it = _map.erase(it);
+      else
+        ++it;
+    }
+  };
+  auto sweepSet = [&_entities](std::set<Entity> &_set)
+  {
+    for (auto it = _set.begin(); it != _set.end();)
+    {
+      if (_entities.find(*it) != _entities.end())
+        it = _set.erase(it);
+      else
+        ++it;
+    }
+  };
+
+  sweepMap(this->invalidData);
+  sweepMap(this->invalidConstData);
+  sweepMap(this->missingCompTracker);
+  sweepMap(this->validData);
+  sweepMap(this->validConstData);
+  sweepMap(this->toAddEntities);
+  sweepSet(this->entities);
+  sweepSet(this->newEntities);
+  sweepSet(this->toRemoveEntities);
+  this->packedDataDirty = true;
+}
+
+//////////////////////////////////////////////////
+const std::vector<Entity> &View::PackedEntities()
+{
+  // Double-checked: the atomic keeps concurrent readers off the mutex in
+  // steady state, and re-checking under the lock ensures only one of the
+  // threads that observed a pending rebuild actually performs it.
+  if (this->packedDataDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(this->packedDataMutex);
+    if (this->packedDataDirty.load(std::memory_order_acquire))
+      this->RebuildPackedData();
+  }
+  return this->packedEntities;
+}
+
+//////////////////////////////////////////////////
+const std::vector<std::vector<components::BaseComponent *>>
+    &View::PackedComponentData()
+{
+  if (this->packedDataDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(this->packedDataMutex);
+    if (this->packedDataDirty.load(std::memory_order_acquire))
+      this->RebuildPackedData();
+  }
+  return this->packedData;
+}
+
+//////////////////////////////////////////////////
+const std::vector<std::vector<const components::BaseComponent *>>
+    &View::PackedConstComponentData()
+{
+  if (this->packedDataDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(this->packedDataMutex);
+    if (this->packedDataDirty.load(std::memory_order_acquire))
+      this->RebuildPackedData();
+  }
+  return this->packedConstData;
+}
+
+//////////////////////////////////////////////////
+void View::RebuildPackedData()
+{
+  this->packedEntities.clear();
+  this->packedData.clear();
+  this->packedConstData.clear();
+  this->packedEntities.reserve(this->entities.size());
+  this->packedData.reserve(this->entities.size());
+  this->packedConstData.reserve(this->entities.size());
+
+  // iterate over this->entities (instead of validData) so that the packed
+  // arrays preserve the entity ordering that users of Entities() observe
+  for (const Entity entity : this->entities)
+  {
+    this->packedEntities.push_back(entity);
+    this->packedData.push_back(this->validData.at(entity));
+    this->packedConstData.push_back(this->validConstData.at(entity));
+  }
+
+  // The release store pairs with the acquire load in the Packed* methods,
+  // so a thread that skips the rebuild also sees the rebuilt arrays.
+  this->packedDataDirty.store(false, std::memory_order_release);
+}
+
 //////////////////////////////////////////////////
 bool View::NotifyComponentAddition(const Entity _entity,
     bool _newEntity, const ComponentTypeId _typeId)
@@ -118,6 +298,7 @@ bool View::NotifyComponentAddition(const Entity _entity,
     auto constCompNh = this->invalidConstData.extract(_entity);
     this->validConstData.insert(std::move(constCompNh));
     this->entities.insert(_entity);
+    this->packedDataDirty = true;
     if (_newEntity)
       this->newEntities.insert(_entity);
     this->missingCompTracker.erase(_entity);
@@ -154,6 +335,7 @@ bool View::NotifyComponentRemoval(const Entity _entity,
     this->invalidConstData.insert(std::move(constCompNh));
     this->entities.erase(_entity);
     this->newEntities.erase(_entity);
+    this->packedDataDirty = true;
   }
 
   this->missingCompTracker[_entity].insert(_typeId);
@@ -177,6 +359,12 @@ void View::Reset()
   this->invalidData.clear();
   this->invalidConstData.clear();
   this->missingCompTracker.clear();
+
+  // reset the packed storage
+  this->packedEntities.clear();
+  this->packedData.clear();
+  this->packedConstData.clear();
+  this->packedDataDirty = true;
 }
 
 }  // namespace detail
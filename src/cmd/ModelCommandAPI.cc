@@ -19,6 +19,7 @@
 
 #include <gz/msgs/serialized.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
+#include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/stringmsg_v.pb.h>
 
 #include <string>
@@ -538,8 +539,13 @@ void printMagnetometer(const uint64_t _entity,
 //////////////////////////////////////////////////
 // \brief Set the state of a ECM instance with a world snapshot.
 // \param _ecm ECM instance to be populated.
+// \param _scopedName When not empty, only this entity's subtree is
+// requested through the scoped state service, so the transfer is sized by
+// the answer instead of the world. Falls back to the full state against
+// servers that don't serve scoped state.
 // \return boolean indicating if it was able to populate the ECM.
-bool populateECM(EntityComponentManager &_ecm)
+bool populateECM(EntityComponentManager &_ecm,
+    const std::string &_scopedName = "")
 {
   const std::string world = getWorldName();
   if (world.empty())
@@ -552,6 +558,21 @@ bool populateECM(EntityComponentManager &_ecm)
   transport::Node node;
   bool result{false};
   const unsigned int timeout{5000};
+
+  if (!_scopedName.empty())
+  {
+    const std::string scopedService{"/world/" + world + "/state_scoped"};
+    msgs::StringMsg scopedReq;
+    scopedReq.set_data(_scopedName);
+    msgs::SerializedStepMap scopedRes;
+    if (node.Request(scopedService, scopedReq, timeout, scopedRes, result) &&
+        result)
+    {
+      _ecm.SetState(scopedRes.state());
+      return true;
+    }
+  }
+
   const std::string service{"/world/" + world + "/state"};
 
   std::cout << std::endl << "Requesting state for world [" << world
@@ -837,7 +858,7 @@ void cmdModelInfo(
   }
 
   EntityComponentManager ecm{};
-  if (!populateECM(ecm))
+  if (!populateECM(ecm, _modelName))
     return;
 
   // Get the desired model entity.
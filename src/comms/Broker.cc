@@ -23,6 +23,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include <gz/transport/Node.hh>
 #include "gz/sim/comms/Broker.hh"
@@ -191,7 +192,7 @@ void Broker::OnMsg(const gz::msgs::Dataframe &_msg)
   msgPtr->mutable_header()->mutable_stamp()->CopyFrom(
       sim::convert<msgs::Time>(this->dataPtr->time));
 
-  this->DataManager().AddOutbound(_msg.src_address(), msgPtr);
+  this->DataManager().AddOutbound(_msg.src_address(), std::move(msgPtr));
 }
 
 //////////////////////////////////////////////////
@@ -44,6 +44,11 @@ class gz::sim::comms::ICommsModel::Implementation
 
   /// \brief Current time.
   public: std::chrono::steady_clock::time_point currentTime;
+
+  /// \brief Scratch registry stepped each iteration. Reused across steps so
+  /// the per-step working copy recycles the previous step's storage instead
+  /// of reallocating every queue and string.
+  public: Registry scratchRegistry;
 };
 
 //////////////////////////////////////////////////
@@ -114,12 +119,15 @@ void ICommsModel::StepImpl(const UpdateInfo &_info,
   // Update the time in the broker.
   this->dataPtr->broker.SetTime(_info.simTime);
 
-  // Step the comms model.
+  // Step the comms model. The working copy is reused across steps and
+  // swapped in afterwards, so neither direction deep-copies into freshly
+  // allocated storage.
   const Registry &currentRegistry =
     this->dataPtr->broker.DataManager().DataConst();
-  Registry newRegistry = this->dataPtr->broker.DataManager().Copy();
+  Registry &newRegistry = this->dataPtr->scratchRegistry;
+  this->dataPtr->broker.DataManager().CopyInto(newRegistry);
   this->Step(_info, currentRegistry, newRegistry, _ecm);
-  this->dataPtr->broker.DataManager().Set(newRegistry);
+  this->dataPtr->broker.DataManager().Swap(newRegistry);
 
   this->dataPtr->broker.Unlock();
 
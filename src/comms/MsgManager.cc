@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include <gz/transport/Node.hh>
 #include <gz/utils/ImplPtr.hh>
@@ -79,6 +80,13 @@ void MsgManager::AddInbound(const std::string &_address,
   this->dataPtr->data[_address].inboundMsgs.push_back(_msg);
 }
 
+//////////////////////////////////////////////////
+void MsgManager::AddInbound(const std::string &_address,
+                            msgs::DataframeSharedPtr &&_msg)
+{
+  this->dataPtr->data[_address].inboundMsgs.push_back(std::move(_msg));
+}
+
 //////////////////////////////////////////////////
 void MsgManager::AddOutbound(const std::string &_address,
                              const msgs::DataframeSharedPtr &_msg)
@@ -86,6 +94,13 @@ void MsgManager::AddOutbound(const std::string &_address,
   this->dataPtr->data[_address].outboundMsgs.push_back(_msg);
 }
 
+//////////////////////////////////////////////////
+void MsgManager::AddOutbound(const std::string &_address,
+                             msgs::DataframeSharedPtr &&_msg)
+{
+  this->dataPtr->data[_address].outboundMsgs.push_back(std::move(_msg));
+}
+
 //////////////////////////////////////////////////
 bool MsgManager::RemoveSubscriber(const std::string &_address,
                                   const std::string &_topic)
@@ -180,8 +195,37 @@ Registry MsgManager::Copy() const
   return this->dataPtr->data;
 }
 
+//////////////////////////////////////////////////
+void MsgManager::CopyInto(Registry &_dest) const
+{
+  // Drop addresses that no longer exist.
+  for (auto it = _dest.begin(); it != _dest.end();)
+  {
+    if (this->dataPtr->data.count(it->first) == 0)
+      it = _dest.erase(it);
+    else
+      ++it;
+  }
+
+  // Copy-assign per address so existing queue and string storage is reused.
+  for (const auto & [address, content] : this->dataPtr->data)
+    _dest[address] = content;
+}
+
 //////////////////////////////////////////////////
 void MsgManager::Set(const Registry &_newContent)
 {
   this->dataPtr->data = _newContent;
 }
+
+//////////////////////////////////////////////////
+void MsgManager::Set(Registry &&_newContent)
+{
+  this->dataPtr->data = std::move(_newContent);
+}
+
+//////////////////////////////////////////////////
+void MsgManager::Swap(Registry &_other)
+{
+  std::swap(this->dataPtr->data, _other);
+}
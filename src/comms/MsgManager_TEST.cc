@@ -19,6 +19,7 @@
 #include <gz/msgs/dataframe.pb.h>
 
 #include <unordered_map>
+#include <utility>
 
 #include "gz/sim/comms/MsgManager.hh"
 #include "helpers/EnvTestFixture.hh"
@@ -143,4 +144,30 @@ TEST_F(MsgManagerTest, MsgManager)
   auto it = msgManager.DataConst().find("addr6");
   EXPECT_TRUE(it->second.subscriptions.empty());
 
+  // Test CopyInto. Stale addresses in the destination are removed.
+  std::unordered_map<std::string, comms::AddressContent> dest;
+  dest["stale"].inboundMsgs.push_back(msgIn2);
+  msgManager.CopyInto(dest);
+  EXPECT_EQ(dest.end(), dest.find("stale"));
+  EXPECT_NE(dest.end(), dest.find("addr6"));
+  EXPECT_EQ(1u, dest["addr6"].inboundMsgs.size());
+  EXPECT_EQ(msgIn2, dest["addr6"].inboundMsgs[0u]);
+
+  // Test swap. The manager takes the given registry and the caller gets
+  // the manager's previous content back.
+  std::unordered_map<std::string, comms::AddressContent> other;
+  other["addr7"].outboundMsgs.push_back(msgOut2);
+  msgManager.Swap(other);
+  EXPECT_EQ(msgManager.Data().end(), msgManager.Data().find("addr6"));
+  EXPECT_EQ(1u, msgManager.Data()["addr7"].outboundMsgs.size());
+  EXPECT_NE(other.end(), other.find("addr6"));
+
+  // Test move-based set and inbound/outbound insertion.
+  auto msgIn3 = std::make_shared<msgs::Dataframe>();
+  auto rawMsgIn3 = msgIn3.get();
+  msgManager.Set(std::move(other));
+  EXPECT_NE(msgManager.Data().end(), msgManager.Data().find("addr6"));
+  msgManager.AddInbound("addr8", std::move(msgIn3));
+  EXPECT_EQ(1u, msgManager.Data()["addr8"].inboundMsgs.size());
+  EXPECT_EQ(rawMsgIn3, msgManager.Data()["addr8"].inboundMsgs[0u].get());
 }
@@ -16,6 +16,7 @@
 */
 
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -41,6 +42,7 @@
 #include "gz/sim/SystemLoader.hh"
 
 #include "GuiRunner.hh"
+#include "../ShmStateChannel.hh"
 
 using namespace gz;
 using namespace sim;
@@ -61,6 +63,17 @@ class gz::sim::GuiRunner::Implementation
   /// \brief Topic to request state
   public: std::string stateTopic;
 
+  /// \brief World name this runner is attached to.
+  public: std::string worldName;
+
+  /// \brief Shared memory state channel reader. While unattached, state
+  /// flows over the transport subscription instead.
+  public: ShmStateReader shmStateReader;
+
+  /// \brief Reused buffer for snapshots copied out of the shared memory
+  /// channel.
+  public: std::string shmStateBuffer;
+
   /// \brief Latest update info
   public: UpdateInfo updateInfo;
 
@@ -76,6 +89,17 @@ class gz::sim::GuiRunner::Implementation
   /// \brief True if the initial state has been received and processed.
   public: bool receivedInitialState{false};
 
+  /// \brief State messages received from the transport thread, waiting to
+  /// be applied on the Qt thread. Protected by stateMsgMutex.
+  public: std::vector<msgs::SerializedStepMap> stagedStateMsgs;
+
+  /// \brief True while a ProcessStagedStates invocation is queued on the
+  /// Qt thread. Protected by stateMsgMutex.
+  public: bool processStatesQueued{false};
+
+  /// \brief Mutex to protect stagedStateMsgs and processStatesQueued.
+  public: std::mutex stateMsgMutex;
+
   /// \brief Name of WorldControl service
   public: std::string controlService;
 
@@ -112,6 +136,7 @@ GuiRunner::GuiRunner(const std::string &_worldName)
   qRegisterMetaType<msgs::SerializedStepMap>();
 
   this->setProperty("worldName", QString::fromStdString(_worldName));
+  this->dataPtr->worldName = _worldName;
 
   // Allow for creation of entities on GUI side.
   // Note we have to start the entity id at an offset so it does not conflict
@@ -219,6 +244,16 @@ bool GuiRunner::eventFilter(QObject *_obj, QEvent *_event)
 
 /////////////////////////////////////////////////
 void GuiRunner::RequestState()
+{
+  // Subscribe to periodic updates.
+  this->dataPtr->node.Subscribe(this->dataPtr->stateTopic,
+      &GuiRunner::OnState, this);
+
+  this->RequestStateAsync();
+}
+
+/////////////////////////////////////////////////
+void GuiRunner::RequestStateAsync()
 {
   // set up service for async state response callback
   std::string id = std::to_string(gz::gui::App()->applicationPid());
@@ -247,9 +282,12 @@ void GuiRunner::RequestState()
   msgs::StringMsg req;
   req.set_data(reqSrv);
 
-  // Subscribe to periodic updates.
-  this->dataPtr->node.Subscribe(this->dataPtr->stateTopic,
-      &GuiRunner::OnState, this);
+  // Negotiate chunked delivery: a broadcaster that understands this header
+  // streams the initial state in entity-granular chunks that are applied
+  // as they arrive; an older one ignores it and replies in one piece.
+  auto *chunked = req.mutable_header()->add_data();
+  chunked->set_key("chunked");
+  chunked->add_value("true");
 
   // send async state request
   this->dataPtr->node.Request(this->dataPtr->stateTopic + "_async", req);
@@ -264,6 +302,22 @@ void GuiRunner::OnStateAsyncService(const msgs::SerializedStepMap &_res)
   // variables.
   QMetaObject::invokeMethod(this, "OnStateQt", Qt::QueuedConnection,
                             Q_ARG(msgs::SerializedStepMap, _res));
+
+  // A chunked broadcaster tags every piece with the number of chunks still
+  // in flight; a legacy response carries no tag and is complete on its own.
+  // Keep the response service up until the final chunk has landed.
+  bool complete = true;
+  for (const auto &data : _res.state().header().data())
+  {
+    if (data.key() == "chunks_remaining" && data.value_size() > 0)
+    {
+      complete = data.value(0) == "0";
+      break;
+    }
+  }
+  if (!complete)
+    return;
+
   this->dataPtr->receivedInitialState = true;
 
   // todo(anyone) store reqSrv string in a member variable and use it here
@@ -284,12 +338,53 @@ void GuiRunner::OnState(const msgs::SerializedStepMap &_msg)
   if (!this->dataPtr->receivedInitialState)
     return;
 
-  // Since this function may be called from a transport thread, we push the
-  // OnStateQt function to the queue so that its called from the Qt thread. This
-  // ensures that only one thread has access to the ecm and updateInfo
-  // variables.
-  QMetaObject::invokeMethod(this, "OnStateQt", Qt::QueuedConnection,
-                            Q_ARG(msgs::SerializedStepMap, _msg));
+  // Since this function may be called from a transport thread, the message
+  // is staged and applied from the Qt thread. This ensures that only one
+  // thread has access to the ecm and updateInfo variables. At most one
+  // apply is queued at a time: if the Qt thread falls behind, messages
+  // accumulate in the staging buffer and are all applied in a single event
+  // with a single plugin update, instead of one full update per message.
+  bool queueInvoke = false;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->stateMsgMutex);
+    this->dataPtr->stagedStateMsgs.push_back(_msg);
+    if (!this->dataPtr->processStatesQueued)
+    {
+      this->dataPtr->processStatesQueued = true;
+      queueInvoke = true;
+    }
+  }
+  if (queueInvoke)
+  {
+    QMetaObject::invokeMethod(this, "ProcessStagedStates",
+                              Qt::QueuedConnection);
+  }
+}
+
+/////////////////////////////////////////////////
+void GuiRunner::ProcessStagedStates()
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("GuiRunner::ProcessStagedStates");
+
+  std::vector<msgs::SerializedStepMap> msgs;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->stateMsgMutex);
+    msgs.swap(this->dataPtr->stagedStateMsgs);
+    this->dataPtr->processStatesQueued = false;
+  }
+
+  if (msgs.empty())
+    return;
+
+  // Periodic states are diffs, so every staged message has to be applied;
+  // only the plugin update is coalesced.
+  for (const auto &msg : msgs)
+  {
+    this->dataPtr->ecm.SetState(msg.state());
+  }
+  this->dataPtr->updateInfo = convert<UpdateInfo>(msgs.back().stats());
+  this->UpdatePlugins();
 }
 
 /////////////////////////////////////////////////
@@ -304,9 +399,63 @@ void GuiRunner::OnStateQt(const msgs::SerializedStepMap &_msg)
   this->UpdatePlugins();
 }
 
+/////////////////////////////////////////////////
+void GuiRunner::PollShmState()
+{
+  // The transport path owns state sync until the initial state arrived.
+  if (!this->dataPtr->receivedInitialState)
+    return;
+
+  if (!this->dataPtr->shmStateReader.Valid())
+  {
+    // The server creates the segment when it starts; keep trying so a GUI
+    // started first still attaches. The name matches the one built by
+    // SceneBroadcaster, partition included.
+    if (!this->dataPtr->shmStateReader.Attach(
+        this->dataPtr->node.Options().Partition() + "-" +
+        this->dataPtr->worldName))
+    {
+      return;
+    }
+    gzdbg << "Attached to shared memory state segment; state updates now "
+           << "bypass transport." << std::endl;
+    this->dataPtr->node.Unsubscribe(this->dataPtr->stateTopic);
+  }
+
+  GZ_PROFILE("GuiRunner::PollShmState");
+  bool missedSnapshot{false};
+  if (!this->dataPtr->shmStateReader.Poll(this->dataPtr->shmStateBuffer,
+      missedSnapshot))
+  {
+    return;
+  }
+
+  msgs::SerializedStepMap msg;
+  if (!msg.ParseFromString(this->dataPtr->shmStateBuffer))
+    return;
+  this->dataPtr->ecm.SetState(msg.state());
+  this->dataPtr->updateInfo = convert<UpdateInfo>(msg.stats());
+
+  // The slot only holds the latest delta, so a skipped sequence number
+  // means one-time changes (entity creations and removals) may be lost
+  // for good; ask the server for a full state to resync. The first poll
+  // after attaching reports a miss too, which covers whatever was
+  // published during the switchover from the transport subscription.
+  if (missedSnapshot)
+  {
+    gzdbg << "Missed state snapshots on the shared memory channel; "
+           << "requesting a full state." << std::endl;
+    this->RequestStateAsync();
+  }
+}
+
 /////////////////////////////////////////////////
 void GuiRunner::UpdatePlugins()
 {
+  // Pick up state from the shared memory channel when it is attached; this
+  // runs on the Qt thread, same as OnStateQt.
+  this->PollShmState();
+
   // gui plugins
   auto plugins = gz::gui::App()->findChildren<GuiSystem *>();
   for (auto plugin : plugins)
@@ -69,9 +69,23 @@ class GZ_SIM_GUI_VISIBLE GuiRunner : public QObject
   /// \param[in] _msg New state message.
   private: Q_INVOKABLE void OnStateQt(const msgs::SerializedStepMap &_msg);
 
+  /// \brief Called by the Qt thread to apply all state messages staged by
+  /// OnState since the last invocation, then update the plugins once.
+  private: Q_INVOKABLE void ProcessStagedStates();
+
   /// \brief Update the plugins.
   private: Q_INVOKABLE void UpdatePlugins();
 
+  /// \brief Poll the shared memory state channel. Attaches lazily once the
+  /// server has created the segment; until then state flows over transport.
+  /// Missed snapshots trigger a full state re-request.
+  private: void PollShmState();
+
+  /// \brief Request a full state over the async state service without
+  /// touching the state topic subscription. Used for the initial request
+  /// and to resync after snapshots were missed.
+  private: void RequestStateAsync();
+
   /// \brief Load systems
   private: void LoadSystems();
 
@@ -171,6 +171,24 @@ void removeSuffix(const std::string &_suffix, std::string &_s)
 using namespace gz;
 using namespace sim;
 
+//////////////////////////////////////////////////
+/// \brief Write the data type and data roles of an item, skipping roles
+/// whose stored value is already equal. The inspector refreshes every
+/// component of the selected entity each update cycle, so this keeps
+/// unchanged rows from emitting itemChanged (and re-evaluating their QML
+/// delegates) every frame.
+static void setDataIfChanged(QStandardItem *_item, const QString &_dataType,
+    const QVariant &_data)
+{
+  static const int dataTypeRole = ComponentsModel::RoleNames().key("dataType");
+  static const int dataRole = ComponentsModel::RoleNames().key("data");
+
+  if (_item->data(dataTypeRole).toString() != _dataType)
+    _item->setData(_dataType, dataTypeRole);
+  if (_item->data(dataRole) != _data)
+    _item->setData(_data, dataRole);
+}
+
 //////////////////////////////////////////////////
 template<>
 void gz::sim::setData(QStandardItem *_item, const msgs::Light &_data)
@@ -192,9 +210,7 @@ void gz::sim::setData(QStandardItem *_item, const msgs::Light &_data)
     lightType = 2;
   }
 
-  _item->setData(QString("Light"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QList({
+  setDataIfChanged(_item, QString("Light"), QList({
     QVariant(_data.specular().r()),
     QVariant(_data.specular().g()),
     QVariant(_data.specular().b()),
@@ -218,7 +234,7 @@ void gz::sim::setData(QStandardItem *_item, const msgs::Light &_data)
     QVariant(lightType),
     QVariant(!_data.is_light_off()),
     QVariant(_data.visualize_visual())
-  }), ComponentsModel::RoleNames().key("data"));
+  }));
 }
 
 //////////////////////////////////////////////////
@@ -229,13 +245,11 @@ void sim::setData(QStandardItem *_item,
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Vector3d"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QList({
+  setDataIfChanged(_item, QString("Vector3d"), QList({
     QVariant(_data.X()),
     QVariant(_data.Y()),
     QVariant(_data.Z())
-  }), ComponentsModel::RoleNames().key("data"));
+  }));
 }
 
 //////////////////////////////////////////////////
@@ -245,10 +259,7 @@ void sim::setData(QStandardItem *_item, const std::string &_data)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("String"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QString::fromStdString(_data),
-      ComponentsModel::RoleNames().key("data"));
+  setDataIfChanged(_item, QString("String"), QString::fromStdString(_data));
 }
 
 //////////////////////////////////////////////////
@@ -259,10 +270,8 @@ void sim::setData(QStandardItem *_item,
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Raw"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QString::fromStdString(_data.str()),
-      ComponentsModel::RoleNames().key("data"));
+  setDataIfChanged(_item, QString("Raw"),
+      QString::fromStdString(_data.str()));
 }
 
 //////////////////////////////////////////////////
@@ -272,9 +281,7 @@ void sim::setData(QStandardItem *_item, const bool &_data)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Boolean"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(_data, ComponentsModel::RoleNames().key("data"));
+  setDataIfChanged(_item, QString("Boolean"), _data);
 }
 
 //////////////////////////////////////////////////
@@ -284,9 +291,7 @@ void sim::setData(QStandardItem *_item, const int &_data)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Integer"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(_data, ComponentsModel::RoleNames().key("data"));
+  setDataIfChanged(_item, QString("Integer"), _data);
 }
 
 //////////////////////////////////////////////////
@@ -303,9 +308,7 @@ void sim::setData(QStandardItem *_item, const double &_data)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Float"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(_data, ComponentsModel::RoleNames().key("data"));
+  setDataIfChanged(_item, QString("Float"), _data);
 }
 
 //////////////////////////////////////////////////
@@ -315,12 +318,10 @@ void sim::setData(QStandardItem *_item, const sdf::Physics &_data)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Physics"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QList({
+  setDataIfChanged(_item, QString("Physics"), QList({
     QVariant(_data.MaxStepSize()),
     QVariant(_data.RealTimeFactor())
-  }), ComponentsModel::RoleNames().key("data"));
+  }));
 }
 
 //////////////////////////////////////////////////
@@ -331,9 +332,7 @@ void sim::setData(QStandardItem *_item,
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("Material"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QList({
+  setDataIfChanged(_item, QString("Material"), QList({
     QVariant(_data.Ambient().R()),
     QVariant(_data.Ambient().G()),
     QVariant(_data.Ambient().B()),
@@ -350,7 +349,7 @@ void sim::setData(QStandardItem *_item,
     QVariant(_data.Emissive().G()),
     QVariant(_data.Emissive().B()),
     QVariant(_data.Emissive().A())
-  }), ComponentsModel::RoleNames().key("data"));
+  }));
 
   // TODO(anyone) Only shows colors of material,
   // need to add others (e.g., pbr)
@@ -364,16 +363,14 @@ void sim::setData(QStandardItem *_item,
   if (nullptr == _item)
     return;
 
-  _item->setData(QString("SphericalCoordinates"),
-      ComponentsModel::RoleNames().key("dataType"));
-  _item->setData(QList({
+  setDataIfChanged(_item, QString("SphericalCoordinates"), QList({
     QVariant(QString::fromStdString(math::SphericalCoordinates::Convert(
         _data.Surface()))),
     QVariant(_data.LatitudeReference().Degree()),
     QVariant(_data.LongitudeReference().Degree()),
     QVariant(_data.ElevationReference()),
     QVariant(_data.HeadingOffset().Degree()),
-  }), ComponentsModel::RoleNames().key("data"));
+  }));
 }
 
 //////////////////////////////////////////////////
@@ -382,8 +379,10 @@ void sim::setUnit(QStandardItem *_item, const std::string &_unit)
   if (nullptr == _item)
     return;
 
-  _item->setData(QString::fromStdString(_unit),
-      ComponentsModel::RoleNames().key("unit"));
+  static const int unitRole = ComponentsModel::RoleNames().key("unit");
+  auto unit = QString::fromStdString(_unit);
+  if (_item->data(unitRole).toString() != unit)
+    _item->setData(unit, unitRole);
 }
 
 /////////////////////////////////////////////////
@@ -459,15 +458,17 @@ QHash<int, QByteArray> ComponentsModel::roleNames() const
 }
 
 /////////////////////////////////////////////////
-QHash<int, QByteArray> ComponentsModel::RoleNames()
+const QHash<int, QByteArray> &ComponentsModel::RoleNames()
 {
-  return {std::pair(100, "typeName"),
+  static const QHash<int, QByteArray> roles{
+          std::pair(100, "typeName"),
           std::pair(101, "typeId"),
           std::pair(102, "shortName"),
           std::pair(103, "dataType"),
           std::pair(104, "unit"),
           std::pair(105, "data"),
           std::pair(106, "entity")};
+  return roles;
 }
 
 /////////////////////////////////////////////////
@@ -601,8 +602,10 @@ void ComponentInspector::Update(const UpdateInfo &,
       item = this->dataPtr->componentsModel.AddComponentType(typeId);
     }
 
-    item->setData(QString::number(this->dataPtr->entity),
-                  ComponentsModel::RoleNames().key("entity"));
+    static const int entityRole = ComponentsModel::RoleNames().key("entity");
+    auto entityStr = QString::number(this->dataPtr->entity);
+    if (item->data(entityRole).toString() != entityStr)
+      item->setData(entityStr, entityRole);
 
     if (nullptr == item)
     {
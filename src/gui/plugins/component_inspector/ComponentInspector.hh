@@ -148,8 +148,10 @@ namespace sim
     public: QHash<int, QByteArray> roleNames() const override;
 
     /// \brief Static version of roleNames
-    /// \return A hash connecting a unique identifier to a role name.
-    public: static QHash<int, QByteArray> RoleNames();
+    /// \return A hash connecting a unique identifier to a role name. The
+    /// hash is built once and shared, so callers may look up keys per
+    /// update without rebuilding it.
+    public: static const QHash<int, QByteArray> &RoleNames();
 
     /// \brief Add a component type to the inspector.
     /// \param[in] _typeId Type of component to be added.
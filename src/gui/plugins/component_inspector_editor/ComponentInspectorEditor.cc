@@ -18,10 +18,14 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <optional>
 #include <regex>
 #include <vector>
 
 #include <QColorDialog>
+#include <gz/msgs/physics.pb.h>
+#include <gz/msgs/spherical_coordinates.pb.h>
+#include <gz/msgs/visual.pb.h>
 #include <gz/common/Console.hh>
 #include <gz/common/MeshManager.hh>
 #include <gz/common/Profiler.hh>
@@ -161,6 +165,22 @@ namespace gz::sim
     public: std::vector<
             std::function<void(EntityComponentManager &)>> updateCallbacks;
 
+    /// \brief Pending light commands keyed by entity. Successive edits of
+    /// the same light within one update cycle collapse into a single
+    /// request carrying the latest values.
+    public: std::map<Entity, msgs::Light> pendingLightCmds;
+
+    /// \brief Pending visual material commands keyed by entity, coalesced
+    /// like \ref pendingLightCmds.
+    public: std::map<Entity, msgs::Visual> pendingVisualCmds;
+
+    /// \brief Pending physics command; successive edits overwrite it.
+    public: std::optional<msgs::Physics> pendingPhysicsCmd;
+
+    /// \brief Pending spherical coordinates command; successive edits
+    /// overwrite it.
+    public: std::optional<msgs::SphericalCoordinates> pendingSphericalCmd;
+
     /// \brief A map of component type to creation functions.
     public: std::map<ComponentTypeId, ComponentCreator> componentCreators;
   };
@@ -989,6 +1009,101 @@ void ComponentInspectorEditor::Update(const UpdateInfo &_info,
   for (auto cb : this->dataPtr->updateCallbacks)
     cb(_ecm);
   this->dataPtr->updateCallbacks.clear();
+
+  // Flush the staged edit commands. Edits of the same target made during
+  // this cycle have been coalesced, so each target costs one request.
+  if (!this->dataPtr->pendingLightCmds.empty())
+  {
+    std::function<void(const msgs::Boolean &, const bool)> cb =
+        [](const msgs::Boolean &/*_rep*/, const bool _result)
+    {
+      if (!_result)
+        gzerr << "Error setting light configuration" << std::endl;
+    };
+
+    auto lightConfigService = transport::TopicUtils::AsValidTopic(
+        "/world/" + this->dataPtr->worldName + "/light_config");
+    if (lightConfigService.empty())
+    {
+      gzerr << "Invalid light command service topic provided" << std::endl;
+    }
+    else
+    {
+      for (const auto &cmd : this->dataPtr->pendingLightCmds)
+        this->dataPtr->node.Request(lightConfigService, cmd.second, cb);
+    }
+    this->dataPtr->pendingLightCmds.clear();
+  }
+
+  if (!this->dataPtr->pendingVisualCmds.empty())
+  {
+    std::function<void(const msgs::Boolean &, const bool)> cb =
+        [](const msgs::Boolean &/*_rep*/, const bool _result)
+    {
+      if (!_result)
+        gzerr << "Error setting material color configuration"
+               << " on visual" << std::endl;
+    };
+
+    auto materialCmdService = transport::TopicUtils::AsValidTopic(
+        "/world/" + this->dataPtr->worldName + "/visual_config");
+    if (materialCmdService.empty())
+    {
+      gzerr << "Invalid material command service topic provided" << std::endl;
+    }
+    else
+    {
+      for (const auto &cmd : this->dataPtr->pendingVisualCmds)
+        this->dataPtr->node.Request(materialCmdService, cmd.second, cb);
+    }
+    this->dataPtr->pendingVisualCmds.clear();
+  }
+
+  if (this->dataPtr->pendingPhysicsCmd)
+  {
+    std::function<void(const msgs::Boolean &, const bool)> cb =
+        [](const msgs::Boolean &/*_rep*/, const bool _result)
+    {
+      if (!_result)
+        gzerr << "Error setting physics parameters" << std::endl;
+    };
+
+    auto physicsCmdService = transport::TopicUtils::AsValidTopic(
+        "/world/" + this->dataPtr->worldName + "/set_physics");
+    if (physicsCmdService.empty())
+    {
+      gzerr << "Invalid physics command service topic provided" << std::endl;
+    }
+    else
+    {
+      this->dataPtr->node.Request(physicsCmdService,
+          *this->dataPtr->pendingPhysicsCmd, cb);
+    }
+    this->dataPtr->pendingPhysicsCmd.reset();
+  }
+
+  if (this->dataPtr->pendingSphericalCmd)
+  {
+    std::function<void(const msgs::Boolean &, const bool)> cb =
+        [](const msgs::Boolean &/*_rep*/, const bool _result)
+    {
+      if (!_result)
+        gzerr << "Error setting spherical coordinates." << std::endl;
+    };
+
+    auto sphericalCoordsCmdService = transport::TopicUtils::AsValidTopic(
+        "/world/" + this->dataPtr->worldName + "/set_spherical_coordinates");
+    if (sphericalCoordsCmdService.empty())
+    {
+      gzerr << "Invalid spherical coordinates service" << std::endl;
+    }
+    else
+    {
+      this->dataPtr->node.Request(sphericalCoordsCmdService,
+          *this->dataPtr->pendingSphericalCmd, cb);
+    }
+    this->dataPtr->pendingSphericalCmd.reset();
+  }
 }
 
 /////////////////////////////////////////////////
@@ -1118,13 +1233,6 @@ void ComponentInspectorEditor::OnLight(
   double _directionY, double _directionZ, double _innerAngle,
   double _outerAngle, double _falloff, double _intensity, int _type)
 {
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting light configuration" << std::endl;
-  };
-
   gz::msgs::Light req;
   req.set_name(this->dataPtr->entityName);
   req.set_id(this->dataPtr->entity);
@@ -1159,40 +1267,21 @@ void ComponentInspectorEditor::OnLight(
       gz::math::Vector3d(_directionX, _directionY, _directionZ));
   }
 
-  auto lightConfigService = "/world/" + this->dataPtr->worldName +
-    "/light_config";
-  lightConfigService = transport::TopicUtils::AsValidTopic(lightConfigService);
-  if (lightConfigService.empty())
-  {
-    gzerr << "Invalid light command service topic provided" << std::endl;
-    return;
-  }
-  this->dataPtr->node.Request(lightConfigService, req, cb);
+  // Stage the edit; all edits of one update cycle are sent as a batch.
+  this->dataPtr->pendingLightCmds[this->dataPtr->entity] = req;
 }
 
 /////////////////////////////////////////////////
 void ComponentInspectorEditor::OnPhysics(double _stepSize,
     double _realTimeFactor)
 {
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-        gzerr << "Error setting physics parameters" << std::endl;
-  };
-
   gz::msgs::Physics req;
   req.set_max_step_size(_stepSize);
   req.set_real_time_factor(_realTimeFactor);
-  auto physicsCmdService = "/world/" + this->dataPtr->worldName
-      + "/set_physics";
-  physicsCmdService = transport::TopicUtils::AsValidTopic(physicsCmdService);
-  if (physicsCmdService.empty())
-  {
-    gzerr << "Invalid physics command service topic provided" << std::endl;
-    return;
-  }
-  this->dataPtr->node.Request(physicsCmdService, req, cb);
+
+  // Stage the edit; only the latest values of one update cycle are sent,
+  // so there is a single physics parameter refresh per batch.
+  this->dataPtr->pendingPhysicsCmd = req;
 }
 
 /////////////////////////////////////////////////
@@ -1250,14 +1339,6 @@ void ComponentInspectorEditor::OnMaterialColor(
     }
   }
 
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting material color configuration"
-             << " on visual" << std::endl;
-  };
-
   msgs::Visual req;
   req.set_id(this->dataPtr->entity);
 
@@ -1274,15 +1355,8 @@ void ComponentInspectorEditor::OnMaterialColor(
     math::Color(_rEmissive / 255.0, _gEmissive / 255.0,
       _bEmissive / 255.0, _aEmissive / 255.0));
 
-  auto materialCmdService = "/world/" + this->dataPtr->worldName
-      + "/visual_config";
-  materialCmdService = transport::TopicUtils::AsValidTopic(materialCmdService);
-  if (materialCmdService.empty())
-  {
-    gzerr << "Invalid material command service topic provided" << std::endl;
-    return;
-  }
-  this->dataPtr->node.Request(materialCmdService, req, cb);
+  // Stage the edit; all edits of one update cycle are sent as a batch.
+  this->dataPtr->pendingVisualCmds[this->dataPtr->entity] = req;
 }
 
 /////////////////////////////////////////////////
@@ -1297,13 +1371,6 @@ void ComponentInspectorEditor::OnSphericalCoordinates(QString _surface,
     return;
   }
 
-  std::function<void(const msgs::Boolean &, const bool)> cb =
-      [](const msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting spherical coordinates." << std::endl;
-  };
-
   msgs::SphericalCoordinates req;
   req.set_surface_model(msgs::SphericalCoordinates::EARTH_WGS84);
   req.set_latitude_deg(_latitude);
@@ -1311,16 +1378,8 @@ void ComponentInspectorEditor::OnSphericalCoordinates(QString _surface,
   req.set_elevation(_elevation);
   req.set_heading_deg(_heading);
 
-  auto sphericalCoordsCmdService = "/world/" + this->dataPtr->worldName
-      + "/set_spherical_coordinates";
-  sphericalCoordsCmdService =
-      transport::TopicUtils::AsValidTopic(sphericalCoordsCmdService);
-  if (sphericalCoordsCmdService.empty())
-  {
-    gzerr << "Invalid spherical coordinates service" << std::endl;
-    return;
-  }
-  this->dataPtr->node.Request(sphericalCoordsCmdService, req, cb);
+  // Stage the edit; only the latest values of one update cycle are sent.
+  this->dataPtr->pendingSphericalCmd = req;
 }
 
 /////////////////////////////////////////////////
@@ -78,6 +78,12 @@ namespace gz::sim
 using namespace gz;
 using namespace sim;
 
+// Role IDs returned by TreeModel::roleNames(). Kept as constants so item
+// updates don't rebuild the role hash just to look up a key.
+static constexpr int kRoleEntityName = 100;
+static constexpr int kRoleEntity = 101;
+static constexpr int kRoleType = 102;
+
 //////////////////////////////////////////////////
 QString entityType(Entity _entity,
     const EntityComponentManager &_ecm)
@@ -119,6 +125,9 @@ QString entityType(Entity _entity,
 TreeModel::TreeModel() : QStandardItemModel()
 {
   qRegisterMetaType<Entity>("Entity");
+  qRegisterMetaType<QVector<gz::sim::TreeModel::EntityInfo>>(
+      "QVector<gz::sim::TreeModel::EntityInfo>");
+  qRegisterMetaType<QVector<Entity>>("QVector<gz::sim::Entity>");
 }
 
 /////////////////////////////////////////////////
@@ -159,10 +168,9 @@ void TreeModel::AddEntity(Entity _entity, const QString &_entityName,
 
   // New entity item
   auto entityItem = new QStandardItem(_entityName);
-  entityItem->setData(_entityName, this->roleNames().key("entityName"));
-  entityItem->setData(QString::number(_entity),
-      this->roleNames().key("entity"));
-  entityItem->setData(_type, this->roleNames().key("type"));
+  entityItem->setData(_entityName, kRoleEntityName);
+  entityItem->setData(QString::number(_entity), kRoleEntity);
+  entityItem->setData(_type, kRoleType);
 
   parentItem->appendRow(entityItem);
 
@@ -214,8 +222,7 @@ void TreeModel::RemoveEntity(Entity _entity)
     {
       auto childItem = _item->child(i);
       removeChildren(childItem);
-      this->entityItems.erase(childItem->data(
-          this->roleNames().key("entity")).toUInt());
+      this->entityItems.erase(childItem->data(kRoleEntity).toUInt());
     }
   };
   this->entityItems.erase(_entity);
@@ -236,7 +243,7 @@ QString TreeModel::EntityType(const QModelIndex &_index) const
   if (!item)
     return type;
 
-  QVariant typeVar  = item->data(this->roleNames().key("type"));
+  QVariant typeVar  = item->data(kRoleType);
   if (!typeVar.isValid())
     return type;
 
@@ -272,7 +279,7 @@ Entity TreeModel::EntityId(const QModelIndex &_index) const
   if (!item)
     return entity;
 
-  QVariant entityVar  = item->data(this->roleNames().key("entity"));
+  QVariant entityVar  = item->data(kRoleEntity);
   if (!entityVar.isValid())
     return entity;
 
@@ -282,9 +289,32 @@ Entity TreeModel::EntityId(const QModelIndex &_index) const
 /////////////////////////////////////////////////
 QHash<int, QByteArray> TreeModel::roleNames() const
 {
-  return {std::pair(100, "entityName"),
-          std::pair(101, "entity"),
-          std::pair(102, "type")};
+  return {std::pair(kRoleEntityName, "entityName"),
+          std::pair(kRoleEntity, "entity"),
+          std::pair(kRoleType, "type")};
+}
+
+/////////////////////////////////////////////////
+void TreeModel::AddEntities(
+    const QVector<gz::sim::TreeModel::EntityInfo> &_entities)
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("TreeModel::AddEntities");
+  for (const auto &info : _entities)
+  {
+    this->AddEntity(info.entity, info.name, info.parentEntity, info.type);
+  }
+}
+
+/////////////////////////////////////////////////
+void TreeModel::RemoveEntities(const QVector<gz::sim::Entity> &_entities)
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("TreeModel::RemoveEntities");
+  for (const auto entity : _entities)
+  {
+    this->RemoveEntity(entity);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -313,6 +343,13 @@ void EntityTree::LoadConfig(const tinyxml2::XMLElement *)
 void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
 {
   GZ_PROFILE("EntityTree::Update");
+
+  // Additions and removals are collected and pushed to the Qt thread as one
+  // queued invocation per batch, rather than one queued event per entity,
+  // which matters when a large world is first loaded.
+  QVector<TreeModel::EntityInfo> entitiesToAdd;
+  QVector<Entity> entitiesToRemove;
+
   // Treat all pre-existent entities as new at startup
   if (!this->dataPtr->initialized)
   {
@@ -345,12 +382,9 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      entitiesToAdd.push_back({_entity,
+          QString::fromStdString(_name->Data()), parentEntity,
+          entityType(_entity, _ecm)});
       return true;
     });
 
@@ -375,12 +409,9 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      entitiesToAdd.push_back({_entity,
+          QString::fromStdString(_name->Data()), parentEntity,
+          entityType(_entity, _ecm)});
       return true;
     });
   }
@@ -389,9 +420,7 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
     [&](const Entity &_entity,
         const components::Name *)->bool
   {
-    QMetaObject::invokeMethod(&this->dataPtr->treeModel, "RemoveEntity",
-        Qt::QueuedConnection,
-        Q_ARG(Entity, _entity));
+    entitiesToRemove.push_back(_entity);
     return true;
   });
 
@@ -425,24 +454,32 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, entity),
-          Q_ARG(QString, QString::fromStdString(nameComp->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(entity, _ecm)));
+      entitiesToAdd.push_back({entity,
+          QString::fromStdString(nameComp->Data()), parentEntity,
+          entityType(entity, _ecm)});
     }
 
     for (auto entity : this->dataPtr->removedEntities)
     {
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "RemoveEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, entity));
+      entitiesToRemove.push_back(entity);
     }
 
     this->dataPtr->newEntities.clear();
     this->dataPtr->removedEntities.clear();
   }
+
+  if (!entitiesToAdd.isEmpty())
+  {
+    QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntities",
+        Qt::QueuedConnection,
+        Q_ARG(QVector<gz::sim::TreeModel::EntityInfo>, entitiesToAdd));
+  }
+  if (!entitiesToRemove.isEmpty())
+  {
+    QMetaObject::invokeMethod(&this->dataPtr->treeModel, "RemoveEntities",
+        Qt::QueuedConnection,
+        Q_ARG(QVector<gz::sim::Entity>, entitiesToRemove));
+  }
 }
 
 /////////////////////////////////////////////////
@@ -45,6 +45,26 @@ namespace sim
     // Documentation inherited
     public: QHash<int, QByteArray> roleNames() const override;
 
+    /// \brief Entity information used to queue the pending entities
+    public: struct EntityInfo
+    {
+      /// \brief Entity ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity entity;
+
+      /// \brief Entity name
+      QString name;
+
+      /// \brief Parent ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity parentEntity;
+
+      /// \brief Entity type
+      QString type;
+    };
+
     /// \brief Add an entity to the tree.
     /// \param[in] _entity Entity to be added
     /// \param[in] _entityName Name of entity to be added
@@ -60,6 +80,18 @@ namespace sim
     /// \param[in] _entity Entity to be removed
     public slots: void RemoveEntity(Entity _entity);
 
+    /// \brief Add a batch of entities to the tree with a single queued
+    /// invocation instead of one per entity.
+    /// \param[in] _entities Entities to be added
+    public slots: void AddEntities(
+        const QVector<gz::sim::TreeModel::EntityInfo> &_entities);
+
+    /// \brief Remove a batch of entities from the tree with a single queued
+    /// invocation instead of one per entity.
+    /// \param[in] _entities Entities to be removed
+    public slots: void RemoveEntities(
+        const QVector<gz::sim::Entity> &_entities);
+
     /// \brief Get the entity type of a tree item at specified index
     /// \param[in] _index Model index
     /// \return Type of entity
@@ -78,26 +110,6 @@ namespace sim
     /// \brief Keep track of which item corresponds to which entity.
     private: std::map<Entity, QStandardItem *> entityItems;
 
-    /// \brief Entity information used to queue the pending entities
-    struct EntityInfo
-    {
-      /// \brief Entity ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity entity;
-
-      /// \brief Entity name
-      QString name;
-
-      /// \brief Parent ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity parentEntity;
-
-      /// \brief Entity type
-      QString type;
-    };
-
     /// \brief If an entity is added before its parent, we queue it in this
     /// vector until their parent shows up or they are deleted.
     private: std::vector<EntityInfo> pendingEntities;
@@ -150,4 +162,6 @@ namespace sim
 }
 }
 
+Q_DECLARE_METATYPE(gz::sim::TreeModel::EntityInfo)
+
 #endif
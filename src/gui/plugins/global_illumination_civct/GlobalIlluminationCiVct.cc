@@ -462,6 +462,13 @@ bool GlobalIlluminationCiVct::eventFilter(QObject *_obj, QEvent *_event)
         this->EnabledChanged();
         this->LightingChanged();
         this->DebugVisualizationModeChanged();
+
+        // The setters above skip unchanged values, so schedule the
+        // initial build explicitly.
+        {
+          std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
+          this->dataPtr->visualDirty = true;
+        }
       }
     }
 
@@ -608,8 +615,11 @@ bool GlobalIlluminationCiVct::SetEnabled(const bool _enabled)
   }
 
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->enabled = _enabled;
-  this->dataPtr->visualDirty = true;
+  if (this->dataPtr->enabled != _enabled)
+  {
+    this->dataPtr->enabled = _enabled;
+    this->dataPtr->visualDirty = true;
+  }
 
   return _enabled;
 }
@@ -632,8 +642,11 @@ bool GlobalIlluminationCiVct::CascadesEditable() const
 void GlobalIlluminationCiVct::SetBounceCount(const uint32_t _bounces)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->bounceCount = _bounces;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->bounceCount != _bounces)
+  {
+    this->dataPtr->bounceCount = _bounces;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -647,8 +660,11 @@ uint32_t GlobalIlluminationCiVct::BounceCount() const
 void GlobalIlluminationCiVct::SetHighQuality(const bool _quality)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->highQuality = _quality;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->highQuality != _quality)
+  {
+    this->dataPtr->highQuality = _quality;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -662,8 +678,11 @@ bool GlobalIlluminationCiVct::HighQuality() const
 void GlobalIlluminationCiVct::SetAnisotropic(const bool _anisotropic)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->anisotropic = _anisotropic;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->anisotropic != _anisotropic)
+  {
+    this->dataPtr->anisotropic = _anisotropic;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -419,6 +419,13 @@ bool GlobalIlluminationVct::eventFilter(QObject *_obj, QEvent *_event)
         this->LightingChanged();
         this->SettingsChanged();
         this->DebugVisualizationModeChanged();
+
+        // The setters above skip unchanged values, so schedule the
+        // initial build explicitly.
+        {
+          std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
+          this->dataPtr->visualDirty = true;
+        }
       }
     }
 
@@ -534,24 +541,33 @@ void GlobalIlluminationVct::UpdateDebugVisualizationMode(int _mode)
 void GlobalIlluminationVct::UpdateResolution(int _axis, uint32_t _res)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->resolution[_axis] = _res;
-  this->dataPtr->visualDirty = true;
+  if (this->dataPtr->resolution[_axis] != _res)
+  {
+    this->dataPtr->resolution[_axis] = _res;
+    this->dataPtr->visualDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
 void GlobalIlluminationVct::UpdateOctantCount(int _axis, uint32_t _count)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->octantCount[_axis] = _count;
-  this->dataPtr->visualDirty = true;
+  if (this->dataPtr->octantCount[_axis] != _count)
+  {
+    this->dataPtr->octantCount[_axis] = _count;
+    this->dataPtr->visualDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
 void GlobalIlluminationVct::SetEnabled(const bool _enabled)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->enabled = _enabled;
-  this->dataPtr->visualDirty = true;
+  if (this->dataPtr->enabled != _enabled)
+  {
+    this->dataPtr->enabled = _enabled;
+    this->dataPtr->visualDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -643,8 +659,11 @@ uint32_t GlobalIlluminationVct::OctantCountZ() const
 void GlobalIlluminationVct::SetBounceCount(const uint32_t _bounces)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->bounceCount = _bounces;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->bounceCount != _bounces)
+  {
+    this->dataPtr->bounceCount = _bounces;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -658,8 +677,11 @@ uint32_t GlobalIlluminationVct::BounceCount() const
 void GlobalIlluminationVct::SetHighQuality(const bool _quality)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->highQuality = _quality;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->highQuality != _quality)
+  {
+    this->dataPtr->highQuality = _quality;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -673,8 +695,11 @@ bool GlobalIlluminationVct::HighQuality() const
 void GlobalIlluminationVct::SetAnisotropic(const bool _anisotropic)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->anisotropic = _anisotropic;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->anisotropic != _anisotropic)
+  {
+    this->dataPtr->anisotropic = _anisotropic;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -688,8 +713,11 @@ bool GlobalIlluminationVct::Anisotropic() const
 void GlobalIlluminationVct::SetConserveMemory(const bool _conserveMemory)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->conserveMemory = _conserveMemory;
-  this->dataPtr->lightingDirty = true;
+  if (this->dataPtr->conserveMemory != _conserveMemory)
+  {
+    this->dataPtr->conserveMemory = _conserveMemory;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -703,8 +731,12 @@ bool GlobalIlluminationVct::ConserveMemory() const
 void GlobalIlluminationVct::SetThinWallCounter(const float _thinWallCounter)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->thinWallCounter = _thinWallCounter;
-  this->dataPtr->lightingDirty = true;
+  // Exact comparison: this only detects echoes of the same value.
+  if (this->dataPtr->thinWallCounter != _thinWallCounter)
+  {
+    this->dataPtr->thinWallCounter = _thinWallCounter;
+    this->dataPtr->lightingDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -718,8 +750,11 @@ float GlobalIlluminationVct::ThinWallCounter() const
 void GlobalIlluminationVct::SetDebugVisualizationMode(const uint32_t _visMode)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-  this->dataPtr->debugVisMode = _visMode;
-  this->dataPtr->debugVisualizationDirty = true;
+  if (this->dataPtr->debugVisMode != _visMode)
+  {
+    this->dataPtr->debugVisMode = _visMode;
+    this->dataPtr->debugVisualizationDirty = true;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -17,6 +17,9 @@
 
 #include "Plotting.hh"
 
+#include <algorithm>
+#include <utility>
+
 #include <gz/math/Pose3.hh>
 #include <gz/math/SphericalCoordinates.hh>
 #include <gz/math/Vector3.hh>
@@ -56,6 +59,18 @@ namespace gz::sim
 
     /// \brief Mutex to protect the components map.
     public: std::recursive_mutex componentsMutex;
+
+    /// \brief Period between emissions to the charts. Samples arriving
+    /// faster than this are folded into per-attribute [min, max] buckets,
+    /// so the charts receive a bounded number of points regardless of the
+    /// simulation rate.
+    public: std::chrono::steady_clock::duration bucketPeriod
+        {std::chrono::milliseconds(50)};
+
+    /// \brief Simulation time at which the current decimation bucket
+    /// started, i.e. the time of the last emission to the charts
+    public: std::chrono::steady_clock::duration bucketStart
+        {std::chrono::steady_clock::duration::zero()};
   };
 
   class PlotComponentPrivate
@@ -73,6 +88,10 @@ namespace gz::sim
     /// ex: x,y,z attributes in Vector3d type component
     public: std::map<std::string,
       std::shared_ptr<gz::gui::PlotData>> data;
+
+    /// \brief [min, max] value each attribute covered in the current
+    /// decimation bucket, cleared by ResetRanges
+    public: std::map<std::string, std::pair<double, double>> ranges;
   };
 }
 
@@ -187,7 +206,41 @@ void PlotComponent::SetAttributeValue(std::string _attribute,
                                       const double &_value)
 {
   if (this->dataPtr->data.count(_attribute) > 0)
+  {
     this->dataPtr->data[_attribute]->SetValue(_value);
+
+    auto range = this->dataPtr->ranges.find(_attribute);
+    if (range == this->dataPtr->ranges.end())
+    {
+      this->dataPtr->ranges[_attribute] = {_value, _value};
+    }
+    else
+    {
+      range->second.first = std::min(range->second.first, _value);
+      range->second.second = std::max(range->second.second, _value);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+std::pair<double, double> PlotComponent::AttributeRange(
+    const std::string &_attribute) const
+{
+  auto range = this->dataPtr->ranges.find(_attribute);
+  if (range != this->dataPtr->ranges.end())
+    return range->second;
+
+  double value = 0.0;
+  auto data = this->dataPtr->data.find(_attribute);
+  if (data != this->dataPtr->data.end())
+    value = data->second->Value();
+  return {value, value};
+}
+
+//////////////////////////////////////////////////
+void PlotComponent::ResetRanges()
+{
+  this->dataPtr->ranges.clear();
 }
 
 //////////////////////////////////////////////////
@@ -235,10 +288,28 @@ Plotting::~Plotting()
 }
 
 //////////////////////////////////////////
-void Plotting::LoadConfig(const tinyxml2::XMLElement *)
+void Plotting::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
 {
   if (this->title.empty())
     this->title = "Plotting";
+
+  if (_pluginElem)
+  {
+    if (auto *periodElem = _pluginElem->FirstChildElement("update_period_ms"))
+    {
+      int periodMs{0};
+      if (periodElem->QueryIntText(&periodMs) == tinyxml2::XML_SUCCESS &&
+          periodMs > 0)
+      {
+        this->dataPtr->bucketPeriod = std::chrono::milliseconds(periodMs);
+      }
+      else
+      {
+        gzwarn << "Invalid <update_period_ms> value, keeping default."
+               << std::endl;
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -536,19 +607,51 @@ void Plotting::Update(const gz::sim::UpdateInfo &_info,
       }
     }
 
+  }
+
+  // Decimate what reaches the charts: samples are folded into per-attribute
+  // [min, max] buckets above, and only the bucket extremes are emitted once
+  // per period, so chart memory and redraw cost depend on the plotting rate
+  // instead of the simulation rate.
+  if (_info.simTime < this->dataPtr->bucketStart)
+  {
+    // sim time moved backwards, e.g. on reset; start a new bucket
+    this->dataPtr->bucketStart = _info.simTime;
+  }
+
+  if (_info.simTime - this->dataPtr->bucketStart <
+      this->dataPtr->bucketPeriod)
+    return;
+
+  double x = _info.simTime.count() * std::pow(10, -9);
+  double xMid = 0.5 *
+      (x + this->dataPtr->bucketStart.count() * std::pow(10, -9));
+  this->dataPtr->bucketStart = _info.simTime;
+
+  for (auto component : this->dataPtr->components)
+  {
     for (auto attribute : component.second->Data())
     {
-      for (auto chart : attribute.second->Charts())
-      {
-        QString attributeName = QString::fromStdString(
-                    component.first + "," + attribute.first);
-        double y = attribute.second->Value();
+      if (attribute.second->ChartCount() == 0)
+        continue;
 
-        double x = _info.simTime.count() * std::pow(10, -9);
+      auto range = component.second->AttributeRange(attribute.first);
+      QString attributeName = QString::fromStdString(
+                  component.first + "," + attribute.first);
 
-        emit this->dataPtr->plottingIface->plot(chart, attributeName, x, y);
+      for (auto chart : attribute.second->Charts())
+      {
+        // emit both bucket extremes so peaks survive the decimation
+        if (!math::equal(range.first, range.second))
+        {
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              xMid, range.first);
+        }
+        emit this->dataPtr->plottingIface->plot(chart, attributeName,
+            x, range.second);
       }
     }
+    component.second->ResetRanges();
   }
 }
 
@@ -31,6 +31,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <utility>
 
 namespace gz {
 
@@ -74,6 +75,18 @@ class PlotComponent
   /// \param[in] _value value to be set to the attribute
   public: void SetAttributeValue(std::string _attribute, const double &_value);
 
+  /// \brief Get the [min, max] range an attribute covered since the last
+  /// call to ResetRanges. If no value arrived yet, both entries hold the
+  /// current attribute value.
+  /// \param[in] _attribute component attribute to query
+  /// \return minimum and maximum attribute values of the current bucket
+  public: std::pair<double, double> AttributeRange(
+      const std::string &_attribute) const;
+
+  /// \brief Clear the recorded [min, max] ranges of all attributes,
+  /// starting a new decimation bucket
+  public: void ResetRanges();
+
   /// \brief Get all attributes of the component
   /// \return component attributes
   public: std::map<std::string, std::shared_ptr<gz::gui::PlotData>>
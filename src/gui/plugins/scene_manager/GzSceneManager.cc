@@ -65,6 +65,15 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     /// \brief List of new entities from a gui event
     public: std::set<Entity> newEntities;
 
+    /// \brief Maximum number of queued new entities to create visuals for
+    /// in a single update cycle. Larger bursts are spread across several
+    /// cycles so entity spawning doesn't stall the Qt event loop.
+    public: std::size_t maxNewEntitiesPerCycle{128u};
+
+    /// \brief Cached pointer to the main window, used as the event
+    /// receiver. Avoids a recursive findChild per sent event.
+    public: gz::gui::MainWindow *mainWindow{nullptr};
+
     /// \brief List of removed entities from a gui event
     public: std::set<Entity> removedEntities;
 
@@ -111,8 +120,9 @@ void GzSceneManager::LoadConfig(const tinyxml2::XMLElement *)
   }
   done = true;
 
-  gz::gui::App()->findChild<
-      gz::gui::MainWindow *>()->installEventFilter(this);
+  this->dataPtr->mainWindow =
+      gz::gui::App()->findChild<gz::gui::MainWindow *>();
+  this->dataPtr->mainWindow->installEventFilter(this);
 
   this->dataPtr->initialized = true;
 }
@@ -136,9 +146,27 @@ void GzSceneManager::Update(const UpdateInfo &_info,
 
   std::lock_guard<std::mutex> lock(this->dataPtr->newRemovedEntityMutex);
   {
-    this->dataPtr->renderUtil.CreateVisualsForEntities(_ecm,
-        this->dataPtr->newEntities);
-    this->dataPtr->newEntities.clear();
+    // Drain the queue under a per-cycle budget so a burst of spawned
+    // entities is amortized over several cycles instead of blocking this
+    // one for all of them.
+    if (this->dataPtr->newEntities.size() <=
+        this->dataPtr->maxNewEntitiesPerCycle)
+    {
+      this->dataPtr->renderUtil.CreateVisualsForEntities(_ecm,
+          this->dataPtr->newEntities);
+      this->dataPtr->newEntities.clear();
+    }
+    else
+    {
+      std::set<Entity> batch;
+      auto it = this->dataPtr->newEntities.begin();
+      for (std::size_t i = 0; i < this->dataPtr->maxNewEntitiesPerCycle; ++i)
+      {
+        batch.insert(batch.end(), *it);
+        it = this->dataPtr->newEntities.erase(it);
+      }
+      this->dataPtr->renderUtil.CreateVisualsForEntities(_ecm, batch);
+    }
   }
 
   this->dataPtr->renderUtil.UpdateFromECM(_info, _ecm);
@@ -177,8 +205,7 @@ void GzSceneManager::Update(const UpdateInfo &_info,
     // Send the new VisualPlugins event
     gz::sim::gui::events::VisualPlugins visualPluginsEvent(
         it.first, it.second);
-    gz::gui::App()->sendEvent(
-        gz::gui::App()->findChild<gz::gui::MainWindow *>(),
+    gz::gui::App()->sendEvent(this->dataPtr->mainWindow,
         &visualPluginsEvent);
   }
 
@@ -199,11 +226,14 @@ void GzSceneManager::Update(const UpdateInfo &_info,
         return true;
       });
 
-  gz::sim::gui::events::NewRemovedEntities removedEvent(
-      created, removed);
-  gz::gui::App()->sendEvent(
-      gz::gui::App()->findChild<gz::gui::MainWindow *>(),
-      &removedEvent);
+  // All the deltas of one update cycle are coalesced into a single event,
+  // and quiescent cycles don't post one at all.
+  if (!created.empty() || !removed.empty())
+  {
+    gz::sim::gui::events::NewRemovedEntities removedEvent(
+        created, removed);
+    gz::gui::App()->sendEvent(this->dataPtr->mainWindow, &removedEvent);
+  }
 }
 
 /////////////////////////////////////////////////
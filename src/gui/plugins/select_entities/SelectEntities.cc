@@ -100,6 +100,14 @@ class gz::sim::gui::SelectEntitiesPrivate
   public: rendering::NodePtr TopLevelNode(
       const rendering::NodePtr &_node);
 
+  /// \brief Get the visual for the given sim entity. Served from an index
+  /// that is rebuilt in a single pass over the scene when a lookup misses,
+  /// so selecting a batch of entities costs one scan instead of one scan
+  /// per entity.
+  /// \param[in] _entity Sim entity to look up
+  /// \return Pointer to the entity's visual, null if there is none.
+  public: rendering::VisualPtr VisualForEntity(Entity _entity);
+
   /// \brief Helper object to select entities. Only the latest selection
   /// request is kept.
   public: SelectionHelper selectionHelper;
@@ -123,6 +131,15 @@ class gz::sim::gui::SelectEntitiesPrivate
   public: std::unordered_map<Entity,
     gz::rendering::WireBoxPtr> wireBoxes;
 
+  /// \brief Index from sim entities to rendering visual IDs, used by
+  /// VisualForEntity. Entries are validated against the scene on lookup and
+  /// erased when entities are removed.
+  public: std::unordered_map<Entity, unsigned int> entityVisualIds;
+
+  /// \brief Number of scene visuals the last time entityVisualIds was
+  /// rebuilt, used to skip rebuilding on lookups that cannot succeed.
+  public: unsigned int indexedVisualCount{0};
+
   /// \brief MouseEvent
   public: gz::common::MouseEvent mouseEvent;
 
@@ -306,6 +323,45 @@ void SelectEntitiesPrivate::HighlightNode(const rendering::VisualPtr &_visual)
   }
 }
 
+/////////////////////////////////////////////////
+rendering::VisualPtr SelectEntitiesPrivate::VisualForEntity(Entity _entity)
+{
+  auto it = this->entityVisualIds.find(_entity);
+  if (it != this->entityVisualIds.end())
+  {
+    // the visual may have been destroyed since it was indexed
+    auto visual = this->scene->VisualById(it->second);
+    if (visual)
+      return visual;
+    this->entityVisualIds.erase(it);
+  }
+
+  // only rebuild the index if the scene changed since the last pass,
+  // otherwise the lookup cannot succeed
+  if (this->scene->VisualCount() == this->indexedVisualCount)
+    return nullptr;
+
+  this->entityVisualIds.clear();
+  this->indexedVisualCount = this->scene->VisualCount();
+  for (unsigned int i = 0; i < this->scene->VisualCount(); ++i)
+  {
+    auto visual = this->scene->VisualByIndex(i);
+    if (!visual)
+      continue;
+
+    if (std::holds_alternative<uint64_t>(visual->UserData("gazebo-entity")))
+    {
+      this->entityVisualIds[std::get<uint64_t>(
+          visual->UserData("gazebo-entity"))] = visual->Id();
+    }
+  }
+
+  it = this->entityVisualIds.find(_entity);
+  if (it != this->entityVisualIds.end())
+    return this->scene->VisualById(it->second);
+  return nullptr;
+}
+
 /////////////////////////////////////////////////
 rendering::NodePtr SelectEntitiesPrivate::TopLevelNode(
     const rendering::NodePtr &_node)
@@ -521,23 +577,11 @@ bool SelectEntities::eventFilter(QObject *_obj, QEvent *_event)
     {
       for (const auto &entity : selectedEvent->Data())
       {
-        for (unsigned int i = 0; i < this->dataPtr->scene->VisualCount(); i++)
+        auto visual = this->dataPtr->VisualForEntity(entity);
+        if (visual)
         {
-          auto visual = this->dataPtr->scene->VisualByIndex(i);
-
-          Entity entityId = kNullEntity;
-          if (std::holds_alternative<uint64_t>(
-            visual->UserData("gazebo-entity")))
-          {
-            entityId = std::get<uint64_t>(visual->UserData("gazebo-entity"));
-          }
-
-          if (entityId == entity)
-          {
-            this->dataPtr->selectedEntitiesIDNew.push_back(visual->Id());
-            this->dataPtr->receivedSelectedEntities = true;
-            break;
-          }
+          this->dataPtr->selectedEntitiesIDNew.push_back(visual->Id());
+          this->dataPtr->receivedSelectedEntities = true;
         }
       }
     }
@@ -569,20 +613,21 @@ bool SelectEntities::eventFilter(QObject *_obj, QEvent *_event)
   else if (_event->type() ==
            gz::sim::gui::events::NewRemovedEntities::kType)
   {
-    if (!this->dataPtr->wireBoxes.empty())
+    auto event =
+        reinterpret_cast<gui::events::NewRemovedEntities *>(_event);
+    for (auto &entity : event->RemovedEntities())
     {
-      auto event =
-          reinterpret_cast<gui::events::NewRemovedEntities *>(_event);
-      for (auto &entity : event->RemovedEntities())
+      this->dataPtr->entityVisualIds.erase(entity);
+
+      if (this->dataPtr->wireBoxes.empty())
+        continue;
+
+      auto wireBoxIt = this->dataPtr->wireBoxes.find(entity);
+      if (wireBoxIt != this->dataPtr->wireBoxes.end())
       {
-        auto wireBoxIt = this->dataPtr->wireBoxes.find(entity);
-        if (wireBoxIt != this->dataPtr->wireBoxes.end())
-        {
-          this->dataPtr->scene->DestroyVisual(wireBoxIt->second->Parent());
-          this->dataPtr->wireBoxes.erase(wireBoxIt);
-        }
+        this->dataPtr->scene->DestroyVisual(wireBoxIt->second->Parent());
+        this->dataPtr->wireBoxes.erase(wireBoxIt);
       }
-
     }
   }
 
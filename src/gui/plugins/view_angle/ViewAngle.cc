@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <gz/common/Console.hh>
@@ -484,31 +485,25 @@ void ViewAnglePrivate::OnRender()
       math::Vector3d lookAt = math::Vector3d::Zero;
       if (!this->selectedEntities.empty())
       {
-        for (const auto &entity : this->selectedEntities)
+        // One pass over the scene with a hashed entity lookup, instead of
+        // rescanning every visual once per selected entity.
+        std::unordered_set<Entity> selected(this->selectedEntities.begin(),
+            this->selectedEntities.end());
+        auto scene = this->camera->Scene();
+        for (auto i = 0u; i < scene->VisualCount(); ++i)
         {
-          for (auto i = 0u; i < this->camera->Scene()->VisualCount();
-              ++i)
+          auto vis = scene->VisualByIndex(i);
+          if (!vis)
+            continue;
+
+          auto userData = vis->UserData("gazebo-entity");
+          if (!std::holds_alternative<uint64_t>(userData) ||
+              selected.find(std::get<uint64_t>(userData)) == selected.end())
           {
-            auto vis = this->camera->Scene()->VisualByIndex(i);
-            if (!vis)
-              continue;
-
-            if (std::holds_alternative<uint64_t>(
-              vis->UserData("gazebo-entity")))
-            {
-              if (std::get<uint64_t>(vis->UserData("gazebo-entity")) != entity)
-              {
-                continue;
-              }
-            }
-            else
-            {
-              continue;
-            }
-
-            auto pos = vis->WorldPose().Pos();
-            lookAt += pos;
+            continue;
           }
+
+          lookAt += vis->WorldPose().Pos();
         }
         lookAt /= this->selectedEntities.size();
       }
@@ -144,6 +144,9 @@ namespace gz::sim
 
     /// \brief Retrieve visual based on its Gazebo entity. Note that this is
     /// different from gz-rendering's internal ID for the visual.
+    /// Looks up the visuals map first and only falls back to scanning the
+    /// scene on a miss, memoizing the result so repeated lookups (e.g. when
+    /// toggling a view mode on a large model) stay cheap.
     /// \param[in] _entity Gazebo entity
     /// \return Pointer to requested visual, null if not found.
     public: rendering::VisualPtr VisualByEntity(Entity _entity);
@@ -360,7 +363,10 @@ namespace gz::sim
     public: std::map<gz::sim::Entity,
       std::vector<gz::sim::Entity>> linkToVisualEntities;
 
-    /// \brief Map of visual entity in Gazebo to visual pointers.
+    /// \brief Map of visual entity in Gazebo to visual pointers. Visuals
+    /// created by this plugin are registered here on creation, and visuals
+    /// created elsewhere (e.g. by the scene manager) are added lazily by
+    /// VisualByEntity. Entries are dropped when the entity is removed.
     public: std::map<Entity, rendering::VisualPtr> visuals;
 
     /////////////////////////////////////////////////
@@ -1731,6 +1737,16 @@ rendering::VisualPtr VisualizationCapabilitiesPrivate::CreateFrameVisual(
 rendering::VisualPtr VisualizationCapabilitiesPrivate::VisualByEntity(
   Entity _entity)
 {
+  auto it = this->visuals.find(_entity);
+  if (it != this->visuals.end())
+  {
+    // the visual may have been destroyed by whoever created it, e.g. the
+    // scene manager, so make sure it still belongs to the scene
+    if (it->second && this->scene->HasVisual(it->second))
+      return it->second;
+    this->visuals.erase(it);
+  }
+
   for (unsigned int i = 0; i < this->scene->VisualCount(); ++i)
   {
     auto visual = this->scene->VisualByIndex(i);
@@ -1742,6 +1758,7 @@ rendering::VisualPtr VisualizationCapabilitiesPrivate::VisualByEntity(
 
       if (visualEntity == _entity)
       {
+        this->visuals[_entity] = visual;
         return visual;
       }
     }
@@ -2476,24 +2493,22 @@ std::vector<Entity> VisualizationCapabilitiesPrivate::FindChildLinksFromECM(
   if (_ecm.EntityMatches(_entity,
         std::set<ComponentTypeId>{components::Model::typeId}))
   {
+    // the child maps are kept up to date incrementally in Update, so walk
+    // them instead of scanning the whole ECM for each nested model
     std::stack<Entity> modelStack;
     modelStack.push(_entity);
 
-    std::vector<Entity> childLinks, childModels;
+    std::vector<Entity> childModels;
     while (!modelStack.empty())
     {
       Entity model = modelStack.top();
       modelStack.pop();
 
-      childLinks = _ecm.EntitiesByComponents(components::ParentEntity(model),
-                                             components::Link());
       links.insert(links.end(),
-                   childLinks.begin(),
-                   childLinks.end());
+          this->modelToLinkEntities[model].begin(),
+          this->modelToLinkEntities[model].end());
 
-      childModels =
-          _ecm.EntitiesByComponents(components::ParentEntity(model),
-                                    components::Model());
+      childModels = this->modelToModelEntities[model];
       for (const auto &childModel : childModels)
       {
           modelStack.push(childModel);
@@ -2829,6 +2844,7 @@ void VisualizationCapabilities::Update(const UpdateInfo &,
         const components::Pose *) -> bool
     {
       this->dataPtr->entitiesWithPose.erase(_entity);
+      this->dataPtr->visuals.erase(_entity);
       return true;
     });
 
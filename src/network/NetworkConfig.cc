@@ -65,6 +65,21 @@ NetworkConfig NetworkConfig::FromValues(const std::string &_role,
   if (config.role == NetworkRole::SimulationPrimary)
   {
     config.numSecondariesExpected = _secondaries;
+
+    std::string stepSlackStr;
+    if (common::env("GZ_NETWORK_STEP_SLACK", stepSlackStr))
+    {
+      try
+      {
+        config.stepSlack = std::stoul(stepSlackStr);
+      }
+      catch (const std::exception &)
+      {
+        gzwarn << "Invalid setting for GZ_NETWORK_STEP_SLACK: "
+                << stepSlackStr << ", keeping lockstep" << std::endl;
+      }
+    }
+
     if (config.numSecondariesExpected == 0)
     {
       config.role = NetworkRole::None;
@@ -52,6 +52,12 @@ namespace gz
 
       /// \brief Expect number of network secondaries.
       public: size_t numSecondariesExpected { 0 };
+
+      /// \brief Number of simulation steps the primary may run ahead of
+      /// secondary acknowledgments. Zero, the default, keeps strict
+      /// lockstep. Only meaningful if role == primary. Populated from the
+      /// GZ_NETWORK_STEP_SLACK environment variable.
+      public: size_t stepSlack { 0 };
     };
     }
   }  // namespace sim
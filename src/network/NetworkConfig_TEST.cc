@@ -25,6 +25,30 @@
 
 using namespace gz::sim;
 
+TEST(NetworkManager, StepSlackFromEnv)
+{
+  {
+    // Slack window read from the environment
+    gz::common::setenv("GZ_NETWORK_STEP_SLACK", "4");
+    auto config = NetworkConfig::FromValues("PRIMARY", 3);
+    EXPECT_EQ(4u, config.stepSlack);
+  }
+
+  {
+    // Invalid values fall back to lockstep
+    gz::common::setenv("GZ_NETWORK_STEP_SLACK", "not_a_number");
+    auto config = NetworkConfig::FromValues("PRIMARY", 3);
+    EXPECT_EQ(0u, config.stepSlack);
+  }
+
+  {
+    // Lockstep by default
+    gz::common::unsetenv("GZ_NETWORK_STEP_SLACK");
+    auto config = NetworkConfig::FromValues("PRIMARY", 3);
+    EXPECT_EQ(0u, config.stepSlack);
+  }
+}
+
 TEST(NetworkManager, ValueConstructor)
 {
   gz::common::Console::SetVerbosity(4);
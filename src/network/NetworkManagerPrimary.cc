@@ -23,10 +23,13 @@
 #include "gz/sim/private_msgs/simulation_step.pb.h"
 
 #include <algorithm>
-#include <future>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -67,6 +70,7 @@ void NetworkManagerPrimary::Handshake()
   {
     private_msgs::PeerControl req, resp;
     req.set_enable_sim(true);
+    req.set_delta_state(true);
 
     auto sc = std::make_unique<SecondaryControl>();
     sc->id = peer;
@@ -85,6 +89,7 @@ void NetworkManagerPrimary::Handshake()
       {
         gzmsg << "Peer initialized [" << sc->prefix << "]" << std::endl;
         sc->ready = true;
+        sc->deltaState = resp.delta_state();
       }
       else
       {
@@ -100,6 +105,44 @@ void NetworkManagerPrimary::Handshake()
 
     this->secondaries[sc->prefix] = std::move(sc);
   }
+
+  // Delta states can only be decoded if every secondary sends them. If a
+  // secondary does not support the encoding, ask the ones that acknowledged
+  // it to fall back to plain states.
+  bool allDelta = true;
+  for (const auto &secondary : this->secondaries)
+  {
+    if (secondary.second->ready && !secondary.second->deltaState)
+      allDelta = false;
+  }
+  if (allDelta)
+  {
+    this->deltaStateEnabled = true;
+  }
+  else
+  {
+    for (auto &secondary : this->secondaries)
+    {
+      if (!secondary.second->deltaState)
+        continue;
+      private_msgs::PeerControl req, resp;
+      req.set_enable_sim(true);
+      req.set_delta_state(false);
+      bool result;
+      if (this->node.Request(secondary.second->prefix + "/control", req,
+          5000, resp, result))
+      {
+        secondary.second->deltaState = false;
+      }
+      else
+      {
+        gzerr << "Failed to disable delta states on ["
+               << secondary.second->prefix << "]" << std::endl;
+      }
+    }
+    gzmsg << "Mixed secondary capabilities; using plain state sync"
+           << std::endl;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -132,7 +175,7 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
   }
 
   private_msgs::SimulationStep step;
-  step.mutable_stats()->CopyFrom(convert<msgs::WorldStatistics>(_info));
+  set(step.mutable_stats(), _info);
 
   // Affinities that changed this step
   this->PopulateAffinities(step);
@@ -145,36 +188,58 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
   }
 
   // Send step to all secondaries
-  this->secondaryStates.clear();
-  this->secondaryStatesPromise = std::promise<void>{};
-  auto future = this->secondaryStatesPromise.get_future();
   this->simStepPub.Publish(step);
-
-  // Block until all secondaries are done
+  ++this->stepsPublished;
+
+  // Block until the pipeline is back within the slack window. With the
+  // default slack of zero this is strict lockstep: every secondary must
+  // acknowledge this step before the primary continues. With slack K the
+  // primary runs up to K steps ahead, so sustained throughput is bounded
+  // by bandwidth instead of the round trip to the slowest secondary.
+  std::vector<msgs::SerializedStateMap> states;
   {
     GZ_PROFILE("Waiting for secondaries");
 
-    auto result = future.wait_for(10s);
+    const uint64_t nSecondaries = this->secondaries.size();
+    const uint64_t slack = this->dataPtr->config.stepSlack;
 
-    if (std::future_status::ready != result)
+    std::unique_lock<std::mutex> lock(this->secondaryStatesMutex);
+    bool inWindow = this->secondaryStatesCv.wait_for(lock, 10s, [&]
     {
-      gzerr << "Waited 10 s and got only [" << this->secondaryStates.size()
-             << " / " << this->secondaries.size()
-             << "] responses from secondaries. Stopping simulation."
+      const uint64_t stepsCompleted = nSecondaries == 0u ?
+          this->stepsPublished : this->acksReceived / nSecondaries;
+      return this->stepsPublished - stepsCompleted <= slack;
+    });
+
+    if (!inWindow)
+    {
+      const uint64_t stepsCompleted = nSecondaries == 0u ?
+          this->stepsPublished : this->acksReceived / nSecondaries;
+      gzerr << "Waited 10 s for secondaries to catch up; only ["
+             << stepsCompleted << " / " << this->stepsPublished
+             << "] steps acknowledged. Stopping simulation."
              << std::endl;
       this->dataPtr->eventMgr->Emit<events::Stop>();
       return false;
     }
+
+    states.swap(this->secondaryStates);
   }
 
-  // Update primary state with states received from secondaries
+  // The acknowledged step doubles as liveness for the whole fleet, so no
+  // heartbeats are needed while simulation is running
+  this->dataPtr->tracker->MarkAlive(NetworkRole::SimulationSecondary);
+  this->dataPtr->tracker->NotifyActivity();
+
+  // Update primary state with states received from secondaries. The
+  // secondaries own disjoint sets of performers and messages from each
+  // secondary arrive in order, so applying in arrival order is safe.
   {
     GZ_PROFILE("Updating primary state");
-    for (const auto &msg : this->secondaryStates)
+    for (const auto &msg : states)
     {
       this->dataPtr->ecm->SetState(msg);
     }
-    this->secondaryStates.clear();
   }
 
   // Step all systems
@@ -201,11 +266,28 @@ std::map<std::string, SecondaryControl::Ptr>
 //////////////////////////////////////////////////
 void NetworkManagerPrimary::OnStepAck(const msgs::SerializedStateMap &_msg)
 {
-  this->secondaryStates.push_back(_msg);
-  if (this->secondaryStates.size() == this->secondaries.size())
   {
-    this->secondaryStatesPromise.set_value();
+    std::lock_guard<std::mutex> lock(this->secondaryStatesMutex);
+    if (this->deltaStateEnabled)
+    {
+      msgs::SerializedStateMap decoded(_msg);
+      if (!DecodeStateMapDelta(decoded, this->receivedStateCache))
+      {
+        gzerr << "Failed to decode delta state from secondary; "
+               << "discarding message." << std::endl;
+      }
+      else
+      {
+        this->secondaryStates.push_back(std::move(decoded));
+      }
+    }
+    else
+    {
+      this->secondaryStates.push_back(_msg);
+    }
+    ++this->acksReceived;
   }
+  this->secondaryStatesCv.notify_all();
 }
 
 //////////////////////////////////////////////////
@@ -231,13 +313,13 @@ void NetworkManagerPrimary::PopulateAffinities(
   // Previous performer-to-secondary mapping - may need updating
   std::map<Entity, std::string> pToSPrevious;
 
-  // Updated performer-to-level mapping - used to update affinities
+  // Updated performer-to-level mapping - used to cluster performers
   std::map<Entity, std::set<Entity>> lToPNew;
 
   // All performers
   std::set<Entity> allPerformers;
 
-  // Go through performers and assign affinities
+  // Go through performers and collect levels and previous affinities
   this->dataPtr->ecm->Each<
         components::PerformerLevels>(
     [&](const Entity &_entity,
@@ -262,47 +344,117 @@ void NetworkManagerPrimary::PopulateAffinities(
       return true;
     });
 
-  // First assignment: distribute levels evenly across secondaries
-  if (pToSPrevious.empty())
+  if (allPerformers.empty() || this->secondaries.empty())
+    return;
+
+  // Cluster performers by locality: performers that share a level are
+  // close enough to interact, so they should run on the same secondary.
+  // Union performers through their shared levels so that overlapping
+  // levels merge into a single cluster. Clusters are recomputed every
+  // call, which also merges and splits them as performers move between
+  // levels.
+  std::map<Entity, Entity> parent;
+  std::function<Entity(Entity)> findRoot =
+      [&parent, &findRoot](Entity _e) -> Entity
   {
-    auto secondaryIt = this->secondaries.begin();
+    auto &p = parent[_e];
+    if (p == _e)
+      return _e;
+    // path compression
+    p = findRoot(p);
+    return p;
+  };
+
+  for (const auto performer : allPerformers)
+    parent[performer] = performer;
+  for (const auto &[level, performers] : lToPNew)
+  {
+    const Entity first = *performers.begin();
+    for (const auto performer : performers)
+      parent[findRoot(performer)] = findRoot(first);
+  }
 
-    for (const auto &it : lToPNew)
+  // c: cluster (keyed by its union-find root, so ordering is stable)
+  std::map<Entity, std::vector<Entity>> clusters;
+  for (const auto performer : allPerformers)
+    clusters[findRoot(performer)].push_back(performer);
+
+  // Number of performers currently assigned to each secondary
+  std::map<std::string, std::size_t> sLoad;
+  for (const auto &secondary : this->secondaries)
+    sLoad[secondary.first] = 0u;
+
+  auto leastLoaded = [&sLoad]() -> const std::string &
+  {
+    auto best = sLoad.begin();
+    for (auto it = sLoad.begin(); it != sLoad.end(); ++it)
     {
-      for (const auto &performer : it.second)
+      if (it->second < best->second)
+        best = it;
+    }
+    return best->first;
+  };
+
+  // Assign big clusters first so they land on the emptiest secondaries,
+  // then fill in with the small ones.
+  std::vector<std::map<Entity, std::vector<Entity>>::iterator> ordered;
+  ordered.reserve(clusters.size());
+  for (auto it = clusters.begin(); it != clusters.end(); ++it)
+    ordered.push_back(it);
+  std::stable_sort(ordered.begin(), ordered.end(),
+      [](const auto &_a, const auto &_b)
       {
-        this->SetAffinity(performer, secondaryIt->second->prefix,
-            _msg.add_affinity());
+        return _a->second.size() > _b->second.size();
+      });
 
-        // Remove performers as they are assigned
-        allPerformers.erase(performer);
-      }
+  for (const auto &clusterIt : ordered)
+  {
+    const auto &cluster = clusterIt->second;
 
-      // Round-robin levels
-      secondaryIt++;
-      if (secondaryIt == this->secondaries.end())
+    // Prefer the secondary that already owns most of the cluster, so
+    // that cluster merges and splits only migrate the minority of
+    // performers. New clusters go to the least loaded secondary.
+    std::map<std::string, std::size_t> votes;
+    for (const auto performer : cluster)
+    {
+      auto previousIt = pToSPrevious.find(performer);
+      if (previousIt != pToSPrevious.end() &&
+          this->secondaries.find(previousIt->second) !=
+          this->secondaries.end())
       {
-        secondaryIt = this->secondaries.begin();
+        ++votes[previousIt->second];
       }
     }
 
-    // Also assign level-less performers
-    for (auto performer : allPerformers)
+    const std::string *chosen = nullptr;
+    std::size_t bestVotes = 0u;
+    for (const auto &[secondary, count] : votes)
     {
-      this->SetAffinity(performer, secondaryIt->second->prefix,
-          _msg.add_affinity());
-
-      // Round-robin performers
-      secondaryIt++;
-      if (secondaryIt == this->secondaries.end())
+      if (count > bestVotes ||
+          (count == bestVotes && nullptr != chosen &&
+           sLoad[secondary] < sLoad[*chosen]))
       {
-        secondaryIt = this->secondaries.begin();
+        chosen = &secondary;
+        bestVotes = count;
       }
     }
-    return;
-  }
+    if (nullptr == chosen)
+      chosen = &leastLoaded();
 
-  // TODO(louise) Process level changes
+    sLoad[*chosen] += cluster.size();
+
+    // Only performers whose affinity actually changed are migrated;
+    // the rest stay in place and produce no message traffic.
+    for (const auto performer : cluster)
+    {
+      auto previousIt = pToSPrevious.find(performer);
+      if (previousIt != pToSPrevious.end() && previousIt->second == *chosen)
+        continue;
+
+      this->SetAffinity(performer, this->secondaries[*chosen]->prefix,
+          _msg.add_affinity());
+    }
+  }
 }
 
 //////////////////////////////////////////////////
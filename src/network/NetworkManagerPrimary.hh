@@ -21,8 +21,10 @@
 #include "gz/sim/private_msgs/simulation_step.pb.h"
 
 #include <atomic>
-#include <future>
+#include <condition_variable>
+#include <cstdint>
 #include <map>
+#include <mutex>
 #include <memory>
 #include <string>
 #include <vector>
@@ -34,6 +36,7 @@
 
 
 #include "NetworkManager.hh"
+#include "StateDeltaCodec.hh"
 
 namespace gz
 {
@@ -46,6 +49,9 @@ namespace gz
       /// \brief indicate if the secondary is ready to execute
       std::atomic<bool> ready{false};
 
+      /// \brief indicate if the secondary acknowledged delta state encoding
+      std::atomic<bool> deltaState{false};
+
       /// \brief id of the secondary peer
       std::string id;
 
@@ -90,15 +96,24 @@ namespace gz
       /// peers.
       public: std::map<std::string, SecondaryControl::Ptr>& Secondaries();
 
-      /// \brief Callback for step ack messages.
+      /// \brief Callback for step ack messages. With pipelined stepping
+      /// acks from consecutive steps can interleave; states are queued and
+      /// applied in arrival order on the simulation thread.
       /// \param[in] _msg Message containing secondary's updated state.
       private: void OnStepAck(const msgs::SerializedStateMap &_msg);
 
       /// \brief Check if the step publisher has connections.
       private: bool SecondariesCanStep() const;
 
-      /// \brief Populate the step message with the latest affinities according
-      /// to levels.
+      /// \brief Populate the step message with the latest affinities.
+      /// Performers are clustered by locality: performers that share a
+      /// level are assumed to interact, so transitively-connected levels
+      /// form one cluster and each cluster is kept on a single secondary
+      /// to avoid cross-secondary state exchange. Clusters are assigned
+      /// largest-first to the least loaded secondaries; on later calls a
+      /// cluster stays with the secondary that already owns most of its
+      /// performers, so merges and splits only migrate the minority and
+      /// only changed affinities are sent.
       /// \param[in] _msg Step message.
       private: void PopulateAffinities(private_msgs::SimulationStep &_msg);
 
@@ -118,11 +133,30 @@ namespace gz
       /// \brief Publisher for network step sync
       private: gz::transport::Node::Publisher simStepPub;
 
-      /// \brief Keep track of states received from secondaries.
+      /// \brief States received from secondaries that have not been
+      /// applied to the primary ECM yet. Protected by secondaryStatesMutex.
       private: std::vector<msgs::SerializedStateMap> secondaryStates;
 
-      /// \brief Promise used to notify when all secondaryStates where received.
-      private: std::promise<void> secondaryStatesPromise;
+      /// \brief Protects secondaryStates and acksReceived.
+      private: std::mutex secondaryStatesMutex;
+
+      /// \brief Notified whenever a step ack arrives.
+      private: std::condition_variable secondaryStatesCv;
+
+      /// \brief Total step acks received since simulation start.
+      private: uint64_t acksReceived{0u};
+
+      /// \brief Total steps published since simulation start. Only
+      /// accessed from the simulation thread.
+      private: uint64_t stepsPublished{0u};
+
+      /// \brief True once every secondary acknowledged delta state
+      /// encoding during the handshake.
+      private: bool deltaStateEnabled{false};
+
+      /// \brief Last raw component payloads received from secondaries,
+      /// used to decode delta states. Protected by secondaryStatesMutex.
+      private: ComponentDeltaCache receivedStateCache;
     };
     }
   }  // namespace sim
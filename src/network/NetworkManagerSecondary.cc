@@ -95,6 +95,10 @@ bool NetworkManagerSecondary::OnControl(const private_msgs::PeerControl &_req,
 {
   this->enableSim = _req.enable_sim();
   _resp.set_enable_sim(this->enableSim);
+  this->deltaState = _req.delta_state();
+  _resp.set_delta_state(this->deltaState);
+  if (this->deltaState)
+    this->sentStateCache.clear();
   return true;
 }
 
@@ -142,6 +146,11 @@ void NetworkManagerSecondary::OnStep(
     }
   }
 
+  // The step from the primary proves it alive, and the ack published
+  // below does the same for this peer, so heartbeats pause while stepping
+  this->dataPtr->tracker->MarkAlive(NetworkRole::SimulationPrimary);
+  this->dataPtr->tracker->NotifyActivity();
+
   // Update info
   auto info = convert<UpdateInfo>(_msg.stats());
 
@@ -172,6 +181,11 @@ void NetworkManagerSecondary::OnStep(
   stateMsg.set_has_one_time_component_changes(
     this->dataPtr->ecm->HasOneTimeComponentChanges());
 
+  // Consecutive states are mostly redundant, so when the primary
+  // negotiated it, send each component as a delta against the last one
+  if (this->deltaState)
+    EncodeStateMapDelta(stateMsg, this->sentStateCache);
+
   this->stepAckPub.Publish(stateMsg);
 
   this->dataPtr->ecm->SetAllComponentsUnchanged();
@@ -30,6 +30,7 @@
 #include "gz/sim/private_msgs/peer_control.pb.h"
 
 #include "NetworkManager.hh"
+#include "StateDeltaCodec.hh"
 
 namespace gz
 {
@@ -73,6 +74,14 @@ namespace gz
       /// \brief Flag to control enabling/disabling simulation secondary.
       private: std::atomic<bool> enableSim {false};
 
+      /// \brief Delta-encode step acknowledgment states, as negotiated by
+      /// the primary during the handshake.
+      private: std::atomic<bool> deltaState {false};
+
+      /// \brief Last raw component payloads sent to the primary, used to
+      /// encode delta states. Only accessed from the step callback.
+      private: ComponentDeltaCache sentStateCache;
+
       /// \brief Transport node used for communication with simulation graph.
       private: gz::transport::Node node;
 
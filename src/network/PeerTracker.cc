@@ -125,7 +125,15 @@ void PeerTracker::HeartbeatLoop()
   while (this->heartbeatRunning)
   {
     lastUpdateTime = Clock::now();
-    this->heartbeatPub.Publish(toProto(this->info));
+
+    // While simulation traffic is flowing, that traffic already proves
+    // this peer alive on the other end, so skip the redundant heartbeat.
+    const auto lastActivity = Clock::time_point(
+        std::chrono::nanoseconds(this->lastActivityNs.load()));
+    if (lastUpdateTime - lastActivity >= this->heartbeatPeriod)
+    {
+      this->heartbeatPub.Publish(toProto(this->info));
+    }
 
     std::vector<PeerInfo> toRemove;
     for (auto peer : this->peers)
@@ -155,6 +163,28 @@ void PeerTracker::HeartbeatLoop()
   }
 }
 
+/////////////////////////////////////////////////
+void PeerTracker::MarkAlive(const NetworkRole &_role)
+{
+  auto lock = PeerLock(this->peersMutex);
+  const auto now = std::chrono::steady_clock::now();
+  for (auto &peer : this->peers)
+  {
+    if (peer.second.info.role == _role)
+    {
+      peer.second.lastSeen = now;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void PeerTracker::NotifyActivity()
+{
+  this->lastActivityNs.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 /////////////////////////////////////////////////
 bool PeerTracker::RemovePeer(const PeerInfo &_info)
 {
@@ -17,6 +17,8 @@
 #ifndef GZ_SIM_NETWORK_PEERTRACKER_HH_
 #define GZ_SIM_NETWORK_PEERTRACKER_HH_
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -107,6 +109,22 @@ namespace gz
       /// \return Number of peers with the given role.
       public: size_t NumPeers(const NetworkRole &_role) const;
 
+      /// \brief Refresh the liveness of all peers with the given role.
+      ///
+      /// Simulation traffic doubles as liveness: a step or step ack proves
+      /// the sender is alive, so the network managers call this when such
+      /// traffic arrives instead of waiting for heartbeats.
+      /// \param[in] _role Role of peers to mark alive.
+      public: void MarkAlive(const NetworkRole &_role);
+
+      /// \brief Note that this peer just exchanged simulation traffic.
+      ///
+      /// While traffic flows within the heartbeat period, this peer's own
+      /// heartbeat publication is suppressed; peers learn its liveness from
+      /// the traffic itself via MarkAlive. Heartbeats resume automatically
+      /// when the simulation goes idle.
+      public: void NotifyActivity();
+
       /// \brief Retrieve number of detected primaries
       public: inline size_t NumPrimary() const
               {
@@ -199,6 +217,10 @@ namespace gz
       /// \brief Period to publish heartbeat at
       private: Duration heartbeatPeriod {std::chrono::milliseconds(100)};
 
+      /// \brief Time of the last simulation traffic, as a steady clock
+      /// duration since epoch. Zero means no traffic has been seen.
+      private: std::atomic<int64_t> lastActivityNs {0};
+
       /// \brief Timeout to mark a peer as stale.
       private: size_t staleMultiplier {100};
 
@@ -187,6 +187,59 @@ TEST(PeerTracker, GZ_UTILS_TEST_DISABLED_ON_MAC(PeerTrackerStale))
   // received from stale peer
 }
 
+//////////////////////////////////////////////////
+TEST(PeerTracker, GZ_UTILS_TEST_DISABLED_ON_MAC(PiggybackedLiveness))
+{
+  gz::common::Console::SetVerbosity(4);
+  EventManager eventMgr;
+
+  // Tracker with artificially short timeout.
+  auto tracker1 = std::make_shared<PeerTracker>(
+      PeerInfo(NetworkRole::SimulationPrimary), &eventMgr);
+  tracker1->SetHeartbeatPeriod(std::chrono::milliseconds(10));
+  tracker1->SetStaleMultiplier(5);
+
+  std::atomic<int> stalePeers = 0;
+  auto stale = eventMgr.Connect<PeerStale>([&](PeerInfo)
+  {
+    stalePeers++;
+  });
+
+  auto tracker2 = std::make_shared<PeerTracker>(
+      PeerInfo(NetworkRole::SimulationSecondary));
+
+  int maxSleep{100};
+  int sleep{0};
+  for (; sleep < maxSleep && tracker1->NumPeers() == 0; ++sleep)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_LT(sleep, maxSleep);
+
+  // Simulate step traffic: tracker2 stops heartbeating while tracker1
+  // refreshes it from the traffic itself. No peer goes stale.
+  for (int i = 0; i < 30; ++i)
+  {
+    tracker2->NotifyActivity();
+    tracker1->MarkAlive(NetworkRole::SimulationSecondary);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(0, stalePeers);
+  EXPECT_EQ(1u, tracker1->NumPeers());
+
+  // Traffic continues to suppress heartbeats but the liveness refresh
+  // stops, as if the secondary hung mid-step: it goes stale.
+  sleep = 0;
+  for (; sleep < maxSleep && stalePeers == 0; ++sleep)
+  {
+    tracker2->NotifyActivity();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_LT(sleep, maxSleep);
+  EXPECT_EQ(1, stalePeers);
+  EXPECT_EQ(0u, tracker1->NumPeers());
+}
+
 //////////////////////////////////////////////////
 TEST(PeerTracker, Partitioned)
 {
@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_NETWORK_STATEDELTACODEC_HH_
+#define GZ_SIM_NETWORK_STATEDELTACODEC_HH_
+
+#include <gz/msgs/serialized_map.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace gz
+{
+namespace sim
+{
+/// \file StateDeltaCodec.hh
+/// \brief Compact delta encoding for state sync between distributed peers.
+///
+/// Serialized component payloads change very little between consecutive
+/// steps: a pose component differs from the previous step in a few float
+/// digits. The codec XORs each payload against the previous payload of the
+/// same entity and component, then run-length encodes the zero bytes, so
+/// the wire carries only the bytes that actually changed plus small run
+/// headers. Both sides keep the last exchanged payload per entity and
+/// component; per-peer message ordering, which gz-transport guarantees,
+/// keeps the caches in sync.
+///
+/// Delta format: varint payload size, then alternating runs, starting with
+/// a run of zeros: [varint zeroRunLength][varint literalLength][literal
+/// bytes]...
+
+/// \brief Last exchanged raw component payloads, keyed by entity and then
+/// component type.
+using ComponentDeltaCache = std::unordered_map<uint64_t,
+    std::unordered_map<int64_t, std::string>>;
+
+/// \brief Append a varint-encoded value.
+/// \param[out] _out Buffer to append to
+/// \param[in] _value Value to encode
+inline void AppendVarint(std::string &_out, uint64_t _value)
+{
+  while (_value >= 0x80)
+  {
+    _out.push_back(static_cast<char>((_value & 0x7F) | 0x80));
+    _value >>= 7;
+  }
+  _out.push_back(static_cast<char>(_value));
+}
+
+/// \brief Read a varint-encoded value.
+/// \param[in] _in Buffer to read from
+/// \param[inout] _pos Read position, advanced past the varint
+/// \param[out] _value Decoded value
+/// \return False if the buffer ends mid-varint
+inline bool ReadVarint(const std::string &_in, std::size_t &_pos,
+    uint64_t &_value)
+{
+  _value = 0;
+  int shift = 0;
+  while (_pos < _in.size() && shift < 64)
+  {
+    const auto byte = static_cast<uint8_t>(_in[_pos++]);
+    _value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+      return true;
+    shift += 7;
+  }
+  return false;
+}
+
+/// \brief Encode a payload as a delta against the previous payload.
+/// \param[in] _prev Previous payload; empty encodes _curr from scratch
+/// \param[in] _curr Current payload
+/// \param[out] _out Encoded delta. Cleared first.
+inline void EncodeStateDelta(const std::string &_prev,
+    const std::string &_curr, std::string &_out)
+{
+  _out.clear();
+  AppendVarint(_out, _curr.size());
+
+  // XOR against the previous payload; bytes past its end pass through
+  std::string diff(_curr);
+  const std::size_t common = std::min(_prev.size(), _curr.size());
+  for (std::size_t i = 0; i < common; ++i)
+    diff[i] = static_cast<char>(diff[i] ^ _prev[i]);
+
+  // Only zero runs at least this long are worth a run header
+  const std::size_t kMinZeroRun = 4;
+
+  std::size_t pos = 0;
+  while (pos < diff.size())
+  {
+    // Leading zero run
+    std::size_t zeroRun = 0;
+    while (pos + zeroRun < diff.size() && diff[pos + zeroRun] == 0)
+      ++zeroRun;
+    pos += zeroRun;
+
+    // Literal run: up to the next zero run long enough to pay for itself
+    std::size_t literalEnd = pos;
+    while (literalEnd < diff.size())
+    {
+      if (diff[literalEnd] != 0)
+      {
+        ++literalEnd;
+        continue;
+      }
+      std::size_t innerZeros = 0;
+      while (literalEnd + innerZeros < diff.size() &&
+          diff[literalEnd + innerZeros] == 0)
+      {
+        ++innerZeros;
+      }
+      if (innerZeros >= kMinZeroRun ||
+          literalEnd + innerZeros == diff.size())
+      {
+        break;
+      }
+      literalEnd += innerZeros;
+    }
+
+    AppendVarint(_out, zeroRun);
+    AppendVarint(_out, literalEnd - pos);
+    _out.append(diff, pos, literalEnd - pos);
+    pos = literalEnd;
+  }
+}
+
+/// \brief Decode a delta produced by EncodeStateDelta.
+/// \param[in] _prev The payload the delta was encoded against
+/// \param[in] _delta Encoded delta
+/// \param[out] _curr Decoded payload. Cleared first.
+/// \return False if the delta is malformed
+inline bool DecodeStateDelta(const std::string &_prev,
+    const std::string &_delta, std::string &_curr)
+{
+  _curr.clear();
+
+  std::size_t pos = 0;
+  uint64_t size = 0;
+  if (!ReadVarint(_delta, pos, size))
+    return false;
+
+  std::string diff;
+  diff.reserve(size);
+  while (diff.size() < size)
+  {
+    uint64_t zeroRun = 0;
+    uint64_t literalLen = 0;
+    if (!ReadVarint(_delta, pos, zeroRun) ||
+        !ReadVarint(_delta, pos, literalLen))
+    {
+      return false;
+    }
+    if (zeroRun > size - diff.size() ||
+        literalLen > size - diff.size() - zeroRun ||
+        literalLen > _delta.size() - pos)
+    {
+      return false;
+    }
+    diff.append(zeroRun, '\0');
+    diff.append(_delta, pos, literalLen);
+    pos += literalLen;
+  }
+
+  const std::size_t common = std::min(_prev.size(), diff.size());
+  for (std::size_t i = 0; i < common; ++i)
+    diff[i] = static_cast<char>(diff[i] ^ _prev[i]);
+  _curr = std::move(diff);
+  return true;
+}
+
+/// \brief Delta-encode every component payload of a state message in
+/// place, updating the cache with the raw payloads.
+/// \param[inout] _msg State message to encode
+/// \param[inout] _cache Last payloads sent to the peer
+inline void EncodeStateMapDelta(msgs::SerializedStateMap &_msg,
+    ComponentDeltaCache &_cache)
+{
+  std::string encoded;
+  for (auto &entityEntry : *_msg.mutable_entities())
+  {
+    auto &entityMsg = entityEntry.second;
+    if (entityMsg.remove())
+    {
+      _cache.erase(entityEntry.first);
+      continue;
+    }
+    auto &entityCache = _cache[entityEntry.first];
+    for (auto &compEntry : *entityMsg.mutable_components())
+    {
+      auto &compMsg = compEntry.second;
+      if (compMsg.remove())
+      {
+        entityCache.erase(compEntry.first);
+        continue;
+      }
+      auto &prev = entityCache[compEntry.first];
+      EncodeStateDelta(prev, compMsg.component(), encoded);
+      prev = compMsg.component();
+      compMsg.set_component(encoded);
+    }
+  }
+}
+
+/// \brief Decode a state message encoded with EncodeStateMapDelta in
+/// place, updating the cache with the raw payloads.
+/// \param[inout] _msg State message to decode
+/// \param[inout] _cache Last payloads received from the peer
+/// \return False if any component delta is malformed. The message must
+/// not be used in that case.
+inline bool DecodeStateMapDelta(msgs::SerializedStateMap &_msg,
+    ComponentDeltaCache &_cache)
+{
+  std::string decoded;
+  for (auto &entityEntry : *_msg.mutable_entities())
+  {
+    auto &entityMsg = entityEntry.second;
+    if (entityMsg.remove())
+    {
+      _cache.erase(entityEntry.first);
+      continue;
+    }
+    auto &entityCache = _cache[entityEntry.first];
+    for (auto &compEntry : *entityMsg.mutable_components())
+    {
+      auto &compMsg = compEntry.second;
+      if (compMsg.remove())
+      {
+        entityCache.erase(compEntry.first);
+        continue;
+      }
+      auto &prev = entityCache[compEntry.first];
+      if (!DecodeStateDelta(prev, compMsg.component(), decoded))
+        return false;
+      prev = decoded;
+      compMsg.set_component(decoded);
+    }
+  }
+  return true;
+}
+}
+}
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "StateDeltaCodec.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+TEST(StateDeltaCodec, Varint)
+{
+  std::string buffer;
+  AppendVarint(buffer, 0u);
+  AppendVarint(buffer, 127u);
+  AppendVarint(buffer, 128u);
+  AppendVarint(buffer, 1u << 20);
+
+  std::size_t pos = 0;
+  uint64_t value = 0;
+  EXPECT_TRUE(ReadVarint(buffer, pos, value));
+  EXPECT_EQ(0u, value);
+  EXPECT_TRUE(ReadVarint(buffer, pos, value));
+  EXPECT_EQ(127u, value);
+  EXPECT_TRUE(ReadVarint(buffer, pos, value));
+  EXPECT_EQ(128u, value);
+  EXPECT_TRUE(ReadVarint(buffer, pos, value));
+  EXPECT_EQ(1u << 20, value);
+  EXPECT_EQ(buffer.size(), pos);
+
+  // Truncated input
+  EXPECT_FALSE(ReadVarint(buffer, pos, value));
+}
+
+/////////////////////////////////////////////////
+TEST(StateDeltaCodec, RoundTrip)
+{
+  const std::string prev(200, 'a');
+
+  // A payload differing in a few bytes in the middle
+  std::string curr = prev;
+  curr[100] = 'b';
+  curr[101] = 'c';
+
+  std::string delta;
+  EncodeStateDelta(prev, curr, delta);
+  // Long identical stretches collapse into run headers
+  EXPECT_LT(delta.size(), 20u);
+
+  std::string decoded;
+  EXPECT_TRUE(DecodeStateDelta(prev, delta, decoded));
+  EXPECT_EQ(curr, decoded);
+}
+
+/////////////////////////////////////////////////
+TEST(StateDeltaCodec, RoundTripEdgeCases)
+{
+  std::string delta;
+  std::string decoded;
+
+  // No previous payload: the delta carries the payload verbatim
+  EncodeStateDelta("", "hello", delta);
+  EXPECT_TRUE(DecodeStateDelta("", delta, decoded));
+  EXPECT_EQ("hello", decoded);
+
+  // Identical payloads: a couple of run headers and no literals
+  EncodeStateDelta("hello world", "hello world", delta);
+  EXPECT_LT(delta.size(), 5u);
+  EXPECT_TRUE(DecodeStateDelta("hello world", delta, decoded));
+  EXPECT_EQ("hello world", decoded);
+
+  // Payload grows
+  EncodeStateDelta("abc", "abcdef", delta);
+  EXPECT_TRUE(DecodeStateDelta("abc", delta, decoded));
+  EXPECT_EQ("abcdef", decoded);
+
+  // Payload shrinks
+  EncodeStateDelta("abcdef", "abc", delta);
+  EXPECT_TRUE(DecodeStateDelta("abcdef", delta, decoded));
+  EXPECT_EQ("abc", decoded);
+
+  // Empty payload
+  EncodeStateDelta("abc", "", delta);
+  EXPECT_TRUE(DecodeStateDelta("abc", delta, decoded));
+  EXPECT_EQ("", decoded);
+}
+
+/////////////////////////////////////////////////
+TEST(StateDeltaCodec, MalformedDelta)
+{
+  std::string decoded;
+  EXPECT_FALSE(DecodeStateDelta("", "", decoded));
+
+  // Size promises more bytes than the runs provide
+  std::string delta;
+  AppendVarint(delta, 100u);
+  AppendVarint(delta, 2u);
+  AppendVarint(delta, 200u);
+  EXPECT_FALSE(DecodeStateDelta("", delta, decoded));
+}
+
+/////////////////////////////////////////////////
+TEST(StateDeltaCodec, StateMapRoundTrip)
+{
+  // Two consecutive states of the same entity and component
+  msgs::SerializedStateMap first;
+  {
+    msgs::SerializedEntityMap entityMsg;
+    entityMsg.set_id(5u);
+    msgs::SerializedComponent compMsg;
+    compMsg.set_type(7);
+    compMsg.set_component(std::string(100, 'x') + "step one");
+    (*entityMsg.mutable_components())[7] = compMsg;
+    (*first.mutable_entities())[5u] = entityMsg;
+  }
+  msgs::SerializedStateMap second(first);
+  (*(*second.mutable_entities())[5u].mutable_components())[7]
+      .set_component(std::string(100, 'x') + "step two");
+
+  ComponentDeltaCache sendCache;
+  ComponentDeltaCache receiveCache;
+
+  auto firstEncoded = first;
+  EncodeStateMapDelta(firstEncoded, sendCache);
+  EXPECT_TRUE(DecodeStateMapDelta(firstEncoded, receiveCache));
+  EXPECT_EQ(first.entities().at(5u).components().at(7).component(),
+      firstEncoded.entities().at(5u).components().at(7).component());
+
+  auto secondEncoded = second;
+  EncodeStateMapDelta(secondEncoded, sendCache);
+  EXPECT_TRUE(DecodeStateMapDelta(secondEncoded, receiveCache));
+  EXPECT_EQ(second.entities().at(5u).components().at(7).component(),
+      secondEncoded.entities().at(5u).components().at(7).component());
+
+  // Removed components drop out of the caches
+  msgs::SerializedStateMap third(second);
+  (*(*third.mutable_entities())[5u].mutable_components())[7]
+      .set_remove(true);
+  EncodeStateMapDelta(third, sendCache);
+  EXPECT_TRUE(DecodeStateMapDelta(third, receiveCache));
+  EXPECT_TRUE(sendCache.at(5u).empty());
+  EXPECT_TRUE(receiveCache.at(5u).empty());
+}
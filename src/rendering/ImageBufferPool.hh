@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_RENDERING_IMAGEBUFFERPOOL_HH_
+#define GZ_SIM_RENDERING_IMAGEBUFFERPOOL_HH_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace gz
+{
+namespace sim
+{
+/// \brief Ref-counted pool of byte buffers for per-frame image data.
+///
+/// Rendering sensor outputs are large (a 1080p float depth image is 8 MB)
+/// and are produced every frame, so allocating a fresh buffer per capture
+/// and publication churns hundreds of MB/s through the allocator. The pool
+/// hands out std::vector<unsigned char> buffers wrapped in a shared_ptr
+/// whose deleter returns the storage to the pool when the last holder, e.g.
+/// the transport layer, drops its reference. Buffers are matched by
+/// capacity, so mixed-resolution sensor stacks share the pool without
+/// repeated growth.
+///
+/// The pool is internal to the rendering and sensor update paths and is
+/// safe to use from multiple threads. Hit and miss counters are exposed so
+/// the steady-state reuse rate can be checked when tuning.
+class ImageBufferPool
+{
+  /// \brief A pooled buffer. Storage returns to the pool when the last
+  /// reference is dropped.
+  public: using BufferPtr = std::shared_ptr<std::vector<unsigned char>>;
+
+  /// \brief Constructor
+  /// \param[in] _maxPooledBytes Upper bound on idle bytes retained by the
+  /// pool. Buffers released beyond this bound are freed instead of pooled.
+  public: explicit ImageBufferPool(std::size_t _maxPooledBytes = 256u << 20)
+    : state(std::make_shared<State>())
+  {
+    this->state->maxPooledBytes = _maxPooledBytes;
+  }
+
+  /// \brief Get a buffer of the requested size, reusing pooled storage
+  /// when a large enough buffer is idle.
+  /// \param[in] _size Required buffer size in bytes
+  /// \return A buffer of exactly _size bytes. Contents are unspecified.
+  public: BufferPtr Acquire(std::size_t _size)
+  {
+    std::unique_ptr<std::vector<unsigned char>> buffer;
+    {
+      std::lock_guard<std::mutex> lock(this->state->mutex);
+      // Smallest idle buffer whose capacity fits the request
+      auto it = this->state->freeBuffers.lower_bound(_size);
+      if (it != this->state->freeBuffers.end())
+      {
+        buffer = std::move(it->second);
+        this->state->pooledBytes -= it->first;
+        this->state->freeBuffers.erase(it);
+        ++this->state->hits;
+      }
+      else
+      {
+        buffer = std::make_unique<std::vector<unsigned char>>();
+        buffer->reserve(_size);
+        ++this->state->misses;
+      }
+    }
+    buffer->resize(_size);
+
+    // The deleter keeps only a weak reference so buffers released after
+    // the pool is destroyed are simply freed.
+    std::weak_ptr<State> weakState = this->state;
+    auto raw = buffer.release();
+    return BufferPtr(raw, [weakState](std::vector<unsigned char> *_buf)
+    {
+      auto s = weakState.lock();
+      if (s)
+      {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        if (s->pooledBytes + _buf->capacity() <= s->maxPooledBytes)
+        {
+          s->pooledBytes += _buf->capacity();
+          s->freeBuffers.emplace(_buf->capacity(),
+              std::unique_ptr<std::vector<unsigned char>>(_buf));
+          return;
+        }
+      }
+      delete _buf;
+    });
+  }
+
+  /// \brief Number of acquisitions served from pooled storage.
+  public: uint64_t Hits() const
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->hits;
+  }
+
+  /// \brief Number of acquisitions that had to allocate.
+  public: uint64_t Misses() const
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->misses;
+  }
+
+  /// \brief Fraction of acquisitions served from pooled storage, in
+  /// [0, 1]. Zero if nothing has been acquired yet.
+  public: double HitRate() const
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    const uint64_t total = this->state->hits + this->state->misses;
+    if (total == 0u)
+      return 0.0;
+    return static_cast<double>(this->state->hits) / static_cast<double>(total);
+  }
+
+  /// \brief Idle bytes currently retained by the pool.
+  public: std::size_t PooledBytes() const
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->pooledBytes;
+  }
+
+  /// \brief Number of idle buffers currently retained by the pool.
+  public: std::size_t PooledCount() const
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->freeBuffers.size();
+  }
+
+  /// \brief Free all idle buffers. Buffers still referenced are not
+  /// affected; they are freed instead of pooled on release.
+  public: void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    this->state->freeBuffers.clear();
+    this->state->pooledBytes = 0u;
+  }
+
+  /// \brief Shared pool state, kept alive by outstanding buffer deleters.
+  private: struct State
+  {
+    /// \brief Protects all members
+    public: mutable std::mutex mutex;
+
+    /// \brief Idle buffers keyed by capacity
+    public: std::multimap<std::size_t,
+        std::unique_ptr<std::vector<unsigned char>>> freeBuffers;
+
+    /// \brief Sum of the capacities in freeBuffers
+    public: std::size_t pooledBytes{0u};
+
+    /// \brief Upper bound on pooledBytes
+    public: std::size_t maxPooledBytes{0u};
+
+    /// \brief Acquisitions served from the pool
+    public: uint64_t hits{0u};
+
+    /// \brief Acquisitions that allocated
+    public: uint64_t misses{0u};
+  };
+
+  /// \brief Pool state shared with buffer deleters
+  private: std::shared_ptr<State> state;
+};
+}
+}
+#endif
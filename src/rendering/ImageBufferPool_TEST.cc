@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "ImageBufferPool.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+TEST(ImageBufferPool, AcquireAndReuse)
+{
+  ImageBufferPool pool;
+  EXPECT_EQ(0u, pool.Hits());
+  EXPECT_EQ(0u, pool.Misses());
+  EXPECT_DOUBLE_EQ(0.0, pool.HitRate());
+
+  auto buffer = pool.Acquire(1024u);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(1024u, buffer->size());
+  EXPECT_EQ(1u, pool.Misses());
+
+  auto *data = buffer->data();
+  buffer.reset();
+  EXPECT_EQ(1u, pool.PooledCount());
+
+  // A smaller request reuses the released storage
+  auto reused = pool.Acquire(512u);
+  ASSERT_NE(nullptr, reused);
+  EXPECT_EQ(512u, reused->size());
+  EXPECT_EQ(data, reused->data());
+  EXPECT_EQ(1u, pool.Hits());
+  EXPECT_EQ(0u, pool.PooledCount());
+  EXPECT_DOUBLE_EQ(0.5, pool.HitRate());
+}
+
+/////////////////////////////////////////////////
+TEST(ImageBufferPool, LargerRequestAllocates)
+{
+  ImageBufferPool pool;
+  pool.Acquire(1024u).reset();
+  EXPECT_EQ(1u, pool.PooledCount());
+
+  // The pooled buffer is too small for this request, so it stays pooled
+  auto big = pool.Acquire(4096u);
+  EXPECT_EQ(4096u, big->size());
+  EXPECT_EQ(2u, pool.Misses());
+  EXPECT_EQ(1u, pool.PooledCount());
+}
+
+/////////////////////////////////////////////////
+TEST(ImageBufferPool, PooledBytesBound)
+{
+  // A pool that can retain at most one of the two buffers
+  ImageBufferPool pool(1500u);
+  auto first = pool.Acquire(1024u);
+  auto second = pool.Acquire(1024u);
+  first.reset();
+  EXPECT_EQ(1u, pool.PooledCount());
+
+  // Releasing the second would exceed the bound, so it is freed
+  second.reset();
+  EXPECT_EQ(1u, pool.PooledCount());
+  EXPECT_LE(pool.PooledBytes(), 1500u);
+}
+
+/////////////////////////////////////////////////
+TEST(ImageBufferPool, Clear)
+{
+  ImageBufferPool pool;
+  pool.Acquire(1024u).reset();
+  pool.Acquire(2048u).reset();
+  EXPECT_EQ(2u, pool.PooledCount());
+
+  pool.Clear();
+  EXPECT_EQ(0u, pool.PooledCount());
+  EXPECT_EQ(0u, pool.PooledBytes());
+}
+
+/////////////////////////////////////////////////
+TEST(ImageBufferPool, ReleaseAfterPoolDestroyed)
+{
+  ImageBufferPool::BufferPtr buffer;
+  {
+    ImageBufferPool pool;
+    buffer = pool.Acquire(1024u);
+  }
+  // The pool is gone; releasing must free the buffer without crashing
+  buffer.reset();
+}
@@ -19,7 +19,9 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
+#include <utility>
 
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/marker.pb.h>
@@ -34,6 +36,7 @@
 
 #include "gz/sim/Events.hh"
 #include "gz/sim/Conversions.hh"
+#include "gz/sim/PublishQueue.hh"
 #include "gz/common/Console.hh"
 #include "gz/rendering/Marker.hh"
 #include "gz/rendering/RenderingIface.hh"
@@ -110,6 +113,11 @@ class gz::sim::MarkerManagerPrivate
   public: std::map<std::string,
       std::map<uint64_t, rendering::VisualPtr>> visuals;
 
+  /// \brief Markers with a finite lifetime, keyed by namespace. The expiry
+  /// sweep in Update only visits these, so retained markers cost nothing
+  /// per frame.
+  public: std::map<std::string, std::set<uint64_t>> lifetimeMarkers;
+
   /// \brief List of marker message to process.
   public: std::list<msgs::Marker> markerMsgs;
 
@@ -139,7 +147,12 @@ MarkerManager::MarkerManager() : dataPtr(
 }
 
 /////////////////////////////////////////////////
-MarkerManager::~MarkerManager() = default;
+MarkerManager::~MarkerManager()
+{
+  // Drain the shared publication queue so no queued marker message
+  // references this manager's publisher after it is destroyed.
+  PublishQueue::Instance().Flush();
+}
 
 /////////////////////////////////////////////////
 void MarkerManager::SetScene(rendering::ScenePtr _scene)
@@ -224,47 +237,73 @@ void MarkerManagerPrivate::Update()
 {
   std::lock_guard<std::mutex> lock(this->mutex);
 
-  // Process the marker messages.
+  // Process the marker messages. The echo on the marker topic is only
+  // serialized when someone is listening, and off the render thread.
+  const bool echoMarkers = this->markerPub.HasConnections();
   for (auto markerIter = this->markerMsgs.begin();
        markerIter != this->markerMsgs.end();)
   {
     this->ProcessMarkerMsg(*markerIter);
-    this->markerPub.Publish(*markerIter);
+    if (echoMarkers)
+      PublishQueue::Instance().Publish(this->markerPub,
+          std::move(*markerIter));
     this->markerMsgs.erase(markerIter++);
   }
 
-
-  // Erase any markers that have a lifetime.
-  for (auto mit = this->visuals.begin();
-       mit != this->visuals.end();)
+  // Erase any markers that have a lifetime. Only the registered lifetime
+  // markers are scanned.
+  const bool rewound = this->simTime < this->lastSimTime;
+  for (auto nsIt = this->lifetimeMarkers.begin();
+       nsIt != this->lifetimeMarkers.end();)
   {
-    for (auto it = mit->second.cbegin();
-         it != mit->second.cend(); ++it)
+    auto visNsIter = this->visuals.find(nsIt->first);
+    for (auto idIt = nsIt->second.begin(); idIt != nsIt->second.end();)
     {
-      if (it->second->GeometryCount() == 0u)
+      rendering::VisualPtr visual;
+      if (visNsIter != this->visuals.end())
+      {
+        auto visIter = visNsIter->second.find(*idIt);
+        if (visIter != visNsIter->second.end())
+          visual = visIter->second;
+      }
+
+      // Marker was deleted through another path, drop the stale entry.
+      if (visual == nullptr)
+      {
+        idIt = nsIt->second.erase(idIt);
         continue;
+      }
 
-      rendering::MarkerPtr markerPtr =
-            std::dynamic_pointer_cast<rendering::Marker>
-            (it->second->GeometryByIndex(0u));
-      if (markerPtr != nullptr)
+      bool expired = rewound;
+      if (!expired && visual->GeometryCount() > 0u)
       {
-        if (markerPtr->Lifetime().count() != 0 &&
-            (markerPtr->Lifetime() <= simTime ||
-            this->simTime < this->lastSimTime))
-        {
-          this->scene->DestroyVisual(it->second);
-          it = mit->second.erase(it);
-          break;
-        }
+        rendering::MarkerPtr markerPtr =
+              std::dynamic_pointer_cast<rendering::Marker>
+              (visual->GeometryByIndex(0u));
+        expired = markerPtr != nullptr &&
+            markerPtr->Lifetime().count() != 0 &&
+            markerPtr->Lifetime() <= this->simTime;
+      }
+
+      if (expired)
+      {
+        this->scene->DestroyVisual(visual);
+        visNsIter->second.erase(*idIt);
+        idIt = nsIt->second.erase(idIt);
+      }
+      else
+      {
+        ++idIt;
       }
     }
 
     // Erase a namespace if it's empty
-    if (mit->second.empty())
-      mit = this->visuals.erase(mit);
+    if (visNsIter != this->visuals.end() && visNsIter->second.empty())
+      this->visuals.erase(visNsIter);
+    if (nsIt->second.empty())
+      nsIt = this->lifetimeMarkers.erase(nsIt);
     else
-      ++mit;
+      ++nsIt;
   }
   this->lastSimTime = this->simTime;
 }
@@ -543,6 +582,20 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
       // Store the visual
       this->visuals[ns][id] = visualPtr;
     }
+
+    // Keep the lifetime registry in sync so the expiry sweep only scans
+    // markers that can actually expire.
+    if (convert<std::chrono::steady_clock::duration>(
+        _msg.lifetime()).count() != 0)
+    {
+      this->lifetimeMarkers[ns].insert(id);
+    }
+    else
+    {
+      auto lifetimeIter = this->lifetimeMarkers.find(ns);
+      if (lifetimeIter != this->lifetimeMarkers.end())
+        lifetimeIter->second.erase(id);
+    }
   }
   // Remove a single marker
   else if (_msg.action() == msgs::Marker::DELETE_MARKER)
@@ -557,6 +610,14 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
       // Remove namespace if empty
       if (this->visuals[ns].empty())
         this->visuals.erase(nsIter);
+
+      auto lifetimeIter = this->lifetimeMarkers.find(ns);
+      if (lifetimeIter != this->lifetimeMarkers.end())
+      {
+        lifetimeIter->second.erase(id);
+        if (lifetimeIter->second.empty())
+          this->lifetimeMarkers.erase(lifetimeIter);
+      }
     }
     else
     {
@@ -584,6 +645,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
       }
       nsIter->second.clear();
       this->visuals.erase(nsIter);
+      this->lifetimeMarkers.erase(ns);
     }
     // Remove all markers in all namespaces.
     else
@@ -597,6 +659,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
         }
       }
       this->visuals.clear();
+      this->lifetimeMarkers.clear();
     }
   }
   else
@@ -651,6 +714,7 @@ bool MarkerManagerPrivate::OnMarkerMsgArray(
 void MarkerManager::Clear()
 {
   this->dataPtr->visuals.clear();
+  this->dataPtr->lifetimeMarkers.clear();
   this->dataPtr->markerMsgs.clear();
   this->dataPtr->scene.reset();
 }
@@ -42,6 +42,12 @@ void MaterialParser::Load()
 std::optional<MaterialParser::MaterialValues> MaterialParser::GetMaterialValues(
   const std::string& _material)
 {
+  auto cached = this->valuesCache.find(_material);
+  if (cached != this->valuesCache.end())
+  {
+    return cached->second;
+  }
+
   std::optional<MaterialValues> values = std::nullopt;
   std::map<std::string, ConfigNode *> scripts =
     this->configLoader.GetAllConfigScripts();
@@ -95,5 +101,7 @@ std::optional<MaterialParser::MaterialValues> MaterialParser::GetMaterialValues(
       // \todo Handle dependent materials
     }
   }
+
+  this->valuesCache.emplace(_material, values);
   return values;
 }
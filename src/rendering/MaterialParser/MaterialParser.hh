@@ -20,6 +20,7 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
 
 #include <gz/math/Color.hh>
 
@@ -47,6 +48,11 @@ class MaterialParser
 
   private:
   ConfigLoader configLoader;
+
+  /// Resolved values per queried material name, including negative results.
+  /// The loaded script set is immutable after Load, so repeated lookups for
+  /// visuals sharing a material skip the script scan entirely.
+  std::unordered_map<std::string, std::optional<MaterialValues>> valuesCache;
 };
 }  // namespace sim
 }  // namespace gz
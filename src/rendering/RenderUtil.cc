@@ -16,10 +16,12 @@
  */
 
 #include <map>
+#include <memory>
 #include <stack>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -30,6 +32,7 @@
 #include <sdf/Joint.hh>
 #include <sdf/Light.hh>
 #include <sdf/Link.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Model.hh>
 #include <sdf/parser.hh>
 #include <sdf/Scene.hh>
@@ -39,6 +42,9 @@
 #include <gz/common/Profiler.hh>
 #include <gz/common/Skeleton.hh>
 #include <gz/common/SkeletonAnimation.hh>
+#include <gz/common/URI.hh>
+#include <gz/common/Util.hh>
+#include <gz/common/WorkerPool.hh>
 
 #include <gz/math/Color.hh>
 #include <gz/math/Helpers.hh>
@@ -47,6 +53,7 @@
 
 #include <gz/msgs/Utility.hh>
 
+#include <gz/rendering/Camera.hh>
 #include <gz/rendering/Grid.hh>
 #include <gz/rendering/RenderEngine.hh>
 #include <gz/rendering/RenderingIface.hh>
@@ -68,6 +75,7 @@
 #include "gz/sim/components/JointAxis.hh"
 #include "gz/sim/components/JointType.hh"
 #include "gz/sim/components/LaserRetro.hh"
+#include "gz/sim/components/Lod.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/LightCmd.hh"
 #include "gz/sim/components/Link.hh"
@@ -144,6 +152,14 @@ class gz::sim::RenderUtilPrivate
   /// \param[in] _ecm The entity-component manager
   public: void UpdateRenderingEntities(const EntityComponentManager &_ecm);
 
+  /// \brief Dispatch background loads for mesh geometries referenced by
+  /// newly staged visuals, so visual creation on the rendering thread
+  /// hits the mesh cache instead of doing disk I/O and parsing.
+  public: void PrefetchMeshes();
+
+  /// \brief Wait for outstanding mesh prefetch work to finish.
+  public: void WaitForMeshPrefetch();
+
   /// \breif Helper function to add new sensors
   /// \param[in] _ecm The entity-component manager
   /// \param[in] _entity Sensor entity
@@ -205,6 +221,11 @@ class gz::sim::RenderUtilPrivate
   /// \brief Event manager used for emitting render / scene events
   public: EventManager *eventManager{nullptr};
 
+  /// \brief Scene update event channel, resolved once when the event
+  /// manager is set so the per-update emit skips the EventManager type
+  /// lookup.
+  public: events::SceneUpdate *sceneUpdateEvent{nullptr};
+
   /// \brief Total time elapsed in simulation. This will not increase while
   /// paused.
   public: std::chrono::steady_clock::duration simTime{0};
@@ -269,6 +290,10 @@ class gz::sim::RenderUtilPrivate
   /// [0] entity id, [1] SDF DOM, [2] parent entity id
   public: std::vector<std::tuple<Entity, sdf::Visual, Entity>> newVisuals;
 
+  /// \brief Level-of-detail variants of new visuals, to be handed to the
+  /// scene manager once the visuals are created.
+  public: std::unordered_map<Entity, std::vector<LodVariant>> newLods;
+
   /// \brief New actors to be created. The elements in the tuple are:
   /// [0] entity id, [1] SDF DOM, [2] actor name, [3] parent entity id
   public: std::vector<std::tuple<Entity, sdf::Actor, std::string, Entity>>
@@ -316,6 +341,66 @@ class gz::sim::RenderUtilPrivate
   /// \brief A map of entity ids and pose updates.
   public: std::unordered_map<Entity, math::Pose3d> entityPoses;
 
+  /// \brief Scratch set of entities whose pose changed in the current
+  /// iteration. Member variable so the allocation is reused between updates.
+  public: std::unordered_set<Entity> changedPoseEntities;
+
+  /// \brief Pool used to load mesh assets in the background while the
+  /// simulation continues. Created lazily when the first mesh visual is
+  /// staged.
+  public: std::unique_ptr<common::WorkerPool> meshPrefetchPool;
+
+  /// \brief Full paths of meshes that have already been dispatched for
+  /// prefetching.
+  public: std::unordered_set<std::string> prefetchedMeshPaths;
+
+  /// \brief Batched (node, pose) pairs collected each frame before they
+  /// are applied to the scene in one tight loop. Member variable so the
+  /// allocation is reused between frames.
+  public: std::vector<std::pair<rendering::NodePtr, math::Pose3d>>
+      poseUpdateBatch;
+
+  /// \brief Last pose applied to each entity's render node, used to skip
+  /// redundant scene graph updates for entities that did not move.
+  public: std::unordered_map<Entity, math::Pose3d> lastNodePoses;
+
+  /// \brief True to restrict pose synchronization on the sensors render
+  /// instance to nodes within range of at least one sensor. Updates for
+  /// nodes outside every sensor's interest radius are deferred until the
+  /// node comes back into range. Enabled by setting the
+  /// GZ_SIM_SENSOR_INTEREST_CULLING environment variable to 1.
+  public: bool sensorInterestCulling = false;
+
+  /// \brief Interest volumes of the scene's sensors, collected on the
+  /// render thread each frame: sensor world position and interest radius.
+  public: std::vector<std::pair<math::Vector3d, double>>
+      sensorInterestVolumes;
+
+  /// \brief Fallback interest radius in meters for sensors whose range
+  /// cannot be queried. Cameras and GPU lidars use their far clip plane
+  /// instead. Override with the GZ_SIM_SENSOR_INTEREST_RADIUS environment
+  /// variable.
+  public: double sensorInterestRadius = 100.0;
+
+  /// \brief Pose updates withheld because their node was out of range of
+  /// every sensor, applied once the node comes back into range.
+  public: std::unordered_map<Entity, math::Pose3d> deferredNodePoses;
+
+  /// \brief Number of pose updates deferred by sensor interest culling.
+  public: uint64_t poseUpdatesCulled = 0u;
+
+  /// \brief Number of pose updates applied to the scene.
+  public: uint64_t poseUpdatesApplied = 0u;
+
+  /// \brief Frame counter used to periodically report culling statistics.
+  public: uint64_t interestCullingLogCounter = 0u;
+
+  /// \brief Check whether a position is within the interest radius of any
+  /// sensor collected this frame.
+  /// \param[in] _pos World position to test.
+  /// \return True if at least one sensor is interested in the position.
+  public: bool InsideSensorInterest(const math::Vector3d &_pos) const;
+
   /// \brief A map of entity ids and light updates.
   public: std::unordered_map<Entity, msgs::Light> entityLights;
 
@@ -382,6 +467,31 @@ class gz::sim::RenderUtilPrivate
   /// \todo(anyone) Let this be turned on from a component
   public: bool actorManualSkeletonUpdate = false;
 
+  /// \brief True to decimate actor skeletal updates with distance from
+  /// the camera and freeze the pose of far actors.
+  public: bool actorAnimationLod = false;
+
+  /// \brief Position of the camera used for animation LOD, captured on
+  /// the rendering thread while the update mutex is held.
+  public: math::Vector3d lodCameraPos;
+
+  /// \brief True once lodCameraPos holds a valid position.
+  public: bool lodCameraValid = false;
+
+  /// \brief Counts actor update passes, used to stagger decimated
+  /// skeletal updates across actors.
+  public: uint64_t actorUpdateCounter = 0u;
+
+  /// \brief Actors that have had at least one skeletal pose computed, so
+  /// far actors are frozen rather than left unposed.
+  public: std::unordered_set<Entity> actorPosedOnce;
+
+  /// \brief Skeletal update interval for an actor at a camera distance.
+  /// \param[in] _distance Distance from the LOD camera in meters.
+  /// \return Number of update passes between skeletal updates, or zero to
+  /// freeze the actor's current pose.
+  public: uint64_t ActorAnimationInterval(double _distance) const;
+
   /// \brief Mutex to protect updates
   public: std::mutex updateMutex;
 
@@ -631,6 +741,35 @@ class gz::sim::RenderUtilPrivate
 //////////////////////////////////////////////////
 RenderUtil::RenderUtil() : dataPtr(std::make_unique<RenderUtilPrivate>())
 {
+  std::string animationLod;
+  common::env("GZ_SIM_ACTOR_ANIMATION_LOD", animationLod);
+  this->dataPtr->actorAnimationLod = animationLod == "1";
+
+  std::string interestCulling;
+  common::env("GZ_SIM_SENSOR_INTEREST_CULLING", interestCulling);
+  this->dataPtr->sensorInterestCulling = interestCulling == "1";
+
+  std::string interestRadius;
+  if (common::env("GZ_SIM_SENSOR_INTEREST_RADIUS", interestRadius))
+  {
+    try
+    {
+      this->dataPtr->sensorInterestRadius = std::stod(interestRadius);
+    }
+    catch (const std::exception &)
+    {
+      gzwarn << "Invalid GZ_SIM_SENSOR_INTEREST_RADIUS value ["
+             << interestRadius << "]. Using default "
+             << this->dataPtr->sensorInterestRadius << " m." << std::endl;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void RenderUtil::SetActorAnimationLod(bool _enabled)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
+  this->dataPtr->actorAnimationLod = _enabled;
 }
 
 //////////////////////////////////////////////////
@@ -708,45 +847,56 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
   }
 
   // Update thermal cameras
-  _ecm.Each<components::ThermalCamera>(
-      [&](const Entity &_entity,
-        const components::ThermalCamera *)->bool
-      {
-        // set properties from thermal sensor plugin
-        // Set defaults to invaid values so we know they have not been set.
-        // set UpdateECM(). We check for valid values first before setting
-        // these thermal camera properties..
-        double resolution = 0.0;
-        components::TemperatureRangeInfo range;
-        range.min = std::numeric_limits<double>::max();
-        range.max = 0;
-
-        // resolution
-        auto resolutionComp =
-          _ecm.Component<components::TemperatureLinearResolution>(_entity);
-        if (resolutionComp != nullptr)
-        {
-          resolution = resolutionComp->Data();
-          _ecm.RemoveComponent<components::TemperatureLinearResolution>(
-              _entity);
-        }
-
-        // min / max temp
-        auto tempRangeComp =
-          _ecm.Component<components::TemperatureRange>(_entity);
-        if (tempRangeComp != nullptr)
+  // The resolution and temperature range components are one-shot
+  // configuration from the thermal sensor plugin and are removed once
+  // consumed. Iterating over them directly instead of over every
+  // ThermalCamera makes this a no-op in steady state.
+  {
+    // Defaults are invalid values so we know they have not been set when
+    // checked in UpdateThermalCamera().
+    auto defaultThermalData = []()
+    {
+      components::TemperatureRangeInfo range;
+      range.min = std::numeric_limits<double>::max();
+      range.max = 0;
+      return std::make_tuple(0.0, range);
+    };
+
+    std::vector<Entity> resolutionCompsToDelete;
+    _ecm.Each<components::ThermalCamera,
+              components::TemperatureLinearResolution>(
+        [&](const Entity &_entity,
+            const components::ThermalCamera *,
+            const components::TemperatureLinearResolution *_resolution)->bool
         {
-          range = tempRangeComp->Data();
-          _ecm.RemoveComponent<components::TemperatureRange>(_entity);
-        }
+          auto data = this->dataPtr->thermalCameraData.emplace(
+              _entity, defaultThermalData()).first;
+          std::get<0>(data->second) = _resolution->Data();
+          resolutionCompsToDelete.push_back(_entity);
+          return true;
+        });
+    for (const auto entity : resolutionCompsToDelete)
+    {
+      _ecm.RemoveComponent<components::TemperatureLinearResolution>(entity);
+    }
 
-        if (resolutionComp || tempRangeComp)
+    std::vector<Entity> tempRangeCompsToDelete;
+    _ecm.Each<components::ThermalCamera, components::TemperatureRange>(
+        [&](const Entity &_entity,
+            const components::ThermalCamera *,
+            const components::TemperatureRange *_range)->bool
         {
-          this->dataPtr->thermalCameraData[_entity] =
-              std::make_tuple(resolution, range);
-        }
-        return true;
-      });
+          auto data = this->dataPtr->thermalCameraData.emplace(
+              _entity, defaultThermalData()).first;
+          std::get<1>(data->second) = _range->Data();
+          tempRangeCompsToDelete.push_back(_entity);
+          return true;
+        });
+    for (const auto entity : tempRangeCompsToDelete)
+    {
+      _ecm.RemoveComponent<components::TemperatureRange>(entity);
+    }
+  }
 
   // visual commands
   {
@@ -822,6 +972,7 @@ void RenderUtil::UpdateFromECM(const UpdateInfo &_info,
   this->dataPtr->simTime = _info.simTime;
 
   this->dataPtr->CreateRenderingEntities(_ecm, _info);
+  this->dataPtr->PrefetchMeshes();
   this->dataPtr->UpdateRenderingEntities(_ecm);
   this->dataPtr->RemoveRenderingEntities(_ecm, _info);
   this->dataPtr->markerManager.SetSimTime(_info.simTime);
@@ -1097,11 +1248,29 @@ void RenderUtil::Update()
 
   this->dataPtr->updateMutex.lock();
 
+  // Capture a camera position for actor animation LOD while the mutex is
+  // held; UpdateRenderingEntities reads it on the simulation thread.
+  if (this->dataPtr->actorAnimationLod)
+  {
+    for (unsigned int i = 0; i < this->dataPtr->scene->SensorCount(); ++i)
+    {
+      auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+          this->dataPtr->scene->SensorByIndex(i));
+      if (nullptr != camera)
+      {
+        this->dataPtr->lodCameraPos = camera->WorldPosition();
+        this->dataPtr->lodCameraValid = true;
+        break;
+      }
+    }
+  }
+
   this->dataPtr->scene->SetTime(this->dataPtr->simTime);
   auto newScenes = std::move(this->dataPtr->newScenes);
   auto newModels = std::move(this->dataPtr->newModels);
   auto newLinks = std::move(this->dataPtr->newLinks);
   auto newVisuals = std::move(this->dataPtr->newVisuals);
+  auto newLods = std::move(this->dataPtr->newLods);
   auto newActors = std::move(this->dataPtr->newActors);
   auto newLights = std::move(this->dataPtr->newLights);
   auto newParticleEmitters = std::move(this->dataPtr->newParticleEmitters);
@@ -1133,6 +1302,7 @@ void RenderUtil::Update()
   this->dataPtr->newModels.clear();
   this->dataPtr->newLinks.clear();
   this->dataPtr->newVisuals.clear();
+  this->dataPtr->newLods.clear();
   this->dataPtr->newActors.clear();
   this->dataPtr->newLights.clear();
   this->dataPtr->newParticleEmitters.clear();
@@ -1202,6 +1372,8 @@ void RenderUtil::Update()
           this->dataPtr->selectedEntities.end(), entity.first),
           this->dataPtr->selectedEntities.end());
       this->dataPtr->sceneManager.RemoveEntity(entity.first);
+      this->dataPtr->lastNodePoses.erase(entity.first);
+      this->dataPtr->deferredNodePoses.erase(entity.first);
 
       this->dataPtr->RemoveSensor(entity.first);
       this->dataPtr->RemoveBoundingBox(entity.first);
@@ -1245,12 +1417,22 @@ void RenderUtil::Update()
           std::get<0>(link), std::get<1>(link), std::get<2>(link));
     }
 
+    // Mesh assets referenced by the new visuals have been loading in the
+    // background since the visuals were staged; wait for them so the
+    // creation below resolves meshes from the cache.
+    this->dataPtr->WaitForMeshPrefetch();
+
     for (const auto &visual : newVisuals)
     {
       this->dataPtr->sceneManager.CreateVisual(
           std::get<0>(visual), std::get<1>(visual), std::get<2>(visual));
     }
 
+    for (const auto &[lodEntity, lodVariants] : newLods)
+    {
+      this->dataPtr->sceneManager.SetVisualLod(lodEntity, lodVariants);
+    }
+
     for (const auto &light : newLights)
     {
       auto newLightRendering = this->dataPtr->sceneManager.CreateLight(
@@ -1345,8 +1527,47 @@ void RenderUtil::Update()
   // update entities' pose
   {
     GZ_PROFILE("RenderUtil::Update Poses");
+    // Collect the (node, pose) pairs first so the apply step below is a
+    // tight loop over contiguous data. Nodes whose pose did not change
+    // since the last frame are skipped before the more expensive visual
+    // and user data checks.
+    this->dataPtr->poseUpdateBatch.clear();
+    const Entity lastSelected = this->dataPtr->selectedEntities.empty() ?
+        kNullEntity : this->dataPtr->selectedEntities.back();
+
+    // Per-sensor interest management: on the sensors render instance,
+    // pose updates for nodes out of range of every sensor are deferred
+    // instead of applied, so a camera in one corner of a large world does
+    // not pay for transform updates of everything outside its reach.
+    const bool interestCulling = this->dataPtr->enableSensors &&
+        this->dataPtr->sensorInterestCulling;
+    if (interestCulling)
+    {
+      this->dataPtr->sensorInterestVolumes.clear();
+      for (unsigned int i = 0; i < this->dataPtr->scene->SensorCount(); ++i)
+      {
+        auto sensor = this->dataPtr->scene->SensorByIndex(i);
+        if (nullptr == sensor)
+          continue;
+        // Cameras (including GPU lidars) see no farther than their far
+        // clip plane; other sensors fall back to a fixed radius.
+        double radius = this->dataPtr->sensorInterestRadius;
+        auto camera = std::dynamic_pointer_cast<rendering::Camera>(sensor);
+        if (nullptr != camera)
+          radius = camera->FarClipPlane();
+        this->dataPtr->sensorInterestVolumes.emplace_back(
+            sensor->WorldPosition(), radius);
+      }
+    }
     for (const auto &pose : entityPoses)
     {
+      auto lastIt = this->dataPtr->lastNodePoses.find(pose.first);
+      if (lastIt != this->dataPtr->lastNodePoses.end() &&
+          lastIt->second == pose.second)
+      {
+        continue;
+      }
+
       auto node = this->dataPtr->sceneManager.NodeById(pose.first);
       if (!node)
         continue;
@@ -1366,14 +1587,76 @@ void RenderUtil::Update()
         entityId = std::get<uint64_t>(vis->UserData("gazebo-entity"));
       }
       if ((this->dataPtr->transformActive &&
-          (pose.first == this->dataPtr->selectedEntities.back() ||
-          entityId == this->dataPtr->selectedEntities.back())) ||
+          (pose.first == lastSelected || entityId == lastSelected)) ||
           updateNode)
       {
+        // The node may be moved locally while paused or manipulated, so
+        // drop the cached pose to force a reapply once released.
+        this->dataPtr->lastNodePoses.erase(pose.first);
+        continue;
+      }
+
+      // Defer the update when neither the node's current position nor the
+      // incoming pose is within any sensor's reach. The incoming pose is
+      // relative to the node's parent, so for nested nodes this test is
+      // conservative and only ever applies more updates, never fewer.
+      if (interestCulling && !this->dataPtr->sensorInterestVolumes.empty() &&
+          !this->dataPtr->InsideSensorInterest(node->WorldPose().Pos()) &&
+          !this->dataPtr->InsideSensorInterest(pose.second.Pos()))
+      {
+        this->dataPtr->lastNodePoses[pose.first] = pose.second;
+        this->dataPtr->deferredNodePoses[pose.first] = pose.second;
+        ++this->dataPtr->poseUpdatesCulled;
         continue;
       }
+      this->dataPtr->deferredNodePoses.erase(pose.first);
+
+      this->dataPtr->lastNodePoses[pose.first] = pose.second;
+      this->dataPtr->poseUpdateBatch.emplace_back(node, pose.second);
+    }
+
+    for (const auto &[node, nodePose] : this->dataPtr->poseUpdateBatch)
+    {
+      node->SetLocalPose(nodePose);
+    }
+    this->dataPtr->poseUpdatesApplied += this->dataPtr->poseUpdateBatch.size();
+
+    // Reapply deferred poses for nodes that came back into range, e.g.
+    // because a sensor moved toward them.
+    if (interestCulling && !this->dataPtr->deferredNodePoses.empty())
+    {
+      for (auto it = this->dataPtr->deferredNodePoses.begin();
+           it != this->dataPtr->deferredNodePoses.end();)
+      {
+        auto node = this->dataPtr->sceneManager.NodeById(it->first);
+        if (nullptr == node)
+        {
+          it = this->dataPtr->deferredNodePoses.erase(it);
+          continue;
+        }
+        if (this->dataPtr->sensorInterestVolumes.empty() ||
+            this->dataPtr->InsideSensorInterest(node->WorldPose().Pos()) ||
+            this->dataPtr->InsideSensorInterest(it->second.Pos()))
+        {
+          node->SetLocalPose(it->second);
+          ++this->dataPtr->poseUpdatesApplied;
+          it = this->dataPtr->deferredNodePoses.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+    }
 
-      node->SetLocalPose(pose.second);
+    if (interestCulling &&
+        ++this->dataPtr->interestCullingLogCounter % 1000u == 0u)
+    {
+      gzdbg << "Sensor interest culling: "
+            << this->dataPtr->poseUpdatesCulled << " pose updates culled, "
+            << this->dataPtr->poseUpdatesApplied << " applied, "
+            << this->dataPtr->deferredNodePoses.size()
+            << " currently deferred." << std::endl;
     }
 
     // update entities' local transformations
@@ -1429,6 +1712,21 @@ void RenderUtil::Update()
     }
   }
 
+  // swap level-of-detail meshes based on camera distance
+  if (this->dataPtr->sceneManager.LodCount() > 0u)
+  {
+    GZ_PROFILE("RenderUtil::Update Lods");
+    std::vector<math::Vector3d> cameraPositions;
+    for (unsigned int i = 0; i < this->dataPtr->scene->SensorCount(); ++i)
+    {
+      auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+          this->dataPtr->scene->SensorByIndex(i));
+      if (camera)
+        cameraPositions.push_back(camera->WorldPosition());
+    }
+    this->dataPtr->sceneManager.UpdateLods(cameraPositions);
+  }
+
   // set visual temperature
   for (const auto &temp : entityTemp)
   {
@@ -1646,7 +1944,10 @@ void RenderUtil::Update()
         for (auto g = 0u; g < vis->GeometryCount(); ++g)
         {
           rendering::GeometryPtr geom = vis->GeometryByIndex(g);
-          rendering::MaterialPtr geomMat = geom->Material();
+          // Detach from any deduplicated material before applying
+          // per-visual colors, so sibling visuals keep their own look.
+          rendering::MaterialPtr geomMat =
+              this->dataPtr->sceneManager.DetachSharedMaterial(geom);
           if (!geomMat)
             continue;
 
@@ -1683,8 +1984,8 @@ void RenderUtil::Update()
     }
   }
 
-  if (this->dataPtr->eventManager)
-    this->dataPtr->eventManager->Emit<events::SceneUpdate>();
+  if (this->dataPtr->sceneUpdateEvent)
+    this->dataPtr->sceneUpdateEvent->Signal();
 }
 
 //////////////////////////////////////////////////
@@ -2309,35 +2610,32 @@ void RenderUtilPrivate::UpdateRenderingEntities(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("RenderUtilPrivate::UpdateRenderingEntities");
-  _ecm.Each<components::Model, components::Pose>(
-      [&](const Entity &_entity,
-        const components::Model *,
-        const components::Pose *_pose)->bool
-      {
-        this->entityPoses[_entity] = _pose->Data();
-        return true;
-      });
 
-  _ecm.Each<components::Link, components::Pose>(
-      [&](const Entity &_entity,
-        const components::Link *,
-        const components::Pose *_pose)->bool
-      {
-        this->entityPoses[_entity] = _pose->Data();
-        return true;
-      });
+  // Consume the ECM's change tracking (the same dirty sets used for
+  // periodic state serialization) so the per-update cost is proportional
+  // to the number of entities that moved, not to world size. Models,
+  // links, visuals and lights whose pose did not change keep their scene
+  // pose from previous updates.
+  this->changedPoseEntities.clear();
+  _ecm.ChangedEntities(components::Pose::typeId, this->changedPoseEntities);
+  for (const auto entity : this->changedPoseEntities)
+  {
+    auto poseComp = _ecm.Component<components::Pose>(entity);
+    if (nullptr == poseComp)
+      continue;
 
-  // visuals
-  _ecm.Each<components::Visual, components::Pose >(
-      [&](const Entity &_entity,
-        const components::Visual *,
-        const components::Pose *_pose)->bool
-      {
-        this->entityPoses[_entity] = _pose->Data();
-        return true;
-      });
+    if (nullptr != _ecm.Component<components::Model>(entity) ||
+        nullptr != _ecm.Component<components::Link>(entity) ||
+        nullptr != _ecm.Component<components::Visual>(entity) ||
+        nullptr != _ecm.Component<components::Light>(entity))
+    {
+      this->entityPoses[entity] = poseComp->Data();
+    }
+  }
 
-  // actors
+  // actors: animation state advances every iteration even when the actor
+  // pose is unchanged, so they keep the full scan
+  ++this->actorUpdateCounter;
   _ecm.Each<components::Actor, components::Pose>(
       [&](const Entity &_entity,
         const components::Actor *,
@@ -2346,6 +2644,28 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         // Trajectory origin
         this->entityPoses[_entity] = _pose->Data();
 
+        // Animation LOD: actors far from the camera update their skeleton
+        // on a decimated cadence, staggered by entity so the updates do
+        // not all land on the same pass, and very far actors keep their
+        // last pose entirely.
+        if (this->actorAnimationLod && this->lodCameraValid &&
+            this->actorPosedOnce.find(_entity) != this->actorPosedOnce.end())
+        {
+          const double distance =
+              (_pose->Data().Pos() - this->lodCameraPos).Length();
+          const uint64_t interval = this->ActorAnimationInterval(distance);
+          if (interval == 0u ||
+              (this->actorUpdateCounter + _entity) % interval != 0u)
+          {
+            // Trajectory poses set by other systems are still picked up.
+            auto trajPose =
+                _ecm.Component<components::TrajectoryPose>(_entity);
+            if (trajPose)
+              this->trajectoryPoses[_entity] = trajPose->Data();
+            return true;
+          }
+        }
+
         auto animTimeComp = _ecm.Component<components::AnimationTime>(_entity);
         auto animNameComp = _ecm.Component<components::AnimationName>(_entity);
 
@@ -2385,22 +2705,82 @@ void RenderUtilPrivate::UpdateRenderingEntities(
           }
         }
 
+        this->actorPosedOnce.insert(_entity);
+
         // Trajectory pose set by other systems
         auto trajPoseComp = _ecm.Component<components::TrajectoryPose>(_entity);
         if (trajPoseComp)
           this->trajectoryPoses[_entity] = trajPoseComp->Data();
         return true;
       });
+}
 
-  // update lights
-  _ecm.Each<components::Light, components::Pose>(
-      [&](const Entity &_entity,
-        const components::Light *,
-        const components::Pose *_pose)->bool
-      {
-        this->entityPoses[_entity] = _pose->Data();
-        return true;
-      });
+//////////////////////////////////////////////////
+uint64_t RenderUtilPrivate::ActorAnimationInterval(double _distance) const
+{
+  if (_distance < 15.0)
+    return 1u;
+  if (_distance < 30.0)
+    return 2u;
+  if (_distance < 60.0)
+    return 4u;
+  if (_distance < 120.0)
+    return 8u;
+  // Beyond this range the actor keeps its last pose.
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+bool RenderUtilPrivate::InsideSensorInterest(const math::Vector3d &_pos) const
+{
+  for (const auto &[sensorPos, radius] : this->sensorInterestVolumes)
+  {
+    if (_pos.DistanceTo(sensorPos) <= radius)
+      return true;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+void RenderUtilPrivate::PrefetchMeshes()
+{
+  for (const auto &visual : this->newVisuals)
+  {
+    const sdf::Visual &visualSdf = std::get<1>(visual);
+    if (!visualSdf.Geom() ||
+        visualSdf.Geom()->Type() != sdf::GeometryType::MESH)
+      continue;
+
+    const sdf::Mesh meshSdf = *visualSdf.Geom()->MeshShape();
+    // name:// meshes are already registered with the mesh manager
+    if (common::URI(meshSdf.Uri()).Scheme() == "name")
+      continue;
+
+    const std::string fullPath = asFullPath(meshSdf.Uri(), meshSdf.FilePath());
+    if (!this->prefetchedMeshPaths.insert(fullPath).second)
+      continue;
+
+    if (!this->meshPrefetchPool)
+      this->meshPrefetchPool = std::make_unique<common::WorkerPool>();
+
+    // The mesh manager serializes loads internally, so warming its cache
+    // here lets the rendering thread's CreateVisual resolve the mesh
+    // without touching the disk.
+    this->meshPrefetchPool->AddWork([meshSdf]()
+    {
+      loadMesh(meshSdf);
+    });
+  }
+}
+
+//////////////////////////////////////////////////
+void RenderUtilPrivate::WaitForMeshPrefetch()
+{
+  if (this->meshPrefetchPool)
+  {
+    GZ_PROFILE("RenderUtilPrivate::WaitForMeshPrefetch");
+    this->meshPrefetchPool->WaitForResults();
+  }
 }
 
 //////////////////////////////////////////////////
@@ -2415,6 +2795,7 @@ void RenderUtilPrivate::RemoveRenderingEntities(
         this->entityPoses.erase(_entity);
         this->actorAnimationData.erase(_entity);
         this->actorTransforms.erase(_entity);
+        this->actorPosedOnce.erase(_entity);
         this->trajectoryPoses.erase(_entity);
         return true;
       });
@@ -3843,6 +4224,9 @@ void RenderUtilPrivate::CreateVisual(
     }
   }
 
+  if (auto lodComp = _ecm.Component<components::Lod>(_entity))
+    this->newLods[_entity] = lodComp->Data();
+
   this->newVisuals.push_back(
       std::make_tuple(_entity, visual, _parent->Data()));
 
@@ -3865,4 +4249,6 @@ void RenderUtilPrivate::CreateLight(
 void RenderUtil::SetEventManager(EventManager *_mgr)
 {
   this->dataPtr->eventManager = _mgr;
+  this->dataPtr->sceneUpdateEvent =
+      _mgr ? &_mgr->Channel<events::SceneUpdate>() : nullptr;
 }
@@ -16,9 +16,11 @@
  */
 
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <queue>
+#include <sstream>
 #include <unordered_map>
 
 #include <sdf/Box.hh>
@@ -122,6 +124,38 @@ class gz::sim::SceneManagerPrivate
   /// \brief Map of sensor entity in Gazebo to sensor pointers.
   public: std::unordered_map<Entity, rendering::SensorPtr> sensors;
 
+  /// \brief Materials shared between visuals with identical definitions.
+  /// Key is a signature built from the SDF material and the per-visual
+  /// overrides applied at load time.
+  public: std::unordered_map<std::string, rendering::MaterialPtr>
+      sharedMaterials;
+
+  /// \brief Number of visuals created with each shared material, keyed by
+  /// the same signature as sharedMaterials.
+  public: std::unordered_map<std::string, unsigned int> sharedMaterialCounts;
+
+  /// \brief Level-of-detail state of one visual.
+  public: struct VisualLod
+  {
+    /// \brief Variants sorted by ascending activation distance.
+    std::vector<LodVariant> variants;
+
+    /// \brief Index into variants of the active variant, or -1 when the
+    /// visual's original geometry is shown.
+    int active{-1};
+
+    /// \brief The visual's original geometries, captured before the first
+    /// swap.
+    std::vector<rendering::GeometryPtr> originalGeoms;
+
+    /// \brief Lazily created geometry per variant index. A null entry marks
+    /// a variant whose mesh failed to load, so it is not retried.
+    std::map<int, rendering::GeometryPtr> variantGeoms;
+  };
+
+  /// \brief Level-of-detail state per visual entity.
+  public: std::unordered_map<Entity, VisualLod> lods;
+
   /// \brief The map of the original transparency values for the nodes.
   public: std::map<std::string, double> originalTransparency;
 
@@ -283,6 +317,50 @@ rendering::VisualPtr SceneManager::CreateLink(Entity _id,
   return linkVis;
 }
 
+/////////////////////////////////////////////////
+/// \brief Build a signature identifying a material definition together with
+/// the per-visual overrides applied when it is loaded. Visuals with equal
+/// signatures can share one rendering material.
+/// \param[in] _material Material sdf dom
+/// \param[in] _transparency Transparency of the visual the material is
+/// loaded for
+/// \param[in] _castShadows Cast shadows flag of the visual the material is
+/// loaded for
+/// \return Signature string
+static std::string materialSignature(const sdf::Material &_material,
+    double _transparency, bool _castShadows)
+{
+  std::ostringstream signature;
+  signature << _material.Ambient() << ";" << _material.Diffuse() << ";"
+            << _material.Specular() << ";" << _material.Shininess() << ";"
+            << _material.Emissive() << ";" << _material.RenderOrder() << ";"
+            << _material.DoubleSided() << ";" << _material.FilePath() << ";"
+            << _transparency << ";" << _castShadows;
+
+  const sdf::Pbr *pbr = _material.PbrMaterial();
+  if (pbr)
+  {
+    const sdf::PbrWorkflow *workflow =
+        pbr->Workflow(sdf::PbrWorkflowType::METAL);
+    if (!workflow)
+      workflow = pbr->Workflow(sdf::PbrWorkflowType::SPECULAR);
+    if (workflow)
+    {
+      signature << ";" << workflow->Roughness()
+                << ";" << workflow->Metalness()
+                << ";" << workflow->RoughnessMap()
+                << ";" << workflow->MetalnessMap()
+                << ";" << workflow->AlbedoMap()
+                << ";" << workflow->NormalMap()
+                << ";" << workflow->EnvironmentMap()
+                << ";" << workflow->EmissiveMap()
+                << ";" << workflow->LightMap()
+                << ";" << workflow->LightMapTexCoordSet();
+    }
+  }
+  return signature.str();
+}
+
 /////////////////////////////////////////////////
 rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
     const sdf::Visual &_visual, Entity _parentId)
@@ -354,13 +432,28 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
 
     // set material
     rendering::MaterialPtr material{nullptr};
+    std::string materialKey;
     if (_visual.Geom()->Type() == sdf::GeometryType::HEIGHTMAP)
     {
       // Heightmap's material is loaded together with it.
     }
     else if (_visual.Material())
     {
-      material = this->LoadMaterial(*_visual.Material());
+      // Identical material definitions are loaded once and shared between
+      // visuals, so worlds with many copies of the same model pay for the
+      // material only once.
+      materialKey = materialSignature(*_visual.Material(),
+          _visual.Transparency(), _visual.CastShadows());
+      auto matIt = this->dataPtr->sharedMaterials.find(materialKey);
+      if (matIt != this->dataPtr->sharedMaterials.end())
+      {
+        ++this->dataPtr->sharedMaterialCounts[materialKey];
+        geom->SetMaterial(matIt->second, false);
+      }
+      else
+      {
+        material = this->LoadMaterial(*_visual.Material());
+      }
     }
     // Don't set a default material for meshes because they
     // may have their own
@@ -413,12 +506,23 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
       // cast shadows
       material->SetCastShadows(_visual.CastShadows());
 
-      geom->SetMaterial(material);
-      // todo(anyone) SetMaterial function clones the input material.
-      // but does not take ownership of it so we need to destroy it here.
-      // This is not ideal. We should let gz-rendering handle the lifetime
-      // of this material
-      this->dataPtr->scene->DestroyMaterial(material);
+      if (!materialKey.empty())
+      {
+        // First visual created with this definition: keep the material
+        // alive so subsequent identical visuals can share it.
+        geom->SetMaterial(material, false);
+        this->dataPtr->sharedMaterials[materialKey] = material;
+        this->dataPtr->sharedMaterialCounts[materialKey] = 1u;
+      }
+      else
+      {
+        geom->SetMaterial(material);
+        // todo(anyone) SetMaterial function clones the input material.
+        // but does not take ownership of it so we need to destroy it here.
+        // This is not ideal. We should let gz-rendering handle the lifetime
+        // of this material
+        this->dataPtr->scene->DestroyMaterial(material);
+      }
     }
   }
   else
@@ -2064,6 +2168,7 @@ void SceneManager::RemoveEntity(Entity _id)
 
       this->dataPtr->scene->DestroyVisual(it->second);
       this->dataPtr->visuals.erase(it);
+      this->dataPtr->lods.erase(_id);
       return;
     }
   }
@@ -2138,6 +2243,174 @@ rendering::NodePtr SceneManager::TopLevelNode(
   return node;
 }
 
+////////////////////////////////////////////////
+rendering::MaterialPtr SceneManager::DetachSharedMaterial(
+    const rendering::GeometryPtr &_geom)
+{
+  if (!_geom)
+    return rendering::MaterialPtr();
+
+  auto material = _geom->Material();
+  if (!material)
+    return material;
+
+  for (const auto &[key, sharedMat] : this->dataPtr->sharedMaterials)
+  {
+    if (sharedMat == material)
+    {
+      // Give the geometry its own copy before it diverges from the shared
+      // definition.
+      _geom->SetMaterial(material, true);
+      auto countIt = this->dataPtr->sharedMaterialCounts.find(key);
+      if (countIt != this->dataPtr->sharedMaterialCounts.end() &&
+          countIt->second > 0u)
+      {
+        --countIt->second;
+      }
+      return _geom->Material();
+    }
+  }
+  return material;
+}
+
+/////////////////////////////////////////////////
+std::unordered_map<std::string, unsigned int>
+    SceneManager::MaterialInstanceCounts() const
+{
+  return this->dataPtr->sharedMaterialCounts;
+}
+
+/////////////////////////////////////////////////
+void SceneManager::SetVisualLod(Entity _id,
+    const std::vector<LodVariant> &_variants)
+{
+  if (_variants.empty())
+    return;
+
+  auto it = this->dataPtr->visuals.find(_id);
+  if (it == this->dataPtr->visuals.end())
+  {
+    // It is possible to get here if the visual entity is created then
+    // removed in between render updates.
+    return;
+  }
+
+  SceneManagerPrivate::VisualLod lod;
+  lod.variants = _variants;
+  this->dataPtr->lods[_id] = std::move(lod);
+}
+
+/////////////////////////////////////////////////
+unsigned int SceneManager::LodCount() const
+{
+  return this->dataPtr->lods.size();
+}
+
+/////////////////////////////////////////////////
+void SceneManager::UpdateLods(
+    const std::vector<math::Vector3d> &_cameraPositions)
+{
+  if (_cameraPositions.empty() || !this->dataPtr->scene)
+    return;
+
+  // Swapping within this band around an activation distance is suppressed
+  // so a camera hovering near a threshold does not flicker between levels.
+  const double kLodHysteresis = 0.1;
+
+  for (auto &[entity, lod] : this->dataPtr->lods)
+  {
+    auto visIt = this->dataPtr->visuals.find(entity);
+    if (visIt == this->dataPtr->visuals.end())
+      continue;
+    rendering::VisualPtr vis = visIt->second;
+
+    // The closest camera decides the detail level, so multi-camera setups
+    // degrade conservatively.
+    double dist = math::MAX_D;
+    for (const auto &camPos : _cameraPositions)
+    {
+      dist = std::min(dist, (vis->WorldPosition() - camPos).Length());
+    }
+
+    int target = -1;
+    for (auto i = 0u; i < lod.variants.size(); ++i)
+    {
+      if (dist >= lod.variants[i].minDistance)
+        target = static_cast<int>(i);
+    }
+    if (target == lod.active)
+      continue;
+
+    if (target > lod.active)
+    {
+      // Moving to a coarser variant: require the camera to be clearly past
+      // the activation distance being crossed.
+      if (dist < lod.variants[target].minDistance * (1.0 + kLodHysteresis))
+        continue;
+    }
+    else
+    {
+      // Moving to a finer variant: require the camera to be clearly below
+      // the active variant's activation distance.
+      if (dist > lod.variants[lod.active].minDistance * (1.0 - kLodHysteresis))
+        continue;
+    }
+
+    // Resolve the target geometry before detaching anything so a failed
+    // mesh load leaves the visual untouched.
+    rendering::GeometryPtr targetGeom;
+    if (target >= 0)
+    {
+      auto geomIt = lod.variantGeoms.find(target);
+      if (geomIt == lod.variantGeoms.end())
+      {
+        sdf::Mesh meshSdf;
+        meshSdf.SetUri(lod.variants[target].meshUri);
+        rendering::MeshDescriptor descriptor;
+        descriptor.mesh = loadMesh(meshSdf);
+        descriptor.meshName = lod.variants[target].meshUri;
+        if (descriptor.mesh)
+          targetGeom = this->dataPtr->scene->CreateMesh(descriptor);
+        if (!targetGeom)
+        {
+          gzerr << "Failed to load level-of-detail mesh ["
+                << lod.variants[target].meshUri << "] for visual ["
+                << vis->Name() << "]" << std::endl;
+        }
+        lod.variantGeoms[target] = targetGeom;
+      }
+      else
+      {
+        targetGeom = geomIt->second;
+      }
+      if (!targetGeom)
+        continue;
+    }
+
+    if (lod.originalGeoms.empty() && -1 == lod.active)
+    {
+      for (auto g = 0u; g < vis->GeometryCount(); ++g)
+        lod.originalGeoms.push_back(vis->GeometryByIndex(g));
+    }
+
+    // Detach the current geometries without destroying them so they can be
+    // reattached when the camera moves back.
+    while (vis->GeometryCount() > 0u)
+      vis->RemoveGeometry(vis->GeometryByIndex(0u));
+
+    if (target < 0)
+    {
+      for (const auto &geom : lod.originalGeoms)
+        vis->AddGeometry(geom);
+    }
+    else
+    {
+      vis->AddGeometry(targetGeom);
+    }
+    lod.active = target;
+  }
+}
+
 ////////////////////////////////////////////////
 void SceneManager::UpdateTransparency(const rendering::NodePtr &_node,
     bool _makeTransparent)
@@ -2200,6 +2473,9 @@ void SceneManager::UpdateTransparency(const rendering::NodePtr &_node,
     auto geomMat = geom->Material();
     if (nullptr == geomMat || visMat == geomMat)
       continue;
+    // Mutating a shared material would affect every visual created from
+    // the same definition, so detach to a private copy first.
+    geomMat = this->DetachSharedMaterial(geom);
     auto geomTransparency =
         this->dataPtr->originalTransparency.find(geom->Name());
     auto geomDepthWrite =
@@ -2571,6 +2847,9 @@ void SceneManager::Clear()
   this->dataPtr->particleEmitters.clear();
   this->dataPtr->projectors.clear();
   this->dataPtr->sensors.clear();
+  this->dataPtr->sharedMaterials.clear();
+  this->dataPtr->sharedMaterialCounts.clear();
+  this->dataPtr->lods.clear();
   this->dataPtr->scene.reset();
   this->dataPtr->originalTransparency.clear();
   this->dataPtr->originalDepthWrite.clear();
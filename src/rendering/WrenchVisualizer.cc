@@ -69,7 +69,9 @@ rendering::ArrowVisualPtr WrenchVisualizer::CreateForceVisual(
   }
   rendering::ArrowVisualPtr forceVisual =
     this->dataPtr->scene->CreateArrowVisual();
-  forceVisual->SetMaterial(_material);
+  // Share the caller's material instance instead of cloning one per arrow,
+  // so many arrows created from the same material stay in one render batch.
+  forceVisual->SetMaterial(_material, false);
   forceVisual->ShowArrowHead(true);
   forceVisual->ShowArrowShaft(true);
   forceVisual->ShowArrowRotation(false);
@@ -103,7 +105,8 @@ rendering::VisualPtr WrenchVisualizer::CreateTorqueVisual(
   auto torqueVisual = this->dataPtr->scene->CreateVisual();
   torqueVisual->AddChild(torqueTube);
   torqueVisual->AddChild(cylinder);
-  torqueVisual->SetMaterial(_material);
+  // Share the material instance, see CreateForceVisual.
+  torqueVisual->SetMaterial(_material, false);
   return torqueVisual;
 }
 
@@ -116,15 +119,20 @@ void WrenchVisualizer::UpdateVectorVisual(rendering::VisualPtr _visual,
 {
   math::Quaterniond quat;
   quat.SetFrom2Axes(math::Vector3d::UnitZ, _direction);
+
+  math::Vector3d position = _position;
   if (_tip)
   {
-    _visual->SetLocalPosition(
-      _position - 0.75 * _size * _direction.Normalized());
-  }
-  else
-  {
-    _visual->SetLocalPosition(_position);
+    position -= 0.75 * _size * _direction.Normalized();
   }
-  _visual->SetLocalRotation(quat);
-  _visual->SetLocalScale(_size);
+
+  // Only dirty the scene graph for values that actually changed; arrows
+  // that keep their pose between frames then cost nothing to update.
+  if (_visual->LocalPosition() != position)
+    _visual->SetLocalPosition(position);
+  if (_visual->LocalRotation() != quat)
+    _visual->SetLocalRotation(quat);
+  const math::Vector3d scale{_size, _size, _size};
+  if (_visual->LocalScale() != scale)
+    _visual->SetLocalScale(scale);
 }
@@ -20,6 +20,7 @@
  * Research Institute (MBARI) and the David and Lucile Packard Foundation
  */
 #include <unordered_map>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
 #include <gz/plugin/Register.hh>
@@ -87,6 +88,10 @@ class AcousticComms::Implementation
 
   /// \brief Seed value for random sampling.
   public: unsigned int seed = 0;
+
+  /// \brief Scratch list of bound modem entities, reused across steps to
+  /// avoid per-step allocation.
+  public: std::vector<Entity> modemEntities;
 };
 
 //////////////////////////////////////////////////
@@ -202,6 +207,17 @@ void AcousticComms::Step(
     }
   }
 
+  // Sample the world position of every bound modem once per step. Message
+  // processing below reads from this table, so the pose tree is walked once
+  // per modem instead of once per in-transit message.
+  this->dataPtr->modemEntities.clear();
+  for (auto & [address, content] : _currentRegistry)
+  {
+    if (content.entity != kNullEntity)
+      this->dataPtr->modemEntities.push_back(content.entity);
+  }
+  const auto modemPoses = worldPoses(this->dataPtr->modemEntities, _ecm);
+
   for (auto & [address, content] : _currentRegistry)
   {
     // Reference to the outbound queue for this address.
@@ -241,20 +257,15 @@ void AcousticComms::Step(
         // If it has reached neither the destination nor the maxRange,
         // it is considered in transit.
 
-        if (this->dataPtr->poseSrcAtMsgTimestamp.count(msg) == 0)
-        {
-          // This message is being processed for the first time.
-          // Record the current position of the sender and use it
-          // for distance calculations.
-          this->dataPtr->poseSrcAtMsgTimestamp[msg] =
-            worldPose(itSrc->second.entity, _ecm).Pos();
-        }
-
-        const auto& poseSrc =
-          this->dataPtr->poseSrcAtMsgTimestamp[msg];
+        // If this message is being processed for the first time, record the
+        // current position of the sender and use it for distance
+        // calculations.
+        const auto &poseSrc =
+          this->dataPtr->poseSrcAtMsgTimestamp.try_emplace(
+            msg, modemPoses.at(itSrc->second.entity).Pos()).first->second;
 
         // Calculate distance between the bodies.
-        const auto poseDst = worldPose(itDst->second.entity, _ecm).Pos();
+        const auto poseDst = modemPoses.at(itDst->second.entity).Pos();
         const auto distanceToTransmitter = (poseSrc - poseDst).Length();
 
         // Calculate distance covered by the message.
@@ -280,26 +291,30 @@ void AcousticComms::Step(
             // This message has effectively reached the destination.
             bool receivedSuccessfully = false;
 
-            // Check for time collision
-            if (this->dataPtr->lastMsgReceivedInfo.count(
-                  msg->dst_address()) == 0)
+            // Check for time collision. A single lookup serves both the
+            // collision check and the update below.
+            auto lastMsgIt =
+              this->dataPtr->lastMsgReceivedInfo.find(msg->dst_address());
+            if (lastMsgIt == this->dataPtr->lastMsgReceivedInfo.end())
             {
               // This is the first message received by this address.
               receivedSuccessfully = true;
+              lastMsgIt = this->dataPtr->lastMsgReceivedInfo.emplace(
+                msg->dst_address(), std::make_tuple(
+                  std::chrono::duration<double>::zero(),
+                  std::chrono::duration<double>::zero())).first;
             }
             else
             {
               // A previous msg was already received at this address.
               // time gap = current time - time at which last msg was received.
               std::chrono::duration<double> timeGap = currTimestamp -
-                std::get<0>(this->dataPtr->lastMsgReceivedInfo[
-                            msg->dst_address()]);
+                std::get<0>(lastMsgIt->second);
 
               // drop interval = collision time interval per byte *
               //                 length of last msg received.
               auto dropInterval = std::chrono::duration<double>(
-                  std::get<1>(this->dataPtr->lastMsgReceivedInfo[
-                              msg->dst_address()]));
+                  std::get<1>(lastMsgIt->second));
 
               if (timeGap >= dropInterval)
                 receivedSuccessfully = true;
@@ -326,7 +341,7 @@ void AcousticComms::Step(
                 this->dataPtr->collisionTimePerByte *
                 msg->data().length());
 
-              this->dataPtr->lastMsgReceivedInfo[msg->dst_address()] =
+              lastMsgIt->second =
                 std::make_tuple(currTimestamp, blockingTime);
             }
             else
@@ -336,8 +351,7 @@ void AcousticComms::Step(
                   this->dataPtr->collisionTimePacketDrop
                 );
 
-              std::get<1>(this->dataPtr->lastMsgReceivedInfo[
-                          msg->dst_address()]) += blockingTime;
+              std::get<1>(lastMsgIt->second) += blockingTime;
             }
 
             // Stop keeping track of the position of its source.
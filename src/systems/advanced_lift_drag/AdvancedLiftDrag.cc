@@ -274,6 +274,14 @@ class gz::sim::systems::AdvancedLiftDragPrivate
   /// \brief Link entity targeted this plugin.
   public: Entity linkEntity;
 
+  /// \brief Wind entity, resolved lazily on the first update. Scanning
+  /// for it every step is measurable with many surfaces.
+  public: Entity windEntity{kNullEntity};
+
+  /// \brief Scratch buffer for per-joint position lookups, reused across
+  /// updates to avoid a per-step allocation.
+  public: std::vector<components::JointPosition *> controlJointPositions;
+
   /// \brief Joint entity that actuates a control surface for this lifting body
   public: Entity controlJointEntity;
 
@@ -483,15 +491,17 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
       _ecm.Component<components::WorldPose>(this->linkEntity);
 
   // get wind as a component from the _ecm
+  if (this->windEntity == kNullEntity)
+    this->windEntity = _ecm.EntityByComponents(components::Wind());
   components::WorldLinearVelocity *windLinearVel = nullptr;
-  if(_ecm.EntityByComponents(components::Wind()) != kNullEntity){
-    Entity windEntity = _ecm.EntityByComponents(components::Wind());
+  if (this->windEntity != kNullEntity)
+  {
     windLinearVel =
-        _ecm.Component<components::WorldLinearVelocity>(windEntity);
+        _ecm.Component<components::WorldLinearVelocity>(this->windEntity);
   }
 
-  std::vector<components::JointPosition*> controlJointPosition_vec(
-    this->num_ctrl_surfaces);
+  auto &controlJointPosition_vec = this->controlJointPositions;
+  controlJointPosition_vec.assign(this->num_ctrl_surfaces, nullptr);
   // Generate a new vector that contains the current positions for all joints
   for(int i = 0; i < this->num_ctrl_surfaces; i++){
     components::JointPosition *controlJointPosition = nullptr;
@@ -509,10 +519,8 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
   const auto cpWorld = pose.Rot().RotateVector(this->cp);
   auto air_velocity = worldLinVel->Data() + worldAngVel->Data().Cross(
     cpWorld);
-  if (windLinearVel != nullptr){
-    air_velocity = worldLinVel->Data() + worldAngVel->Data().Cross(
-    cpWorld) - windLinearVel->Data();
-  }
+  if (windLinearVel != nullptr)
+    air_velocity -= windLinearVel->Data();
 
   // Define body frame: X forward, Z downward, Y out the right wing
   gz::math::Vector3d body_x_axis = pose.Rot().RotateVector(this->forward);
@@ -24,6 +24,7 @@
 #include <atomic>
 #include <deque>
 #include <functional>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -149,6 +150,17 @@ class gz::sim::systems::LinearBatteryPluginPrivate
   /// \brief Model interface
   public: Model model{kNullEntity};
 
+  /// \brief Joint entities of the model, cached for the drain-start scan
+  /// so the entity tree isn't traversed every step.
+  public: std::vector<Entity> jointEntities;
+
+  /// \brief Whether jointEntities has been populated.
+  public: bool jointEntitiesCached{false};
+
+  /// \brief Last total power load handed to the battery, used to skip
+  /// redundant SetPowerLoad calls when the load didn't change.
+  public: std::optional<double> lastTotalPowerLoad;
+
   /// \brief Gazebo communication node
   public: transport::Node node;
 
@@ -505,19 +517,29 @@ void LinearBatteryPlugin::PreUpdate(
       return true;
     });
 
-  bool success = this->dataPtr->battery->SetPowerLoad(
-      this->dataPtr->consumerId, total_power_load);
-  if (!success)
-      gzerr << "Failed to set consumer power load." << std::endl;
+  if (this->dataPtr->lastTotalPowerLoad != total_power_load)
+  {
+    bool success = this->dataPtr->battery->SetPowerLoad(
+        this->dataPtr->consumerId, total_power_load);
+    if (!success)
+        gzerr << "Failed to set consumer power load." << std::endl;
+    else
+        this->dataPtr->lastTotalPowerLoad = total_power_load;
+  }
 
   // Start draining the battery if the robot has started moving
   if (!this->dataPtr->startDraining)
   {
-    const std::vector<Entity> joints = _ecm.ChildrenByComponents(
-      this->dataPtr->model.Entity(),
-      components::Joint());
+    // The model's joints don't change, cache them on the first pass.
+    if (!this->dataPtr->jointEntitiesCached)
+    {
+      this->dataPtr->jointEntities = _ecm.ChildrenByComponents(
+        this->dataPtr->model.Entity(),
+        components::Joint());
+      this->dataPtr->jointEntitiesCached = true;
+    }
 
-    for (Entity jointEntity : joints)
+    for (Entity jointEntity : this->dataPtr->jointEntities)
     {
       const auto *jointVelocityCmd =
         _ecm.Component<components::JointVelocityCmd>(jointEntity);
@@ -626,6 +648,10 @@ void LinearBatteryPlugin::PostUpdate(const UpdateInfo &_info,
   if (!this->dataPtr->battery)
     return;
 
+  // Don't construct the message if no one is listening.
+  if (!this->dataPtr->statePub.HasConnections())
+    return;
+
   // Publish battery state
   msgs::BatteryState msg;
   msg.mutable_header()->mutable_stamp()->CopyFrom(
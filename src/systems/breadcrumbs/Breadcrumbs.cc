@@ -115,6 +115,10 @@ void Breadcrumbs::Configure(const Entity &_entity,
     return;
   }
 
+  // Copy the template once; deployments only rewrite the name and pose.
+  this->modelToSpawn = *this->modelRoot.Model();
+  this->modelToSpawnRawPose = this->modelToSpawn.RawPose();
+
   if (_sdf->HasElement("performer_volume"))
   {
     auto vol = _sdf->GetElementImpl("performer_volume");
@@ -203,22 +207,17 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
       if (this->maxDeployments < 0 ||
           this->numDeployments < this->maxDeployments)
       {
-        sdf::Model modelToSpawn = *this->modelRoot.Model();
-        std::string desiredName =
-            modelToSpawn.Name() + "_" + std::to_string(this->numDeployments);
-
-        std::vector<std::string> modelNames;
-        _ecm.Each<components::Name, components::Model>(
-            [&modelNames](const Entity &, const components::Name *_name,
-                          const components::Model *)
-            {
-              modelNames.push_back(_name->Data());
-              return true;
-            });
+        sdf::Model &modelToSpawn = this->modelToSpawn;
+        std::string desiredName = this->modelRoot.Model()->Name() + "_" +
+            std::to_string(this->numDeployments);
 
         // Check if there's a model with the same name.
-        auto it = std::find(modelNames.begin(), modelNames.end(), desiredName);
-        if (it != modelNames.end())
+        auto nameTaken = [&_ecm](const std::string &_name)
+        {
+          return kNullEntity != _ecm.EntityByComponents(
+              components::Name(_name), components::Model());
+        };
+        if (nameTaken(desiredName))
         {
           if (!this->allowRenaming)
           {
@@ -231,8 +230,7 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
 
           std::string newName = desiredName;
           int counter = 0;
-          while (std::find(modelNames.begin(), modelNames.end(), newName) !=
-                 modelNames.end())
+          while (nameTaken(newName))
           {
             newName = desiredName + "_" + std::to_string(++counter);
           }
@@ -240,7 +238,7 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
         }
 
         modelToSpawn.SetName(desiredName);
-        modelToSpawn.SetRawPose(poseComp->Data() * modelToSpawn.RawPose());
+        modelToSpawn.SetRawPose(poseComp->Data() * this->modelToSpawnRawPose);
         gzmsg << "Deploying " << modelToSpawn.Name() << " at "
                << modelToSpawn.RawPose() << std::endl;
         Entity entity = this->creator->CreateEntities(&modelToSpawn);
@@ -137,6 +137,15 @@ namespace systems
     /// \brief sdf::Root of the model to be deployed
     private: sdf::Root modelRoot;
 
+    /// \brief Reusable copy of the breadcrumb model template. Kept as a
+    /// member so each deployment only updates the name and pose instead of
+    /// deep-copying the whole model description.
+    private: sdf::Model modelToSpawn;
+
+    /// \brief Raw pose of the breadcrumb template, saved before the pose
+    /// is overwritten by the first deployment.
+    private: math::Pose3d modelToSpawnRawPose;
+
     /// \brief Whether the deployed models will be performers
     private: bool isPerformer{false};
 
@@ -16,8 +16,11 @@
  */
 #include <gz/msgs/wrench.pb.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -77,17 +80,63 @@ class gz::sim::systems::BuoyancyPrivate
   /// \return The fluid density at the givein pose.
   public: double UniformFluidDensity(const math::Pose3d &_pose) const;
 
+  /// \brief Precomputed submerged volume and first moment of volume for a
+  /// collision shape, sampled against horizontal slicing planes when the
+  /// shape is first seen. Per-step graded buoyancy then reduces to a table
+  /// interpolation keyed by depth instead of re-deriving the analytic
+  /// submerged-volume integrals for every collision every step. Like the
+  /// analytic path it replaces, the slicing plane is expressed in the shape
+  /// frame and the shape's orientation is ignored (see the TODO about
+  /// transforming the plane).
+  public: struct ShapeDepthTable
+  {
+    /// \brief Plane offset, in the shape frame, of the first sample. At or
+    /// below this depth the shape is entirely above the fluid.
+    public: double minDepth;
+
+    /// \brief Distance between consecutive samples.
+    public: double step;
+
+    /// \brief Submerged volume at each sampled plane offset.
+    public: std::vector<double> volumes;
+
+    /// \brief First moment of the submerged volume (volume times center of
+    /// volume, in the shape frame) at each sampled plane offset. Moments
+    /// interpolate more smoothly than the center of volume itself.
+    public: std::vector<math::Vector3d> moments;
+
+    /// \brief Interpolated submerged volume below the given plane offset.
+    /// \param[in] _depth Plane offset in the shape frame.
+    /// \return Submerged volume, clamped to [0, full volume].
+    public: double VolumeBelow(double _depth) const;
+
+    /// \brief Interpolated center of the submerged volume below the given
+    /// plane offset.
+    /// \param[in] _depth Plane offset in the shape frame.
+    /// \return Center of volume in the shape frame, or nullopt if the
+    /// submerged volume is zero.
+    public: std::optional<math::Vector3d> CenterOfVolumeBelow(
+        double _depth) const;
+  };
+
+  /// \brief Build the depth table for a shape by sampling its analytic
+  /// submerged-volume integrals across its vertical extent.
+  /// \param[in] _shape The collision shape. Currently must be box or sphere.
+  /// \param[in] _halfExtent Half of the shape's extent along the slicing
+  /// axis.
+  /// \return The sampled table.
+  public:
+  template<typename T>
+  static ShapeDepthTable BuildDepthTable(const T &_shape, double _halfExtent);
+
   /// \brief Get the resultant buoyant force on a shape.
   /// \param[in] _pose World pose of the shape's origin.
-  /// \param[in] _shape The collision mesh of a shape. Currently must
-  /// be box or sphere.
+  /// \param[in] _table Depth table precomputed for the shape.
   /// \param[in] _gravity Gravity acceleration in the world frame.
   /// Updates this->buoyancyForces containing {force, center_of_volume} to be
   /// applied on the link.
-  public:
-  template<typename T>
-  void GradedFluidDensity(
-    const math::Pose3d &_pose, const T &_shape, const math::Vector3d &_gravity);
+  public: void GradedFluidDensity(const math::Pose3d &_pose,
+    const ShapeDepthTable &_table, const math::Vector3d &_gravity);
 
   /// \brief Check for new links to apply buoyancy forces to. Calculates the
   /// volume and center of volume for every new link and stages them to be
@@ -160,18 +209,105 @@ class gz::sim::systems::BuoyancyPrivate
 
   /// \brief Volumes to be added on the next.
   public: std::unordered_map<Entity, double> volumes;
+
+  /// \brief Depth tables built per collision entity, keyed by the collision
+  /// entity. Built when the collision is first processed and reused every
+  /// step after.
+  public: std::unordered_map<Entity, ShapeDepthTable> depthTables;
 };
 
+/// \brief Number of depth samples per shape table. Submerged volume is a
+/// smooth function of depth, so the interpolation error at this resolution
+/// is far below the forces' other approximations.
+static constexpr std::size_t kDepthTableSamples = 256;
+
 //////////////////////////////////////////////////
 double BuoyancyPrivate::UniformFluidDensity(const math::Pose3d &/*_pose*/) const
 {
   return this->fluidDensity;
 }
 
+//////////////////////////////////////////////////
+double BuoyancyPrivate::ShapeDepthTable::VolumeBelow(double _depth) const
+{
+  if (_depth <= this->minDepth)
+    return 0.0;
+
+  const double maxDepth =
+    this->minDepth + this->step * static_cast<double>(this->volumes.size() - 1);
+  if (_depth >= maxDepth)
+    return this->volumes.back();
+
+  const double pos = (_depth - this->minDepth) / this->step;
+  const auto index = static_cast<std::size_t>(pos);
+  const double frac = pos - static_cast<double>(index);
+  return this->volumes[index] * (1.0 - frac) +
+         this->volumes[index + 1] * frac;
+}
+
+//////////////////////////////////////////////////
+std::optional<math::Vector3d> BuoyancyPrivate::ShapeDepthTable::
+  CenterOfVolumeBelow(double _depth) const
+{
+  const double vol = this->VolumeBelow(_depth);
+  if (vol <= 0)
+    return std::nullopt;
+
+  const double maxDepth =
+    this->minDepth + this->step * static_cast<double>(this->moments.size() - 1);
+  math::Vector3d moment;
+  if (_depth >= maxDepth)
+  {
+    moment = this->moments.back();
+  }
+  else
+  {
+    const double pos = (_depth - this->minDepth) / this->step;
+    const auto index = static_cast<std::size_t>(pos);
+    const double frac = pos - static_cast<double>(index);
+    moment = this->moments[index] * (1.0 - frac) +
+             this->moments[index + 1] * frac;
+  }
+  return moment / vol;
+}
+
 //////////////////////////////////////////////////
 template<typename T>
-void BuoyancyPrivate::GradedFluidDensity(
-  const math::Pose3d &_pose, const T &_shape, const math::Vector3d &_gravity)
+BuoyancyPrivate::ShapeDepthTable BuoyancyPrivate::BuildDepthTable(
+  const T &_shape, double _halfExtent)
+{
+  ShapeDepthTable table;
+  table.minDepth = -_halfExtent;
+  table.step = 2.0 * _halfExtent /
+    static_cast<double>(kDepthTableSamples - 1);
+  table.volumes.reserve(kDepthTableSamples);
+  table.moments.reserve(kDepthTableSamples);
+
+  for (std::size_t i = 0; i < kDepthTableSamples; ++i)
+  {
+    const double depth = table.minDepth + table.step * static_cast<double>(i);
+    // TODO(arjo): Transform plane and slice the shape
+    math::Planed plane{math::Vector3d{0, 0, 1}, depth};
+    const double vol = std::max(_shape.VolumeBelow(plane), 0.0);
+    const auto cov = _shape.CenterOfVolumeBelow(plane);
+    table.volumes.push_back(vol);
+    table.moments.push_back(
+      cov.has_value() ? vol * cov.value() : math::Vector3d::Zero);
+  }
+
+  // Pin the endpoints to the exact analytic values so the fully emerged and
+  // fully submerged cases match the closed-form results.
+  table.volumes.front() = 0.0;
+  table.moments.front() = math::Vector3d::Zero;
+  table.volumes.back() = _shape.Volume();
+  table.moments.back() = math::Vector3d::Zero;
+
+  return table;
+}
+
+//////////////////////////////////////////////////
+void BuoyancyPrivate::GradedFluidDensity(const math::Pose3d &_pose,
+  const ShapeDepthTable &_table, const math::Vector3d &_gravity)
 {
   auto prevLayerFluidDensity = this->fluidDensity;
   auto prevLayerVol = 0.0;
@@ -179,9 +315,7 @@ void BuoyancyPrivate::GradedFluidDensity(
 
   for (const auto &[height, currFluidDensity] : this->layers)
   {
-    // TODO(arjo): Transform plane and slice the shape
-    math::Planed plane{math::Vector3d{0, 0, 1}, height - _pose.Pos().Z()};
-    auto vol = _shape.VolumeBelow(plane);
+    auto vol = _table.VolumeBelow(height - _pose.Pos().Z());
 
     // Short circuit.
     if (vol <= 0)
@@ -191,7 +325,7 @@ void BuoyancyPrivate::GradedFluidDensity(
     }
 
     // Calculate point from which force is applied
-    auto cov = _shape.CenterOfVolumeBelow(plane);
+    auto cov = _table.CenterOfVolumeBelow(height - _pose.Pos().Z());
 
     if (!cov.has_value())
     {
@@ -219,7 +353,7 @@ void BuoyancyPrivate::GradedFluidDensity(
     prevLayerVol = vol;
   }
   // For the rest of the layers.
-  auto vol = _shape.Volume();
+  auto vol = _table.volumes.back();
 
   // No force contributed by this layer.
   if (std::abs(vol - prevLayerVol) < 1e-10)
@@ -594,32 +728,49 @@ void Buoyancy::PreUpdate(const UpdateInfo &_info,
             continue;
           }
 
-          switch (coll->Data().Geom()->Type())
+          // Build the shape's depth table on first sight, then interpolate
+          // it on every subsequent step.
+          auto tableIt = this->dataPtr->depthTables.find(e);
+          if (tableIt == this->dataPtr->depthTables.end())
           {
-            case sdf::GeometryType::BOX:
-              this->dataPtr->GradedFluidDensity<math::Boxd>(
-                pose,
-                coll->Data().Geom()->BoxShape()->Shape(),
-                gravity->Data());
-              break;
-            case sdf::GeometryType::SPHERE:
-              this->dataPtr->GradedFluidDensity<math::Sphered>(
-                pose,
-                coll->Data().Geom()->SphereShape()->Shape(),
-                gravity->Data());
-              break;
-            default:
+            switch (coll->Data().Geom()->Type())
             {
-              static bool warned{false};
-              if (!warned)
+              case sdf::GeometryType::BOX:
+              {
+                const auto &shape = coll->Data().Geom()->BoxShape()->Shape();
+                tableIt = this->dataPtr->depthTables.emplace(e,
+                  BuoyancyPrivate::BuildDepthTable(shape,
+                    shape.Size().Z() / 2)).first;
+                break;
+              }
+              case sdf::GeometryType::SPHERE:
               {
-                gzwarn << "Only <box> and <sphere> collisions are supported "
-                  << "by the graded buoyancy option." << std::endl;
-                warned = true;
+                const auto &shape =
+                  coll->Data().Geom()->SphereShape()->Shape();
+                tableIt = this->dataPtr->depthTables.emplace(e,
+                  BuoyancyPrivate::BuildDepthTable(shape,
+                    shape.Radius())).first;
+                break;
+              }
+              default:
+              {
+                static bool warned{false};
+                if (!warned)
+                {
+                  gzwarn << "Only <box> and <sphere> collisions are supported "
+                    << "by the graded buoyancy option." << std::endl;
+                  warned = true;
+                }
+                break;
               }
-              break;
             }
           }
+
+          if (tableIt != this->dataPtr->depthTables.end())
+          {
+            this->dataPtr->GradedFluidDensity(
+              pose, tableIt->second, gravity->Data());
+          }
         }
         auto [force, torque] = this->dataPtr->ResolveForces(linkWorldPose);
         // Apply the wrench to the link. This wrench is applied in the
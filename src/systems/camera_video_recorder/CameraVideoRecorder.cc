@@ -20,9 +20,12 @@
 #include <gz/msgs/time.pb.h>
 #include <gz/msgs/video_record.pb.h>
 
+#include <condition_variable>
+#include <mutex>
 #include <regex>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <gz/common/Profiler.hh>
@@ -68,6 +71,20 @@ class gz::sim::systems::CameraVideoRecorderPrivate
   /// \brief Callback for new images
   public: void OnImage(const msgs::Image &_msg);
 
+  /// \brief Destructor. Stops the encoder thread if it is still running.
+  public: ~CameraVideoRecorderPrivate();
+
+  /// \brief Starts the encoder worker thread.
+  public: void StartEncoderThread();
+
+  /// \brief Stops and joins the encoder worker thread, draining any staged
+  /// frame first.
+  public: void StopEncoderThread();
+
+  /// \brief Worker loop that feeds staged frames to the video encoder so
+  /// the encode cost stays off the rendering thread.
+  public: void EncoderLoop();
+
   /// \brief Transport node
   public: transport::Node node;
 
@@ -142,8 +159,118 @@ class gz::sim::systems::CameraVideoRecorderPrivate
 
   /// \brief Marker manager
   public: MarkerManager markerManager;
+
+  /// \brief Frame staged for the encoder thread. Double-buffered with
+  /// cameraImage: the rendering thread writes into one buffer while the
+  /// encoder thread reads the other, so neither ever blocks on the
+  /// encode itself.
+  public: rendering::Image encodeImage;
+
+  /// \brief Timestamp of the staged frame.
+  public: std::chrono::steady_clock::time_point encodeFrameTime;
+
+  /// \brief Dimensions of the staged frame.
+  public: unsigned int encodeFrameWidth = 0;
+  public: unsigned int encodeFrameHeight = 0;
+
+  /// \brief Worker thread running EncoderLoop.
+  public: std::thread encoderThread;
+
+  /// \brief Protects the staged frame and the flags below.
+  public: std::mutex encodeMutex;
+
+  /// \brief Signals the encoder thread that a frame is staged.
+  public: std::condition_variable encodeCv;
+
+  /// \brief True while a staged frame is waiting for the encoder thread.
+  /// When the encoder can't keep up, new frames are dropped instead of
+  /// stalling the rendering thread.
+  public: bool frameReady = false;
+
+  /// \brief Tells the encoder thread to exit.
+  public: bool stopEncoder = false;
 };
 
+//////////////////////////////////////////////////
+CameraVideoRecorderPrivate::~CameraVideoRecorderPrivate()
+{
+  this->StopEncoderThread();
+}
+
+//////////////////////////////////////////////////
+void CameraVideoRecorderPrivate::StartEncoderThread()
+{
+  if (this->encoderThread.joinable())
+    return;
+  this->stopEncoder = false;
+  this->frameReady = false;
+  this->encoderThread =
+      std::thread(&CameraVideoRecorderPrivate::EncoderLoop, this);
+}
+
+//////////////////////////////////////////////////
+void CameraVideoRecorderPrivate::StopEncoderThread()
+{
+  if (!this->encoderThread.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(this->encodeMutex);
+    this->stopEncoder = true;
+  }
+  this->encodeCv.notify_one();
+  this->encoderThread.join();
+}
+
+//////////////////////////////////////////////////
+void CameraVideoRecorderPrivate::EncoderLoop()
+{
+  while (true)
+  {
+    rendering::Image frame;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    std::chrono::steady_clock::time_point t;
+    {
+      std::unique_lock<std::mutex> lock(this->encodeMutex);
+      this->encodeCv.wait(lock,
+          [this] { return this->frameReady || this->stopEncoder; });
+      if (!this->frameReady)
+        break;
+      // The image object shares its buffer; the rendering thread writes
+      // into the other buffer until frameReady is set again.
+      frame = this->encodeImage;
+      width = this->encodeFrameWidth;
+      height = this->encodeFrameHeight;
+      t = this->encodeFrameTime;
+      this->frameReady = false;
+    }
+
+    bool frameAdded = this->videoEncoder.AddFrame(
+        frame.Data<unsigned char>(), width, height, t);
+
+    if (frameAdded)
+    {
+      // publish recorder stats
+      if (this->recordStartTime ==
+          std::chrono::steady_clock::time_point(
+            std::chrono::duration(std::chrono::seconds(0))))
+      {
+        // start time, i.e. time when first frame is added
+        this->recordStartTime = t;
+      }
+
+      std::chrono::steady_clock::duration dt;
+      dt = t - this->recordStartTime;
+      int64_t sec, nsec;
+      std::tie(sec, nsec) = math::durationToSecNsec(dt);
+      msgs::Time msg;
+      msg.set_sec(sec);
+      msg.set_nsec(nsec);
+      this->recorderStatsPub.Publish(msg);
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 void CameraVideoRecorderPrivate::OnImage(const msgs::Image &)
 {
@@ -336,35 +463,26 @@ void CameraVideoRecorderPrivate::OnPostRender()
     // Video recorder is on. Add more frames to it
     if (this->videoEncoder.IsEncoding())
     {
-      this->camera->Copy(this->cameraImage);
       std::chrono::steady_clock::time_point t;
       if (this->recordVideoUseSimTime)
         t = std::chrono::steady_clock::time_point(this->simTime);
       else
         t = std::chrono::steady_clock::now();
 
-      bool frameAdded = this->videoEncoder.AddFrame(
-          this->cameraImage.Data<unsigned char>(), width, height, t);
-
-      if (frameAdded)
+      // Stage the frame for the encoder thread. If the previous frame is
+      // still being encoded, drop this one instead of stalling the
+      // rendering thread.
+      std::unique_lock<std::mutex> frameLock(this->encodeMutex);
+      if (!this->frameReady)
       {
-        // publish recorder stats
-        if (this->recordStartTime ==
-            std::chrono::steady_clock::time_point(
-              std::chrono::duration(std::chrono::seconds(0))))
-        {
-          // start time, i.e. time when first frame is added
-          this->recordStartTime = t;
-        }
-
-        std::chrono::steady_clock::duration dt;
-        dt = t - this->recordStartTime;
-        int64_t sec, nsec;
-        std::tie(sec, nsec) = math::durationToSecNsec(dt);
-        msgs::Time msg;
-        msg.set_sec(sec);
-        msg.set_nsec(nsec);
-        this->recorderStatsPub.Publish(msg);
+        this->camera->Copy(this->cameraImage);
+        std::swap(this->cameraImage, this->encodeImage);
+        this->encodeFrameWidth = width;
+        this->encodeFrameHeight = height;
+        this->encodeFrameTime = t;
+        this->frameReady = true;
+        frameLock.unlock();
+        this->encodeCv.notify_one();
       }
     }
     // Video recorder is idle. Start recording.
@@ -385,6 +503,8 @@ void CameraVideoRecorderPrivate::OnPostRender()
       this->recordStartTime = std::chrono::steady_clock::time_point(
             std::chrono::duration(std::chrono::seconds(0)));
 
+      this->StartEncoderThread();
+
       gzmsg << "Start video recording on [" << this->service << "]. "
              << "Encoding to tmp file: ["
              << this->tmpVideoFilename << "]" << std::endl;
@@ -396,7 +516,9 @@ void CameraVideoRecorderPrivate::OnPostRender()
     // other connections
     this->node.Unsubscribe(this->sensorTopic);
 
-    // stop encoding
+    // stop encoding; drain the staged frame first so the last frame isn't
+    // lost
+    this->StopEncoderThread();
     this->videoEncoder.Stop();
 
     gzmsg << "Stop video recording on [" << this->service << "]." << std::endl;
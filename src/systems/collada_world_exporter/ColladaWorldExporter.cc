@@ -16,6 +16,7 @@
  */
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/plugin/Register.hh>
@@ -44,6 +45,7 @@
 #include <gz/common/Mesh.hh>
 #include <gz/common/SubMesh.hh>
 
+#include <gz/math/Helpers.hh>
 #include <gz/math/Matrix4.hh>
 
 #include <gz/common/ColladaExporter.hh>
@@ -81,6 +83,29 @@ class gz::sim::systems::ColladaWorldExporterPrivate
       return true;
     });
 
+    // Deduplicate materials with identical properties. Visuals without a
+    // material component would otherwise each add their own copy to the
+    // world mesh, bloating the exported document with one material per
+    // visual.
+    std::vector<std::pair<common::MaterialPtr, int>> materialCache;
+    auto findOrAddMaterial = [&](const common::MaterialPtr &_mat) -> int
+    {
+      for (const auto &[cached, index] : materialCache)
+      {
+        if (cached->Diffuse() == _mat->Diffuse() &&
+            cached->Ambient() == _mat->Ambient() &&
+            cached->Emissive() == _mat->Emissive() &&
+            cached->Specular() == _mat->Specular() &&
+            math::equal(cached->Transparency(), _mat->Transparency()))
+        {
+          return index;
+        }
+      }
+      int index = worldMesh.AddMaterial(_mat);
+      materialCache.push_back({_mat, index});
+      return index;
+    };
+
     _ecm.Each<components::Visual,
             components::Name,
             components::Geometry,
@@ -128,11 +153,12 @@ class gz::sim::systems::ColladaWorldExporterPrivate
         }
         else
         {
-          newMatIndex = worldMesh.AddMaterial(mat);
+          newMatIndex = findOrAddMaterial(mat);
         }
 
-        subm.lock()->SetMaterialIndex(newMatIndex);
-        subm.lock()->Scale(scale);
+        auto submesh = subm.lock();
+        submesh->SetMaterialIndex(newMatIndex);
+        submesh->Scale(scale);
         subMeshMatrix.push_back(matrix);
       };
 
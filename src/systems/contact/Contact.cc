@@ -59,7 +59,7 @@ class ContactSensor
   /// \brief Add contacts to the list to be published
   /// \param[in] _stamp Time stamp of the sensor measurement
   /// \param[in] _contacts A contact message to be added to the list
-  public: void AddContacts(const std::chrono::steady_clock::duration &_stamp,
+  public: void AddContacts(const msgs::Time &_stamp,
                            const msgs::Contacts &_contacts);
 
   /// \brief Publish sensor data over gz transport
@@ -68,9 +68,13 @@ class ContactSensor
   /// \brief Topic to publish data to
   public: std::string topic;
 
-  /// \brief Message to publish
+  /// \brief Message to publish. Reused across steps so repeated contact
+  /// entries keep their allocations.
   public: msgs::Contacts contactsMsg;
 
+  /// \brief Number of contact entries filled in contactsMsg this step.
+  public: int usedContacts{0};
+
   /// \brief Gazebo transport node
   public: transport::Node node;
 
@@ -128,28 +132,38 @@ void ContactSensor::Load(const sdf::ElementPtr &_sdf, const std::string &_topic,
 
 //////////////////////////////////////////////////
 void ContactSensor::AddContacts(
-    const std::chrono::steady_clock::duration &_stamp,
+    const msgs::Time &_stamp,
     const msgs::Contacts &_contacts)
 {
-  auto stamp = convert<msgs::Time>(_stamp);
   for (const auto &contact : _contacts.contact())
   {
-    auto *newContact = this->contactsMsg.add_contact();
+    // Overwrite an entry left over from the previous step when available so
+    // the message's allocations are reused instead of freed and reacquired.
+    auto *newContact =
+        this->usedContacts < this->contactsMsg.contact_size() ?
+        this->contactsMsg.mutable_contact(this->usedContacts) :
+        this->contactsMsg.add_contact();
+    ++this->usedContacts;
     newContact->CopyFrom(contact);
-    newContact->mutable_header()->mutable_stamp()->CopyFrom(stamp);
+    newContact->mutable_header()->mutable_stamp()->CopyFrom(_stamp);
   }
 
-  this->contactsMsg.mutable_header()->mutable_stamp()->CopyFrom(stamp);
+  this->contactsMsg.mutable_header()->mutable_stamp()->CopyFrom(_stamp);
 }
 
 //////////////////////////////////////////////////
 void ContactSensor::Publish()
 {
   // Only publish if there are contacts
-  if (this->contactsMsg.contact_size() > 0)
+  if (this->usedContacts > 0)
   {
+    // Drop stale entries from a previous, larger step. RemoveLast keeps the
+    // removed entries cached inside the message for later reuse.
+    while (this->contactsMsg.contact_size() > this->usedContacts)
+      this->contactsMsg.mutable_contact()->RemoveLast();
+
     this->pub.Publish(this->contactsMsg);
-    this->contactsMsg.Clear();
+    this->usedContacts = 0;
   }
 }
 
@@ -216,8 +230,13 @@ void ContactPrivate::UpdateSensors(const UpdateInfo &_info,
                                    const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("ContactPrivate::UpdateSensors");
+  auto stamp = convert<msgs::Time>(_info.simTime);
   for (const auto &item : this->entitySensorMap)
   {
+    // Don't build messages nobody is listening to.
+    if (!item.second->pub.HasConnections())
+      continue;
+
     for (const Entity &entity : item.second->collisionEntities)
     {
       auto contacts = _ecm.Component<components::ContactSensorData>(entity);
@@ -226,7 +245,7 @@ void ContactPrivate::UpdateSensors(const UpdateInfo &_info,
       // this entity is in the collisionEntities list
       if (contacts->Data().contact_size() > 0)
       {
-        item.second->AddContacts(_info.simTime, contacts->Data());
+        item.second->AddContacts(stamp, contacts->Data());
       }
     }
   }
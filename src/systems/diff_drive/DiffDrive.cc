@@ -24,10 +24,12 @@
 #include <gz/msgs/time.pb.h>
 #include <gz/msgs/twist.pb.h>
 
+#include <cstddef>
 #include <limits>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -60,6 +62,28 @@ struct Commands
   Commands() : lin(0.0), ang(0.0) {}
 };
 
+//////////////////////////////////////////////////
+/// \brief Append or overwrite one joint's velocity command in a reused
+/// batch, recycling the slot's storage when the slot already exists.
+/// \param[in, out] _batch Batch of joint velocity commands.
+/// \param[in] _index Slot to write.
+/// \param[in] _joint Joint entity.
+/// \param[in] _speed Joint speed to command.
+static void SetWheelCmdBatchEntry(
+    std::vector<std::pair<Entity, std::vector<double>>> &_batch,
+    std::size_t _index, Entity _joint, double _speed)
+{
+  if (_index < _batch.size())
+  {
+    _batch[_index].first = _joint;
+    _batch[_index].second.assign(1, _speed);
+  }
+  else
+  {
+    _batch.emplace_back(_joint, std::vector<double>{_speed});
+  }
+}
+
 class gz::sim::systems::DiffDrivePrivate
 {
   /// \brief Callback for velocity subscription
@@ -114,9 +138,22 @@ class gz::sim::systems::DiffDrivePrivate
   /// \brief Model interface
   public: Model model{kNullEntity};
 
+  /// \brief Model name, cached on Configure so per-step code doesn't
+  /// re-fetch the name component.
+  public: std::string modelName;
+
   /// \brief The model's canonical link.
   public: Link canonicalLink{kNullEntity};
 
+  /// \brief Reused batch of wheel joint velocity commands, written to the
+  /// ECM in a single call each step.
+  public: std::vector<std::pair<Entity, std::vector<double>>>
+    wheelVelocityCmdBatch;
+
+  /// \brief Whether the joint position components used for odometry have
+  /// been created.
+  public: bool jointPosComponentsCreated{false};
+
   /// \brief Update period calculated from <odom__publish_frequency>.
   public: std::chrono::steady_clock::duration odomPubPeriod{0};
 
@@ -187,6 +224,8 @@ void DiffDrive::Configure(const Entity &_entity,
     return;
   }
 
+  this->dataPtr->modelName = this->dataPtr->model.Name(_ecm);
+
   // Get params from SDF
   auto sdfElem = _sdf->FindElement("left_joint");
   while (sdfElem)
@@ -338,7 +377,7 @@ void DiffDrive::Configure(const Entity &_entity,
   {
     topics.push_back(_sdf->Get<std::string>("topic"));
   }
-  topics.push_back("/model/" + this->dataPtr->model.Name(_ecm) + "/cmd_vel");
+  topics.push_back("/model/" + this->dataPtr->modelName + "/cmd_vel");
   auto topic = validTopic(topics);
 
   this->dataPtr->node.Subscribe(topic, &DiffDrivePrivate::OnCmdVel,
@@ -347,7 +386,7 @@ void DiffDrive::Configure(const Entity &_entity,
   // Subscribe to enable/disable
   std::vector<std::string> enableTopics;
   enableTopics.push_back(
-    "/model/" + this->dataPtr->model.Name(_ecm) + "/enable");
+    "/model/" + this->dataPtr->modelName + "/enable");
   auto enableTopic = validTopic(enableTopics);
 
   if (!enableTopic.empty())
@@ -362,14 +401,14 @@ void DiffDrive::Configure(const Entity &_entity,
   {
     odomTopics.push_back(_sdf->Get<std::string>("odom_topic"));
   }
-  odomTopics.push_back("/model/" + this->dataPtr->model.Name(_ecm) +
+  odomTopics.push_back("/model/" + this->dataPtr->modelName +
       "/odometry");
   auto odomTopic = validTopic(odomTopics);
 
   this->dataPtr->odomPub = this->dataPtr->node.Advertise<msgs::Odometry>(
       odomTopic);
 
-  std::string tfTopic{"/model/" + this->dataPtr->model.Name(_ecm) +
+  std::string tfTopic{"/model/" + this->dataPtr->modelName +
     "/tf"};
   if (_sdf->HasElement("tf_topic"))
     tfTopic = _sdf->Get<std::string>("tf_topic");
@@ -402,7 +441,7 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
 
   // If the joints haven't been identified yet, look for them
   static std::set<std::string> warnedModels;
-  auto modelName = this->dataPtr->model.Name(_ecm);
+  const std::string &modelName = this->dataPtr->modelName;
   if (this->dataPtr->leftJoints.empty() ||
       this->dataPtr->rightJoints.empty())
   {
@@ -452,15 +491,19 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
   if (_info.paused)
     return;
 
+  // Gather the wheel velocity commands into a reused batch and write them
+  // in one call, so the component change tracking is resolved once per
+  // step instead of once per joint.
+  auto &batch = this->dataPtr->wheelVelocityCmdBatch;
+  std::size_t wheelCount = 0;
   for (Entity joint : this->dataPtr->leftJoints)
   {
     // skip this entity if it has been removed
     if (!_ecm.HasEntity(joint))
       continue;
 
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->leftJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->leftJointSpeed);
   }
 
   for (Entity joint : this->dataPtr->rightJoints)
@@ -469,27 +512,39 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
     if (!_ecm.HasEntity(joint))
       continue;
 
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->rightJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->rightJointSpeed);
   }
+  batch.resize(wheelCount);
+
+  // Update wheel velocities
+  _ecm.SetComponentDataBatch<components::JointVelocityCmd>(batch);
 
   // Create the left and right side joint position components if they
-  // don't exist.
-  auto leftPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->leftJoints[0]);
-  if (!leftPos && _ecm.HasEntity(this->dataPtr->leftJoints[0]))
+  // don't exist. Once both exist the per-step lookups can be skipped.
+  if (!this->dataPtr->jointPosComponentsCreated)
   {
-    _ecm.CreateComponent(this->dataPtr->leftJoints[0],
-        components::JointPosition());
-  }
+    auto leftPos = _ecm.Component<components::JointPosition>(
+        this->dataPtr->leftJoints[0]);
+    if (!leftPos && _ecm.HasEntity(this->dataPtr->leftJoints[0]))
+    {
+      _ecm.CreateComponent(this->dataPtr->leftJoints[0],
+          components::JointPosition());
+    }
 
-  auto rightPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->rightJoints[0]);
-  if (!rightPos && _ecm.HasEntity(this->dataPtr->rightJoints[0]))
-  {
-    _ecm.CreateComponent(this->dataPtr->rightJoints[0],
-        components::JointPosition());
+    auto rightPos = _ecm.Component<components::JointPosition>(
+        this->dataPtr->rightJoints[0]);
+    if (!rightPos && _ecm.HasEntity(this->dataPtr->rightJoints[0]))
+    {
+      _ecm.CreateComponent(this->dataPtr->rightJoints[0],
+          components::JointPosition());
+    }
+
+    this->dataPtr->jointPosComponentsCreated =
+        nullptr != _ecm.Component<components::JointPosition>(
+            this->dataPtr->leftJoints[0]) &&
+        nullptr != _ecm.Component<components::JointPosition>(
+            this->dataPtr->rightJoints[0]);
   }
 }
 
@@ -565,7 +620,7 @@ void DiffDrivePrivate::UpdateOdometry(const UpdateInfo &_info,
   frame->set_key("frame_id");
   if (this->sdfFrameId.empty())
   {
-    frame->add_value(this->model.Name(_ecm) + "/odom");
+    frame->add_value(this->modelName + "/odom");
   }
   else
   {
@@ -579,7 +634,7 @@ void DiffDrivePrivate::UpdateOdometry(const UpdateInfo &_info,
     {
       auto childFrame = msg.mutable_header()->add_data();
       childFrame->set_key("child_frame_id");
-      childFrame->add_value(this->model.Name(_ecm) + "/" + *linkName);
+      childFrame->add_value(this->modelName + "/" + *linkName);
     }
   }
   else
@@ -32,7 +32,6 @@
 #include <gz/sim/components/Name.hh>
 #include <gz/sim/components/ParentEntity.hh>
 #include <gz/sim/components/Pose.hh>
-#include <gz/sim/components/SphericalCoordinates.hh>
 #include <gz/sim/Conversions.hh>
 #include <gz/sim/EntityComponentManager.hh>
 #include <gz/sim/EventManager.hh>
@@ -157,6 +156,13 @@ class gz::sim::systems::DopplerVelocityLogSystem::Implementation
   /// \brief State of all entities in the world in simulation thread
   public: std::optional<gz::sensors::WorldState> latestWorldState;
 
+  /// \brief Persistent world state maintained incrementally in the
+  /// simulation thread. Entities whose kinematic components are unchanged
+  /// since the last ping keep their entries, so each ping only copies the
+  /// state of entities that actually moved instead of re-reading the whole
+  /// view.
+  public: gz::sensors::WorldState trackedWorldState;
+
   /// \brief State of all entities in the world in simulation thread
   public: std::shared_ptr<
     gz::sensors::EnvironmentalData> latestEnvironmentalData;
@@ -361,14 +367,16 @@ void DopplerVelocityLogSystem::Implementation::DoPostUpdate(
   {
     this->simTime = _info.simTime;
     requests::SetWorldState request;
-    auto component = _ecm.Component<
-      gz::sim::components::SphericalCoordinates
-    >(gz::sim::worldEntity(_ecm));
-    if (component)
+    // Per-step world-constants snapshot; avoids the world entity and
+    // component lookups every update.
+    const auto &origin =
+        gz::sim::worldConstants(_ecm).sphericalCoordinates;
+    if (origin)
     {
-      request.worldState.origin = component->Data();
+      request.worldState.origin = *origin;
     }
 
+    std::size_t visited = 0u;
     _ecm.Each<gz::sim::components::WorldPose,
               gz::sim::components::WorldLinearVelocity,
               gz::sim::components::WorldAngularVelocity>(
@@ -377,13 +385,49 @@ void DopplerVelocityLogSystem::Implementation::DoPostUpdate(
           const gz::sim::components::WorldLinearVelocity *_linearVelocity,
           const gz::sim::components::WorldAngularVelocity *_angularVelocity)
       {
-        auto & kinematicState = request.worldState.kinematics[_entity];
-
+        ++visited;
+        auto [it, inserted] =
+            this->trackedWorldState.kinematics.try_emplace(_entity);
+        // Static entities, e.g. seabed geometry with kinematic components
+        // enabled, never change after their first copy; skip them unless a
+        // component was flagged as changed this step.
+        if (!inserted &&
+            gz::sim::ComponentState::NoChange == _ecm.ComponentState(
+              _entity, gz::sim::components::WorldPose::typeId) &&
+            gz::sim::ComponentState::NoChange == _ecm.ComponentState(
+              _entity, gz::sim::components::WorldLinearVelocity::typeId) &&
+            gz::sim::ComponentState::NoChange == _ecm.ComponentState(
+              _entity, gz::sim::components::WorldAngularVelocity::typeId))
+        {
+          return true;
+        }
+
+        auto &kinematicState = it->second;
         kinematicState.pose = _pose->Data();
         kinematicState.linearVelocity = _linearVelocity->Data();
         kinematicState.angularVelocity = _angularVelocity->Data();
         return true;
-      });;
+      });
+
+    // Entities left the view, e.g. on removal; prune their stale entries.
+    if (visited != this->trackedWorldState.kinematics.size())
+    {
+      for (auto it = this->trackedWorldState.kinematics.begin();
+           it != this->trackedWorldState.kinematics.end();)
+      {
+        if (nullptr == _ecm.Component<gz::sim::components::WorldPose>(
+            it->first))
+        {
+          it = this->trackedWorldState.kinematics.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+    }
+
+    request.worldState.kinematics = this->trackedWorldState.kinematics;
 
     {
       std::lock_guard<std::mutex> lock(this->requestsMutex);
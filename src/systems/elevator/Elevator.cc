@@ -105,6 +105,10 @@ class ElevatorPrivate : public ElevatorCommonPrivate
   public: void UpdateState(const gz::sim::UpdateInfo &_info,
                            const EntityComponentManager &_ecm);
 
+  /// \brief Publishes the elevator state, throttled to the state publish rate
+  /// \param[in] _info Current simulation step info
+  public: void PublishState(const gz::sim::UpdateInfo &_info);
+
   /// \brief Callback for the door lidar scans
   /// \param[in] _floorLevel Floor level
   /// \param[in] _msg Laserscan message
@@ -249,6 +253,25 @@ void Elevator::PostUpdate(const UpdateInfo &_info,
   this->dataPtr->lastUpdateTime = _info.simTime;
 
   std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  // While the elevator is stationary - no monitor waiting on a joint, no
+  // door timer counting down, and the cabin joint position unchanged this
+  // step - there is no state to recompute. The component change flag kept
+  // by the ECM acts as the joint-position trigger: physics only marks
+  // JointPosition as changed when the value actually moves.
+  const bool idle = !this->dataPtr->doorJointMonitor.Active() &&
+      !this->dataPtr->cabinJointMonitor.Active() &&
+      !this->dataPtr->doorTimer->Active() &&
+      ComponentState::NoChange ==
+          _ecm.ComponentState(this->dataPtr->cabinJoint,
+                              components::JointPosition::typeId);
+  if (idle)
+  {
+    // NOTE Topic should be latched; keep the periodic publication alive
+    this->dataPtr->PublishState(_info);
+    return;
+  }
+
   this->dataPtr->UpdateState(_info, _ecm);
   this->dataPtr->doorTimer->Update(
       _info, this->dataPtr->isDoorwayBlockedStates[this->dataPtr->state]);
@@ -406,6 +429,12 @@ void ElevatorPrivate::UpdateState(const gz::sim::UpdateInfo &_info,
   auto it = std::min_element(diffs.begin(), diffs.end());
   this->state = static_cast<int32_t>(std::distance(diffs.begin(), it));
 
+  this->PublishState(_info);
+}
+
+//////////////////////////////////////////////////
+void ElevatorPrivate::PublishState(const gz::sim::UpdateInfo &_info)
+{
   // Throttle publish rate
   auto elapsed = _info.simTime - this->lastStatePubTime;
   if (elapsed > std::chrono::steady_clock::duration::zero() &&
@@ -82,6 +82,12 @@ void DoorTimer::Configure(const std::chrono::steady_clock::duration &_startTime,
   this->dataPtr->timeoutCallback = _timeoutCallback;
 }
 
+//////////////////////////////////////////////////
+bool DoorTimer::Active() const
+{
+  return this->dataPtr->isActive;
+}
+
 //////////////////////////////////////////////////
 void DoorTimer::Update(const UpdateInfo &_info, bool _isDoorwayBlocked)
 {
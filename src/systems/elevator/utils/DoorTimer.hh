@@ -67,6 +67,10 @@ class DoorTimer
   /// blocked
   public: void Update(const UpdateInfo &_info, bool _isDoorwayBlocked);
 
+  /// \brief Checks whether the timer is counting down
+  /// \return True if the timer is active
+  public: bool Active() const;
+
   /// \brief Private data pointer
   private: std::unique_ptr<DoorTimerPrivate> dataPtr;
 };
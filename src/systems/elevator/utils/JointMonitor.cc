@@ -77,6 +77,12 @@ void JointMonitor::Configure(
   this->dataPtr->targetReachedCallback = _jointTargetReachedCallback;
 }
 
+//////////////////////////////////////////////////
+bool JointMonitor::Active() const
+{
+  return this->dataPtr->isActive;
+}
+
 //////////////////////////////////////////////////
 void JointMonitor::Update(const EntityComponentManager &_ecm)
 {
@@ -66,6 +66,10 @@ class JointMonitor
   /// \param[in] _ecm Entity component manager
   public: void Update(const EntityComponentManager &_ecm);
 
+  /// \brief Checks whether the monitor is waiting on a joint target
+  /// \return True if the monitor is active
+  public: bool Active() const;
+
   /// \brief Private data pointer
   private: std::unique_ptr<JointMonitorPrivate> dataPtr;
 };
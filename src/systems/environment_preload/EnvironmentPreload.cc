@@ -17,8 +17,12 @@
 #include "EnvironmentPreload.hh"
 #include "VisualizationTool.hh"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +30,7 @@
 #include <gz/common/CSVStreams.hh>
 #include <gz/common/DataFrame.hh>
 #include <gz/common/Filesystem.hh>
+#include <gz/common/Util.hh>
 
 #include <gz/plugin/Register.hh>
 
@@ -82,6 +87,25 @@ class gz::sim::systems::EnvironmentPreloadPrivate
   /// \brief Reference to data
   public: std::shared_ptr<components::EnvironmentalData> envData;
 
+  /// \brief Number of time slices of the dataset kept resident at once.
+  /// 0 (the default) keeps the whole dataset in memory.
+  public: std::size_t maxResidentTimeSlices{0};
+
+  /// \brief Header line of the indexed dataset.
+  public: std::string headerLine;
+
+  /// \brief Time and byte offset of the first row of every distinct
+  /// time value, in ascending time order. Empty when chunked residency
+  /// is disabled or the whole dataset is resident.
+  public: std::vector<std::pair<double, std::streampos>> timeSliceIndex;
+
+  /// \brief First resident time slice.
+  public: std::size_t residentBegin{0};
+
+  /// \brief Number of resident time slices, 0 when the whole dataset
+  /// is resident.
+  public: std::size_t residentCount{0};
+
   //////////////////////////////////////////////////
   public: EnvironmentPreloadPrivate() :
     visualizationPtr(new EnvironmentVisualizationTool) {}
@@ -215,6 +239,22 @@ class gz::sim::systems::EnvironmentPreloadPrivate
       }
     }
 
+    // Optional bounded-memory residency: keep only this many time
+    // slices of the dataset in memory, reloading the window as
+    // simulation time advances. 0 (the default) loads the whole
+    // dataset up front.
+    if (this->sdf->HasElement("max_resident_time_slices"))
+    {
+      this->maxResidentTimeSlices = static_cast<std::size_t>(
+          this->sdf->Get<uint64_t>("max_resident_time_slices"));
+      if (1 == this->maxResidentTimeSlices)
+      {
+        gzwarn << "<max_resident_time_slices> must be at least 2 to "
+               << "interpolate in time; using 2." << std::endl;
+        this->maxResidentTimeSlices = 2;
+      }
+    }
+
     this->dataDescription.set_static_time(ignoreTime);
     this->dataDescription.set_coordinate_type(spatialReference);
     this->dataDescription.set_time(timeColumnName);
@@ -241,20 +281,215 @@ class gz::sim::systems::EnvironmentPreloadPrivate
     }
   }
 
+  //////////////////////////////////////////////////
+  /// \brief Build the Environment component from a stream of CSV data.
+  /// The caller must hold mtx. Throws std::invalid_argument on malformed
+  /// data, like the underlying data frame reader.
+  /// \param[in] _ecm Mutable reference to the ECM.
+  /// \param[in] _stream Stream of CSV data, header line included.
+  public: void BuildComponent(EntityComponentManager &_ecm,
+      std::istream &_stream)
+  {
+    std::array<std::string, 3> spatialColumnNames{
+      this->dataDescription.x(),
+      this->dataDescription.y(),
+      this->dataDescription.z()};
+
+    math::SphericalCoordinates::CoordinateType spatialReference =
+      msgs::Convert(this->dataDescription.coordinate_type());
+    auto units = this->ConvertUnits(this->dataDescription.units());
+
+    using ComponentDataT = components::EnvironmentalData;
+    auto data = ComponentDataT::MakeShared(
+        common::IO<ComponentDataT::FrameT>::ReadFrom(
+            common::CSVIStreamIterator(_stream),
+            common::CSVIStreamIterator(),
+            this->dataDescription.time(), spatialColumnNames),
+        spatialReference, units, this->dataDescription.static_time());
+    this->envData = data;
+    using ComponentT = components::Environment;
+    auto component = ComponentT{std::move(data)};
+    _ecm.CreateComponent(worldEntity(_ecm), std::move(component));
+    this->visualizationPtr->resample = true;
+    this->fileLoaded = true;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Index the dataset by time: record the byte offset of the
+  /// first row of every distinct time value. The file is streamed once
+  /// without retaining rows, so indexing works on datasets much larger
+  /// than memory. Requires rows grouped by ascending time, which is how
+  /// these data frames are laid out. The caller must hold mtx.
+  /// \return True if the index was built.
+  public: bool IndexTimeSlices()
+  {
+    this->timeSliceIndex.clear();
+    std::ifstream file(this->dataDescription.path());
+    if (!file.is_open())
+      return false;
+    if (!std::getline(file, this->headerLine))
+      return false;
+
+    const auto columns = common::split(this->headerLine, ",");
+    std::size_t timeColumn = columns.size();
+    for (std::size_t i = 0; i < columns.size(); ++i)
+    {
+      if (columns[i] == this->dataDescription.time())
+        timeColumn = i;
+    }
+    if (timeColumn == columns.size())
+    {
+      gzwarn << "Time column [" << this->dataDescription.time()
+             << "] not found; loading the whole dataset." << std::endl;
+      return false;
+    }
+
+    std::string line;
+    double lastTime = 0.0;
+    bool first = true;
+    while (file)
+    {
+      const auto offset = file.tellg();
+      if (!std::getline(file, line) || line.empty())
+        break;
+      const auto fields = common::split(line, ",");
+      if (timeColumn >= fields.size())
+        continue;
+      double time;
+      try
+      {
+        time = std::stod(fields[timeColumn]);
+      }
+      catch (const std::exception &)
+      {
+        continue;
+      }
+      if (first || time != lastTime)
+      {
+        if (!first && time < lastTime)
+        {
+          gzwarn << "Dataset rows are not grouped by ascending time; "
+                 << "loading the whole dataset." << std::endl;
+          this->timeSliceIndex.clear();
+          return false;
+        }
+        this->timeSliceIndex.emplace_back(time, offset);
+        lastTime = time;
+        first = false;
+      }
+    }
+    return !this->timeSliceIndex.empty();
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Materialize the window of time slices starting at _begin,
+  /// spanning up to the configured budget. The caller must hold mtx.
+  /// \param[in] _ecm Mutable reference to the ECM.
+  /// \param[in] _begin First time slice of the window.
+  /// \return True if the window was loaded.
+  public: bool LoadResidentWindow(EntityComponentManager &_ecm,
+      std::size_t _begin)
+  {
+    const auto total = this->timeSliceIndex.size();
+    if (_begin >= total)
+      _begin = total - 1;
+    const auto count = std::min(this->maxResidentTimeSlices,
+        total - _begin);
+
+    std::ifstream file(this->dataDescription.path(), std::ios::binary);
+    if (!file.is_open())
+      return false;
+
+    const auto beginOffset = this->timeSliceIndex[_begin].second;
+    file.seekg(beginOffset);
+    std::string rows;
+    if (_begin + count < total)
+    {
+      const auto endOffset = this->timeSliceIndex[_begin + count].second;
+      rows.resize(static_cast<std::size_t>(endOffset - beginOffset));
+      file.read(rows.data(), rows.size());
+      rows.resize(static_cast<std::size_t>(file.gcount()));
+    }
+    else
+    {
+      std::ostringstream tail;
+      tail << file.rdbuf();
+      rows = tail.str();
+    }
+
+    std::stringstream window;
+    window << this->headerLine << "\n" << rows;
+    this->BuildComponent(_ecm, window);
+
+    this->residentBegin = _begin;
+    this->residentCount = count;
+    gzdbg << "Resident environment window: slices [" << _begin << ", "
+          << _begin + count << ") of " << total << ", t = ["
+          << this->timeSliceIndex[_begin].first << ", "
+          << this->timeSliceIndex[_begin + count - 1].first << "]"
+          << std::endl;
+    return true;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Advance the resident window to cover the current simulation
+  /// time, prefetching forward along the time axis. The window is
+  /// reloaded when the step enters its last resident slice pair or moves
+  /// behind it. No-op when the whole dataset is resident.
+  /// \param[in] _info Current simulation step information.
+  /// \param[in] _ecm Mutable reference to the ECM.
+  public: void UpdateResidency(const UpdateInfo &_info,
+      EntityComponentManager &_ecm)
+  {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    if (this->timeSliceIndex.empty() || 0 == this->residentCount ||
+        this->residentCount >= this->timeSliceIndex.size())
+      return;
+
+    const double simTime =
+        std::chrono::duration<double>(_info.simTime).count();
+
+    // Last slice whose start time is at or before the current time.
+    auto iter = std::upper_bound(this->timeSliceIndex.begin(),
+        this->timeSliceIndex.end(), simTime,
+        [](double _t, const std::pair<double, std::streampos> &_slice)
+        {
+          return _t < _slice.first;
+        });
+    const std::size_t needed = iter == this->timeSliceIndex.begin() ?
+        0u : static_cast<std::size_t>(
+            std::distance(this->timeSliceIndex.begin(), iter)) - 1u;
+
+    const bool behind = needed < this->residentBegin;
+    const bool aheadOfPrefetch =
+        needed + 2 > this->residentBegin + this->residentCount;
+    if (!behind && !aheadOfPrefetch)
+      return;
+
+    // Keep one slice behind the current time for interpolation; the
+    // rest of the budget prefetches forward.
+    const std::size_t newBegin = needed == 0 ? 0u : needed - 1u;
+    if (newBegin == this->residentBegin)
+      return;
+
+    try
+    {
+      this->LoadResidentWindow(_ecm, newBegin);
+    }
+    catch (const std::invalid_argument &_exc)
+    {
+      gzerr << "Failed to advance environment data window" << std::endl
+            << _exc.what() << std::endl;
+      this->timeSliceIndex.clear();
+    }
+  }
+
   //////////////////////////////////////////////////
   public: void LoadEnvironment(EntityComponentManager &_ecm)
   {
     try
     {
       std::lock_guard<std::mutex> lock(this->mtx);
-      std::array<std::string, 3> spatialColumnNames{
-        this->dataDescription.x(),
-        this->dataDescription.y(),
-        this->dataDescription.z()};
-
-      math::SphericalCoordinates::CoordinateType spatialReference =
-        msgs::Convert(this->dataDescription.coordinate_type());
-      auto units = this->ConvertUnits(this->dataDescription.units());
 
       std::ifstream dataFile(this->dataDescription.path());
       if (!dataFile.is_open())
@@ -271,19 +506,25 @@ class gz::sim::systems::EnvironmentPreloadPrivate
       gzmsg << "Loading Environment Data " << this->dataDescription.path() <<
         std::endl;
 
-      using ComponentDataT = components::EnvironmentalData;
-      auto data = ComponentDataT::MakeShared(
-          common::IO<ComponentDataT::FrameT>::ReadFrom(
-              common::CSVIStreamIterator(dataFile),
-              common::CSVIStreamIterator(),
-              this->dataDescription.time(), spatialColumnNames),
-          spatialReference, units, this->dataDescription.static_time());
-      this->envData = data;
-      using ComponentT = components::Environment;
-      auto component = ComponentT{std::move(data)};
-      _ecm.CreateComponent(worldEntity(_ecm), std::move(component));
-      this->visualizationPtr->resample = true;
-      this->fileLoaded = true;
+      // With a slice budget configured, datasets with more time slices
+      // than the budget are loaded as a sliding window instead of
+      // whole-file, so memory stays bounded by the budget.
+      if (this->maxResidentTimeSlices > 0 &&
+          !this->dataDescription.static_time() &&
+          this->IndexTimeSlices() &&
+          this->timeSliceIndex.size() > this->maxResidentTimeSlices)
+      {
+        if (this->LoadResidentWindow(_ecm, 0))
+        {
+          this->needsReload = false;
+          return;
+        }
+      }
+
+      // Whole dataset resident; no residency updates needed.
+      this->timeSliceIndex.clear();
+      this->residentCount = 0;
+      this->BuildComponent(_ecm, dataFile);
     }
     catch (const std::invalid_argument &exc)
     {
@@ -345,6 +586,10 @@ void EnvironmentPreload::PreUpdate(
   {
     this->dataPtr->LoadEnvironment(_ecm);
   }
+  else if (this->dataPtr->fileLoaded)
+  {
+    this->dataPtr->UpdateResidency(_info, _ecm);
+  }
 
   if (this->dataPtr->visualize)
   {
@@ -37,6 +37,11 @@ namespace systems
   **/
   /// \brief A plugin to preload an Environment component
   /// into the ECM upon simulation start-up.
+  ///
+  /// The whole dataset is loaded by default. For datasets too large to
+  /// hold in memory, <max_resident_time_slices> bounds residency to that
+  /// many time slices; the resident window follows simulation time and
+  /// is prefetched forward along the time axis.
   class EnvironmentPreload :
     public System,
     public ISystemConfigure,
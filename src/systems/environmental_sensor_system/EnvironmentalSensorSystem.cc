@@ -38,11 +38,13 @@
 #include <gz/math/Pose3.hh>
 
 #include <chrono>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <unordered_set>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace gz;
 using namespace gz::sim;
@@ -197,27 +199,40 @@ class EnvironmentalSensor : public gz::sensors::Sensor
 
 
     std::optional<double> dataPoints[3];
-    for (std::size_t i = 0; i < this->numberOfFields; ++i)
+    // A static field sampled by a probe that has not moved produces the
+    // same values as the previous step; reuse them instead of redoing the
+    // volumetric lookup per field.
+    if (this->dataCacheValid && !this->positionChanged &&
+        this->gridField->staticTime)
     {
-      if (this->fieldName[i].empty())
+      for (std::size_t i = 0; i < this->numberOfFields; ++i)
+        dataPoints[i] = this->cachedDataPoints[i];
+    }
+    else
+    {
+      for (std::size_t i = 0; i < this->numberOfFields; ++i)
       {
-        // Empty field name means the column should default to zero.
-        dataPoints[i] = 0;
-        continue;
-      }
-
-      if (!this->session[i].has_value()) return false;
-
-      // Step time if its not static
-      if (!this->gridField->staticTime)
-        this->session[i] = this->gridField->frame[this->fieldName[i]].StepTo(
-          this->session[i].value(),
-          std::chrono::duration<double>(_now).count());
+        if (this->fieldName[i].empty())
+        {
+          // Empty field name means the column should default to zero.
+          dataPoints[i] = 0;
+          continue;
+        }
 
-      if (!this->session[i].has_value()) return false;
+        // Sessions are shared across all environmental sensors and stepped
+        // to the current time once per iteration by the system.
+        if (nullptr == this->sharedSessions) return false;
+        auto sessionIt = this->sharedSessions->find(this->fieldName[i]);
+        if (sessionIt == this->sharedSessions->end() ||
+            !sessionIt->second.has_value())
+          return false;
 
-      dataPoints[i] = this->gridField->frame[this->fieldName[i]].LookUp(
-        this->session[i].value(), this->position);
+        dataPoints[i] = this->gridField->frame[this->fieldName[i]].LookUp(
+          sessionIt->second.value(), this->position);
+      }
+      for (std::size_t i = 0; i < this->numberOfFields; ++i)
+        this->cachedDataPoints[i] = dataPoints[i];
+      this->dataCacheValid = true;
     }
 
     if (this->numberOfFields == 1) {
@@ -267,10 +282,9 @@ class EnvironmentalSensor : public gz::sensors::Sensor
   ////////////////////////////////////////////////////////////////
   /// \brief Attempts to set a data table.
   /// \param[in] _data - The data table
-  /// \param[in] _curr_time - The current time.
   public: void SetDataTable(
     const components::Environment* _data,
-    const std::chrono::steady_clock::duration &_curr_time)
+    const std::chrono::steady_clock::duration &/*_curr_time*/)
   {
     gzdbg << "Setting new data table\n";
     auto data = _data->Data();
@@ -289,26 +303,8 @@ class EnvironmentalSensor : public gz::sensors::Sensor
     }
 
     this->gridField = data;
-    for (std::size_t i = 0; i < this->numberOfFields; ++i)
-    {
-      if (this->fieldName[i].empty())
-        continue;
-
-      this->session[i] =
-        this->gridField->frame[this->fieldName[i]].CreateSession();
-      if (!this->gridField->staticTime)
-      {
-        this->session[i] = this->gridField->frame[this->fieldName[i]].StepTo(
-          *this->session[i],
-          std::chrono::duration<double>(_curr_time).count());
-      }
-
-      if(!this->session[i].has_value())
-      {
-        gzerr << "Exceeded time stamp." << std::endl;
-      }
-    }
-
+    this->dataCacheValid = false;
+    this->lastWorldPosition.reset();
     this->ready = true;
   }
 
@@ -326,6 +322,22 @@ class EnvironmentalSensor : public gz::sensors::Sensor
 
     this->objectPose = worldPose(_entity, _ecm);
     const auto worldPosition = this->objectPose.Pos();
+
+    auto vel = _ecm.Component<components::WorldLinearVelocity>(_entity);
+    if (vel != nullptr)
+    {
+      this->velocity = vel->Data();
+    }
+
+    // A probe that did not move keeps its cached lookup coordinates; the
+    // coordinate transform only reruns on motion.
+    if (this->lastWorldPosition.has_value() &&
+        *this->lastWorldPosition == worldPosition)
+    {
+      this->positionChanged = false;
+      return true;
+    }
+
     auto lookupCoords =
       getGridFieldCoordinates(_ecm, worldPosition, this->gridField);
 
@@ -334,12 +346,9 @@ class EnvironmentalSensor : public gz::sensors::Sensor
       return false;
     }
 
-    auto vel = _ecm.Component<components::WorldLinearVelocity>(_entity);
-    if (vel != nullptr)
-    {
-      this->velocity = vel->Data();
-    }
     this->position = lookupCoords.value();
+    this->lastWorldPosition = worldPosition;
+    this->positionChanged = true;
     return true;
   }
 
@@ -349,16 +358,56 @@ class EnvironmentalSensor : public gz::sensors::Sensor
     return fieldName[0];
   }
 
+  ////////////////////////////////////////////////////////////////
+  /// \brief Field names this sensor samples, skipping empty columns.
+  public: std::vector<std::string> FieldNames() const
+  {
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < this->numberOfFields; ++i)
+    {
+      if (!this->fieldName[i].empty())
+        names.push_back(this->fieldName[i]);
+    }
+    return names;
+  }
+
+  ////////////////////////////////////////////////////////////////
+  /// \brief Set the table of lookup sessions shared across all
+  /// environmental sensors. The system owns the table and steps each
+  /// session to the current time once per iteration.
+  /// \param[in] _sessions The shared session table.
+  public: void SetSharedSessions(const std::unordered_map<std::string,
+    std::optional<gz::math::InMemorySession<double, double>>> *_sessions)
+  {
+    this->sharedSessions = _sessions;
+  }
+
   private: bool ready {false};
   private: math::Vector3d position, velocity;
   private: math::Pose3d objectPose;
   private: std::size_t numberOfFields{1};
   private: std::string fieldName[3];
   private: std::string frameId;
-  private: std::optional<gz::math::InMemorySession<double, double>> session[3];
+  private: const std::unordered_map<std::string,
+    std::optional<gz::math::InMemorySession<double, double>>>
+      *sharedSessions{nullptr};
   private: std::shared_ptr<gz::sim::components::EnvironmentalData>
     gridField;
   private: TransformType transformType{TransformType::GLOBAL};
+
+  /// \brief World position at the last coordinate transform, used to skip
+  /// the transform and lookups while the probe is stationary.
+  private: std::optional<math::Vector3d> lastWorldPosition;
+
+  /// \brief True if the probe moved since the previous update.
+  private: bool positionChanged{true};
+
+  /// \brief Values sampled at the last lookup, reused for static fields
+  /// while the probe is stationary.
+  private: std::optional<double> cachedDataPoints[3];
+
+  /// \brief True once cachedDataPoints holds a full sample.
+  private: bool dataCacheValid{false};
 };
 
 class gz::sim::EnvironmentalSensorSystemPrivate {
@@ -386,6 +435,59 @@ class gz::sim::EnvironmentalSensorSystemPrivate {
   public: Entity worldEntity;
 
   public: bool useSphericalCoords{false};
+
+  /// \brief Data frame shared by all environmental sensors.
+  public: std::shared_ptr<components::EnvironmentalData> gridField;
+
+  /// \brief Lookup sessions shared across all sensors, one per sampled
+  /// field. Each session is stepped to the current time once per
+  /// iteration instead of once per sensor per field.
+  public: std::unordered_map<std::string,
+    std::optional<math::InMemorySession<double, double>>> sharedSessions;
+
+  /// \brief Rebuild the shared session table for all registered fields,
+  /// e.g. after a new data frame was loaded or a new field registered.
+  /// \param[in] _time Current simulation time.
+  public: void RefreshSharedSessions(
+    const std::chrono::steady_clock::duration &_time)
+  {
+    this->sharedSessions.clear();
+    if (nullptr == this->gridField)
+      return;
+    for (const auto &field : this->fields)
+    {
+      if (!this->gridField->frame.Has(field))
+        continue;
+      std::optional<math::InMemorySession<double, double>> session =
+        this->gridField->frame[field].CreateSession();
+      if (!this->gridField->staticTime)
+      {
+        session = this->gridField->frame[field].StepTo(*session,
+          std::chrono::duration<double>(_time).count());
+      }
+      if (!session.has_value())
+      {
+        gzerr << "Exceeded time stamp." << std::endl;
+      }
+      this->sharedSessions[field] = session;
+    }
+  }
+
+  /// \brief Step every shared session to the given time.
+  /// \param[in] _time Current simulation time.
+  public: void StepSharedSessions(
+    const std::chrono::steady_clock::duration &_time)
+  {
+    if (nullptr == this->gridField || this->gridField->staticTime)
+      return;
+    for (auto &[field, session] : this->sharedSessions)
+    {
+      if (!session.has_value())
+        continue;
+      session = this->gridField->frame[field].StepTo(*session,
+        std::chrono::duration<double>(_time).count());
+    }
+  }
 };
 
 
@@ -454,11 +556,21 @@ void EnvironmentalSensorSystem::PreUpdate(const gz::sim::UpdateInfo &_info,
         if (environData != nullptr)
         {
           sensor->SetDataTable(environData, _info.simTime);
+
+          // Register this sensor's fields with the shared session table,
+          // which is stepped once per iteration for all sensors.
+          this->dataPtr->gridField = environData->Data();
+          bool newField = false;
+          for (const auto &name : sensor->FieldNames())
+            newField = this->dataPtr->fields.insert(name).second || newField;
+          if (newField)
+            this->dataPtr->RefreshSharedSessions(_info.simTime);
         }
         else
         {
           gzerr << "No sensor data loaded\n";
         }
+        sensor->SetSharedSessions(&this->dataPtr->sharedSessions);
 
         enableComponent<components::WorldLinearVelocity>(_ecm, _entity);
 
@@ -476,15 +588,19 @@ void EnvironmentalSensorSystem::PostUpdate(const gz::sim::UpdateInfo &_info,
   _ecm.EachNew<components::Environment>([&](const Entity &/*_entity*/,
     const components::Environment *_environmental_data)->bool
     {
+      this->dataPtr->gridField = _environmental_data->Data();
       for (auto &[entity, sensor] : this->dataPtr->entitySensorMap)
       {
         sensor->SetDataTable(_environmental_data, _info.simTime);
       }
+      this->dataPtr->RefreshSharedSessions(_info.simTime);
       return true;
     });
   // Only update and publish if not paused.
   if (!_info.paused)
   {
+    // Advance the shared lookup sessions once for all sensors.
+    this->dataPtr->StepSharedSessions(_info.simTime);
 
     for (auto &[entity, sensor] : this->dataPtr->entitySensorMap)
     {
@@ -15,6 +15,7 @@
  *
  */
 
+#include <cmath>
 #include <string>
 
 #include <gz/plugin/Register.hh>
@@ -51,6 +52,25 @@ class gz::sim::systems::FollowActorPrivate
   /// \brief Maximum distance in meters to keep away from target.
   public: double maxDistance{4};
 
+  /// \brief Squared min/max distances, precomputed so the per-step
+  /// range checks don't need a square root.
+  public: double minDistanceSq{1.2 * 1.2};
+  public: double maxDistanceSq{16.0};
+
+  /// \brief Cached component pointers. Component storage is stable while
+  /// the entity set doesn't change, so these turn the per-step ECM hash
+  /// lookups into pointer reads. Revalidated whenever the entity
+  /// structure epoch changes.
+  public: components::TrajectoryPose *trajPoseComp{nullptr};
+  public: components::Pose *targetPoseComp{nullptr};
+  public: components::AnimationTime *animTimeComp{nullptr};
+
+  /// \brief Entity structure epoch the cached pointers were fetched at.
+  public: uint64_t cachedEpoch{0u};
+
+  /// \brief True while the cached pointers are valid.
+  public: bool cacheValid{false};
+
   /// \brief Velocity of the animation dislocation on the X axis, in m/s.
   /// Used to coordinate translational motion with the actor's feet.
   /// TODO(louise) Automatically calculate it from the root node's first and
@@ -113,6 +133,11 @@ void FollowActor::Configure(const Entity &_entity,
   if (_sdf->HasElement("max_distance"))
     this->dataPtr->maxDistance = _sdf->Get<double>("max_distance");
 
+  this->dataPtr->minDistanceSq =
+      this->dataPtr->minDistance * this->dataPtr->minDistance;
+  this->dataPtr->maxDistanceSq =
+      this->dataPtr->maxDistance * this->dataPtr->maxDistance;
+
   if (_sdf->HasElement("animation_x_vel"))
     this->dataPtr->animationXVel = _sdf->Get<double>("animation_x_vel");
 
@@ -209,33 +234,56 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
   this->dataPtr->lastUpdate = _info.simTime;
 
   // Is there a follow target?
-  if (this->dataPtr->targetEntity == kNullEntity ||
-    !_ecm.HasEntity(this->dataPtr->targetEntity) ||
-    !_ecm.HasEntity(this->dataPtr->actorEntity))
+  if (this->dataPtr->targetEntity == kNullEntity)
+    return;
+
+  // Revalidate the cached component pointers whenever entities were
+  // created or removed; in between, component storage is stable and the
+  // per-step lookups reduce to pointer reads.
+  const uint64_t epoch = _ecm.EntityStructureEpoch();
+  if (!this->dataPtr->cacheValid || epoch != this->dataPtr->cachedEpoch)
+  {
+    this->dataPtr->cachedEpoch = epoch;
+    this->dataPtr->cacheValid = false;
+
+    if (!_ecm.HasEntity(this->dataPtr->targetEntity) ||
+        !_ecm.HasEntity(this->dataPtr->actorEntity))
+      return;
+
+    this->dataPtr->trajPoseComp = _ecm.Component<components::TrajectoryPose>(
+        this->dataPtr->actorEntity);
+    this->dataPtr->targetPoseComp = _ecm.Component<components::Pose>(
+        this->dataPtr->targetEntity);
+    this->dataPtr->animTimeComp = _ecm.Component<components::AnimationTime>(
+        this->dataPtr->actorEntity);
+
+    this->dataPtr->cacheValid = nullptr != this->dataPtr->trajPoseComp &&
+        nullptr != this->dataPtr->targetPoseComp &&
+        nullptr != this->dataPtr->animTimeComp;
+  }
+  if (!this->dataPtr->cacheValid)
     return;
 
   // Current world pose
-  auto trajPoseComp = _ecm.Component<components::TrajectoryPose>(
-      this->dataPtr->actorEntity);
-  auto actorPose = trajPoseComp->Data();
-  auto initialPose = actorPose;
+  auto actorPose = this->dataPtr->trajPoseComp->Data();
 
   // Current target
-  auto targetPose = _ecm.Component<components::Pose>(
-      this->dataPtr->targetEntity)->Data();
+  const auto &targetPose = this->dataPtr->targetPoseComp->Data();
 
   // Direction to target
   auto dir = targetPose.Pos() - actorPose.Pos();
   dir.Z(0);
 
+  const double distSq = dir.SquaredLength();
+
   // Stop if too close to target
-  if (dir.Length() <= this->dataPtr->minDistance)
+  if (distSq <= this->dataPtr->minDistanceSq)
   {
     return;
   }
 
   // Stop following if too far from target
-  if (dir.Length() > this->dataPtr->maxDistance)
+  if (distSq > this->dataPtr->maxDistanceSq)
   {
     if (this->dataPtr->following)
     {
@@ -265,24 +313,22 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
   actorPose.Rot() = math::Quaterniond(0, 0, yaw.Radian());
 
   // Distance traveled is used to coordinate motion with the walking
-  // animation
-  double distanceTraveled = (actorPose.Pos() - initialPose.Pos()).Length();
+  // animation. The actor moves exactly velocity * dt along a unit
+  // direction in the XY plane, so the norm is known in closed form.
+  const double distanceTraveled = this->dataPtr->velocity * dt;
 
   // Update actor root pose
-  *trajPoseComp = components::TrajectoryPose(actorPose);
+  *this->dataPtr->trajPoseComp = components::TrajectoryPose(actorPose);
   // Mark as a one-time-change so that the change is propagated to the GUI
   _ecm.SetChanged(this->dataPtr->actorEntity,
       components::TrajectoryPose::typeId, ComponentState::OneTimeChange);
 
   // Update actor bone trajectories based on animation time
-  auto animTimeComp = _ecm.Component<components::AnimationTime>(
-      this->dataPtr->actorEntity);
-
-  auto animTime = animTimeComp->Data() +
+  auto animTime = this->dataPtr->animTimeComp->Data() +
     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
     std::chrono::duration<double>(distanceTraveled *
     this->dataPtr->animationXVel));
-  *animTimeComp = components::AnimationTime(animTime);
+  *this->dataPtr->animTimeComp = components::AnimationTime(animTime);
   // Mark as a one-time-change so that the change is propagated to the GUI
   _ecm.SetChanged(this->dataPtr->actorEntity,
       components::AnimationTime::typeId, ComponentState::OneTimeChange);
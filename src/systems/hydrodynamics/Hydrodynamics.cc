@@ -25,6 +25,7 @@
 
 #include "gz/sim/components/AngularVelocity.hh"
 #include "gz/sim/components/Environment.hh"
+#include "gz/sim/components/Inertial.hh"
 #include "gz/sim/components/LinearVelocity.hh"
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/World.hh"
@@ -41,6 +42,16 @@ using namespace gz;
 using namespace sim;
 using namespace systems;
 
+/// \brief Fixed-size matrix and vector types for the 6 DOF hydrodynamic
+/// equations. The compile-time sizes let Eigen vectorize the products and
+/// avoid per-step heap allocation.
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+/// \brief Row-major view used to map the flat stability derivative arrays
+/// into Eigen without copying.
+using RowMatrix6d = Eigen::Matrix<double, 6, 6, Eigen::RowMajor>;
+
 /// \brief Private Hydrodynamics data class.
 class gz::sim::systems::HydrodynamicsPrivateData
 {
@@ -74,13 +85,17 @@ class gz::sim::systems::HydrodynamicsPrivateData
 
   /// \brief Added mass of vehicle;
   /// See: https://en.wikipedia.org/wiki/Added_mass
-  public: Eigen::MatrixXd Ma;
+  public: Matrix6d Ma;
 
   /// \brief Previous state.
-  public: Eigen::VectorXd prevState;
+  public: Vector6d prevState;
 
   /// \brief Previous derivative of the state
-  public: Eigen::VectorXd prevStateDot;
+  public: Vector6d prevStateDot;
+
+  /// \brief Pose of the link's inertial frame relative to the link,
+  /// cached at configure time for water current lookups.
+  public: math::Pose3d inertialPose;
 
   /// \brief Use current table if true
   public: bool useCurrentTable {false};
@@ -345,7 +360,7 @@ void Hydrodynamics::Configure(
   // Note: Adding added mass here is deprecated and will be removed in
   // Gazebo J as this formulation has instabilities.
   bool addedMassSpecified = false;
-  this->dataPtr->Ma = Eigen::MatrixXd::Zero(6, 6);
+  this->dataPtr->Ma = Matrix6d::Zero();
   for(auto i = 0; i < 6; i++)
   {
     for(auto j = 0; j < 6; j++)
@@ -409,7 +424,14 @@ void Hydrodynamics::Configure(
     this->dataPtr->currentVector = _sdf->Get<math::Vector3d>("default_current");
   }
 
-  this->dataPtr->prevState = Eigen::VectorXd::Zero(6);
+  this->dataPtr->prevState = Vector6d::Zero();
+
+  auto inertial =
+    _ecm.Component<components::Inertial>(this->dataPtr->linkEntity);
+  if (nullptr != inertial)
+  {
+    this->dataPtr->inertialPose = inertial->Data().Pose();
+  }
 
   if(_sdf->HasElement("lookup_current_x"))
   {
@@ -458,18 +480,17 @@ void Hydrodynamics::PreUpdate(
   // `Cmat` corresponds to the Centripetal matrix
   // `Dmat` is the drag matrix
   // `Ma` is the added mass.
-  Eigen::VectorXd stateDot = Eigen::VectorXd(6);
-  Eigen::VectorXd state    = Eigen::VectorXd(6);
-  Eigen::MatrixXd Cmat     = Eigen::MatrixXd::Zero(6, 6);
-  Eigen::MatrixXd Dmat     = Eigen::MatrixXd::Zero(6, 6);
+  Vector6d stateDot;
+  Vector6d state;
+  Matrix6d Cmat = Matrix6d::Zero();
 
-  // Get vehicle state
+  // Get vehicle state. The pose and both velocities are sampled in a single
+  // pass instead of through separate link queries.
   gz::sim::Link baseLink(this->dataPtr->linkEntity);
-  auto linearVelocity =
-    _ecm.Component<components::WorldLinearVelocity>(this->dataPtr->linkEntity);
-  auto rotationalVelocity = baseLink.WorldAngularVelocity(_ecm);
+  const auto kinematics =
+    linkWorldKinematics(this->dataPtr->linkEntity, _ecm);
 
-  if (!linearVelocity)
+  if (!kinematics.has_value())
   {
     gzerr << "no linear vel" <<"\n";
     return;
@@ -480,12 +501,9 @@ void Hydrodynamics::PreUpdate(
 
   if (this->dataPtr->useCurrentTable)
   {
-    auto position = baseLink.WorldInertialPose(_ecm);
-    if (position.has_value())
-    {
-      currentVector = this->dataPtr->GetWaterCurrentFromEnvironment(
-        _ecm, _info.simTime, position.value().Pos());
-    }
+    auto position = kinematics->pose * this->dataPtr->inertialPose;
+    currentVector = this->dataPtr->GetWaterCurrentFromEnvironment(
+      _ecm, _info.simTime, position.Pos());
   }
   else
   {
@@ -493,12 +511,13 @@ void Hydrodynamics::PreUpdate(
     currentVector = this->dataPtr->currentVector;
   }
   // Transform state to local frame
-  auto pose = baseLink.WorldPose(_ecm);
+  const auto &pose = kinematics->pose;
   // Since we are transforming angular and linear velocity we only care about
   // rotation. Also this is where we apply the effects of current to the link
-  auto localLinearVelocity = pose->Rot().Inverse() *
-    (linearVelocity->Data() - currentVector);
-  auto localRotationalVelocity = pose->Rot().Inverse() * *rotationalVelocity;
+  auto localLinearVelocity = pose.Rot().Inverse() *
+    (kinematics->linearVelocity - currentVector);
+  auto localRotationalVelocity =
+    pose.Rot().Inverse() * kinematics->angularVelocity;
 
   state(0) = localLinearVelocity.X();
   state(1) = localLinearVelocity.Y();
@@ -515,7 +534,7 @@ void Hydrodynamics::PreUpdate(
 
   // The added mass
   // Negative sign signifies the behaviour change
-  const Eigen::VectorXd kAmassVec = - this->dataPtr->Ma * stateDot;
+  const Vector6d kAmassVec = - this->dataPtr->Ma * stateDot;
 
   // Coriolis and Centripetal forces for under water vehicles (Fossen P. 37)
   // Note: this is significantly different from VRX because we need to account
@@ -541,32 +560,28 @@ void Hydrodynamics::PreUpdate(
   Cmat(5, 1) =   this->dataPtr->Ma(0, 0) * state(0);
   Cmat(5, 3) = - this->dataPtr->Ma(4, 4) * state(4);
   Cmat(5, 4) =   this->dataPtr->Ma(3, 3) * state(3);
-  const Eigen::VectorXd kCmatVec = - Cmat * state;
-
-  // Damping forces
+  const Vector6d kCmatVec = - Cmat * state;
+
+  // Damping forces. Each row of the damping matrix is the linear terms plus
+  // the quadratic derivative blocks contracted with the state, evaluated as
+  // matrix-vector products over mapped views of the flat coefficient arrays.
+  const Vector6d absState = state.cwiseAbs();
+  Eigen::Map<const RowMatrix6d> linearTerms(
+    this->dataPtr->stabilityLinearTerms);
+  Matrix6d Dmat;
   for(int i = 0; i < 6; i++)
   {
-    for(int j = 0; j < 6; j++)
-    {
-      auto coeff = - this->dataPtr->stabilityLinearTerms[i * 6 + j];
-      for(int k = 0; k < 6; k++)
-      {
-        auto index = i * 36 + j * 6 + k;
-        auto absCoeff =
-          this->dataPtr->stabilityQuadraticAbsDerivative[index] * abs(state(k));
-        coeff -= absCoeff;
-        auto velCoeff =
-          this->dataPtr->stabilityQuadraticDerivative[index] * state(k);
-        coeff -= velCoeff;
-      }
-
-      Dmat(i, j) = coeff;
-    }
+    Eigen::Map<const RowMatrix6d> quadBlock(
+      this->dataPtr->stabilityQuadraticDerivative + i * 36);
+    Eigen::Map<const RowMatrix6d> quadAbsBlock(
+      this->dataPtr->stabilityQuadraticAbsDerivative + i * 36);
+    Dmat.row(i) = - linearTerms.row(i) -
+      (quadAbsBlock * absState + quadBlock * state).transpose();
   }
 
-  const Eigen::VectorXd kDvec = Dmat * state;
+  const Vector6d kDvec = Dmat * state;
 
-  Eigen::VectorXd kTotalWrench = kDvec;
+  Vector6d kTotalWrench = kDvec;
 
   if (!this->dataPtr->disableAddedMass)
   {
@@ -584,8 +599,8 @@ void Hydrodynamics::PreUpdate(
 
   baseLink.AddWorldWrench(
     _ecm,
-    pose->Rot()*(totalForce),
-    pose->Rot()*totalTorque);
+    pose.Rot()*(totalForce),
+    pose.Rot()*totalTorque);
 }
 
 /////////////////////////////////////////////////
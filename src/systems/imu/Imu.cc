@@ -75,9 +75,12 @@ class gz::sim::systems::ImuPrivate
   /// \param[in] _ecm Immutable reference to ECM.
   public: void CreateSensors(const EntityComponentManager &_ecm);
 
-  /// \brief Update IMU sensor data based on physics data
+  /// \brief Update IMU sensor data based on physics data. Only sensors
+  /// that are due for an update and have subscribers are touched.
+  /// \param[in] _info Current simulation step info.
   /// \param[in] _ecm Immutable reference to ECM.
-  public: void Update(const EntityComponentManager &_ecm);
+  public: void Update(const UpdateInfo &_info,
+                      const EntityComponentManager &_ecm);
 
   /// \brief Create sensor
   /// \param[in] _ecm Immutable reference to ECM.
@@ -163,13 +166,7 @@ void Imu::PostUpdate(const UpdateInfo &_info,
     if (!needsUpdate)
       return;
 
-    this->dataPtr->Update(_ecm);
-
-    for (auto &it : this->dataPtr->entitySensorMap)
-    {
-      // Update measurement time
-      it.second->Update(_info.simTime, false);
-    }
+    this->dataPtr->Update(_info, _ecm);
   }
 
   this->dataPtr->RemoveImuEntities(_ecm);
@@ -300,7 +297,8 @@ void ImuPrivate::CreateSensors(const EntityComponentManager &_ecm)
 }
 
 //////////////////////////////////////////////////
-void ImuPrivate::Update(const EntityComponentManager &_ecm)
+void ImuPrivate::Update(const UpdateInfo &_info,
+                        const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("ImuPrivate::Update");
   _ecm.Each<components::Imu,
@@ -316,6 +314,14 @@ void ImuPrivate::Update(const EntityComponentManager &_ecm)
         auto it = this->entitySensorMap.find(_entity);
         if (it != this->entitySensorMap.end())
         {
+          // Skip sensors that wouldn't publish this step; their data would
+          // be overwritten before it's ever used.
+          if (it->second->NextDataUpdateTime() > _info.simTime ||
+              !it->second->HasConnections())
+          {
+            return true;
+          }
+
           const auto &imuWorldPose = _worldPose->Data();
           it->second->SetWorldPose(imuWorldPose);
 
@@ -324,6 +330,9 @@ void ImuPrivate::Update(const EntityComponentManager &_ecm)
 
           // Set the IMU linear acceleration in the imu local frame
           it->second->SetLinearAcceleration(_linearAccel->Data());
+
+          // Update measurement time and publish
+          it->second->Update(_info.simTime, false);
          }
         else
         {
@@ -325,17 +325,12 @@ void JointController::PreUpdate(const UpdateInfo &_info,
       // Update force command.
       double force = this->dataPtr->velPid.Update(error, _info.dt);
 
-      auto forceComp =
-          _ecm.Component<components::JointForceCmd>(joint);
-      if (forceComp == nullptr)
-      {
-        _ecm.CreateComponent(joint,
-                            components::JointForceCmd({force}));
-      }
-      else
-      {
-        *forceComp = components::JointForceCmd({force});
-      }
+      // Accumulate into the command instead of overwriting it, so forces
+      // from other systems writing the same joint this step are not
+      // clobbered. Physics zero-fills the command after applying it.
+      auto forceComp = _ecm.ComponentDefault<components::JointForceCmd>(
+          joint, {0.0});
+      forceComp->Data()[0] += force;
     }
   }
   // Velocity mode.
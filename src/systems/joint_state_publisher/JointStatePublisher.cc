@@ -19,11 +19,15 @@
 
 #include <gz/msgs/model.pb.h>
 
+#include <cmath>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/plugin/Register.hh>
 
+#include "gz/sim/PublishQueue.hh"
+
 #include "gz/sim/components/ChildLinkName.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/Joint.hh"
@@ -100,6 +104,27 @@ void JointStatePublisher::Configure(
     this->topic = _sdf->Get<std::string>("topic");
   }
 
+  // Change-filtered publication
+  this->positionTolerance =
+      _sdf->Get<double>("position_tolerance", this->positionTolerance).first;
+
+  // Queued publication is opt-in: the shared queue takes serialization
+  // off the step critical path but is bounded and drops the oldest
+  // message under load, while direct publication is lossless.
+  this->usePublishQueue =
+      _sdf->Get<bool>("use_publish_queue", this->usePublishQueue).first;
+  if (this->positionTolerance < 0.0)
+  {
+    gzwarn << "<position_tolerance> must not be negative, disabling the "
+           << "change filter.\n";
+    this->positionTolerance = 0.0;
+  }
+
+  const double keyframeSec = _sdf->Get<double>("keyframe_interval",
+      std::chrono::duration<double>(this->keyframeInterval).count()).first;
+  this->keyframeInterval =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(keyframeSec));
 }
 
 //////////////////////////////////////////////////
@@ -182,6 +207,44 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
   if (!this->modelPub)
     return;
 
+  // Suppress the publication when no joint position has moved beyond the
+  // tolerance since the last published message, unless the keyframe
+  // interval has elapsed.
+  if (this->positionTolerance > 0.0 &&
+      _info.simTime - this->lastPubTime < this->keyframeInterval)
+  {
+    bool changed = false;
+    for (const Entity &joint : this->joints)
+    {
+      const auto *jointPositions =
+        _ecm.Component<components::JointPosition>(joint);
+      if (!jointPositions)
+        continue;
+
+      const auto &positions = jointPositions->Data();
+      const auto lastIt = this->lastPubPositions.find(joint);
+      if (lastIt == this->lastPubPositions.end() ||
+          lastIt->second.size() != positions.size())
+      {
+        changed = true;
+        break;
+      }
+      for (size_t i = 0; i < positions.size(); ++i)
+      {
+        if (std::abs(positions[i] - lastIt->second[i]) >
+            this->positionTolerance)
+        {
+          changed = true;
+          break;
+        }
+      }
+      if (changed)
+        break;
+    }
+    if (!changed)
+      return;
+  }
+
   // Create the message
   msgs::Model msg;
   msg.mutable_header()->mutable_stamp()->CopyFrom(
@@ -229,6 +292,11 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
       _ecm.Component<components::JointPosition>(joint);
     if (jointPositions)
     {
+      // Remember what was published so the change filter can compare
+      // against it
+      if (this->positionTolerance > 0.0)
+        this->lastPubPositions[joint] = jointPositions->Data();
+
       for (size_t i = 0; i < jointPositions->Data().size(); ++i)
       {
         if (i == 0)
@@ -307,8 +375,14 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
     }
   }
 
-  // Publish the message.
-  this->modelPub->Publish(msg);
+  this->lastPubTime = _info.simTime;
+
+  // Publish the message. When opted in, serialization happens on the
+  // shared I/O thread, off the step critical path.
+  if (this->usePublishQueue)
+    PublishQueue::Instance().Publish(*this->modelPub, std::move(msg));
+  else
+    this->modelPub->Publish(msg);
 }
 
 GZ_ADD_PLUGIN(JointStatePublisher,
@@ -18,9 +18,12 @@
 #ifndef GZ_SIM_SYSTEMS_STATE_PUBLISHER_HH_
 #define GZ_SIM_SYSTEMS_STATE_PUBLISHER_HH_
 
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <gz/sim/Model.hh>
 #include <gz/transport/Node.hh>
 #include <gz/sim/System.hh>
@@ -50,6 +53,18 @@ namespace systems
   /// - `<joint_name>`: Name of a joint to publish. This parameter can be
   /// specified multiple times, and is optional. All joints in a model will
   /// be published if joint names are not specified.
+  ///
+  /// - `<position_tolerance>`: Optional, defaults to 0 (disabled). When set
+  /// to a positive value, a message is only published when at least one
+  /// joint position has changed by more than this amount (in radians or
+  /// meters) since the last published message. This cuts bandwidth for
+  /// models whose joints are static most of the time.
+  ///
+  /// - `<keyframe_interval>`: Optional, defaults to 1 second. When
+  /// `<position_tolerance>` filtering is enabled, a message is still
+  /// published at least this often (in seconds) so that late subscribers
+  /// and downstream bridges receive a full state even while the model is
+  /// static.
   class JointStatePublisher
       : public System,
         public ISystemConfigure,
@@ -90,6 +105,27 @@ namespace systems
 
     /// \brief The topic
     private: std::string topic;
+
+    /// \brief Minimum joint position change that triggers a publication.
+    /// Zero disables the change filter and publishes every step.
+    private: double positionTolerance{0.0};
+
+    /// \brief True to publish through the shared publication queue,
+    /// which moves serialization off the step but may drop messages
+    /// under load. Off by default; direct publication is lossless.
+    private: bool usePublishQueue{false};
+
+    /// \brief Maximum time between publications while the change filter
+    /// suppresses them.
+    private: std::chrono::steady_clock::duration keyframeInterval
+        {std::chrono::seconds(1)};
+
+    /// \brief Sim time of the last published message.
+    private: std::chrono::steady_clock::duration lastPubTime{0};
+
+    /// \brief Joint positions included in the last published message, used
+    /// by the change filter.
+    private: std::unordered_map<Entity, std::vector<double>> lastPubPositions;
   };
   }
 }
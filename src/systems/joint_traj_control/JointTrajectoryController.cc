@@ -35,6 +35,7 @@
 #include <gz/transport/Publisher.hh>
 #include <gz/transport/TopicUtils.hh>
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -222,6 +223,11 @@ class Trajectory
   /// \return Fraction of the completed points in range (0.0, 1.0]
   public: float ComputeProgress() const;
 
+  /// \brief Precompute the time table of the trajectory points, so that
+  /// following the trajectory compares plain durations instead of
+  /// converting each point's protobuf timestamp every step
+  public: void Precompute();
+
   /// \brief Reset trajectory internals, i.e. clean list of joint names, points
   /// and reset index of the current point
   public: void Reset();
@@ -251,6 +257,10 @@ class Trajectory
   /// \brief Trajectory defined in terms of temporal points, whose members are
   /// ordered according to `jointNames`
   public: std::vector<gz::msgs::JointTrajectoryPoint> points;
+
+  /// \brief Time from start of each entry in `points`, precomputed by
+  /// Precompute() when the trajectory is received
+  public: std::vector<std::chrono::steady_clock::duration> pointTimes;
 };
 
 /// \brief Private data of the JointTrajectoryController plugin
@@ -295,6 +305,11 @@ class gz::sim::systems::JointTrajectoryControllerPrivate
   /// \brief Information about trajectory that should be followed
   public: Trajectory trajectory;
 
+  /// \brief Actuated joints matching the current trajectory's `jointNames`,
+  /// resolved once per trajectory so per-point target updates don't repeat
+  /// the name lookups. Unconfigured joints are stored as nullptr
+  public: std::vector<ActuatedJoint *> trajectoryJoints;
+
   /// \brief Flag that determines whether to use message header timestamp as
   /// the trajectory start, where simulation time at the beginning of execution
   /// is used otherwise
@@ -462,6 +477,23 @@ void JointTrajectoryController::PreUpdate(
         this->dataPtr->trajectory.status = Trajectory::Reached;
       }
 
+      // Resolve the trajectory's joint names against the actuated joints
+      // once, so the per-point target updates don't repeat the map lookups
+      this->dataPtr->trajectoryJoints.clear();
+      for (const auto &jointName : this->dataPtr->trajectory.jointNames)
+      {
+        auto jointIt = this->dataPtr->actuatedJoints.find(jointName);
+        if (jointIt == this->dataPtr->actuatedJoints.end())
+        {
+          gzwarn << "[JointTrajectoryController] Trajectory contains joint ["
+                  << jointName << "] that is not configured. It will be"
+                     " ignored.\n";
+          this->dataPtr->trajectoryJoints.push_back(nullptr);
+          continue;
+        }
+        this->dataPtr->trajectoryJoints.push_back(&jointIt->second);
+      }
+
       // Update is always needed for a new trajectory
       isTargetUpdateRequired = true;
     }
@@ -481,20 +513,19 @@ void JointTrajectoryController::PreUpdate(
     if (isTargetUpdateRequired &&
         this->dataPtr->trajectory.status != Trajectory::Reached)
     {
-      const auto targetPoint =
+      const auto &targetPoint =
           this->dataPtr->trajectory.points[this->dataPtr->trajectory
                                                .pointIndex];
       for (auto jointIndex = 0u;
-           jointIndex < this->dataPtr->trajectory.jointNames.size();
+           jointIndex < this->dataPtr->trajectoryJoints.size();
            ++jointIndex)
       {
-        const auto jointName = this->dataPtr->trajectory.jointNames[jointIndex];
-        if (this->dataPtr->actuatedJoints.count(jointName) == 0)
+        auto *joint = this->dataPtr->trajectoryJoints[jointIndex];
+        if (nullptr == joint)
         {
           // Warning about unconfigured joint is already logged above
           continue;
         }
-        auto *joint = &this->dataPtr->actuatedJoints[jointName];
         joint->SetTarget(targetPoint, jointIndex);
       }
 
@@ -686,6 +717,9 @@ void JointTrajectoryControllerPrivate::JointTrajectoryCallback(
   {
     this->trajectory.points.push_back(point);
   }
+
+  // Precompute the time table of the new points
+  this->trajectory.Precompute();
 }
 
 //////////////////////////////////////////////////
@@ -1009,11 +1043,9 @@ bool Trajectory::UpdateCurrentPoint(
       break;
     }
 
-    // Break if point needs to be followed
-    const auto pointTFS = this->points[this->pointIndex].time_from_start();
-    const auto pointTime = std::chrono::seconds(pointTFS.sec()) +
-                           std::chrono::nanoseconds(pointTFS.nsec());
-    if (pointTime >= trajectoryTime)
+    // Break if point needs to be followed. The point times were
+    // precomputed when the trajectory was received
+    if (this->pointTimes[this->pointIndex] >= trajectoryTime)
     {
       break;
     }
@@ -1047,6 +1079,19 @@ float Trajectory::ComputeProgress() const
   }
 }
 
+//////////////////////////////////////////////////
+void Trajectory::Precompute()
+{
+  this->pointTimes.clear();
+  this->pointTimes.reserve(this->points.size());
+  for (const auto &point : this->points)
+  {
+    const auto &pointTFS = point.time_from_start();
+    this->pointTimes.push_back(std::chrono::seconds(pointTFS.sec()) +
+                               std::chrono::nanoseconds(pointTFS.nsec()));
+  }
+}
+
 //////////////////////////////////////////////////
 void Trajectory::Reset()
 {
@@ -1054,6 +1099,7 @@ void Trajectory::Reset()
   this->pointIndex = 0;
   this->jointNames.clear();
   this->points.clear();
+  this->pointTimes.clear();
 }
 
 // Register plugin
@@ -68,6 +68,15 @@ class gz::sim::systems::KineticEnergyMonitorPrivate
   /// \brief Kinetic energy threshold.
   public: double keThreshold {7.0};
 
+  /// \brief Half the link mass, cached at configure time for the cheap
+  /// kinetic energy upper bound. The inertial of a monitored link does not
+  /// change at runtime.
+  public: double halfMass {0.0};
+
+  /// \brief Half the largest principal moment of inertia of the link,
+  /// cached at configure time.
+  public: double halfMaxInertia {0.0};
+
   /// \brief Gazebo communication publisher.
   public: transport::Node::Publisher pub;
 
@@ -143,6 +152,17 @@ void KineticEnergyMonitor::Configure(const Entity &_entity,
 
   // Create a default inertia in case the link doesn't have it
   enableComponent<components::Inertial>(_ecm, this->dataPtr->linkEntity, true);
+
+  // Cache the inertia values used by the cheap energy bound in PostUpdate
+  auto inertial =
+    _ecm.Component<components::Inertial>(this->dataPtr->linkEntity);
+  if (inertial)
+  {
+    const auto &massMatrix = inertial->Data().MassMatrix();
+    this->dataPtr->halfMass = 0.5 * massMatrix.Mass();
+    this->dataPtr->halfMaxInertia =
+      0.5 * massMatrix.PrincipalMoments().Max();
+  }
 }
 
 //////////////////////////////////////////////////
@@ -156,10 +176,36 @@ void KineticEnergyMonitor::PostUpdate(const UpdateInfo &_info,
 
   if (this->dataPtr->linkEntity != kNullEntity)
   {
+    // Cheap short circuit: an energy drop can only exceed the threshold if
+    // the previous energy exceeded it, and 1/2 m v^2 + 1/2 Imax w^2 is an
+    // upper bound of the kinetic energy. While both stay at or below the
+    // threshold no trigger is possible, so the exact energy (which needs
+    // the world pose and the full inertia matrix) doesn't have to be
+    // computed; tracking the upper bound instead keeps the comparison
+    // conservative.
+    if (this->dataPtr->prevKineticEnergy <= this->dataPtr->keThreshold)
+    {
+      auto linVel = _ecm.Component<components::WorldLinearVelocity>(
+        this->dataPtr->linkEntity);
+      auto angVel = _ecm.Component<components::WorldAngularVelocity>(
+        this->dataPtr->linkEntity);
+      if (linVel && angVel)
+      {
+        const double energyBound =
+          this->dataPtr->halfMass * linVel->Data().SquaredLength() +
+          this->dataPtr->halfMaxInertia * angVel->Data().SquaredLength();
+        if (energyBound <= this->dataPtr->keThreshold)
+        {
+          this->dataPtr->prevKineticEnergy = energyBound;
+          return;
+        }
+      }
+    }
+
     Link link(this->dataPtr->linkEntity);
-    if (std::nullopt != link.WorldKineticEnergy(_ecm))
+    if (auto kineticEnergy = link.WorldKineticEnergy(_ecm))
     {
-      double currKineticEnergy = *link.WorldKineticEnergy(_ecm);
+      double currKineticEnergy = *kineticEnergy;
 
       // We only care about positive values of this (the links looses energy)
       double deltaKE = this->dataPtr->prevKineticEnergy - currKineticEnergy;
@@ -130,6 +130,10 @@ class gz::sim::systems::LiftDragPrivate
   /// \brief Link entity targeted this plugin.
   public: Entity linkEntity;
 
+  /// \brief Wind entity, resolved lazily on the first update. Scanning
+  /// for it every step is measurable with many surfaces.
+  public: Entity windEntity{kNullEntity};
+
   /// \brief Joint entity that actuates a control surface for this lifting body
   public: Entity controlJointEntity;
 
@@ -266,11 +270,13 @@ void LiftDragPrivate::Update(EntityComponentManager &_ecm)
       _ecm.Component<components::WorldPose>(this->linkEntity);
 
   // get wind as a component from the _ecm
+  if (this->windEntity == kNullEntity)
+    this->windEntity = _ecm.EntityByComponents(components::Wind());
   components::WorldLinearVelocity *windLinearVel = nullptr;
-  if(_ecm.EntityByComponents(components::Wind()) != kNullEntity){
-    Entity windEntity = _ecm.EntityByComponents(components::Wind());
+  if (this->windEntity != kNullEntity)
+  {
     windLinearVel =
-        _ecm.Component<components::WorldLinearVelocity>(windEntity);
+        _ecm.Component<components::WorldLinearVelocity>(this->windEntity);
   }
   components::JointPosition *controlJointPosition = nullptr;
   if (this->controlJointEntity != kNullEntity)
@@ -286,12 +292,9 @@ void LiftDragPrivate::Update(EntityComponentManager &_ecm)
 
   const auto &pose = worldPose->Data();
   const auto cpWorld = pose.Rot().RotateVector(this->cp);
-  auto vel = worldLinVel->Data() + worldAngVel->Data().Cross(
-  cpWorld);
-  if (windLinearVel != nullptr){
-    vel = worldLinVel->Data() + worldAngVel->Data().Cross(
-    cpWorld) - windLinearVel->Data();
-  }
+  auto vel = worldLinVel->Data() + worldAngVel->Data().Cross(cpWorld);
+  if (windLinearVel != nullptr)
+    vel -= windLinearVel->Data();
 
   if (vel.Length() <= 0.01)
   {
@@ -0,0 +1,385 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_SYSTEMS_FLATSTATELOG_HH_
+#define GZ_SIM_SYSTEMS_FLATSTATELOG_HH_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gz/sim/config.hh>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define GZ_SIM_FLAT_LOG_MMAP_AVAILABLE 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace systems
+{
+/// \file FlatStateLog.hh
+/// \brief Flat, memory-mappable sidecar format for recorded states.
+///
+/// The sqlite-backed gz-transport log stores each state as a blob that
+/// playback must query and copy out row by row. The flat log stores the
+/// same serialized state payloads back to back in a plain file with a
+/// trailing offset table, so playback can mmap the file once and parse
+/// each payload directly from the mapping, with O(log n) time-based
+/// random access through the table.
+///
+/// File layout, all integers little-endian host order:
+///   [8-byte header magic]
+///   repeated records: [int64 simTimeNs][uint32 flags][uint32 size][bytes]
+///   offset table: per record [int64 simTimeNs][uint64 file offset]
+///   [uint64 record count][uint64 table offset][8-byte footer magic]
+/// A file whose footer is missing, e.g. after a crash, is recovered by
+/// scanning the records sequentially up to the first truncated one.
+
+/// \brief Record flag marking a full state keyframe.
+constexpr uint32_t kFlatStateKeyframe = 1u;
+
+/// \brief Magic bytes at the start of a flat state log.
+constexpr char kFlatStateHeaderMagic[8] =
+    {'G', 'Z', 'S', 'F', 'L', 'A', 'T', '1'};
+
+/// \brief Magic bytes at the end of a complete flat state log.
+constexpr char kFlatStateFooterMagic[8] =
+    {'G', 'Z', 'S', 'F', 'L', 'A', 'T', 'X'};
+
+/// \brief A record in a flat state log. The data pointer aliases the
+/// reader's mapping and is valid until the reader is closed.
+struct FlatStateRecord
+{
+  /// \brief Sim time of the record in nanoseconds
+  int64_t timeNs{0};
+
+  /// \brief Record flags, see kFlatStateKeyframe
+  uint32_t flags{0};
+
+  /// \brief Serialized payload bytes
+  const char *data{nullptr};
+
+  /// \brief Payload size in bytes
+  uint32_t size{0};
+};
+
+/// \brief Appends records to a flat state log. Not thread safe; intended
+/// to be driven by a single writer thread.
+class FlatStateLogWriter
+{
+  /// \brief Destructor, finalizes the file.
+  public: ~FlatStateLogWriter()
+  {
+    this->Close();
+  }
+
+  /// \brief Create or truncate a flat state log.
+  /// \param[in] _path File path to write to
+  /// \return True if the file is ready for appending.
+  public: bool Open(const std::string &_path)
+  {
+    this->out.open(_path, std::ios::binary | std::ios::trunc);
+    if (!this->out.is_open())
+      return false;
+    this->out.write(kFlatStateHeaderMagic, sizeof(kFlatStateHeaderMagic));
+    this->offset = sizeof(kFlatStateHeaderMagic);
+    return this->out.good();
+  }
+
+  /// \brief Whether the writer has an open file.
+  public: bool Valid() const
+  {
+    return this->out.is_open();
+  }
+
+  /// \brief Append a record.
+  /// \param[in] _timeNs Sim time of the record in nanoseconds
+  /// \param[in] _flags Record flags, see kFlatStateKeyframe
+  /// \param[in] _data Serialized payload bytes
+  public: void Append(int64_t _timeNs, uint32_t _flags,
+      const std::string &_data)
+  {
+    if (!this->out.is_open())
+      return;
+    const auto size = static_cast<uint32_t>(_data.size());
+    this->out.write(reinterpret_cast<const char *>(&_timeNs),
+        sizeof(_timeNs));
+    this->out.write(reinterpret_cast<const char *>(&_flags), sizeof(_flags));
+    this->out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    this->out.write(_data.data(), size);
+    this->index.push_back({_timeNs, this->offset});
+    this->offset += sizeof(_timeNs) + sizeof(_flags) + sizeof(size) + size;
+  }
+
+  /// \brief Write the offset table and footer and close the file.
+  public: void Close()
+  {
+    if (!this->out.is_open())
+      return;
+    const uint64_t tableOffset = this->offset;
+    for (const auto &entry : this->index)
+    {
+      this->out.write(reinterpret_cast<const char *>(&entry.timeNs),
+          sizeof(entry.timeNs));
+      this->out.write(reinterpret_cast<const char *>(&entry.offset),
+          sizeof(entry.offset));
+    }
+    const uint64_t count = this->index.size();
+    this->out.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    this->out.write(reinterpret_cast<const char *>(&tableOffset),
+        sizeof(tableOffset));
+    this->out.write(kFlatStateFooterMagic, sizeof(kFlatStateFooterMagic));
+    this->out.close();
+    this->index.clear();
+    this->offset = 0;
+  }
+
+  /// \brief An offset table entry
+  private: struct IndexEntry
+  {
+    /// \brief Sim time of the record in nanoseconds
+    int64_t timeNs;
+
+    /// \brief File offset of the record header
+    uint64_t offset;
+  };
+
+  /// \brief Output stream
+  private: std::ofstream out;
+
+  /// \brief File offset of the next record
+  private: uint64_t offset{0};
+
+  /// \brief Offset table accumulated for the footer
+  private: std::vector<IndexEntry> index;
+};
+
+/// \brief Memory-maps a flat state log for random access. Unavailable on
+/// platforms without POSIX mmap; Open fails there and callers fall back
+/// to the sqlite log.
+class FlatStateLogReader
+{
+  /// \brief Destructor, unmaps the file.
+  public: ~FlatStateLogReader()
+  {
+    this->Close();
+  }
+
+  /// \brief Map a flat state log.
+  /// \param[in] _path File path to map
+  /// \return True if the file mapped and its index is usable.
+  public: bool Open(const std::string &_path)
+  {
+#ifdef GZ_SIM_FLAT_LOG_MMAP_AVAILABLE
+    this->Close();
+    this->fd = open(_path.c_str(), O_RDONLY);
+    if (this->fd < 0)
+      return false;
+    struct stat st;
+    if (fstat(this->fd, &st) != 0 ||
+        static_cast<uint64_t>(st.st_size) < sizeof(kFlatStateHeaderMagic))
+    {
+      this->Close();
+      return false;
+    }
+    this->size = static_cast<uint64_t>(st.st_size);
+    void *mapped = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE,
+        this->fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+      this->Close();
+      return false;
+    }
+    this->map = static_cast<const char *>(mapped);
+    if (std::memcmp(this->map, kFlatStateHeaderMagic,
+        sizeof(kFlatStateHeaderMagic)) != 0)
+    {
+      this->Close();
+      return false;
+    }
+
+    if (!this->LoadFooterIndex())
+      this->ScanIndex();
+    return true;
+#else
+    (void)_path;
+    return false;
+#endif
+  }
+
+  /// \brief Whether the reader has a mapped file.
+  public: bool Valid() const
+  {
+    return this->map != nullptr;
+  }
+
+  /// \brief Number of records in the log.
+  public: std::size_t RecordCount() const
+  {
+    return this->index.size();
+  }
+
+  /// \brief Get a record. The returned data pointer aliases the mapping.
+  /// \param[in] _i Record index, must be below RecordCount
+  /// \return The record.
+  public: FlatStateRecord Record(std::size_t _i) const
+  {
+    FlatStateRecord record;
+    const auto &entry = this->index[_i];
+    const char *base = this->map + entry.offset;
+    std::memcpy(&record.timeNs, base, sizeof(record.timeNs));
+    std::memcpy(&record.flags, base + 8, sizeof(record.flags));
+    std::memcpy(&record.size, base + 12, sizeof(record.size));
+    record.data = base + 16;
+    return record;
+  }
+
+  /// \brief Index of the first record at or after a time.
+  /// \param[in] _timeNs Sim time in nanoseconds
+  /// \return Record index, RecordCount if every record is earlier.
+  public: std::size_t LowerBound(int64_t _timeNs) const
+  {
+    auto it = std::lower_bound(this->index.begin(), this->index.end(),
+        _timeNs, [](const IndexEntry &_entry, int64_t _t)
+        {
+          return _entry.timeNs < _t;
+        });
+    return static_cast<std::size_t>(it - this->index.begin());
+  }
+
+  /// \brief Unmap the file.
+  public: void Close()
+  {
+#ifdef GZ_SIM_FLAT_LOG_MMAP_AVAILABLE
+    if (this->map != nullptr)
+      munmap(const_cast<char *>(this->map), this->size);
+    if (this->fd >= 0)
+      close(this->fd);
+#endif
+    this->map = nullptr;
+    this->size = 0;
+    this->fd = -1;
+    this->index.clear();
+  }
+
+  /// \brief Load the offset table from the footer.
+  /// \return False if the footer is missing or inconsistent.
+  private: bool LoadFooterIndex()
+  {
+    const uint64_t footerSize = 2 * sizeof(uint64_t) +
+        sizeof(kFlatStateFooterMagic);
+    if (this->size < sizeof(kFlatStateHeaderMagic) + footerSize)
+      return false;
+    const char *footer = this->map + this->size - footerSize;
+    if (std::memcmp(footer + 2 * sizeof(uint64_t), kFlatStateFooterMagic,
+        sizeof(kFlatStateFooterMagic)) != 0)
+    {
+      return false;
+    }
+    uint64_t count = 0;
+    uint64_t tableOffset = 0;
+    std::memcpy(&count, footer, sizeof(count));
+    std::memcpy(&tableOffset, footer + sizeof(count), sizeof(tableOffset));
+    if (tableOffset < sizeof(kFlatStateHeaderMagic) ||
+        tableOffset > this->size - footerSize ||
+        count != (this->size - footerSize - tableOffset) / 16)
+    {
+      return false;
+    }
+
+    this->index.reserve(count);
+    const char *table = this->map + tableOffset;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+      IndexEntry entry;
+      std::memcpy(&entry.timeNs, table + i * 16, sizeof(entry.timeNs));
+      std::memcpy(&entry.offset, table + i * 16 + 8, sizeof(entry.offset));
+      uint32_t recordSize = 0;
+      if (entry.offset + 16 > tableOffset)
+      {
+        this->index.clear();
+        return false;
+      }
+      std::memcpy(&recordSize, this->map + entry.offset + 12,
+          sizeof(recordSize));
+      if (recordSize > tableOffset - entry.offset - 16)
+      {
+        this->index.clear();
+        return false;
+      }
+      this->index.push_back(entry);
+    }
+    return true;
+  }
+
+  /// \brief Rebuild the index by scanning the records sequentially,
+  /// stopping at the first truncated record. Used when the footer is
+  /// missing, e.g. after a crash.
+  private: void ScanIndex()
+  {
+    uint64_t offset = sizeof(kFlatStateHeaderMagic);
+    while (offset + 16 <= this->size)
+    {
+      int64_t timeNs = 0;
+      uint32_t recordSize = 0;
+      std::memcpy(&timeNs, this->map + offset, sizeof(timeNs));
+      std::memcpy(&recordSize, this->map + offset + 12, sizeof(recordSize));
+      if (recordSize > this->size - offset - 16)
+        break;
+      this->index.push_back({timeNs, offset});
+      offset += 16 + recordSize;
+    }
+  }
+
+  /// \brief An offset table entry
+  private: struct IndexEntry
+  {
+    /// \brief Sim time of the record in nanoseconds
+    int64_t timeNs;
+
+    /// \brief File offset of the record header
+    uint64_t offset;
+  };
+
+  /// \brief Mapped file contents
+  private: const char *map{nullptr};
+
+  /// \brief Mapped size in bytes
+  private: uint64_t size{0};
+
+  /// \brief File descriptor backing the mapping
+  private: int fd{-1};
+
+  /// \brief Offset table, ordered by time
+  private: std::vector<IndexEntry> index;
+};
+}
+}
+}
+}
+#endif
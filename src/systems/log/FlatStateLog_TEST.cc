@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+
+#include "FlatStateLog.hh"
+
+using namespace gz;
+using namespace sim;
+using namespace systems;
+
+#ifdef GZ_SIM_FLAT_LOG_MMAP_AVAILABLE
+
+/////////////////////////////////////////////////
+class FlatStateLogTest : public ::testing::Test
+{
+  protected: void SetUp() override
+  {
+    this->tmpDir = std::make_unique<common::TempDirectory>(
+        "flat_state_log", "gz_sim", true);
+    ASSERT_TRUE(this->tmpDir->Valid());
+    this->path = common::joinPaths(this->tmpDir->Path(), "state.flat");
+  }
+
+  /// \brief Temporary directory holding the log file
+  protected: std::unique_ptr<common::TempDirectory> tmpDir;
+
+  /// \brief Path of the log file
+  protected: std::string path;
+};
+
+/////////////////////////////////////////////////
+TEST_F(FlatStateLogTest, RoundTrip)
+{
+  {
+    FlatStateLogWriter writer;
+    ASSERT_TRUE(writer.Open(this->path));
+    EXPECT_TRUE(writer.Valid());
+    writer.Append(100, kFlatStateKeyframe, "full state");
+    writer.Append(200, 0u, "delta one");
+    writer.Append(300, 0u, "delta two");
+    writer.Close();
+  }
+
+  FlatStateLogReader reader;
+  ASSERT_TRUE(reader.Open(this->path));
+  EXPECT_TRUE(reader.Valid());
+  ASSERT_EQ(3u, reader.RecordCount());
+
+  auto record = reader.Record(0);
+  EXPECT_EQ(100, record.timeNs);
+  EXPECT_EQ(kFlatStateKeyframe, record.flags);
+  EXPECT_EQ("full state", std::string(record.data, record.size));
+
+  record = reader.Record(2);
+  EXPECT_EQ(300, record.timeNs);
+  EXPECT_EQ(0u, record.flags);
+  EXPECT_EQ("delta two", std::string(record.data, record.size));
+}
+
+/////////////////////////////////////////////////
+TEST_F(FlatStateLogTest, LowerBound)
+{
+  {
+    FlatStateLogWriter writer;
+    ASSERT_TRUE(writer.Open(this->path));
+    writer.Append(100, 0u, "a");
+    writer.Append(200, 0u, "b");
+    writer.Append(300, 0u, "c");
+    writer.Close();
+  }
+
+  FlatStateLogReader reader;
+  ASSERT_TRUE(reader.Open(this->path));
+  EXPECT_EQ(0u, reader.LowerBound(0));
+  EXPECT_EQ(0u, reader.LowerBound(100));
+  EXPECT_EQ(1u, reader.LowerBound(101));
+  EXPECT_EQ(2u, reader.LowerBound(300));
+  EXPECT_EQ(3u, reader.LowerBound(301));
+}
+
+/////////////////////////////////////////////////
+TEST_F(FlatStateLogTest, RecoverWithoutFooter)
+{
+  {
+    FlatStateLogWriter writer;
+    ASSERT_TRUE(writer.Open(this->path));
+    writer.Append(100, 0u, "a");
+    writer.Append(200, 0u, "bb");
+    writer.Close();
+  }
+
+  // Drop the footer and half of the second record, as a crash would
+  {
+    std::ifstream in(this->path, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+        std::istreambuf_iterator<char>());
+    // header + first record + second record header + 1 of 2 payload bytes
+    contents.resize(8 + (16 + 1) + 16 + 1);
+    std::ofstream out(this->path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), contents.size());
+  }
+
+  // The sequential scan recovers the records before the truncation
+  FlatStateLogReader reader;
+  ASSERT_TRUE(reader.Open(this->path));
+  ASSERT_EQ(1u, reader.RecordCount());
+  auto record = reader.Record(0);
+  EXPECT_EQ(100, record.timeNs);
+  EXPECT_EQ("a", std::string(record.data, record.size));
+}
+
+/////////////////////////////////////////////////
+TEST_F(FlatStateLogTest, MissingOrInvalidFile)
+{
+  FlatStateLogReader reader;
+  EXPECT_FALSE(reader.Open(this->path));
+  EXPECT_FALSE(reader.Valid());
+
+  // A file that is not a flat state log is rejected
+  {
+    std::ofstream out(this->path, std::ios::binary);
+    out << "definitely not a flat state log";
+  }
+  EXPECT_FALSE(reader.Open(this->path));
+  EXPECT_FALSE(reader.Valid());
+}
+
+#endif  // GZ_SIM_FLAT_LOG_MMAP_AVAILABLE
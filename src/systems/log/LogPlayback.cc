@@ -19,6 +19,9 @@
 
 #include <gz/msgs/log_playback_stats.pb.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <regex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -47,6 +50,8 @@
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/World.hh"
 
+#include "FlatStateLog.hh"
+
 using namespace gz;
 using namespace sim;
 using namespace systems;
@@ -73,6 +78,61 @@ class gz::sim::systems::LogPlaybackPrivate
   /// \return String of prepended path.
   public: std::string PrependLogPath(const std::string &_uri);
 
+  /// \brief Apply the latest recorded keyframe at or before _endTime, if
+  /// the log contains any, so replay can resume from it instead of from
+  /// the beginning of the log.
+  /// \param[in] _ecm Mutable ECM.
+  /// \param[in] _endTime Seek target time.
+  /// \param[out] _startTime Set to just after the keyframe time when a
+  /// keyframe was applied; untouched otherwise.
+  /// \param[inout] _entitiesToRemove Entities queued for removal by the
+  /// rewind logic; entities present in the keyframe are erased from it.
+  /// \return True if a keyframe was applied.
+  public: bool SeekToKeyframe(EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_endTime,
+      std::chrono::steady_clock::duration &_startTime,
+      std::set<Entity> &_entitiesToRemove);
+
+  /// \brief Whether a state message may be skipped under stride playback:
+  /// every entity it touches already exists and none is being removed.
+  /// Skipped frames only delay updates to existing components until the
+  /// next applied frame, which is acceptable while scrubbing.
+  /// \param[in] _ecm Immutable ECM.
+  /// \param[in] _msg Parsed state message.
+  /// \return True if the message is safe to skip.
+  public: bool CanStrideSkip(const EntityComponentManager &_ecm,
+      const msgs::SerializedStateMap &_msg) const;
+
+  /// \brief Whether a state message may be skipped under stride playback.
+  /// \param[in] _ecm Immutable ECM.
+  /// \param[in] _msg Parsed state message.
+  /// \return True if the message is safe to skip.
+  public: bool CanStrideSkip(const EntityComponentManager &_ecm,
+      const msgs::SerializedState &_msg) const;
+
+  /// \brief Advance the stride counter and report whether the current
+  /// state frame falls on a skipped slot. Always false when the stride is
+  /// one or while rewinding.
+  /// \param[in] _seekRewind True while replaying for a rewind.
+  /// \return True if the current frame may be skipped, subject to
+  /// CanStrideSkip.
+  public: bool StrideSkips(bool _seekRewind);
+
+  /// \brief Replay the states in a time range from the memory-mapped flat
+  /// log, parsing each payload in place instead of querying sqlite.
+  /// \param[in] _ecm Mutable ECM.
+  /// \param[in] _startTime Start of the replay range, inclusive. Ignored
+  /// when rewinding; the range then starts at the latest keyframe at or
+  /// before _endTime, or at the beginning of the log.
+  /// \param[in] _endTime End of the replay range, inclusive.
+  /// \param[in] _seekRewind True while replaying for a rewind.
+  /// \param[inout] _entitiesToRemove Entities queued for removal by the
+  /// rewind logic.
+  public: void UpdateFromFlat(EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_startTime,
+      const std::chrono::steady_clock::duration &_endTime,
+      bool _seekRewind, std::set<Entity> &_entitiesToRemove);
+
   /// \brief Updates the ECM according to the given message.
   /// \param[in] _ecm Mutable ECM.
   /// \param[in] _msg Message containing state updates.
@@ -115,6 +175,20 @@ class gz::sim::systems::LogPlaybackPrivate
 
   // \brief Saves which particle emitter emitting components have changed
   public: std::unordered_map<Entity, bool> prevParticleEmitterCmds;
+
+  /// \brief Apply only every k-th state frame during forward playback.
+  /// One, the default, applies every frame.
+  public: uint64_t stride{1u};
+
+  /// \brief Number of state frames considered for stride playback
+  public: uint64_t strideCounter{0u};
+
+  /// \brief Memory-mapped flat state log, used instead of sqlite queries
+  /// when the recording includes one
+  public: FlatStateLogReader flatReader;
+
+  /// \brief Message reused when parsing flat log payloads
+  public: msgs::SerializedStateMap flatMsg;
 };
 
 bool LogPlaybackPrivate::started{false};
@@ -143,6 +217,176 @@ void LogPlaybackPrivate::Parse(EntityComponentManager &_ecm,
   _ecm.SetState(_msg);
 }
 
+//////////////////////////////////////////////////
+void LogPlaybackPrivate::UpdateFromFlat(EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_startTime,
+    const std::chrono::steady_clock::duration &_endTime,
+    bool _seekRewind, std::set<Entity> &_entitiesToRemove)
+{
+  const int64_t endNs =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(_endTime).count();
+  int64_t startNs =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(_startTime).count();
+
+  if (_seekRewind)
+  {
+    startNs = 0;
+
+    // Resume from the latest keyframe at or before the seek target; the
+    // offset table makes this a binary search plus a backward scan over
+    // record headers
+    auto i = this->flatReader.LowerBound(endNs + 1);
+    while (i > 0)
+    {
+      --i;
+      const auto record = this->flatReader.Record(i);
+      if ((record.flags & kFlatStateKeyframe) == 0u)
+        continue;
+      if (!this->flatMsg.ParseFromArray(record.data,
+          static_cast<int>(record.size)))
+      {
+        continue;
+      }
+      for (const auto &entIt : this->flatMsg.entities())
+      {
+        if (!entIt.second.remove())
+          _entitiesToRemove.erase(Entity{entIt.second.id()});
+      }
+      this->Parse(_ecm, this->flatMsg);
+
+      // The keyframe holds the state at its own timestamp, including that
+      // step's changes, so replay resumes just after it
+      startNs = record.timeNs + 1;
+      gzdbg << "Seeking from keyframe at [" << 1e-9 * record.timeNs
+            << " s]." << std::endl;
+      break;
+    }
+  }
+
+  for (auto i = this->flatReader.LowerBound(startNs);
+      i < this->flatReader.RecordCount(); ++i)
+  {
+    const auto record = this->flatReader.Record(i);
+    if (record.timeNs > endNs)
+      break;
+
+    // Parse the payload straight out of the mapping
+    if (!this->flatMsg.ParseFromArray(record.data,
+        static_cast<int>(record.size)))
+    {
+      gzwarn << "Failed to parse flat log record at ["
+             << 1e-9 * record.timeNs << " s]." << std::endl;
+      continue;
+    }
+
+    // For seeking back in time only:
+    // While stepping, update the list of entities to be removed
+    // so we do not remove any entities that are to be created
+    if (_seekRewind)
+    {
+      for (const auto &entIt : this->flatMsg.entities())
+      {
+        Entity entity{entIt.second.id()};
+        if (entIt.second.remove())
+          _entitiesToRemove.insert(entity);
+        else
+          _entitiesToRemove.erase(entity);
+      }
+    }
+
+    if (!this->StrideSkips(_seekRewind) ||
+        !this->CanStrideSkip(_ecm, this->flatMsg))
+    {
+      this->Parse(_ecm, this->flatMsg);
+    }
+    this->ReplaceResourceURIs(_ecm);
+  }
+}
+
+//////////////////////////////////////////////////
+bool LogPlaybackPrivate::SeekToKeyframe(EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_endTime,
+    std::chrono::steady_clock::duration &_startTime,
+    std::set<Entity> &_entitiesToRemove)
+{
+  // Keyframes are recorded on their own topic; match by suffix because
+  // the world name is part of the topic.
+  auto keyframes = this->log->QueryMessages(transport::log::TopicPattern(
+      std::regex(".*/log/keyframe"),
+      {std::chrono::steady_clock::duration::zero(), _endTime}));
+
+  // The batch iterates forward only; keep the last keyframe in range
+  std::string lastData;
+  std::chrono::nanoseconds lastTime{-1};
+  for (auto it = keyframes.begin(); it != keyframes.end(); ++it)
+  {
+    lastData = it->Data();
+    lastTime = it->TimeReceived();
+  }
+  if (lastTime < std::chrono::nanoseconds::zero())
+    return false;
+
+  msgs::SerializedStateMap msg;
+  if (!msg.ParseFromString(lastData))
+  {
+    gzwarn << "Failed to parse keyframe message. Replaying from the "
+           << "beginning of the log." << std::endl;
+    return false;
+  }
+
+  // Entities in the keyframe exist at the seek target, so they must not
+  // be removed by the rewind logic
+  for (const auto &entIt : msg.entities())
+  {
+    if (!entIt.second.remove())
+      _entitiesToRemove.erase(Entity{entIt.second.id()});
+  }
+
+  this->Parse(_ecm, msg);
+
+  // The keyframe holds the state at its own timestamp, including that
+  // step's changes, so replay resumes just after it
+  _startTime = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      lastTime) + std::chrono::steady_clock::duration{1};
+
+  gzdbg << "Seeking from keyframe at ["
+        << std::chrono::duration<double>(lastTime).count() << " s]."
+        << std::endl;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LogPlaybackPrivate::StrideSkips(bool _seekRewind)
+{
+  if (this->stride <= 1u || _seekRewind)
+    return false;
+  return (this->strideCounter++ % this->stride) != 0u;
+}
+
+//////////////////////////////////////////////////
+bool LogPlaybackPrivate::CanStrideSkip(const EntityComponentManager &_ecm,
+    const msgs::SerializedStateMap &_msg) const
+{
+  for (const auto &entIt : _msg.entities())
+  {
+    if (entIt.second.remove() || !_ecm.HasEntity(Entity{entIt.second.id()}))
+      return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LogPlaybackPrivate::CanStrideSkip(const EntityComponentManager &_ecm,
+    const msgs::SerializedState &_msg) const
+{
+  for (const auto &entIt : _msg.entities())
+  {
+    if (entIt.remove() || !_ecm.HasEntity(Entity{entIt.id()}))
+      return false;
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 void LogPlaybackPrivate::Parse(EntityComponentManager &_ecm,
     const msgs::SerializedState &_msg)
@@ -158,6 +402,11 @@ void LogPlayback::Configure(const Entity &,
   // Get directory paths from SDF
   this->dataPtr->logPath = _sdf->Get<std::string>("playback_path");
 
+  // Apply every k-th state frame for fast scrubbing. Frames that create
+  // or remove entities are always applied.
+  this->dataPtr->stride = std::max<uint64_t>(1u,
+      _sdf->Get<uint64_t>("stride", 1u).first);
+
   this->dataPtr->eventManager = &_eventMgr;
 
   // Prepend working directory if path is relative
@@ -230,6 +479,14 @@ bool LogPlaybackPrivate::Start(EntityComponentManager &_ecm)
     gzerr << "Failed to open log file [" << dbPath << "]" << std::endl;
   }
 
+  // Memory-map the flat state sidecar when the recording includes one;
+  // state replay then parses payloads in place instead of querying sqlite
+  std::string flatPath = common::joinPaths(this->logPath, "state.flat");
+  if (common::exists(flatPath) && this->flatReader.Open(flatPath))
+  {
+    gzmsg << "Playing back states from flat log [" << flatPath << "]\n";
+  }
+
   // Access all messages in .tlog file
   this->batch = this->log->QueryMessages();
   auto iter = this->batch.begin();
@@ -500,80 +757,107 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
       entitiesToRemove.insert(Entity(entity.first));
 
     startTime = std::chrono::steady_clock::duration::zero();
-  }
 
-  this->dataPtr->batch = this->dataPtr->log->QueryMessages(
-      transport::log::AllTopics({startTime, endTime}));
+    // Logs recorded with <record_keyframe_period> contain periodic full
+    // state keyframes; resume from the latest one at or before the seek
+    // target instead of from the beginning. The flat log path below does
+    // its own keyframe seek.
+    if (!this->dataPtr->flatReader.Valid())
+    {
+      this->dataPtr->SeekToKeyframe(_ecm, endTime, startTime,
+          entitiesToRemove);
+    }
+  }
 
-  auto iter = this->dataPtr->batch.begin();
-  while (iter != this->dataPtr->batch.end())
+  if (this->dataPtr->flatReader.Valid())
   {
-    auto msgType = iter->Type();
+    // Replay straight from the memory-mapped flat log
+    this->dataPtr->UpdateFromFlat(_ecm, startTime, endTime, seekRewind,
+        entitiesToRemove);
+  }
+  else
+  {
+    this->dataPtr->batch = this->dataPtr->log->QueryMessages(
+        transport::log::AllTopics({startTime, endTime}));
 
-    if (msgType == "gz.msgs.SerializedState")
+    auto iter = this->dataPtr->batch.begin();
+    while (iter != this->dataPtr->batch.end())
     {
-      msgs::SerializedState msg;
-      msg.ParseFromString(iter->Data());
+      auto msgType = iter->Type();
 
-      // For seeking back in time only:
-      // While stepping, update the list of entities to be removed
-      // so we do not remove any entities that are to be created
-      if (seekRewind)
+      if (msgType == "gz.msgs.SerializedState")
       {
-        for (const auto &entIt : msg.entities())
+        msgs::SerializedState msg;
+        msg.ParseFromString(iter->Data());
+
+        // For seeking back in time only:
+        // While stepping, update the list of entities to be removed
+        // so we do not remove any entities that are to be created
+        if (seekRewind)
         {
-          Entity entity{entIt.id()};
-          if (entIt.remove())
-          {
-            entitiesToRemove.insert(entity);
-          }
-          else
+          for (const auto &entIt : msg.entities())
           {
-            entitiesToRemove.erase(entity);
+            Entity entity{entIt.id()};
+            if (entIt.remove())
+            {
+              entitiesToRemove.insert(entity);
+            }
+            else
+            {
+              entitiesToRemove.erase(entity);
+            }
           }
         }
-      }
 
-      this->dataPtr->Parse(_ecm, msg);
-    }
-    else if (msgType == "gz.msgs.SerializedStateMap")
-    {
-      msgs::SerializedStateMap msg;
-      msg.ParseFromString(iter->Data());
-
-      // For seeking back in time only:
-      // While stepping, update the list of entities to be removed
-      // so we do not remove any entities that are to be created
-      if (seekRewind)
+        if (!this->dataPtr->StrideSkips(seekRewind) ||
+            !this->dataPtr->CanStrideSkip(_ecm, msg))
+        {
+          this->dataPtr->Parse(_ecm, msg);
+        }
+      }
+      else if (msgType == "gz.msgs.SerializedStateMap")
       {
-        for (const auto &entIt : msg.entities())
+        msgs::SerializedStateMap msg;
+        msg.ParseFromString(iter->Data());
+
+        // For seeking back in time only:
+        // While stepping, update the list of entities to be removed
+        // so we do not remove any entities that are to be created
+        if (seekRewind)
         {
-          const auto &entityMsg = entIt.second;
-          Entity entity{entityMsg.id()};
-          if (entityMsg.remove())
+          for (const auto &entIt : msg.entities())
           {
-            entitiesToRemove.insert(entity);
-          }
-          else
-          {
-            entitiesToRemove.erase(entity);
+            const auto &entityMsg = entIt.second;
+            Entity entity{entityMsg.id()};
+            if (entityMsg.remove())
+            {
+              entitiesToRemove.insert(entity);
+            }
+            else
+            {
+              entitiesToRemove.erase(entity);
+            }
           }
         }
-      }
 
-      this->dataPtr->Parse(_ecm, msg);
-    }
-    else if (msgType == "gz.msgs.StringMsg")
-    {
-      // Do nothing, we assume this is the SDF string
-    }
-    else
-    {
-      gzwarn << "Trying to playback unsupported message type ["
-              << msgType << "]" << std::endl;
+        if (!this->dataPtr->StrideSkips(seekRewind) ||
+            !this->dataPtr->CanStrideSkip(_ecm, msg))
+        {
+          this->dataPtr->Parse(_ecm, msg);
+        }
+      }
+      else if (msgType == "gz.msgs.StringMsg")
+      {
+        // Do nothing, we assume this is the SDF string
+      }
+      else
+      {
+        gzwarn << "Trying to playback unsupported message type ["
+                << msgType << "]" << std::endl;
+      }
+      this->dataPtr->ReplaceResourceURIs(_ecm);
+      ++iter;
     }
-    this->dataPtr->ReplaceResourceURIs(_ecm);
-    ++iter;
   }
 
     // particle emitters
@@ -25,6 +25,13 @@
 #include <ctime>
 #include <set>
 #include <list>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -60,6 +67,8 @@
 
 #include "gz/sim/Util.hh"
 
+#include "FlatStateLog.hh"
+
 using namespace gz;
 using namespace gz::sim;
 using namespace gz::sim::systems;
@@ -104,6 +113,44 @@ class gz::sim::systems::LogRecordPrivate
   /// \brief Compress model resource files and state file into one file.
   public: void CompressStateAndResources();
 
+  /// \brief Serialize the changed state and hand it to the writer thread.
+  /// Snapshots carrying only periodic changes are dropped and counted if
+  /// the queue is at its watermark; snapshots carrying one-time changes
+  /// (entity creations, removals, one-time component changes) block until
+  /// the writer makes room, because dropping them would corrupt the log.
+  /// \param[in] _ecm Reference to an instance of entity component manager
+  /// \param[in] _simTime Current sim time
+  public: void EnqueueState(const EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_simTime);
+
+  /// \brief Serialize the full ECM state and hand it to the writer thread
+  /// as a keyframe. Keyframes let playback seek without replaying the log
+  /// from the beginning.
+  /// \param[in] _ecm Reference to an instance of entity component manager
+  /// \param[in] _simTime Current sim time
+  public: void EnqueueKeyframe(const EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_simTime);
+
+  /// \brief Move changedStateBuffer into the write queue, honoring the
+  /// watermark.
+  /// \param[in] _keyframe True to publish on the keyframe topic instead of
+  /// the changed state topic.
+  /// \param[in] _simTime Sim time of the snapshot
+  /// \param[in] _blockWhenFull True to wait for queue space instead of
+  /// dropping the snapshot when the watermark is reached. Used for
+  /// snapshots whose loss playback could never recover from.
+  public: void EnqueueBuffer(bool _keyframe,
+      const std::chrono::steady_clock::duration &_simTime,
+      bool _blockWhenFull = false);
+
+  /// \brief Body of the writer thread. Pops queued states and publishes
+  /// them to the recorder off the simulation thread.
+  public: void WriterLoop();
+
+  /// \brief Stop the writer thread, flushing queued states first, and
+  /// report how many snapshots were dropped, if any.
+  public: void StopWriter();
+
   /// \brief Indicator of whether any recorder instance has ever been started.
   /// Currently, only one instance is allowed. This enforcement may be removed
   /// in the future.
@@ -143,6 +190,81 @@ class gz::sim::systems::LogRecordPrivate
   /// \brief Publisher for state changes
   public: transport::Node::Publisher statePub;
 
+  /// \brief Buffer reused across steps for the serialized changed state,
+  /// published through the raw path so the state is serialized exactly once.
+  public: std::string changedStateBuffer;
+
+  /// \brief Publisher for full state keyframes
+  public: transport::Node::Publisher keyframePub;
+
+  /// \brief Message reused across keyframes for the full ECM state
+  public: msgs::SerializedStateMap keyframeMsg;
+
+  /// \brief Time period between full state keyframes. Zero disables
+  /// keyframes.
+  public: std::chrono::steady_clock::duration keyframePeriod{0};
+
+  /// \brief Last time a keyframe was recorded
+  public: std::chrono::steady_clock::duration lastKeyframeSimTime{0};
+
+  /// \brief A serialized state awaiting the writer thread
+  public: struct QueuedState
+  {
+    /// \brief Serialized SerializedStateMap bytes
+    std::string data;
+
+    /// \brief Sim time of the snapshot
+    std::chrono::steady_clock::duration time{0};
+
+    /// \brief True if this is a full state keyframe
+    bool keyframe{false};
+  };
+
+  /// \brief States serialized on the simulation thread, awaiting
+  /// publication by the writer thread. Protected by writeMutex.
+  public: std::deque<QueuedState> writeQueue;
+
+  /// \brief Spare buffers recycled from the writer thread so steady-state
+  /// recording does not allocate. Protected by writeMutex.
+  public: std::vector<std::string> spareBuffers;
+
+  /// \brief Sum of the sizes of the states in writeQueue
+  public: std::size_t queuedBytes{0u};
+
+  /// \brief Watermark on queuedBytes. Snapshots arriving while the queue
+  /// is at the watermark are dropped and counted instead of stalling the
+  /// simulation.
+  public: std::size_t maxQueuedBytes{64u << 20};
+
+  /// \brief Number of snapshots dropped at the watermark
+  public: uint64_t droppedStates{0u};
+
+  /// \brief Bytes dropped at the watermark
+  public: uint64_t droppedBytes{0u};
+
+  /// \brief Protects writeQueue, spareBuffers and the drop counters
+  public: std::mutex writeMutex;
+
+  /// \brief Signals the writer thread that work or shutdown is pending
+  public: std::condition_variable writeCv;
+
+  /// \brief Signals producers that the writer freed queue space.
+  public: std::condition_variable spaceCv;
+
+  /// \brief Set to false to stop the writer thread. Protected by
+  /// writeMutex.
+  public: bool writerRunning{false};
+
+  /// \brief Thread that publishes queued states to the recorder
+  public: std::thread writerThread;
+
+  /// \brief Whether to also write states to a flat, memory-mappable
+  /// sidecar file that playback can mmap instead of querying sqlite
+  public: bool recordFlatState{false};
+
+  /// \brief Flat sidecar writer, driven by the writer thread only
+  public: FlatStateLogWriter flatWriter;
+
   /// \brief Message holding SDF string of world
   public: msgs::StringMsg sdfMsg;
 
@@ -191,6 +313,9 @@ LogRecord::~LogRecord()
 {
   if (this->dataPtr->instStarted)
   {
+    // Flush queued states to the recorder before stopping it
+    this->dataPtr->StopWriter();
+
     // Use gz-transport directly
     this->dataPtr->recorder.Stop();
 
@@ -220,9 +345,34 @@ void LogRecord::Configure(const Entity &_entity,
     std::chrono::duration<double>(
     _sdf->Get<double>("record_period", 0.0).first));
 
+  // Also write states to a flat, memory-mappable sidecar file
+  this->dataPtr->recordFlatState =
+    _sdf->Get<bool>("record_flat_state", false).first;
+
+  // Period between full state keyframes, in seconds. Zero, the default,
+  // disables keyframes.
+  this->dataPtr->keyframePeriod =
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<double>(
+    _sdf->Get<double>("record_keyframe_period", 0.0).first));
+
   this->dataPtr->compress = _sdf->Get<bool>("compress", false).first;
   this->dataPtr->cmpPath = _sdf->Get<std::string>("compress_path", "").first;
 
+  // Watermark on the state snapshots buffered for the writer thread, in MB
+  const double recordBuffer = _sdf->Get<double>("record_buffer", 64.0).first;
+  if (recordBuffer > 0.0)
+  {
+    this->dataPtr->maxQueuedBytes =
+        static_cast<std::size_t>(recordBuffer * (1u << 20));
+  }
+  else
+  {
+    gzwarn << "Ignoring non-positive <record_buffer> [" << recordBuffer
+           << "]. Using default ["
+           << (this->dataPtr->maxQueuedBytes >> 20) << " MB].\n";
+  }
+
   // If plugin is specified in both the SDF tag and on command line, only
   //   activate one recorder.
   if (!LogRecordPrivate::started)
@@ -320,6 +470,21 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
            << stateTopic << "]." << std::endl;
   }
 
+  // Full state keyframes, recorded alongside the changed states so
+  // playback can seek without replaying from the beginning
+  std::string keyframeTopic = "/world/" + this->worldName + "/log/keyframe";
+  auto validKeyframeTopic = transport::TopicUtils::AsValidTopic(keyframeTopic);
+  if (!validKeyframeTopic.empty())
+  {
+    this->keyframePub = this->node.Advertise<msgs::SerializedStateMap>(
+        validKeyframeTopic);
+  }
+  else
+  {
+    gzerr << "Failed to generate valid topic to publish keyframes. Tried ["
+           << keyframeTopic << "]." << std::endl;
+  }
+
   // Append file name
   std::string dbPath = common::joinPaths(this->logPath, "state.tlog");
   if (common::exists(dbPath))
@@ -334,6 +499,11 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   gzdbg << "Recording default topic[" << stateTopic << "].\n";
   this->recorder.AddTopic(sdfTopic);
   this->recorder.AddTopic(stateTopic);
+  if (this->keyframePeriod > std::chrono::steady_clock::duration::zero())
+  {
+    gzdbg << "Recording default topic[" << keyframeTopic << "].\n";
+    this->recorder.AddTopic(keyframeTopic);
+  }
 
   // Get the topics to record, if any.
   if (this->sdf->HasElement("record_topic"))
@@ -371,6 +541,22 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   if (this->recorder.Start(dbPath) ==
       transport::log::RecorderError::SUCCESS)
   {
+    // Flat, memory-mappable sidecar next to the sqlite log; playback
+    // mmaps it instead of querying sqlite when it is present
+    if (this->recordFlatState)
+    {
+      std::string flatPath = common::joinPaths(this->logPath, "state.flat");
+      if (this->flatWriter.Open(flatPath))
+        gzmsg << "Recording flat state file [" << flatPath << "]\n";
+      else
+        gzwarn << "Failed to open flat state file [" << flatPath << "]\n";
+    }
+
+    // Hand serialized states to a dedicated thread so the recorder's disk
+    // writes never block the simulation step.
+    this->writerRunning = true;
+    this->writerThread = std::thread(&LogRecordPrivate::WriterLoop, this);
+
     this->instStarted = true;
     return true;
   }
@@ -378,6 +564,168 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
     return false;
 }
 
+//////////////////////////////////////////////////
+void LogRecordPrivate::EnqueueState(const EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_simTime)
+{
+  // Serialize the changed state directly into a reused flat buffer on the
+  // simulation thread, where the ECM can be accessed safely.
+  _ecm.ChangedState(this->changedStateBuffer);
+  if (this->changedStateBuffer.empty())
+    return;
+
+  // Periodic changes repair themselves in the log on their next change,
+  // so those snapshots may be dropped under backpressure. One-time
+  // changes never recur: losing one diverges playback permanently, so
+  // those snapshots wait for queue space instead.
+  const bool oneTimeChanges = _ecm.HasNewEntities() ||
+      _ecm.HasEntitiesMarkedForRemoval() ||
+      _ecm.HasOneTimeComponentChanges();
+
+  this->EnqueueBuffer(false, _simTime, oneTimeChanges);
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::EnqueueKeyframe(const EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_simTime)
+{
+  this->keyframeMsg.Clear();
+  _ecm.State(this->keyframeMsg, {}, {}, true);
+  if (!this->keyframeMsg.SerializeToString(&this->changedStateBuffer) ||
+      this->changedStateBuffer.empty())
+  {
+    return;
+  }
+
+  this->EnqueueBuffer(true, _simTime);
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::EnqueueBuffer(bool _keyframe,
+    const std::chrono::steady_clock::duration &_simTime,
+    bool _blockWhenFull)
+{
+  std::unique_lock<std::mutex> lock(this->writeMutex);
+  if (this->queuedBytes + this->changedStateBuffer.size() >
+      this->maxQueuedBytes)
+  {
+    if (_blockWhenFull && this->writerRunning)
+    {
+      // This snapshot carries one-time changes the log can never
+      // recover; stall the simulation until the writer frees room.
+      gzwarn << "State recording buffer is full [" << this->queuedBytes
+             << " queued bytes]; pausing simulation until the recorder "
+             << "catches up to avoid losing one-time changes."
+             << std::endl;
+      this->spaceCv.wait(lock, [this]
+          {
+            return this->queuedBytes + this->changedStateBuffer.size() <=
+                this->maxQueuedBytes || !this->writerRunning;
+          });
+    }
+    else
+    {
+      // The writer thread is not keeping up. This snapshot only carries
+      // periodic changes, which repair themselves in the log on their
+      // next change, so dropping it is preferable to stalling the
+      // simulation.
+      this->droppedBytes += this->changedStateBuffer.size();
+      if (this->droppedStates++ % 100u == 0u)
+      {
+        gzwarn << "State recording buffer is full [" << this->queuedBytes
+               << " queued bytes]. Dropped " << this->droppedStates
+               << " state snapshot(s) so far." << std::endl;
+      }
+      return;
+    }
+  }
+  this->queuedBytes += this->changedStateBuffer.size();
+
+  // Swap the serialized state with a recycled buffer so the next step
+  // serializes into already-grown storage.
+  QueuedState queued;
+  queued.time = _simTime;
+  queued.keyframe = _keyframe;
+  if (!this->spareBuffers.empty())
+  {
+    queued.data = std::move(this->spareBuffers.back());
+    this->spareBuffers.pop_back();
+  }
+  std::swap(queued.data, this->changedStateBuffer);
+  this->writeQueue.push_back(std::move(queued));
+  this->writeCv.notify_one();
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::WriterLoop()
+{
+  const std::string msgType(msgs::SerializedStateMap().GetTypeName());
+
+  std::unique_lock<std::mutex> lock(this->writeMutex);
+  while (true)
+  {
+    this->writeCv.wait(lock, [this]
+        {
+          return !this->writeQueue.empty() || !this->writerRunning;
+        });
+
+    // Drain the queue before honoring a stop so every accepted snapshot
+    // reaches the recorder.
+    if (this->writeQueue.empty())
+      break;
+
+    QueuedState queued = std::move(this->writeQueue.front());
+    this->writeQueue.pop_front();
+    this->queuedBytes -= queued.data.size();
+    this->spaceCv.notify_all();
+
+    lock.unlock();
+    // The recorder subscribes to these topics and performs the sqlite
+    // write in its own callback, entirely off the simulation thread.
+    if (queued.keyframe)
+      this->keyframePub.PublishRaw(queued.data, msgType);
+    else
+      this->statePub.PublishRaw(queued.data, msgType);
+    if (this->flatWriter.Valid())
+    {
+      this->flatWriter.Append(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+          queued.time).count(),
+          queued.keyframe ? kFlatStateKeyframe : 0u, queued.data);
+    }
+    queued.data.clear();
+    lock.lock();
+
+    if (this->spareBuffers.size() < 4u)
+      this->spareBuffers.push_back(std::move(queued.data));
+  }
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::StopWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->writeMutex);
+    if (!this->writerRunning)
+      return;
+    this->writerRunning = false;
+  }
+  this->writeCv.notify_one();
+  this->spaceCv.notify_all();
+  if (this->writerThread.joinable())
+    this->writerThread.join();
+
+  // Finalize the flat sidecar's offset table
+  this->flatWriter.Close();
+
+  if (this->droppedStates > 0u)
+  {
+    gzwarn << "Dropped " << this->droppedStates << " state snapshot(s) ["
+           << this->droppedBytes << " bytes] because the recording buffer "
+           << "was full. Consider raising <record_buffer>." << std::endl;
+  }
+}
+
 //////////////////////////////////////////////////
 bool LogRecordPrivate::RecordResources() const
 {
@@ -723,10 +1071,20 @@ void LogRecord::PostUpdate(const UpdateInfo &_info,
   // (especially in tools like plotting or seeking through logs).
   if (record)
   {
-    msgs::SerializedStateMap stateMsg;
-    _ecm.ChangedState(stateMsg);
-    if (!stateMsg.entities().empty())
-      this->dataPtr->statePub.Publish(stateMsg);
+    // Serialize on this thread, then hand the buffer to the writer thread,
+    // which publishes the raw bytes to the recorder.
+    this->dataPtr->EnqueueState(_ecm, _info.simTime);
+  }
+
+  // Record a full state keyframe periodically so playback can seek to it
+  // instead of replaying the log from the beginning
+  if (this->dataPtr->keyframePeriod >
+      std::chrono::steady_clock::duration::zero() &&
+      (_info.simTime - this->dataPtr->lastKeyframeSimTime) >=
+      this->dataPtr->keyframePeriod)
+  {
+    this->dataPtr->lastKeyframeSimTime = _info.simTime;
+    this->dataPtr->EnqueueKeyframe(_ecm, _info.simTime);
   }
 
   // If there are new models loaded, save meshes and textures
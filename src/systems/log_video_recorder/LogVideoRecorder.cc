@@ -230,25 +230,32 @@ void LogVideoRecorder::PostUpdate(const UpdateInfo &_info,
 {
   GZ_PROFILE("LogVideoRecorder::PostUpdate");
 
-  // record videos for models in the specified regions.
-  if (!this->dataPtr->regions.empty())
+  // record videos for models in the specified regions. Poses only change
+  // while playback is running, so the scan is skipped on paused steps.
+  if (!this->dataPtr->regions.empty() && !_info.paused)
   {
     _ecm.Each<components::Model, components::Name, components::Pose>(
         [&](const Entity &, const components::Model *,
             const components::Name *_nameComp,
             const components::Pose *_poseComp) -> bool
         {
-          math::Pose3d p = _poseComp->Data();
+          // Models already recorded or queued don't need the box tests.
+          const std::string &name = _nameComp->Data();
+          if (this->dataPtr->modelsRecorded.find(name) !=
+              this->dataPtr->modelsRecorded.end() ||
+              this->dataPtr->modelsToRecord.find(name) !=
+              this->dataPtr->modelsToRecord.end())
+          {
+            return true;
+          }
+
+          const math::Pose3d &p = _poseComp->Data();
           for (const auto &box : this->dataPtr->regions)
           {
             if (box.Contains(p.Pos()))
             {
-              const std::string &name = _nameComp->Data();
-              if (this->dataPtr->modelsRecorded.find(name) ==
-                  this->dataPtr->modelsRecorded.end())
-              {
-                this->dataPtr->modelsToRecord.insert(name);
-              }
+              this->dataPtr->modelsToRecord.insert(name);
+              break;
             }
           }
           return true;
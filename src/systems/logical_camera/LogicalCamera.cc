@@ -19,11 +19,13 @@
 
 #include <gz/msgs/logical_camera_image.pb.h>
 
+#include <cmath>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
 #include <gz/plugin/Register.hh>
@@ -253,17 +255,34 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("LogicalCameraPrivate::UpdateLogicalCameras");
-  std::map<std::string, math::Pose3d> modelPoses;
 
+  // Collect the models first so their world poses can be resolved in one
+  // pass, sharing ancestor poses between nested models.
+  std::vector<std::pair<Entity, std::string>> models;
   _ecm.Each<components::Model, components::Name>(
     [&](const Entity &_entity,
       const components::Model *,
       const components::Name *_name)->bool
     {
-      modelPoses[_name->Data()] = worldPose(_entity, _ecm);
+      models.emplace_back(_entity, _name->Data());
       return true;
     });
 
+  std::vector<Entity> modelEntities;
+  modelEntities.reserve(models.size());
+  for (const auto &model : models)
+    modelEntities.push_back(model.first);
+
+  auto poses = worldPoses(modelEntities, _ecm);
+
+  // Flat position array shared by every camera's culling pass below, so
+  // the per-model work inside the per-camera loop is a pair of branch-light
+  // vector tests instead of map lookups.
+  std::vector<math::Vector3d> modelPositions;
+  modelPositions.reserve(models.size());
+  for (const auto &model : models)
+    modelPositions.push_back(poses[model.first].Pos());
+
   _ecm.Each<components::LogicalCamera, components::WorldPose>(
     [&](const Entity &_entity,
         const components::LogicalCamera * /*_logicalCamera*/,
@@ -274,9 +293,38 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
         {
           const math::Pose3d &worldPose = _worldPose->Data();
           it->second->SetPose(worldPose);
-          // Make a copy of modelPoses s.t. SetModelPoses can take ownership
-          auto modelPoses_ = modelPoses;
-          it->second->SetModelPoses(std::move(modelPoses_));
+
+          // The sensor tests model positions against its frustum, so any
+          // model farther from the camera than the far-plane corners, or
+          // behind the near plane, can be culled here without changing the
+          // result. The corner distance bounds the frustum's reach:
+          // far * sqrt(1 + tan^2(hfov/2) + tan^2(vfov/2)).
+          const double farClip = it->second->Far();
+          const double tanHalfH =
+              std::tan(it->second->HorizontalFOV().Radian() / 2.0);
+          const double aspect = it->second->AspectRatio();
+          const double tanHalfV =
+              aspect > 0.0 ? tanHalfH / aspect : tanHalfH;
+          const double cullRadiusSq = farClip * farClip *
+              (1.0 + tanHalfH * tanHalfH + tanHalfV * tanHalfV);
+
+          const math::Vector3d &cameraPos = worldPose.Pos();
+          const math::Vector3d forward =
+              worldPose.Rot().RotateVector(math::Vector3d::UnitX);
+
+          std::map<std::string, math::Pose3d> culledPoses;
+          for (std::size_t i = 0; i < models.size(); ++i)
+          {
+            const math::Vector3d d = modelPositions[i] - cameraPos;
+            if (d.SquaredLength() > cullRadiusSq)
+              continue;
+            // Behind the camera; the near plane sits at a non-negative
+            // distance, so this test is conservative.
+            if (d.Dot(forward) < 0.0)
+              continue;
+            culledPoses[models[i].second] = poses[models[i].first];
+          }
+          it->second->SetModelPoses(std::move(culledPoses));
         }
         else
         {
@@ -33,13 +33,11 @@
 #include <gz/sensors/SensorFactory.hh>
 #include <gz/sensors/MagnetometerSensor.hh>
 
-#include "gz/sim/components/MagneticField.hh"
 #include "gz/sim/components/Magnetometer.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/Sensor.hh"
-#include "gz/sim/components/World.hh"
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/Util.hh"
 
@@ -144,13 +142,13 @@ class gz::sim::systems::MagnetometerPrivate
   /// \param[in] _ecm Immutable reference to ECM.
   /// \param[in] _entity Entity of the IMU
   /// \param[in] _magnetometer Magnetometer component.
-  /// \param[in] _worldField MagneticField component.
+  /// \param[in] _worldField World magnetic field, in the world frame.
   /// \param[in] _parent Parent entity component.
   public: void AddMagnetometer(
     const EntityComponentManager &_ecm,
     const Entity _entity,
     const components::Magnetometer *_magnetometer,
-    const components::MagneticField *_worldField,
+    const math::Vector3d &_worldField,
     const components::ParentEntity *_parent);
 
   /// \brief Create magnetometer sensor
@@ -347,7 +345,7 @@ void MagnetometerPrivate::AddMagnetometer(
   const EntityComponentManager &_ecm,
   const Entity _entity,
   const components::Magnetometer *_magnetometer,
-  const components::MagneticField *_worldField,
+  const math::Vector3d &_worldField,
   const components::ParentEntity *_parent)
 {
   // create sensor
@@ -376,7 +374,7 @@ void MagnetometerPrivate::AddMagnetometer(
       _parent->Data())->Data();
   sensor->SetParent(parentName);
 
-  sensor->SetWorldMagneticField(_worldField->Data());
+  sensor->SetWorldMagneticField(_worldField);
 
   // Get initial pose of sensor and set the reference z pos
   // The WorldPose component was just created and so it's empty
@@ -393,20 +391,22 @@ void MagnetometerPrivate::AddMagnetometer(
 void MagnetometerPrivate::CreateSensors(const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("MagnetometerPrivate::CreateMagnetometerEntities");
-  auto worldEntity = _ecm.EntityByComponents(components::World());
-  if (kNullEntity == worldEntity)
+  // Read the world entity and magnetic field from the per-step snapshot
+  // instead of looking them up on every call.
+  const auto &constants = worldConstants(_ecm);
+  if (kNullEntity == constants.world)
   {
     gzerr << "Missing world entity." << std::endl;
     return;
   }
 
   // Get the world magnetic field (defined in world frame)
-  auto worldField = _ecm.Component<components::MagneticField>(worldEntity);
-  if (nullptr == worldField)
+  if (!constants.hasMagneticField)
   {
     gzerr << "World missing magnetic field." << std::endl;
     return;
   }
+  const math::Vector3d &worldField = constants.magneticField;
 
   if (!this->initialized)
   {
@@ -455,8 +455,11 @@ void MagnetometerPrivate::Update(
           const math::Pose3d &magnetometerWorldPose = _worldPose->Data();
           it->second->SetWorldPose(magnetometerWorldPose);
 
-          // Position
-          auto latLonEle = sphericalCoordinates(_entity, _ecm);
+          // Position. The WorldPose component already holds the sensor's
+          // world pose, so pass it along instead of letting the helper
+          // climb the kinematic tree again.
+          auto latLonEle =
+              sphericalCoordinates(_entity, _ecm, magnetometerWorldPose);
           if (!latLonEle)
           {
             gzwarn << "Failed to update Magnetometer sensor enity [" << _entity
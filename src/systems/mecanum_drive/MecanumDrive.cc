@@ -21,10 +21,12 @@
 #include <gz/msgs/pose_v.pb.h>
 #include <gz/msgs/twist.pb.h>
 
+#include <cstddef>
 #include <limits>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -60,6 +62,28 @@ struct Commands
   Commands() : lin(0.0), lat(0.0), ang(0.0) {}
 };
 
+//////////////////////////////////////////////////
+/// \brief Append or overwrite one joint's velocity command in a reused
+/// batch, recycling the slot's storage when the slot already exists.
+/// \param[in, out] _batch Batch of joint velocity commands.
+/// \param[in] _index Slot to write.
+/// \param[in] _joint Joint entity.
+/// \param[in] _speed Joint speed to command.
+static void SetWheelCmdBatchEntry(
+    std::vector<std::pair<Entity, std::vector<double>>> &_batch,
+    std::size_t _index, Entity _joint, double _speed)
+{
+  if (_index < _batch.size())
+  {
+    _batch[_index].first = _joint;
+    _batch[_index].second.assign(1, _speed);
+  }
+  else
+  {
+    _batch.emplace_back(_joint, std::vector<double>{_speed});
+  }
+}
+
 class gz::sim::systems::MecanumDrivePrivate
 {
   /// \brief Callback for velocity subscription
@@ -124,9 +148,18 @@ class gz::sim::systems::MecanumDrivePrivate
   /// \brief Model interface
   public: Model model{kNullEntity};
 
+  /// \brief Model name, cached on Configure so per-step code doesn't
+  /// re-fetch the name component.
+  public: std::string modelName;
+
   /// \brief The model's canonical link.
   public: Link canonicalLink{kNullEntity};
 
+  /// \brief Reused batch of wheel joint velocity commands, written to the
+  /// ECM in a single call each step.
+  public: std::vector<std::pair<Entity, std::vector<double>>>
+    wheelVelocityCmdBatch;
+
   /// \brief Update period calculated from <odom__publish_frequency>.
   public: std::chrono::steady_clock::duration odomPubPeriod{0};
 
@@ -194,6 +227,8 @@ void MecanumDrive::Configure(const Entity &_entity,
     return;
   }
 
+  this->dataPtr->modelName = this->dataPtr->model.Name(_ecm);
+
   // Get params from SDF
   auto sdfElem = _sdf->FindElement("front_left_joint");
   while (sdfElem)
@@ -288,7 +323,7 @@ void MecanumDrive::Configure(const Entity &_entity,
   {
     topics.push_back(_sdf->Get<std::string>("topic"));
   }
-  topics.push_back("/model/" + this->dataPtr->model.Name(_ecm) + "/cmd_vel");
+  topics.push_back("/model/" + this->dataPtr->modelName + "/cmd_vel");
   auto topic = validTopic(topics);
 
   this->dataPtr->node.Subscribe(topic, &MecanumDrivePrivate::OnCmdVel,
@@ -299,14 +334,14 @@ void MecanumDrive::Configure(const Entity &_entity,
   {
     odomTopics.push_back(_sdf->Get<std::string>("odom_topic"));
   }
-  odomTopics.push_back("/model/" + this->dataPtr->model.Name(_ecm) +
+  odomTopics.push_back("/model/" + this->dataPtr->modelName +
       "/odometry");
   auto odomTopic = validTopic(odomTopics);
 
   this->dataPtr->odomPub = this->dataPtr->node.Advertise<msgs::Odometry>(
       odomTopic);
 
-  std::string tfTopic{"/model/" + this->dataPtr->model.Name(_ecm) +
+  std::string tfTopic{"/model/" + this->dataPtr->modelName +
     "/tf"};
   if (_sdf->HasElement("tf_topic"))
     tfTopic = _sdf->Get<std::string>("tf_topic");
@@ -339,7 +374,7 @@ void MecanumDrive::PreUpdate(const gz::sim::UpdateInfo &_info,
 
   // If the joints haven't been identified yet, look for them
   static std::set<std::string> warnedModels;
-  auto modelName = this->dataPtr->model.Name(_ecm);
+  const std::string &modelName = this->dataPtr->modelName;
   if (this->dataPtr->frontLeftJoints.empty() ||
       this->dataPtr->frontRightJoints.empty() ||
       this->dataPtr->backLeftJoints.empty() ||
@@ -423,33 +458,38 @@ void MecanumDrive::PreUpdate(const gz::sim::UpdateInfo &_info,
   if (_info.paused)
     return;
 
+  // Gather the wheel velocity commands into a reused batch and write them
+  // in one call, so the component change tracking is resolved once per
+  // step instead of once per joint.
+  auto &batch = this->dataPtr->wheelVelocityCmdBatch;
+  std::size_t wheelCount = 0;
   for (Entity joint : this->dataPtr->frontLeftJoints)
   {
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->frontLeftJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->frontLeftJointSpeed);
   }
 
   for (Entity joint : this->dataPtr->frontRightJoints)
   {
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->frontRightJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->frontRightJointSpeed);
   }
 
   for (Entity joint : this->dataPtr->backLeftJoints)
   {
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->backLeftJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->backLeftJointSpeed);
   }
 
   for (Entity joint : this->dataPtr->backRightJoints)
   {
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->backRightJointSpeed});
+    SetWheelCmdBatchEntry(batch, wheelCount++, joint,
+        this->dataPtr->backRightJointSpeed);
   }
+  batch.resize(wheelCount);
+
+  // Update wheel velocities
+  _ecm.SetComponentDataBatch<components::JointVelocityCmd>(batch);
 }
 
 //////////////////////////////////////////////////
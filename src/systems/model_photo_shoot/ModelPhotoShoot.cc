@@ -18,11 +18,13 @@
 
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Image.hh>
 #include <gz/plugin/Register.hh>
 #include <gz/rendering/Camera.hh>
+#include <gz/rendering/Image.hh>
 #include <gz/rendering/Scene.hh>
 #include <gz/rendering/RenderingIface.hh>
 #include <gz/rendering/Visual.hh>
@@ -49,9 +51,15 @@ class gz::sim::systems::ModelPhotoShootPrivate
   public: void PerformPostRenderingOperations();
 
   /// \brief Save a pitcture with the camera from the given pose.
+  /// \param[in] _camera Camera to capture with.
+  /// \param[in] _pose Camera world pose for the shot.
+  /// \param[in] _fileName File to save the image to.
+  /// \param[in] _image Reusable capture buffer, shared across shots so
+  /// each view doesn't allocate a full-resolution image.
   public: void SavePicture (const gz::rendering::CameraPtr _camera,
                     const gz::math::Pose3d &_pose,
-                    const std::string &_fileName) const;
+                    const std::string &_fileName,
+                    gz::rendering::Image &_image) const;
 
   /// \brief Name of the loaded model.
   public: std::string modelName;
@@ -198,6 +206,11 @@ void ModelPhotoShoot::PreUpdate(
 //////////////////////////////////////////////////
 void ModelPhotoShootPrivate::PerformPostRenderingOperations()
 {
+  // All shots are taken on a single render event; later events have
+  // nothing to do.
+  if (!this->takePicture)
+    return;
+
   gz::rendering::ScenePtr scene =
       gz::rendering::sceneFromFirstRenderEngine();
   gz::rendering::VisualPtr modelVisual =
@@ -205,7 +218,7 @@ void ModelPhotoShootPrivate::PerformPostRenderingOperations()
 
   gz::rendering::VisualPtr root = scene->RootVisual();
 
-  if (modelVisual && this->takePicture)
+  if (modelVisual)
   {
     scene->SetAmbientLight(0.3, 0.3, 0.3);
 
@@ -242,46 +255,62 @@ void ModelPhotoShootPrivate::PerformPostRenderingOperations()
           this->savingFile << "Scaling: " << scaling << std::endl;
         }
 
+        // Precompute all view poses, then capture them back to back with a
+        // shared image buffer so the only per-shot work is the render and
+        // the PNG write.
+        std::vector<std::pair<gz::math::Pose3d, std::string>> views;
+        views.reserve(5);
+
         gz::math::Pose3d pose;
         // Perspective view
         pose.Pos().Set(1.6 / scaling + translation.X(),
                        -1.6 / scaling + translation.Y(),
                        1.2 / scaling + translation.Z());
         pose.Rot().SetFromEuler(0, GZ_DTOR(30), GZ_DTOR(-225));
-        SavePicture(camera, pose, "1.png");
+        views.push_back({pose, "1.png"});
 
         // Top view
         pose.Pos().Set(0 + translation.X(),
                        0 + translation.Y(),
                        2.2 / scaling + translation.Z());
         pose.Rot().SetFromEuler(0, GZ_DTOR(90), 0);
-        SavePicture(camera, pose, "2.png");
+        views.push_back({pose, "2.png"});
 
         // Front view
         pose.Pos().Set(2.2 / scaling + translation.X(),
                        0 + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, GZ_DTOR(-180));
-        SavePicture(camera, pose, "3.png");
+        views.push_back({pose, "3.png"});
 
         // Side view
         pose.Pos().Set(0 + translation.X(),
                        2.2 / scaling + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, GZ_DTOR(-90));
-        SavePicture(camera, pose, "4.png");
+        views.push_back({pose, "4.png"});
 
         // Back view
         pose.Pos().Set(-2.2 / scaling + translation.X(),
                        0 + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, 0);
-        SavePicture(camera, pose, "5.png");
+        views.push_back({pose, "5.png"});
+
+        auto cameraImage = camera->CreateImage();
+        for (const auto &[viewPose, fileName] : views)
+          SavePicture(camera, viewPose, fileName, cameraImage);
 
         this->takePicture = false;
+        break;
       }
     }
   }
+
+  // Once the shoot is done there is no reason to keep running on every
+  // render event.
+  if (!this->takePicture)
+    this->connection.reset();
 }
 
 //////////////////////////////////////////////////
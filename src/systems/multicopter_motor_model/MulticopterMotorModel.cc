@@ -25,6 +25,7 @@
 #include "MulticopterMotorModel.hh"
 
 #include <mutex>
+#include <optional>
 #include <string>
 
 #include <gz/msgs/actuators.pb.h>
@@ -142,6 +143,17 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   /// \brief Parent link Entity
   public: Entity parentLinkEntity;
 
+  /// \brief Entity of the world wind, looked up once.
+  public: Entity windEntity{kNullEntity};
+
+  /// \brief Pose of the joint relative to its child link, cached from the
+  /// Pose component since it doesn't change during simulation.
+  public: std::optional<math::Pose3d> jointPose;
+
+  /// \brief Joint axis expressed in the joint frame, cached from the
+  /// JointAxis component since it doesn't change during simulation.
+  public: std::optional<math::Vector3d> jointAxisXyz;
+
   /// \brief Parent link name
   public: std::string parentLinkName;
 
@@ -578,36 +590,45 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
       Link link(this->linkEntity);
       const auto worldPose = link.WorldPose(_ecm);
 
-      // Apply a force to the link.
-      link.AddWorldForce(_ecm,
-                         worldPose->Rot().RotateVector(Vector3(0, 0, thrust)));
+      const Vector3 thrustForceWorld =
+          worldPose->Rot().RotateVector(Vector3(0, 0, thrust));
 
-      const auto jointPose = _ecm.Component<components::Pose>(
-          this->jointEntity);
-      if (!jointPose)
+      // Cache the joint pose and axis on first use; both are fixed for the
+      // lifetime of the joint.
+      if (!this->jointPose || !this->jointAxisXyz)
       {
-        gzerr << "joint " << this->jointName << " has no Pose"
-               << "component" << std::endl;
-        return;
+        const auto jointPoseComp = _ecm.Component<components::Pose>(
+            this->jointEntity);
+        if (!jointPoseComp)
+        {
+          gzerr << "joint " << this->jointName << " has no Pose"
+                 << "component" << std::endl;
+          return;
+        }
+
+        const auto jointAxisComp = _ecm.Component<components::JointAxis>(
+            this->jointEntity);
+        if (!jointAxisComp)
+        {
+          gzerr << "joint " << this->jointName << " has no JointAxis"
+                 << "component" << std::endl;
+          return;
+        }
+
+        this->jointPose = jointPoseComp->Data();
+        this->jointAxisXyz = jointAxisComp->Data().Xyz();
       }
+
       // computer joint world pose by multiplying child link WorldPose
       // with joint Pose
-      Pose jointWorldPose = *worldPose * jointPose->Data();
-
-      const auto jointAxisComp = _ecm.Component<components::JointAxis>(
-          this->jointEntity);
-      if (!jointAxisComp)
-      {
-        gzerr << "joint " << this->jointName << " has no JointAxis"
-               << "component" << std::endl;
-        return;
-      }
+      Pose jointWorldPose = *worldPose * *this->jointPose;
 
       const auto worldLinearVel = link.WorldLinearVelocity(_ecm);
 
-      Entity windEntity = _ecm.EntityByComponents(components::Wind());
+      if (this->windEntity == kNullEntity)
+        this->windEntity = _ecm.EntityByComponents(components::Wind());
       auto windLinearVel =
-          _ecm.Component<components::WorldLinearVelocity>(windEntity);
+          _ecm.Component<components::WorldLinearVelocity>(this->windEntity);
       Vector3 windSpeedWorld = windLinearVel->Data();
 
       // Forces from Philppe Martin's and Erwan Salaun's
@@ -615,7 +636,7 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
       // The True Role of Accelerometer Feedback in Quadrotor Control
       // - \omega * \lambda_1 * V_A^{\perp}
       Vector3 jointAxis =
-          jointWorldPose.Rot().RotateVector(jointAxisComp->Data().Xyz());
+          jointWorldPose.Rot().RotateVector(*this->jointAxisXyz);
       Vector3 bodyVelocityWorld = *worldLinearVel;
       Vector3 relativeWindVelocityWorld = bodyVelocityWorld - windSpeedWorld;
       Vector3 bodyVelocityPerpendicular =
@@ -625,8 +646,9 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
                                this->rotorDragCoefficient *
                                bodyVelocityPerpendicular;
 
-      // Apply air drag to link.
-      link.AddWorldForce(_ecm, airDrag);
+      // Apply the thrust and air drag to the link in a single wrench
+      // update.
+      link.AddWorldForce(_ecm, thrustForceWorld + airDrag);
       // Moments get the parent link, such that the resulting torques can be
       // applied.
       Vector3 parentWorldTorque;
@@ -19,7 +19,9 @@
 
 #include <gz/msgs/navsat.pb.h>
 
+#include <cmath>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,9 +30,12 @@
 #include <sdf/Sensor.hh>
 
 #include <gz/common/Profiler.hh>
+#include <gz/common/Util.hh>
 #include <gz/plugin/Register.hh>
 
+#include <gz/math/CoordinateVector3.hh>
 #include <gz/math/Helpers.hh>
+#include <gz/math/SphericalCoordinates.hh>
 #include <gz/transport/Node.hh>
 
 #include <gz/sensors/SensorFactory.hh>
@@ -89,11 +94,60 @@ class gz::sim::systems::NavSat::Implementation
     const Entity _entity,
     const components::NavSat *_navSat,
     const components::ParentEntity *_parent);
+
+  /// \brief Local linearization of the world-to-spherical conversion,
+  /// anchored at the last full ellipsoid solve.
+  public: struct Linearization
+  {
+    /// \brief World position of the anchor point.
+    math::Vector3d refPosition;
+
+    /// \brief Latitude (deg), longitude (deg) and elevation (m) at the
+    /// anchor point.
+    math::Vector3d refLatLonEle;
+
+    /// \brief Change of lat/lon/ele per meter of world x.
+    math::Vector3d dPerX;
+
+    /// \brief Change of lat/lon/ele per meter of world y.
+    math::Vector3d dPerY;
+
+    /// \brief Change of lat/lon/ele per meter of world z.
+    math::Vector3d dPerZ;
+  };
+
+  /// \brief Per-sensor linearization anchors.
+  public: std::unordered_map<Entity, Linearization> linearizations;
+
+  /// \brief World spherical coordinates the anchors were computed
+  /// against, so anchors are dropped when the origin changes at runtime.
+  public: std::optional<math::SphericalCoordinates> lastOrigin;
+
+  /// \brief Distance in meters from the anchor within which the
+  /// linearized conversion is used instead of the full ellipsoid solve.
+  /// Within 100 m of the anchor the linearization error is far below GPS
+  /// noise. Zero disables linearization; override with the
+  /// GZ_SIM_NAVSAT_LINEARIZATION_RANGE environment variable.
+  public: double linearizationRange{100.0};
 };
 
 //////////////////////////////////////////////////
 NavSat::NavSat() : System(), dataPtr(utils::MakeUniqueImpl<Implementation>())
 {
+  std::string range;
+  if (common::env("GZ_SIM_NAVSAT_LINEARIZATION_RANGE", range))
+  {
+    try
+    {
+      this->dataPtr->linearizationRange = std::stod(range);
+    }
+    catch (const std::exception &)
+    {
+      gzwarn << "Invalid GZ_SIM_NAVSAT_LINEARIZATION_RANGE value ["
+             << range << "]. Using default "
+             << this->dataPtr->linearizationRange << " m." << std::endl;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -237,6 +291,34 @@ void NavSat::Implementation::Update(const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("NavSat::Update");
 
+  // The runner refreshes the world-constants snapshot each step, so the
+  // origin is read without a per-update component fetch.
+  const auto &origin = worldConstants(_ecm).sphericalCoordinates;
+
+  // Drop anchors computed against a different origin, e.g. after the
+  // world's spherical coordinates were changed through a service call.
+  if (origin.has_value() &&
+      (!this->lastOrigin.has_value() ||
+      !(*this->lastOrigin == *origin)))
+  {
+    this->linearizations.clear();
+    this->lastOrigin = *origin;
+  }
+
+  // Full local-to-spherical solve through the ellipsoid math.
+  auto toLatLonEle = [&origin](const math::Vector3d &_xyz)
+      -> std::optional<math::Vector3d>
+  {
+    auto rad = origin->PositionTransform(
+        math::CoordinateVector3::Metric(_xyz),
+        math::SphericalCoordinates::LOCAL,
+        math::SphericalCoordinates::SPHERICAL);
+    if (!rad.has_value() || !rad->IsSpherical())
+      return std::nullopt;
+    return math::Vector3d(
+        rad->Lat()->Degree(), rad->Lon()->Degree(), *rad->Z());
+  };
+
   _ecm.Each<components::NavSat, components::WorldLinearVelocity>(
     [&](const Entity &_entity,
         const components::NavSat * /*_navsat*/,
@@ -252,8 +334,60 @@ void NavSat::Implementation::Update(const EntityComponentManager &_ecm)
           return true;
         }
 
+        if (!origin.has_value())
+        {
+          gzwarn << "Failed to update NavSat sensor enity [" << _entity
+                  << "]. Spherical coordinates not set." << std::endl;
+          return true;
+        }
+
         // Position
-        auto latLonEle = sphericalCoordinates(_entity, _ecm);
+        const math::Pose3d pose = worldPose(_entity, _ecm);
+        const math::Vector3d &pos = pose.Pos();
+
+        std::optional<math::Vector3d> latLonEle;
+        auto linIt = this->linearizations.find(_entity);
+        if (linIt != this->linearizations.end() &&
+            (pos - linIt->second.refPosition).Length() <=
+            this->linearizationRange)
+        {
+          // Close to the anchor the tangent-plane linearization is
+          // accurate to well below GPS noise; skip the ellipsoid solve.
+          const Linearization &lin = linIt->second;
+          const math::Vector3d d = pos - lin.refPosition;
+          latLonEle = lin.refLatLonEle + lin.dPerX * d.X() +
+              lin.dPerY * d.Y() + lin.dPerZ * d.Z();
+        }
+        else
+        {
+          latLonEle = toLatLonEle(pos);
+
+          // Anchor a fresh linearization with a numerical Jacobian. The
+          // three extra solves amortize over every step the sensor spends
+          // within linearizationRange of this position.
+          if (latLonEle.has_value() && this->linearizationRange > 0.0)
+          {
+            constexpr double eps = 1.0;
+            auto px = toLatLonEle(pos + math::Vector3d::UnitX * eps);
+            auto py = toLatLonEle(pos + math::Vector3d::UnitY * eps);
+            auto pz = toLatLonEle(pos + math::Vector3d::UnitZ * eps);
+            // Skip anchoring near the antimeridian, where longitude
+            // deltas wrap.
+            if (px.has_value() && py.has_value() && pz.has_value() &&
+                std::abs(px->Y() - latLonEle->Y()) < 180.0 &&
+                std::abs(py->Y() - latLonEle->Y()) < 180.0)
+            {
+              Linearization lin;
+              lin.refPosition = pos;
+              lin.refLatLonEle = *latLonEle;
+              lin.dPerX = (*px - *latLonEle) / eps;
+              lin.dPerY = (*py - *latLonEle) / eps;
+              lin.dPerZ = (*pz - *latLonEle) / eps;
+              this->linearizations[_entity] = lin;
+            }
+          }
+        }
+
         if (!latLonEle)
         {
           gzwarn << "Failed to update NavSat sensor enity [" << _entity
@@ -289,6 +423,7 @@ void NavSat::Implementation::RemoveSensors(const EntityComponentManager &_ecm)
         }
 
         this->entitySensorMap.erase(sensorId);
+        this->linearizations.erase(_entity);
 
         return true;
       });
@@ -102,6 +102,22 @@ class gz::sim::systems::OdometryPublisherPrivate
   /// \brief Current pose of the model in the odom frame.
   public: math::Pose3d lastUpdatePose{0, 0, 0, 0, 0, 0};
 
+  /// \brief Euler angles of lastUpdatePose, cached so each update extracts
+  /// Euler angles from a quaternion once instead of re-deriving them for
+  /// both the current and the previous pose.
+  public: math::Vector3d lastUpdateEuler{0, 0, 0};
+
+  /// \brief Odometry message reused across publishes. Fields that never
+  /// change (frame ids) are populated once on initialization.
+  public: msgs::Odometry msg;
+
+  /// \brief Odometry with covariance message reused across publishes. The
+  /// covariance matrices are populated once on initialization.
+  public: msgs::OdometryWithCovariance msgCovariance;
+
+  /// \brief Pose vector (TF) message reused across publishes.
+  public: msgs::Pose_V tfMsg;
+
   /// \brief Current timestamp.
   public: std::chrono::steady_clock::time_point lastUpdateTime;
 
@@ -335,17 +351,39 @@ void OdometryPublisherPrivate::UpdateOdometry(
     const gz::sim::EntityComponentManager &_ecm)
 {
   GZ_PROFILE("OdometryPublisher::UpdateOdometry");
-  // Record start time.
+  // Record start time and populate the message fields that never change
+  // across publishes.
   if (!this->initialized)
   {
     this->lastUpdateTime = std::chrono::steady_clock::time_point(_info.simTime);
+
+    // Set the frame ids.
+    auto frame = this->msg.mutable_header()->add_data();
+    frame->set_key("frame_id");
+    frame->add_value(odomFrame);
+    auto childFrame = this->msg.mutable_header()->add_data();
+    childFrame->set_key("child_frame_id");
+    childFrame->add_value(robotBaseFrame);
+
+    // Populate the covariance matrix.
+    // Should the matrix me populated for pose as well ?
+    auto gn2 = this->gaussianNoise * this->gaussianNoise;
+    for (int i = 0; i < 36; i++)
+    {
+      const double value = (i % 7 == 0) ? gn2 : 0;
+      this->msgCovariance.mutable_pose_with_covariance()->
+        mutable_covariance()->add_data(value);
+      this->msgCovariance.mutable_twist_with_covariance()->
+        mutable_covariance()->add_data(value);
+    }
+
     this->initialized = true;
     return;
   }
 
-  // Construct the odometry message and publish it.
+  // Update the preallocated odometry message and publish it.
   //! [declarePoseMsg]
-  msgs::Odometry msg;
+  msgs::Odometry &msg = this->msg;
   //! [declarePoseMsg]
 
   const std::chrono::duration<double> dt =
@@ -374,8 +412,12 @@ void OdometryPublisherPrivate::UpdateOdometry(
   double linearDisplacementX = pose.Pos().X() - this->lastUpdatePose.Pos().X();
   double linearDisplacementY = pose.Pos().Y() - this->lastUpdatePose.Pos().Y();
 
-  double currentYaw = pose.Rot().Yaw();
-  const double lastYaw = this->lastUpdatePose.Rot().Yaw();
+  // A single Euler extraction covers roll, pitch and yaw; the previous
+  // pose's angles are cached from the last update.
+  const math::Vector3d currentEuler = pose.Rot().Euler();
+
+  double currentYaw = currentEuler.Z();
+  const double lastYaw = this->lastUpdateEuler.Z();
   while (currentYaw < lastYaw - GZ_PI) currentYaw += 2 * GZ_PI;
   while (currentYaw > lastYaw + GZ_PI) currentYaw -= 2 * GZ_PI;
   const float yawDiff = currentYaw - lastYaw;
@@ -383,10 +425,12 @@ void OdometryPublisherPrivate::UpdateOdometry(
   // Get velocities assuming 2D
   if (this->dimensions == 2)
   {
-    double linearVelocityX = (cosf(currentYaw) * linearDisplacementX
-      + sinf(currentYaw) * linearDisplacementY) / dt.count();
-    double linearVelocityY = (cosf(currentYaw) * linearDisplacementY
-      - sinf(currentYaw) * linearDisplacementX) / dt.count();
+    const float cosYaw = cosf(currentYaw);
+    const float sinYaw = sinf(currentYaw);
+    double linearVelocityX = (cosYaw * linearDisplacementX
+      + sinYaw * linearDisplacementY) / dt.count();
+    double linearVelocityY = (cosYaw * linearDisplacementY
+      - sinYaw * linearDisplacementX) / dt.count();
     std::get<0>(this->linearMean).Push(linearVelocityX);
     std::get<1>(this->linearMean).Push(linearVelocityY);
     msg.mutable_twist()->mutable_linear()->set_x(
@@ -406,14 +450,14 @@ void OdometryPublisherPrivate::UpdateOdometry(
   // Get velocities and roll/pitch rates assuming 3D
   else if (this->dimensions == 3)
   {
-    double currentRoll = pose.Rot().Roll();
-    const double lastRoll = this->lastUpdatePose.Rot().Roll();
+    double currentRoll = currentEuler.X();
+    const double lastRoll = this->lastUpdateEuler.X();
     while (currentRoll < lastRoll - GZ_PI) currentRoll += 2 * GZ_PI;
     while (currentRoll > lastRoll + GZ_PI) currentRoll -= 2 * GZ_PI;
     const float rollDiff = currentRoll - lastRoll;
 
-    double currentPitch = pose.Rot().Pitch();
-    const double lastPitch = this->lastUpdatePose.Rot().Pitch();
+    double currentPitch = currentEuler.Y();
+    const double lastPitch = this->lastUpdateEuler.Y();
     while (currentPitch < lastPitch - GZ_PI) currentPitch += 2 * GZ_PI;
     while (currentPitch > lastPitch + GZ_PI) currentPitch -= 2 * GZ_PI;
     const float pitchDiff = currentPitch - lastPitch;
@@ -452,21 +496,12 @@ void OdometryPublisherPrivate::UpdateOdometry(
     std::get<2>(this->angularMean).Mean() +
     gz::math::Rand::DblNormal(0, this->gaussianNoise));
 
-  // Set the time stamp in the header.
-  msgs::Header header;
-  header.mutable_stamp()->CopyFrom(convert<msgs::Time>(_info.simTime));
-
-  // Set the frame ids.
-  auto frame = header.add_data();
-  frame->set_key("frame_id");
-  frame->add_value(odomFrame);
-  auto childFrame = header.add_data();
-  childFrame->set_key("child_frame_id");
-  childFrame->add_value(robotBaseFrame);
-
-  msg.mutable_header()->CopyFrom(header);
+  // Set the time stamp in the header. The frame ids were set once on
+  // initialization.
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
   this->lastUpdatePose = pose;
+  this->lastUpdateEuler = currentEuler;
   this->lastUpdateTime = std::chrono::steady_clock::time_point(_info.simTime);
 
   // Throttle publishing.
@@ -484,11 +519,11 @@ void OdometryPublisherPrivate::UpdateOdometry(
     //! [publishMsg]
   }
 
-  // Generate odometry with covariance message and publish it.
-  msgs::OdometryWithCovariance msgCovariance;
+  // Update the preallocated odometry with covariance message and publish it.
+  msgs::OdometryWithCovariance &msgCovariance = this->msgCovariance;
 
   // Set the time stamp in the header.
-  msgCovariance.mutable_header()->CopyFrom(header);
+  msgCovariance.mutable_header()->CopyFrom(msg.header());
 
   // Copy position from odometry msg.
   msgCovariance.mutable_pose_with_covariance()->
@@ -517,26 +552,8 @@ void OdometryPublisherPrivate::UpdateOdometry(
   msgCovariance.mutable_twist_with_covariance()->
     mutable_twist()->mutable_linear()->set_z(msg.twist().linear().z());
 
-  // Populate the covariance matrix.
-  // Should the matrix me populated for pose as well ?
-  auto gn2 = this->gaussianNoise * this->gaussianNoise;
-  for (int i = 0; i < 36; i++)
-  {
-    if (i % 7 == 0)
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-    }
-    else
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(0);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(0);
-    }
-  }
+  // The covariance matrices were populated once on initialization and do
+  // not change between publishes.
   if (this->odomCovPub.Valid())
   {
     this->odomCovPub.Publish(msgCovariance);
@@ -544,12 +561,12 @@ void OdometryPublisherPrivate::UpdateOdometry(
 
   if (this->tfPub.Valid())
   {
-    msgs::Pose_V tfMsg;
-    auto tfMsgPose = tfMsg.add_pose();
+    auto tfMsgPose = this->tfMsg.pose_size() > 0 ?
+      this->tfMsg.mutable_pose(0) : this->tfMsg.add_pose();
     tfMsgPose->CopyFrom(msg.pose());
-    tfMsgPose->mutable_header()->CopyFrom(header);
+    tfMsgPose->mutable_header()->CopyFrom(msg.header());
 
-    this->tfPub.Publish(tfMsg);
+    this->tfPub.Publish(this->tfMsg);
   }
 }
 
@@ -165,6 +165,19 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   /// \brief Flag for checking the data type returned by the DepthCamera
   public: bool checkDepthCameraData{true};
 
+  /// \brief Axis-aligned bounds of the sensing volume (including the
+  /// extended sensing distance), precomputed at load time so the per-point
+  /// inclusion test is just six comparisons.
+  public: gz::math::Vector3f sensingMinBound;
+  public: gz::math::Vector3f sensingMaxBound;
+
+  /// \brief Point cloud layout cached once per camera message.
+  /// MapPointCloudData runs five times per sampled pixel, so it shouldn't
+  /// go through the protobuf accessors for every point.
+  public: uint32_t cameraRowStep{0};
+  public: uint32_t cameraPointStep{0};
+  public: uint32_t cameraFieldOffset[3]{0, 0, 0};
+
   /// \brief Flag for allowing the plugin to output error/warning only once
   public: bool initErrorPrinted{false};
 
@@ -575,6 +588,21 @@ void OpticalTactilePluginPrivate::Load(const EntityComponentManager &_ecm)
     depthCameraPose.Data().Rot().Y(),
     depthCameraPose.Data().Rot().Z());
 
+  // Precompute the sensing volume bounds used by PointInsideSensor
+  const auto extended = static_cast<float>(this->extendedSensing);
+  const gz::math::Vector3f halfSize(
+    static_cast<float>(this->sensorSize.X()),
+    static_cast<float>(this->sensorSize.Y() / 2),
+    static_cast<float>(this->sensorSize.Z() / 2));
+  this->sensingMinBound = gz::math::Vector3f(
+    std::abs(this->depthCameraOffset.X()) - extended,
+    -halfSize.Y() - extended,
+    -halfSize.Z() - extended);
+  this->sensingMaxBound = gz::math::Vector3f(
+    std::abs(this->depthCameraOffset.X()) + halfSize.X() + extended,
+    halfSize.Y() + extended,
+    halfSize.Z() + extended);
+
   // Configure subscriber for depth camera images
   if (depthCameraTopic.empty())
   {
@@ -686,22 +714,22 @@ gz::math::Vector3f OpticalTactilePluginPrivate::MapPointCloudData(
   const char *temporaryMsgBuffer = _msgBuffer;
 
   // Number of bytes from the beginning of the pointer (image coordinates at
-  // 0,0) to the desired (i,j) position
+  // 0,0) to the desired (i,j) position. The layout values are cached by
+  // ComputeNormalForces once per message.
   uint32_t msgBufferIndex =
-    _j*this->cameraMsg.row_step() + _i*this->cameraMsg.point_step();
+    _j*this->cameraRowStep + _i*this->cameraPointStep;
 
   temporaryMsgBuffer += msgBufferIndex;
-  int fieldIndex = 0;
 
   // X coordinate
   measuredPoint.X() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex++).offset());
+    temporaryMsgBuffer + this->cameraFieldOffset[0]);
   // Y coordinate
   measuredPoint.Y() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex++).offset());
+    temporaryMsgBuffer + this->cameraFieldOffset[1]);
   // Z coordinate
   measuredPoint.Z() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex).offset());
+    temporaryMsgBuffer + this->cameraFieldOffset[2]);
 
   // Check if point is inside the sensor
   bool pointInside = this->PointInsideSensor(measuredPoint);
@@ -726,22 +754,14 @@ bool OpticalTactilePluginPrivate::PointInsideSensor(
     return false;
 
   // We assume that the depth camera is placed behind the contact surface, i.e.
-  // displaced in the -X direction with respect to the model's origin
-  bool insideX =
-    (_point.X() >= std::abs(this->depthCameraOffset.X()) -
-      this->extendedSensing) &&
-    (_point.X() <= (std::abs(this->depthCameraOffset.X()) +
-      this->sensorSize.X() + this->extendedSensing));
-
-  bool insideY =
-    (_point.Y() <= this->sensorSize.Y() / 2 + this->extendedSensing) &&
-    (_point.Y() >= - this->sensorSize.Y() / 2 - this->extendedSensing);
-
-  bool insideZ =
-    (_point.Z() <= this->sensorSize.Z() / 2 + this->extendedSensing) &&
-    (_point.Z() >= - this->sensorSize.Z() / 2 - this->extendedSensing);
-
-  return (insideX && insideY && insideZ);
+  // displaced in the -X direction with respect to the model's origin.
+  // The bounds are precomputed in Load().
+  return _point.X() >= this->sensingMinBound.X() &&
+         _point.X() <= this->sensingMaxBound.X() &&
+         _point.Y() >= this->sensingMinBound.Y() &&
+         _point.Y() <= this->sensingMaxBound.Y() &&
+         _point.Z() >= this->sensingMinBound.Z() &&
+         _point.Z() <= this->sensingMaxBound.Z();
 }
 
 //////////////////////////////////////////////////
@@ -758,6 +778,13 @@ void OpticalTactilePluginPrivate::ComputeNormalForces(
   // Get data from the message
   const char *msgBuffer = _msg.data().data();
 
+  // Cache the point cloud layout once per message so MapPointCloudData
+  // doesn't go through the protobuf accessors for every point
+  this->cameraRowStep = _msg.row_step();
+  this->cameraPointStep = _msg.point_step();
+  for (int field = 0; field < 3 && field < _msg.field_size(); ++field)
+    this->cameraFieldOffset[field] = _msg.field(field).offset();
+
   // Declare variables for storing the XYZ points
   gz::math::Vector3f p1, p2, p3, p4, markerPosition;
 
@@ -18,9 +18,11 @@
 #include <gz/msgs/particle_emitter.pb.h>
 #include <gz/msgs/particle_emitter_v.pb.h>
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -60,6 +62,10 @@ class gz::sim::systems::ParticleEmitterPrivate
   /// \brief Map of Entity to particle emitter command requested externally.
   public: std::map<Entity, gz::msgs::ParticleEmitter> userCmd;
 
+  /// \brief Set when a command has been queued in userCmd, so PreUpdate
+  /// can skip taking the mutex on steps where nothing arrived.
+  public: std::atomic<bool> newCmdAvailable{false};
+
   /// \brief A mutex to protect the user command.
   public: std::mutex mutex;
 
@@ -80,6 +86,7 @@ void ParticleEmitterPrivate::OnCmd(const msgs::ParticleEmitter &_msg,
   if (iter != this->emitterTopicMap.end())
   {
     this->userCmd[iter->second].CopyFrom(_msg);
+    this->newCmdAvailable = true;
   }
   else
   {
@@ -140,85 +147,90 @@ void ParticleEmitter::PreUpdate(const gz::sim::UpdateInfo &_info,
 {
   GZ_PROFILE("ParticleEmitter::PreUpdate");
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-
-  // Create particle emitters
-  {
-    std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
-    _ecm.EachNew<components::ParticleEmitter, components::ParentEntity,
-      components::Pose>(
-      [&](const Entity &_entity,
-          const components::ParticleEmitter *_emitter,
-          const components::ParentEntity *_parent,
-          const components::Pose *_pose)->bool
+  // Create particle emitters. The mutexes are only taken inside the
+  // lambda so steps without new emitters or commands stay lock-free.
+  _ecm.EachNew<components::ParticleEmitter, components::ParentEntity,
+    components::Pose>(
+    [&](const Entity &_entity,
+        const components::ParticleEmitter *_emitter,
+        const components::ParentEntity *_parent,
+        const components::Pose *_pose)->bool
+      {
+        std::string topic;
+
+        // Get the topic information from the header, which is currently a
+        // hack to avoid breaking the particle_emitter.proto message.
+        if (_emitter->Data().has_header())
         {
-          std::string topic;
-
-          // Get the topic information from the header, which is currently a
-          // hack to avoid breaking the particle_emitter.proto message.
-          if (_emitter->Data().has_header())
+          for (const auto & data : _emitter->Data().header().data())
           {
-            for (const auto & data : _emitter->Data().header().data())
+            if (data.key() == "topic" && !data.value().empty())
             {
-              if (data.key() == "topic" && !data.value().empty())
-              {
-                topic = data.value(0);
-              }
+              topic = data.value(0);
             }
           }
+        }
 
-          // If a topic has not been specified, then generate topic based
-          // on the scoped name.
-          topic = !topic.empty() ? topic :
-            topicFromScopedName(_entity, _ecm) + "/cmd";
+        // If a topic has not been specified, then generate topic based
+        // on the scoped name.
+        topic = !topic.empty() ? topic :
+          topicFromScopedName(_entity, _ecm) + "/cmd";
 
-          // Subscribe to the topic that receives particle emitter commands.
-          if (!this->dataPtr->node.Subscribe(
-                topic, &ParticleEmitterPrivate::OnCmd, this->dataPtr.get()))
-          {
-            gzerr << "Error subscribing to topic [" << topic << "]. "
-              << "Particle emitter will not receive updates." << std::endl;
-            return false;
-          }
-          gzmsg << "Particle emitter["
-            << scopedName(_entity, _ecm, "::", false) << "] subscribed "
-            << "to command messages on topic[" << topic << "]\n";
-
-          // Store the topic name so that we can apply user commands
-          // correctly.
+        // Store the topic name before subscribing so that a command
+        // arriving right away can be applied correctly.
+        {
+          std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
           this->dataPtr->emitterTopicMap[topic] = _entity;
+        }
 
-          // Store the emitter information in the service message, which
-          // can then be used in the particle_emitters service.
-          msgs::ParticleEmitter *emitterMsg =
-            this->dataPtr->serviceMsg.add_particle_emitter();
-          emitterMsg->CopyFrom(_emitter->Data());
-          msgs::Set(emitterMsg->mutable_pose(), _pose->Data());
-
-          // Set the topic information if it was not set via SDF.
-          if (!emitterMsg->has_header())
-          {
-            auto headerData = emitterMsg->mutable_header()->add_data();
-            headerData->set_key("topic");
-            headerData->add_value(topic);
-          }
-
-          // Set the particle emitter frame
-          auto frameData = emitterMsg->mutable_header()->add_data();
-          frameData->set_key("frame");
-          frameData->add_value(
-              removeParentScope(
-                scopedName(_parent->Data(), _ecm, "::", false), "::"));
-
-          return true;
-        });
-  }
-
-  if (this->dataPtr->userCmd.empty() || _info.paused)
+        // Subscribe to the topic that receives particle emitter commands.
+        if (!this->dataPtr->node.Subscribe(
+              topic, &ParticleEmitterPrivate::OnCmd, this->dataPtr.get()))
+        {
+          gzerr << "Error subscribing to topic [" << topic << "]. "
+            << "Particle emitter will not receive updates." << std::endl;
+          std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+          this->dataPtr->emitterTopicMap.erase(topic);
+          return false;
+        }
+        gzmsg << "Particle emitter["
+          << scopedName(_entity, _ecm, "::", false) << "] subscribed "
+          << "to command messages on topic[" << topic << "]\n";
+
+        // Store the emitter information in the service message, which
+        // can then be used in the particle_emitters service.
+        std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
+        msgs::ParticleEmitter *emitterMsg =
+          this->dataPtr->serviceMsg.add_particle_emitter();
+        emitterMsg->CopyFrom(_emitter->Data());
+        msgs::Set(emitterMsg->mutable_pose(), _pose->Data());
+
+        // Set the topic information if it was not set via SDF.
+        if (!emitterMsg->has_header())
+        {
+          auto headerData = emitterMsg->mutable_header()->add_data();
+          headerData->set_key("topic");
+          headerData->add_value(topic);
+        }
+
+        // Set the particle emitter frame
+        auto frameData = emitterMsg->mutable_header()->add_data();
+        frameData->set_key("frame");
+        frameData->add_value(
+            removeParentScope(
+              scopedName(_parent->Data(), _ecm, "::", false), "::"));
+
+        return true;
+      });
+
+  if (_info.paused || !this->dataPtr->newCmdAvailable)
     return;
 
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->newCmdAvailable = false;
+
   // Process each command
-  for (const auto & cmd : this->dataPtr->userCmd)
+  for (auto & cmd : this->dataPtr->userCmd)
   {
     // Create component.
     auto emitterComp = _ecm.Component<components::ParticleEmitterCmd>(
@@ -230,7 +242,9 @@ void ParticleEmitter::PreUpdate(const gz::sim::UpdateInfo &_info,
     }
     else
     {
-      emitterComp->Data() = cmd.second;
+      // The queue is cleared below, so the message can be moved into the
+      // component instead of deep-copied.
+      emitterComp->Data() = std::move(cmd.second);
 
       // Note: we process the cmd component in RenderUtil but if there is only
       // rendering on the gui side, it will not be able to remove the cmd
@@ -17,6 +17,18 @@
 
 #include <gz/msgs/pose.pb.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include <gz/common/Profiler.hh>
 #include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/Vector3.hh>
@@ -41,6 +53,234 @@ using namespace gz;
 using namespace sim;
 using namespace systems;
 
+namespace
+{
+/// \brief Snapshot of one performer's state taken while building the shared
+/// broadphase grid.
+struct PerformerEntry
+{
+  /// \brief The performer entity.
+  Entity entity{kNullEntity};
+
+  /// \brief World pose of the performer's parent model.
+  math::Pose3d pose;
+
+  /// \brief Name of the performer's parent model.
+  std::string name;
+
+  /// \brief World-space axis aligned volume of the performer.
+  math::AxisAlignedBox volume;
+};
+
+/// \brief Uniform-grid broadphase over performer volumes, shared by every
+/// PerformerDetector instance reading the same entity component manager.
+/// The first detector to update on a step inserts all performers into the
+/// grid once; the remaining detectors only probe the cells overlapped by
+/// their detection region, so the per-step cost is proportional to the
+/// performers near detectors instead of the detector x performer cross
+/// product.
+class SharedPerformerIndex
+{
+  /// \brief Get the index shared by detectors reading _ecm. Indices are
+  /// keyed per manager so concurrent worlds, and the snapshot manager used
+  /// for asynchronous PostUpdate, each get their own grid.
+  /// \param[in] _ecm The entity component manager being read.
+  /// \return The shared index.
+  public: static SharedPerformerIndex &ForEcm(
+      const EntityComponentManager &_ecm)
+  {
+    static std::mutex mapMutex;
+    static std::unordered_map<const EntityComponentManager *,
+        std::unique_ptr<SharedPerformerIndex>> indices;
+    std::lock_guard<std::mutex> lock(mapMutex);
+    auto &index = indices[&_ecm];
+    if (!index)
+      index = std::make_unique<SharedPerformerIndex>();
+    return *index;
+  }
+
+  /// \brief Collect the performers whose volume may overlap _region.
+  /// Candidates still require an exact intersection test.
+  /// \param[in] _ecm The entity component manager being read.
+  /// \param[in] _iteration Current simulation iteration.
+  /// \param[in] _region World-space detection region.
+  /// \param[out] _candidates Entries overlapping the region's grid cells.
+  /// The pointers remain valid for the rest of the step.
+  public: void Query(const EntityComponentManager &_ecm,
+      uint64_t _iteration, const math::AxisAlignedBox &_region,
+      std::vector<const PerformerEntry *> &_candidates)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->RebuildIfStale(_ecm, _iteration);
+
+    const auto minCell = this->CellOf(_region.Min());
+    const auto maxCell = this->CellOf(_region.Max());
+
+    // A region spanning more cells than there are performers is cheaper to
+    // test against every entry directly. Count in floating point to avoid
+    // overflow on oversized regions.
+    const double cellCount =
+        static_cast<double>(maxCell[0] - minCell[0] + 1) *
+        static_cast<double>(maxCell[1] - minCell[1] + 1) *
+        static_cast<double>(maxCell[2] - minCell[2] + 1);
+    if (cellCount >= static_cast<double>(this->entries.size()))
+    {
+      for (const auto &entry : this->entries)
+        _candidates.push_back(&entry);
+      return;
+    }
+
+    std::unordered_set<std::size_t> seen;
+    for (int64_t x = minCell[0]; x <= maxCell[0]; ++x)
+    {
+      for (int64_t y = minCell[1]; y <= maxCell[1]; ++y)
+      {
+        for (int64_t z = minCell[2]; z <= maxCell[2]; ++z)
+        {
+          auto cellIter = this->grid.find(this->CellKey(x, y, z));
+          if (cellIter == this->grid.end())
+            continue;
+          for (const auto entryIndex : cellIter->second)
+          {
+            if (seen.insert(entryIndex).second)
+              _candidates.push_back(&this->entries[entryIndex]);
+          }
+        }
+      }
+    }
+  }
+
+  /// \brief Get the entry of a single performer.
+  /// \param[in] _ecm The entity component manager being read.
+  /// \param[in] _iteration Current simulation iteration.
+  /// \param[in] _entity The performer entity.
+  /// \return The entry, or nullptr if the performer no longer exists.
+  public: const PerformerEntry *Entry(const EntityComponentManager &_ecm,
+      uint64_t _iteration, Entity _entity)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->RebuildIfStale(_ecm, _iteration);
+    auto iter = this->entryByEntity.find(_entity);
+    return iter == this->entryByEntity.end() ? nullptr :
+        &this->entries[iter->second];
+  }
+
+  /// \brief Rebuild the grid if it was built for an earlier iteration.
+  /// \param[in] _ecm The entity component manager being read.
+  /// \param[in] _iteration Current simulation iteration.
+  private: void RebuildIfStale(const EntityComponentManager &_ecm,
+      uint64_t _iteration)
+  {
+    if (this->built && this->builtIteration == _iteration)
+      return;
+
+    this->entries.clear();
+    this->entryByEntity.clear();
+    this->grid.clear();
+
+    double maxSide{0.0};
+    _ecm.Each<components::Performer, components::Geometry,
+              components::ParentEntity>(
+        [&](const Entity &_entity, const components::Performer *,
+            const components::Geometry *_geometry,
+            const components::ParentEntity *_parent) -> bool
+        {
+          auto poseComp = _ecm.Component<components::Pose>(_parent->Data());
+          auto nameComp = _ecm.Component<components::Name>(_parent->Data());
+          if (nullptr == poseComp || nullptr == nameComp)
+            return true;
+
+          // We assume the geometry contains a box.
+          auto perfBox = _geometry->Data().BoxShape();
+          if (nullptr == perfBox)
+          {
+            gzerr << "Internal error: geometry of performer [" << _entity
+                   << "] missing box." << std::endl;
+            return true;
+          }
+
+          PerformerEntry entry;
+          entry.entity = _entity;
+          entry.pose = poseComp->Data();
+          entry.name = nameComp->Data();
+          entry.volume = math::AxisAlignedBox(
+              entry.pose.Pos() - perfBox->Size() / 2,
+              entry.pose.Pos() + perfBox->Size() / 2);
+          maxSide = std::max({maxSide, perfBox->Size().X(),
+              perfBox->Size().Y(), perfBox->Size().Z()});
+          this->entryByEntity[_entity] = this->entries.size();
+          this->entries.push_back(std::move(entry));
+          return true;
+        });
+
+    // Cells sized to the largest performer keep each volume within at most
+    // eight cells.
+    this->cellSize = std::max(1.0, maxSide);
+    for (std::size_t i = 0; i < this->entries.size(); ++i)
+    {
+      const auto minCell = this->CellOf(this->entries[i].volume.Min());
+      const auto maxCell = this->CellOf(this->entries[i].volume.Max());
+      for (int64_t x = minCell[0]; x <= maxCell[0]; ++x)
+        for (int64_t y = minCell[1]; y <= maxCell[1]; ++y)
+          for (int64_t z = minCell[2]; z <= maxCell[2]; ++z)
+            this->grid[this->CellKey(x, y, z)].push_back(i);
+    }
+
+    this->built = true;
+    this->builtIteration = _iteration;
+  }
+
+  /// \brief Grid cell containing a world position.
+  /// \param[in] _pos World position.
+  /// \return Integer cell coordinates.
+  private: std::array<int64_t, 3> CellOf(const math::Vector3d &_pos) const
+  {
+    return {static_cast<int64_t>(std::floor(_pos.X() / this->cellSize)),
+            static_cast<int64_t>(std::floor(_pos.Y() / this->cellSize)),
+            static_cast<int64_t>(std::floor(_pos.Z() / this->cellSize))};
+  }
+
+  /// \brief Hash a cell coordinate into a grid key. Collisions only merge
+  /// candidate lists; the exact intersection test filters them out.
+  /// \param[in] _x Cell x coordinate.
+  /// \param[in] _y Cell y coordinate.
+  /// \param[in] _z Cell z coordinate.
+  /// \return Grid key.
+  private: uint64_t CellKey(int64_t _x, int64_t _y, int64_t _z) const
+  {
+    uint64_t key = 14695981039346656037ULL;
+    for (const auto coord : {_x, _y, _z})
+    {
+      key ^= static_cast<uint64_t>(coord);
+      key *= 1099511628211ULL;
+    }
+    return key;
+  }
+
+  /// \brief Guards the grid; detectors may update concurrently from the
+  /// PostUpdate worker pool.
+  private: std::mutex mutex;
+
+  /// \brief True once the grid has been built at least once.
+  private: bool built{false};
+
+  /// \brief Iteration the grid was built for.
+  private: uint64_t builtIteration{0};
+
+  /// \brief Grid cell edge length in meters.
+  private: double cellSize{1.0};
+
+  /// \brief All performer entries for the current iteration.
+  private: std::vector<PerformerEntry> entries;
+
+  /// \brief Map from performer entity to its index in entries.
+  private: std::unordered_map<Entity, std::size_t> entryByEntity;
+
+  /// \brief Map from cell key to indices of entries overlapping the cell.
+  private: std::unordered_map<uint64_t, std::vector<std::size_t>> grid;
+};
+}
+
 /////////////////////////////////////////////////
 void PerformerDetector::Configure(const Entity &_entity,
                const std::shared_ptr<const sdf::Element> &_sdf,
@@ -159,45 +399,57 @@ void PerformerDetector::PostUpdate(
   auto region = this->detectorGeometry -
     (-(modelPose.Pos() + modelPose.Rot() * this->poseOffset.Pos()));
 
-  _ecm.Each<components::Performer, components::Geometry,
-            components::ParentEntity>(
-      [&](const Entity &_entity, const components::Performer *,
-          const components::Geometry *_geometry,
-          const components::ParentEntity *_parent) -> bool
-      {
-        auto pose = _ecm.Component<components::Pose>(_parent->Data())->Data();
-        auto name = _ecm.Component<components::Name>(_parent->Data())->Data();
-        const math::Pose3d relPose = modelPose.Inverse() * pose;
+  auto &index = SharedPerformerIndex::ForEcm(_ecm);
+  std::vector<const PerformerEntry *> candidates;
+  index.Query(_ecm, _info.iterations, region, candidates);
 
-        // We assume the geometry contains a box.
-        auto perfBox = _geometry->Data().BoxShape();
-        if (nullptr == perfBox)
-        {
-          gzerr << "Internal error: geometry of performer [" << _entity
-                 << "] missing box." << std::endl;
-          return true;
-        }
+  for (const auto *entry : candidates)
+  {
+    const math::Pose3d relPose = modelPose.Inverse() * entry->pose;
 
-        math::AxisAlignedBox performerVolume{pose.Pos() - perfBox->Size() / 2,
-                                             pose.Pos() + perfBox->Size() / 2};
+    bool alreadyDetected = this->IsAlreadyDetected(entry->entity);
+    if (region.Intersects(entry->volume))
+    {
+      if (!alreadyDetected)
+      {
+        this->AddToDetected(entry->entity);
+        this->Publish(entry->entity, entry->name, true, relPose,
+            _info.simTime);
+      }
+    }
+    else if (alreadyDetected)
+    {
+      this->RemoveFromDetected(entry->entity);
+      this->Publish(entry->entity, entry->name, false, relPose,
+          _info.simTime);
+    }
+  }
 
-        bool alreadyDetected = this->IsAlreadyDetected(_entity);
-        if (region.Intersects(performerVolume))
-        {
-          if (!alreadyDetected)
-          {
-            this->AddToDetected(_entity);
-            this->Publish(_entity, name, true, relPose, _info.simTime);
-          }
-        }
-        else if (alreadyDetected)
+  // A detected performer that moved far from the region no longer shows up
+  // as a candidate, so sweep the detected set for performers that left.
+  for (auto detectedIter = this->detectedEntities.begin();
+       detectedIter != this->detectedEntities.end();)
+  {
+    const Entity detected = *detectedIter;
+    const bool isCandidate = std::any_of(candidates.begin(), candidates.end(),
+        [detected](const PerformerEntry *_entry)
         {
-          this->RemoveFromDetected(_entity);
-          this->Publish(_entity, name, false, relPose, _info.simTime);
-        }
+          return _entry->entity == detected;
+        });
+    if (isCandidate)
+    {
+      ++detectedIter;
+      continue;
+    }
 
-        return true;
-      });
+    detectedIter = this->detectedEntities.erase(detectedIter);
+    const auto *entry = index.Entry(_ecm, _info.iterations, detected);
+    if (nullptr != entry)
+    {
+      this->Publish(detected, entry->name, false,
+          modelPose.Inverse() * entry->pose, _info.simTime);
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -18,9 +18,12 @@
 #ifndef GZ_SIM_SYSTEMS_PHYSICS_ENTITY_FEATURE_MAP_HH_
 #define GZ_SIM_SYSTEMS_PHYSICS_ENTITY_FEATURE_MAP_HH_
 
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gz/physics/Entity.hh>
 #include <gz/physics/FindFeatures.hh>
@@ -83,6 +86,37 @@ namespace systems::physics_system
                  std::tuple<RequiredEntityPtr,
                             PhysicsEntityPtr<OptionalFeatureLists>...>;
 
+    /// \brief Position of a FeatureList within OptionalFeatureLists, used
+    /// as the bit position in CastEntry::attemptedMask.
+    private: template <typename T>
+             static constexpr std::size_t FeatureListIndex()
+    {
+      constexpr bool matches[] = {std::is_same_v<T, OptionalFeatureLists>...};
+      std::size_t index = 0;
+      for (std::size_t i = 0; i < sizeof...(OptionalFeatureLists); ++i)
+      {
+        if (matches[i])
+          index = i;
+      }
+      return index;
+    }
+
+    /// \brief Cast cache slot: the cast results for one entity plus a
+    /// bitmask of the feature lists that have already been attempted.
+    /// Whether the engine supports a feature is fixed for the lifetime of
+    /// the entity, so a failed cast is as cacheable as a successful one;
+    /// without the mask every unsupported capability would be re-queried
+    /// dynamically on each use.
+    private: struct CastEntry
+    {
+      Entity entity{kNullEntity};
+      ValueType entities;
+      uint32_t attemptedMask{0};
+    };
+
+    static_assert(sizeof...(OptionalFeatureLists) <= 32,
+        "CastEntry::attemptedMask holds one bit per optional FeatureList");
+
     /// \brief Helper function to cast from an entity type with minimum features
     /// to an entity with a different set of features. When the entity is cast
     /// successfully, it is added to an internal cache so that subsequent casts
@@ -108,15 +142,17 @@ namespace systems::physics_system
       else
       {
         using ToEntityPtr = PhysicsEntityPtr<ToFeatureList>;
-        // Has already been cast
-        auto castIt = this->castCache.find(_entity);
-        if (castIt != this->castCache.end())
+        constexpr uint32_t bit =
+            uint32_t(1) << FeatureListIndex<ToFeatureList>();
+
+        // Has already been attempted: return the cached result, including
+        // a cached failure when the engine doesn't support the feature.
+        const auto slot = entityIndex(_entity);
+        if (slot < this->castCache.size() &&
+            this->castCache[slot].entity == _entity &&
+            (this->castCache[slot].attemptedMask & bit) != 0)
         {
-          auto castEntity = std::get<ToEntityPtr>(castIt->second);
-          if (nullptr != castEntity)
-          {
-            return castEntity;
-          }
+          return std::get<ToEntityPtr>(this->castCache[slot].entities);
         }
 
         auto reqEntity = this->Get(_entity);
@@ -126,13 +162,21 @@ namespace systems::physics_system
         }
 
         // Cast
-        auto castEntity = physics::RequestFeatures<ToFeatureList>::From(
-            this->Get(_entity));
+        auto castEntity =
+            physics::RequestFeatures<ToFeatureList>::From(reqEntity);
 
-        if (castEntity)
+        if (slot >= this->castCache.size())
+        {
+          this->castCache.resize(slot + 1);
+        }
+        auto &entry = this->castCache[slot];
+        if (entry.entity != _entity)
         {
-          std::get<ToEntityPtr>(this->castCache[_entity]) = castEntity;
+          entry = CastEntry();
+          entry.entity = _entity;
         }
+        entry.attemptedMask |= bit;
+        std::get<ToEntityPtr>(entry.entities) = castEntity;
 
         return castEntity;
       }
@@ -165,10 +209,11 @@ namespace systems::physics_system
     /// nullptr
     public: RequiredEntityPtr Get(const Entity &_entity) const
     {
-      auto it = this->entityMap.find(_entity);
-      if (it != this->entityMap.end())
+      const auto slot = entityIndex(_entity);
+      if (slot < this->forwardIndex.size() &&
+          this->forwardIndex[slot].first == _entity)
       {
-        return it->second;
+        return this->forwardIndex[slot].second;
       }
       return nullptr;
     }
@@ -224,7 +269,7 @@ namespace systems::physics_system
     /// Gazebo entity
     public: bool HasEntity(const Entity &_entity) const
     {
-      return this->entityMap.find(_entity) != this->entityMap.end();
+      return nullptr != this->Get(_entity);
     }
 
     /// \brief Check whether there is a gazebo entity associated with the given
@@ -247,6 +292,13 @@ namespace systems::physics_system
       this->reverseMap[_physicsEntity] = _entity;
       this->physEntityById[_physicsEntity->EntityID()] = _physicsEntity;
       this->entityByPhysId[_physicsEntity->EntityID()] = _entity;
+
+      const auto slot = entityIndex(_entity);
+      if (slot >= this->forwardIndex.size())
+      {
+        this->forwardIndex.resize(slot + 1);
+      }
+      this->forwardIndex[slot] = std::make_pair(_entity, _physicsEntity);
     }
 
     /// \brief Remove entity from all associated maps
@@ -260,7 +312,7 @@ namespace systems::physics_system
         this->reverseMap.erase(it->second);
         this->physEntityById.erase(it->second->EntityID());
         this->entityByPhysId.erase(it->second->EntityID());
-        this->castCache.erase(_entity);
+        this->ClearSlots(_entity);
         this->entityMap.erase(it);
         return true;
       }
@@ -278,7 +330,7 @@ namespace systems::physics_system
         this->entityMap.erase(it->second);
         this->physEntityById.erase(it->first->EntityID());
         this->entityByPhysId.erase(it->first->EntityID());
-        this->castCache.erase(it->second);
+        this->ClearSlots(it->second);
         this->reverseMap.erase(it);
         return true;
       }
@@ -298,11 +350,32 @@ namespace systems::physics_system
     /// \return Number of entries in all the maps.
     public: std::size_t TotalMapEntryCount() const
     {
+      std::size_t castCount{0};
+      for (const auto &entry : this->castCache)
+      {
+        if (kNullEntity != entry.entity)
+          ++castCount;
+      }
       return this->entityMap.size() + this->reverseMap.size() +
-             this->castCache.size() + this->physEntityById.size() +
+             castCount + this->physEntityById.size() +
              this->entityByPhysId.size();
     }
 
+    /// \brief Clear the dense index and cast cache slots of an entity.
+    /// \param[in] _entity Gazebo entity being removed.
+    private: void ClearSlots(Entity _entity)
+    {
+      const auto slot = entityIndex(_entity);
+      if (slot < this->forwardIndex.size())
+      {
+        this->forwardIndex[slot] = {kNullEntity, RequiredEntityPtr()};
+      }
+      if (slot < this->castCache.size())
+      {
+        this->castCache[slot] = CastEntry();
+      }
+    }
+
     /// \brief Map from Gazebo entity to physics entities with required features
     private: std::unordered_map<Entity, RequiredEntityPtr> entityMap;
 
@@ -316,9 +389,18 @@ namespace systems::physics_system
     /// \brief Map of physics entity IDs to Gazebo entity
     private: std::unordered_map<std::size_t, Entity> entityByPhysId;
 
-    /// \brief Cache map from Gazebo entity to physics entities with optional
-    /// features
-    private: mutable std::unordered_map<Entity, ValueType> castCache;
+    /// \brief Dense index from entity slot (see entityIndex) to the physics
+    /// entity with required features. This mirrors entityMap and serves the
+    /// per-step Get and HasEntity lookups without hashing; the hash maps
+    /// above are only touched on creation and removal. The full entity ID
+    /// is stored alongside so a recycled index never aliases a removed
+    /// entity.
+    private: std::vector<std::pair<Entity, RequiredEntityPtr>> forwardIndex;
+
+    /// \brief Cache from entity slot to cast results, indexed like
+    /// forwardIndex. Covers failed casts as well, so each optional
+    /// capability is resolved at most once per entity.
+    private: mutable std::vector<CastEntry> castCache;
   };
 
   /// \brief Convenience template that presets EntityFeatureMap with
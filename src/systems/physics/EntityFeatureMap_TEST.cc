@@ -184,3 +184,43 @@ TEST_F(EntityFeatureMapFixture,
       testWorld2->EntityID()));
   EXPECT_EQ(0u, testMap.TotalMapEntryCount());
 }
+
+/////////////////////////////////////////////////
+TEST_F(EntityFeatureMapFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(RecycledEntityIndex))
+{
+  using WorldEntityMap =
+      EntityFeatureMap3d<physics::World, MinimumFeatureList>;
+
+  using WorldPtrType = physics::EntityPtr<
+      physics::World<physics::FeaturePolicy3d, MinimumFeatureList>>;
+
+  // Two entity IDs that share the same index but have different generations,
+  // the way the entity component manager recycles IDs.
+  const sim::Entity firstEntity = 42;
+  const sim::Entity recycledEntity =
+      firstEntity | (sim::Entity(1) << sim::kEntityIndexBits);
+
+  WorldPtrType testWorld1 = this->engine->ConstructEmptyWorld("world1");
+  WorldPtrType testWorld2 = this->engine->ConstructEmptyWorld("world2");
+
+  WorldEntityMap testMap;
+  testMap.AddEntity(firstEntity, testWorld1);
+  EXPECT_EQ(testWorld1, testMap.Get(firstEntity));
+
+  // An ID with the same index must not alias the live entity.
+  EXPECT_EQ(nullptr, testMap.Get(recycledEntity));
+  EXPECT_FALSE(testMap.HasEntity(recycledEntity));
+
+  testMap.Remove(firstEntity);
+  EXPECT_EQ(nullptr, testMap.Get(firstEntity));
+
+  // Reusing the index with a new generation only resolves the new ID.
+  testMap.AddEntity(recycledEntity, testWorld2);
+  EXPECT_EQ(testWorld2, testMap.Get(recycledEntity));
+  EXPECT_EQ(nullptr, testMap.Get(firstEntity));
+  EXPECT_FALSE(testMap.HasEntity(firstEntity));
+
+  testMap.Remove(recycledEntity);
+  EXPECT_EQ(0u, testMap.TotalMapEntryCount());
+}
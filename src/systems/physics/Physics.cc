@@ -23,11 +23,14 @@
 #include <gz/msgs/Utility.hh>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
-#include <deque>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -39,7 +42,9 @@
 #include <gz/common/MeshManager.hh>
 #include <gz/common/Profiler.hh>
 #include <gz/common/StringUtils.hh>
+#include <gz/common/WorkerPool.hh>
 #include <gz/common/SystemPaths.hh>
+#include <gz/common/Util.hh>
 #include <gz/common/Uuid.hh>
 #include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/eigen3/Conversions.hh>
@@ -143,6 +148,7 @@
 #include "gz/sim/components/PoseCmd.hh"
 #include "gz/sim/components/Recreate.hh"
 #include "gz/sim/components/SelfCollide.hh"
+#include "gz/sim/components/Sleeping.hh"
 #include "gz/sim/components/SlipComplianceCmd.hh"
 #include "gz/sim/components/SphericalCoordinates.hh"
 #include "gz/sim/components/Static.hh"
@@ -355,6 +361,66 @@ class gz::sim::systems::PhysicsPrivate
   /// after a physics step.
   public: std::unordered_map<Entity, gz::math::Pose3d> linkWorldPoses;
 
+  /// \brief Physics step at which each link last moved, used to detect
+  /// quiescent links.
+  public: std::unordered_map<Entity, uint64_t> linkLastMovedStep;
+
+  /// \brief Links currently considered asleep. Mirrored into each link's
+  /// Sleeping component so other systems can observe quiescence.
+  public: std::unordered_set<Entity> sleepingLinks;
+
+  /// \brief Number of physics steps taken, used with linkLastMovedStep.
+  public: uint64_t stepCount{0};
+
+  /// \brief Consecutive steps without movement before a link is marked as
+  /// sleeping.
+  public: static constexpr uint64_t kSleepThresholdSteps{20};
+
+  /// \brief Sleeping links are only re-examined every this many steps when
+  /// the engine doesn't report changed poses itself, bounding how stale
+  /// their readback can be.
+  public: static constexpr uint64_t kSleepRecheckPeriodSteps{8};
+
+  /// \brief Mark a link as sleeping or awake, mirroring the state into the
+  /// link's Sleeping component on transitions.
+  /// \param[in] _ecm Mutable reference to ECM.
+  /// \param[in] _entity Link entity.
+  /// \param[in] _sleeping True if the link is quiescent.
+  public: void SetLinkSleeping(EntityComponentManager &_ecm,
+      const Entity _entity, const bool _sleeping);
+
+  /// \brief Physics step at which any link of each model last moved, used
+  /// to skip AxisAlignedBox recomputation for models at rest.
+  public: std::unordered_map<Entity, uint64_t> modelLastMovedStep;
+
+  /// \brief Cache from a link to its ancestor model chain, so a moving
+  /// link also invalidates the boxes of the models nesting it.
+  public: std::unordered_map<Entity, std::vector<Entity>> linkModelChain;
+
+  /// \brief Physics step at which each model's AxisAlignedBox component
+  /// was last recomputed.
+  public: std::unordered_map<Entity, uint64_t> aabbLastComputedStep;
+
+  /// \brief Joints whose most recent applied force command was nonzero.
+  /// Commands are zero-filled after every step, so without this set every
+  /// joint that was ever actuated would pay per-DOF engine calls forever;
+  /// instead a zero command is pushed to the engine exactly once after
+  /// the last nonzero command.
+  public: std::unordered_set<Entity> jointsWithAppliedForce;
+
+  /// \brief Mesh optimization applied to collision meshes whose SDF does
+  /// not request one ("convex_decomposition" or "convex_hull"). Set with
+  /// the GZ_SIM_COLLISION_MESH_OPTIMIZATION environment variable; when
+  /// empty, collision meshes are passed to the engine as authored.
+  public: std::string collisionMeshOptimization;
+
+  /// \brief Record that a link moved this step, invalidating the cached
+  /// bounding box of every model containing it.
+  /// \param[in] _ecm Immutable reference to ECM.
+  /// \param[in] _link Link entity that moved.
+  public: void MarkLinkModelsMoved(const EntityComponentManager &_ecm,
+      const Entity _link);
+
   /// \brief Keep a mapping of canonical links to models that have this
   /// canonical link. Useful for updating model poses efficiently after a
   /// physics step
@@ -365,6 +431,17 @@ class gz::sim::systems::PhysicsPrivate
   /// most recent model world pose change that took place.
   public: std::unordered_map<Entity, math::Pose3d> modelWorldPoses;
 
+  /// \brief Scratch buffer of changed link poses, committed to the ECM in
+  /// one batched writeback per step instead of one call per link. Kept as
+  /// a member so its capacity is reused across steps.
+  public: std::vector<std::pair<Entity, math::Pose3d>> linkPoseWriteback;
+
+  /// \brief Worker pool used to step multiple physics worlds concurrently.
+  /// Worlds are dynamically independent, so each one can advance on its
+  /// own thread. Created on demand the first time more than one world is
+  /// present.
+  public: std::unique_ptr<common::WorkerPool> worldStepPool;
+
   /// \brief A map between model entity ids in the ECM to whether its battery
   /// has drained.
   public: std::unordered_map<Entity, bool> entityOffMap;
@@ -769,6 +846,30 @@ class gz::sim::systems::PhysicsPrivate
   /// \brief Flag to store whether the names of colliding entities should
   /// be populated in the contact points.
   public: bool contactsEntityNames = true;
+
+  /// \brief Scratch contacts message reused across collisions and steps so
+  /// repeated-field capacity is recycled instead of reallocated for every
+  /// collision every step.
+  public: msgs::Contacts contactsBuffer;
+
+  /// \brief Cache of scoped collision entity names used in contact
+  /// messages. Entries are dropped when the collision is removed.
+  public: std::unordered_map<Entity, std::string> collisionScopedNames;
+
+  /// \brief Slip compliance values last pushed into the physics engine per
+  /// collision, used to skip redundant engine calls. Systems such as
+  /// WheelSlip resend their command every step even when the values are
+  /// unchanged. Entries are dropped when the collision is removed.
+  public: std::unordered_map<Entity, std::array<double, 2>>
+      lastSlipComplianceApplied;
+
+  /// \brief Get the scoped name of a collision entity for contact
+  /// messages, computing and caching it on first use.
+  /// \param[in] _entity Collision entity.
+  /// \param[in] _ecm Immutable reference to ECM.
+  /// \return The collision's scoped name, without the world scope.
+  public: const std::string &ScopedContactName(const Entity _entity,
+      const EntityComponentManager &_ecm);
 };
 
 //////////////////////////////////////////////////
@@ -830,6 +931,25 @@ void Physics::Configure(const Entity &_entity,
       "include_entity_names", true).first;
   }
 
+  // Optionally force an optimization for collision meshes that do not
+  // request one in SDF. Visual-resolution meshes used as collision geometry
+  // are a common source of slow physics steps; this applies convex
+  // decomposition (or a single convex hull) engine-wide without editing
+  // every model.
+  std::string collisionOptimization;
+  common::env("GZ_SIM_COLLISION_MESH_OPTIMIZATION", collisionOptimization);
+  if (collisionOptimization == "convex_decomposition" ||
+      collisionOptimization == "convex_hull")
+  {
+    this->dataPtr->collisionMeshOptimization = collisionOptimization;
+  }
+  else if (!collisionOptimization.empty())
+  {
+    gzwarn << "Ignoring unknown GZ_SIM_COLLISION_MESH_OPTIMIZATION value ["
+           << collisionOptimization << "]. Supported values are "
+           << "[convex_decomposition] and [convex_hull]." << std::endl;
+  }
+
   // Find engine shared library
   // Look in:
   // * Paths from environment variable
@@ -1477,6 +1597,17 @@ void PhysicsPrivate::CreateCollisionEntities(const EntityComponentManager &_ecm,
             return true;
           }
 
+          // Apply the engine-wide collision mesh optimization when the
+          // mesh does not request one itself.
+          sdf::Mesh meshSdfLocal;
+          if (meshSdf->Optimization() == sdf::MeshOptimization::NONE &&
+              !this->collisionMeshOptimization.empty())
+          {
+            meshSdfLocal = *meshSdf;
+            meshSdfLocal.SetOptimization(this->collisionMeshOptimization);
+            meshSdf = &meshSdfLocal;
+          }
+
           const common::Mesh *mesh = loadMesh(*meshSdf);
           if (!mesh)
             return true;
@@ -2076,6 +2207,8 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
             {
               this->entityCollisionMap.Remove(childCollision);
               this->topLevelModelMap.erase(childCollision);
+              this->collisionScopedNames.erase(childCollision);
+              this->lastSlipComplianceApplied.erase(childCollision);
               if (this->customContactSurfaceEntities[world].erase(
                 childCollision))
               {
@@ -2092,6 +2225,9 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
             this->topLevelModelMap.erase(childLink);
             this->staticEntities.erase(childLink);
             this->linkWorldPoses.erase(childLink);
+            this->linkLastMovedStep.erase(childLink);
+            this->linkModelChain.erase(childLink);
+            this->sleepingLinks.erase(childLink);
             this->canonicalLinkModelTracker.RemoveLink(childLink);
           }
 
@@ -2100,9 +2236,12 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
           {
             this->entityJointMap.Remove(childJoint);
             this->topLevelModelMap.erase(childJoint);
+            this->jointsWithAppliedForce.erase(childJoint);
           }
 
           this->entityFreeGroupMap.Remove(_entity);
+          this->modelLastMovedStep.erase(_entity);
+          this->aabbLastComputedStep.erase(_entity);
           // Remove the model from the physics engine
           modelPtrPhys->Remove();
           this->entityModelMap.Remove(_entity);
@@ -2340,9 +2479,28 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           }
           std::size_t nDofs = std::min(force->Data().size(),
                                        jointPhys->GetDegreesOfFreedom());
-          for (std::size_t i = 0; i < nDofs; ++i)
+          const bool anyNonZero = std::any_of(force->Data().begin(),
+              force->Data().begin() + nDofs,
+              [](double _f)
+              {
+                return _f != 0.0;
+              });
+          if (anyNonZero)
           {
-            jointPhys->SetForce(i, force->Data()[i]);
+            for (std::size_t i = 0; i < nDofs; ++i)
+            {
+              jointPhys->SetForce(i, force->Data()[i]);
+            }
+            this->jointsWithAppliedForce.insert(_entity);
+          }
+          else if (this->jointsWithAppliedForce.erase(_entity) > 0u)
+          {
+            // Reset the engine force once; skipping the calls entirely
+            // while the command stays zero.
+            for (std::size_t i = 0; i < nDofs; ++i)
+            {
+              jointPhys->SetForce(i, 0.0);
+            }
           }
         }
         // Only set joint velocity if joint force is not set.
@@ -2522,10 +2680,20 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
 
         if (_slipCmdComp->Data().size() == 2)
         {
-          slipComplianceShape->SetPrimarySlipCompliance(
-              _slipCmdComp->Data()[0]);
-          slipComplianceShape->SetSecondarySlipCompliance(
-              _slipCmdComp->Data()[1]);
+          // Skip the engine calls if these values were already applied.
+          const std::array<double, 2> slip{_slipCmdComp->Data()[0],
+                                           _slipCmdComp->Data()[1]};
+          auto lastIt = this->lastSlipComplianceApplied.find(_entity);
+          if (lastIt != this->lastSlipComplianceApplied.end() &&
+              math::equal(lastIt->second[0], slip[0]) &&
+              math::equal(lastIt->second[1], slip[1]))
+          {
+            return true;
+          }
+
+          slipComplianceShape->SetPrimarySlipCompliance(slip[0]);
+          slipComplianceShape->SetSecondarySlipCompliance(slip[1]);
+          this->lastSlipComplianceApplied[_entity] = slip;
         }
 
         return true;
@@ -2855,10 +3023,35 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
   // Populate bounding box info
   // Only compute bounding box if component exists to avoid unnecessary
   // computations
+
+  // A freshly created box component must be populated even when the model
+  // is at rest, e.g. when the component was removed and requested again.
+  _ecm.EachNew<components::Model, components::AxisAlignedBox>(
+      [&](const Entity &_entity, const components::Model *,
+          const components::AxisAlignedBox *) -> bool
+      {
+        this->aabbLastComputedStep.erase(_entity);
+        return true;
+      });
+
   _ecm.Each<components::Model, components::AxisAlignedBox>(
       [&](const Entity &_entity, const components::Model *,
           components::AxisAlignedBox *_bbox)
       {
+        // The box only changes when a link of the model moves (geometry
+        // changes rebuild the model in the engine, which reports its links
+        // as moved), so models at rest keep their cached box.
+        auto computedIt = this->aabbLastComputedStep.find(_entity);
+        if (computedIt != this->aabbLastComputedStep.end())
+        {
+          auto movedIt = this->modelLastMovedStep.find(_entity);
+          if (movedIt == this->modelLastMovedStep.end() ||
+              movedIt->second < computedIt->second)
+          {
+            return true;
+          }
+        }
+
         if (!this->entityModelMap.HasEntity(_entity))
         {
           gzwarn << "Failed to find model [" << _entity << "]." << std::endl;
@@ -2890,6 +3083,7 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
             ComponentState::PeriodicChange :
             ComponentState::NoChange;
         _ecm.SetChanged(_entity, components::AxisAlignedBox::typeId, state);
+        this->aabbLastComputedStep[_entity] = this->stepCount;
 
         return true;
       });
@@ -2903,6 +3097,21 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
   // Clear worldPoseCmdsToRemove because pose commands that were issued before
   // the reset will be ignored.
   this->linkWorldPoses.clear();
+  this->linkLastMovedStep.clear();
+  this->modelLastMovedStep.clear();
+  this->linkModelChain.clear();
+  this->aabbLastComputedStep.clear();
+  this->jointsWithAppliedForce.clear();
+  // Wake everything so Sleeping components don't go stale across the reset.
+  for (const Entity sleepingLink : this->sleepingLinks)
+  {
+    if (_ecm.SetComponentData<components::Sleeping>(sleepingLink, false))
+    {
+      _ecm.SetChanged(sleepingLink, components::Sleeping::typeId,
+          ComponentState::OneTimeChange);
+    }
+  }
+  this->sleepingLinks.clear();
   this->canonicalLinkModelTracker = CanonicalLinkModelTracker();
   this->modelWorldPoses.clear();
   this->worldPoseCmdsToRemove.clear();
@@ -3012,12 +3221,18 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
   // however, we try to look for the parent model's world pose in
   // modelWorldPoses and fail. So the workaround here is to update the world
   // poses of all models.
+  std::vector<Entity> modelEntities;
   _ecm.Each<components::Model>(
       [&](const Entity &_entity, const components::Model *)
       {
-        this->modelWorldPoses[_entity] = sim::worldPose(_entity, _ecm);
+        modelEntities.push_back(_entity);
         return true;
       });
+  for (const auto &[modelEntity, modelWorldPose] :
+      sim::worldPoses(modelEntities, _ecm))
+  {
+    this->modelWorldPoses[modelEntity] = modelWorldPose;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -3026,16 +3241,67 @@ gz::physics::ForwardStep::Output PhysicsPrivate::Step(
 {
   GZ_PROFILE("PhysicsPrivate::Step");
   physics::ForwardStep::Input input;
-  physics::ForwardStep::State state;
-  physics::ForwardStep::Output output;
 
   input.Get<std::chrono::steady_clock::duration>() = _dt;
 
-  for (const auto &world : this->entityWorldMap.Map())
+  const auto &worlds = this->entityWorldMap.Map();
+
+  if (worlds.size() <= 1)
   {
-    world.second->Step(output, state, input);
+    physics::ForwardStep::State state;
+    physics::ForwardStep::Output output;
+    for (const auto &world : worlds)
+    {
+      world.second->Step(output, state, input);
+    }
+    return output;
+  }
+
+  // With more than one world, step each of them on a worker thread. Worlds
+  // are dynamically independent, so they can advance concurrently.
+  if (nullptr == this->worldStepPool)
+  {
+    this->worldStepPool = std::make_unique<common::WorkerPool>(
+        std::min(worlds.size(), static_cast<std::size_t>(
+        std::max(2u, std::thread::hardware_concurrency()))));
+  }
+
+  std::vector<physics::ForwardStep::Output> outputs(worlds.size());
+  std::vector<physics::ForwardStep::State> states(worlds.size());
+  std::size_t index = 0;
+  for (const auto &world : worlds)
+  {
+    auto worldPtr = world.second;
+    auto *out = &outputs[index];
+    auto *state = &states[index];
+    ++index;
+    this->worldStepPool->AddWork([worldPtr, out, state, &input]()
+    {
+      worldPtr->Step(*out, *state, input);
+    });
   }
+  this->worldStepPool->WaitForResults();
 
+  // Merge the per-world changed poses. If any world's engine didn't report
+  // them, return an output without the entry so ChangedLinks falls back to
+  // scanning all links.
+  physics::ForwardStep::Output output;
+  const bool allHavePoses = std::all_of(outputs.begin(), outputs.end(),
+      [](const physics::ForwardStep::Output &_out)
+      {
+        return _out.Has<physics::ChangedWorldPoses>();
+      });
+  if (allHavePoses)
+  {
+    auto &merged = output.Get<physics::ChangedWorldPoses>().entries;
+    for (auto &out : outputs)
+    {
+      auto &entries = out.Get<physics::ChangedWorldPoses>().entries;
+      merged.insert(merged.end(),
+          std::make_move_iterator(entries.begin()),
+          std::make_move_iterator(entries.end()));
+    }
+  }
   return output;
 }
 
@@ -3075,6 +3341,50 @@ math::Pose3d PhysicsPrivate::RelativePose(const Entity &_from,
   return transform;
 }
 
+//////////////////////////////////////////////////
+void PhysicsPrivate::SetLinkSleeping(EntityComponentManager &_ecm,
+    const Entity _entity, const bool _sleeping)
+{
+  if (_sleeping)
+  {
+    if (!this->sleepingLinks.insert(_entity).second)
+      return;
+  }
+  else if (0 == this->sleepingLinks.erase(_entity))
+  {
+    return;
+  }
+
+  if (_ecm.SetComponentData<components::Sleeping>(_entity, _sleeping))
+  {
+    _ecm.SetChanged(_entity, components::Sleeping::typeId,
+        ComponentState::OneTimeChange);
+  }
+}
+
+//////////////////////////////////////////////////
+void PhysicsPrivate::MarkLinkModelsMoved(const EntityComponentManager &_ecm,
+    const Entity _link)
+{
+  auto chainIt = this->linkModelChain.find(_link);
+  if (chainIt == this->linkModelChain.end())
+  {
+    std::vector<Entity> chain;
+    auto parentComp = _ecm.Component<components::ParentEntity>(_link);
+    while (parentComp)
+    {
+      const Entity parent = parentComp->Data();
+      if (nullptr != _ecm.Component<components::Model>(parent))
+        chain.push_back(parent);
+      parentComp = _ecm.Component<components::ParentEntity>(parent);
+    }
+    chainIt = this->linkModelChain.emplace(_link, std::move(chain)).first;
+  }
+
+  for (const Entity model : chainIt->second)
+    this->modelLastMovedStep[model] = this->stepCount;
+}
+
 //////////////////////////////////////////////////
 std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
     EntityComponentManager &_ecm,
@@ -3082,6 +3392,8 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
 {
   GZ_PROFILE("Links Frame Data");
 
+  ++this->stepCount;
+
   std::map<Entity, physics::FrameData3d> linkFrameData;
 
   // Check to see if the physics engine gave a list of changed poses. If not, we
@@ -3109,6 +3421,30 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
 
       auto frameData = linkPhys->FrameDataRelativeToWorld();
       linkFrameData[entity] = frameData;
+
+      this->linkLastMovedStep[entity] = this->stepCount;
+      this->MarkLinkModelsMoved(_ecm, entity);
+      this->SetLinkSleeping(_ecm, entity, false);
+    }
+
+    // Periodically mark links the engine hasn't reported as moved recently
+    // so their Sleeping component reflects quiescence.
+    if (0 == this->stepCount % kSleepRecheckPeriodSteps)
+    {
+      for (const auto &link : this->entityLinkMap.Map())
+      {
+        if (this->staticEntities.find(link.first) !=
+            this->staticEntities.end())
+        {
+          continue;
+        }
+        auto movedIt = this->linkLastMovedStep.find(link.first);
+        if (movedIt == this->linkLastMovedStep.end() ||
+            this->stepCount - movedIt->second >= kSleepThresholdSteps)
+        {
+          this->SetLinkSleeping(_ecm, link.first, true);
+        }
+      }
     }
   }
   else
@@ -3122,6 +3458,14 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
           return true;
         }
 
+        // Sleeping links are only re-examined periodically; in between,
+        // their frame data isn't even read back.
+        if (this->sleepingLinks.find(_entity) != this->sleepingLinks.end() &&
+            0 != this->stepCount % kSleepRecheckPeriodSteps)
+        {
+          return true;
+        }
+
         // This `once` variable is here to aid in debugging, make sure to
         // remove it.
         auto linkPhys = this->entityLinkMap.Get(_entity);
@@ -3157,6 +3501,19 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
           this->linkWorldPoses[_entity] = worldPoseMath3d;
 
           linkFrameData[_entity] = frameData;
+
+          this->linkLastMovedStep[_entity] = this->stepCount;
+          this->MarkLinkModelsMoved(_ecm, _entity);
+          this->SetLinkSleeping(_ecm, _entity, false);
+        }
+        else
+        {
+          auto movedIt = this->linkLastMovedStep.find(_entity);
+          if (movedIt == this->linkLastMovedStep.end() ||
+              this->stepCount - movedIt->second >= kSleepThresholdSteps)
+          {
+            this->SetLinkSleeping(_ecm, _entity, true);
+          }
         }
 
         return true;
@@ -3374,6 +3731,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
 
   // Link poses, velocities...
   GZ_PROFILE_BEGIN("Links");
+  this->linkPoseWriteback.clear();
   for (const auto &[entity, frameData] : _linkFrameData)
   {
     GZ_PROFILE_BEGIN("Local pose");
@@ -3397,12 +3755,10 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       const math::Pose3d &parentWorldPose = parentModelPoseIt->second;
 
       // Unlike canonical links, pose of regular links can move relative.
-      // to the parent. Same for links inside nested models.
-      auto pose = _ecm.Component<components::Pose>(entity);
-      *pose = components::Pose(parentWorldPose.Inverse() *
-                                math::eigen3::convert(worldPose));
-      _ecm.SetChanged(entity, components::Pose::typeId,
-          ComponentState::PeriodicChange);
+      // to the parent. Same for links inside nested models. The new poses
+      // are collected and committed to the ECM in one batch below.
+      this->linkPoseWriteback.emplace_back(entity,
+          parentWorldPose.Inverse() * math::eigen3::convert(worldPose));
     }
     GZ_PROFILE_END();
 
@@ -3538,6 +3894,10 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           state);
     }
   }
+
+  // Commit all changed link poses in one call so the per-type change
+  // tracking is only resolved once.
+  _ecm.SetComponentDataBatch<components::Pose>(this->linkPoseWriteback);
   GZ_PROFILE_END();
 
   // pose/velocity/acceleration of non-link entities such as sensors /
@@ -3925,13 +4285,24 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       {
         if (auto jointPhys = this->entityJointMap.Get(_entity))
         {
-          _jointPos->Data().resize(jointPhys->GetDegreesOfFreedom());
-          for (std::size_t i = 0; i < jointPhys->GetDegreesOfFreedom(); ++i)
+          const std::size_t dofs = jointPhys->GetDegreesOfFreedom();
+          auto &positions = _jointPos->Data();
+          positions.resize(dofs);
+          bool changed = false;
+          for (std::size_t i = 0; i < dofs; ++i)
           {
-            _jointPos->Data()[i] = jointPhys->GetPosition(i);
+            const double position = jointPhys->GetPosition(i);
+            if (positions[i] != position)
+            {
+              positions[i] = position;
+              changed = true;
+            }
+          }
+          if (changed)
+          {
+            _ecm.SetChanged(_entity, components::JointPosition::typeId,
+                ComponentState::PeriodicChange);
           }
-          _ecm.SetChanged(_entity, components::JointPosition::typeId,
-              ComponentState::PeriodicChange);
         }
         return true;
       });
@@ -3943,11 +4314,12 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       {
         if (auto jointPhys = this->entityJointMap.Get(_entity))
         {
-          _jointVel->Data().resize(jointPhys->GetDegreesOfFreedom());
-          for (std::size_t i = 0; i < jointPhys->GetDegreesOfFreedom();
-               ++i)
+          const std::size_t dofs = jointPhys->GetDegreesOfFreedom();
+          auto &velocities = _jointVel->Data();
+          velocities.resize(dofs);
+          for (std::size_t i = 0; i < dofs; ++i)
           {
-            _jointVel->Data()[i] = jointPhys->GetVelocity(i);
+            velocities[i] = jointPhys->GetVelocity(i);
           }
         }
         return true;
@@ -4001,6 +4373,19 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
 }  // NOLINT readability/fn_size
 // TODO (azeey) Reduce size of function and remove the NOLINT above
 
+//////////////////////////////////////////////////
+const std::string &PhysicsPrivate::ScopedContactName(const Entity _entity,
+    const EntityComponentManager &_ecm)
+{
+  auto it = this->collisionScopedNames.find(_entity);
+  if (it == this->collisionScopedNames.end())
+  {
+    it = this->collisionScopedNames.emplace(_entity,
+        removeParentScope(scopedName(_entity, _ecm, "::", 0), "::")).first;
+  }
+  return it->second;
+}
+
 //////////////////////////////////////////////////
 void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
 {
@@ -4068,7 +4453,8 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
   // position and extra contact date (wrench, normal and penetration depth).
   // This map groups contacts so that it is easy to query all the
   // contacts of one entity.
-  using EntityContactMap = std::unordered_map<Entity, std::deque<ContactData>>;
+  using EntityContactMap =
+      std::unordered_map<Entity, std::vector<ContactData>>;
 
   // This data structure is essentially a mapping between a pair of entities and
   // a list of pointers to their contact object. We use a map inside a map to
@@ -4105,7 +4491,8 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
       [&](const Entity &_collEntity1, components::Collision *,
           components::ContactSensorData *_contacts) -> bool
       {
-        msgs::Contacts contactsComp;
+        msgs::Contacts &contactsComp = this->contactsBuffer;
+        contactsComp.Clear();
         if (entityContactMap.find(_collEntity1) == entityContactMap.end())
         {
           // Clear the last contact data
@@ -4128,9 +4515,9 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
           if (this->contactsEntityNames)
           {
             contactMsg->mutable_collision1()->set_name(
-              removeParentScope(scopedName(_collEntity1, _ecm, "::", 0), "::"));
+              this->ScopedContactName(_collEntity1, _ecm));
             contactMsg->mutable_collision2()->set_name(
-              removeParentScope(scopedName(collEntity2, _ecm, "::", 0), "::"));
+              this->ScopedContactName(collEntity2, _ecm));
           }
           for (const auto &contact : contactData)
           {
@@ -35,6 +35,7 @@
 #include <gz/plugin/Register.hh>
 #include <gz/transport/Node.hh>
 
+#include "gz/sim/PublishQueue.hh"
 #include "gz/sim/Util.hh"
 #include "gz/sim/components/CanonicalLink.hh"
 #include "gz/sim/components/ChildLinkName.hh"
@@ -169,6 +170,10 @@ class gz::sim::systems::PosePublisherPrivate
   /// msgs.
   public: bool usePoseV = false;
 
+  /// \brief True to publish through the shared publication queue, which
+  /// moves serialization off the step but may drop messages under load.
+  public: bool usePublishQueue = false;
+
   /// \brief Whether cache variables have been initialized
   public: bool initialized{false};
 };
@@ -254,6 +259,12 @@ void PosePublisher::Configure(const Entity &_entity,
   this->dataPtr->usePoseV =
     _sdf->Get<bool>("use_pose_vector_msg", this->dataPtr->usePoseV).first;
 
+  // Queued publication is opt-in: the shared queue takes serialization
+  // off the step critical path but is bounded and drops the oldest
+  // message under load, while direct publication is lossless.
+  this->dataPtr->usePublishQueue =
+    _sdf->Get<bool>("use_publish_queue", this->dataPtr->usePublishQueue).first;
+
   std::string poseTopic = topicFromScopedName(_entity, _ecm, true) + "/pose";
   if (poseTopic.empty())
   {
@@ -570,14 +581,32 @@ void PosePublisherPrivate::PublishPoses(
     msg->set_name(childFrameId);
     msgs::Set(msg, transform);
 
-    // publish individual pose msgs
+    // publish individual pose msgs. When opted in, moving the message
+    // into the shared publication queue hands serialization to its I/O
+    // thread; the buffer is cleared before its next use, so moving from
+    // it is safe.
     if (!this->usePoseV)
-      _publisher.Publish(this->poseMsg);
+    {
+      if (this->usePublishQueue)
+      {
+        PublishQueue::Instance().Publish(_publisher,
+            std::move(this->poseMsg));
+      }
+      else
+      {
+        _publisher.Publish(this->poseMsg);
+      }
+    }
   }
 
   // publish pose vector msg
   if (this->usePoseV)
-    _publisher.Publish(this->poseVMsg);
+  {
+    if (this->usePublishQueue)
+      PublishQueue::Instance().Publish(_publisher, std::move(this->poseVMsg));
+    else
+      _publisher.Publish(this->poseVMsg);
+  }
 }
 
 GZ_ADD_PLUGIN(PosePublisher,
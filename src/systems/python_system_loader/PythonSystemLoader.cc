@@ -170,25 +170,17 @@ void PythonSystemLoader::Configure(
 
 //////////////////////////////////////////////////
 template <typename... Args>
-void PythonSystemLoader::CallPythonMethod(py::object _method, Args &&..._args)
+void PythonSystemLoader::CallPythonMethod(const py::object &_method,
+                                          Args &&..._args)
 {
-  if (!this->validConfig)
+  try
   {
-    return;
+    _method(std::forward<Args>(_args)...);
   }
-
-  if (_method)
+  catch (const pybind11::error_already_set &_err)
   {
-    try
-    {
-      _method(std::forward<Args>(_args)...);
-    }
-    catch (const pybind11::error_already_set &_err)
-    {
-      gzerr << _err.what() << std::endl;
-      this->validConfig = false;
-      return;
-    }
+    gzerr << _err.what() << std::endl;
+    this->validConfig = false;
   }
 }
 
@@ -196,9 +188,13 @@ void PythonSystemLoader::CallPythonMethod(py::object _method, Args &&..._args)
 void PythonSystemLoader::PreUpdate(const UpdateInfo &_info,
                                    EntityComponentManager &_ecm)
 {
-  // Add explicit scoped acquire and release of GIL, so that Python
-  // Systems can be executed.This acquire and release is only required
-  // from the PythonSystem code
+  // Only acquire the GIL when there is actually a Python method to call,
+  // so phases the Python system doesn't implement run without touching the
+  // interpreter. The scoped acquire and release is only required from the
+  // PythonSystem code.
+  if (!this->validConfig || !this->preUpdateMethod)
+    return;
+
   py::gil_scoped_acquire gil;
   CallPythonMethod(this->preUpdateMethod, _info, &_ecm);
 }
@@ -207,6 +203,9 @@ void PythonSystemLoader::PreUpdate(const UpdateInfo &_info,
 void PythonSystemLoader::Update(const UpdateInfo &_info,
                                 EntityComponentManager &_ecm)
 {
+  if (!this->validConfig || !this->updateMethod)
+    return;
+
   py::gil_scoped_acquire gil;
   CallPythonMethod(this->updateMethod, _info, &_ecm);
 }
@@ -215,6 +214,9 @@ void PythonSystemLoader::Update(const UpdateInfo &_info,
 void PythonSystemLoader::PostUpdate(const UpdateInfo &_info,
                                     const EntityComponentManager &_ecm)
 {
+  if (!this->validConfig || !this->postUpdateMethod)
+    return;
+
   py::gil_scoped_acquire gil;
   CallPythonMethod(this->postUpdateMethod, _info, &_ecm);
 }
@@ -222,6 +224,9 @@ void PythonSystemLoader::PostUpdate(const UpdateInfo &_info,
 void PythonSystemLoader::Reset(const UpdateInfo &_info,
                                EntityComponentManager &_ecm)
 {
+  if (!this->validConfig || !this->resetMethod)
+    return;
+
   py::gil_scoped_acquire gil;
   CallPythonMethod(this->resetMethod, _info, &_ecm);
 }
@@ -97,9 +97,10 @@ class GZ_SIM_PYTHON_SYSTEM_LOADER_SYSTEM_HIDDEN PythonSystemLoader final
                      EntityComponentManager &_ecm) final;
 
   /// \brief Function that calls each of the python equivalents of Configure,
-  /// PreUpdate, etc.
+  /// PreUpdate, etc. Callers are expected to check validConfig and that the
+  /// method is set before acquiring the GIL and calling this.
   private: template <typename ...Args>
-  void CallPythonMethod(pybind11::object _method, Args&&...);
+  void CallPythonMethod(const pybind11::object &_method, Args&&...);
 
   /// \brief Whether we have a valid configuration after Configure has run. This
   /// includes checking if the Python module is found and that the system is
@@ -17,16 +17,22 @@
 
 #include <gz/msgs/dataframe.pb.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <list>
+#include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <sdf/sdf.hh>
 #include <gz/common/Profiler.hh>
+#include <gz/common/WorkerPool.hh>
 #include <gz/math/Pose3.hh>
 #include <gz/math/Rand.hh>
 #include <gz/plugin/Register.hh>
@@ -150,6 +156,25 @@ struct RFPower
   }
 };
 
+/// \brief One source/destination pairing of an outbound message awaiting
+/// propagation evaluation. Pathloss only depends on the radio poses, so
+/// every pairing can be evaluated in parallel; the stateful delivery pass
+/// then consumes the pairings serially in registry order.
+struct PendingSend
+{
+  /// \brief State of the transmitting radio.
+  RadioState *txState = nullptr;
+
+  /// \brief State of the receiving radio.
+  RadioState *rxState = nullptr;
+
+  /// \brief The outbound message.
+  msgs::DataframeSharedPtr msg;
+
+  /// \brief Received power distribution, filled by the parallel pass.
+  RFPower rxPowerDist{0.0, 0.0};
+};
+
 /// \brief Private RFComms data class.
 class gz::sim::systems::RFComms::Implementation
 {
@@ -164,11 +189,43 @@ class gz::sim::systems::RFComms::Implementation
   /// \param[in out] _txState Current state of the transmitter.
   /// \param[in out] _rxState Current state of the receiver.
   /// \param[in] _numBytes Size of the packet.
+  /// \param[in] _rxPowerDist Received power distribution for this pairing,
+  /// precomputed by EvaluatePathloss.
   /// \return std::tuple<bool, double> reporting if the packet should be
   /// delivered and the received signal strength (in dBm).
   public: std::tuple<bool, double> AttemptSend(RadioState &_txState,
                                                RadioState &_rxState,
-                                               const uint64_t &_numBytes);
+                                               const uint64_t &_numBytes,
+                                               const RFPower &_rxPowerDist);
+
+  /// \brief Evaluate the received power distribution of every pending
+  /// send, in parallel when there are enough of them to amortize the
+  /// dispatch. The evaluation is pure once the radio poses have been
+  /// sampled, so the result is independent of evaluation order; bitrate
+  /// bookkeeping and random draws stay in the serial delivery pass.
+  /// \param[in, out] _pendingSends Pairings to evaluate.
+  public: void EvaluatePathloss(std::vector<PendingSend> &_pendingSends);
+
+  /// \brief Precompute the distance-to-received-power and power-to-BER
+  /// tables for the current range and radio configuration. Called after
+  /// the configuration is parsed; must be called again if parameters ever
+  /// change at runtime.
+  public: void BuildPropagationTables();
+
+  /// \brief Table-based replacement for LogNormalReceivedPower. Linear
+  /// interpolation between bucket samples; falls back to the exact
+  /// formula for ranges shorter than one bucket, where the logarithmic
+  /// pathloss curve is too steep to interpolate.
+  /// \param[in] _range Distance between transmitter and receiver.
+  /// \return The RFPower pathloss distribution at that range.
+  public: RFPower TabulatedReceivedPower(double _range) const;
+
+  /// \brief Table-based log(1 - BER) at a received power, interpolated
+  /// between bucket samples and clamped to the table's power span; both
+  /// ends of the span are deep in the saturated tails of the BER curve.
+  /// \param[in] _rxPowerDbm Received power in dBm.
+  /// \return log(1 - BER); -infinity when the bit error rate saturates.
+  public: double LogOneMinusBer(double _rxPowerDbm) const;
 
   /// \brief Convert from dBm to power.
   /// \param[in] _dBm Input in dBm.
@@ -183,15 +240,6 @@ class gz::sim::systems::RFComms::Implementation
   private: double QPSKPowerToBER(double _power,
                                  double _noise) const;
 
-  /// \brief Function to compute the pathloss between two antenna poses.
-  /// \param[in] _txPower Tx power.
-  /// \param[in] _txState Radio state of the transmitter.
-  /// \param[in] _rxState Radio state of the receiver.
-  /// \return The RFPower pathloss distribution of the two antenna poses.
-  private: RFPower LogNormalReceivedPower(const double &_txPower,
-                                          const RadioState &_txState,
-                                          const RadioState &_rxState) const;
-
   /// \brief Range configuration.
   public: RangeConfiguration rangeConfig;
 
@@ -209,6 +257,25 @@ class gz::sim::systems::RFComms::Implementation
 
   /// \brief Random number generator.
   public: std::default_random_engine rndEngine{rd()};
+
+  /// \brief Worker pool for parallel pathloss evaluation.
+  public: common::WorkerPool workerPool{2};
+
+  /// \brief Received power mean per distance bucket, sampled at multiples
+  /// of pathlossBucketWidth up to the configured max range.
+  public: std::vector<double> pathlossTable;
+
+  /// \brief Distance covered by one pathloss table bucket.
+  public: double pathlossBucketWidth = 0.0;
+
+  /// \brief log(1 - BER) per received-power bucket.
+  public: std::vector<double> logOneMinusBerTable;
+
+  /// \brief Received power of the first BER table bucket (dBm).
+  public: double berTableMinDbm = 0.0;
+
+  /// \brief Received power covered by one BER table bucket (dBm).
+  public: double berTableBucketWidth = 0.0;
 };
 
 /////////////////////////////////////////////
@@ -224,25 +291,10 @@ double RFComms::Implementation::QPSKPowerToBER(
   return erfc(sqrt(_power / _noise));
 }
 
-/////////////////////////////////////////////
-RFPower RFComms::Implementation::LogNormalReceivedPower(
-  const double &_txPower, const RadioState &_txState,
-  const RadioState &_rxState) const
-{
-  const double kRange = _txState.pose.Pos().Distance(_rxState.pose.Pos());
-
-  if (this->rangeConfig.maxRange > 0.0 && kRange > this->rangeConfig.maxRange)
-    return {-std::numeric_limits<double>::infinity(), 0.0};
-
-  const double kPL = this->rangeConfig.l0 +
-    10 * this->rangeConfig.fadingExponent * log10(kRange);
-
-  return {_txPower - kPL, pow(this->rangeConfig.sigma, 2.)};
-}
-
 /////////////////////////////////////////////
 std::tuple<bool, double> RFComms::Implementation::AttemptSend(
-  RadioState &_txState, RadioState &_rxState, const uint64_t &_numBytes)
+  RadioState &_txState, RadioState &_rxState, const uint64_t &_numBytes,
+  const RFPower &_rxPowerDist)
 {
   double now = _txState.timeStamp;
 
@@ -277,9 +329,9 @@ std::tuple<bool, double> RFComms::Implementation::AttemptSend(
   _txState.bytesSent.push_back(std::make_pair(now, _numBytes));
   _txState.bytesSentThisEpoch += _numBytes;
 
-  // Get the received power based on TX power and position of each node.
-  auto rxPowerDist =
-    this->LogNormalReceivedPower(this->radioConfig.txPower, _txState, _rxState);
+  // Received power based on TX power and position of each node,
+  // precomputed by EvaluatePathloss.
+  const RFPower &rxPowerDist = _rxPowerDist;
 
   double rxPower = rxPowerDist.mean;
   if (rxPowerDist.variance > 0.0)
@@ -289,12 +341,10 @@ std::tuple<bool, double> RFComms::Implementation::AttemptSend(
   }
 
   // Based on rx_power, noise value, and modulation, compute the bit
-  // error rate (BER).
-  double ber = this->QPSKPowerToBER(
-    this->DbmToPow(rxPower), this->DbmToPow(this->radioConfig.noiseFloor));
+  // error rate (BER). log(1 - BER) comes from the precomputed table, so
+  // the per-message cost is a lookup and one exponential.
   double packetDropProb =
-
-    1.0 - exp(static_cast<double>(_numBytes) * log(1 - ber));
+    1.0 - exp(static_cast<double>(_numBytes) * this->LogOneMinusBer(rxPower));
 
   // gzdbg << "TX power (dBm): " << this->radioConfig.txPower << "\n" <<
   //           "RX power (dBm): " << rxPower << "\n" <<
@@ -342,6 +392,132 @@ std::tuple<bool, double> RFComms::Implementation::AttemptSend(
   return std::make_tuple(true, rxPower);
 }
 
+/////////////////////////////////////////////
+void RFComms::Implementation::EvaluatePathloss(
+  std::vector<PendingSend> &_pendingSends)
+{
+  // Below this size the chunk dispatch costs more than the math it hides.
+  constexpr std::size_t kParallelThreshold = 64;
+  const std::size_t count = _pendingSends.size();
+  const std::size_t workers = std::thread::hardware_concurrency();
+
+  if (count < kParallelThreshold || workers < 2)
+  {
+    for (auto &pendingSend : _pendingSends)
+    {
+      pendingSend.rxPowerDist = this->TabulatedReceivedPower(
+        pendingSend.txState->pose.Pos().Distance(
+          pendingSend.rxState->pose.Pos()));
+    }
+    return;
+  }
+
+  const std::size_t chunkSize = (count + workers - 1) / workers;
+  for (std::size_t start = 0; start < count; start += chunkSize)
+  {
+    const std::size_t end = std::min(count, start + chunkSize);
+    this->workerPool.AddWork([this, &_pendingSends, start, end]()
+    {
+      for (std::size_t i = start; i < end; ++i)
+      {
+        _pendingSends[i].rxPowerDist = this->TabulatedReceivedPower(
+          _pendingSends[i].txState->pose.Pos().Distance(
+            _pendingSends[i].rxState->pose.Pos()));
+      }
+    });
+  }
+  this->workerPool.WaitForResults();
+}
+
+/////////////////////////////////////////////
+void RFComms::Implementation::BuildPropagationTables()
+{
+  constexpr std::size_t kBuckets = 2048;
+
+  // Distance table over (0, maxRange]. Ranges beyond maxRange are rejected
+  // before any lookup and ranges below one bucket use the exact formula.
+  this->pathlossTable.clear();
+  if (this->rangeConfig.maxRange > 0.0)
+  {
+    this->pathlossBucketWidth = this->rangeConfig.maxRange / kBuckets;
+    this->pathlossTable.reserve(kBuckets + 1);
+    for (std::size_t i = 0; i <= kBuckets; ++i)
+    {
+      // The i == 0 sample is never interpolated against; store the first
+      // bucket's value to keep the table free of infinities.
+      const double d = std::max(1.0, static_cast<double>(i)) *
+        this->pathlossBucketWidth;
+      const double kPL = this->rangeConfig.l0 +
+        10 * this->rangeConfig.fadingExponent * log10(d);
+      this->pathlossTable.push_back(this->radioConfig.txPower - kPL);
+    }
+  }
+
+  // BER table spanning 40 dB either side of the noise floor; outside that
+  // span erfc has saturated to 1 or 0 well past double precision.
+  constexpr double kBerSpanDb = 40.0;
+  this->berTableMinDbm = this->radioConfig.noiseFloor - kBerSpanDb;
+  this->berTableBucketWidth = 2.0 * kBerSpanDb / kBuckets;
+  const double noisePower = this->DbmToPow(this->radioConfig.noiseFloor);
+  this->logOneMinusBerTable.clear();
+  this->logOneMinusBerTable.reserve(kBuckets + 1);
+  for (std::size_t i = 0; i <= kBuckets; ++i)
+  {
+    const double dbm = this->berTableMinDbm +
+      static_cast<double>(i) * this->berTableBucketWidth;
+    const double ber = this->QPSKPowerToBER(this->DbmToPow(dbm), noisePower);
+    this->logOneMinusBerTable.push_back(log(1 - ber));
+  }
+}
+
+/////////////////////////////////////////////
+RFPower RFComms::Implementation::TabulatedReceivedPower(double _range) const
+{
+  if (this->rangeConfig.maxRange > 0.0 &&
+      _range > this->rangeConfig.maxRange)
+  {
+    return {-std::numeric_limits<double>::infinity(), 0.0};
+  }
+
+  const double variance = pow(this->rangeConfig.sigma, 2.);
+
+  if (this->pathlossTable.empty() || _range <= this->pathlossBucketWidth)
+  {
+    // No table (unlimited range) or too close for interpolation.
+    const double kPL = this->rangeConfig.l0 +
+      10 * this->rangeConfig.fadingExponent * log10(_range);
+    return {this->radioConfig.txPower - kPL, variance};
+  }
+
+  const double pos = _range / this->pathlossBucketWidth;
+  const auto i = static_cast<std::size_t>(pos);
+  const double t = pos - static_cast<double>(i);
+  const double mean = this->pathlossTable[i] * (1.0 - t) +
+    this->pathlossTable[i + 1] * t;
+  return {mean, variance};
+}
+
+/////////////////////////////////////////////
+double RFComms::Implementation::LogOneMinusBer(double _rxPowerDbm) const
+{
+  const double span = this->berTableBucketWidth *
+    static_cast<double>(this->logOneMinusBerTable.size() - 1);
+  const double clamped = std::clamp(
+    _rxPowerDbm - this->berTableMinDbm, 0.0, span);
+  const double pos = clamped / this->berTableBucketWidth;
+  auto i = static_cast<std::size_t>(pos);
+  if (i >= this->logOneMinusBerTable.size() - 1)
+    i = this->logOneMinusBerTable.size() - 2;
+  const double t = pos - static_cast<double>(i);
+  const double a = this->logOneMinusBerTable[i];
+  const double b = this->logOneMinusBerTable[i + 1];
+  // The low-power tail holds -infinity where the BER saturates at 1;
+  // interpolating against it would produce NaN.
+  if (!std::isfinite(a) || !std::isfinite(b))
+    return std::min(a, b);
+  return a * (1.0 - t) + b * t;
+}
+
 //////////////////////////////////////////////////
 RFComms::RFComms()
   : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
@@ -391,11 +567,20 @@ void RFComms::Load(const Entity &/*_entity*/,
         this->dataPtr->radioConfig.noiseFloor).first;
   }
 
+  // Seed the fading random engine so runs can be reproduced. Without a
+  // seed the engine keeps its random_device seed.
+  if (_sdf->HasElement("seed"))
+    this->dataPtr->rndEngine.seed(_sdf->Get<unsigned int>("seed"));
+
   gzdbg << "Range configuration:" << std::endl
          << this->dataPtr->rangeConfig << std::endl;
 
   gzdbg << "Radio configuration:" << std::endl
          << this->dataPtr->radioConfig << std::endl;
+
+  // Parameters are fixed after load, so the propagation tables are built
+  // once here.
+  this->dataPtr->BuildPropagationTables();
 }
 
 //////////////////////////////////////////////////
@@ -405,7 +590,18 @@ void RFComms::Step(
       comms::Registry &_newRegistry,
       EntityComponentManager &_ecm)
 {
-  // Update ratio states.
+  // Resolve the world pose of every bound radio in one batched pass,
+  // sharing ancestor poses between radios on the same model tree.
+  std::vector<Entity> radioEntities;
+  radioEntities.reserve(_currentRegistry.size());
+  for (auto & [address, content] : _currentRegistry)
+  {
+    if (content.entity != kNullEntity)
+      radioEntities.push_back(content.entity);
+  }
+  const auto radioPoses = sim::worldPoses(radioEntities, _ecm);
+
+  // Update radio states.
   for (auto & [address, content] : _currentRegistry)
   {
     // Associate entity if needed.
@@ -426,53 +622,65 @@ void RFComms::Step(
     else
     {
       // Update radio state.
-      const auto kPose = sim::worldPose(content.entity, _ecm);
-      this->dataPtr->radioStates[address].pose = kPose;
-      this->dataPtr->radioStates[address].timeStamp =
+      auto &radioState = this->dataPtr->radioStates[address];
+      radioState.pose = radioPoses.at(content.entity);
+      radioState.timeStamp =
         std::chrono::duration<double>(_info.simTime).count();
-      this->dataPtr->radioStates[address].name = content.modelName;
+      radioState.name = content.modelName;
     }
   }
 
+  // Collect every source/destination pairing with both ends attached to a
+  // robot. The propagation evaluation over the pairings is parallel; the
+  // delivery pass below consumes them serially in registry order, so the
+  // bitrate bookkeeping, the random draws and the inbound queue order all
+  // match a serial evaluation.
+  std::vector<PendingSend> pendingSends;
   for (auto & [address, content] : _currentRegistry)
   {
-    // Reference to the outbound queue for this address.
-    auto &outbound = content.outboundMsgs;
-
     // The source address needs to be attached to a robot.
     auto itSrc = this->dataPtr->radioStates.find(address);
     if (itSrc != this->dataPtr->radioStates.end())
     {
       // All these messages need to be processed.
-      for (const auto &msg : outbound)
+      for (const auto &msg : content.outboundMsgs)
       {
         // The destination address needs to be attached to a robot.
         auto itDst = this->dataPtr->radioStates.find(msg->dst_address());
         if (itDst == this->dataPtr->radioStates.end())
           continue;
 
-        auto [sendPacket, rssi] = this->dataPtr->AttemptSend(
-          itSrc->second, itDst->second, msg->data().size());
-
-        if (sendPacket)
-        {
-          // We create a copy of the outbound message because each destination
-          // might have a different rssi value.
-          auto inboundMsg = std::make_shared<msgs::Dataframe>(*msg);
-
-          // Add rssi.
-          auto *rssiPtr = inboundMsg->mutable_header()->add_data();
-          rssiPtr->set_key("rssi");
-          rssiPtr->add_value(std::to_string(rssi));
-
-          _newRegistry[msg->dst_address()].inboundMsgs.push_back(inboundMsg);
-        }
+        pendingSends.push_back({&itSrc->second, &itDst->second, msg});
       }
     }
 
     // Clear the outbound queue.
     _newRegistry[address].outboundMsgs.clear();
   }
+
+  this->dataPtr->EvaluatePathloss(pendingSends);
+
+  for (auto &pendingSend : pendingSends)
+  {
+    auto [sendPacket, rssi] = this->dataPtr->AttemptSend(
+      *pendingSend.txState, *pendingSend.rxState,
+      pendingSend.msg->data().size(), pendingSend.rxPowerDist);
+
+    if (sendPacket)
+    {
+      // We create a copy of the outbound message because each destination
+      // might have a different rssi value.
+      auto inboundMsg = std::make_shared<msgs::Dataframe>(*pendingSend.msg);
+
+      // Add rssi.
+      auto *rssiPtr = inboundMsg->mutable_header()->add_data();
+      rssiPtr->set_key("rssi");
+      rssiPtr->add_value(std::to_string(rssi));
+
+      _newRegistry[pendingSend.msg->dst_address()].inboundMsgs.push_back(
+        inboundMsg);
+    }
+  }
 }
 
 GZ_ADD_PLUGIN(RFComms,
@@ -65,6 +65,10 @@ namespace systems
   ///   - `<noise_floor>`: Noise floor in dBm.  Default is -90dBm.
   ///   - `<modulation>`: Supported modulations: ["QPSK"]. Default is "QPSK".
   ///
+  /// - `<seed>`: Seed for the random engine that draws the log-normal
+  ///             fading, so runs can be reproduced. Without a seed the
+  ///             engine is seeded from the system's random device.
+  ///
   /// ## Example
   ///
   /// Here's an example:
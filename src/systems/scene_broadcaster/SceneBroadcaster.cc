@@ -17,6 +17,9 @@
 
 #include "SceneBroadcaster.hh"
 
+#include "../../ShmStateChannel.hh"
+
+#include <gz/msgs/bytes.pb.h>
 #include <gz/msgs/camerasensor.pb.h>
 #include <gz/msgs/distortion.pb.h>
 #include <gz/msgs/geometry.pb.h>
@@ -39,11 +42,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <condition_variable>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
 #include <gz/math/graph/Graph.hh>
@@ -76,12 +82,14 @@
 #include "gz/sim/components/RgbdCamera.hh"
 #include "gz/sim/components/Scene.hh"
 #include "gz/sim/components/Sensor.hh"
+#include "gz/sim/components/SkipSceneComponents.hh"
 #include "gz/sim/components/Static.hh"
 #include "gz/sim/components/ThermalCamera.hh"
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/Conversions.hh"
 #include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Util.hh"
 
 #include <sdf/Camera.hh>
 #include <sdf/Imu.hh>
@@ -122,10 +130,28 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \return True if successful.
   public: bool StateService(msgs::SerializedStepMap &_res);
 
+  /// \brief Callback for the scoped state service: the state of a single
+  /// entity subtree looked up by scoped name, so introspection tools can
+  /// ask about one model without transferring the whole world.
+  /// \param[in] _req Scoped entity name, e.g. model_name or
+  /// model_name::link_name.
+  /// \param[out] _res Response containing the subtree state.
+  /// \return True if successful.
+  public: bool ScopedStateService(const msgs::StringMsg &_req,
+              msgs::SerializedStepMap &_res);
+
   /// \brief Callback for state service - non blocking.
   /// \param[out] _res Response containing the last available full state.
   public: void StateAsyncService(const msgs::StringMsg &_req);
 
+  /// \brief Deliver the current full state to an async requester in
+  /// entity-granular chunks. Entities are sent in ascending id order, so
+  /// the scene structure (world, models, links) arrives before later
+  /// additions and the receiver can apply each chunk as it lands.
+  /// Callers must hold stateMutex.
+  /// \param[in] _reqSrv Requester's response service.
+  public: void SendChunkedState(const std::string &_reqSrv);
+
   /// \brief Updates the scene graph when entities are added
   /// \param[in] _manager The entity component manager
   public: void SceneGraphAddEntities(const EntityComponentManager &_manager);
@@ -209,6 +235,26 @@ class gz::sim::systems::SceneBroadcasterPrivate
   public: void PoseUpdate(const UpdateInfo &_info,
     const EntityComponentManager &_manager);
 
+  /// \brief Publish the versioned delta pose stream. Delta messages carry
+  /// only entities whose pose changed since the previous message; a
+  /// keyframe carrying all poses is published periodically and whenever
+  /// entities are added or removed, so subscribers can (re)synchronize
+  /// without a request channel.
+  /// \param[in] _info The update information
+  /// \param[in] _manager The entity component manager
+  public: void DeltaPoseUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_manager);
+
+  /// \brief Publish the opt-in compact pose stream. Poses are packed into
+  /// a fixed point binary payload (see appendCompactPose for the wire
+  /// format) and changes from multiple steps are coalesced into a single
+  /// message per publish period, so load spikes grow messages instead of
+  /// multiplying them.
+  /// \param[in] _info The update information
+  /// \param[in] _manager The entity component manager
+  public: void CompactPoseUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_manager);
+
   /// \brief Transport node.
   public: std::unique_ptr<transport::Node> node{nullptr};
 
@@ -221,6 +267,51 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief Rate at which to publish dynamic poses
   public: int dyPoseHertz{60};
 
+  /// \brief Delta pose publisher. Not throttled by transport because a
+  /// dropped delta would lose changes; DeltaPoseUpdate throttles itself
+  /// while accumulating changed entities.
+  public: transport::Node::Publisher deltaPosePub;
+
+  /// \brief Monotonic version stamped on each delta pose message.
+  public: uint64_t deltaPoseVersion{0u};
+
+  /// \brief Entities whose pose changed since the last delta publication.
+  public: std::unordered_set<Entity> pendingDeltaEntities;
+
+  /// \brief Number of delta messages between keyframes.
+  public: int deltaKeyframeInterval{60};
+
+  /// \brief Delta messages left until the next keyframe.
+  public: int deltaKeyframeCountdown{0};
+
+  /// \brief Last time a delta pose message was published.
+  public: std::chrono::time_point<std::chrono::system_clock>
+      lastDeltaPubTime{std::chrono::system_clock::now()};
+
+  /// \brief Whether the compact pose stream was enabled through the
+  /// <compact_pose> system parameter.
+  public: bool compactPoseEnabled{false};
+
+  /// \brief Compact pose publisher.
+  public: transport::Node::Publisher compactPosePub;
+
+  /// \brief Entities whose pose changed since the last compact pose
+  /// publication.
+  public: std::unordered_set<Entity> pendingCompactEntities;
+
+  /// \brief Last time a compact pose message was published.
+  public: std::chrono::time_point<std::chrono::system_clock>
+      lastCompactPubTime{std::chrono::system_clock::now()};
+
+  /// \brief Shared memory channel carrying state snapshots to co-located
+  /// GUIs, bypassing the transport loopback. Inert on unsupported
+  /// platforms.
+  public: ShmStateWriter shmStateWriter;
+
+  /// \brief Reused buffer for serializing state snapshots into the
+  /// shared memory channel.
+  public: std::string shmStateBuffer;
+
   /// \brief Scene publisher
   public: transport::Node::Publisher scenePub;
 
@@ -242,6 +333,11 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// graph.
   public: Entity worldEntity{kNullEntity};
 
+  /// \brief True once the system has been successfully configured. Stays
+  /// false when the world skips scene components, in which case all updates
+  /// are no-ops.
+  public: bool enabled{false};
+
   /// \brief Keep the name of the world entity so it's easy to create temporary
   /// scene graphs
   public: std::string worldName;
@@ -280,6 +376,23 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief A list of async state requests
   public: std::unordered_set<std::string> stateRequests;
 
+  /// \brief Subset of stateRequests whose requester negotiated chunked
+  /// delivery: the full state is split into several messages instead of
+  /// one monolithic transfer.
+  public: std::unordered_set<std::string> chunkedStateRequests;
+
+  /// \brief True while a scoped state request waits to be served by
+  /// PostUpdate. Protected by stateMutex.
+  public: bool scopedStateRequestPending{false};
+
+  /// \brief Scoped name of the pending scoped state request. Protected by
+  /// stateMutex.
+  public: std::string scopedStateRequestName;
+
+  /// \brief Filled by PostUpdate for the scoped state service. Protected
+  /// by stateMutex.
+  public: msgs::SerializedStepMap scopedStepMsg;
+
   /// \brief Store SDF scene information so that it can be inserted into
   /// scene message.
   public: sdf::Scene sdfScene;
@@ -288,6 +401,12 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// This is currently only used in playback mode.
   public: bool pubPeriodicChanges{false};
 
+  /// \brief True when the periodic change cache was dropped because nobody
+  /// consumed state. The first publication after a consumer appears sends
+  /// the full state to resynchronize, since the cache missed changes that
+  /// happened while idle.
+  public: bool stateCacheResync{false};
+
   /// \brief Stores a cache of components that are changed. (This prevents
   ///  dropping of periodic change components which may not be updated
   ///  frequently enough)
@@ -316,12 +435,37 @@ void SceneBroadcaster::Configure(
     return;
   }
 
+  auto skipComp = _ecm.Component<components::SkipSceneComponents>(_entity);
+  if (nullptr != skipComp && skipComp->Data())
+  {
+    gzmsg << "World [" << name->Data() << "] skips scene components. "
+           << "SceneBroadcaster will not maintain a scene graph."
+           << std::endl;
+    return;
+  }
+
   this->dataPtr->worldEntity = _entity;
   this->dataPtr->worldName = name->Data();
+  this->dataPtr->enabled = true;
 
   auto readHertz = _sdf->Get<int>("dynamic_pose_hertz", 60);
   this->dataPtr->dyPoseHertz = readHertz.first;
 
+  auto keyframeInterval = _sdf->Get<int>("delta_keyframe_interval", 60);
+  if (keyframeInterval.first > 0)
+  {
+    this->dataPtr->deltaKeyframeInterval = keyframeInterval.first;
+  }
+  else
+  {
+    gzerr << "SceneBroadcaster delta_keyframe_interval must be positive, "
+          << "using default (" << this->dataPtr->deltaKeyframeInterval
+          << ")\n";
+  }
+
+  this->dataPtr->compactPoseEnabled =
+      _sdf->Get<bool>("compact_pose", false).first;
+
   auto stateHertz = _sdf->Get<double>("state_hertz", 60);
   if (stateHertz.first > 0.0)
   {
@@ -356,6 +500,9 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
 {
   GZ_PROFILE("SceneBroadcaster::PostUpdate");
 
+  if (!this->dataPtr->enabled)
+    return;
+
   // Update scene graph with added entities before populating pose message
   if (_manager.HasNewEntities())
     this->dataPtr->SceneGraphAddEntities(_manager);
@@ -367,6 +514,30 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
   if (sceneComp)
     this->dataPtr->sdfScene = sceneComp->Data();
 
+  // Serve scoped state requests: only the named entity's subtree plus the
+  // world entity, serialized in full, so a single-model query costs the
+  // size of its answer instead of the size of the world.
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->stateMutex);
+    if (this->dataPtr->scopedStateRequestPending)
+    {
+      this->dataPtr->scopedStepMsg.Clear();
+      set(this->dataPtr->scopedStepMsg.mutable_stats(), _info);
+      auto entities = entitiesFromScopedName(
+          this->dataPtr->scopedStateRequestName, _manager);
+      std::unordered_set<Entity> scope{this->dataPtr->worldEntity};
+      for (const auto entity : entities)
+      {
+        const auto descendants = _manager.Descendants(entity);
+        scope.insert(descendants.begin(), descendants.end());
+      }
+      _manager.State(*this->dataPtr->scopedStepMsg.mutable_state(),
+          scope, {}, true);
+      this->dataPtr->scopedStateRequestPending = false;
+      this->dataPtr->stateCv.notify_all();
+    }
+  }
+
   // Create and send pose update if transport connections exist.
   if (this->dataPtr->dyPosePub.HasConnections() ||
       this->dataPtr->posePub.HasConnections())
@@ -374,12 +545,36 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     this->dataPtr->PoseUpdate(_info, _manager);
   }
 
+  // Delta pose stream for bandwidth constrained subscribers.
+  this->dataPtr->DeltaPoseUpdate(_info, _manager);
+
+  // Opt-in compact pose stream.
+  if (this->dataPtr->compactPoseEnabled)
+    this->dataPtr->CompactPoseUpdate(_info, _manager);
+
   // call SceneGraphRemoveEntities at the end of this update cycle so that
   // removed entities are removed from the scene graph for the next update cycle
   this->dataPtr->SceneGraphRemoveEntities(_manager);
 
-  // Iterate through entities and their changes to cache them.
-  _manager.UpdatePeriodicChangeCache(this->dataPtr->changedComponents);
+  // Readers on the shared memory channel consume the same snapshot, so
+  // they keep state publication alive even with no transport subscribers.
+  bool shmActive = this->dataPtr->shmStateWriter.HasActiveReader();
+
+  // Iterate through entities and their changes to cache them, but only
+  // while somebody consumes state: headless runs with a stray broadcaster
+  // would otherwise pay for caching (and grow the cache) for nobody.
+  bool stateConsumers = this->dataPtr->statePub.HasConnections() ||
+      shmActive || this->dataPtr->stateServiceRequest ||
+      !this->dataPtr->stateRequests.empty();
+  if (stateConsumers)
+  {
+    _manager.UpdatePeriodicChangeCache(this->dataPtr->changedComponents);
+  }
+  else if (!this->dataPtr->stateCacheResync)
+  {
+    this->dataPtr->changedComponents.clear();
+    this->dataPtr->stateCacheResync = true;
+  }
 
   // Publish state only if there are subscribers and
   // * throttle rate to 60 Hz
@@ -399,8 +594,9 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
   // check if we need to publish periodic changes in playback mode.
   bool pubChanges = this->dataPtr->pubPeriodicChanges &&
       _manager.HasPeriodicComponentChanges();
-  auto shouldPublish = this->dataPtr->statePub.HasConnections() &&
-       (changeEvent || itsPubTime || pubChanges);
+  auto shouldPublish =
+      (this->dataPtr->statePub.HasConnections() || shmActive) &&
+      (changeEvent || itsPubTime || pubChanges);
 
   if (this->dataPtr->stateServiceRequest || shouldPublish)
   {
@@ -409,10 +605,16 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
 
     set(this->dataPtr->stepMsg.mutable_stats(), _info);
 
-    // Publish full state if it has been explicitly requested
-    if (this->dataPtr->stateServiceRequest)
+    // Publish full state if it has been explicitly requested, or if the
+    // periodic change cache was dropped while nobody was subscribed: the
+    // new subscriber needs a full snapshot to catch up on what the cache
+    // missed.
+    if (this->dataPtr->stateServiceRequest ||
+        (shouldPublish && this->dataPtr->stateCacheResync))
     {
       _manager.State(*this->dataPtr->stepMsg.mutable_state(), {}, {}, true);
+      if (shouldPublish)
+        this->dataPtr->stateCacheResync = false;
     }
     // Publish the changed state if a change occurred to the ECS
     else if (changeEvent)
@@ -468,9 +670,13 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     {
       for (const auto &reqSrv : this->dataPtr->stateRequests)
       {
-        this->dataPtr->node->Request(reqSrv, this->dataPtr->stepMsg);
+        if (this->dataPtr->chunkedStateRequests.count(reqSrv) > 0)
+          this->dataPtr->SendChunkedState(reqSrv);
+        else
+          this->dataPtr->node->Request(reqSrv, this->dataPtr->stepMsg);
       }
       this->dataPtr->stateRequests.clear();
+      this->dataPtr->chunkedStateRequests.clear();
     }
 
     // Poses periodically + change events
@@ -479,7 +685,14 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     if (shouldPublish)
     {
       GZ_PROFILE("SceneBroadcast::PostUpdate Publish State");
-      this->dataPtr->statePub.Publish(this->dataPtr->stepMsg);
+      if (this->dataPtr->statePub.HasConnections())
+        this->dataPtr->statePub.Publish(this->dataPtr->stepMsg);
+      if (shmActive)
+      {
+        this->dataPtr->stepMsg.SerializeToString(
+            &this->dataPtr->shmStateBuffer);
+        this->dataPtr->shmStateWriter.Write(this->dataPtr->shmStateBuffer);
+      }
       this->dataPtr->lastStatePubTime = now;
     }
   }
@@ -610,6 +823,255 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
   }
 }
 
+//////////////////////////////////////////////////
+void SceneBroadcasterPrivate::DeltaPoseUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_manager)
+{
+  GZ_PROFILE("SceneBroadcast::DeltaPoseUpdate");
+
+  if (!this->deltaPosePub.HasConnections())
+  {
+    // Nothing is listening. Drop any accumulated changes and start the
+    // stream with a keyframe when a subscriber shows up.
+    this->pendingDeltaEntities.clear();
+    this->deltaKeyframeCountdown = 0;
+    return;
+  }
+
+  // Accumulate changed entities every step so the self-throttling below
+  // loses no changes between publications.
+  _manager.ChangedEntities(components::Pose::typeId,
+      this->pendingDeltaEntities);
+
+  // Structure changes invalidate the subscriber's picture of the scene, so
+  // they force a keyframe.
+  const bool structureChanged = _manager.HasNewEntities() ||
+      _manager.HasEntitiesMarkedForRemoval();
+  if (structureChanged)
+    this->deltaKeyframeCountdown = 0;
+
+  // Self-throttle instead of using transport::AdvertiseMessageOptions: a
+  // delta dropped by the transport rate limiter would silently lose the
+  // changes it carried.
+  auto now = std::chrono::system_clock::now();
+  auto deltaPeriod = std::chrono::duration<double, std::ratio<1, 1000>>(
+      1000.0 / this->dyPoseHertz);
+  if (!structureChanged && now - this->lastDeltaPubTime < deltaPeriod)
+    return;
+  this->lastDeltaPubTime = now;
+
+  const bool keyframe = this->deltaKeyframeCountdown <= 0;
+
+  msgs::Pose_V msg;
+  auto addPose = [&msg](const Entity _entity, const std::string &_name,
+      const math::Pose3d &_pose)
+  {
+    auto pose = msg.add_pose();
+    msgs::Set(pose, _pose);
+    pose->set_name(_name);
+    pose->set_id(_entity);
+  };
+
+  if (keyframe)
+  {
+    // Keyframes carry the same entity set as the pose topic so a
+    // subscriber can rebuild its state from a single message.
+    _manager.Each<components::Model, components::Name, components::Pose>(
+        [&](const Entity &_entity, const components::Model *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp) -> bool
+        {
+          addPose(_entity, _nameComp->Data(), _poseComp->Data());
+          return true;
+        });
+    _manager.Each<components::Link, components::Name, components::Pose>(
+        [&](const Entity &_entity, const components::Link *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp) -> bool
+        {
+          addPose(_entity, _nameComp->Data(), _poseComp->Data());
+          return true;
+        });
+    _manager.Each<components::Visual, components::Name, components::Pose>(
+        [&](const Entity &_entity, const components::Visual *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp) -> bool
+        {
+          addPose(_entity, _nameComp->Data(), _poseComp->Data());
+          return true;
+        });
+    _manager.Each<components::Light, components::Name, components::Pose>(
+        [&](const Entity &_entity, const components::Light *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp) -> bool
+        {
+          addPose(_entity, _nameComp->Data(), _poseComp->Data());
+          return true;
+        });
+  }
+  else
+  {
+    for (const auto entity : this->pendingDeltaEntities)
+    {
+      auto nameComp = _manager.Component<components::Name>(entity);
+      auto poseComp = _manager.Component<components::Pose>(entity);
+      // Skip entities removed since the change was recorded.
+      if (!nameComp || !poseComp)
+        continue;
+      addPose(entity, nameComp->Data(), poseComp->Data());
+    }
+  }
+  this->pendingDeltaEntities.clear();
+
+  ++this->deltaPoseVersion;
+  msg.mutable_header()->mutable_stamp()->CopyFrom(
+      convert<msgs::Time>(_info.simTime));
+  {
+    auto versionData = msg.mutable_header()->add_data();
+    versionData->set_key("version");
+    versionData->add_value(std::to_string(this->deltaPoseVersion));
+    auto keyframeData = msg.mutable_header()->add_data();
+    keyframeData->set_key("keyframe");
+    keyframeData->add_value(keyframe ? "1" : "0");
+  }
+  this->deltaPosePub.Publish(msg);
+
+  this->deltaKeyframeCountdown = keyframe ?
+      this->deltaKeyframeInterval : this->deltaKeyframeCountdown - 1;
+}
+
+/////////////////////////////////////////////////
+/// \brief Append one pose to a compact pose payload. The wire format per
+/// entry is:
+///   uint32  entity id
+///   int32   x, y, z position, fixed point with 0.1 mm resolution
+///   uint8   index of the dropped quaternion component
+///   int16   the three remaining quaternion components, scaled from
+///           [-1/sqrt(2), 1/sqrt(2)] to the int16 range (smallest-three
+///           encoding: the largest component is dropped and recomputed by
+///           the receiver from the unit norm)
+/// All fields are in the host byte order; every supported platform is
+/// little endian.
+/// \param[in, out] _buffer Payload to append to
+/// \param[in] _entity Entity id
+/// \param[in] _pose Pose to encode
+static void appendCompactPose(std::string &_buffer, const Entity _entity,
+    const math::Pose3d &_pose)
+{
+  auto appendBytes = [&_buffer](const void *_data, std::size_t _size)
+  {
+    _buffer.append(reinterpret_cast<const char *>(_data), _size);
+  };
+
+  uint32_t id = static_cast<uint32_t>(_entity);
+  appendBytes(&id, sizeof(id));
+
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    int32_t fixed = static_cast<int32_t>(std::lround(_pose.Pos()[i] * 1e4));
+    appendBytes(&fixed, sizeof(fixed));
+  }
+
+  const math::Quaterniond &q = _pose.Rot();
+  double comps[4] = {q.W(), q.X(), q.Y(), q.Z()};
+  uint8_t maxIndex = 0u;
+  for (uint8_t i = 1u; i < 4u; ++i)
+  {
+    if (std::abs(comps[i]) > std::abs(comps[maxIndex]))
+      maxIndex = i;
+  }
+  // q and -q describe the same rotation; keep the dropped component
+  // positive so the receiver can recompute it without a sign bit.
+  if (comps[maxIndex] < 0.0)
+  {
+    for (auto &comp : comps)
+      comp = -comp;
+  }
+  appendBytes(&maxIndex, sizeof(maxIndex));
+  const double scale = 32767.0 * std::sqrt(2.0);
+  for (uint8_t i = 0u; i < 4u; ++i)
+  {
+    if (i == maxIndex)
+      continue;
+    int16_t fixed = static_cast<int16_t>(std::lround(comps[i] * scale));
+    appendBytes(&fixed, sizeof(fixed));
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneBroadcasterPrivate::CompactPoseUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_manager)
+{
+  GZ_PROFILE("SceneBroadcast::CompactPoseUpdate");
+
+  if (!this->compactPosePub.HasConnections())
+  {
+    this->pendingCompactEntities.clear();
+    return;
+  }
+
+  // Accumulate changed entities every step: under load multiple steps
+  // coalesce into one bigger message instead of several small ones.
+  _manager.ChangedEntities(components::Pose::typeId,
+      this->pendingCompactEntities);
+
+  auto now = std::chrono::system_clock::now();
+  auto compactPeriod = std::chrono::duration<double, std::ratio<1, 1000>>(
+      1000.0 / this->dyPoseHertz);
+  if (now - this->lastCompactPubTime < compactPeriod ||
+      this->pendingCompactEntities.empty())
+  {
+    return;
+  }
+  this->lastCompactPubTime = now;
+
+  // Resolve entities up front so the count can be written before the
+  // entries.
+  std::vector<std::pair<Entity, math::Pose3d>> poses;
+  poses.reserve(this->pendingCompactEntities.size());
+  for (const auto entity : this->pendingCompactEntities)
+  {
+    auto poseComp = _manager.Component<components::Pose>(entity);
+    // Skip entities removed since the change was recorded.
+    if (!poseComp)
+      continue;
+    poses.emplace_back(entity, poseComp->Data());
+  }
+  this->pendingCompactEntities.clear();
+  if (poses.empty())
+    return;
+
+  std::string buffer;
+  // Payload header: format version, sim time, entry count.
+  const std::size_t entrySize = sizeof(uint32_t) + 3u * sizeof(int32_t) +
+      sizeof(uint8_t) + 3u * sizeof(int16_t);
+  buffer.reserve(sizeof(uint8_t) + sizeof(int64_t) + sizeof(int32_t) +
+      sizeof(uint32_t) + entrySize * poses.size());
+
+  auto appendBytes = [&buffer](const void *_data, std::size_t _size)
+  {
+    buffer.append(reinterpret_cast<const char *>(_data), _size);
+  };
+
+  const uint8_t version = 1u;
+  appendBytes(&version, sizeof(version));
+  auto stamp = convert<msgs::Time>(_info.simTime);
+  int64_t sec = stamp.sec();
+  int32_t nsec = stamp.nsec();
+  appendBytes(&sec, sizeof(sec));
+  appendBytes(&nsec, sizeof(nsec));
+  uint32_t count = static_cast<uint32_t>(poses.size());
+  appendBytes(&count, sizeof(count));
+
+  for (const auto &[entity, pose] : poses)
+    appendCompactPose(buffer, entity, pose);
+
+  msgs::Bytes msg;
+  msg.mutable_header()->mutable_stamp()->CopyFrom(stamp);
+  msg.set_data(std::move(buffer));
+  this->compactPosePub.Publish(msg);
+}
+
 //////////////////////////////////////////////////
 void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
 {
@@ -654,6 +1116,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Serving full state on [" << opts.NameSpace() << "/"
          << stateService << "]" << std::endl;
 
+  // Scoped state service
+  std::string scopedStateService{"state_scoped"};
+
+  this->node->Advertise(scopedStateService,
+      &SceneBroadcasterPrivate::ScopedStateService, this);
+
+  gzmsg << "Serving scoped state on [" << opts.NameSpace() << "/"
+         << scopedStateService << "]" << std::endl;
+
   // Async State service
   std::string stateAsyncService{"state_async"};
 
@@ -689,6 +1160,16 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Publishing state changes on [" << stateTopic << "]"
       << std::endl;
 
+  // Shared memory fast path for GUIs on the same host. The partition is
+  // part of the segment name so unrelated simulations do not cross-talk.
+  if (this->shmStateWriter.Open(
+      this->node->Options().Partition() + "-" + _worldName))
+  {
+    gzmsg << "Sharing state snapshots on shared memory segment ["
+           << ShmStateName(this->node->Options().Partition() + "-" +
+              _worldName) << "]" << std::endl;
+  }
+
   // Pose info publisher
   std::string poseTopic{"pose/info"};
 
@@ -710,6 +1191,27 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
 
   gzmsg << "Publishing dynamic pose messages on [" << opts.NameSpace() << "/"
          << dyPoseTopic << "]" << std::endl;
+
+  // Delta pose publisher. See DeltaPoseUpdate for why this topic is not
+  // throttled through the advertise options.
+  std::string deltaPoseTopic{"pose/delta"};
+
+  this->deltaPosePub = this->node->Advertise<msgs::Pose_V>(deltaPoseTopic);
+
+  gzmsg << "Publishing delta pose messages on [" << opts.NameSpace() << "/"
+         << deltaPoseTopic << "]" << std::endl;
+
+  if (this->compactPoseEnabled)
+  {
+    // Compact pose publisher, self-throttled like the delta stream.
+    std::string compactPoseTopic{"pose/compact"};
+
+    this->compactPosePub =
+        this->node->Advertise<msgs::Bytes>(compactPoseTopic);
+
+    gzmsg << "Publishing compact pose messages on [" << opts.NameSpace()
+           << "/" << compactPoseTopic << "]" << std::endl;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -717,10 +1219,8 @@ bool SceneBroadcasterPrivate::SceneInfoService(msgs::Scene &_res)
 {
   std::lock_guard<std::mutex> lock(this->graphMutex);
 
-  _res.Clear();
-
   // Populate scene message
-  _res.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+  set(&_res, this->sdfScene);
 
   // Add models
   AddModels(&_res, this->worldEntity, this->sceneGraph);
@@ -738,6 +1238,66 @@ void SceneBroadcasterPrivate::StateAsyncService(
   std::unique_lock<std::mutex> lock(this->stateMutex);
   this->stateServiceRequest = true;
   this->stateRequests.insert(_req.data());
+
+  // Requesters opt in to chunked delivery through a header entry; a plain
+  // request keeps getting the single monolithic response.
+  for (const auto &data : _req.header().data())
+  {
+    if (data.key() == "chunked" && data.value_size() > 0 &&
+        data.value(0) == "true")
+    {
+      this->chunkedStateRequests.insert(_req.data());
+      break;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneBroadcasterPrivate::SendChunkedState(const std::string &_reqSrv)
+{
+  // Cap well under the transport's maximum message size. A chunk holds as
+  // many whole entities as fit; a single entity larger than the budget
+  // still travels alone in its own chunk.
+  static constexpr std::size_t kChunkBudget = 4 * 1024 * 1024;
+
+  const auto &entities = this->stepMsg.state().entities();
+
+  // Ascending entity ids approximate creation order, which puts the scene
+  // structure in the first chunks.
+  std::vector<uint64_t> ids;
+  ids.reserve(entities.size());
+  for (const auto &entityIt : entities)
+    ids.push_back(entityIt.first);
+  std::sort(ids.begin(), ids.end());
+
+  std::vector<msgs::SerializedStepMap> chunks;
+  chunks.emplace_back();
+  std::size_t chunkBytes = 0;
+  for (const auto id : ids)
+  {
+    const auto &entityMsg = entities.at(id);
+    const std::size_t entityBytes = entityMsg.ByteSizeLong();
+    if (chunkBytes > 0 && chunkBytes + entityBytes > kChunkBudget)
+    {
+      chunks.emplace_back();
+      chunkBytes = 0;
+    }
+    (*chunks.back().mutable_state()->mutable_entities())[id] = entityMsg;
+    chunkBytes += entityBytes;
+  }
+
+  for (std::size_t i = 0; i < chunks.size(); ++i)
+  {
+    auto &chunk = chunks[i];
+    chunk.mutable_stats()->CopyFrom(this->stepMsg.stats());
+    chunk.mutable_state()->set_has_one_time_component_changes(
+        this->stepMsg.state().has_one_time_component_changes());
+    // The receiver unadvertises its response service when this reaches 0.
+    auto *remaining = chunk.mutable_state()->mutable_header()->add_data();
+    remaining->set_key("chunks_remaining");
+    remaining->add_value(std::to_string(chunks.size() - 1 - i));
+    this->node->Request(_reqSrv, chunk);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -763,6 +1323,31 @@ bool SceneBroadcasterPrivate::StateService(
   return success;
 }
 
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::ScopedStateService(
+    const msgs::StringMsg &_req, msgs::SerializedStepMap &_res)
+{
+  _res.Clear();
+
+  // Lock and wait for an iteration to serve the request against the live
+  // entity component manager.
+  std::unique_lock<std::mutex> lock(this->stateMutex);
+
+  this->scopedStateRequestName = _req.data();
+  this->scopedStateRequestPending = true;
+  auto success = this->stateCv.wait_for(lock, 5s, [&]
+  {
+    return !this->scopedStateRequestPending;
+  });
+
+  if (success)
+    _res.CopyFrom(this->scopedStepMsg);
+  else
+    gzerr << "Timed out waiting for scoped state" << std::endl;
+
+  return success;
+}
+
 //////////////////////////////////////////////////
 bool SceneBroadcasterPrivate::SceneGraphService(msgs::StringMsg &_res)
 {
@@ -893,7 +1478,7 @@ void SceneBroadcasterPrivate::SceneGraphAddEntities(
           const components::Pose *_poseComp) -> bool
       {
         auto lightMsg = std::make_shared<msgs::Light>();
-        lightMsg->CopyFrom(convert<msgs::Light>(_lightComp->Data()));
+        set(lightMsg.get(), _lightComp->Data());
         lightMsg->set_id(_entity);
         lightMsg->set_parent_id(_parentComp->Data());
         lightMsg->set_name(_nameComp->Data());
@@ -1166,15 +1751,20 @@ void SceneBroadcasterPrivate::SceneGraphAddEntities(
     if (!this->node)
       this->SetupTransport(this->worldName);
 
-    msgs::Scene sceneMsg;
-    // Populate scene message
-    sceneMsg.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+    // Only build the scene message when somebody listens; subscribers that
+    // connect later fetch the same content through the scene info service.
+    if (this->scenePub.HasConnections())
+    {
+      msgs::Scene sceneMsg;
+      // Populate scene message
+      set(&sceneMsg, this->sdfScene);
 
-    AddModels(&sceneMsg, this->worldEntity, newGraph);
+      AddModels(&sceneMsg, this->worldEntity, newGraph);
 
-    // Add lights
-    AddLights(&sceneMsg, this->worldEntity, newGraph);
-    this->scenePub.Publish(sceneMsg);
+      // Add lights
+      AddLights(&sceneMsg, this->worldEntity, newGraph);
+      this->scenePub.Publish(sceneMsg);
+    }
   }
 }
 
@@ -1210,7 +1800,7 @@ void SceneBroadcasterPrivate::SceneGraphRemoveEntities(
         return true;
       });
 
-  if (!removedEntities.empty())
+  if (!removedEntities.empty() && this->deletionPub.HasConnections())
   {
     // Send the list of deleted entities
     msgs::UInt32_V deletionMsg;
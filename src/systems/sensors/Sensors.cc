@@ -17,14 +17,19 @@
 
 #include "Sensors.hh"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <map>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
+#include <gz/common/Util.hh>
 #include <gz/plugin/Register.hh>
 
 #include <sdf/Sensor.hh>
@@ -61,6 +66,7 @@
 #include "gz/sim/components/World.hh"
 #include "gz/sim/Events.hh"
 #include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Util.hh"
 
 #include "gz/sim/rendering/Events.hh"
 #include "gz/sim/rendering/RenderUtil.hh"
@@ -158,14 +164,32 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Update time to be appplied in the rendering thread
   public: std::chrono::steady_clock::duration updateTimeToApply;
 
-  /// \brief Next sensors update time
-  public: std::chrono::steady_clock::duration nextUpdateTime;
+  /// \brief Staleness cap in sim time for lockstep-free sensor updates.
+  /// When positive, the simulation loop does not wait for the render
+  /// thread as long as the frame it is rendering is no older than this
+  /// cap; rendering sensors run on their own cadence against the latest
+  /// latched state. Zero (the default) keeps lockstep behavior.
+  public: std::chrono::steady_clock::duration stalenessCap{0};
 
   /// \brief Sensors to include in the next rendering iteration
   public: std::set<sensors::SensorId> activeSensors;
 
-  /// \brief Sensors to be updated next
-  public: std::set<sensors::SensorId> sensorsToUpdate;
+  /// \brief Sensors bucketed by the simulation time at which they are next
+  /// due. Each step only the due buckets are popped, instead of scanning
+  /// every sensor. Only accessed from the simulation thread.
+  public: std::map<std::chrono::steady_clock::duration,
+      std::set<sensors::SensorId>> sensorSchedule;
+
+  /// \brief Bucket each scheduled sensor currently sits in, so it can be
+  /// removed or reinserted when its due time changes.
+  public: std::unordered_map<sensors::SensorId,
+      std::chrono::steady_clock::duration> scheduledTime;
+
+  /// \brief Sensors created on the rendering thread, staged here under
+  /// sensorsMutex until the simulation thread inserts them into
+  /// sensorSchedule.
+  public: std::vector<std::pair<sensors::SensorId,
+      std::chrono::steady_clock::duration>> pendingSchedule;
 
   /// \brief Mutex to protect sensorMask
   public: std::mutex sensorsMutex;
@@ -173,6 +197,17 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Pointer to the event manager
   public: EventManager *eventManager{nullptr};
 
+  /// \brief Pre render event channel, resolved once at Configure time so
+  /// the render loop signals it directly instead of going through the
+  /// EventManager type lookup every frame.
+  public: events::PreRender *preRenderEvent{nullptr};
+
+  /// \brief Render event channel. \sa preRenderEvent
+  public: events::Render *renderEvent{nullptr};
+
+  /// \brief Post render event channel. \sa preRenderEvent
+  public: events::PostRender *postRenderEvent{nullptr};
+
   /// \brief Wait for initialization to happen
   private: void WaitForInit();
 
@@ -203,8 +238,11 @@ class gz::sim::systems::SensorsPrivate
   /// rendering operation currently ongoing. Rendering will occur
   /// asyncronously.
   //
-  /// The caller of PostUpdate will be blocked if there is a rendering
-  /// operation currently ongoing, until that completes.
+  /// The caller of PostUpdate will be blocked only until the rendering
+  /// thread has latched the staged scene state for the current frame,
+  /// i.e. until renderUtil.Update() has applied the ECM changes to the
+  /// scene and the per-frame flags have been copied. The actual render
+  /// then overlaps with the next simulation step.
   private: void RenderThread();
 
   /// \brief Launch the rendering thread
@@ -220,13 +258,25 @@ class gz::sim::systems::SensorsPrivate
   /// \param[in] _ecm Entity component manager
   public: void UpdateBatteryState(const EntityComponentManager &_ecm);
 
-  /// \brief Get the next closest sensor update time
-  public: std::chrono::steady_clock::duration NextUpdateTime(
-      std::set<sensors::SensorId> &_sensorsToUpdate,
-      const std::chrono::steady_clock::duration &_currentTime);
-
-  /// \brief Check if any of the sensors have connections
-  public: bool SensorsHaveConnections();
+  /// \brief Insert a sensor into the schedule, or move it to a new bucket
+  /// if it is already scheduled.
+  /// \param[in] _id Sensor to schedule
+  /// \param[in] _dueTime Simulation time at which the sensor is next due
+  public: void ScheduleSensor(sensors::SensorId _id,
+      const std::chrono::steady_clock::duration &_dueTime);
+
+  /// \brief Remove a sensor from the schedule.
+  /// \param[in] _id Sensor to remove
+  public: void UnscheduleSensor(sensors::SensorId _id);
+
+  /// \brief Pop all sensors that are due at the given simulation time and
+  /// reschedule them at their next due time. Sensors without connections
+  /// and triggered sensors stay in the schedule but are not returned.
+  /// \param[in] _currentTime Current simulation time
+  /// \param[out] _dueSensors Sensors that should render this iteration
+  public: void PopDueSensors(
+      const std::chrono::steady_clock::duration &_currentTime,
+      std::set<sensors::SensorId> &_dueSensors);
 
   /// \brief Returns all sensors that have a pending trigger
   public: std::unordered_set<sensors::SensorId> SensorsWithPendingTrigger();
@@ -255,6 +305,18 @@ class gz::sim::systems::SensorsPrivate
 
   /// \brief Mutex to protect access to sensorStateChanged
   public: std::mutex sensorStateMutex;
+
+  /// \brief Number of camera passes to batch per GPU flush. Larger values
+  /// let more same-rate sensors render in one scene pass at the cost of
+  /// latency before results are read back.
+  public: unsigned int cameraPassCountPerGpuFlush{6u};
+
+  /// \brief Number of render frames dispatched so far
+  public: uint64_t renderFrameCount{0u};
+
+  /// \brief Total number of active sensors latched across all render
+  /// frames. Together with renderFrameCount this gives the mean batch size.
+  public: uint64_t renderedSensorCount{0u};
 };
 
 //////////////////////////////////////////////////
@@ -287,7 +349,8 @@ void SensorsPrivate::WaitForInit()
       // See Sensors::Update.
 #endif
       this->scene = this->renderUtil.Scene();
-      this->scene->SetCameraPassCountPerGpuFlush(6u);
+      this->scene->SetCameraPassCountPerGpuFlush(
+          this->cameraPassCountPerGpuFlush);
       this->initialized = true;
     }
 
@@ -326,14 +389,31 @@ void SensorsPrivate::RunOnce()
     this->updateTimeCv.notify_one();
   }
 
-  bool activeSensorsEmpty = true;
+  std::size_t batchSize = 0u;
   {
     std::unique_lock<std::mutex> lk(this->sensorsMutex);
-    activeSensorsEmpty = this->activeSensors.empty();
+    batchSize = this->activeSensors.size();
+    this->activeSensors.clear();
   }
+  const bool activeSensorsEmpty = (0u == batchSize);
 
-  if (!activeSensorsEmpty || this->forceUpdate)
+  // Latch the force flag for this frame. ForceRender requests arriving from
+  // here on belong to the next frame.
+  const bool forceUpdateLatched = this->forceUpdate.exchange(false);
+
+  // The staged scene state has been latched; release the simulation loop so
+  // physics can run the next step while this thread renders the current one.
   {
+    std::unique_lock<std::mutex> cvLock(this->renderMutex);
+    this->updateAvailable = false;
+    this->renderCv.notify_one();
+  }
+
+  if (!activeSensorsEmpty || forceUpdateLatched)
+  {
+    ++this->renderFrameCount;
+    this->renderedSensorCount += batchSize;
+
     // disable sensors that are out of battery or re-enable sensors that are
     // being charged
     if (this->disableOnDrainedBattery)
@@ -353,7 +433,7 @@ void SensorsPrivate::RunOnce()
 
     {
       GZ_PROFILE("PreRender");
-      this->eventManager->Emit<events::PreRender>();
+      this->preRenderEvent->Signal();
       this->scene->SetTime(this->updateTimeApplied);
       // Update the scene graph manually to improve performance
       // We only need to do this once per frame It is important to call
@@ -380,13 +460,19 @@ void SensorsPrivate::RunOnce()
 
     // safety check to see if reset occurred while we're rendering
     // avoid publishing outdated data if reset occurred
-    std::unique_lock<std::mutex> timeLock(this->renderMutex);
-    if (this->updateTimeApplied <= this->updateTime)
+    // Only hold renderMutex for the comparison so the simulation loop is not
+    // blocked on it while this thread publishes.
+    bool updateTimeValid = false;
+    {
+      std::unique_lock<std::mutex> timeLock(this->renderMutex);
+      updateTimeValid = this->updateTimeApplied <= this->updateTime;
+    }
+    if (updateTimeValid)
     {
       // publish data
       GZ_PROFILE("RunOnce");
       this->sensorManager.RunOnce(this->updateTimeApplied);
-      this->eventManager->Emit<events::Render>();
+      this->renderEvent->Signal();
     }
 
     // re-enble sensors
@@ -402,18 +488,8 @@ void SensorsPrivate::RunOnce()
       // sensors::RenderingSensor::SetManualSceneUpdate and set it to true
       // so we don't waste cycles doing one scene graph update per sensor
       this->scene->PostRender();
-      this->eventManager->Emit<events::PostRender>();
+      this->postRenderEvent->Signal();
     }
-
-    std::unique_lock<std::mutex> lk(this->sensorsMutex);
-    this->activeSensors.clear();
-  }
-
-  this->forceUpdate = false;
-  {
-    std::unique_lock<std::mutex> cvLock(this->renderMutex);
-    this->updateAvailable = false;
-    this->renderCv.notify_one();
   }
 }
 
@@ -424,6 +500,63 @@ void SensorsPrivate::RenderThread()
 
   gzdbg << "SensorsPrivate::RenderThread started" << std::endl;
 
+  // Optionally pin the render thread, e.g. to the NUMA node driving the
+  // GPU, through a comma-separated CPU list.
+  // Optional thread policy. The server forwards a configured
+  // ServerConfig SensorsRender thread policy through these variables;
+  // they can also be set by hand.
+  std::string name;
+  common::env("GZ_SIM_RENDER_THREAD_NAME", name);
+
+  std::vector<unsigned int> cpus;
+  std::string affinity;
+  if (common::env("GZ_SIM_RENDER_THREAD_AFFINITY", affinity) &&
+      !affinity.empty())
+  {
+    for (const auto &token : common::split(affinity, ","))
+    {
+      try
+      {
+        cpus.push_back(static_cast<unsigned int>(std::stoul(token)));
+      }
+      catch (const std::exception &)
+      {
+        gzwarn << "Ignoring invalid CPU index [" << token
+               << "] in GZ_SIM_RENDER_THREAD_AFFINITY" << std::endl;
+      }
+    }
+  }
+
+  // Scheduling class and priority, e.g. "fifo:10", "rr:5" or "other".
+  std::string schedulingClass;
+  int priority = 0;
+  std::string sched;
+  if (common::env("GZ_SIM_RENDER_THREAD_SCHED", sched) && !sched.empty())
+  {
+    const auto sep = sched.find(':');
+    schedulingClass = sched.substr(0, sep);
+    if (sep != std::string::npos)
+    {
+      try
+      {
+        priority = std::stoi(sched.substr(sep + 1));
+      }
+      catch (const std::exception &)
+      {
+        gzwarn << "Ignoring invalid priority in GZ_SIM_RENDER_THREAD_SCHED ["
+               << sched << "]" << std::endl;
+      }
+    }
+  }
+
+  if (!name.empty() || !cpus.empty() || !schedulingClass.empty())
+  {
+    if (applyThreadPolicy(name, cpus, schedulingClass, priority))
+      gzdbg << "Applied render thread policy\n";
+    else
+      gzwarn << "Unable to apply render thread policy\n";
+  }
+
   // We have to wait for rendering sensors to be available
   this->WaitForInit();
 
@@ -434,6 +567,16 @@ void SensorsPrivate::RenderThread()
 
   this->eventManager->Emit<events::RenderTeardown>();
 
+  if (this->renderFrameCount > 0u)
+  {
+    gzdbg << "Rendered " << this->renderFrameCount << " frames with a mean "
+          << "sensor batch size of "
+          << static_cast<double>(this->renderedSensorCount) /
+             static_cast<double>(this->renderFrameCount)
+          << " (camera passes per GPU flush: "
+          << this->cameraPassCountPerGpuFlush << ")" << std::endl;
+  }
+
   // clean up before exiting
   for (const auto id : this->sensorIds)
     this->sensorManager.Remove(id);
@@ -491,8 +634,15 @@ void Sensors::RemoveSensor(const Entity &_entity)
     {
       std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
       this->dataPtr->activeSensors.erase(idIter->second);
-      this->dataPtr->sensorsToUpdate.erase(idIter->second);
+      this->dataPtr->pendingSchedule.erase(std::remove_if(
+          this->dataPtr->pendingSchedule.begin(),
+          this->dataPtr->pendingSchedule.end(),
+          [&](const auto &_entry)
+          {
+            return _entry.first == idIter->second;
+          }), this->dataPtr->pendingSchedule.end());
     }
+    this->dataPtr->UnscheduleSensor(idIter->second);
 
     // update cameras list
     for (auto &it : this->dataPtr->cameras)
@@ -549,6 +699,42 @@ void Sensors::Configure(const Entity &/*_id*/,
   if (_sdf->HasElement("ambient_light"))
     this->dataPtr->ambientLight = _sdf->Get<math::Color>("ambient_light");
 
+  // Get the number of camera passes to batch per GPU flush, if specified.
+  // Worlds with many same-rate rendering sensors (e.g. multi-lidar rigs)
+  // can raise this so the whole batch renders in one scene pass.
+  this->dataPtr->cameraPassCountPerGpuFlush =
+      _sdf->Get<unsigned int>("camera_pass_count_per_gpu_flush",
+      this->dataPtr->cameraPassCountPerGpuFlush).first;
+
+  // Bounded staleness mode: when a positive cap (in seconds of sim time)
+  // is configured, the simulation loop does not wait for the render thread
+  // as long as sensor output is no staler than the cap, trading frame-exact
+  // sensor timing for throughput on camera-heavy worlds.
+  double stalenessSec =
+      _sdf->Get<double>("bounded_staleness", 0.0).first;
+  std::string stalenessEnv;
+  if (common::env("GZ_SIM_SENSORS_BOUNDED_STALENESS", stalenessEnv) &&
+      !stalenessEnv.empty())
+  {
+    try
+    {
+      stalenessSec = std::stod(stalenessEnv);
+    }
+    catch (const std::exception &)
+    {
+      gzwarn << "Invalid GZ_SIM_SENSORS_BOUNDED_STALENESS value ["
+             << stalenessEnv << "]" << std::endl;
+    }
+  }
+  if (stalenessSec > 0.0)
+  {
+    this->dataPtr->stalenessCap =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(stalenessSec));
+    gzdbg << "Rendering sensors running lockstep-free with a staleness cap "
+          << "of " << stalenessSec << " s of sim time" << std::endl;
+  }
+
   this->dataPtr->renderUtil.SetEngineName(engineName);
 #ifdef __APPLE__
   if (apiBackend.empty())
@@ -606,6 +792,12 @@ void Sensors::Configure(const Entity &/*_id*/,
 
   this->dataPtr->eventManager = &_eventMgr;
 
+  // Resolve the per-frame render event channels once so the render thread
+  // emits them without a type-indexed lookup.
+  this->dataPtr->preRenderEvent = &_eventMgr.Channel<events::PreRender>();
+  this->dataPtr->renderEvent = &_eventMgr.Channel<events::Render>();
+  this->dataPtr->postRenderEvent = &_eventMgr.Channel<events::PostRender>();
+
   this->dataPtr->stopConn = this->dataPtr->eventManager->Connect<events::Stop>(
       std::bind(&SensorsPrivate::Stop, this->dataPtr.get()));
 
@@ -628,7 +820,7 @@ void Sensors::Reset(const UpdateInfo &_info, EntityComponentManager &)
     {
       std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
       this->dataPtr->activeSensors.clear();
-      this->dataPtr->sensorsToUpdate.clear();
+      this->dataPtr->pendingSchedule.clear();
     }
 
     for (auto id : this->dataPtr->sensorIds)
@@ -642,12 +834,19 @@ void Sensors::Reset(const UpdateInfo &_info, EntityComponentManager &)
       }
 
       s->SetNextDataUpdateTime(_info.simTime);
+      this->dataPtr->ScheduleSensor(id, _info.simTime);
+    }
+    {
+      std::unique_lock<std::mutex> lock2(this->dataPtr->renderUtilMutex);
+      this->dataPtr->updateTime =  _info.simTime;
+      this->dataPtr->updateTimeToApply =  _info.simTime;
+      this->dataPtr->updateTimeApplied =  _info.simTime;
     }
-    this->dataPtr->nextUpdateTime =  _info.simTime;
-    std::unique_lock<std::mutex> lock2(this->dataPtr->renderUtilMutex);
-    this->dataPtr->updateTime =  _info.simTime;
-    this->dataPtr->updateTimeToApply =  _info.simTime;
-    this->dataPtr->updateTimeApplied =  _info.simTime;
+
+    // Render one frame right away so the first observation after a reset
+    // reflects the restored poses instead of waiting for the next
+    // scheduled sensor update.
+    this->dataPtr->forceUpdate = true;
   }
 }
 
@@ -672,7 +871,6 @@ void Sensors::Update(const UpdateInfo &_info,
     std::unique_lock<std::mutex> lock(this->dataPtr->renderMutex);
     gzdbg << "Initialization needed" << std::endl;
     this->dataPtr->renderUtil.Init();
-    this->dataPtr->nextUpdateTime = _info.simTime;
   }
 #endif
 
@@ -708,6 +906,22 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
 
   if (this->dataPtr->running && this->dataPtr->initialized)
   {
+    // Bounded staleness: while the render thread is still busy with the
+    // previously staged frame, skip the lockstep waits below as long as the
+    // frame it is rendering is within the staleness cap. The staged state
+    // accumulates keyed by entity, so the next latch simply picks up the
+    // freshest poses. Once the cap is exceeded the usual waits bound how
+    // far sensor output can fall behind.
+    bool skipLockstepWaits = false;
+    if (this->dataPtr->stalenessCap.count() > 0 &&
+        this->dataPtr->updateAvailable)
+    {
+      std::unique_lock<std::mutex> timeLock(this->dataPtr->renderUtilMutex);
+      skipLockstepWaits =
+          _info.simTime - this->dataPtr->updateTimeApplied <=
+          this->dataPtr->stalenessCap;
+    }
+
     {
       GZ_PROFILE("UpdateFromECM");
       // Make sure we do not override the state in renderUtil if there are
@@ -715,12 +929,15 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
       // i.e. wait until renderUtil.Update(), has taken place in the
       // rendering thread
       std::unique_lock<std::mutex> lock(this->dataPtr->renderUtilMutex);
-      this->dataPtr->updateTimeCv.wait(lock, [this]()
+      if (!skipLockstepWaits)
       {
-        return !this->dataPtr->updateAvailable ||
-               (this->dataPtr->updateTimeToApply ==
-               this->dataPtr->updateTimeApplied);
-      });
+        this->dataPtr->updateTimeCv.wait(lock, [this]()
+        {
+          return !this->dataPtr->updateAvailable ||
+                 (this->dataPtr->updateTimeToApply ==
+                 this->dataPtr->updateTimeApplied);
+        });
+      }
 
       this->dataPtr->renderUtil.UpdateFromECM(_info, _ecm);
       this->dataPtr->updateTime = _info.simTime;
@@ -732,28 +949,23 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
     // rate which can be too frequent and causes a performance hit.
     // We should look into throttling render updates
     bool hasRenderConnections =
-      (this->dataPtr->eventManager->ConnectionCount<events::PreRender>() > 0u ||
-      this->dataPtr->eventManager->ConnectionCount<events::Render>() > 0u ||
-      this->dataPtr->eventManager->ConnectionCount<events::PostRender>() > 0u);
-
-    // if nextUpdateTime is max, it probably means there are previously
-    // no active sensors or sensors with connections.
-    // In this case, check if sensors have connections now. If so, we need to
-    // set the nextUpdateTime
-    if (this->dataPtr->nextUpdateTime ==
-        std::chrono::steady_clock::duration::max() &&
-        this->dataPtr->SensorsHaveConnections())
-    {
-      this->dataPtr->nextUpdateTime = this->dataPtr->NextUpdateTime(
-          this->dataPtr->sensorsToUpdate, _info.simTime);
-    }
+      (this->dataPtr->preRenderEvent->ConnectionCount() > 0u ||
+      this->dataPtr->renderEvent->ConnectionCount() > 0u ||
+      this->dataPtr->postRenderEvent->ConnectionCount() > 0u);
 
     std::unordered_set<sensors::SensorId> sensorsWithPendingTriggers =
         this->dataPtr->SensorsWithPendingTrigger();
 
+    // Pop the sensors that are due this iteration. Sensors are rescheduled
+    // as they are popped, so sensors without subscribers keep cycling
+    // through the schedule cheaply and are picked up again as soon as a
+    // connection appears.
+    std::set<sensors::SensorId> dueSensors;
+    this->dataPtr->PopDueSensors(_info.simTime, dueSensors);
+
     // notify the render thread if updates are available
     if (hasRenderConnections ||
-        this->dataPtr->nextUpdateTime <= _info.simTime ||
+        !dueSensors.empty() ||
         this->dataPtr->renderUtil.PendingSensors() > 0 ||
         this->dataPtr->forceUpdate ||
         !sensorsWithPendingTriggers.empty())
@@ -761,7 +973,10 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
       if (this->dataPtr->disableOnDrainedBattery)
         this->dataPtr->UpdateBatteryState(_ecm);
 
+      if (!skipLockstepWaits)
       {
+        // Wait until the render thread has latched the previously staged
+        // frame. The render itself overlaps with the next simulation step.
         std::unique_lock<std::mutex> cvLock(this->dataPtr->renderMutex);
         this->dataPtr->renderCv.wait(cvLock, [this] {
           return !this->dataPtr->running || !this->dataPtr->updateAvailable; });
@@ -774,22 +989,24 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
 
       {
         std::unique_lock<std::mutex> lockSensors(this->dataPtr->sensorsMutex);
-        this->dataPtr->activeSensors =
-            std::move(this->dataPtr->sensorsToUpdate);
+        // Insert rather than assign: in bounded staleness mode the render
+        // thread may not have consumed the previous batch yet.
+        this->dataPtr->activeSensors.insert(dueSensors.begin(),
+                                            dueSensors.end());
         // Add all sensors that have pending triggers.
         this->dataPtr->activeSensors.insert(sensorsWithPendingTriggers.begin(),
                                             sensorsWithPendingTriggers.end());
       }
 
-      this->dataPtr->nextUpdateTime = this->dataPtr->NextUpdateTime(
-          this->dataPtr->sensorsToUpdate, _info.simTime);
-
       // Force scene tree update if there are sensors to be created or
       // subscribes to the render events. This does not necessary force
-      // sensors to update. Only active sensors will be updated
-      this->dataPtr->forceUpdate =
-          (this->dataPtr->renderUtil.PendingSensors() > 0) ||
-          hasRenderConnections;
+      // sensors to update. Only active sensors will be updated. Keep a
+      // force request that the render thread has not latched yet.
+      if ((this->dataPtr->renderUtil.PendingSensors() > 0) ||
+          hasRenderConnections)
+      {
+        this->dataPtr->forceUpdate = true;
+      }
 
       {
         std::unique_lock<std::mutex> timeLock(this->dataPtr->renderUtilMutex);
@@ -936,6 +1153,14 @@ std::string Sensors::CreateSensor(const Entity &_entity,
   renderingSensor->SetParent(_parentName);
   renderingSensor->SetManualSceneUpdate(true);
 
+  // Stage the sensor for scheduling. This runs on the rendering thread;
+  // the schedule itself is owned by the simulation thread.
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
+    this->dataPtr->pendingSchedule.emplace_back(
+        sensorId, renderingSensor->NextDataUpdateTime());
+  }
+
   // Special case for stereo cameras
   auto cameraSensor = dynamic_cast<sensors::CameraSensor *>(sensor);
   if (nullptr != cameraSensor)
@@ -1006,88 +1231,110 @@ std::string Sensors::CreateSensor(const Entity &_entity,
 }
 
 //////////////////////////////////////////////////
-std::chrono::steady_clock::duration SensorsPrivate::NextUpdateTime(
-    std::set<sensors::SensorId> &_sensorsToUpdate,
-    const std::chrono::steady_clock::duration &_currentTime)
+void SensorsPrivate::ScheduleSensor(sensors::SensorId _id,
+    const std::chrono::steady_clock::duration &_dueTime)
 {
-  _sensorsToUpdate.clear();
-  std::chrono::steady_clock::duration minNextUpdateTime =
-      std::chrono::steady_clock::duration::max();
-  for (auto id : this->sensorIds)
+  auto it = this->scheduledTime.find(_id);
+  if (it != this->scheduledTime.end())
   {
-    sensors::Sensor *s = this->sensorManager.Sensor(id);
-
-    if (nullptr == s)
-    {
-      continue;
-    }
-
-    auto rs = dynamic_cast<sensors::RenderingSensor *>(s);
-
-    if (nullptr == rs)
-    {
-      continue;
-    }
-
-    if (!rs->HasConnections())
-    {
-      continue;
-    }
-
-    if (rs->IsTriggered())
+    if (it->second == _dueTime)
+      return;
+    auto bucketIt = this->sensorSchedule.find(it->second);
+    if (bucketIt != this->sensorSchedule.end())
     {
-      continue;
-    }
-
-    std::chrono::steady_clock::duration time;
-    // if sensor's next update tims is less or equal to current sim time then
-    // it's in the process of being updated by the render loop
-    // Set their next update time  to be current time + update period
-    if (rs->NextDataUpdateTime() <= _currentTime)
-    {
-      time = rs->NextDataUpdateTime() +
-          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-          std::chrono::duration<double>(1.0 / rs->UpdateRate()));
-    }
-    else
-    {
-      time = rs->NextDataUpdateTime();
+      bucketIt->second.erase(_id);
+      if (bucketIt->second.empty())
+        this->sensorSchedule.erase(bucketIt);
     }
+  }
+  this->sensorSchedule[_dueTime].insert(_id);
+  this->scheduledTime[_id] = _dueTime;
+}
 
-    if (time <= minNextUpdateTime)
-    {
-      _sensorsToUpdate.clear();
-      minNextUpdateTime = time;
-    }
-    _sensorsToUpdate.insert(id);
+//////////////////////////////////////////////////
+void SensorsPrivate::UnscheduleSensor(sensors::SensorId _id)
+{
+  auto it = this->scheduledTime.find(_id);
+  if (it == this->scheduledTime.end())
+    return;
+  auto bucketIt = this->sensorSchedule.find(it->second);
+  if (bucketIt != this->sensorSchedule.end())
+  {
+    bucketIt->second.erase(_id);
+    if (bucketIt->second.empty())
+      this->sensorSchedule.erase(bucketIt);
   }
-  return minNextUpdateTime;
+  this->scheduledTime.erase(it);
 }
 
 //////////////////////////////////////////////////
-bool SensorsPrivate::SensorsHaveConnections()
+void SensorsPrivate::PopDueSensors(
+    const std::chrono::steady_clock::duration &_currentTime,
+    std::set<sensors::SensorId> &_dueSensors)
 {
-  for (auto id : this->sensorIds)
+  // Insert sensors created on the rendering thread since the last step.
   {
-    sensors::Sensor *s = this->sensorManager.Sensor(id);
-    if (nullptr == s)
-    {
-      continue;
-    }
+    std::unique_lock<std::mutex> lock(this->sensorsMutex);
+    for (const auto &[id, dueTime] : this->pendingSchedule)
+      this->ScheduleSensor(id, dueTime);
+    this->pendingSchedule.clear();
+  }
 
-    auto rs = dynamic_cast<sensors::RenderingSensor *>(s);
+  // Reinsertions are collected and applied after the due buckets have been
+  // drained so that a zero or very high update rate cannot loop forever.
+  std::vector<std::pair<sensors::SensorId,
+      std::chrono::steady_clock::duration>> reschedule;
 
-    if (nullptr == rs)
+  while (!this->sensorSchedule.empty() &&
+         this->sensorSchedule.begin()->first <= _currentTime)
+  {
+    auto bucket = std::move(this->sensorSchedule.begin()->second);
+    this->sensorSchedule.erase(this->sensorSchedule.begin());
+    for (const auto id : bucket)
     {
-      continue;
-    }
+      this->scheduledTime.erase(id);
 
-    if (rs->HasConnections())
-    {
-      return true;
+      sensors::Sensor *s = this->sensorManager.Sensor(id);
+      if (nullptr == s)
+      {
+        continue;
+      }
+
+      auto rs = dynamic_cast<sensors::RenderingSensor *>(s);
+      if (nullptr == rs)
+      {
+        continue;
+      }
+
+      std::chrono::steady_clock::duration dueTime;
+      // if sensor's next update time is less or equal to current sim time
+      // then it's in the process of being updated by the render loop.
+      // Set its next due time to be current time + update period. Reading
+      // the rate here is also what lets rate changes reinsert the sensor
+      // into the right bucket.
+      if (rs->NextDataUpdateTime() <= _currentTime)
+      {
+        dueTime = rs->NextDataUpdateTime() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / rs->UpdateRate()));
+      }
+      else
+      {
+        dueTime = rs->NextDataUpdateTime();
+      }
+      reschedule.emplace_back(id, dueTime);
+
+      // Triggered sensors render through the pending-trigger path, and
+      // sensors without connections stay scheduled without rendering.
+      if (rs->HasConnections() && !rs->IsTriggered())
+      {
+        _dueSensors.insert(id);
+      }
     }
   }
-  return false;
+
+  for (const auto &[id, dueTime] : reschedule)
+    this->ScheduleSensor(id, dueTime);
 }
 
 //////////////////////////////////////////////////
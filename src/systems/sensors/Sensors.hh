@@ -50,6 +50,10 @@ namespace systems
   /// - `<disable_on_drained_battery>`: Disable sensors if the model's
   /// battery plugin charge reaches zero. Sensors that are in nested
   /// models are also affected.
+  /// - `<camera_pass_count_per_gpu_flush>`: Number of camera passes to
+  /// batch per GPU flush. Defaults to 6. Worlds with many rendering
+  /// sensors updating at the same rate can raise this so the whole batch
+  /// renders in a single scene pass.
   ///
   /// \TODO(louise) Have one system for all sensors, or one per
   /// sensor / sensor type?
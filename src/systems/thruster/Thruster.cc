@@ -426,6 +426,7 @@ void Thruster::Configure(
       this->dataPtr->linkEntity);
   enableComponent<components::WorldLinearVelocity>(_ecm,
       this->dataPtr->linkEntity);
+  enableComponent<components::WorldPose>(_ecm, this->dataPtr->linkEntity);
 
   double minThrustCmd = this->dataPtr->cmdMin;
   double maxThrustCmd = this->dataPtr->cmdMax;
@@ -694,10 +695,18 @@ void Thruster::PreUpdate(
 
   gz::sim::Link link(this->dataPtr->linkEntity);
 
+  // Sample the link pose and velocities once for this step.
+  const auto kinematics =
+      linkWorldKinematics(this->dataPtr->linkEntity, _ecm);
+  if (!kinematics.has_value())
+  {
+    gzerr << "Thruster link velocity components are missing" << std::endl;
+    return;
+  }
+
   // TODO(arjo129): add logic for custom coordinate frame
   // Convert joint axis to the world frame
-  const auto linkWorldPose = worldPose(this->dataPtr->linkEntity, _ecm);
-  auto jointWorldPose = linkWorldPose * this->dataPtr->jointPose;
+  auto jointWorldPose = kinematics->pose * this->dataPtr->jointPose;
   auto unitVector =
       jointWorldPose.Rot().RotateVector(this->dataPtr->jointAxis).Normalize();
 
@@ -725,7 +734,7 @@ void Thruster::PreUpdate(
   double torque = 0.0;
   if (!this->dataPtr->velocityControl)
   {
-    auto currentAngular = (link.WorldAngularVelocity(_ecm))->Dot(unitVector);
+    auto currentAngular = kinematics->angularVelocity.Dot(unitVector);
     auto angularError = currentAngular - desiredPropellerAngVel;
     if (abs(angularError) > 0.1)
     {
@@ -760,9 +769,7 @@ void Thruster::PreUpdate(
     unitVector * torque);
 
   // Update the LinearVelocity of the vehicle
-  this->dataPtr->linearVelocity =
-      _ecm.Component<components::WorldLinearVelocity>(
-      this->dataPtr->linkEntity)->Data().Length();
+  this->dataPtr->linearVelocity = kinematics->linearVelocity.Length();
 }
 
 /////////////////////////////////////////////////
@@ -284,9 +284,13 @@ void TouchPluginPrivate::Update(const UpdateInfo &_info,
         if (col1Target || col2Target)
         {
           touching = true;
+          break;
         }
       }
     }
+    // One touching contact is all this plugin needs; skip the rest.
+    if (touching)
+      break;
   }
 
   if (!touching)
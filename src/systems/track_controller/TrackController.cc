@@ -142,6 +142,16 @@ class gz::sim::systems::TrackControllerPrivate
   /// \brief World poses of all collision elements of the track's link.
   public: std::unordered_map<Entity, math::Pose3d> collisionsWorldPose;
 
+  /// \brief Track Y axis in world coordinates, cached once per step in
+  /// PreUpdate. The contact callback fires once per contact point and this
+  /// value is identical for all contacts within a step.
+  public: math::Vector3d trackYAxisGlobal;
+
+  /// \brief Copy of centerOfRotation taken once per step under the command
+  /// mutex, so the per-contact callback doesn't have to lock it.
+  public: math::Vector3d centerOfRotationCopy
+    {math::Vector3d::Zero * math::INF_D};
+
   /// \brief Track position
   public: double position {0};
   /// \brief The last commanded velocity.
@@ -430,9 +440,17 @@ void TrackController::PreUpdate(
     this->dataPtr->collisionsWorldPose[collisionEntity] =
       worldPose(collisionEntity, _ecm);
 
+  // Cache the track frame for the contact callback; it is identical for all
+  // contact points within a step.
+  const auto trackWorldRot =
+    this->dataPtr->linkWorldPose.Rot() * this->dataPtr->trackOrientation;
+  this->dataPtr->trackYAxisGlobal =
+    trackWorldRot.RotateVector(math::Vector3d::UnitY);
+
   std::chrono::steady_clock::duration lastCommandTimeCopy;
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->cmdMutex);
+    this->dataPtr->centerOfRotationCopy = this->dataPtr->centerOfRotation;
     if (this->dataPtr->hasNewCommand)
     {
       this->dataPtr->lastCommandTime = _info.simTime;
@@ -569,34 +587,25 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
   auto contactNormal = _normal.value();
 
   // In case we have not yet cached the collision pose, skip this iteration
-  if (this->collisionsWorldPose.find(trackCollision) ==
-      this->collisionsWorldPose.end())
+  const auto collisionPoseIt = this->collisionsWorldPose.find(trackCollision);
+  if (collisionPoseIt == this->collisionsWorldPose.end())
     return;
-  const auto& collisionPose = this->collisionsWorldPose[trackCollision];
+  const auto& collisionPose = collisionPoseIt->second;
 
   // Flip the contact normal if it points outside the track collision
   if (contactNormal.Dot(collisionPose.Pos() - _point) < 0)
     contactNormal = -contactNormal;
 
-  const auto trackWorldRot = this->linkWorldPose.Rot() * this->trackOrientation;
-  const auto trackYAxisGlobal =
-    trackWorldRot.RotateVector(math::Vector3d::UnitY);
-
   // Vector tangent to the belt pointing in the belt's movement direction
   // The belt's bottom moves backwards when the robot should move forward!
-  auto beltDirection = contactNormal.Cross(trackYAxisGlobal);
+  // The track Y axis is cached once per step in PreUpdate.
+  auto beltDirection = contactNormal.Cross(this->trackYAxisGlobal);
 
   if (this->limitedVelocity < 0)
     beltDirection = -beltDirection;
 
-  math::Vector3d cor;
-  {
-    std::lock_guard<std::mutex> lock(this->cmdMutex);
-    cor = this->centerOfRotation;
-  }
-
   const auto frictionDirection = this->ComputeFrictionDirection(
-    cor, _point, contactNormal, beltDirection);
+    this->centerOfRotationCopy, _point, contactNormal, beltDirection);
 
   _params.firstFrictionalDirection =
     convert(isCollision1Track ? frictionDirection : -frictionDirection);
@@ -619,8 +628,9 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
     gzdbg << "- surface motion       " << surfaceMotion << std::endl;
     gzdbg << "- contact point        " << convert(_point) << std::endl;
     gzdbg << "- contact normal       " << contactNormal << std::endl;
-    gzdbg << "- track rot            " << trackWorldRot << std::endl;
-    gzdbg << "- track Y              " << trackYAxisGlobal << std::endl;
+    gzdbg << "- track rot            "
+           << this->linkWorldPose.Rot() * this->trackOrientation << std::endl;
+    gzdbg << "- track Y              " << this->trackYAxisGlobal << std::endl;
     gzdbg << "- belt direction       " << beltDirection << std::endl;
 
     this->debugMarker.set_id(++this->markerId);
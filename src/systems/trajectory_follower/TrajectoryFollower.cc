@@ -88,6 +88,10 @@ class gz::sim::systems::TrajectoryFollowerPrivate
   /// Units are in meters.
   public: double rangeTolerance = 0.5;
 
+  /// \brief Squared range tolerance, precomputed so the per-step range
+  /// check doesn't need a square root.
+  public: double rangeToleranceSq = 0.25;
+
   /// \brief When the model is at this angle or closer we won't try to rotate.
   /// Units are in degrees.
   public: double bearingTolerance = 2.0;
@@ -102,6 +106,15 @@ class gz::sim::systems::TrajectoryFollowerPrivate
   /// X Y, where X and Y are local (Gazebo) coordinates.
   public: std::vector<gz::math::Vector2d> localWaypoints;
 
+  /// \brief Waypoint goals precomputed as 3D world positions at load time.
+  /// The vector is never modified afterwards; advancing along the
+  /// trajectory only moves \ref waypointIndex, so reaching a waypoint is
+  /// O(1) instead of shifting or rotating the waypoint vector.
+  public: std::vector<gz::math::Vector3d> goals;
+
+  /// \brief Index of the current goal in \ref goals.
+  public: std::size_t waypointIndex = 0u;
+
   /// \brief Initialization flag.
   public: bool initialized{false};
 
@@ -249,6 +262,8 @@ void TrajectoryFollowerPrivate::Load(const EntityComponentManager &_ecm,
   if (_sdf->HasElement("range_tolerance"))
     this->rangeTolerance = _sdf->Get<double>("range_tolerance");
 
+  this->rangeToleranceSq = this->rangeTolerance * this->rangeTolerance;
+
   // Parse the optional <bearing_tolerance> element.
   if (_sdf->HasElement("bearing_tolerance"))
     this->bearingTolerance = _sdf->Get<double>("bearing_tolerance");
@@ -272,11 +287,17 @@ void TrajectoryFollowerPrivate::Load(const EntityComponentManager &_ecm,
       << this->model.Name(_ecm) << "] subscribed "
       << "to pause messages on topic[" << this->topic << "]\n";
 
+  // Precompute the goal table once so the per-step work never re-derives
+  // waypoint geometry.
+  this->goals.reserve(this->localWaypoints.size());
+  for (const auto &waypoint : this->localWaypoints)
+    this->goals.push_back({waypoint.X(), waypoint.Y(), 0});
+
   // If we have waypoints to visit, read the first one.
-  if (!this->localWaypoints.empty())
+  if (!this->goals.empty())
   {
-    this->nextGoal =
-      {this->localWaypoints.front().X(), this->localWaypoints.front().Y(), 0};
+    this->waypointIndex = 0u;
+    this->nextGoal = this->goals.front();
   }
 }
 
@@ -326,7 +347,7 @@ void TrajectoryFollower::PreUpdate(
   }
 
   // Nothing to do.
-  if (this->dataPtr->localWaypoints.empty())
+  if (this->dataPtr->goals.empty())
     return;
 
   this->dataPtr->modelPose = gz::sim::worldPose(
@@ -341,36 +362,32 @@ void TrajectoryFollower::PreUpdate(
   gz::math::Vector3d directionLocalFrame =
     this->dataPtr->modelPose.Rot().RotateVectorReverse(direction);
 
-  double range = directionLocalFrame.Length();
+  double rangeSq = directionLocalFrame.SquaredLength();
   gz::math::Angle bearing(
     atan2(directionLocalFrame.Y(), directionLocalFrame.X()));
   bearing.Normalize();
 
   // Waypoint reached!
-  if (range <= this->dataPtr->rangeTolerance)
+  if (rangeSq <= this->dataPtr->rangeToleranceSq)
   {
-    // We always keep the last waypoint in the vector to keep the model
-    // "alive" in case it moves away from its goal.
-    if (this->dataPtr->localWaypoints.size() == 1)
-      return;
-
     if (this->dataPtr->loopForever)
     {
-      // Rotate to the left.
-      std::rotate(this->dataPtr->localWaypoints.begin(),
-                  this->dataPtr->localWaypoints.begin() + 1,
-                  this->dataPtr->localWaypoints.end());
+      this->dataPtr->waypointIndex =
+        (this->dataPtr->waypointIndex + 1) % this->dataPtr->goals.size();
+    }
+    // We always keep the last waypoint as the goal to keep the model
+    // "alive" in case it moves away from it.
+    else if (this->dataPtr->waypointIndex + 1 < this->dataPtr->goals.size())
+    {
+      ++this->dataPtr->waypointIndex;
     }
     else
     {
-      // Remove the first waypoint.
-      this->dataPtr->localWaypoints.erase(
-        this->dataPtr->localWaypoints.begin());
+      return;
     }
 
-    this->dataPtr->nextGoal = {
-      this->dataPtr->localWaypoints.front().X(),
-      this->dataPtr->localWaypoints.front().Y(), 0};
+    this->dataPtr->nextGoal =
+      this->dataPtr->goals[this->dataPtr->waypointIndex];
 
     return;
   }
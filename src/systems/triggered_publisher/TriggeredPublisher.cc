@@ -30,7 +30,11 @@
 #pragma warning(pop)
 #endif
 
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <set>
+#include <string>
 #include <utility>
 
 #include <gz/common/Profiler.hh>
@@ -97,6 +101,11 @@ class systems::InputMatcher
   /// \brief State of the matcher
   protected: bool valid{false};
 
+  /// \brief Tolerance used for float comparisons, mirroring the value set
+  /// on the comparator so fast paths that bypass the comparator can apply
+  /// the same tolerance
+  protected: double tolerance{1e-8};
+
   /// \brief Field comparator used by MessageDifferencer. This is where
   /// tolerance for float comparisons is set
   protected: google::protobuf::util::DefaultFieldComparator comparator;
@@ -142,6 +151,18 @@ class FullMatcher : public InputMatcher
 
   /// \brief Logic type of this matcher
   protected: const bool logicType;
+
+  /// \brief Whether byte equality of serialized messages can confirm a
+  /// match. Only set for message types without float or map fields, where
+  /// equal values serialize to equal bytes.
+  protected: bool byteMatchCandidate{false};
+
+  /// \brief Serialized match message, compared against serialized inputs
+  /// when byteMatchCandidate is set
+  protected: std::string matchBytes;
+
+  /// \brief Reused buffer for serializing input messages
+  protected: mutable std::string inputBytes;
 };
 
 //////////////////////////////////////////////////
@@ -190,8 +211,63 @@ class FieldMatcher : public InputMatcher
   /// \brief Field descriptor of the field compared by this matcher
   protected: std::vector<const google::protobuf::FieldDescriptor *>
                  fieldDescMatcher;
+
+  /// \brief Comparison compiled from the match criteria at construction.
+  /// Singular scalar leaf fields compile into a typed comparison executed
+  /// without the MessageDifferencer; kNone means the leaf is repeated or a
+  /// message and matching falls back to the differencer.
+  protected: enum class CompiledOp
+  {
+    kNone, kBool, kInt, kUInt, kDouble, kEnum, kString
+  } compiledOp{CompiledOp::kNone};
+
+  /// \brief Compiled match values, one per compilable leaf type. Only the
+  /// member selected by compiledOp is meaningful.
+  protected: bool boolValue{false};
+  protected: int64_t intValue{0};
+  protected: uint64_t uintValue{0u};
+  protected: double doubleValue{0.0};
+  protected: int enumNumber{0};
+  protected: std::string stringValue;
 };
 
+//////////////////////////////////////////////////
+/// \brief Check whether messages of the given type serialize equal values
+/// to equal bytes. Float and double fields can hold distinct bit patterns
+/// that compare as approximately equal, and map fields have no canonical
+/// entry order, so types containing either are excluded.
+/// \param[in] _desc Message descriptor to scan
+/// \param[in, out] _visited Descriptors already scanned, used to guard
+/// against recursive message types
+/// \return True if byte equality of serialized messages implies a match
+static bool byteComparableMessage(const google::protobuf::Descriptor *_desc,
+    std::set<const google::protobuf::Descriptor *> &_visited)
+{
+  if (nullptr == _desc || !_visited.insert(_desc).second)
+    return true;
+
+  for (int i = 0; i < _desc->field_count(); ++i)
+  {
+    const auto *fieldDesc = _desc->field(i);
+    if (fieldDesc->is_map())
+      return false;
+
+    switch (fieldDesc->cpp_type())
+    {
+      case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+      case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+        return false;
+      case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
+        if (!byteComparableMessage(fieldDesc->message_type(), _visited))
+          return false;
+        break;
+      default:
+        break;
+    }
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 InputMatcher::InputMatcher(const std::string &_msgType)
     : matchMsg(msgs::Factory::New(_msgType))
@@ -214,6 +290,7 @@ bool InputMatcher::Match(const transport::ProtoMsg &_input) const
 
 void InputMatcher::SetTolerance(double _tol)
 {
+  this->tolerance = _tol;
   this->comparator.SetDefaultFractionAndMargin(
       std::numeric_limits<double>::min(), _tol);
 }
@@ -256,11 +333,29 @@ FullMatcher::FullMatcher(const std::string &_msgType, bool _logicType,
 
   this->valid = google::protobuf::TextFormat::ParseFromString(
       _matchString, this->matchMsg.get());
+
+  if (this->valid)
+  {
+    std::set<const google::protobuf::Descriptor *> visited;
+    this->byteMatchCandidate =
+        byteComparableMessage(this->matchMsg->GetDescriptor(), visited) &&
+        this->matchMsg->SerializeToString(&this->matchBytes);
+  }
 }
 
 //////////////////////////////////////////////////
 bool FullMatcher::DoMatch(const transport::ProtoMsg &_input) const
 {
+  // Byte equality of the serialized messages confirms a match without
+  // running the differencer. Inequality is inconclusive because the wire
+  // encoding is not canonical, so it falls through to the full comparison.
+  if (this->byteMatchCandidate &&
+      _input.SerializeToString(&this->inputBytes) &&
+      this->inputBytes == this->matchBytes)
+  {
+    return this->logicType;
+  }
+
   return this->logicType == this->diff.Compare(*this->matchMsg, _input);
 }
 
@@ -307,6 +402,55 @@ FieldMatcher::FieldMatcher(const std::string &_msgType, bool _logicType,
   }
 
   this->valid = true;
+
+  // Compile the comparison for singular scalar leaves so the hot path
+  // avoids the MessageDifferencer.
+  const auto *leafDesc = this->fieldDescMatcher.back();
+  if (!leafDesc->is_repeated())
+  {
+    const auto *refl = matcherSubMsg->GetReflection();
+    switch (leafDesc->cpp_type())
+    {
+      case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        this->compiledOp = CompiledOp::kBool;
+        this->boolValue = refl->GetBool(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        this->compiledOp = CompiledOp::kInt;
+        this->intValue = refl->GetInt32(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        this->compiledOp = CompiledOp::kInt;
+        this->intValue = refl->GetInt64(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        this->compiledOp = CompiledOp::kUInt;
+        this->uintValue = refl->GetUInt32(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        this->compiledOp = CompiledOp::kUInt;
+        this->uintValue = refl->GetUInt64(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+        this->compiledOp = CompiledOp::kDouble;
+        this->doubleValue = refl->GetFloat(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+        this->compiledOp = CompiledOp::kDouble;
+        this->doubleValue = refl->GetDouble(*matcherSubMsg, leafDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+        this->compiledOp = CompiledOp::kEnum;
+        this->enumNumber = refl->GetEnum(*matcherSubMsg, leafDesc)->number();
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        this->compiledOp = CompiledOp::kString;
+        this->stringValue = refl->GetString(*matcherSubMsg, leafDesc);
+        break;
+      default:
+        break;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -389,6 +533,68 @@ bool FieldMatcher::FindFieldSubMessage(
 bool FieldMatcher::DoMatch(
     const transport::ProtoMsg &_input) const
 {
+  if (CompiledOp::kNone != this->compiledOp)
+  {
+    const transport::ProtoMsg *subMsgInput = &_input;
+    for (std::size_t i = 0; i < this->fieldDescMatcher.size() - 1; ++i)
+    {
+      subMsgInput = &subMsgInput->GetReflection()->GetMessage(
+          *subMsgInput, this->fieldDescMatcher[i]);
+    }
+
+    const auto *leafDesc = this->fieldDescMatcher.back();
+    const auto *refl = subMsgInput->GetReflection();
+    bool equal{false};
+    switch (this->compiledOp)
+    {
+      case CompiledOp::kBool:
+        equal = this->boolValue == refl->GetBool(*subMsgInput, leafDesc);
+        break;
+      case CompiledOp::kInt:
+      {
+        const int64_t value =
+            google::protobuf::FieldDescriptor::CPPTYPE_INT32 ==
+                leafDesc->cpp_type() ?
+            refl->GetInt32(*subMsgInput, leafDesc) :
+            refl->GetInt64(*subMsgInput, leafDesc);
+        equal = this->intValue == value;
+        break;
+      }
+      case CompiledOp::kUInt:
+      {
+        const uint64_t value =
+            google::protobuf::FieldDescriptor::CPPTYPE_UINT32 ==
+                leafDesc->cpp_type() ?
+            refl->GetUInt32(*subMsgInput, leafDesc) :
+            refl->GetUInt64(*subMsgInput, leafDesc);
+        equal = this->uintValue == value;
+        break;
+      }
+      case CompiledOp::kDouble:
+      {
+        const double value =
+            google::protobuf::FieldDescriptor::CPPTYPE_FLOAT ==
+                leafDesc->cpp_type() ?
+            refl->GetFloat(*subMsgInput, leafDesc) :
+            refl->GetDouble(*subMsgInput, leafDesc);
+        equal = this->doubleValue == value ||
+                std::abs(this->doubleValue - value) <= this->tolerance;
+        break;
+      }
+      case CompiledOp::kEnum:
+        equal = this->enumNumber ==
+                refl->GetEnum(*subMsgInput, leafDesc)->number();
+        break;
+      case CompiledOp::kString:
+        equal =
+            this->stringValue == refl->GetString(*subMsgInput, leafDesc);
+        break;
+      default:
+        break;
+    }
+    return this->logicType == equal;
+  }
+
   google::protobuf::util::DefaultFieldComparator comp;
 
   auto *matcherRefl = this->matchMsg->GetReflection();
@@ -43,8 +43,12 @@
 #include <gz/msgs/visual.pb.h>
 #include <gz/msgs/wheel_slip_parameters_cmd.pb.h>
 
+#include <chrono>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <utility>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -143,6 +147,19 @@ class UserCommandBase
   /// \return True if command was properly executed.
   public: virtual bool Execute() = 0;
 
+  /// \brief Get whether this command may execute inside an entity batch
+  /// shared with adjacent commands, so view membership is updated once for
+  /// a whole burst. Commands that query entity views for entities a
+  /// neighboring command may have just created must return false, since
+  /// views don't see entities staged in an open batch.
+  /// \return True if the command may share an entity batch.
+  public: virtual bool Batchable() const;
+
+  /// \brief Sequence number assigned when the command was accepted by a
+  /// service. Receipts published on the command result topic carry this
+  /// number so callers can match completions to accepted commands.
+  public: uint64_t seq{0u};
+
   /// \brief Message containing command.
   protected: google::protobuf::Message *msg{nullptr};
 
@@ -161,6 +178,9 @@ class CreateCommand : public UserCommandBase
 
   // Documentation inherited
   public: bool Execute() final;
+
+  // Documentation inherited
+  public: bool Batchable() const final;
 };
 
 /// \brief Command to remove an entity from simulation.
@@ -541,6 +561,11 @@ class gz::sim::systems::UserCommandsPrivate
   /// \brief Queue of commands pending execution.
   public: std::vector<std::unique_ptr<UserCommandBase>> pendingCmds;
 
+  /// \brief Maximum time PreUpdate may spend executing commands per step.
+  /// Commands that don't fit carry over to the next step. Zero (the
+  /// default) executes everything queued in a single step.
+  public: std::chrono::steady_clock::duration commandBudget{0};
+
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
@@ -549,6 +574,17 @@ class gz::sim::systems::UserCommandsPrivate
 
   /// \brief Mutex to protect pending queue.
   public: std::mutex pendingMutex;
+
+  /// \brief Next command sequence number, assigned in the order services
+  /// accept commands. Protected by pendingMutex.
+  public: uint64_t nextSeq{1u};
+
+  /// \brief Publisher for command completion receipts. Services return
+  /// immediately once a command is queued; when the command later executes
+  /// in PreUpdate, a receipt with the command's sequence number and result
+  /// is published here, so callers can pipeline commands and track
+  /// completion without step-coupled round trips.
+  public: transport::Node::Publisher resultPub;
 };
 
 /// \brief Pose3d equality comparison function.
@@ -566,10 +602,14 @@ bool pose3Eql(const math::Pose3d &_a, const math::Pose3d &_b)
 /// \brief Update pose for a specific pose message
 /// \param[in] _req Message containing new pose
 /// \param[in] _iface Pointer to user commands interface.
+/// \param[in] _namedEntities Optional name-to-entity map of the world's
+/// children, resolved once for a whole pose batch. When null, names are
+/// resolved through a per-call entity query.
 /// \return True if successful.
 bool updatePose(
   const msgs::Pose &_req,
-  std::shared_ptr<UserCommandsInterface> _iface);
+  std::shared_ptr<UserCommandsInterface> _iface,
+  const std::unordered_map<std::string, Entity> *_namedEntities = nullptr);
 
 //////////////////////////////////////////////////
 UserCommands::UserCommands() : System(),
@@ -638,6 +678,25 @@ void UserCommands::Configure(const Entity &_entity,
   this->dataPtr->iface->creator =
       std::make_unique<SdfEntityCreator>(_ecm, _eventManager);
 
+  // Maximum time to spend executing commands per step, in seconds.
+  // Commands that don't fit carry over to the next step. Zero, the
+  // default, executes everything queued in a single step.
+  if (_sdf->HasElement("update_budget"))
+  {
+    const double budget = _sdf->Get<double>("update_budget", 0.0).first;
+    if (budget < 0.0)
+    {
+      gzwarn << "Ignoring negative <update_budget> [" << budget << "]."
+             << std::endl;
+    }
+    else
+    {
+      this->dataPtr->commandBudget =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(budget));
+    }
+  }
+
   const components::Name *constCmp = _ecm.Component<components::Name>(_entity);
   const std::string &worldName = constCmp->Data();
 
@@ -760,6 +819,15 @@ void UserCommands::Configure(const Entity &_entity,
       &UserCommandsPrivate::WheelSlipService, this->dataPtr.get());
 
   gzmsg << "Material service on [" << wheelSlipService << "]" << std::endl;
+
+  // Command completion receipts. Each executed command publishes a Boolean
+  // with its result and a "seq" header entry holding the sequence number
+  // assigned when the command was accepted, in acceptance order.
+  std::string resultTopic{"/world/" + validWorldName + "/command/result"};
+  this->dataPtr->resultPub =
+      this->dataPtr->node.Advertise<msgs::Boolean>(resultTopic);
+
+  gzmsg << "Command results on [" << resultTopic << "]" << std::endl;
 }
 
 //////////////////////////////////////////////////
@@ -780,16 +848,72 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
 
   // TODO(louise) Record current world state for undo
 
-  // Execute pending commands
-  for (auto &cmd : cmds)
+  const auto startTime = std::chrono::steady_clock::now();
+  const bool hasBudget =
+      this->dataPtr->commandBudget > std::chrono::steady_clock::duration::zero();
+
+  // Execute pending commands. Adjacent batchable commands, e.g. bursts of
+  // spawns, share one entity batch so view membership is updated once for
+  // the whole run instead of once per command.
+  auto *ecm = this->dataPtr->iface->ecm;
+  bool batchOpen = false;
+  std::size_t executed = 0;
+  for (; executed < cmds.size(); ++executed)
   {
+    auto &cmd = cmds[executed];
+    if (cmd->Batchable() && !batchOpen)
+    {
+      ecm->BeginEntityBatch();
+      batchOpen = true;
+    }
+    else if (!cmd->Batchable() && batchOpen)
+    {
+      ecm->CommitEntityBatch();
+      batchOpen = false;
+    }
+
     // Execute
-    if (!cmd->Execute())
-      continue;
+    const bool success = cmd->Execute();
+    if (success)
+    {
+      // TODO(louise) Update command with current world state
+
+      // TODO(louise) Move to undo list
+    }
+
+    // Publish the completion receipt. Skipped when nobody subscribes, so
+    // callers that don't track completion pay nothing.
+    if (this->dataPtr->resultPub.HasConnections())
+    {
+      msgs::Boolean receipt;
+      receipt.set_data(success);
+      auto *seqData = receipt.mutable_header()->add_data();
+      seqData->set_key("seq");
+      seqData->add_value(std::to_string(cmd->seq));
+      this->dataPtr->resultPub.Publish(receipt);
+    }
 
-    // TODO(louise) Update command with current world state
+    // Out of budget: stop here and carry the rest over to the next step
+    if (hasBudget && executed + 1 < cmds.size() &&
+        std::chrono::steady_clock::now() - startTime >
+        this->dataPtr->commandBudget)
+    {
+      ++executed;
+      break;
+    }
+  }
+  if (batchOpen)
+    ecm->CommitEntityBatch();
 
-    // TODO(louise) Move to undo list
+  if (executed < cmds.size())
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->pendingMutex);
+    this->dataPtr->pendingCmds.insert(this->dataPtr->pendingCmds.begin(),
+        std::make_move_iterator(cmds.begin() + executed),
+        std::make_move_iterator(cmds.end()));
+    gzdbg << "User command budget exhausted, carrying "
+          << cmds.size() - executed << " command(s) over to the next step."
+          << std::endl;
   }
 
   // TODO(louise) Clear redo list
@@ -807,6 +931,7 @@ bool UserCommandsPrivate::CreateServiceMultiple(
     auto msgCopy = msg.New();
     msgCopy->CopyFrom(msg);
     auto cmd = std::make_unique<CreateCommand>(msgCopy, this->iface);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -826,6 +951,7 @@ bool UserCommandsPrivate::CreateService(const msgs::EntityFactory &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -845,6 +971,7 @@ bool UserCommandsPrivate::RemoveService(const msgs::Entity &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -864,6 +991,7 @@ bool UserCommandsPrivate::LightService(const msgs::Light &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -881,6 +1009,7 @@ void UserCommandsPrivate::OnCmdLight(const msgs::Light &_msg)
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 }
@@ -897,6 +1026,7 @@ bool UserCommandsPrivate::PoseService(const msgs::Pose &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -916,6 +1046,7 @@ bool UserCommandsPrivate::PoseVectorService(const msgs::Pose_V &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -935,6 +1066,7 @@ bool UserCommandsPrivate::EnableCollisionService(const msgs::Entity &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -954,6 +1086,7 @@ bool UserCommandsPrivate::DisableCollisionService(const msgs::Entity &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -972,6 +1105,7 @@ bool UserCommandsPrivate::PhysicsService(const msgs::Physics &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -990,6 +1124,7 @@ bool UserCommandsPrivate::VisualService(const msgs::Visual &_req,
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -1006,6 +1141,7 @@ void UserCommandsPrivate::OnCmdMaterialColor(const msgs::MaterialColor &_msg)
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -1024,6 +1160,7 @@ bool UserCommandsPrivate::WheelSlipService(
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -1042,6 +1179,7 @@ bool UserCommandsPrivate::SphericalCoordinatesService(
   // Push to pending
   {
     std::lock_guard<std::mutex> lock(this->pendingMutex);
+    cmd->seq = this->nextSeq++;
     this->pendingCmds.push_back(std::move(cmd));
   }
 
@@ -1064,6 +1202,12 @@ UserCommandBase::~UserCommandBase()
   this->msg = nullptr;
 }
 
+//////////////////////////////////////////////////
+bool UserCommandBase::Batchable() const
+{
+  return false;
+}
+
 //////////////////////////////////////////////////
 CreateCommand::CreateCommand(msgs::EntityFactory *_msg,
     std::shared_ptr<UserCommandsInterface> &_iface)
@@ -1071,6 +1215,17 @@ CreateCommand::CreateCommand(msgs::EntityFactory *_msg,
 {
 }
 
+//////////////////////////////////////////////////
+bool CreateCommand::Batchable() const
+{
+  auto createMsg = dynamic_cast<const msgs::EntityFactory *>(this->msg);
+  // Clones resolve the source entity and its name through entity views,
+  // which don't see entities staged in an open batch, so they execute
+  // unbatched.
+  return nullptr != createMsg &&
+      createMsg->from_case() != msgs::EntityFactory::kCloneName;
+}
+
 //////////////////////////////////////////////////
 bool CreateCommand::Execute()
 {
@@ -1219,10 +1374,11 @@ bool CreateCommand::Execute()
     desiredName = root.Actor()->Name();
   }
 
-  // Check if there's already a top-level entity with the given name
-  if (kNullEntity != this->iface->ecm->EntityByComponents(
-      components::Name(desiredName),
-      components::ParentEntity(this->iface->worldEntity)))
+  // Check if there's already a top-level entity with the given name. The
+  // scoped name index sees entities staged in an open entity batch, which
+  // entity views don't, so spawns batched together still get unique names.
+  if (!this->iface->ecm->EntitiesByScopedName(desiredName, "::",
+      this->iface->worldEntity).empty())
   {
     if (!createMsg->allow_renaming())
     {
@@ -1235,9 +1391,8 @@ bool CreateCommand::Execute()
     // Generate unique name
     std::string newName = desiredName;
     int i = 0;
-    while (kNullEntity != this->iface->ecm->EntityByComponents(
-      components::Name(newName),
-      components::ParentEntity(this->iface->worldEntity)))
+    while (!this->iface->ecm->EntitiesByScopedName(newName, "::",
+        this->iface->worldEntity).empty())
     {
       newName = desiredName + "_" + std::to_string(i++);
     }
@@ -1536,7 +1691,8 @@ bool LightCommand::Execute()
 //////////////////////////////////////////////////
 bool updatePose(
   const msgs::Pose &_poseMsg,
-  std::shared_ptr<UserCommandsInterface> _iface)
+  std::shared_ptr<UserCommandsInterface> _iface,
+  const std::unordered_map<std::string, Entity> *_namedEntities)
 {
   // Check the name of the entity being spawned
   std::string entityName = _poseMsg.name();
@@ -1548,8 +1704,17 @@ bool updatePose(
   }
   else if (!entityName.empty())
   {
-    entity = _iface->ecm->EntityByComponents(components::Name(entityName),
-      components::ParentEntity(_iface->worldEntity));
+    if (nullptr != _namedEntities)
+    {
+      auto nameIt = _namedEntities->find(entityName);
+      if (nameIt != _namedEntities->end())
+        entity = nameIt->second;
+    }
+    else
+    {
+      entity = _iface->ecm->EntityByComponents(components::Name(entityName),
+        components::ParentEntity(_iface->worldEntity));
+    }
   }
 
   if (!_iface->ecm->HasEntity(entity))
@@ -1615,9 +1780,36 @@ bool PoseVectorCommand::Execute()
     return false;
   }
 
+  // Resolve entity names once for the whole batch. Resolving each pose
+  // through a per-call entity query rescans the world per pose, which is
+  // quadratic over a large teleport batch.
+  std::unordered_map<std::string, Entity> namedEntities;
+  bool needsNames = false;
+  for (int i = 0; i < poseVectorMsg->pose_size(); ++i)
+  {
+    const auto &poseMsg = poseVectorMsg->pose(i);
+    if ((poseMsg.id() == kNullEntity || poseMsg.id() == 0) &&
+        !poseMsg.name().empty())
+    {
+      needsNames = true;
+      break;
+    }
+  }
+  if (needsNames)
+  {
+    this->iface->ecm->Each<components::Name, components::ParentEntity>(
+        [&](const Entity &_entity, const components::Name *_name,
+            const components::ParentEntity *_parent) -> bool
+        {
+          if (_parent->Data() == this->iface->worldEntity)
+            namedEntities.emplace(_name->Data(), _entity);
+          return true;
+        });
+  }
+
   for (int i = 0; i < poseVectorMsg->pose_size(); i++)
   {
-    if (!updatePose(poseVectorMsg->pose(i), this->iface))
+    if (!updatePose(poseVectorMsg->pose(i), this->iface, &namedEntities))
     {
       return false;
     }
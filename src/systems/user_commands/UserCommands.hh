@@ -69,6 +69,14 @@ namespace systems
   /// * **Request type**: gz.msgs.Pose_V
   /// * **Response type**: gz.msgs.Boolean
   ///
+  /// ## System Parameters
+  ///
+  /// - `<update_budget>`: Maximum time in seconds to spend executing
+  ///   queued commands per simulation step. Commands that don't fit the
+  ///   budget carry over to the next step, so large bursts of commands
+  ///   don't stall a single step. Defaults to 0, which executes everything
+  ///   queued in the step it is drained.
+  ///
   /// Try some examples described in examples/worlds/empty.sdf
   class UserCommands final:
     public System,
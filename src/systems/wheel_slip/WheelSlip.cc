@@ -305,19 +305,20 @@ void WheelSlipPrivate::Update(EntityComponentManager &_ecm)
     double slip1 = speed / force * params.slipComplianceLateral;
     double slip2 = speed / force * params.slipComplianceLongitudinal;
 
-    components::SlipComplianceCmd newSlipCmdComp({slip1, slip2});
-
     auto currSlipCmdComp =
         _ecm.Component<components::SlipComplianceCmd>(params.collision);
     if (currSlipCmdComp)
     {
-      *currSlipCmdComp = newSlipCmdComp;
+      // Overwrite the existing command in place to avoid constructing a
+      // temporary component (and its vector) every step.
+      currSlipCmdComp->Data().assign({slip1, slip2});
       _ecm.SetChanged(params.collision, components::SlipComplianceCmd::typeId,
                       ComponentState::PeriodicChange);
     }
     else
     {
-      _ecm.CreateComponent(params.collision, newSlipCmdComp);
+      _ecm.CreateComponent(params.collision,
+          components::SlipComplianceCmd({slip1, slip2}));
     }
   }
 }
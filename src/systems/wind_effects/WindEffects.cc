@@ -30,6 +30,8 @@
 
 #include <gz/msgs/wind.pb.h>
 
+#include <cmath>
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <vector>
@@ -52,6 +54,7 @@
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/SdfEntityCreator.hh"
 
+#include "gz/sim/components/ExternalWorldWrenchCmd.hh"
 #include "gz/sim/components/Inertial.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/LinearVelocity.hh"
@@ -299,6 +302,39 @@ class gz::sim::systems::WindEffectsPrivate
   /// \brief The scaling factor to approximate wind as force on a mass.
   public: PiecewiseScalingFactor forceApproximationScalingFactor;
 
+  /// \brief Scaling factor value when the field is spatially uniform, set
+  /// at load time. When set, the batched force path skips the per-link
+  /// field evaluation entirely.
+  public: std::optional<double> uniformScalingFactor;
+
+  /// \brief A wind-affected link gathered for the batched force pass.
+  public: struct WindForceTarget
+  {
+    /// \brief Link entity.
+    public: Entity entity;
+
+    /// \brief Link mass.
+    public: double mass;
+
+    /// \brief Wind velocity relative to the link, in the world frame.
+    public: math::Vector3d relativeVel;
+
+    /// \brief Offset from the link origin to its center of mass, in world
+    /// coordinates.
+    public: math::Vector3d comOffsetWorld;
+  };
+
+  /// \brief Gathered wind-affected links, reused across steps to avoid
+  /// per-step allocation.
+  public: std::vector<WindForceTarget> windTargets;
+
+  /// \brief Link positions gathered for field evaluation, contiguous so the
+  /// field is evaluated over the whole batch in one pass.
+  public: std::vector<math::Vector3d> windTargetPositions;
+
+  /// \brief Per-link scaling factors evaluated over windTargetPositions.
+  public: std::vector<double> windTargetFactors;
+
   /// \brief Noise added to magnitude.
   public: sensors::NoisePtr noiseMagnitude;
 
@@ -449,11 +485,18 @@ void WindEffectsPrivate::Load(EntityComponentManager &_ecm,
         _sdf->GetElementImpl("force_approximation_scaling_factor");
     this->forceApproximationScalingFactor =
         LoadPiecewiseScalingFactor(sdfForceApprox);
+    // A plain scalar has no spatial dependence, so the per-link field
+    // evaluation can be skipped.
+    if (!sdfForceApprox->GetFirstElement())
+    {
+      this->uniformScalingFactor = sdfForceApprox->Get<double>();
+    }
   }
   else
   {
     this->forceApproximationScalingFactor =
         PiecewiseScalingFactor::Throughout(MakeConstantScalingFactor(1.));
+    this->uniformScalingFactor = 1.;
   }
 
   // It doesn't make sense to be negative, that would be negative wind drag.
@@ -592,7 +635,13 @@ void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &,
   if (!windVel)
     return;
 
-  Link link;
+  // Gather all wind-affected links into contiguous arrays, evaluate the
+  // scaling field over the whole batch, then scatter the forces back. This
+  // keeps the field evaluation and wrench writes out of the gather loop and
+  // avoids re-resolving per-link poses and inertials through the Link
+  // helpers.
+  this->windTargets.clear();
+  this->windTargetPositions.clear();
 
   _ecm.Each<components::Link,
             components::Inertial,
@@ -612,24 +661,66 @@ void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &,
           return true;
         }
 
-        link.ResetEntity(_entity);
-
-        double forceScalingFactor =
-            this->forceApproximationScalingFactor(_linkPose->Data().Pos());
-        if (std::isnan(forceScalingFactor))
+        const math::Pose3d &pose = _linkPose->Data();
+        this->windTargets.push_back({
+            _entity,
+            _inertial->Data().MassMatrix().Mass(),
+            windVel->Data() - _linkVel->Data(),
+            pose.Rot().RotateVector(_inertial->Data().Pose().Pos())});
+        if (!this->uniformScalingFactor)
         {
-          forceScalingFactor = 0.;
+          this->windTargetPositions.push_back(pose.Pos());
         }
 
-        const math::Vector3d windForce =
-            _inertial->Data().MassMatrix().Mass() *
-            forceScalingFactor * (windVel->Data() - _linkVel->Data());
-
-        // Apply force at center of mass
-        link.AddWorldForce(_ecm, windForce);
-
         return true;
       });
+
+  // Evaluate the scaling field over the gathered positions. Spatially
+  // uniform factors skip this pass entirely.
+  if (!this->uniformScalingFactor)
+  {
+    this->windTargetFactors.clear();
+    this->windTargetFactors.reserve(this->windTargetPositions.size());
+    for (const math::Vector3d &position : this->windTargetPositions)
+    {
+      double factor = this->forceApproximationScalingFactor(position);
+      if (std::isnan(factor))
+      {
+        factor = 0.;
+      }
+      this->windTargetFactors.push_back(factor);
+    }
+  }
+
+  // Scatter the forces back in one pass. The force acts at the center of
+  // mass while ExternalWorldWrenchCmd applies it at the link origin, so the
+  // gathered center of mass offset yields the equivalent torque.
+  for (std::size_t i = 0; i < this->windTargets.size(); ++i)
+  {
+    const WindForceTarget &target = this->windTargets[i];
+    const double factor = this->uniformScalingFactor.has_value() ?
+        this->uniformScalingFactor.value() : this->windTargetFactors[i];
+    const math::Vector3d force = target.mass * factor * target.relativeVel;
+    const math::Vector3d torque = target.comOffsetWorld.Cross(force);
+
+    auto linkWrenchComp =
+        _ecm.Component<components::ExternalWorldWrenchCmd>(target.entity);
+    if (!linkWrenchComp)
+    {
+      components::ExternalWorldWrenchCmd wrench;
+      msgs::Set(wrench.Data().mutable_force(), force);
+      msgs::Set(wrench.Data().mutable_torque(), torque);
+      _ecm.CreateComponent(target.entity, wrench);
+    }
+    else
+    {
+      msgs::Set(linkWrenchComp->Data().mutable_force(),
+        msgs::Convert(linkWrenchComp->Data().force()) + force);
+
+      msgs::Set(linkWrenchComp->Data().mutable_torque(),
+        msgs::Convert(linkWrenchComp->Data().torque()) + torque);
+    }
+  }
 }
 
 
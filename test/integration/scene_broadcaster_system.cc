@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <gz/msgs/boolean.pb.h>
+#include <gz/msgs/bytes.pb.h>
 #include <gz/msgs/empty.pb.h>
 #include <gz/msgs/entity_factory.pb.h>
 #include <gz/msgs/particle_emitter.pb.h>
@@ -39,7 +40,11 @@
 #pragma warning(pop)
 #endif
 
+#include <cmath>
+#include <cstring>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -114,6 +119,187 @@ TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(PoseInfo))
   EXPECT_TRUE(received);
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DeltaPoseInfo))
+{
+  // Start server
+  sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+
+  sim::Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // Create delta pose subscriber
+  transport::Node node;
+
+  std::mutex msgMutex;
+  std::vector<msgs::Pose_V> msgs;
+  std::function<void(const msgs::Pose_V &)> cb = [&](const msgs::Pose_V &_msg)
+  {
+    std::lock_guard<std::mutex> lock(msgMutex);
+    msgs.push_back(_msg);
+  };
+  EXPECT_TRUE(node.Subscribe("/world/default/pose/delta", cb));
+
+  // Run server
+  server.Run(true, 10, false);
+
+  unsigned int sleep{0u};
+  unsigned int maxSleep{30u};
+  bool received{false};
+  while (!received && sleep++ < maxSleep)
+  {
+    GZ_SLEEP_MS(100);
+    std::lock_guard<std::mutex> lock(msgMutex);
+    received = !msgs.empty();
+  }
+  ASSERT_TRUE(received);
+
+  std::lock_guard<std::mutex> lock(msgMutex);
+
+  // The stream starts with a keyframe carrying every pose, stamped with
+  // version metadata
+  auto headerValue = [](const msgs::Pose_V &_msg, const std::string &_key)
+      -> std::string
+  {
+    for (auto d = 0; d < _msg.header().data_size(); ++d)
+    {
+      if (_msg.header().data(d).key() == _key &&
+          _msg.header().data(d).value_size() > 0)
+        return _msg.header().data(d).value(0);
+    }
+    return "";
+  };
+
+  EXPECT_EQ("1", headerValue(msgs.front(), "keyframe"));
+  EXPECT_EQ(17, msgs.front().pose_size());
+
+  // Versions increase monotonically
+  uint64_t lastVersion{0u};
+  for (const auto &msg : msgs)
+  {
+    uint64_t version = std::stoull(headerValue(msg, "version"));
+    EXPECT_LT(lastVersion, version);
+    lastVersion = version;
+  }
+
+  // Deltas in a world at rest carry no poses
+  for (std::size_t i = 1; i < msgs.size(); ++i)
+  {
+    if ("0" == headerValue(msgs[i], "keyframe"))
+      EXPECT_EQ(0, msgs[i].pose_size());
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CompactPoseInfo))
+{
+  // Start server with the compact pose stream enabled
+  sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/compact_pose.sdf");
+
+  sim::Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // Create compact pose subscriber
+  transport::Node node;
+
+  std::mutex msgMutex;
+  std::vector<std::string> payloads;
+  std::function<void(const msgs::Bytes &)> cb = [&](const msgs::Bytes &_msg)
+  {
+    std::lock_guard<std::mutex> lock(msgMutex);
+    payloads.push_back(_msg.data());
+  };
+  EXPECT_TRUE(node.Subscribe("/world/default/pose/compact", cb));
+
+  // Run server
+  server.Run(true, 10, false);
+
+  unsigned int sleep{0u};
+  unsigned int maxSleep{30u};
+  bool received{false};
+  while (!received && sleep++ < maxSleep)
+  {
+    GZ_SLEEP_MS(100);
+    std::lock_guard<std::mutex> lock(msgMutex);
+    received = !payloads.empty();
+  }
+  ASSERT_TRUE(received);
+
+  std::lock_guard<std::mutex> lock(msgMutex);
+  const std::string &payload = payloads.front();
+
+  // Decode the payload header: version, sim time, entry count
+  std::size_t offset{0u};
+  auto read = [&payload, &offset](void *_data, std::size_t _size)
+  {
+    ASSERT_LE(offset + _size, payload.size());
+    std::memcpy(_data, payload.data() + offset, _size);
+    offset += _size;
+  };
+
+  uint8_t version{0u};
+  read(&version, sizeof(version));
+  EXPECT_EQ(1u, version);
+
+  int64_t sec{0};
+  int32_t nsec{0};
+  read(&sec, sizeof(sec));
+  read(&nsec, sizeof(nsec));
+
+  uint32_t count{0u};
+  read(&count, sizeof(count));
+  ASSERT_LT(0u, count);
+
+  // The box model sits at (1, 2, 3) with an identity rotation; one of the
+  // entries must decode back to that pose.
+  bool foundBox{false};
+  for (uint32_t i = 0u; i < count; ++i)
+  {
+    uint32_t id{0u};
+    read(&id, sizeof(id));
+
+    math::Vector3d pos;
+    for (std::size_t axis = 0u; axis < 3u; ++axis)
+    {
+      int32_t fixed{0};
+      read(&fixed, sizeof(fixed));
+      pos[axis] = fixed * 1e-4;
+    }
+
+    uint8_t maxIndex{0u};
+    read(&maxIndex, sizeof(maxIndex));
+    ASSERT_LT(maxIndex, 4u);
+
+    double comps[4] = {0.0, 0.0, 0.0, 0.0};
+    double squaredSum{0.0};
+    for (uint8_t c = 0u; c < 4u; ++c)
+    {
+      if (c == maxIndex)
+        continue;
+      int16_t fixed{0};
+      read(&fixed, sizeof(fixed));
+      comps[c] = fixed / (32767.0 * std::sqrt(2.0));
+      squaredSum += comps[c] * comps[c];
+    }
+    comps[maxIndex] = std::sqrt(std::max(0.0, 1.0 - squaredSum));
+    math::Quaterniond rot(comps[0], comps[1], comps[2], comps[3]);
+
+    if (pos.Equal(math::Vector3d(1, 2, 3), 1e-3) &&
+        rot.Equal(math::Quaterniond::Identity, 1e-3))
+    {
+      foundBox = true;
+    }
+  }
+  EXPECT_TRUE(foundBox);
+  EXPECT_EQ(payload.size(), offset);
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SceneInfo))
 {
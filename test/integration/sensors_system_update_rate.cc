@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include <gz/common/Util.hh>
 #include <gz/transport/Node.hh>
 #include <gz/utils/ExtraTestMacros.hh>
 
@@ -313,3 +314,59 @@ TEST_F(SensorsFixture, UpdateRate)
     EXPECT_FLOAT_EQ(1.0 / segmentationRate, dt);
   }
 }
+
+/////////////////////////////////////////////////
+// Verify that sensors keep publishing when the bounded staleness mode is
+// enabled, i.e. when the simulation loop no longer waits for the render
+// thread as long as sensor output is within the configured staleness cap.
+TEST_F(SensorsFixture, BoundedStaleness)
+{
+  // Enable bounded staleness through the environment so the stock
+  // sensor.sdf world can be reused as-is.
+  common::setenv("GZ_SIM_SENSORS_BOUNDED_STALENESS", "0.1");
+
+  gz::sim::ServerConfig serverConfig;
+
+  const std::string sdfFile =
+    common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+    "test", "worlds", "sensor.sdf");
+
+  serverConfig.SetSdfFile(sdfFile);
+
+  sim::Server server(serverConfig);
+
+  transport::Node node;
+  std::string prefix{"/world/camera_sensor/model/default_topics/"};
+
+  std::vector<double> imageTimestamps;
+  unsigned int imageCount = 0u;
+  auto cameraCb = std::function<void(const msgs::Image &)>(
+      [&](const auto &_msg)
+      {
+        double t = _msg.header().stamp().sec() +
+            _msg.header().stamp().nsec() * 1e-9;
+        imageTimestamps.push_back(t);
+        ++imageCount;
+      });
+  node.Subscribe(prefix + "link/camera_link/sensor/camera/image", cameraCb);
+
+  unsigned int iterations = 2000u;
+  server.Run(true, iterations, false);
+
+  // The loop may outrun the render thread by up to the staleness cap, so
+  // an exact message count cannot be asserted. Sensor output must still
+  // flow, and its timestamps must stay strictly increasing.
+  unsigned int sleep = 0;
+  unsigned int maxSleep = 50;
+  while (sleep++ < maxSleep && imageCount < 2u)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  EXPECT_LT(1u, imageCount);
+  for (unsigned int i = 1; i < imageTimestamps.size(); ++i)
+  {
+    EXPECT_LT(imageTimestamps[i-1], imageTimestamps[i]);
+  }
+
+  common::unsetenv("GZ_SIM_SENSORS_BOUNDED_STALENESS");
+}
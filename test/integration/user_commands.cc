@@ -342,6 +342,74 @@ TEST_F(UserCommandsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Create))
       components::Name("test_model")));
 }
 
+/////////////////////////////////////////////////
+TEST_F(UserCommandsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CreateBudgetCarryOver))
+{
+  // Start server with a budget small enough that each step executes
+  // exactly one queued command
+  ServerConfig serverConfig;
+  const auto sdfFile = std::string(PROJECT_SOURCE_PATH) +
+    "/test/worlds/user_commands_budget.sdf";
+  serverConfig.SetSdfFile(sdfFile);
+
+  Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // Create a system just to get the ECM
+  EntityComponentManager *ecm{nullptr};
+  test::Relay testSystem;
+  testSystem.OnPreUpdate([&](const UpdateInfo &,
+                             EntityComponentManager &_ecm)
+      {
+        ecm = &_ecm;
+      });
+  server.AddSystem(testSystem.systemPtr);
+
+  server.Run(true, 1, false);
+  ASSERT_NE(nullptr, ecm);
+
+  // Queue a burst of spawns
+  transport::Node node;
+  msgs::Boolean res;
+  bool result;
+  unsigned int timeout = 5000;
+  std::string service{"/world/user_commands_budget/create"};
+  for (int i = 0; i < 3; ++i)
+  {
+    auto modelStr = std::string("<?xml version=\"1.0\" ?>") +
+        "<sdf version='1.6'>" +
+        "<model name='budget_model_" + std::to_string(i) + "'>" +
+        "<link name='link'/>" +
+        "</model>" +
+        "</sdf>";
+    msgs::EntityFactory req;
+    req.set_sdf(modelStr);
+    EXPECT_TRUE(node.Request(service, req, timeout, res, result));
+    EXPECT_TRUE(result);
+    EXPECT_TRUE(res.data());
+  }
+
+  // One command fits the budget per step; the rest carry over in order
+  server.Run(true, 1, false);
+  EXPECT_NE(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_0")));
+  EXPECT_EQ(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_1")));
+  EXPECT_EQ(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_2")));
+
+  server.Run(true, 1, false);
+  EXPECT_NE(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_1")));
+  EXPECT_EQ(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_2")));
+
+  server.Run(true, 1, false);
+  EXPECT_NE(kNullEntity, ecm->EntityByComponents(components::Model(),
+      components::Name("budget_model_2")));
+}
+
 /////////////////////////////////////////////////
 TEST_F(UserCommandsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Remove))
 {
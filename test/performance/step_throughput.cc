@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2024 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/sim/ServerConfig.hh"
+#include "gz/sim/TestFixture.hh"
+
+using namespace gz;
+using namespace sim;
+
+/// \brief Step size used by all generated worlds, in seconds.
+static constexpr double kStepSize{0.001};
+
+/// \brief Result of one cell of the throughput matrix.
+struct CellResult
+{
+  /// \brief Number of models in the world
+  public: int models{0};
+
+  /// \brief Label of the system set loaded into the world
+  public: std::string systems;
+
+  /// \brief Steps per second of wall time
+  public: double stepsPerSec{0.0};
+
+  /// \brief Mean step latency in milliseconds
+  public: double meanMs{0.0};
+
+  /// \brief 99th percentile step latency in milliseconds
+  public: double p99Ms{0.0};
+
+  /// \brief Resident set size after the run, in kilobytes
+  public: std::size_t rssKb{0};
+
+  /// \brief Name of the CSV file with the per-step series
+  public: std::string csvFile;
+};
+
+//////////////////////////////////////////////////
+/// \brief Current resident set size in kilobytes, 0 if unavailable.
+std::size_t CurrentRssKb()
+{
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.rfind("VmRSS:", 0) == 0)
+      return std::stoul(line.substr(6));
+  }
+#endif
+  return 0;
+}
+
+//////////////////////////////////////////////////
+/// \brief Generate a world with a ground plane and a grid of falling boxes.
+/// \param[in] _numModels Number of box models
+/// \param[in] _sceneBroadcaster True to also load the scene broadcaster,
+/// which adds state serialization and a post-update system to each step
+/// \return World SDF string
+std::string WorldSdf(int _numModels, bool _sceneBroadcaster)
+{
+  std::ostringstream out;
+  out << "<?xml version='1.0'?>"
+      << "<sdf version='1.9'><world name='step_throughput'>"
+      << "<physics name='1ms' type='ignored'>"
+      << "<max_step_size>" << kStepSize << "</max_step_size>"
+      << "<real_time_factor>0</real_time_factor>"
+      << "</physics>"
+      << "<plugin filename='gz-sim-physics-system' "
+      << "name='gz::sim::systems::Physics'/>";
+
+  if (_sceneBroadcaster)
+  {
+    out << "<plugin filename='gz-sim-scene-broadcaster-system' "
+        << "name='gz::sim::systems::SceneBroadcaster'/>";
+  }
+
+  out << "<model name='ground'><static>true</static><link name='link'>"
+      << "<collision name='col'><geometry><plane>"
+      << "<normal>0 0 1</normal><size>10000 10000</size>"
+      << "</plane></geometry></collision>"
+      << "</link></model>";
+
+  // Boxes on a grid, spaced out so they never touch each other and all the
+  // contact work comes from landing on the ground plane.
+  const int perRow = static_cast<int>(std::ceil(std::sqrt(_numModels)));
+  for (int i = 0; i < _numModels; ++i)
+  {
+    const double x = (i % perRow) * 2.0;
+    const double y = (i / perRow) * 2.0;
+    out << "<model name='box_" << i << "'>"
+        << "<pose>" << x << " " << y << " 1 0 0 0</pose>"
+        << "<link name='link'>"
+        << "<collision name='col'><geometry><box>"
+        << "<size>1 1 1</size></box></geometry></collision>"
+        << "</link></model>";
+  }
+
+  out << "</world></sdf>";
+  return out.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief Run one cell of the matrix and write its per-step series to a
+/// CSV file readable by gz_perf.py.
+/// \param[in] _models Number of box models
+/// \param[in] _sceneBroadcaster Whether to load the scene broadcaster
+/// \param[in] _iterations Number of steps to run
+/// \return Measurements for the cell
+CellResult RunCell(int _models, bool _sceneBroadcaster,
+    unsigned int _iterations)
+{
+  CellResult result;
+  result.models = _models;
+  result.systems = _sceneBroadcaster ? "physics+scene_broadcaster"
+                                     : "physics";
+
+  ServerConfig config;
+  config.SetSdfString(WorldSdf(_models, _sceneBroadcaster));
+
+  TestFixture fixture(config);
+
+  std::vector<std::chrono::steady_clock::time_point> stamps;
+  stamps.reserve(_iterations);
+  fixture.OnPostUpdate(
+      [&stamps](const UpdateInfo &, const EntityComponentManager &)
+      {
+        stamps.push_back(std::chrono::steady_clock::now());
+      }).Finalize();
+
+  fixture.Step(_iterations);
+
+  result.rssKb = CurrentRssKb();
+
+  if (stamps.size() < 2)
+    return result;
+
+  std::vector<double> dtsMs;
+  dtsMs.reserve(stamps.size() - 1);
+  for (std::size_t i = 1; i < stamps.size(); ++i)
+  {
+    dtsMs.push_back(std::chrono::duration<double, std::milli>(
+        stamps[i] - stamps[i - 1]).count());
+  }
+
+  const double totalSec = std::chrono::duration<double>(
+      stamps.back() - stamps.front()).count();
+  result.stepsPerSec = dtsMs.size() / totalSec;
+  result.meanMs = 1e3 * totalSec / dtsMs.size();
+
+  std::vector<double> sorted = dtsMs;
+  std::sort(sorted.begin(), sorted.end());
+  const std::size_t p99Index = static_cast<std::size_t>(
+      std::ceil(0.99 * sorted.size())) - 1;
+  result.p99Ms = sorted[std::min(p99Index, sorted.size() - 1)];
+
+  // Per-step series in the same column layout as sdf_runner's data.csv:
+  // real seconds, real nanoseconds, sim seconds, sim nanoseconds
+  std::ostringstream name;
+  name << "step_throughput_" << _models << "_" << result.systems << ".csv";
+  result.csvFile = name.str();
+
+  std::ofstream csv(result.csvFile);
+  csv << "# real_s, real_ns, sim_s, sim_ns\n";
+  for (std::size_t i = 0; i < stamps.size(); ++i)
+  {
+    const auto real = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        stamps[i] - stamps.front()).count();
+    const auto sim = static_cast<int64_t>(i * kStepSize * 1e9);
+    csv << real / 1000000000 << ", " << real % 1000000000 << ", "
+        << sim / 1000000000 << ", " << sim % 1000000000 << "\n";
+  }
+
+  return result;
+}
+
+//////////////////////////////////////////////////
+int main(int _argc, char **_argv)
+{
+  common::Console::SetVerbosity(2);
+
+  unsigned int iterations{2000};
+  if (_argc >= 2)
+    iterations = atoi(_argv[1]);
+
+  int maxModels{1000};
+  if (_argc >= 3)
+    maxModels = atoi(_argv[2]);
+
+  std::vector<int> modelCounts;
+  for (int count = 1; count <= maxModels; count *= 10)
+    modelCounts.push_back(count);
+
+  std::vector<CellResult> results;
+  for (const int models : modelCounts)
+  {
+    for (const bool sceneBroadcaster : {false, true})
+    {
+      std::cout << "Running " << iterations << " steps with " << models
+                << " models, "
+                << (sceneBroadcaster ? "physics+scene_broadcaster"
+                                     : "physics")
+                << std::endl;
+      results.push_back(RunCell(models, sceneBroadcaster, iterations));
+
+      const auto &r = results.back();
+      std::cout << "  steps/sec: " << r.stepsPerSec
+                << "  mean: " << r.meanMs << " ms"
+                << "  p99: " << r.p99Ms << " ms"
+                << "  rss: " << r.rssKb << " kB" << std::endl;
+    }
+  }
+
+  // Machine-readable summary of the whole matrix
+  std::ofstream json("step_throughput.json");
+  json << "[\n";
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    const auto &r = results[i];
+    json << "  {\"models\": " << r.models
+         << ", \"systems\": \"" << r.systems << "\""
+         << ", \"iterations\": " << iterations
+         << ", \"steps_per_sec\": " << r.stepsPerSec
+         << ", \"mean_ms\": " << r.meanMs
+         << ", \"p99_ms\": " << r.p99Ms
+         << ", \"rss_kb\": " << r.rssKb
+         << ", \"csv\": \"" << r.csvFile << "\"}"
+         << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  json << "]\n";
+
+  std::cout << "Wrote step_throughput.json and one CSV per cell, readable "
+            << "with gz_perf.py" << std::endl;
+
+  return 0;
+}